@@ -0,0 +1,92 @@
+#include "solid_shape.h"
+
+#include <opencascade/BRepBndLib.hxx>
+#include <opencascade/BRepBuilderAPI_MakeVertex.hxx>
+#include <opencascade/BRep_Builder.hxx>
+#include <opencascade/Bnd_Box.hxx>
+#include <opencascade/Precision.hxx>
+#include <opencascade/STEPControl_Reader.hxx>
+#include <opencascade/TopExp_Explorer.hxx>
+#include <opencascade/TopoDS.hxx>
+#include <opencascade/TopoDS_Compound.hxx>
+
+#include <filesystem>
+
+namespace SPH
+{
+//=================================================================================================//
+SolidShape::SolidShape(const TopoDS_Shape &solid, const std::string &shape_name)
+    : Shape(shape_name), solid_(solid), tolerance_(Precision::Confusion()),
+      classifiers_([&]()
+                   { return makeUnique<BRepClass3d_SolidClassifier>(solid_); }),
+      distance_tools_([&]()
+                      {
+                          UniquePtr<BRepExtrema_DistShapeShape> distance_tool = makeUnique<BRepExtrema_DistShapeShape>();
+                          distance_tool->LoadS1(boundary_);
+                          return distance_tool; })
+{
+    BRep_Builder builder;
+    TopoDS_Compound faces;
+    builder.MakeCompound(faces);
+    for (TopExp_Explorer explorer(solid_, TopAbs_FACE); explorer.More(); explorer.Next())
+    {
+        builder.Add(faces, explorer.Current());
+    }
+    boundary_ = faces;
+}
+//=================================================================================================//
+bool SolidShape::checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED)
+{
+    BRepClass3d_SolidClassifier &classifier = *classifiers_.local();
+    classifier.Perform(EigenToOcct(probe_point), tolerance_);
+    TopAbs_State state = classifier.State();
+    return state == TopAbs_IN || (BOUNDARY_INCLUDED && state == TopAbs_ON);
+}
+//=================================================================================================//
+Vecd SolidShape::findClosestPoint(const Vecd &probe_point)
+{
+    BRepExtrema_DistShapeShape &distance_tool = *distance_tools_.local();
+    distance_tool.LoadS2(BRepBuilderAPI_MakeVertex(EigenToOcct(probe_point)).Vertex());
+    if (!distance_tool.Perform() || distance_tool.NbSolution() == 0)
+    {
+        std::cout << "\n Error: the closest point to the solid is not found!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    return OcctToEigen(distance_tool.PointOnShape1(1));
+}
+//=================================================================================================//
+BoundingBoxd SolidShape::findBounds()
+{
+    Bnd_Box box;
+    BRepBndLib::Add(solid_, box);
+    Standard_Real x_min, y_min, z_min, x_max, y_max, z_max;
+    box.Get(x_min, y_min, z_min, x_max, y_max, z_max);
+    return BoundingBoxd(Vecd(x_min, y_min, z_min), Vecd(x_max, y_max, z_max));
+}
+//=================================================================================================//
+SolidShapeSTEP::SolidShapeSTEP(Standard_CString &filepathname, const std::string &shape_name)
+    : SolidShape(readSolid(filepathname), shape_name), geometry_hash_(0)
+{
+    std::filesystem::path path(filepathname);
+    geometry_hash_ = hashCombine(std::hash<std::string>{}(std::filesystem::absolute(path).string()),
+                                 std::filesystem::file_size(path));
+    geometry_hash_ = hashCombine(geometry_hash_, static_cast<size_t>(
+                                                     std::filesystem::last_write_time(path).time_since_epoch().count()));
+}
+//=================================================================================================//
+TopoDS_Shape SolidShapeSTEP::readSolid(Standard_CString &filepathname)
+{
+    if (!std::filesystem::exists(filepathname))
+    {
+        std::cout << "\n Error: the input file:" << filepathname << " is not exists" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    STEPControl_Reader step_reader;
+    step_reader.ReadFile(filepathname);
+    step_reader.TransferRoots();
+    return step_reader.OneShape();
+}
+//=================================================================================================//
+} // namespace SPH
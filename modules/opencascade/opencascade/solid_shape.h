@@ -0,0 +1,78 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	solid_shape.h
+ * @brief 	Volumetric shape defined directly by the B-Rep solid of a CAD model.
+ * @details The distance and containment queries are answered by OpenCASCADE
+ * 			without tessellating the surface into a triangle mesh,
+ * 			so that a level set with fine resolution does not need a huge intermediate mesh.
+ * 			The query tools are loaded once for each thread as the level set is built in parallel.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef SOLID_SHAPE_H
+#define SOLID_SHAPE_H
+
+#include "sphinxsys.h"
+#include "vector.h"
+
+#include <opencascade/BRepClass3d_SolidClassifier.hxx>
+#include <opencascade/BRepExtrema_DistShapeShape.hxx>
+#include <opencascade/Standard_TypeDef.hxx>
+#include <opencascade/TopoDS_Shape.hxx>
+#include <tbb/enumerable_thread_specific.h>
+
+namespace SPH
+{
+class SolidShape : public Shape
+{
+  public:
+    SolidShape(const TopoDS_Shape &solid, const std::string &shape_name);
+    virtual ~SolidShape() {};
+
+    virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
+    virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual BoundingBoxd findBounds() override;
+
+  protected:
+    TopoDS_Shape solid_;
+    TopoDS_Shape boundary_;    /**< the faces only, as the distance to a solid vanishes inside */
+    Standard_Real tolerance_; /**< for points on the boundary */
+    tbb::enumerable_thread_specific<UniquePtr<BRepClass3d_SolidClassifier>> classifiers_;
+    tbb::enumerable_thread_specific<UniquePtr<BRepExtrema_DistShapeShape>> distance_tools_;
+};
+
+class SolidShapeSTEP : public SolidShape
+{
+  public:
+    explicit SolidShapeSTEP(Standard_CString &filepathname,
+                            const std::string &shape_name = "SolidShapeSTEP");
+    virtual ~SolidShapeSTEP() {};
+    virtual size_t GeometryHash() override { return geometry_hash_; };
+
+  protected:
+    size_t geometry_hash_;
+    static TopoDS_Shape readSolid(Standard_CString &filepathname);
+};
+} // namespace SPH
+#endif // SOLID_SHAPE_H
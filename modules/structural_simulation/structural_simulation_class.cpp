@@ -232,20 +232,10 @@ StructuralSimulation::StructuralSimulation(const StructuralSimulationInput &inpu
     // contacts
     initializeAllContacts();
     // boundary conditions
-    initializeGravity();
-    initializeExternalForceInBoundingBox();
-    initializeForceInBodyRegion();
-    initializeSurfacePressure();
-    initializeSpringDamperConstraintParticleWise();
-    initializeSpringNormalOnSurfaceParticles();
-    initializeConstrainSolidBody();
-    initializeConstrainSolidBodyRegion();
-    initializePositionSolidBody();
-    initializePositionScaleSolidBody();
-    initializeTranslateSolidBody();
-    initializeTranslateSolidBodyPart();
+    initializeBoundaryConditions();
     // initialize simulation
     initializeSimulation();
+    saveInitialParticleStates();
 }
 
 StructuralSimulation::~StructuralSimulation()
@@ -388,6 +378,22 @@ void StructuralSimulation::initializeAllContacts()
     }
 }
 
+void StructuralSimulation::initializeBoundaryConditions()
+{
+    initializeGravity();
+    initializeExternalForceInBoundingBox();
+    initializeForceInBodyRegion();
+    initializeSurfacePressure();
+    initializeSpringDamperConstraintParticleWise();
+    initializeSpringNormalOnSurfaceParticles();
+    initializeConstrainSolidBody();
+    initializeConstrainSolidBodyRegion();
+    initializePositionSolidBody();
+    initializePositionScaleSolidBody();
+    initializeTranslateSolidBody();
+    initializeTranslateSolidBodyPart();
+}
+
 void StructuralSimulation::initializeGravity()
 {
     // collect all the body indices with non-zero gravity
@@ -398,6 +404,8 @@ void StructuralSimulation::initializeGravity()
     }
     // initialize gravity
     initialize_gravity_ = {};
+    gravity_list_ = {};
+    gravity_list_.reserve(non_zero_gravity_.size()); // no reallocation while adding
     size_t gravity_index_i = 0; // iterating through gravity_indices
     for (size_t i = 0; i < solid_body_list_.size(); i++)
     {
@@ -828,6 +836,101 @@ void StructuralSimulation::initializeSimulation()
     executeCorrectConfiguration();
 }
 
+template <typename DataType>
+void StructuralSimulation::SaveParticleState::
+operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t total_particles, StdVec<char> &buffer)
+{
+    // the number of variables first, as variables may be registered later
+    size_t number_of_variables = data_keeper.size();
+    const char *size_data = reinterpret_cast<const char *>(&number_of_variables);
+    buffer.insert(buffer.end(), size_data, size_data + sizeof(size_t));
+    for (size_t k = 0; k != number_of_variables; ++k)
+    {
+        const char *data = reinterpret_cast<const char *>(data_keeper[k]);
+        buffer.insert(buffer.end(), data, data + total_particles * sizeof(DataType));
+    }
+}
+
+template <typename DataType>
+void StructuralSimulation::RestoreParticleState::
+operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t total_particles,
+           const StdVec<char> &buffer, size_t &buffer_position)
+{
+    size_t number_of_variables = 0;
+    std::memcpy(&number_of_variables, &buffer[buffer_position], sizeof(size_t));
+    buffer_position += sizeof(size_t);
+    for (size_t k = 0; k != number_of_variables; ++k)
+    {
+        std::memcpy(static_cast<void *>(data_keeper[k]), &buffer[buffer_position], total_particles * sizeof(DataType));
+        buffer_position += total_particles * sizeof(DataType);
+    }
+}
+
+void StructuralSimulation::saveInitialParticleStates()
+{
+    OperationOnDataAssemble<ParticleData, SaveParticleState> save_particle_state;
+    initial_particle_states_ = {};
+    for (size_t i = 0; i < solid_body_list_.size(); i++)
+    {
+        BaseParticles &particles = solid_body_list_[i]->getSolidBodyFromMesh()->getBaseParticles();
+        initial_particle_states_.emplace_back();
+        save_particle_state(particles.all_state_data_, particles.TotalRealParticles(), initial_particle_states_.back());
+    }
+}
+
+void StructuralSimulation::restoreInitialParticleStates()
+{
+    OperationOnDataAssemble<ParticleData, RestoreParticleState> restore_particle_state;
+    for (size_t i = 0; i < solid_body_list_.size(); i++)
+    {
+        BaseParticles &particles = solid_body_list_[i]->getSolidBodyFromMesh()->getBaseParticles();
+        size_t buffer_position = 0;
+        restore_particle_state(particles.all_state_data_, particles.TotalRealParticles(),
+                               initial_particle_states_[i], buffer_position);
+    }
+}
+
+void StructuralSimulation::resetSimulation(const StructuralSimulationInput &input)
+{
+    if (input.material_model_list_.size() != solid_body_list_.size())
+    {
+        std::cout << "\n Error: the number of material models does not match the number of bodies!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    // material parameters, the dynamics refer to the materials owned by the bodies
+    for (size_t i = 0; i < solid_body_list_.size(); i++)
+    {
+        SaintVenantKirchhoffSolid &material = DynamicCast<SaintVenantKirchhoffSolid>(
+            this, solid_body_list_[i]->getSolidBodyFromMesh()->getBaseMaterial());
+        material.resetElasticModuli(input.material_model_list_[i]->getYoungsModulus(),
+                                    input.material_model_list_[i]->getPoissonRatio());
+    }
+    material_model_list_ = input.material_model_list_;
+
+    // boundary conditions
+    non_zero_gravity_ = input.non_zero_gravity_;
+    force_bounding_box_tuple_ = input.force_bounding_box_tuple_;
+    force_in_body_region_tuple_ = input.force_in_body_region_tuple_;
+    surface_pressure_tuple_ = input.surface_pressure_tuple_;
+    spring_damper_tuple_ = input.spring_damper_tuple_;
+    surface_spring_tuple_ = input.surface_spring_tuple_;
+    body_indices_fixed_constraint_ = input.body_indices_fixed_constraint_;
+    body_indices_fixed_constraint_region_ = input.body_indices_fixed_constraint_region_;
+    position_solid_body_tuple_ = input.position_solid_body_tuple_;
+    position_scale_solid_body_tuple_ = input.position_scale_solid_body_tuple_;
+    translation_solid_body_tuple_ = input.translation_solid_body_tuple_;
+    translation_solid_body_part_tuple_ = input.translation_solid_body_part_tuple_;
+    initializeBoundaryConditions();
+
+    // the initial configuration
+    restoreInitialParticleStates();
+    physical_time_ = 0.0;
+    iteration_ = 0;
+    system_.initializeSystemCellLinkedLists();
+    system_.initializeSystemConfigurations();
+}
+
 void StructuralSimulation::runSimulationStep(Real &dt, Real &integration_time)
 {
     if (iteration_ % 100 == 0)
@@ -986,6 +1089,13 @@ void StructuralSimulationJS::runSimulationFixedDuration(int number_of_steps)
     std::cout << "Total time for computation: " << t_interval.seconds() << " seconds." << std::endl;
 }
 
+void StructuralSimulationJS::resetSimulation(const StructuralSimulationInput &input)
+{
+    StructuralSimulation::resetSimulation(input);
+    dt = 0.0;
+    write_states_.writeToFile(0);
+}
+
 VtuStringData StructuralSimulationJS::getVtuData()
 {
     write_states_.writeToFile();
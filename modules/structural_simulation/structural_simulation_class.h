@@ -259,6 +259,7 @@ class StructuralSimulation
     void initializeAllContacts();
 
     // for initializeBoundaryConditions
+    void initializeBoundaryConditions();
     void initializeGravity();
     void initializeExternalForceInBoundingBox();
     void initializeForceInBodyRegion();
@@ -298,6 +299,24 @@ class StructuralSimulation
 
     void initializeSimulation();
 
+    // for resetSimulation, the particle states just after initializeSimulation
+    StdVec<StdVec<char>> initial_particle_states_;
+    void saveInitialParticleStates();
+    void restoreInitialParticleStates();
+
+    struct SaveParticleState
+    {
+        template <typename DataType>
+        void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t total_particles, StdVec<char> &buffer);
+    };
+
+    struct RestoreParticleState
+    {
+        template <typename DataType>
+        void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t total_particles,
+                        const StdVec<char> &buffer, size_t &buffer_position);
+    };
+
     void runSimulationStep(Real &dt, Real &integration_time);
 
   public:
@@ -312,6 +331,14 @@ class StructuralSimulation
 
     // For JS
     double runSimulationFixedDurationJS(int number_of_steps);
+
+    /**
+     * Start a new run without rebuilding the bodies, particles, level sets and relations.
+     * The particle states are reset to the initial configuration, the elastic moduli
+     * are taken from the material models and all boundary conditions from the input.
+     * The body geometries, resolutions, densities and contacts of the input are not used.
+     */
+    void resetSimulation(const StructuralSimulationInput &input);
 };
 
 class StructuralSimulationJS : public StructuralSimulation
@@ -321,6 +348,7 @@ class StructuralSimulationJS : public StructuralSimulation
     ~StructuralSimulationJS() = default;
 
     void runSimulationFixedDuration(int number_of_steps);
+    void resetSimulation(const StructuralSimulationInput &input);
 
     VtuStringData getVtuData();
 
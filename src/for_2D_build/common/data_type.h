@@ -37,6 +37,7 @@ namespace SPH
 {
 using Arrayi = Array2i;
 using Vecd = Vec2d;
+using AccumulationVecd = AccumulationVec<2>;
 using Matd = Mat2d;
 using VecMatd = Vec3d;           // vectorized symmetric 2x2 matrix
 using MatTend = Mat3d;           // matricized symmetric 2x2x2x2 tensor
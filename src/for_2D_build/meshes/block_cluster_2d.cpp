@@ -0,0 +1,73 @@
+#include "block_cluster_2d.h"
+
+namespace SPH
+{
+//=============================================================================================//
+std::vector<Block2D> clusterActiveCells2D(const std::vector<Coord2D> &activeCells)
+{
+    std::unordered_set<Coord2D, Coord2DHash> activeSet(activeCells.begin(), activeCells.end());
+    std::vector<Block2D> blocks;
+
+    while (!activeSet.empty())
+    {
+        Coord2D start = *activeSet.begin();
+        int x0 = start[0], y0 = start[1];
+        int x1 = x0;
+
+        // Extend in x
+        while (activeSet.count({x1 + 1, y0}))
+            ++x1;
+
+        // Extend in y
+        int y1 = y0;
+        bool extendY = true;
+        while (extendY)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                if (!activeSet.count({x, y1 + 1}))
+                {
+                    extendY = false;
+                    break;
+                }
+            }
+            if (extendY)
+                ++y1;
+        }
+
+        // Remove covered cells
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                activeSet.erase({x, y});
+            }
+        }
+
+        blocks.push_back({{x0, y0}, {x1, y1}});
+    }
+
+    return blocks;
+}
+//=============================================================================================//
+StdVec<MeshRange> clusterActiveCells(const StdVec<Arrayi> &active_cells)
+{
+    StdVec<Coord2D> coords;
+    coords.reserve(active_cells.size());
+    for (const Arrayi &cell : active_cells)
+    {
+        coords.push_back({cell[0], cell[1]});
+    }
+
+    StdVec<MeshRange> mesh_ranges;
+    for (const Block2D &block : clusterActiveCells2D(coords))
+    {
+        mesh_ranges.push_back(
+            MeshRange(Arrayi(block.first[0], block.first[1]),
+                      Arrayi(block.second[0] + 1, block.second[1] + 1)));
+    }
+    return mesh_ranges;
+}
+//=============================================================================================//
+} // namespace SPH
+//=============================================================================================//
@@ -0,0 +1,20 @@
+#include "mesh_iterators.h"
+#include <unordered_set>
+
+#pragma once
+
+namespace SPH
+{
+using Coord2D = std::array<int, 2>;
+using Block2D = std::pair<Coord2D, Coord2D>; // {min_corner}, {max_corner}
+
+struct Coord2DHash
+{
+    std::size_t operator()(const Coord2D &coord) const
+    {
+        return std::hash<int>()(coord[0]) ^ (std::hash<int>()(coord[1]) << 1);
+    }
+};
+
+std::vector<Block2D> clusterActiveCells2D(const std::vector<Coord2D> &activeCells);
+} // namespace SPH
@@ -36,6 +36,7 @@ namespace SPH
 {
 using Arrayi = Array3i;
 using Vecd = Vec3d;
+using AccumulationVecd = AccumulationVec<3>;
 using Matd = Mat3d;
 using VecMatd = Vec6d;           // vectorized symmetric 3x3 matrix
 using MatTend = Mat6d;           // matricized symmetric 3x3x3x3 tensor
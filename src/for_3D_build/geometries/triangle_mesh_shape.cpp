@@ -1,9 +1,74 @@
 #include "triangle_mesh_shape.h"
 
 #include "sph_system.h"
+
+#include "tbb/parallel_sort.h"
+
+#include <cstring>
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace SPH
 {
 //=================================================================================================//
+/** Read-only view of a whole file, memory mapped if supported by the platform. */
+class MappedFile
+{
+  public:
+    explicit MappedFile(const std::string &file_path_name)
+    {
+#ifdef _WIN32
+        std::ifstream in_file(file_path_name, std::ios::binary | std::ios::ate);
+        size_ = in_file ? size_t(in_file.tellg()) : 0;
+        buffer_.resize(size_);
+        in_file.seekg(0);
+        in_file.read(buffer_.data(), size_);
+        data_ = buffer_.data();
+#else
+        int file_descriptor = open(file_path_name.c_str(), O_RDONLY);
+        struct stat file_status;
+        if (file_descriptor != -1 && fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0)
+        {
+            size_ = size_t(file_status.st_size);
+            void *mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if (mapped != MAP_FAILED)
+            {
+                madvise(mapped, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char *>(mapped);
+            }
+        }
+        if (file_descriptor != -1)
+        {
+            close(file_descriptor);
+        }
+#endif
+    };
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (data_ != nullptr)
+        {
+            munmap(const_cast<char *>(data_), size_);
+        }
+#endif
+    };
+    const char *Data() { return data_; };
+    size_t Size() { return data_ != nullptr ? size_ : 0; };
+
+  private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    std::vector<char> buffer_;
+#endif
+};
+//=================================================================================================//
 TriangleMeshShape::TriangleMeshShape(const std::string &shape_name) : Shape(shape_name) {}
 //=================================================================================================//
 void TriangleMeshShape::writeMeshToFile(SPHSystem &sph_system, Transform transform)
@@ -105,6 +170,11 @@ void TriangleMeshShape::initializeFromPolygonalMesh(const SimTK::PolygonalMesh &
 void TriangleMeshShape::initializeFromSTLMesh(
     const std::string &file_path_name, Vec3d translation, Real scale_factor)
 {
+    if (initializeFromBinarySTLMesh(file_path_name, translation, scale_factor))
+    {
+        return;
+    }
+
     std::vector<float> coords, normals;
     std::vector<size_t> tris, solids;
     stl_reader::ReadStlFile(file_path_name.c_str(), coords, normals, tris, solids);
@@ -131,6 +201,95 @@ void TriangleMeshShape::initializeFromSTLMesh(
     triangle_mesh_distance_.construct(vertices_, faces_);
 }
 //=================================================================================================//
+bool TriangleMeshShape::initializeFromBinarySTLMesh(
+    const std::string &file_path_name, Vec3d translation, Real scale_factor)
+{
+    // binary STL: 80 bytes header, facet number, and 50 bytes per facet,
+    // i.e. normal, three vertices in float and two bytes attribute
+    constexpr size_t header_bytes = 84;
+    constexpr size_t facet_bytes = 50;
+    MappedFile mapped_file(file_path_name);
+    const char *data = mapped_file.Data();
+    if (mapped_file.Size() < header_bytes)
+    {
+        return false;
+    }
+    uint32_t number_of_facets = 0;
+    std::memcpy(&number_of_facets, data + 80, sizeof(number_of_facets));
+    if (mapped_file.Size() != header_bytes + facet_bytes * size_t(number_of_facets))
+    {
+        return false; // ASCII STL
+    }
+
+    struct FacetVertex
+    {
+        std::array<float, 3> position_;
+        size_t corner_; /**< 3 * facet + corner index */
+    };
+    const size_t number_of_corners = 3 * size_t(number_of_facets);
+    StdVec<FacetVertex> corners(number_of_corners);
+    parallel_for(
+        IndexRange(0, number_of_facets),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                const char *facet = data + header_bytes + facet_bytes * i;
+                for (size_t k = 0; k != 3; ++k)
+                {
+                    FacetVertex &corner = corners[3 * i + k];
+                    std::memcpy(corner.position_.data(), facet + 12 * (k + 1), 3 * sizeof(float));
+                    corner.corner_ = 3 * i + k;
+                }
+            }
+        },
+        ap);
+
+    // identical vertices are adjacent after sorting
+    tbb::parallel_sort(corners.begin(), corners.end(),
+                       [](const FacetVertex &a, const FacetVertex &b)
+                       { return a.position_ < b.position_; });
+    StdVec<int> vertex_index(number_of_corners);
+    int number_of_vertices = 0;
+    for (size_t n = 0; n != number_of_corners; ++n)
+    {
+        if (n != 0 && corners[n].position_ != corners[n - 1].position_)
+        {
+            number_of_vertices++;
+        }
+        vertex_index[n] = number_of_vertices;
+    }
+    number_of_vertices += number_of_corners != 0 ? 1 : 0;
+
+    vertices_.resize(number_of_vertices);
+    faces_.resize(number_of_facets);
+    parallel_for(
+        IndexRange(0, number_of_corners),
+        [&](const IndexRange &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                const FacetVertex &corner = corners[n];
+                faces_[corner.corner_ / 3][corner.corner_ % 3] = vertex_index[n];
+                if (n == 0 || vertex_index[n] != vertex_index[n - 1])
+                {
+                    for (int j = 0; j != 3; ++j)
+                    {
+                        vertices_[vertex_index[n]][j] =
+                            Real(corner.position_[j]) * scale_factor + Real(translation[j]);
+                    }
+                }
+            }
+        },
+        ap);
+
+    std::cout << "TriangleMesh:" << name_ << std::endl;
+    std::cout << "num of vertices:" << vertices_.size() << std::endl;
+    std::cout << "num of faces:" << faces_.size() << std::endl;
+    triangle_mesh_distance_.construct(vertices_, faces_);
+    return true;
+}
+//=================================================================================================//
 bool TriangleMeshShape::checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED)
 {
     Real distance = triangle_mesh_distance_.signed_distance(probe_point).distance;
@@ -144,6 +303,11 @@ Vecd TriangleMeshShape::findClosestPoint(const Vecd &probe_point)
     return Vecd(closest_pnt[0], closest_pnt[1], closest_pnt[2]);
 }
 //=================================================================================================//
+Real TriangleMeshShape::findSignedDistance(const Vec3d &probe_point)
+{
+    return triangle_mesh_distance_.signed_distance(probe_point).distance;
+}
+//=================================================================================================//
 BoundingBoxd TriangleMeshShape::findBounds()
 {
     // initial reference values
@@ -161,6 +325,19 @@ BoundingBoxd TriangleMeshShape::findBounds()
     return BoundingBoxd(lower_bound, upper_bound);
 }
 //=================================================================================================//
+size_t TriangleMeshShape::GeometryHash()
+{
+    size_t hash = std::hash<size_t>{}(faces_.size());
+    for (const auto &vertex : vertices_)
+        for (const Real &coordinate : vertex)
+            hash = hashCombine(hash, std::hash<Real>{}(coordinate));
+
+    for (const auto &face : faces_)
+        for (const int &vertex_index : face)
+            hash = hashCombine(hash, std::hash<int>{}(vertex_index));
+    return hash;
+}
+//=================================================================================================//
 TriangleMeshShapeBrick::TriangleMeshShapeBrick(Vecd halfsize, int resolution, Vecd translation,
                                                const std::string &shape_name)
     : TriangleMeshShape(shape_name)
@@ -57,7 +57,10 @@ class TriangleMeshShape : public Shape
      * when probe distance is far from the surface. */
     virtual bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vec3d findClosestPoint(const Vec3d &probe_point) override;
+    /** Sign and distance are obtained from a single tree query. */
+    virtual Real findSignedDistance(const Vec3d &probe_point) override;
     virtual BoundingBoxd findBounds() override;
+    virtual size_t GeometryHash() override;
     StdVec<std::array<Real, 3>> &getVertices() { return vertices_; }
     StdVec<std::array<int, 3>> &getFaces() { return faces_; }
     void writeMeshToFile(SPHSystem &sph_system, Transform transform = Transform());
@@ -68,6 +71,9 @@ class TriangleMeshShape : public Shape
     tmd::TriangleMeshDistance triangle_mesh_distance_;
     void initializeFromPolygonalMesh(const SimTK::PolygonalMesh &poly_mesh);
     void initializeFromSTLMesh(const std::string &file_path_name, Vec3d translation, Real scale_factor);
+    /** The binary file is memory mapped, and the facets are parsed and the vertices deduplicated in parallel.
+     * Returns false if the file is not a binary STL file. */
+    bool initializeFromBinarySTLMesh(const std::string &file_path_name, Vec3d translation, Real scale_factor);
 };
 
 /**
@@ -0,0 +1,34 @@
+#include "io_xdmf.hpp"
+
+#include "io_environment.h"
+#include "triangle_mesh_shape.h"
+
+namespace SPH
+{
+//=================================================================================================//
+BodyStatesRecordingToTriangleMeshXdmf::BodyStatesRecordingToTriangleMeshXdmf(
+    SPHBody &body, TriangleMeshShape &triangle_mesh_shape)
+    : BodyStatesRecordingToXdmf(body), number_of_faces_(triangle_mesh_shape.getFaces().size())
+{
+    StdVec<std::array<int, 3>> &faces = triangle_mesh_shape.getFaces();
+    std::string filefullpath = io_environment_.OutputFolder() + "/" + data_file_names_[0];
+    std::ofstream data_file(filefullpath.c_str(), std::ios::app | std::ios::binary);
+    connectivity_ = appendDataItem<int32_t>(data_file, data_file_sizes_[0], "Connectivity", "Scalar",
+                                            3, number_of_faces_,
+                                            [&](size_t i, int32_t *value)
+                                            {
+                                                for (int k = 0; k != 3; ++k)
+                                                    value[k] = int32_t(faces[i][k]);
+                                            });
+    data_file.close();
+}
+//=================================================================================================//
+void BodyStatesRecordingToTriangleMeshXdmf::writeTopology(std::ofstream &xdmf_file, size_t body_index,
+                                                          size_t total_real_particles)
+{
+    xdmf_file << "    <Topology TopologyType=\"Triangle\" NumberOfElements=\"" << number_of_faces_ << "\">\n";
+    writeDataItem(xdmf_file, connectivity_, number_of_faces_, data_file_names_[body_index]);
+    xdmf_file << "    </Topology>\n";
+}
+//=================================================================================================//
+} // namespace SPH
@@ -75,5 +75,24 @@ std::vector<Block3D> clusterActiveCells3D(const std::vector<Coord3D> &activeCell
     return blocks;
 }
 //=============================================================================================//
+StdVec<MeshRange> clusterActiveCells(const StdVec<Arrayi> &active_cells)
+{
+    StdVec<Coord3D> coords;
+    coords.reserve(active_cells.size());
+    for (const Arrayi &cell : active_cells)
+    {
+        coords.push_back({cell[0], cell[1], cell[2]});
+    }
+
+    StdVec<MeshRange> mesh_ranges;
+    for (const Block3D &block : clusterActiveCells3D(coords))
+    {
+        mesh_ranges.push_back(
+            MeshRange(Arrayi(block.first[0], block.first[1], block.first[2]),
+                      Arrayi(block.second[0] + 1, block.second[1] + 1, block.second[2] + 1)));
+    }
+    return mesh_ranges;
+}
+//=============================================================================================//
 } // namespace SPH
 //=============================================================================================//
\ No newline at end of file
@@ -34,6 +34,7 @@
 #include "particle_generator_lattice.h"
 #include "particle_generator_mesh.h"
 #include "particle_generator_network.h"
+#include "particle_generator_refinement.h"
 #include "particle_generator_reserve.h"
 
 #endif // ALL_PARTICLE_GENERATORS_3D_H
\ No newline at end of file
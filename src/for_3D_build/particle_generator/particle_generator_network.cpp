@@ -4,8 +4,11 @@
 #include "base_particles.h"
 #include "cell_linked_list.h"
 #include "level_set.h"
+#include "mesh_iterators.hpp"
 #include "sph_system.h"
 
+#include <unordered_map>
+
 namespace SPH
 {
 //=================================================================================================//
@@ -101,11 +104,12 @@ bool ParticleGenerator<BaseParticles, Network>::
 }
 //=================================================================================================//
 bool ParticleGenerator<BaseParticles, Network>::
-    createABranchIfValid(size_t parent_id, Real angle, Real repulsivity, size_t number_segments)
+    computeATentativeBranch(size_t parent_id, Real angle, Real repulsivity,
+                            size_t number_segments, TentativeBranch &tentative_branch)
 {
-    bool is_valid = false;
     TreeBody::Branch *parent_branch = tree_->branches_[parent_id];
     IndexVector &parent_elements = parent_branch->inner_particles_;
+    tentative_branch.parent_id_ = parent_id;
 
     Vecd init_point = position_[parent_elements.back()];
     Vecd init_direction = parent_branch->end_direction_;
@@ -122,47 +126,169 @@ bool ParticleGenerator<BaseParticles, Network>::
     Vecd end_point = init_point;
 
     Vecd new_point = createATentativeNewBranchPoint(end_point, end_direction);
-    if (!isCollision(new_point, cell_linked_list_.findNearestListDataEntry(new_point), parent_id))
+    if (isCollision(new_point, cell_linked_list_.findNearestListDataEntry(new_point), parent_id))
+        return false;
+
+    tentative_branch.points_.push_back(new_point);
+    tentative_branch.end_directions_.push_back(end_direction);
+    for (size_t i = 1; i < number_segments; i++)
+    {
+        surface_norm = initial_shape_.findNormalDirection(new_point);
+        surface_norm /= surface_norm.norm() + TinyReal;
+        /** Project grad to surface. */
+        grad = getGradientFromNearestPoints(new_point, delta);
+        grad -= grad.dot(surface_norm) * surface_norm;
+        dir = (repulsivity * grad + end_direction) / ((repulsivity * grad + end_direction).norm() + TinyReal);
+        end_direction = dir;
+        end_point = new_point;
+
+        new_point = createATentativeNewBranchPoint(end_point, end_direction);
+        if (isCollision(new_point, cell_linked_list_.findNearestListDataEntry(new_point), parent_id))
+        {
+            tentative_branch.is_terminated_ = true;
+            tentative_branch.termination_message_ = "Branch Collision Detected, Break! ";
+            break;
+        }
+        /** This constraint imposed to avoid too small time step size. */
+        if ((new_point - end_point).norm() < 0.5 * segment_length_)
+        {
+            tentative_branch.is_terminated_ = true;
+            tentative_branch.termination_message_ = "New branch point is too close, Break! ";
+            break;
+        }
+        tentative_branch.points_.push_back(new_point);
+        tentative_branch.end_directions_.push_back(end_direction);
+    }
+    return true;
+}
+//=================================================================================================//
+size_t ParticleGenerator<BaseParticles, Network>::addTentativeBranch(TentativeBranch &tentative_branch)
+{
+    TreeBody::Branch *new_branch = tree_->createANewBranch(tentative_branch.parent_id_);
+    for (size_t i = 0; i != tentative_branch.points_.size(); ++i)
+    {
+        growAParticleOnBranch(new_branch, tentative_branch.points_[i], tentative_branch.end_directions_[i]);
+    }
+    new_branch->is_terminated_ = tentative_branch.is_terminated_;
+    if (tentative_branch.is_terminated_)
+    {
+        std::cout << tentative_branch.termination_message_ << std::endl;
+    }
+    return new_branch->id_;
+}
+//=================================================================================================//
+bool ParticleGenerator<BaseParticles, Network>::
+    createABranchIfValid(size_t parent_id, Real angle, Real repulsivity, size_t number_segments)
+{
+    TentativeBranch tentative_branch;
+    if (!computeATentativeBranch(parent_id, angle, repulsivity, number_segments, tentative_branch))
+        return false;
+
+    size_t new_branch_id = addTentativeBranch(tentative_branch);
+    for (const size_t &particle_idx : tree_->branches_[new_branch_id]->inner_particles_)
+    {
+        cell_linked_list_.InsertListDataEntry(particle_idx, position_[particle_idx]);
+    }
+    return true;
+}
+//=================================================================================================//
+IndexVector ParticleGenerator<BaseParticles, Network>::growAGenerationInParallel(const IndexVector &branches_to_grow)
+{
+    StdVec<size_t> parent_ids;
+    StdVec<Real> angles;
+    for (size_t j = 0; j != branches_to_grow.size(); j++)
     {
-        is_valid = true;
-        TreeBody::Branch *new_branch = tree_->createANewBranch(parent_id);
-        growAParticleOnBranch(new_branch, new_point, end_direction);
+        Real rand_num = rand_uniform(-0.5, 0.5);
+        Real angle_to_use = angle_ + rand_num * 0.05;
+        for (size_t k = 0; k != 2; k++)
+        {
+            parent_ids.push_back(branches_to_grow[j]);
+            angles.push_back(angle_to_use);
+            angle_to_use *= -1.0;
+        }
+    }
 
-        for (size_t i = 1; i < number_segments; i++)
+    StdVec<TentativeBranch> tentative_branches(parent_ids.size());
+    StdVec<char> is_valid(parent_ids.size(), 0);
+    parallel_for(
+        IndexRange(0, parent_ids.size()),
+        [&](const IndexRange &r)
         {
-            surface_norm = initial_shape_.findNormalDirection(new_point);
-            surface_norm /= surface_norm.norm() + TinyReal;
-            /** Project grad to surface. */
-            grad = getGradientFromNearestPoints(new_point, delta);
-            grad -= grad.dot(surface_norm) * surface_norm;
-            dir = (repulsivity * grad + end_direction) / ((repulsivity * grad + end_direction).norm() + TinyReal);
-            end_direction = dir;
-            end_point = new_point;
-
-            new_point = createATentativeNewBranchPoint(end_point, end_direction);
-            if (isCollision(new_point, cell_linked_list_.findNearestListDataEntry(new_point), parent_id))
+            for (size_t l = r.begin(); l != r.end(); ++l)
             {
-                new_branch->is_terminated_ = true;
-                std::cout << "Branch Collision Detected, Break! " << std::endl;
-                break;
+                is_valid[l] = computeATentativeBranch(parent_ids[l], angles[l], repulsivity_,
+                                                      segments_in_branch_, tentative_branches[l]);
             }
-            /** This constraint imposed to avoid too small time step size. */
-            if ((new_point - end_point).norm() < 0.5 * segment_length_)
+        },
+        ap);
+
+    // The points added in this generation are hashed by cells of the collision distance.
+    Real collision_distance = 5.0 * segment_length_;
+    std::unordered_map<size_t, StdVec<std::pair<size_t, Vecd>>> generation_points;
+    auto hash_key = [&](const Array3i &cell)
+    { return size_t(cell[0]) * 73856093 ^ size_t(cell[1]) * 19349663 ^ size_t(cell[2]) * 83492791; };
+    auto cell_of = [&](const Vecd &point)
+    { return Array3i(floor(point.array() / collision_distance).cast<int>()); };
+    auto is_in_collision = [&](const Vecd &point, size_t parent_id)
+    {
+        Array3i cell = cell_of(point);
+        return mesh_any_of(
+            cell - Array3i::Ones(), cell + 2 * Array3i::Ones(),
+            [&](const Array3i &neighbor_cell)
+            {
+                auto found = generation_points.find(hash_key(neighbor_cell));
+                if (found == generation_points.end())
+                    return false;
+                for (const auto &entry : found->second)
+                {
+                    // the branches from the same parent are family
+                    if (entry.first != parent_id && (point - entry.second).norm() < collision_distance)
+                        return true;
+                }
+                return false;
+            });
+    };
+
+    IndexVector new_branches_to_grow;
+    size_t first_new_particle = position_.size();
+    for (size_t l = 0; l != tentative_branches.size(); ++l)
+    {
+        TentativeBranch &tentative_branch = tentative_branches[l];
+        if (!is_valid[l])
+            continue;
+
+        StdVec<Vecd> &points = tentative_branch.points_;
+        for (size_t i = 0; i != points.size(); ++i)
+        {
+            if (is_in_collision(points[i], tentative_branch.parent_id_))
             {
-                new_branch->is_terminated_ = true;
-                std::cout << "New branch point is too close, Break! " << std::endl;
+                points.resize(i);
+                tentative_branch.end_directions_.resize(i);
+                tentative_branch.is_terminated_ = true;
+                tentative_branch.termination_message_ = "Branch Collision Detected, Break! ";
                 break;
             }
-            growAParticleOnBranch(new_branch, new_point, end_direction);
         }
+        if (points.empty())
+            continue;
 
-        for (const size_t &particle_idx : new_branch->inner_particles_)
+        size_t new_branch_id = addTentativeBranch(tentative_branch);
+        for (const Vecd &point : points)
         {
-            cell_linked_list_.InsertListDataEntry(particle_idx, position_[particle_idx]);
+            generation_points[hash_key(cell_of(point))].push_back(
+                std::make_pair(tentative_branch.parent_id_, point));
+        }
+        if (!tentative_branch.is_terminated_)
+        {
+            new_branches_to_grow.push_back(new_branch_id);
         }
     }
 
-    return is_valid;
+    for (size_t particle_idx = first_new_particle; particle_idx != position_.size(); ++particle_idx)
+    {
+        cell_linked_list_.InsertListDataEntry(particle_idx, position_[particle_idx]);
+    }
+    return new_branches_to_grow;
 }
 //=================================================================================================//
 void ParticleGenerator<BaseParticles, Network>::prepareGeometricData()
@@ -208,6 +334,14 @@ void ParticleGenerator<BaseParticles, Network>::prepareGeometricData()
     {
         new_branches_to_grow.clear();
         std::shuffle(branches_to_grow.begin(), branches_to_grow.end(), random_engine);
+        if (is_level_synchronous_)
+        {
+            branches_to_grow = growAGenerationInParallel(branches_to_grow);
+            ite++;
+            sph_body_.setNewlyUpdated();
+            write_particle_generation.writeToFile(ite);
+            continue;
+        }
         for (size_t j = 0; j != branches_to_grow.size(); j++)
         {
             size_t grow_id = branches_to_grow[j];
@@ -49,6 +49,12 @@ class ParticleGenerator<BaseParticles, Network> : public ParticleGenerator<BaseP
 
     /** Created base particles based on edges in branch */
     virtual void prepareGeometricData() override;
+    /**
+     * The branches of a generation are grown in parallel against the particles of the previous generations.
+     * The collisions within the generation are detected when the branches are added,
+     * and the cell linked list is updated once per generation.
+     */
+    void useLevelSynchronousGrowth() { is_level_synchronous_ = true; };
 
   protected:
     Vecd starting_pnt_;                                 /**< Starting point for net work. */
@@ -66,6 +72,17 @@ class ParticleGenerator<BaseParticles, Network> : public ParticleGenerator<BaseP
     Shape &initial_shape_;
     BaseCellLinkedList &cell_linked_list_;
     TreeBody *tree_;
+    bool is_level_synchronous_ = false;
+
+    /** A branch computed before being added to the tree. */
+    struct TentativeBranch
+    {
+        size_t parent_id_;
+        StdVec<Vecd> points_;
+        StdVec<Vecd> end_directions_;
+        bool is_terminated_ = false;
+        std::string termination_message_;
+    };
     /**
      *@brief Get the gradient from nearest points, for imposing repulsive force.
      *@param[in] pt(Vecd) Inquiry point.
@@ -81,6 +98,16 @@ class ParticleGenerator<BaseParticles, Network> : public ParticleGenerator<BaseP
      *@param[in] number_segments(size_t) Number of segments in this branch.
      */
     bool createABranchIfValid(size_t parent_id, Real angle, Real repulsivity, size_t number_segments);
+    /**
+     *@brief Compute a branch without modifying the tree and the cell linked list.
+     *@return false if the first point of the branch is in collision.
+     */
+    bool computeATentativeBranch(size_t parent_id, Real angle, Real repulsivity,
+                                 size_t number_segments, TentativeBranch &tentative_branch);
+    /** Add the tentative branch to the tree and return the id of the new branch. */
+    size_t addTentativeBranch(TentativeBranch &tentative_branch);
+    /** Grow all branch tips of a generation in parallel and return the branches to grow subsequently. */
+    IndexVector growAGenerationInParallel(const IndexVector &branches_to_grow);
     /**
      *@brief Functions that creates a new node in the mesh surface and it to the queue is it lies in the surface.
      *@param[in] init_node vector that contains the coordinates of the last node added in the branch.
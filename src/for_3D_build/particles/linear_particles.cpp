@@ -23,6 +23,7 @@ void LinearParticles::registerLinePropertiesFromReload()
 //=================================================================================================//
 void LinearParticles::registerTransformationMatrix()
 {
+    SurfaceParticles::registerTransformationMatrix();
     transformation_matrix0_ = registerStateVariableData<Matd>(
         "TransformationMatrix", [&](size_t index_i) -> Matd
         { return getTransformationMatrix(n_[index_i], b_n_[index_i]); });
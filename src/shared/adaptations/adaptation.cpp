@@ -98,15 +98,15 @@ UniquePtr<BaseCellLinkedList> SPHAdaptation::createRefinedCellLinkedList(
     return makeUnique<CellLinkedList>(domain_bounds, grid_spacing, base_particles, *this);
 }
 //=================================================================================================//
-UniquePtr<LevelSet> SPHAdaptation::createLevelSet(Shape &shape, Real refinement_ratio)
+UniquePtr<LevelSet> SPHAdaptation::createLevelSet(Shape &shape, Real refinement_ratio, const BoundingBoxd &bounds)
 {
     // estimate the required mesh levels
-    int total_levels = (int)log10(shape.getBounds().MinimumDimension() / ReferenceSpacing()) + 2;
+    int total_levels = (int)log10(bounds.MinimumDimension() / ReferenceSpacing()) + 2;
     Real coarsest_spacing = ReferenceSpacing() * pow(2.0, total_levels - 1);
-    LevelSet coarser_level_sets(shape.getBounds(), coarsest_spacing / refinement_ratio,
+    LevelSet coarser_level_sets(bounds, coarsest_spacing / refinement_ratio,
                                 total_levels - 1, shape, *this, refinement_ratio);
     // return the finest level set only
-    return makeUnique<LevelSet>(shape.getBounds(), coarser_level_sets.getMeshLevels().back(),
+    return makeUnique<LevelSet>(bounds, coarser_level_sets.getMeshLevels().back(),
                                 shape, *this, refinement_ratio);
 }
 //=================================================================================================//
@@ -146,10 +146,10 @@ UniquePtr<BaseCellLinkedList> AdaptiveSmoothingLength::
                                                 local_refinement_level_, base_particles, *this);
 }
 //=================================================================================================//
-UniquePtr<LevelSet> AdaptiveSmoothingLength::createLevelSet(Shape &shape, Real refinement_ratio)
+UniquePtr<LevelSet> AdaptiveSmoothingLength::createLevelSet(Shape &shape, Real refinement_ratio, const BoundingBoxd &bounds)
 {
     // one more level for interpolation
-    return makeUnique<LevelSet>(shape.getBounds(), ReferenceSpacing() / refinement_ratio,
+    return makeUnique<LevelSet>(bounds, ReferenceSpacing() / refinement_ratio,
                                 local_refinement_level_ + 1, shape, *this, refinement_ratio);
 }
 //=================================================================================================//
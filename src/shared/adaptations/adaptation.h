@@ -88,7 +88,8 @@ class SPHAdaptation
 
     virtual UniquePtr<BaseCellLinkedList> createCellLinkedList(const BoundingBoxd &domain_bounds, BaseParticles &base_particles);
     UniquePtr<BaseCellLinkedList> createRefinedCellLinkedList(int level, const BoundingBoxd &domain_bounds, BaseParticles &base_particles);
-    virtual UniquePtr<LevelSet> createLevelSet(Shape &shape, Real refinement_ratio);
+    /** The level set is built within the given bounds, usually the shape bounds. */
+    virtual UniquePtr<LevelSet> createLevelSet(Shape &shape, Real refinement_ratio, const BoundingBoxd &bounds);
 
     template <class KernelType, typename... Args>
     void resetKernel(Args &&...args)
@@ -135,7 +136,7 @@ class AdaptiveSmoothingLength : public SPHAdaptation
 
     virtual void initializeAdaptationVariables(BaseParticles &base_particles) override;
     virtual UniquePtr<BaseCellLinkedList> createCellLinkedList(const BoundingBoxd &domain_bounds, BaseParticles &base_particles) override;
-    virtual UniquePtr<LevelSet> createLevelSet(Shape &shape, Real refinement_ratio) override;
+    virtual UniquePtr<LevelSet> createLevelSet(Shape &shape, Real refinement_ratio, const BoundingBoxd &bounds) override;
 
     class ContinuousSmoothingLengthRatio
     {
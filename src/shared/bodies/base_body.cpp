@@ -2,6 +2,8 @@
 
 #include "base_body_relation.h"
 #include "base_particles.hpp"
+#include "particle_iterators.h"
+#include "reduce_functors.h"
 #include "sph_system.h"
 
 namespace SPH
@@ -83,8 +85,19 @@ BaseCellLinkedList &RealBody::getCellLinkedList()
 {
     if (!cell_linked_list_created_)
     {
-        cell_linked_list_ptr_ =
-            sph_adaptation_->createCellLinkedList(getSPHSystemBounds(), *base_particles_);
+        BoundingBoxd bounds = getSPHSystemBounds();
+        Real margin = sph_system_.CellLinkedListMargin();
+        if (margin >= 0.0 && base_particles_->TotalRealParticles() != 0)
+        {
+            Vecd *pos = base_particles_->ParticlePositions();
+            BoundingBoxd particle_bounds =
+                particle_reduce(execution::ParallelPolicy(), IndexRange(0, base_particles_->TotalRealParticles()),
+                                ReduceReference<ReduceBoundingBox>::value, ReduceBoundingBox(),
+                                [&](size_t index_i)
+                                { return BoundingBoxd(pos[index_i], pos[index_i]); });
+            bounds = particle_bounds.expand(margin * Vecd::Ones()).getIntersect(bounds);
+        }
+        cell_linked_list_ptr_ = sph_adaptation_->createCellLinkedList(bounds, *base_particles_);
         cell_linked_list_created_ = true;
         cell_linked_list_ptr_.get()->setName(getName() + "CellLinkedList");
     }
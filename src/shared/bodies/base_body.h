@@ -44,13 +44,16 @@
 #include "base_particles.h"
 #include "cell_linked_list.h"
 #include "closure_wrapper.h"
+#include "periodic_image.h"
 #include "sphinxsys_containers.h"
+#include "startup_profiler.h"
 
 #include <string>
 
 namespace SPH
 {
 class SPHRelation;
+class RelationBase;
 class BodySurface;
 
 /**
@@ -71,14 +74,16 @@ class SPHBody
   protected:
     SPHSystem &sph_system_;
     std::string body_name_;
-    bool newly_updated_;                   /**< whether this body is in a newly updated state */
-    BaseParticles *base_particles_;        /**< Base particles for dynamic cast DataDelegate  */
-    bool is_bound_set_;                    /**< whether the bounding box is set */
-    BoundingBoxd bound_;                    /**< bounding box of the body */
-    Shape *initial_shape_;                 /**< initial volumetric geometry enclosing the body */
-    SPHAdaptation *sph_adaptation_;        /**< numerical adaptation policy */
-    BaseMaterial *base_material_;          /**< base material for dynamic cast in DataDelegate */
-    StdVec<SPHRelation *> body_relations_; /**< all contact relations centered from this body **/
+    bool newly_updated_;                       /**< whether this body is in a newly updated state */
+    BaseParticles *base_particles_;            /**< Base particles for dynamic cast DataDelegate  */
+    bool is_bound_set_;                        /**< whether the bounding box is set */
+    BoundingBoxd bound_;                       /**< bounding box of the body */
+    Shape *initial_shape_;                     /**< initial volumetric geometry enclosing the body */
+    SPHAdaptation *sph_adaptation_;            /**< numerical adaptation policy */
+    BaseMaterial *base_material_;              /**< base material for dynamic cast in DataDelegate */
+    StdVec<SPHRelation *> body_relations_;     /**< all contact relations centered from this body **/
+    StdVec<RelationBase *> body_relations_ck_; /**< all computing-kernel relations centered from this body **/
+    PeriodicImage periodic_image_;             /**< periodic images for the computing-kernel neighbor search **/
 
   public:
     typedef SPHBody BaseIdentifier;
@@ -98,6 +103,8 @@ class SPHBody
     BaseParticles &getBaseParticles();
     BaseMaterial &getBaseMaterial();
     StdVec<SPHRelation *> &getBodyRelations() { return body_relations_; };
+    StdVec<RelationBase *> &getBodyRelationsCK() { return body_relations_ck_; };
+    PeriodicImage &getPeriodicImage() { return periodic_image_; };
     IndexRange LoopRange() { return IndexRange(0, base_particles_->TotalRealParticles()); };
     size_t SizeOfLoopRange() { return base_particles_->TotalRealParticles(); };
     Real getSPHBodyResolutionRef() { return sph_adaptation_->ReferenceSpacing(); };
@@ -192,6 +199,7 @@ class SPHBody
     template <class ParticleType, class... Parameters, typename... Args>
     ParticleType *generateParticles(Args &&...args)
     {
+        ScopedStartupPhase startup_phase("ParticleGeneration", getName());
         ParticleType *particles = base_particles_ptr_keeper_.createPtr<ParticleType>(*this, base_material_);
         ParticleGenerator<ParticleType, Parameters...> particle_generator(*this, *particles, std::forward<Args>(args)...);
         particle_generator.generateParticlesWithGeometricVariables();
@@ -231,6 +239,7 @@ class RealBody : public SPHBody
     };
     virtual ~RealBody() {};
     BaseCellLinkedList &getCellLinkedList();
+    bool isCellLinkedListCreated() { return cell_linked_list_created_; };
     void updateCellLinkedList();
     using ListedParticleMask = typename SPHBody::SourceParticleMask;
 };
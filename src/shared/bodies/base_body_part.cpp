@@ -27,7 +27,7 @@ BodyPartByID::BodyPartByID(SPHBody &sph_body) : BodyPart(sph_body)
 //=================================================================================================//
 BodyPartByParticle::BodyPartByParticle(SPHBody &sph_body)
     : BodyPart(sph_body), body_part_bounds_(Vecd::Zero(), Vecd::Zero()),
-      body_part_bounds_set_(false)
+      body_part_bounds_set_(false), is_contiguous_(false)
 {
     base_particles_.addBodyPartByParticle(this);
     base_particles_.addEvolvingVariable<int>(dv_body_part_id_);
@@ -80,9 +80,9 @@ size_t BodyPartByCell::SizeOfLoopRange()
     return size_of_loop_range;
 }
 //=================================================================================================//
-void BodyPartByCell::tagCells(TaggingCellMethod &tagging_cell_method)
+void BodyPartByCell::tagCells(TaggingCellMethod &tagging_cell_method, size_t cell_list_capacity)
 {
-    ConcurrentIndexVector cell_indexes;
+    ConcurrentIndexVector &cell_indexes = body_part_cell_indexes_;
     cell_linked_list_.tagBodyPartByCell(body_part_cells_, cell_indexes, tagging_cell_method);
 
     for (size_t i = 0; i != body_part_cells_.size(); ++i)
@@ -94,12 +94,38 @@ void BodyPartByCell::tagCells(TaggingCellMethod &tagging_cell_method)
         }
     }
     dv_cell_list_ = unique_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
-        part_name_, cell_indexes.size(), [&](size_t i)
-        { return cell_indexes[i]; });
+        part_name_, SMAX(cell_indexes.size(), cell_list_capacity), [&](size_t i)
+        { return i < cell_indexes.size() ? cell_indexes[i] : 0; });
     sv_range_size_ = unique_variable_ptrs_.createPtr<SingularVariable<UnsignedInt>>(
         part_name_ + "_Size", cell_indexes.size());
 }
 //=================================================================================================//
+void BodyPartByCell::retagCells(TaggingCellMethod &tagging_cell_method, const BoundingBoxd &swept_bounds)
+{
+    cell_linked_list_.retagBodyPartByCell(
+        body_part_cells_, body_part_cell_indexes_, tagging_cell_method, swept_bounds);
+
+    size_t number_of_cells = body_part_cell_indexes_.size();
+    if (number_of_cells > dv_cell_list_->getDataSize())
+    {
+        if (dv_cell_list_->isDataDelegated())
+        {
+            std::cout << "\n Error: the cell list of " << part_name_
+                      << " exceeds its capacity after being delegated to the device!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        dv_cell_list_->reallocateData(execution::par_host, number_of_cells);
+    }
+
+    UnsignedInt *cell_list = dv_cell_list_->Data();
+    for (size_t i = 0; i != number_of_cells; ++i)
+    {
+        cell_list[i] = body_part_cell_indexes_[i];
+    }
+    sv_range_size_->setValue(number_of_cells);
+}
+//=================================================================================================//
 BodyRegionByParticle::
     BodyRegionByParticle(SPHBody &sph_body, Shape &body_part_shape)
     : BodyPartByParticle(sph_body), body_part_shape_(body_part_shape)
@@ -239,7 +265,7 @@ AlignedBoxByCell::AlignedBoxByCell(RealBody &real_body, const AlignedBox &aligne
 {
     TaggingCellMethod tagging_cell_method =
         std::bind(&AlignedBoxByCell::checkNotFar, this, _1, _2);
-    tagCells(tagging_cell_method);
+    tagCells(tagging_cell_method, estimateCellListCapacity());
 }
 //=================================================================================================//
 bool AlignedBoxByCell::checkNotFar(Vecd cell_position, Real threshold)
@@ -247,4 +273,86 @@ bool AlignedBoxByCell::checkNotFar(Vecd cell_position, Real threshold)
     return aligned_box_.checkNotFar(cell_position, threshold);
 }
 //=================================================================================================//
+BoundingBoxd AlignedBoxByCell::getAlignedBoxBounds()
+{
+    Vecd halfsize = aligned_box_.HalfSize();
+    Transform &transform = aligned_box_.getTransform();
+    Vecd lower = Vecd::Constant(MaxReal);
+    Vecd upper = Vecd::Constant(-MaxReal);
+    for (int corner = 0; corner != (1 << Dimensions); ++corner)
+    {
+        Vecd corner_in_frame = halfsize;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if ((corner >> k) & 1)
+                corner_in_frame[k] = -halfsize[k];
+        }
+        Vecd corner_position = transform.shiftFrameStationToBase(corner_in_frame);
+        lower = lower.cwiseMin(corner_position);
+        upper = upper.cwiseMax(corner_position);
+    }
+    return BoundingBoxd(lower, upper);
+}
+//=================================================================================================//
+void AlignedBoxByCell::moveAlignedBox(const Transform &transform)
+{
+    BoundingBoxd swept_bounds = getAlignedBoxBounds();
+    aligned_box_.setTransform(transform);
+    svAlignedBox()->setValue(aligned_box_);
+    BoundingBoxd new_bounds = getAlignedBoxBounds();
+    swept_bounds.lower_ = swept_bounds.lower_.cwiseMin(new_bounds.lower_);
+    swept_bounds.upper_ = swept_bounds.upper_.cwiseMax(new_bounds.upper_);
+
+    TaggingCellMethod tagging_cell_method =
+        std::bind(&AlignedBoxByCell::checkNotFar, this, _1, _2);
+    retagCells(tagging_cell_method, swept_bounds);
+}
+//=================================================================================================//
+size_t AlignedBoxByCell::estimateCellListCapacity()
+{
+    Real diagonal = 2.0 * aligned_box_.HalfSize().norm();
+    size_t capacity = 0;
+    for (Mesh *mesh : cell_linked_list_.getMeshes())
+    {
+        // the tagged cells extend one grid spacing and one stencil cell beyond the box
+        Real cells_per_axis = diagonal / mesh->GridSpacing() + 6.0;
+        capacity += SMIN(size_t(std::pow(cells_per_axis, Dimensions)), size_t(mesh->NumberOfCells()));
+    }
+    return capacity;
+}
+//=================================================================================================//
+AlignedBoxPartsByCell::AlignedBoxPartsByCell(RealBody &real_body, StdVec<AlignedBoxByCell *> aligned_box_parts)
+    : BodyPartByCell(real_body), aligned_box_parts_(aligned_box_parts)
+{
+    alias_ = "AlignedBoxParts";
+    dv_aligned_boxes_ = unique_variable_ptrs_.createPtr<DiscreteVariable<AlignedBox>>(
+        part_name_ + "AlignedBoxes", aligned_box_parts_.size(), [&](size_t k)
+        { return aligned_box_parts_[k]->getAlignedBox(); });
+    dv_part_ids_ = unique_variable_ptrs_.createPtr<DiscreteVariable<int>>(
+        part_name_ + "PartIDs", aligned_box_parts_.size(), [&](size_t k)
+        { return aligned_box_parts_[k]->getPartID(); });
+
+    ConcurrentIndexVector cell_indexes;
+    TaggingCellMethod tagging_cell_method =
+        std::bind(&AlignedBoxPartsByCell::checkNotFar, this, _1, _2);
+    cell_linked_list_.tagBodyPartByCell(body_part_cells_, cell_indexes, tagging_cell_method);
+    dv_cell_list_ = unique_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+        part_name_, cell_indexes.size(), [&](size_t i)
+        { return cell_indexes[i]; });
+    sv_range_size_ = unique_variable_ptrs_.createPtr<SingularVariable<UnsignedInt>>(
+        part_name_ + "_Size", cell_indexes.size());
+}
+//=================================================================================================//
+bool AlignedBoxPartsByCell::checkNotFar(Vecd cell_position, Real threshold)
+{
+    for (size_t k = 0; k != aligned_box_parts_.size(); ++k)
+    {
+        if (aligned_box_parts_[k]->getAlignedBox().checkNotFar(cell_position, threshold))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+//=================================================================================================//
 } // namespace SPH
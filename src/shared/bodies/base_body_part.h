@@ -116,11 +116,37 @@ class BodyPartByParticle : public BodyPart
     virtual ~BodyPartByParticle() {};
     void setBodyPartBounds(BoundingBoxd bbox);
     BoundingBoxd getBodyPartBounds();
+    /** The particles are at the front of the particle range in the order of the particle list,
+     *  i.e. the particle list is the identity, as set by ParticleSortCK::setContiguousBodyPart. */
+    bool isContiguous() { return is_contiguous_; };
+    void setContiguous(bool is_contiguous) { is_contiguous_ = is_contiguous; };
+
+    /** Only the particles in the body part are the sources of a relation,
+     *  e.g. the surface layer of a structure for the contact with a fluid. */
+    class SourceParticleMask
+    {
+      public:
+        template <class ExecutionPolicy, typename EnclosureType>
+        SourceParticleMask(ExecutionPolicy &ex_policy, EnclosureType &encloser)
+            : part_id_(encloser.part_id_),
+              body_part_id_(encloser.dv_body_part_id_->DelegatedData(ex_policy)) {}
+        ~SourceParticleMask() {}
+
+        bool operator()(UnsignedInt source_index)
+        {
+            return body_part_id_[source_index] == part_id_;
+        }
+
+      protected:
+        int part_id_;
+        int *body_part_id_;
+    };
 
   protected:
     DiscreteVariable<UnsignedInt> *dv_particle_list_;
     BoundingBoxd body_part_bounds_;
     bool body_part_bounds_set_;
+    bool is_contiguous_;
     typedef std::function<bool(size_t)> TaggingParticleMethod;
     void tagParticles(TaggingParticleMethod &tagging_particle_method);
 };
@@ -148,8 +174,13 @@ class BodyPartByCell : public BodyPart
     DiscreteVariable<UnsignedInt> *dv_cell_list_;
     DiscreteVariable<UnsignedInt> *dv_particle_index_;
     DiscreteVariable<UnsignedInt> *dv_cell_offset_;
+    ConcurrentIndexVector body_part_cell_indexes_; /**< Linear indexes of the cells, kept for re-tagging. */
     typedef std::function<bool(Vecd, Real)> TaggingCellMethod;
-    void tagCells(TaggingCellMethod &tagging_cell_method);
+    /** The cell list is allocated with at least the given capacity so that it can be re-tagged in place. */
+    void tagCells(TaggingCellMethod &tagging_cell_method, size_t cell_list_capacity = 0);
+    /** Re-tag only the cells within the swept bounds, e.g. of a moving region,
+     *  and rewrite the host cell list. The body part ids of the particles are not changed. */
+    void retagCells(TaggingCellMethod &tagging_cell_method, const BoundingBoxd &swept_bounds);
 };
 
 /**
@@ -277,8 +308,43 @@ class AlignedBoxByCell : public BodyPartByCell, public AlignedBoxPart
   public:
     AlignedBoxByCell(RealBody &real_body, const AlignedBox &aligned_box);
     virtual ~AlignedBoxByCell() {};
+    /** Move the box and re-tag only the cells swept between the old and the new box. */
+    void moveAlignedBox(const Transform &transform);
+    /** Move the box and copy the updated cell list to the device for the computing kernels. */
+    template <class ExecutionPolicy>
+    void moveAlignedBox(const ExecutionPolicy &ex_policy, const Transform &transform)
+    {
+        moveAlignedBox(transform);
+        dv_cell_list_->finalizeLoadIn(ex_policy);
+    };
+    BoundingBoxd getAlignedBoxBounds();
+
+  protected:
+    bool checkNotFar(Vecd cell_position, Real threshold);
+    /** Enough cells for the box at any position and orientation. */
+    size_t estimateCellListCapacity();
+};
+
+/**
+ * @class AlignedBoxPartsByCell
+ * @brief The union of the cells of several aligned box parts, so that the particles
+ * in all the boxes can be classified in one pass. The boxes are copied at construction
+ * and the body part ids of the particles are left to the individual aligned box parts.
+ */
+class AlignedBoxPartsByCell : public BodyPartByCell
+{
+  public:
+    AlignedBoxPartsByCell(RealBody &real_body, StdVec<AlignedBoxByCell *> aligned_box_parts);
+    virtual ~AlignedBoxPartsByCell() {};
+    UnsignedInt NumberOfParts() { return aligned_box_parts_.size(); };
+    StdVec<AlignedBoxByCell *> &getAlignedBoxParts() { return aligned_box_parts_; };
+    DiscreteVariable<AlignedBox> *dvAlignedBoxes() { return dv_aligned_boxes_; };
+    DiscreteVariable<int> *dvPartIDs() { return dv_part_ids_; };
 
   protected:
+    StdVec<AlignedBoxByCell *> aligned_box_parts_;
+    DiscreteVariable<AlignedBox> *dv_aligned_boxes_;
+    DiscreteVariable<int> *dv_part_ids_;
     bool checkNotFar(Vecd cell_position, Real threshold);
 };
 } // namespace SPH
@@ -45,4 +45,11 @@ BaseCellLinkedList &BodyPartitionSpatial::getCellLinkedList()
     return *cell_linked_list_ptr_.get();
 }
 //=================================================================================================//
+BodyActivityPartition::BodyActivityPartition(SPHBody &sph_body)
+    : sph_body_(sph_body), base_particles_(sph_body.getBaseParticles()),
+      dv_particle_activity_(base_particles_.registerStateVariable<int>("ParticleActivity", 1))
+{
+    base_particles_.addEvolvingVariable<int>("ParticleActivity");
+}
+//=================================================================================================//
 } // namespace SPH
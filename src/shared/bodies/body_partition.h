@@ -105,5 +105,30 @@ class BodyPartitionSpatial : public BodyPartition
     Real getReferenceSmoothingLength() { return sph_adaptation_.SmoothingLengthByLevel(present_adapt_level_); };
     virtual BaseCellLinkedList &getCellLinkedList() override;
 };
+
+/**
+ * @class BodyActivityPartition
+ * @brief The active particles of a body, i.e. those not sleeping in a quiescent region.
+ * @details The activity is indicated by ParticleActivityCK. The dynamics on the partition
+ * skip the inactive particles, which still act as neighbors of the active ones.
+ */
+class BodyActivityPartition
+{
+  public:
+    typedef BodyActivityPartition BaseIdentifier;
+    explicit BodyActivityPartition(SPHBody &sph_body);
+    virtual ~BodyActivityPartition() {};
+    SPHBody &getSPHBody() { return sph_body_; };
+    SPHSystem &getSPHSystem() { return sph_body_.getSPHSystem(); };
+    std::string getName() { return sph_body_.getName() + "ActivityPartition"; };
+    SPHAdaptation &getSPHAdaptation() { return sph_body_.getSPHAdaptation(); };
+    BaseParticles &getBaseParticles() { return base_particles_; };
+    DiscreteVariable<int> *dvParticleActivity() { return dv_particle_activity_; };
+
+  protected:
+    SPHBody &sph_body_;
+    BaseParticles &base_particles_;
+    DiscreteVariable<int> *dv_particle_activity_;
+};
 } // namespace SPH
 #endif // BODY_PARTITION_H
@@ -30,8 +30,10 @@
 #define ALL_BODY_RELATIONS_H
 
 #include "base_body_relation.h"
+#include "compact_body_relation.h"
 #include "complex_body_relation.h"
 #include "contact_body_relation.h"
 #include "inner_body_relation.h"
+#include "verlet_body_relation.h"
 
 #endif // ALL_BODY_RELATIONS_H
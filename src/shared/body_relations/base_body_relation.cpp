@@ -41,6 +41,21 @@ void BaseInnerRelation::resetNeighborhoodCurrentSize()
         ap);
 }
 //=================================================================================================//
+MemoryUsage BaseInnerRelation::getMemoryUsage()
+{
+    return MemoryUsage{configurationMemoryBytes(inner_configuration_), 0};
+}
+//=================================================================================================//
+void BaseInnerRelation::swapNeighborhoods(size_t index_a, size_t index_b)
+{
+    inner_configuration_[index_a].swap(inner_configuration_[index_b]);
+}
+//=================================================================================================//
+size_t BaseInnerRelation::NeighborHighWaterMark()
+{
+    return configurationHighWaterMark(inner_configuration_);
+}
+//=================================================================================================//
 BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
     : SPHRelation(sph_body), contact_bodies_(contact_sph_bodies)
 {
@@ -55,6 +70,34 @@ BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector conta
     }
 }
 //=================================================================================================//
+MemoryUsage BaseContactRelation::getMemoryUsage()
+{
+    MemoryUsage memory_usage;
+    for (size_t k = 0; k != contact_configuration_.size(); ++k)
+    {
+        memory_usage.host_bytes_ += configurationMemoryBytes(contact_configuration_[k]);
+    }
+    return memory_usage;
+}
+//=================================================================================================//
+void BaseContactRelation::swapNeighborhoods(size_t index_a, size_t index_b)
+{
+    for (size_t k = 0; k != contact_configuration_.size(); ++k)
+    {
+        contact_configuration_[k][index_a].swap(contact_configuration_[k][index_b]);
+    }
+}
+//=================================================================================================//
+size_t BaseContactRelation::NeighborHighWaterMark()
+{
+    size_t high_water_mark = 0;
+    for (size_t k = 0; k != contact_configuration_.size(); ++k)
+    {
+        high_water_mark = SMAX(high_water_mark, configurationHighWaterMark(contact_configuration_[k]));
+    }
+    return high_water_mark;
+}
+//=================================================================================================//
 void BaseContactRelation::resetNeighborhoodCurrentSize()
 {
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
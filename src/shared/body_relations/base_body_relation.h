@@ -97,6 +97,17 @@ struct SearchDepthAdaptiveContact
     };
 };
 
+/** @brief a small functor for obtaining search depth for the neighbor list with skin
+ * @details Note that the search depth is defined on the target cell linked list.
+ */
+struct SearchDepthWithSkin
+{
+    int search_depth_;
+    SearchDepthWithSkin(Real cutoff_radius_with_skin, Mesh &target_mesh)
+        : search_depth_(1 + (int)floor(cutoff_radius_with_skin / target_mesh.GridSpacing())) {};
+    int operator()(size_t particle_index) const { return search_depth_; };
+};
+
 /** Transfer body parts to real bodies. **/
 RealBodyVector BodyPartsToRealBodies(BodyPartVector body_parts);
 
@@ -113,6 +124,12 @@ class SPHRelation
 
     void subscribeToBody() { sph_body_.getBodyRelations().push_back(this); };
     virtual void updateConfiguration() = 0;
+    /** Host bytes of the particle configurations owned by the relation. */
+    virtual MemoryUsage getMemoryUsage() { return MemoryUsage(); };
+    /** Follow the swap of two particles during sorting so that the neighbor capacities stay with the particles. */
+    virtual void swapNeighborhoods(size_t index_a, size_t index_b) {};
+    /** The largest number of neighbors of a particle ever kept by the relation. */
+    virtual size_t NeighborHighWaterMark() { return 0; };
 
   protected:
     SPHBody &sph_body_;
@@ -131,6 +148,9 @@ class BaseInnerRelation : public SPHRelation
     explicit BaseInnerRelation(RealBody &real_body);
     virtual ~BaseInnerRelation() {};
     BaseInnerRelation &getRelation() { return *this; };
+    virtual MemoryUsage getMemoryUsage() override;
+    virtual void swapNeighborhoods(size_t index_a, size_t index_b) override;
+    virtual size_t NeighborHighWaterMark() override;
 
   protected:
     virtual void resetNeighborhoodCurrentSize();
@@ -159,6 +179,9 @@ class BaseContactRelation : public SPHRelation
     RealBodyVector getContactBodies() { return contact_bodies_; };
     StdVec<BaseParticles *> getContactParticles() { return contact_particles_; };
     StdVec<SPHAdaptation *> getContactAdaptations() { return contact_adaptations_; };
+    virtual MemoryUsage getMemoryUsage() override;
+    virtual void swapNeighborhoods(size_t index_a, size_t index_b) override;
+    virtual size_t NeighborHighWaterMark() override;
 };
 } // namespace SPH
 #endif // BASE_BODY_RELATION_H
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "compact_body_relation.h"
+#include "base_particles.hpp"
+#include "cell_linked_list.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+CompactInnerRelation::CompactInnerRelation(RealBody &real_body, bool store_kernel_values)
+    : SPHRelation(real_body), get_inner_neighbor_(real_body),
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      real_body_(&real_body), inner_configuration_(base_particles_.ParticlesBound(), store_kernel_values),
+      on_the_fly_kernel_(*real_body.getSPHAdaptation().getKernel())
+{
+    subscribeToBody();
+}
+//=================================================================================================//
+void CompactInnerRelation::updateConfiguration()
+{
+    Mesh &mesh = cell_linked_list_.getMesh();
+    cell_linked_list_.searchNeighborsByMesh(mesh, sph_body_, inner_configuration_,
+                                            get_single_search_depth_, get_inner_neighbor_);
+}
+//=================================================================================================//
+CompactContactRelation::
+    CompactContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies, bool store_kernel_values)
+    : SPHRelation(sph_body), contact_bodies_(contact_bodies)
+{
+    subscribeToBody();
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        contact_particles_.push_back(&contact_bodies_[k]->getBaseParticles());
+        contact_configuration_.emplace_back(base_particles_.ParticlesBound(), store_kernel_values);
+        on_the_fly_kernels_.push_back(
+            on_the_fly_kernel_ptrs_keeper_.createPtr<OnTheFlyKernel>(
+                *NeighborBuilder::chooseKernel(sph_body_, *contact_bodies_[k])));
+        CellLinkedList *target_cell_linked_list =
+            DynamicCast<CellLinkedList>(this, &contact_bodies_[k]->getCellLinkedList());
+        target_cell_linked_lists_.push_back(target_cell_linked_list);
+        get_search_depths_.push_back(
+            search_depth_ptrs_keeper_.createPtr<SearchDepthContact>(
+                sph_body_, target_cell_linked_list->getMesh()));
+        get_contact_neighbors_.push_back(
+            neighbor_builder_contact_ptrs_keeper_.createPtr<NeighborBuilderContact>(
+                sph_body_, *contact_bodies_[k]));
+    }
+}
+//=================================================================================================//
+void CompactContactRelation::updateConfiguration()
+{
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
+        target_cell_linked_lists_[k]->searchNeighborsByMesh(
+            mesh, sph_body_, contact_configuration_[k],
+            *get_search_depths_[k], *get_contact_neighbors_[k]);
+    }
+}
+//=================================================================================================//
+MemoryUsage CompactContactRelation::getMemoryUsage()
+{
+    MemoryUsage memory_usage;
+    for (size_t k = 0; k != contact_configuration_.size(); ++k)
+    {
+        memory_usage.host_bytes_ += contact_configuration_[k].MemoryBytes();
+    }
+    return memory_usage;
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,93 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	compact_body_relation.h
+ * @brief 	The topological relations within a body and to other bodies
+ * 			with particle configuration in compressed sparse row (CSR) layout.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef COMPACT_BODY_RELATION_H
+#define COMPACT_BODY_RELATION_H
+
+#include "base_body_relation.h"
+
+namespace SPH
+{
+/**
+ * @class CompactInnerRelation
+ * @brief The inner relation within a SPH body
+ * with the neighbors of all particles saved in a compact particle configuration.
+ * @details If kernel values are not stored, only neighbor indices and distances are saved
+ * and the kernel values are evaluated by on_the_fly_kernel_ with the particle positions.
+ */
+class CompactInnerRelation : public SPHRelation
+{
+  protected:
+    SearchDepthSingleResolution get_single_search_depth_;
+    NeighborBuilderInner get_inner_neighbor_;
+    CellLinkedList &cell_linked_list_;
+
+  public:
+    RealBody *real_body_;
+    CompactParticleConfiguration inner_configuration_;
+    OnTheFlyKernel on_the_fly_kernel_;
+
+    explicit CompactInnerRelation(RealBody &real_body, bool store_kernel_values = true);
+    virtual ~CompactInnerRelation() {};
+    CompactInnerRelation &getRelation() { return *this; };
+    CellLinkedList &getCellLinkedList() { return cell_linked_list_; };
+    virtual void updateConfiguration() override;
+    virtual MemoryUsage getMemoryUsage() override { return MemoryUsage{inner_configuration_.MemoryBytes(), 0}; };
+};
+
+/**
+ * @class CompactContactRelation
+ * @brief The contact relation between a SPH body and its contact bodies
+ * with the neighbors of all particles saved in compact particle configurations.
+ */
+class CompactContactRelation : public SPHRelation
+{
+  protected:
+    UniquePtrsKeeper<SearchDepthContact> search_depth_ptrs_keeper_;
+    UniquePtrsKeeper<NeighborBuilderContact> neighbor_builder_contact_ptrs_keeper_;
+    StdVec<CellLinkedList *> target_cell_linked_lists_;
+    UniquePtrsKeeper<OnTheFlyKernel> on_the_fly_kernel_ptrs_keeper_;
+    StdVec<SearchDepthContact *> get_search_depths_;
+    StdVec<NeighborBuilderContact *> get_contact_neighbors_;
+
+  public:
+    RealBodyVector contact_bodies_;
+    StdVec<BaseParticles *> contact_particles_;
+    StdVec<CompactParticleConfiguration> contact_configuration_;
+    StdVec<OnTheFlyKernel *> on_the_fly_kernels_;
+
+    CompactContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies, bool store_kernel_values = true);
+    virtual ~CompactContactRelation() {};
+    CompactContactRelation &getRelation() { return *this; };
+    RealBodyVector getContactBodies() { return contact_bodies_; };
+    virtual void updateConfiguration() override;
+    virtual MemoryUsage getMemoryUsage() override;
+};
+} // namespace SPH
+#endif // COMPACT_BODY_RELATION_H
@@ -2,12 +2,43 @@
 #include "all_particles.h"
 #include "base_particle_dynamics.h"
 #include "cell_linked_list.hpp"
+#include "reduce_functors.h"
 
 #include <numeric>
 
 namespace SPH
 {
 //=================================================================================================//
+BoundingBoxd ContactRelationCrossResolution::
+    findParticleBounds(BaseParticles &particles, const IndexVector &particle_list)
+{
+    Vecd *pos = particles.ParticlePositions();
+    return particle_reduce(execution::ParallelPolicy(), particle_list,
+                           ReduceReference<ReduceBoundingBox>::value, ReduceBoundingBox(),
+                           [&](size_t index_i)
+                           { return BoundingBoxd(pos[index_i], pos[index_i]); });
+}
+//=================================================================================================//
+BoundingBoxd ContactRelationCrossResolution::findParticleBounds(BaseParticles &particles)
+{
+    Vecd *pos = particles.ParticlePositions();
+    return particle_reduce(execution::ParallelPolicy(), IndexRange(0, particles.TotalRealParticles()),
+                           ReduceReference<ReduceBoundingBox>::value, ReduceBoundingBox(),
+                           [&](size_t index_i)
+                           { return BoundingBoxd(pos[index_i], pos[index_i]); });
+}
+//=================================================================================================//
+bool ContactRelationCrossResolution::isContactBodyReachable(size_t k, const BoundingBoxd &source_bounds)
+{
+    if (!is_broad_phase_ || target_cell_linked_lists_[k]->getPeriodicImage().isPeriodic())
+        return true;
+
+    Real reach = Real(get_search_depths_[k]->search_depth_ + 1) * target_cell_linked_lists_[k]->getMesh().GridSpacing();
+    BoundingBoxd contact_bounds = findParticleBounds(contact_bodies_[k]->getBaseParticles());
+    return (source_bounds.lower_.array() - reach <= contact_bounds.upper_.array()).all() &&
+           (contact_bounds.lower_.array() <= source_bounds.upper_.array() + reach).all();
+}
+//=================================================================================================//
 ContactRelation::ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
     : ContactRelationCrossResolution(sph_body, contact_bodies)
 {
@@ -31,6 +62,30 @@ void ContactRelation::updateConfiguration()
     }
 }
 //=================================================================================================//
+RigidContactRelation::RigidContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
+    : ContactRelationCrossResolution(sph_body, contact_bodies),
+      rigid_transforms_(contact_bodies_.size())
+{
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        get_contact_neighbors_.push_back(
+            neighbor_builder_contact_ptrs_keeper_.createPtr<NeighborBuilderContactRigid>(
+                sph_body_, *contact_bodies_[k], rigid_transforms_[k]));
+    }
+}
+//=================================================================================================//
+void RigidContactRelation::updateConfiguration()
+{
+    resetNeighborhoodCurrentSize();
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
+        target_cell_linked_lists_[k]->searchNeighborsByMeshInFrame(
+            mesh, sph_body_, contact_configuration_[k],
+            *get_search_depths_[k], *get_contact_neighbors_[k], rigid_transforms_[k]);
+    }
+}
+//=================================================================================================//
 ShellSurfaceContactRelation::ShellSurfaceContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
     : ContactRelationCrossResolution(sph_body, contact_bodies),
       body_surface_layer_(shape_surface_ptr_keeper_.createPtr<BodySurfaceLayer>(sph_body)),
@@ -59,8 +114,12 @@ void ShellSurfaceContactRelation::resetNeighborhoodCurrentSize()
 void ShellSurfaceContactRelation::updateConfiguration()
 {
     resetNeighborhoodCurrentSize();
+    BoundingBoxd source_bounds = findParticleBounds(sph_body_.getBaseParticles(), body_part_particles_);
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
+        if (!isContactBodyReachable(k, source_bounds))
+            continue;
+
         Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
         target_cell_linked_lists_[k]->searchNeighborsByMesh(
             mesh, *body_surface_layer_, contact_configuration_[k],
@@ -146,6 +205,7 @@ ContactRelationFromShellToFluid::ContactRelationFromShellToFluid(SPHBody &sph_bo
             neighbor_builder_contact_from_shell_ptrs_keeper_.createPtr<NeighborBuilderContactFromShellToFluid>(
                 sph_body_, *contact_bodies_[k], normal_corrections[k]));
     }
+    shell_cell_bands_.resize(contact_bodies_.size());
 }
 //=================================================================================================//
 void ContactRelationFromShellToFluid::updateConfiguration()
@@ -154,9 +214,11 @@ void ContactRelationFromShellToFluid::updateConfiguration()
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
-        target_cell_linked_lists_[k]->searchNeighborsByMesh(
+        target_cell_linked_lists_[k]->tagOccupiedCellBand(
+            mesh, get_search_depths_[k]->search_depth_, shell_cell_bands_[k]);
+        target_cell_linked_lists_[k]->searchNeighborsByMeshInBand(
             mesh, sph_body_, contact_configuration_[k],
-            *get_search_depths_[k], *get_shell_contact_neighbors_[k]);
+            *get_search_depths_[k], *get_shell_contact_neighbors_[k], shell_cell_bands_[k]);
     }
 }
 //=================================================================================================//
@@ -240,8 +302,12 @@ void SurfaceContactRelation::resetNeighborhoodCurrentSize()
 void SurfaceContactRelation::updateConfiguration()
 {
     resetNeighborhoodCurrentSize();
+    BoundingBoxd source_bounds = findParticleBounds(sph_body_.getBaseParticles(), body_part_particles_);
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
+        if (!isContactBodyReachable(k, source_bounds))
+            continue;
+
         Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
         target_cell_linked_lists_[k]->searchNeighborsByMesh(
             mesh, *body_surface_layer_, contact_configuration_[k],
@@ -62,10 +62,22 @@ class ContactRelationCrossResolution : public BaseContactRelation
     };
     virtual ~ContactRelationCrossResolution() {};
     StdVec<CellLinkedList *> getContactCellLinkedList() { return target_cell_linked_lists_; }
+    /** Broad phase is not valid for bodies with ghost particles, e.g. by classic periodic conditions. */
+    void setBroadPhase(bool is_broad_phase) { is_broad_phase_ = is_broad_phase; };
 
   protected:
     StdVec<CellLinkedList *> target_cell_linked_lists_;
     StdVec<SearchDepthContact *> get_search_depths_;
+    bool is_broad_phase_ = true;
+
+    /** Bounds of the present particle positions. */
+    BoundingBoxd findParticleBounds(BaseParticles &particles, const IndexVector &particle_list);
+    BoundingBoxd findParticleBounds(BaseParticles &particles);
+    /**
+     * Broad phase: the contact body k is possibly within the search reach
+     * only if its bounds overlap the source bounds expanded by the search stencil.
+     */
+    bool isContactBodyReachable(size_t k, const BoundingBoxd &source_bounds);
 };
 
 /**
@@ -86,6 +98,31 @@ class ContactRelation : public ContactRelationCrossResolution
     StdVec<NeighborBuilderContact *> get_contact_neighbors_;
 };
 
+/**
+ * @class RigidContactRelation
+ * @brief The relation between a SPH body and its rigid contact bodies.
+ * The cell linked lists of the contact bodies are built once in their initial frames
+ * and need not be updated any more. Instead, the rigid transforms from the initial
+ * to the present frames are given before updating the configuration,
+ * so that only the positions of the searching particles are transformed.
+ */
+class RigidContactRelation : public ContactRelationCrossResolution
+{
+  protected:
+    UniquePtrsKeeper<NeighborBuilderContactRigid> neighbor_builder_contact_ptrs_keeper_;
+
+  public:
+    RigidContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies);
+    virtual ~RigidContactRelation() {};
+    void setRigidTransform(size_t k, const Transform &rigid_transform) { rigid_transforms_[k] = rigid_transform; };
+    Transform &getRigidTransform(size_t k) { return rigid_transforms_[k]; };
+    virtual void updateConfiguration() override;
+
+  protected:
+    StdVec<Transform> rigid_transforms_;
+    StdVec<NeighborBuilderContactRigid *> get_contact_neighbors_;
+};
+
 /**
  * @class ShellSurfaceContactRelation
  * @brief The relation between a solid body and its contact shell bodies
@@ -157,6 +194,8 @@ class AdaptiveContactRelation : public BaseContactRelation
 /**
  * @class ContactRelationFromShellToFluid
  * @brief The relation between a fluid body and its contact shell bodies
+ * @details Only the fluid particles in the cell band along the shell surface are searched,
+ * as the most cells of the shell cell linked list are empty.
  */
 class ContactRelationFromShellToFluid : public ContactRelationCrossResolution
 {
@@ -170,6 +209,7 @@ class ContactRelationFromShellToFluid : public ContactRelationCrossResolution
 
   private:
     StdVec<NeighborBuilderContactFromShellToFluid *> get_shell_contact_neighbors_;
+    StdVec<StdVec<char>> shell_cell_bands_;
 };
 
 /**
@@ -53,7 +53,14 @@ SelfSurfaceContactRelation::
       body_surface_layer_(real_body),
       body_part_particles_(body_surface_layer_.body_part_particles_),
       get_self_contact_neighbor_(real_body),
-      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())) {}
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      deformation_tolerance_(0), F_(nullptr), searched_surface_particles_(base_particles_) {}
+//=================================================================================================//
+void SelfSurfaceContactRelation::skipUndeformedRegions(Real deformation_tolerance)
+{
+    deformation_tolerance_ = deformation_tolerance;
+    F_ = base_particles_.getVariableDataByName<Matd>("DeformationGradient");
+}
 //=================================================================================================//
 void SelfSurfaceContactRelation::resetNeighborhoodCurrentSize()
 {
@@ -68,9 +75,55 @@ void SelfSurfaceContactRelation::updateConfiguration()
 {
     resetNeighborhoodCurrentSize();
     Mesh &mesh = cell_linked_list_.getMesh();
+    if (F_ == nullptr)
+    {
+        cell_linked_list_.searchNeighborsByMesh(
+            mesh, body_surface_layer_, inner_configuration_,
+            get_single_search_depth_, get_self_contact_neighbor_);
+        return;
+    }
+
+    collectSearchedSurfaceParticles();
     cell_linked_list_.searchNeighborsByMesh(
-        mesh, body_surface_layer_, inner_configuration_,
+        mesh, searched_surface_particles_, inner_configuration_,
         get_single_search_depth_, get_self_contact_neighbor_);
+    tagParticlesInContact();
+}
+//=================================================================================================//
+void SelfSurfaceContactRelation::collectSearchedSurfaceParticles()
+{
+    is_in_contact_.resize(base_particles_.ParticlesBound(), 1);
+    IndexVector &searched = searched_surface_particles_.particles_;
+    searched.clear();
+    const Matd identity = Matd::Identity();
+    for (size_t index_i : body_part_particles_)
+    {
+        if (is_in_contact_[index_i] || (F_[index_i] - identity).norm() > deformation_tolerance_)
+        {
+            searched.push_back(index_i);
+        }
+    }
+}
+//=================================================================================================//
+void SelfSurfaceContactRelation::tagParticlesInContact()
+{
+    for (size_t index_i : body_part_particles_)
+    {
+        is_in_contact_[index_i] = 0;
+    }
+    // Self contact pairs are few, so the tagging is sequential.
+    for (size_t index_i : searched_surface_particles_.particles_)
+    {
+        const Neighborhood &neighborhood = inner_configuration_[index_i];
+        if (neighborhood.current_size_ != 0)
+        {
+            is_in_contact_[index_i] = 1;
+            for (size_t n = 0; n != neighborhood.current_size_; ++n)
+            {
+                is_in_contact_[neighborhood.j_[n]] = 1;
+            }
+        }
+    }
 }
 //=================================================================================================//
 TreeInnerRelation::TreeInnerRelation(RealBody &real_body)
@@ -85,14 +85,35 @@ class SelfSurfaceContactRelation : public BaseInnerRelation
     explicit SelfSurfaceContactRelation(RealBody &real_body);
     virtual ~SelfSurfaceContactRelation() {};
     virtual void updateConfiguration() override;
+    /**
+     * The search is skipped for the surface particles whose deformation gradient stays
+     * within the tolerance of identity, unless they were in contact at the last update.
+     * The particles found by a searched particle are kept in the search for the next update.
+     */
+    void skipUndeformedRegions(Real deformation_tolerance);
 
   protected:
     IndexVector &body_part_particles_;
     SearchDepthSingleResolution get_single_search_depth_;
     NeighborBuilderSelfContact get_self_contact_neighbor_;
     CellLinkedList &cell_linked_list_;
+    Real deformation_tolerance_;
+    Matd *F_;
+    StdVec<char> is_in_contact_;
+
+    /** The surface particles searched in the current update. */
+    struct SearchedSurfaceParticles
+    {
+        BaseParticles &base_particles_;
+        IndexVector particles_;
+        explicit SearchedSurfaceParticles(BaseParticles &base_particles) : base_particles_(base_particles) {};
+        BaseParticles &getBaseParticles() { return base_particles_; };
+        IndexVector &LoopRange() { return particles_; };
+    } searched_surface_particles_;
 
     virtual void resetNeighborhoodCurrentSize() override;
+    void collectSearchedSurfaceParticles();
+    void tagParticlesInContact();
 };
 
 class TreeBody;
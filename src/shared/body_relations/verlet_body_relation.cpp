@@ -0,0 +1,170 @@
+#include "verlet_body_relation.h"
+#include "base_particle_dynamics.h"
+#include "base_particles.hpp"
+#include "cell_linked_list.hpp"
+#include "reduce_functors.h"
+
+namespace SPH
+{
+//=================================================================================================//
+VerletSkin::VerletSkin(SPHBody &sph_body)
+    : base_particles_(sph_body.getBaseParticles()),
+      pos_at_build_(base_particles_.ParticlesBound(), ZeroData<Vecd>::value),
+      total_real_particles_at_build_(0) {}
+//=================================================================================================//
+void VerletSkin::recordPositions()
+{
+    Vecd *pos = base_particles_.ParticlePositions();
+    total_real_particles_at_build_ = base_particles_.TotalRealParticles();
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles_at_build_),
+                 [&](size_t index_i)
+                 { pos_at_build_[index_i] = pos[index_i]; });
+}
+//=================================================================================================//
+Real VerletSkin::MaxDisplacement()
+{
+    size_t total_real_particles = base_particles_.TotalRealParticles();
+    if (total_real_particles != total_real_particles_at_build_)
+    {
+        return MaxReal;
+    }
+
+    Vecd *pos = base_particles_.ParticlePositions();
+    Real max_displacement_sqr = particle_reduce(
+        execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+        ReduceReference<ReduceMax>::value, ReduceMax(),
+        [&](size_t index_i)
+        { return (pos[index_i] - pos_at_build_[index_i]).squaredNorm(); });
+    return std::sqrt(max_displacement_sqr);
+}
+//=================================================================================================//
+VerletInnerRelation::VerletInnerRelation(RealBody &real_body, Real skin_ratio)
+    : BaseInnerRelation(real_body),
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      get_neighbor_with_skin_(real_body.getSPHAdaptation().getKernel(), skin_ratio, true),
+      get_search_depth_(get_neighbor_with_skin_.CutOffRadiusWithSkin(), cell_linked_list_.getMesh()),
+      verlet_skin_(real_body),
+      skin_thickness_(skin_ratio * real_body.getSPHAdaptation().getKernel()->CutOffRadius()),
+      is_rebuild_forced_(true), total_builds_(0) {}
+//=================================================================================================//
+void VerletInnerRelation::buildNeighborList()
+{
+    real_body_->updateCellLinkedList();
+    resetNeighborhoodCurrentSize();
+    Mesh &mesh = cell_linked_list_.getMesh();
+    cell_linked_list_.searchNeighborsByMesh(mesh, sph_body_, inner_configuration_,
+                                            get_search_depth_, get_neighbor_with_skin_);
+    verlet_skin_.recordPositions();
+    is_rebuild_forced_ = false;
+    total_builds_++;
+}
+//=================================================================================================//
+void VerletInnerRelation::updateNeighborList()
+{
+    Vecd *pos = base_particles_.ParticlePositions();
+    particle_for(execution::ParallelPolicy(), sph_body_.LoopRange(),
+                 [&](size_t index_i)
+                 {
+                     Neighborhood &neighborhood = inner_configuration_[index_i];
+                     for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                     {
+                         Vecd displacement = pos[index_i] - pos[neighborhood.j_[n]];
+                         get_neighbor_with_skin_.updateNeighbor(
+                             neighborhood, n, displacement.norm(), displacement);
+                     }
+                 });
+}
+//=================================================================================================//
+void VerletInnerRelation::updateConfiguration()
+{
+    // relative displacement of a pair is bounded by twice of the maximum displacement
+    if (is_rebuild_forced_ || 2.0 * verlet_skin_.MaxDisplacement() > skin_thickness_)
+    {
+        buildNeighborList();
+    }
+    else
+    {
+        updateNeighborList();
+    }
+}
+//=================================================================================================//
+VerletContactRelation::VerletContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies, Real skin_ratio)
+    : BaseContactRelation(sph_body, contact_bodies), verlet_skin_(sph_body),
+      is_rebuild_forced_(true), total_builds_(0)
+{
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        contact_real_bodies_.push_back(contact_bodies_[k]);
+        CellLinkedList *target_cell_linked_list =
+            DynamicCast<CellLinkedList>(this, &contact_bodies_[k]->getCellLinkedList());
+        target_cell_linked_lists_.push_back(target_cell_linked_list);
+        Kernel *kernel = NeighborBuilder::chooseKernel(sph_body_, *contact_bodies_[k]);
+        NeighborBuilderWithSkin *neighbor_builder =
+            neighbor_builder_ptrs_keeper_.createPtr<NeighborBuilderWithSkin>(kernel, skin_ratio, false);
+        get_neighbors_with_skin_.push_back(neighbor_builder);
+        get_search_depths_.push_back(
+            search_depth_ptrs_keeper_.createPtr<SearchDepthWithSkin>(
+                neighbor_builder->CutOffRadiusWithSkin(), target_cell_linked_list->getMesh()));
+        contact_verlet_skins_.push_back(verlet_skin_ptrs_keeper_.createPtr<VerletSkin>(*contact_bodies_[k]));
+        skin_thickness_.push_back(skin_ratio * kernel->CutOffRadius());
+    }
+}
+//=================================================================================================//
+void VerletContactRelation::buildNeighborList(size_t k)
+{
+    contact_real_bodies_[k]->updateCellLinkedList();
+    particle_for(execution::ParallelPolicy(), sph_body_.LoopRange(),
+                 [&](size_t index_i)
+                 { contact_configuration_[k][index_i].current_size_ = 0; });
+    Mesh &mesh = target_cell_linked_lists_[k]->getMesh();
+    target_cell_linked_lists_[k]->searchNeighborsByMesh(
+        mesh, sph_body_, contact_configuration_[k],
+        *get_search_depths_[k], *get_neighbors_with_skin_[k]);
+    contact_verlet_skins_[k]->recordPositions();
+}
+//=================================================================================================//
+void VerletContactRelation::updateNeighborList(size_t k)
+{
+    Vecd *pos = base_particles_.ParticlePositions();
+    Vecd *contact_pos = contact_particles_[k]->ParticlePositions();
+    particle_for(execution::ParallelPolicy(), sph_body_.LoopRange(),
+                 [&](size_t index_i)
+                 {
+                     Neighborhood &neighborhood = contact_configuration_[k][index_i];
+                     for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                     {
+                         Vecd displacement = pos[index_i] - contact_pos[neighborhood.j_[n]];
+                         get_neighbors_with_skin_[k]->updateNeighbor(
+                             neighborhood, n, displacement.norm(), displacement);
+                     }
+                 });
+}
+//=================================================================================================//
+void VerletContactRelation::updateConfiguration()
+{
+    Real max_displacement = verlet_skin_.MaxDisplacement();
+    bool is_any_rebuilt = false;
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        // relative displacement of a pair is bounded by the sum of maximum displacements
+        if (is_rebuild_forced_ ||
+            max_displacement + contact_verlet_skins_[k]->MaxDisplacement() > skin_thickness_[k])
+        {
+            buildNeighborList(k);
+            is_any_rebuilt = true;
+        }
+        else
+        {
+            updateNeighborList(k);
+        }
+    }
+
+    if (is_any_rebuilt)
+    {
+        verlet_skin_.recordPositions();
+        is_rebuild_forced_ = false;
+        total_builds_++;
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,122 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	verlet_body_relation.h
+ * @brief 	The topological relations with neighbor lists including a skin layer,
+ * 			which are reused until the particles have moved across the skin.
+ * @details The neighbor lists are built with the cut-off radius (1 + skin_ratio) * rc.
+ * 			Between two builds, only the pair geometry and kernel values are updated.
+ * 			A rebuild is carried out when the maximum particle displacement since the last build
+ * 			exceeds half of the skin thickness. The cell linked lists are updated only for a rebuild.
+ * 			Note that particle sorting changes particle indices
+ * 			so that forceRebuild() should be called after sorting.
+ * 			These relations are not applicable for periodic conditions by cell linked list.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef VERLET_BODY_RELATION_H
+#define VERLET_BODY_RELATION_H
+
+#include "base_body_relation.h"
+
+namespace SPH
+{
+/**
+ * @class VerletSkin
+ * @brief Tracking the particle displacements of a body since the last neighbor list build.
+ */
+class VerletSkin
+{
+  public:
+    explicit VerletSkin(SPHBody &sph_body);
+    ~VerletSkin() {};
+    void recordPositions();
+    /** maximum displacement since the last build, infinite if the number of particles has changed */
+    Real MaxDisplacement();
+
+  protected:
+    BaseParticles &base_particles_;
+    StdVec<Vecd> pos_at_build_;
+    size_t total_real_particles_at_build_;
+};
+
+/**
+ * @class VerletInnerRelation
+ * @brief The inner relation with a reusable neighbor list.
+ */
+class VerletInnerRelation : public BaseInnerRelation
+{
+  public:
+    VerletInnerRelation(RealBody &real_body, Real skin_ratio = 0.2);
+    virtual ~VerletInnerRelation() {};
+    virtual void updateConfiguration() override;
+    void forceRebuild() { is_rebuild_forced_ = true; };
+    size_t TotalBuilds() { return total_builds_; };
+
+  protected:
+    CellLinkedList &cell_linked_list_;
+    NeighborBuilderWithSkin get_neighbor_with_skin_;
+    SearchDepthWithSkin get_search_depth_;
+    VerletSkin verlet_skin_;
+    Real skin_thickness_;
+    bool is_rebuild_forced_;
+    size_t total_builds_;
+
+    void buildNeighborList();
+    void updateNeighborList();
+};
+
+/**
+ * @class VerletContactRelation
+ * @brief The contact relation with reusable neighbor lists.
+ */
+class VerletContactRelation : public BaseContactRelation
+{
+  protected:
+    UniquePtrsKeeper<NeighborBuilderWithSkin> neighbor_builder_ptrs_keeper_;
+    UniquePtrsKeeper<SearchDepthWithSkin> search_depth_ptrs_keeper_;
+    UniquePtrsKeeper<VerletSkin> verlet_skin_ptrs_keeper_;
+
+  public:
+    VerletContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies, Real skin_ratio = 0.2);
+    virtual ~VerletContactRelation() {};
+    virtual void updateConfiguration() override;
+    void forceRebuild() { is_rebuild_forced_ = true; };
+    size_t TotalBuilds() { return total_builds_; };
+
+  protected:
+    StdVec<RealBody *> contact_real_bodies_;
+    StdVec<CellLinkedList *> target_cell_linked_lists_;
+    StdVec<NeighborBuilderWithSkin *> get_neighbors_with_skin_;
+    StdVec<SearchDepthWithSkin *> get_search_depths_;
+    VerletSkin verlet_skin_;
+    StdVec<VerletSkin *> contact_verlet_skins_;
+    StdVec<Real> skin_thickness_;
+    bool is_rebuild_forced_;
+    size_t total_builds_;
+
+    void buildNeighborList(size_t k);
+    void updateNeighborList(size_t k);
+};
+} // namespace SPH
+#endif // VERLET_BODY_RELATION_H
@@ -1,5 +1,7 @@
 #include "algorithm_primitive.h"
 
+#include <tbb/task_arena.h>
+
 namespace SPH
 {
 //=================================================================================================//
@@ -15,6 +17,15 @@ void QuickSort::SwapIndex::operator()(UnsignedInt *a, UnsignedInt *b)
     std::swap(index_permutation_[index_a], index_permutation_[index_b]);
 }
 //=================================================================================================//
+void QuickSort::sort(const SequencedPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index)
+{
+    quick_sort_range_.begin_ = sequence_ + start_index;
+    quick_sort_range_.size_ = size;
+    tbb::task_arena single_thread_arena(1); // same range splitting as the parallel version
+    single_thread_arena.execute([&]()
+                                { tbb::parallel_for(quick_sort_range_, quick_sort_body_); });
+}
+//=================================================================================================//
 void QuickSort::sort(const ParallelPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index)
 {
     quick_sort_range_.begin_ = sequence_ + start_index;
@@ -22,4 +33,142 @@ void QuickSort::sort(const ParallelPolicy &ex_policy, UnsignedInt size, Unsigned
     tbb::parallel_for(quick_sort_range_, quick_sort_body_);
 }
 //=================================================================================================//
+template <class BlockFunction>
+void HostRadixSort::forEachBlock(const SequencedPolicy &ex_policy, UnsignedInt number_of_blocks,
+                                 const BlockFunction &block_function)
+{
+    for (UnsignedInt block = 0; block != number_of_blocks; ++block)
+    {
+        block_function(block);
+    }
+}
+//=================================================================================================//
+template <class BlockFunction>
+void HostRadixSort::forEachBlock(const ParallelPolicy &ex_policy, UnsignedInt number_of_blocks,
+                                 const BlockFunction &block_function)
+{
+    tbb::parallel_for(UnsignedInt(0), number_of_blocks, block_function);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void HostRadixSort::radixSort(const ExecutionPolicy &ex_policy, UnsignedInt size,
+                              UnsignedInt start_index, UnsignedInt number_of_blocks)
+{
+    if (size < 2)
+    {
+        return;
+    }
+
+    UnsignedInt block_size = (size + number_of_blocks - 1) / number_of_blocks;
+    UnsignedInt *keys = sequence_ + start_index;
+    UnsignedInt *values = index_permutation_ + start_index;
+
+    StdVec<UnsignedInt> block_max_keys(number_of_blocks, 0);
+    forEachBlock(ex_policy, number_of_blocks,
+                 [&](UnsignedInt block)
+                 {
+                     UnsignedInt end = SMIN((block + 1) * block_size, size);
+                     UnsignedInt max_key = 0;
+                     for (UnsignedInt i = block * block_size; i < end; ++i)
+                     {
+                         max_key = SMAX(max_key, keys[i]);
+                     }
+                     block_max_keys[block] = max_key;
+                 });
+    UnsignedInt max_key = *std::max_element(block_max_keys.begin(), block_max_keys.end());
+
+    UnsignedInt number_of_passes = 0;
+    for (UnsignedInt remaining = max_key; remaining != 0; remaining >>= radix_bits_)
+    {
+        ++number_of_passes;
+    }
+
+    if (sequence_buffer_.size() < size)
+    {
+        sequence_buffer_.resize(size);
+        index_permutation_buffer_.resize(size);
+    }
+    block_offsets_.resize(radix_size_ * number_of_blocks);
+
+    UnsignedInt *source_keys = keys;
+    UnsignedInt *source_values = values;
+    UnsignedInt *target_keys = sequence_buffer_.data();
+    UnsignedInt *target_values = index_permutation_buffer_.data();
+    UnsignedInt *block_offsets = block_offsets_.data();
+    for (UnsignedInt pass = 0; pass != number_of_passes; ++pass)
+    {
+        UnsignedInt shift = pass * radix_bits_;
+        forEachBlock(ex_policy, number_of_blocks,
+                     [&](UnsignedInt block)
+                     {
+                         UnsignedInt histogram[radix_size_] = {0};
+                         UnsignedInt end = SMIN((block + 1) * block_size, size);
+                         for (UnsignedInt i = block * block_size; i < end; ++i)
+                         {
+                             ++histogram[(source_keys[i] >> shift) & (radix_size_ - 1)];
+                         }
+                         for (UnsignedInt digit = 0; digit != radix_size_; ++digit)
+                         {
+                             block_offsets[digit * number_of_blocks + block] = histogram[digit];
+                         }
+                     });
+
+        // digit-major order gives the stable position of each block for each digit
+        UnsignedInt offset = 0;
+        for (UnsignedInt k = 0; k != radix_size_ * number_of_blocks; ++k)
+        {
+            UnsignedInt count = block_offsets[k];
+            block_offsets[k] = offset;
+            offset += count;
+        }
+
+        forEachBlock(ex_policy, number_of_blocks,
+                     [&](UnsignedInt block)
+                     {
+                         UnsignedInt offsets[radix_size_];
+                         for (UnsignedInt digit = 0; digit != radix_size_; ++digit)
+                         {
+                             offsets[digit] = block_offsets[digit * number_of_blocks + block];
+                         }
+                         UnsignedInt end = SMIN((block + 1) * block_size, size);
+                         for (UnsignedInt i = block * block_size; i < end; ++i)
+                         {
+                             UnsignedInt target = offsets[(source_keys[i] >> shift) & (radix_size_ - 1)]++;
+                             target_keys[target] = source_keys[i];
+                             target_values[target] = source_values[i];
+                         }
+                     });
+
+        std::swap(source_keys, target_keys);
+        std::swap(source_values, target_values);
+    }
+
+    if (source_keys != keys)
+    {
+        forEachBlock(ex_policy, number_of_blocks,
+                     [&](UnsignedInt block)
+                     {
+                         UnsignedInt begin = block * block_size;
+                         UnsignedInt end = SMIN(begin + block_size, size);
+                         if (begin < end)
+                         {
+                             std::copy(source_keys + begin, source_keys + end, keys + begin);
+                             std::copy(source_values + begin, source_values + end, values + begin);
+                         }
+                     });
+    }
+}
+//=================================================================================================//
+void HostRadixSort::sort(const SequencedPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index)
+{
+    radixSort(ex_policy, size, start_index, 1);
+}
+//=================================================================================================//
+void HostRadixSort::sort(const ParallelPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index)
+{
+    UnsignedInt max_blocks = 4 * UnsignedInt(tbb::this_task_arena::max_concurrency());
+    UnsignedInt number_of_blocks = SMAX(UnsignedInt(1), SMIN(max_blocks, size / block_grain_size_));
+    radixSort(ex_policy, size, start_index, number_of_blocks);
+}
+//=================================================================================================//
 } // namespace SPH
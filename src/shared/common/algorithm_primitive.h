@@ -29,6 +29,7 @@
 #ifndef ALGORITHM_PRIMITIVE_H
 #define ALGORITHM_PRIMITIVE_H
 
+#include "loop_scheduling.h"
 #include "sphinxsys_variable.h"
 
 #include <numeric>
@@ -227,6 +228,7 @@ class QuickSort
           swap_index_(sequence_, index_permutation_), compare_(),
           quick_sort_range_(sequence_, 0, compare_, swap_index_),
           quick_sort_body_(){};
+    void sort(const SequencedPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index = 0);
     void sort(const ParallelPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index = 0);
 
   protected:
@@ -238,6 +240,43 @@ class QuickSort
     tbb::interface9::QuickSortBody<UnsignedInt *, CompareSequence, SwapIndex> quick_sort_body_;
 };
 
+/**
+ * @class HostRadixSort
+ * @brief The least-significant-digit radix sort of the sequence and index-permutation pairs on the host.
+ * @details The number of the passes is given by the maximum key, i.e. the bounded cell ordering.
+ * The range is divided into blocks, each with its own digit histogram,
+ * so that the scatter is stable and each block writes to contiguous segments of the output.
+ */
+class HostRadixSort
+{
+    static constexpr UnsignedInt radix_bits_ = 8;
+    static constexpr UnsignedInt radix_size_ = 1 << radix_bits_;
+    static constexpr UnsignedInt block_grain_size_ = 4096;
+
+  public:
+    template <class ExecutionPolicy>
+    explicit HostRadixSort(const ExecutionPolicy &ex_policy,
+                           DiscreteVariable<UnsignedInt> *dv_sequence,
+                           DiscreteVariable<UnsignedInt> *dv_index_permutation)
+        : sequence_(dv_sequence->DelegatedData(ex_policy)),
+          index_permutation_(dv_index_permutation->DelegatedData(ex_policy)) {};
+    void sort(const SequencedPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index = 0);
+    void sort(const ParallelPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index = 0);
+
+  protected:
+    UnsignedInt *sequence_;
+    UnsignedInt *index_permutation_;
+    StdVec<UnsignedInt> sequence_buffer_, index_permutation_buffer_;
+    StdVec<UnsignedInt> block_offsets_; /**< digit-major offsets of all blocks */
+
+    template <class BlockFunction>
+    void forEachBlock(const SequencedPolicy &ex_policy, UnsignedInt number_of_blocks, const BlockFunction &block_function);
+    template <class BlockFunction>
+    void forEachBlock(const ParallelPolicy &ex_policy, UnsignedInt number_of_blocks, const BlockFunction &block_function);
+    template <class ExecutionPolicy>
+    void radixSort(const ExecutionPolicy &ex_policy, UnsignedInt size, UnsignedInt start_index, UnsignedInt number_of_blocks);
+};
+
 template <typename T, typename Op>
 T exclusive_scan(const SequencedPolicy &seq_policy, T *first, T *d_first, UnsignedInt d_size, Op op)
 {
@@ -287,7 +326,8 @@ template <class LocalDynamicsFunction>
 inline void generic_for(const ParallelPolicy &par_host, const IndexRange &particles_range,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
-    tbb::parallel_for(
+    static tbb::affinity_partitioner affinity_partitioner;
+    scheduled_parallel_for(
         particles_range,
         [&](const IndexRange &r)
         {
@@ -296,7 +336,7 @@ inline void generic_for(const ParallelPolicy &par_host, const IndexRange &partic
                 local_dynamics_function(i);
             }
         },
-        ap);
+        affinity_partitioner);
 };
 } // namespace SPH
 
@@ -0,0 +1,65 @@
+#include "allocation_counter.h"
+
+#if SPHINXSYS_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<size_t> heap_allocation_count{0};
+
+void *countedAllocation(std::size_t size)
+{
+    heap_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void *countedAlignedAllocation(std::size_t size, std::align_val_t alignment)
+{
+    heap_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    void *ptr = nullptr;
+    return posix_memalign(&ptr, align < sizeof(void *) ? sizeof(void *) : align, size == 0 ? 1 : size) == 0
+               ? ptr
+               : nullptr;
+}
+} // namespace
+
+void *operator new(std::size_t size)
+{
+    void *ptr = countedAllocation(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return countedAllocation(size); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return countedAllocation(size); }
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    void *ptr = countedAlignedAllocation(size, alignment);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+void *operator new[](std::size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+namespace SPH
+{
+//=================================================================================================//
+size_t heapAllocationCount()
+{
+    return heap_allocation_count.load(std::memory_order_relaxed);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // SPHINXSYS_COUNT_ALLOCATIONS
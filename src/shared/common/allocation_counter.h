@@ -0,0 +1,47 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	allocation_counter.h
+ * @brief 	Counting the heap allocations, e.g. for finding the allocations in hot loops.
+ * @details With the build option SPHINXSYS_COUNT_ALLOCATIONS, the global operator new is replaced
+ *          by one counting the allocations of all threads, and DynamicsProfiler reports
+ *          the allocations within each profiled dynamics execution.
+ *          Otherwise, the count is always zero without any cost.
+ *          The counting allocation uses malloc and posix_memalign, so it is for POSIX systems only.
+ * @author	Xiangyu Hu
+ */
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace SPH
+{
+#if SPHINXSYS_COUNT_ALLOCATIONS
+/** the number of heap allocations by operator new since the program start */
+size_t heapAllocationCount();
+#else
+inline size_t heapAllocationCount() { return 0; };
+#endif
+} // namespace SPH
+#endif // ALLOCATION_COUNTER_H
@@ -67,6 +67,40 @@ using AtomicRef = boost::atomic_ref<T>;
 namespace math = std;
 #endif // SPHINXSYS_USE_SYCL
 
+/** Atomically add to a scalar, or to a vector or matrix component by component. */
+template <typename DataType>
+inline void atomicAdd(DataType &target, const DataType &value)
+{
+    AtomicRef<DataType>(target).fetch_add(value);
+}
+
+template <typename DataType, int N, int M>
+inline void atomicAdd(Eigen::Matrix<DataType, N, M> &target, const Eigen::Matrix<DataType, N, M> &value)
+{
+    for (int k = 0; k != N * M; ++k)
+        AtomicRef<DataType>(target.data()[k]).fetch_add(value.data()[k]);
+}
+
+/** Atomically raise a scalar to the value, if the latter is larger. */
+template <typename DataType>
+inline void atomicMax(DataType &target, const DataType &value)
+{
+    AtomicRef<DataType> atomic_target(target);
+    DataType present = atomic_target.load();
+    while (present < value && !atomic_target.compare_exchange_weak(present, value))
+    {
+    }
+}
+
+/** Vectorize a neighbor loop with a sum reduction, in which the neighbor data are gathered
+ *  by index. Compilers do not vectorize such floating-point reductions by themselves. */
+#define SPHINXSYS_PRAGMA(x) _Pragma(#x)
+#if SPHINXSYS_USE_SIMD && !SPHINXSYS_USE_SYCL && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_SUM_REDUCTION(variable) SPHINXSYS_PRAGMA(omp simd reduction(+ : variable))
+#else
+#define SIMD_SUM_REDUCTION(variable)
+#endif // SPHINXSYS_USE_SIMD
+
 #if SPHINXSYS_USE_FLOAT
 using Real = float;
 #if defined(_MSC_VER)
@@ -79,6 +113,14 @@ using Real = double;
 using UnsignedInt = size_t;
 #endif // SPHINXSYS_USE_FLOAT
 
+/** Real type for the per-particle sums in interaction kernels,
+ *  double with mixed precision while the particle data are stored with float. */
+#if SPHINXSYS_USE_FLOAT && SPHINXSYS_USE_MIXED_PRECISION
+using AccumulationReal = double;
+#else
+using AccumulationReal = Real;
+#endif // SPHINXSYS_USE_MIXED_PRECISION
+
 /** Vector with integers. */
 using Array2i = Eigen::Array<int, 2, 1>;
 using Array3i = Eigen::Array<int, 3, 1>;
@@ -101,6 +143,25 @@ using VecMatGrad3d = Eigen::Matrix<Real, 6, 3>;
 /** Dynamic matrix*/
 using MatXd = Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>;
 
+/** Vector with accumulation precision. */
+template <int N>
+using AccumulationVec = Eigen::Matrix<AccumulationReal, N, 1>;
+
+/** Conversion between storage and accumulation precision. */
+template <class Derived>
+inline auto accumulationCast(const Eigen::MatrixBase<Derived> &value)
+{
+    return value.template cast<AccumulationReal>();
+}
+
+template <class Derived>
+inline Eigen::Matrix<Real, Derived::RowsAtCompileTime, Derived::ColsAtCompileTime>
+storageCast(const Eigen::MatrixBase<Derived> &value)
+{
+    return value.template cast<Real>();
+}
+inline Real storageCast(AccumulationReal value) { return static_cast<Real>(value); }
+
 /** Unified initialize to zero for all data type. */
 template <typename DataType>
 struct ZeroData
@@ -136,6 +197,12 @@ struct ZeroData<UnsignedInt>
     static inline const UnsignedInt value = 0;
 };
 
+template <>
+struct ZeroData<uint8_t>
+{
+    static inline const uint8_t value = 0;
+};
+
 template <typename FirstType, typename SecondType>
 struct ZeroData<std::pair<FirstType, SecondType>>
 {
@@ -212,6 +279,12 @@ struct DataTypeIndex<VecMatGrad3d>
 {
     static constexpr int value = 10;
 };
+/** Compact storage for the per-particle flags and indicators. */
+template <>
+struct DataTypeIndex<uint8_t>
+{
+    static constexpr int value = 11;
+};
 /** Verbal boolean for positive and negative axis directions. */
 const int xAxis = 0;
 const int yAxis = 1;
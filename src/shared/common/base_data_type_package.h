@@ -64,7 +64,8 @@ using DataAssemble = std::tuple<KeeperType<ContainerType<UnsignedInt>>,
                                 KeeperType<ContainerType<Vec6d>>,
                                 KeeperType<ContainerType<Mat6d>>,
                                 KeeperType<ContainerType<VecMatGrad2d>>,
-                                KeeperType<ContainerType<VecMatGrad3d>>>;
+                                KeeperType<ContainerType<VecMatGrad3d>>,
+                                KeeperType<ContainerType<uint8_t>>>;
 /** Generalized data container assemble type */
 template <template <typename> typename ContainerType>
 using DataContainerAssemble = DataAssemble<DataContainerKeeper, ContainerType>;
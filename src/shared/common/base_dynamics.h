@@ -29,6 +29,8 @@
 #define BASE_DYNAMICS_H
 
 #include "base_data_type_package.h"
+#include "dynamics_profiler.h"
+#include "loop_scheduling.h"
 
 namespace SPH
 {
@@ -58,6 +60,15 @@ class BaseDynamics : public AbstractDynamics
     /** There is the interface functions for computing. */
     virtual ReturnType exec(Real dt = 0.0) = 0;
 
+    /** The execution hints for the parallel loops of the dynamics, used for dynamics on few particles. */
+    void setGrainSize(size_t grain_size) { execution_hint_.grain_size_ = grain_size; };
+    void setSerialCutoff(size_t serial_cutoff) { execution_hint_.serial_cutoff_ = serial_cutoff; };
+    void setTaskArena(tbb::task_arena &task_arena) { execution_hint_.task_arena_ = &task_arena; };
+    const execution::ExecutionHint &getExecutionHint() { return execution_hint_; };
+
+  protected:
+    execution::ExecutionHint execution_hint_;
+
   private:
     bool is_newly_updated_;
 };
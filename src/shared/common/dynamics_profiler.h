@@ -0,0 +1,234 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	dynamics_profiler.h
+ * @brief 	Opt-in timing of the execution of particle dynamics,
+ *          reported per dynamics and body, or written as a Chrome trace.
+ * @author	Xiangyu Hu
+ */
+#ifndef DYNAMICS_PROFILER_H
+#define DYNAMICS_PROFILER_H
+
+#include "allocation_counter.h"
+#include "base_data_type_package.h"
+#include "hardware_counters.h"
+
+#include <array>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace SPH
+{
+/**
+ * @struct NeighborStatisticsRecord
+ * @brief The summary of the neighbor lists of a relation to one target, see NeighborStatistics.
+ * The sums are kept so that the records evaluated on particle ranges can be joined.
+ */
+struct NeighborStatisticsRecord
+{
+    static constexpr size_t HistogramBins = 16; /**< the last bin counts all larger neighbor sizes */
+    size_t particles_ = 0;
+    size_t min_size_ = std::numeric_limits<size_t>::max();
+    size_t max_size_ = 0;
+    size_t total_size_ = 0;
+    size_t candidates_ = 0;     /**< the particles visited by the cell linked list search */
+    size_t index_distance_ = 0; /**< the summed index distances of the neighbors */
+    size_t bin_width_ = 1;
+    std::array<size_t, HistogramBins> histogram_{};
+
+    void addParticle(size_t neighbor_size, size_t candidates, size_t index_distance)
+    {
+        particles_++;
+        min_size_ = SMIN(min_size_, neighbor_size);
+        max_size_ = SMAX(max_size_, neighbor_size);
+        total_size_ += neighbor_size;
+        candidates_ += candidates;
+        index_distance_ += index_distance;
+        histogram_[SMIN(neighbor_size / bin_width_, HistogramBins - 1)]++;
+    };
+    void join(const NeighborStatisticsRecord &other)
+    {
+        particles_ += other.particles_;
+        min_size_ = SMIN(min_size_, other.min_size_);
+        max_size_ = SMAX(max_size_, other.max_size_);
+        total_size_ += other.total_size_;
+        candidates_ += other.candidates_;
+        index_distance_ += other.index_distance_;
+        for (size_t k = 0; k != HistogramBins; ++k)
+            histogram_[k] += other.histogram_[k];
+    };
+    size_t MinSize() const { return particles_ == 0 ? 0 : min_size_; };
+    Real MeanSize() const { return Real(total_size_) / Real(SMAX(particles_, size_t(1))); };
+    /** the searched candidates per accepted neighbor, which grows with too large cells or search depths */
+    Real CandidateRatio() const { return Real(candidates_) / Real(SMAX(total_size_, size_t(1))); };
+    /** the mean index distance per neighbor, which grows as the particles get unsorted */
+    Real MeanIndexDistance() const { return Real(index_distance_) / Real(SMAX(total_size_, size_t(1))); };
+};
+
+/**
+ * @class DynamicsProfiler
+ * @brief Accumulates the wall-clock times of dynamics executions.
+ * Only the outermost timed dynamics on a thread is recorded, so that the times of
+ * the dynamics executed within another one, e.g. pre- and post-processes, are
+ * attributed to the outer dynamics and not counted twice.
+ * The report is written at exit if it has not been written before.
+ */
+class DynamicsProfiler
+{
+  public:
+    static DynamicsProfiler &get();
+    ~DynamicsProfiler();
+
+    void enable(bool is_enabled = true) { is_enabled_ = is_enabled; };
+    /** also keep every execution as an event for the Chrome trace */
+    void enableTrace(bool is_traced = true)
+    {
+        is_traced_ = is_traced;
+        is_enabled_ = is_enabled_ || is_traced;
+    };
+    bool isEnabled() { return is_enabled_; };
+    /** also count cycles, instructions and cache misses, see HardwareCounters */
+    void enableHardwareCounters();
+    HardwareCounters *getHardwareCounters() { return hardware_counters_.get(); };
+    /** the latest number of neighbor pairs of a body, for the memory traffic per pair */
+    void recordPairCount(const std::string &body_name, size_t pair_count);
+    /** the latest neighbor statistics of a relation, written in the report */
+    void recordNeighborStatistics(const std::string &relation_name, const NeighborStatisticsRecord &record);
+    /** count the time steps for the per-step averages in the report */
+    void incrementStep()
+    {
+        if (is_enabled_)
+            number_of_steps_++;
+    };
+    void recordTime(std::string_view dynamics_name, const std::string &body_name,
+                    const TickCount &start, const TickCount &end,
+                    const HardwareCounters::CounterValues &counters = HardwareCounters::CounterValues{},
+                    size_t allocations = 0);
+    void writeReport(std::ostream &output_stream);
+    /** write the time records as a JSON array sorted by the total time */
+    void writeJson(std::ostream &output_stream);
+    /** the time per step of each record, keyed by "dynamics at body", for comparing with a baseline */
+    StdVec<std::pair<std::string, Real>> TimesPerStep();
+    /** write the events in the Chrome trace (JSON) format, viewable by chrome://tracing or Perfetto */
+    void writeTrace(const std::string &file_path);
+    void reset();
+    /** nesting depth of the timed dynamics on the calling thread */
+    static size_t &TimerDepth();
+
+  private:
+    DynamicsProfiler() : start_(TickCount::now()) {};
+
+    struct TimeRecord
+    {
+        std::string dynamics_name_;
+        std::string body_name_;
+        size_t calls_;
+        Real total_time_;
+        Real max_time_;
+        HardwareCounters::CounterValues counters_;
+        size_t allocations_;
+    };
+
+    struct TraceEvent
+    {
+        size_t record_index_;
+        Real start_;
+        Real duration_;
+    };
+
+    bool is_enabled_ = false;
+    bool is_traced_ = false;
+    bool is_reported_ = false;
+    size_t number_of_steps_ = 0;
+    TickCount start_;
+    std::mutex mutex_;
+    UniquePtr<HardwareCounters> hardware_counters_;
+    std::unordered_map<std::string, size_t> pair_counts_;
+    StdVec<std::pair<std::string, NeighborStatisticsRecord>> neighbor_statistics_;
+    std::unordered_map<std::string, size_t> record_index_;
+    StdVec<TimeRecord> time_records_;
+    StdVec<TraceEvent> trace_events_;
+};
+
+/**
+ * @class ScopedDynamicsTimer
+ * @brief Time the scope of a dynamics execution if the profiler is enabled.
+ * When disabled, the cost is a single flag check.
+ */
+class ScopedDynamicsTimer
+{
+  public:
+    template <class BodyType>
+    ScopedDynamicsTimer(std::string_view dynamics_name, BodyType &body)
+        : dynamics_name_(dynamics_name)
+    {
+        if (DynamicsProfiler::get().isEnabled())
+        {
+            is_counted_ = true;
+            if (DynamicsProfiler::TimerDepth()++ == 0)
+            {
+                is_outermost_ = true;
+                body_name_ = body.getName();
+                hardware_counters_ = DynamicsProfiler::get().getHardwareCounters();
+                if (hardware_counters_ != nullptr)
+                    start_counters_ = hardware_counters_->read();
+                start_allocations_ = heapAllocationCount();
+                start_ = TickCount::now();
+            }
+        }
+    };
+
+    ~ScopedDynamicsTimer()
+    {
+        if (is_outermost_)
+        {
+            TickCount end = TickCount::now();
+            size_t allocations = heapAllocationCount() - start_allocations_;
+            HardwareCounters::CounterValues counters{};
+            if (hardware_counters_ != nullptr)
+            {
+                counters = hardware_counters_->read();
+                for (size_t k = 0; k != counters.size(); ++k)
+                    counters[k] -= start_counters_[k];
+            }
+            DynamicsProfiler::get().recordTime(dynamics_name_, body_name_, start_, end, counters, allocations);
+        }
+        if (is_counted_)
+        {
+            DynamicsProfiler::TimerDepth()--;
+        }
+    };
+
+  private:
+    bool is_counted_ = false;
+    bool is_outermost_ = false;
+    std::string_view dynamics_name_;
+    std::string body_name_;
+    TickCount start_;
+    HardwareCounters *hardware_counters_ = nullptr;
+    HardwareCounters::CounterValues start_counters_;
+    size_t start_allocations_ = 0;
+};
+} // namespace SPH
+#endif // DYNAMICS_PROFILER_H
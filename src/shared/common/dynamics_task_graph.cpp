@@ -0,0 +1,68 @@
+#include "dynamics_task_graph.h"
+
+namespace SPH
+{
+//=================================================================================================//
+void DynamicsTaskGraph::add(BaseDynamics<void> &dynamics, const StdVec<Entity *> &read_variables,
+                            const StdVec<Entity *> &written_variables)
+{
+    if (is_graph_built_)
+    {
+        std::cout << "\n Error: the dynamics task graph has been built, no dynamics can be added!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    tasks_.push_back(DynamicsTask{&dynamics, read_variables, written_variables});
+}
+//=================================================================================================//
+bool DynamicsTaskGraph::isDependent(const DynamicsTask &later, const DynamicsTask &earlier)
+{
+    auto is_shared = [](const StdVec<Entity *> &first, const StdVec<Entity *> &second)
+    {
+        return std::find_first_of(first.begin(), first.end(), second.begin(), second.end()) != first.end();
+    };
+    return is_shared(earlier.written_variables_, later.read_variables_) ||
+           is_shared(earlier.written_variables_, later.written_variables_) ||
+           is_shared(earlier.read_variables_, later.written_variables_);
+}
+//=================================================================================================//
+void DynamicsTaskGraph::buildGraph()
+{
+    StdVec<DynamicsNode *> nodes;
+    for (size_t k = 0; k != tasks_.size(); ++k)
+    {
+        BaseDynamics<void> *dynamics = tasks_[k].dynamics_;
+        nodes.push_back(node_ptrs_keeper_.createPtr<DynamicsNode>(
+            graph_, [this, dynamics](const tbb::flow::continue_msg &)
+            { dynamics->exec(dt_); }));
+
+        bool has_predecessor = false;
+        for (size_t l = 0; l != k; ++l)
+        {
+            if (isDependent(tasks_[k], tasks_[l]))
+            {
+                tbb::flow::make_edge(*nodes[l], *nodes[k]);
+                has_predecessor = true;
+                number_of_dependences_++;
+            }
+        }
+        if (!has_predecessor)
+        {
+            tbb::flow::make_edge(start_node_, *nodes[k]);
+        }
+    }
+    is_graph_built_ = true;
+}
+//=================================================================================================//
+void DynamicsTaskGraph::exec(Real dt)
+{
+    if (!is_graph_built_)
+    {
+        buildGraph();
+    }
+    dt_ = dt;
+    start_node_.try_put(tbb::flow::continue_msg());
+    graph_.wait_for_all();
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,78 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	dynamics_task_graph.h
+ * @brief 	A step of dynamics on several bodies scheduled as a task graph.
+ * @details The variables read and written by each dynamics are declared when it is added.
+ *          A dynamics depends on the earlier added ones which write a variable it reads or writes,
+ *          or read a variable it writes. The dynamics without such dependence, e.g. those
+ *          on different bodies, run concurrently, each with its own parallel loops,
+ *          so that the threads are kept busy even if a body has few particles.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DYNAMICS_TASK_GRAPH_H
+#define DYNAMICS_TASK_GRAPH_H
+
+#include "base_dynamics.h"
+#include "ownership.h"
+#include "sphinxsys_variable.h"
+
+#include <tbb/flow_graph.h>
+
+namespace SPH
+{
+class DynamicsTaskGraph : public BaseDynamics<void>
+{
+    using DynamicsNode = tbb::flow::continue_node<tbb::flow::continue_msg>;
+    tbb::flow::graph graph_; /**< declared before the nodes, which are destroyed first */
+    tbb::flow::broadcast_node<tbb::flow::continue_msg> start_node_{graph_};
+    UniquePtrsKeeper<DynamicsNode> node_ptrs_keeper_;
+
+  public:
+    DynamicsTaskGraph() : BaseDynamics<void>() {};
+    virtual ~DynamicsTaskGraph() {};
+
+    /** The dynamics are kept in the order of adding, which is the sequential order of execution. */
+    void add(BaseDynamics<void> &dynamics, const StdVec<Entity *> &read_variables,
+             const StdVec<Entity *> &written_variables);
+    UnsignedInt NumberOfDependences() { return number_of_dependences_; };
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    struct DynamicsTask
+    {
+        BaseDynamics<void> *dynamics_;
+        StdVec<Entity *> read_variables_;
+        StdVec<Entity *> written_variables_;
+    };
+    StdVec<DynamicsTask> tasks_;
+    bool is_graph_built_ = false;
+    UnsignedInt number_of_dependences_ = 0;
+    Real dt_ = 0.0;
+
+    bool isDependent(const DynamicsTask &later, const DynamicsTask &earlier);
+    void buildGraph();
+};
+} // namespace SPH
+#endif // DYNAMICS_TASK_GRAPH_H
@@ -161,6 +161,12 @@ class BaseTransform
         return translation_ + xformFrameVecToBase(origin);
     };
 
+    /** Forward rotation of a second-order tensor. */
+    MatType xformFrameTensorToBase(const MatType &origin)
+    {
+        return rotation_ * origin * inv_rotation_;
+    };
+
     /** Inverse rotation. */
     VecType xformBaseVecToFrame(const VecType &target)
     {
@@ -0,0 +1,82 @@
+#include "hardware_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace SPH
+{
+//=================================================================================================//
+HardwareCounters::HardwareCounters()
+{
+    file_descriptors_.fill(-1);
+#ifdef __linux__
+    const uint64_t configs[NumberOfCounters] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES};
+    is_available_ = true;
+    for (int k = 0; k != NumberOfCounters; ++k)
+    {
+        perf_event_attr attribute;
+        std::memset(&attribute, 0, sizeof(perf_event_attr));
+        attribute.type = PERF_TYPE_HARDWARE;
+        attribute.size = sizeof(perf_event_attr);
+        attribute.config = configs[k];
+        attribute.inherit = 1;
+        attribute.exclude_kernel = 1;
+        attribute.exclude_hv = 1;
+        // the calling thread and the threads created afterwards, on any cpu
+        file_descriptors_[k] = int(syscall(__NR_perf_event_open, &attribute, 0, -1, -1, 0));
+        is_available_ = is_available_ && file_descriptors_[k] != -1;
+    }
+
+    if (is_available_)
+    {
+        for (int file_descriptor : file_descriptors_)
+        {
+            ioctl(file_descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+//=================================================================================================//
+HardwareCounters::~HardwareCounters()
+{
+#ifdef __linux__
+    for (int file_descriptor : file_descriptors_)
+    {
+        if (file_descriptor != -1)
+            close(file_descriptor);
+    }
+#endif
+}
+//=================================================================================================//
+HardwareCounters::CounterValues HardwareCounters::read()
+{
+    CounterValues values;
+    values.fill(0);
+#ifdef __linux__
+    if (is_available_)
+    {
+        for (int k = 0; k != NumberOfCounters; ++k)
+        {
+            if (::read(file_descriptors_[k], &values[k], sizeof(uint64_t)) != sizeof(uint64_t))
+                values[k] = 0;
+        }
+    }
+#endif
+    return values;
+}
+//=================================================================================================//
+std::string HardwareCounters::CounterName(int counter_type)
+{
+    const std::string names[NumberOfCounters] = {"cycles", "instructions", "cache-references", "cache-misses"};
+    return names[counter_type];
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,65 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	hardware_counters.h
+ * @brief 	Hardware performance counters of the process read by perf_event on Linux.
+ * @details The counters are opened so that they are inherited by the threads created afterwards,
+ *          so they should be enabled before the first parallel loop starts the worker threads.
+ *          On other platforms, or if perf_event is not permitted, no counter is available.
+ * @author	Xiangyu Hu
+ */
+#ifndef HARDWARE_COUNTERS_H
+#define HARDWARE_COUNTERS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace SPH
+{
+class HardwareCounters
+{
+  public:
+    enum CounterType
+    {
+        Cycles = 0,
+        Instructions,
+        CacheReferences,
+        CacheMisses,
+        NumberOfCounters
+    };
+    using CounterValues = std::array<uint64_t, NumberOfCounters>;
+    static constexpr uint64_t CacheLineSize = 64;
+
+    HardwareCounters();
+    ~HardwareCounters();
+    bool isAvailable() { return is_available_; };
+    CounterValues read();
+    static std::string CounterName(int counter_type);
+
+  private:
+    bool is_available_ = false;
+    std::array<int, NumberOfCounters> file_descriptors_;
+};
+} // namespace SPH
+#endif // HARDWARE_COUNTERS_H
@@ -0,0 +1,233 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	loop_scheduling.h
+ * @brief 	Scheduling of the parallel particle loops and reductions on the host.
+ * @details With the affinity partitioning, each loop body, i.e. each call site of the
+ *          parallel iterators, keeps its own affinity partitioner to replay its ranges.
+ *          With the static chunked partitioning, all loops over the same particle range
+ *          give the same chunks to the same threads, so that the data of consecutive
+ *          dynamics are reused in the private caches.
+ *          With the neighbor cost partitioning, the loops over the particles of a relation
+ *          are split into chunks of equal number of neighbors plus particles, given by the
+ *          prefix sums of the neighbor counts, and the chunks are balanced by work stealing.
+ *          The other loops are scheduled as the static chunked partitioning.
+ *          The deterministic reductions split the range into fixed chunks and join
+ *          the partial results in a fixed order, so that the results are repeatable.
+ * @author	Xiangyu Hu
+ */
+#ifndef LOOP_SCHEDULING_H
+#define LOOP_SCHEDULING_H
+
+#include "large_data_containers.h"
+
+#include "tbb/partitioner.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+
+namespace SPH
+{
+namespace execution
+{
+enum class PartitionerType
+{
+    Affinity,     /**< affinity partitioner per loop body */
+    StaticChunked, /**< equal chunks per thread, the same for all loops of the same range */
+    NeighborCost   /**< chunks of equal neighbor counts for the interactions */
+};
+
+class LoopScheduling
+{
+  public:
+    LoopScheduling(LoopScheduling const &) = delete;
+    void operator=(LoopScheduling const &) = delete;
+
+    static LoopScheduling &getInstance()
+    {
+        static LoopScheduling instance;
+        return instance;
+    };
+
+    void setPartitioner(PartitionerType partitioner_type) { partitioner_type_ = partitioner_type; };
+    PartitionerType Partitioner() { return partitioner_type_; };
+    void setDeterministicReduction(bool deterministic_reduction) { deterministic_reduction_ = deterministic_reduction; };
+    bool DeterministicReduction() { return deterministic_reduction_; };
+    /** The chunk size of the deterministic reductions, on which the results depend. */
+    void setReductionGrainSize(size_t reduction_grain_size) { reduction_grain_size_ = reduction_grain_size; };
+    size_t ReductionGrainSize() { return reduction_grain_size_; };
+    /** The number of chunks per thread for the neighbor cost partitioning. */
+    void setCostChunksPerThread(size_t cost_chunks_per_thread) { cost_chunks_per_thread_ = cost_chunks_per_thread; };
+    size_t CostChunksPerThread() { return cost_chunks_per_thread_; };
+
+  private:
+    LoopScheduling() {};
+    PartitionerType partitioner_type_ = PartitionerType::Affinity;
+    bool deterministic_reduction_ = false;
+    size_t reduction_grain_size_ = 1024;
+    size_t cost_chunks_per_thread_ = 8;
+} static &loop_scheduling = LoopScheduling::getInstance();
+
+/**
+ * @struct ExecutionHint
+ * @brief The execution hint of a dynamics for its parallel loops on the host.
+ * Loops shorter than the serial cutoff run on the calling thread,
+ * the others are split to chunks not smaller than the grain size
+ * and run in the given task arena, e.g. the one owned by the SPHSystem.
+ * The default hint keeps the default TBB scheduling.
+ */
+struct ExecutionHint
+{
+    size_t grain_size_ = 1;
+    size_t serial_cutoff_ = 0;
+    tbb::task_arena *task_arena_ = nullptr;
+};
+
+/** The hint of the dynamics running on this thread, set by ScopedExecutionHint. */
+inline const ExecutionHint *&currentExecutionHint()
+{
+    static thread_local const ExecutionHint *execution_hint = nullptr;
+    return execution_hint;
+};
+
+class ScopedExecutionHint
+{
+  public:
+    explicit ScopedExecutionHint(const ExecutionHint &execution_hint)
+        : previous_hint_(currentExecutionHint())
+    {
+        currentExecutionHint() = &execution_hint;
+    };
+    ~ScopedExecutionHint() { currentExecutionHint() = previous_hint_; };
+
+  private:
+    const ExecutionHint *previous_hint_;
+};
+
+template <class Function>
+inline auto executeWithHint(const ExecutionHint &execution_hint, const Function &function)
+{
+    return execution_hint.task_arena_ == nullptr ? function() : execution_hint.task_arena_->execute(function);
+};
+
+/** The affinity partitioner is given by the caller so that it is kept per loop body. */
+template <class LoopBody>
+inline void scheduled_parallel_for(const IndexRange &range, const LoopBody &loop_body,
+                                   tbb::affinity_partitioner &affinity_partitioner)
+{
+    const ExecutionHint *execution_hint = currentExecutionHint();
+    if (execution_hint != nullptr && range.size() < execution_hint->serial_cutoff_)
+    {
+        loop_body(range);
+        return;
+    }
+
+    ExecutionHint hint = execution_hint != nullptr ? *execution_hint : ExecutionHint();
+    IndexRange hinted_range(range.begin(), range.end(), hint.grain_size_);
+    executeWithHint(
+        hint, [&]()
+        {
+            if (loop_scheduling.Partitioner() != PartitionerType::Affinity)
+            {
+                tbb::parallel_for(hinted_range, loop_body, tbb::static_partitioner());
+            }
+            else
+            {
+                tbb::parallel_for(hinted_range, loop_body, affinity_partitioner);
+            } });
+};
+
+/** The deterministic reductions are not changed by the execution hint, as their results depend on the chunks. */
+template <class ReturnType, class LoopBody, class JoinFunction>
+inline ReturnType scheduled_parallel_reduce(const IndexRange &range, const ReturnType &identity,
+                                            const LoopBody &loop_body, const JoinFunction &join_function)
+{
+    if (loop_scheduling.DeterministicReduction())
+    {
+        return tbb::parallel_deterministic_reduce(
+            IndexRange(range.begin(), range.end(), loop_scheduling.ReductionGrainSize()),
+            identity, loop_body, join_function, tbb::simple_partitioner());
+    }
+
+    const ExecutionHint *execution_hint = currentExecutionHint();
+    if (execution_hint != nullptr && range.size() < execution_hint->serial_cutoff_)
+    {
+        return loop_body(range, identity);
+    }
+
+    ExecutionHint hint = execution_hint != nullptr ? *execution_hint : ExecutionHint();
+    IndexRange hinted_range(range.begin(), range.end(), hint.grain_size_);
+    return executeWithHint(
+        hint, [&]() -> ReturnType
+        {
+            if (loop_scheduling.Partitioner() != PartitionerType::Affinity)
+            {
+                return tbb::parallel_reduce(hinted_range, identity, loop_body, join_function, tbb::static_partitioner());
+            }
+            return tbb::parallel_reduce(hinted_range, identity, loop_body, join_function); });
+};
+
+/**
+ * Loop over [0, loop_bound) in chunks of equal cost, in which the cost of index i is
+ * one plus offset[i + 1] - offset[i], e.g. the neighbor count from the prefix sums.
+ * The boundaries of a chunk are found by binary search on the monotonic cost bounds.
+ */
+template <typename OffsetType, class LoopBody>
+inline void cost_balanced_parallel_for(size_t loop_bound, const OffsetType *offset, const LoopBody &loop_body)
+{
+    auto cost_bound = [&](size_t i) -> size_t
+    { return size_t(offset[i] - offset[0]) + i; };
+    size_t number_of_chunks = std::min(loop_bound, loop_scheduling.CostChunksPerThread() *
+                                                       size_t(tbb::this_task_arena::max_concurrency()));
+    if (number_of_chunks == 0)
+    {
+        return;
+    }
+
+    size_t total_cost = cost_bound(loop_bound);
+    auto chunk_boundary = [&](size_t chunk) -> size_t
+    {
+        size_t target_cost = total_cost / number_of_chunks * chunk +
+                             total_cost % number_of_chunks * chunk / number_of_chunks;
+        size_t lower = 0, upper = loop_bound;
+        while (lower < upper)
+        {
+            size_t middle = lower + (upper - lower) / 2;
+            cost_bound(middle) < target_cost ? lower = middle + 1 : upper = middle;
+        }
+        return lower;
+    };
+
+    tbb::parallel_for(
+        IndexRange(0, number_of_chunks, 1),
+        [&](const IndexRange &r)
+        {
+            for (size_t chunk = r.begin(); chunk != r.end(); ++chunk)
+            {
+                loop_body(IndexRange(chunk_boundary(chunk), chunk_boundary(chunk + 1)));
+            }
+        });
+};
+} // namespace execution
+} // namespace SPH
+#endif // LOOP_SCHEDULING_H
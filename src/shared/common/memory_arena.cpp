@@ -0,0 +1,61 @@
+#include "memory_arena.h"
+
+#include <cstdlib>
+#include <iostream>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace SPH
+{
+//=================================================================================================//
+MemoryArena::MemoryArena(size_t block_size)
+    : block_size_((block_size + HugePageSize - 1) / HugePageSize * HugePageSize) {}
+//=================================================================================================//
+MemoryArena::~MemoryArena()
+{
+    for (auto &block : blocks_)
+    {
+        std::free(block.data_);
+    }
+}
+//=================================================================================================//
+void *MemoryArena::allocateBytes(size_t bytes)
+{
+    size_t aligned_bytes = (bytes + CacheLineSize - 1) / CacheLineSize * CacheLineSize;
+    if (blocks_.empty() || blocks_.back().size_ - blocks_.back().used_ < aligned_bytes)
+    {
+        addBlock(aligned_bytes);
+    }
+    Block &block = blocks_.back();
+    void *allocated = block.data_ + block.used_;
+    block.used_ += aligned_bytes;
+    allocated_bytes_ += aligned_bytes;
+    return allocated;
+}
+//=================================================================================================//
+void MemoryArena::addBlock(size_t minimum_size)
+{
+    size_t size = block_size_;
+    if (size < minimum_size)
+    {
+        size = (minimum_size + HugePageSize - 1) / HugePageSize * HugePageSize;
+    }
+
+    char *data = static_cast<char *>(std::aligned_alloc(HugePageSize, size));
+    if (data == nullptr)
+    {
+        std::cout << "\n Error: the memory arena failed to allocate a block of " << size << " bytes!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+#ifdef __linux__
+    madvise(data, size, MADV_HUGEPAGE);
+#endif
+
+    blocks_.push_back(Block{data, size, 0});
+    reserved_bytes_ += size;
+}
+//=================================================================================================//
+} // namespace SPH
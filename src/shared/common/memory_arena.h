@@ -0,0 +1,96 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	memory_arena.h
+ * @brief 	Bump allocation of data arrays from large blocks.
+ * @details The blocks are aligned to huge pages, which are advised to the kernel on Linux.
+ *          The arrays are aligned to cache lines and are only released with the arena.
+ *          An array copied into the arena is first touched by a statically partitioned
+ *          parallel loop, so that its pages are placed on the NUMA nodes of the threads
+ *          which work on the same particle ranges later.
+ * @author	Xiangyu Hu
+ */
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace SPH
+{
+class MemoryArena
+{
+  public:
+    static constexpr size_t CacheLineSize = 64;
+    static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+    explicit MemoryArena(size_t block_size = 32 * HugePageSize);
+    ~MemoryArena();
+    MemoryArena(const MemoryArena &) = delete;
+    MemoryArena &operator=(const MemoryArena &) = delete;
+
+    template <typename DataType>
+    DataType *allocate(size_t data_size)
+    {
+        return static_cast<DataType *>(allocateBytes(data_size * sizeof(DataType)));
+    };
+    /** Allocate and first touch the array in parallel by copying from the origin. */
+    template <typename DataType>
+    DataType *allocateCopy(const DataType *origin, size_t data_size)
+    {
+        DataType *allocated = allocate<DataType>(data_size);
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, data_size),
+            [&](const tbb::blocked_range<size_t> &r)
+            {
+                std::uninitialized_copy(origin + r.begin(), origin + r.end(), allocated + r.begin());
+            },
+            tbb::static_partitioner());
+        return allocated;
+    };
+    /** Bytes of all blocks, including those not yet handed out. */
+    size_t ReservedBytes() const { return reserved_bytes_; };
+    /** Bytes handed out, including the padding for alignment. */
+    size_t AllocatedBytes() const { return allocated_bytes_; };
+
+  protected:
+    struct Block
+    {
+        char *data_;
+        size_t size_;
+        size_t used_;
+    };
+    size_t block_size_;
+    std::vector<Block> blocks_;
+    size_t reserved_bytes_ = 0;
+    size_t allocated_bytes_ = 0;
+
+    void *allocateBytes(size_t bytes);
+    void addBlock(size_t minimum_size);
+};
+} // namespace SPH
+#endif // MEMORY_ARENA_H
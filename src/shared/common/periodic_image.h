@@ -0,0 +1,131 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	periodic_image.h
+ * @brief 	Periodic images of positions and displacements in a periodic box,
+ *          with which the neighbor search and the particle pair displacements
+ *          of the computing kernels are periodic without ghost particles.
+ * @details The period has to be larger than twice the search distance,
+ *          so that a particle does not find the same neighbor twice.
+ * @author	Xiangyu Hu
+ */
+#ifndef PERIODIC_IMAGE_H
+#define PERIODIC_IMAGE_H
+
+#include "base_data_type_package.h"
+
+namespace SPH
+{
+class PeriodicImage
+{
+  public:
+    PeriodicImage() : is_periodic_(Arrayi::Zero()), lower_(Vecd::Zero()), period_(Vecd::Ones()) {};
+
+    void setPeriodicAxis(const BoundingBoxd &periodic_bounds, int axis)
+    {
+        is_periodic_[axis] = 1;
+        lower_[axis] = periodic_bounds.lower_[axis];
+        period_[axis] = periodic_bounds.upper_[axis] - periodic_bounds.lower_[axis];
+    };
+    bool isPeriodic() const { return is_periodic_.any(); };
+    bool isPeriodic(int axis) const { return is_periodic_[axis] != 0; };
+    Real Period(int axis) const { return period_[axis]; };
+
+    /** The displacement to the nearest periodic image. */
+    inline Vecd minimumImage(const Vecd &displacement) const
+    {
+        Vecd image = displacement;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if (is_periodic_[k] != 0)
+            {
+                image[k] -= period_[k] * math::floor(image[k] / period_[k] + Real(0.5));
+            }
+        }
+        return image;
+    };
+
+    /** The periodic image of the position inside the periodic box. */
+    inline Vecd insideImage(const Vecd &position) const
+    {
+        Vecd image = position;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if (is_periodic_[k] != 0)
+            {
+                image[k] -= period_[k] * math::floor((image[k] - lower_[k]) / period_[k]);
+            }
+        }
+        return image;
+    };
+
+    /** Apply the function on the position and on its images within the distance across the periodic bounds. */
+    template <typename FunctionOnImage>
+    inline void forEachImage(const Vecd &position, Real distance, const FunctionOnImage &function) const
+    {
+        function(position);
+        if (!isPeriodic())
+        {
+            return;
+        }
+
+        Arrayi lower_shift = Arrayi::Zero();
+        Arrayi upper_shift = Arrayi::Zero();
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if (is_periodic_[k] != 0)
+            {
+                upper_shift[k] = position[k] - lower_[k] < distance ? 1 : 0;
+                lower_shift[k] = lower_[k] + period_[k] - position[k] < distance ? -1 : 0;
+            }
+        }
+
+        int number_of_shifts = 1;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            number_of_shifts *= 3;
+        }
+        for (int code = 0; code != number_of_shifts; ++code)
+        {
+            Arrayi shift;
+            int remainder = code;
+            for (int k = 0; k != Dimensions; ++k)
+            {
+                shift[k] = remainder % 3 - 1;
+                remainder /= 3;
+            }
+            if ((shift == 0).all() || (shift < lower_shift).any() || (shift > upper_shift).any())
+            {
+                continue;
+            }
+            function(position + (shift.cast<Real>() * period_.array()).matrix());
+        }
+    };
+
+  protected:
+    Arrayi is_periodic_;
+    Vecd lower_;
+    Vecd period_;
+};
+} // namespace SPH
+#endif // PERIODIC_IMAGE_H
@@ -0,0 +1,125 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	small_matrix_math.h
+ * @brief 	Closed-form inverses and regularized solvers for the small matrices
+ * 			of the particle kernels, without the general Eigen inverse, so that
+ * 			the register usage in device kernels is kept low.
+ * @details The closed forms are used for 2x2 and 3x3 matrices,
+ * 			larger matrices fall back to the Eigen inverse.
+ * @author	Xiangyu Hu
+ */
+#ifndef SMALL_MATRIX_MATH_H
+#define SMALL_MATRIX_MATH_H
+
+#include "data_type.h"
+
+namespace SPH
+{
+namespace small_matrix
+{
+/** inverse of a general matrix by the adjugate. */
+template <typename MatrixType>
+inline MatrixType inverse(const MatrixType &A)
+{
+    constexpr int size = MatrixType::RowsAtCompileTime;
+    if constexpr (size == 2)
+    {
+        Real inv_det = 1.0 / (A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0));
+        MatrixType result;
+        result(0, 0) = A(1, 1) * inv_det;
+        result(0, 1) = -A(0, 1) * inv_det;
+        result(1, 0) = -A(1, 0) * inv_det;
+        result(1, 1) = A(0, 0) * inv_det;
+        return result;
+    }
+    else if constexpr (size == 3)
+    {
+        MatrixType result;
+        result(0, 0) = A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1);
+        result(0, 1) = A(0, 2) * A(2, 1) - A(0, 1) * A(2, 2);
+        result(0, 2) = A(0, 1) * A(1, 2) - A(0, 2) * A(1, 1);
+        result(1, 0) = A(1, 2) * A(2, 0) - A(1, 0) * A(2, 2);
+        result(1, 1) = A(0, 0) * A(2, 2) - A(0, 2) * A(2, 0);
+        result(1, 2) = A(0, 2) * A(1, 0) - A(0, 0) * A(1, 2);
+        result(2, 0) = A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0);
+        result(2, 1) = A(0, 1) * A(2, 0) - A(0, 0) * A(2, 1);
+        result(2, 2) = A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+        Real inv_det = 1.0 / (A(0, 0) * result(0, 0) + A(0, 1) * result(1, 0) + A(0, 2) * result(2, 0));
+        return result * inv_det;
+    }
+    else
+    {
+        return A.inverse();
+    }
+}
+
+/** inverse of a symmetric matrix, only the upper triangle is used. */
+template <typename MatrixType>
+inline MatrixType symmetricInverse(const MatrixType &S)
+{
+    constexpr int size = MatrixType::RowsAtCompileTime;
+    if constexpr (size == 2)
+    {
+        Real inv_det = 1.0 / (S(0, 0) * S(1, 1) - S(0, 1) * S(0, 1));
+        MatrixType result;
+        result(0, 0) = S(1, 1) * inv_det;
+        result(0, 1) = -S(0, 1) * inv_det;
+        result(1, 0) = result(0, 1);
+        result(1, 1) = S(0, 0) * inv_det;
+        return result;
+    }
+    else if constexpr (size == 3)
+    {
+        Real c00 = S(1, 1) * S(2, 2) - S(1, 2) * S(1, 2);
+        Real c01 = S(0, 2) * S(1, 2) - S(0, 1) * S(2, 2);
+        Real c02 = S(0, 1) * S(1, 2) - S(0, 2) * S(1, 1);
+        Real inv_det = 1.0 / (S(0, 0) * c00 + S(0, 1) * c01 + S(0, 2) * c02);
+        MatrixType result;
+        result(0, 0) = c00 * inv_det;
+        result(0, 1) = c01 * inv_det;
+        result(0, 2) = c02 * inv_det;
+        result(1, 1) = (S(0, 0) * S(2, 2) - S(0, 2) * S(0, 2)) * inv_det;
+        result(1, 2) = (S(0, 1) * S(0, 2) - S(0, 0) * S(1, 2)) * inv_det;
+        result(2, 2) = (S(0, 0) * S(1, 1) - S(0, 1) * S(0, 1)) * inv_det;
+        result(1, 0) = result(0, 1);
+        result(2, 0) = result(0, 2);
+        result(2, 1) = result(1, 2);
+        return result;
+    }
+    else
+    {
+        return S.inverse();
+    }
+}
+
+/** Tikhonov regularized inverse (A^T A + epsilon I)^{-1} A^T. */
+template <typename MatrixType>
+inline MatrixType regularizedInverse(const MatrixType &A, Real epsilon)
+{
+    MatrixType A_T = A.transpose();
+    return symmetricInverse<MatrixType>(A_T * A + epsilon * MatrixType::Identity()) * A_T;
+}
+} // namespace small_matrix
+} // namespace SPH
+#endif // SMALL_MATRIX_MATH_H
@@ -50,6 +50,17 @@ class ConstantArray : public Entity
             data_[i] = DataType(*generators[i]);
         }
     };
+    /** The constants hold data delegated for the execution policy, e.g. local parameters of particles. */
+    template <class ExecutionPolicy, typename GeneratorType>
+    ConstantArray(const ExecutionPolicy &ex_policy, StdVec<GeneratorType *> generators)
+        : Entity("ConstantArray"), data_size_(generators.size()),
+          data_(new DataType[data_size_]), delegated_(data_)
+    {
+        for (size_t i = 0; i != data_size_; ++i)
+        {
+            data_[i] = DataType(ex_policy, *generators[i]);
+        }
+    };
     ~ConstantArray() { delete[] data_; };
     size_t getDataSize() { return data_size_; }
     DataType *Data() { return data_; };
@@ -80,5 +91,33 @@ class DeviceOnlyConstantArray : public Entity
   protected:
     DataType *device_only_data_;
 };
+
+/**
+ * @class PolicyConstantArray
+ * @brief The constants are generated with the execution policy when first delegated,
+ * so that they may hold pointers to particle data delegated to the same policy.
+ */
+template <typename DataType, typename GeneratorType>
+class PolicyConstantArray
+{
+    UniquePtrKeeper<ConstantArray<DataType>> constant_array_keeper_;
+
+  public:
+    PolicyConstantArray(StdVec<GeneratorType *> generators) : generators_(generators) {};
+    template <class ExecutionPolicy>
+    DataType *DelegatedData(const ExecutionPolicy &ex_policy)
+    {
+        if (constant_array_ == nullptr)
+        {
+            constant_array_ = constant_array_keeper_.template createPtr<ConstantArray<DataType>>(
+                ex_policy, generators_);
+        }
+        return constant_array_->DelegatedData(ex_policy);
+    };
+
+  protected:
+    StdVec<GeneratorType *> generators_;
+    ConstantArray<DataType> *constant_array_ = nullptr;
+};
 } // namespace SPH
 #endif // SPHINXSYS_CONSTANT_H
@@ -45,6 +45,7 @@ class Continuous
 };
 class Lattice;          // Indicating with lattice points
 class UnstructuredMesh; // Indicating with unstructured mesh
+class Tabulated;        // Indicating evaluated from a precomputed table
 class BaseMaterial;
 class SPHBody;
 class RealBody;
@@ -32,8 +32,11 @@
 
 #include "base_data_type_package.h"
 #include "execution_policy.h"
+#include "memory_arena.h"
 #include "ownership.h"
 
+#include <functional>
+
 namespace SPH
 {
 using namespace execution;
@@ -44,6 +47,23 @@ class SingularVariable;
 template <typename DataType>
 class DiscreteVariable;
 
+/** Size of the host staging buffers by which device data are streamed, e.g. for binary restart files. */
+constexpr size_t BinaryStreamChunkBytes = size_t(1) << 22;
+
+/** Bytes allocated on the host and on the device. */
+struct MemoryUsage
+{
+    size_t host_bytes_ = 0;
+    size_t device_bytes_ = 0;
+
+    MemoryUsage &operator+=(const MemoryUsage &other)
+    {
+        host_bytes_ += other.host_bytes_;
+        device_bytes_ += other.device_bytes_;
+        return *this;
+    };
+};
+
 class Entity
 {
   public:
@@ -83,9 +103,21 @@ class SingularVariable : public Entity
     ~SingularVariable() { delete data_; };
 
     DataType *Data() { return delegated_; };
-    void setValue(const DataType &value) { *delegated_ = value; };
-    DataType getValue() const { return *delegated_; };
-    void incrementValue(const DataType &value) { *delegated_ += value; };
+    void setValue(const DataType &value)
+    {
+        waitForDelegatedData();
+        *delegated_ = value;
+    };
+    DataType getValue() const
+    {
+        waitForDelegatedData();
+        return *delegated_;
+    };
+    void incrementValue(const DataType &value)
+    {
+        waitForDelegatedData();
+        *delegated_ += value;
+    };
 
     template <class ExecutionPolicy>
     DataType *DelegatedData(const ExecutionPolicy &ex_policy) { return delegated_; };
@@ -111,6 +143,23 @@ class SingularVariable : public Entity
   protected:
     DataType *data_;
     DataType *delegated_;
+
+    /** Device shared data may still be in use by asynchronously submitted kernels. */
+    void waitForDelegatedData() const
+    {
+        if (data_ != delegated_)
+        {
+            execution::waitForDeviceSubmissions();
+        }
+    };
+};
+
+/** The allocation of the device data of a discrete variable. */
+enum class DeviceAllocation
+{
+    DeviceOnly,       /**< device memory, copied explicitly from and to the host data */
+    PinnedHostMirror, /**< device memory, with the host data pinned for direct memory access copies */
+    Shared            /**< unified shared memory, migrated between host and device by the runtime */
 };
 
 template <typename DataType>
@@ -120,9 +169,50 @@ class DeviceOnlyDiscreteVariable : public Entity
     DeviceOnlyDiscreteVariable(DiscreteVariable<DataType> *host_variable);
     ~DeviceOnlyDiscreteVariable();
     void reallocateData(DiscreteVariable<DataType> *host_variable);
+    /** called before the host data are reallocated */
+    void releaseHostData();
 
   protected:
+    DeviceAllocation device_allocation_;
     DataType *device_only_data_field_;
+    DataType *pinned_host_data_field_;
+
+    void allocateDeviceData(DiscreteVariable<DataType> *host_variable);
+};
+
+/**
+ * @class ScratchBuffer
+ * @brief Device memory shared by the scratch variables of a lifetime group.
+ * The variables in a group are declared by the user not to be in use at the same time,
+ * so that they are aliased onto one buffer with the size of the largest variable.
+ */
+class ScratchBuffer : public Entity
+{
+  public:
+    explicit ScratchBuffer(const std::string &lifetime_group) : Entity(lifetime_group) {};
+    ~ScratchBuffer()
+    {
+#if SPHINXSYS_USE_SYCL
+        releaseDeviceData();
+#endif
+    };
+    /** The buffer is reallocated if a member needs more bytes, after which all members are rebound. */
+    void *DeviceData(const std::string &member_name, size_t bytes,
+                     const std::function<void(void *)> &rebind_member);
+    size_t DeviceBytes() { return device_bytes_; };
+
+  protected:
+    void *device_data_ = nullptr;
+    size_t device_bytes_ = 0;
+    std::map<std::string, std::function<void(void *)>> rebind_members_;
+
+    void releaseDeviceData();
+};
+
+/** Tag for constructing a scratch variable, with a nullptr buffer if not aliased. */
+struct ScratchVariable
+{
+    ScratchBuffer *scratch_buffer_ = nullptr;
 };
 
 template <typename DataType>
@@ -155,19 +245,98 @@ class DiscreteVariable : public Entity
                            [&](UnsignedInt index)
                            { return origin_variable->getValue(index); }) {};
 
-    ~DiscreteVariable() { delete[] data_field_; };
-    DataType *Data() { return data_field_; };
-    void setValue(size_t index, const DataType &value) { data_field_[index] = value; };
-    DataType getValue(size_t index) { return data_field_[index]; };
+    /** The data of a scratch variable are used within a time step only, and are not copied
+     *  between the host and device. The host data are only allocated when used on the host. */
+    DiscreteVariable(const std::string &name, size_t data_size, const ScratchVariable &scratch)
+        : Entity(name), data_size_(data_size), data_field_(nullptr),
+          device_only_variable_(nullptr), device_data_field_(nullptr),
+          is_scratch_(true), scratch_buffer_(scratch.scratch_buffer_) {};
+
+    ~DiscreteVariable()
+    {
+#if SPHINXSYS_USE_SYCL
+        if (device_only_variable_ != nullptr)
+        {
+            device_only_variable_->releaseHostData();
+        }
+#endif
+        if (memory_arena_ == nullptr)
+        {
+            delete[] data_field_;
+        }
+    };
+    DataType *Data()
+    {
+        if (data_field_ == nullptr)
+        {
+            allocateScratchHostData();
+        }
+        return data_field_;
+    };
+    void setValue(size_t index, const DataType &value) { Data()[index] = value; };
+    DataType getValue(size_t index) { return Data()[index]; };
 
     template <class ExecutionPolicy>
-    DataType *DelegatedData(const ExecutionPolicy &ex_policy) { return data_field_; };
+    DataType *DelegatedData(const ExecutionPolicy &ex_policy) { return Data(); };
+    template <class PolicyType>
+    DataType *DelegatedData(const DeviceExecution<PolicyType> &ex_policy)
+    {
+        is_device_data_writable_ = true;
+        return DelegatedOnDevice();
+    };
+    /** Read-only access, with which the device data will not be copied back to the host for output. */
+    template <class ExecutionPolicy>
+    const DataType *ConstDelegatedData(const ExecutionPolicy &ex_policy) { return Data(); };
     template <class PolicyType>
-    DataType *DelegatedData(const DeviceExecution<PolicyType> &ex_policy) { return DelegatedOnDevice(); };
+    const DataType *ConstDelegatedData(const DeviceExecution<PolicyType> &ex_policy) { return DelegatedOnDevice(); };
+    /** Whether writable device data have been handed out, i.e. the host data may be outdated. */
+    bool isDeviceDataWritable() { return is_device_data_writable_; };
+    /** Choose the allocation of the device data, which is only possible before the data are delegated. */
+    void setDeviceAllocation(DeviceAllocation device_allocation)
+    {
+        if (isDataDelegated())
+        {
+            std::cout << "\n Error: the device data of variable " << name_ << " are already allocated!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        device_allocation_ = device_allocation;
+    };
+    DeviceAllocation getDeviceAllocation() { return device_allocation_; };
     DataType *DelegatedOnDevice();
     bool isDataDelegated() { return device_data_field_ != nullptr; };
     size_t getDataSize() { return data_size_; }
+    bool isScratch() { return is_scratch_; };
+    ScratchBuffer *getScratchBuffer() { return scratch_buffer_; };
+    /** The device data, if delegated, have the same size as the host data.
+     *  The device data aliased onto a scratch buffer are counted by the buffer. */
+    MemoryUsage getMemoryUsage()
+    {
+        size_t bytes = data_size_ * sizeof(DataType);
+        size_t host_bytes = data_field_ != nullptr ? bytes : 0;
+        size_t device_bytes = isDataDelegated() && scratch_buffer_ == nullptr ? bytes : 0;
+        return MemoryUsage{host_bytes, device_bytes};
+    };
     void setDeviceData(DataType *data_field) { device_data_field_ = data_field; };
+    /** Move the host data into the arena, which is only possible before the data are used elsewhere. */
+    void relocateData(MemoryArena &memory_arena)
+    {
+        if (memory_arena_ != nullptr || is_scratch_)
+        {
+            return;
+        }
+        if (isDataDelegated())
+        {
+            std::cout << "\n Error: the device data of variable " << name_ << " are already allocated!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        DataType *relocated = memory_arena.allocateCopy<DataType>(data_field_, data_size_);
+        delete[] data_field_;
+        data_field_ = relocated;
+        memory_arena_ = &memory_arena;
+    };
+    bool isArenaAllocated() { return memory_arena_ != nullptr; };
 
     template <class ExecutionPolicy>
     void reallocateData(const ExecutionPolicy &ex_policy, size_t tentative_size)
@@ -194,16 +363,60 @@ class DiscreteVariable : public Entity
     void finalizeLoadIn(const ExecutionPolicy &ex_policy) {};
     void finalizeLoadIn(const ParallelDevicePolicy &ex_policy) { synchronizeToDevice(); };
 
+    /**
+     * Hand the first data_size entries to the chunk function as host arrays, e.g. to write a file.
+     * For device execution, the device data are copied in chunks to small pinned staging buffers,
+     * overlapped with the chunk function, so that the host data are not synchronized as a whole.
+     */
+    template <class ExecutionPolicy, class ChunkFunction>
+    void streamOutData(const ExecutionPolicy &ex_policy, size_t data_size, const ChunkFunction &chunk_function)
+    {
+        chunk_function(Data(), data_size);
+    };
+    template <class ChunkFunction>
+    void streamOutData(const ParallelDevicePolicy &ex_policy, size_t data_size, const ChunkFunction &chunk_function);
+    /** The chunk function fills the host arrays, e.g. from a file, which are copied to the device data if delegated.
+     *  Then, the host data are outdated and not to be copied to the device by finalizeLoadIn. */
+    template <class ExecutionPolicy, class ChunkFunction>
+    void streamInData(const ExecutionPolicy &ex_policy, size_t data_size, const ChunkFunction &chunk_function)
+    {
+        chunk_function(Data(), data_size);
+    };
+    template <class ChunkFunction>
+    void streamInData(const ParallelDevicePolicy &ex_policy, size_t data_size, const ChunkFunction &chunk_function);
+
   private:
     size_t data_size_;
     DataType *data_field_;
     DeviceOnlyDiscreteVariable<DataType> *device_only_variable_;
     DataType *device_data_field_;
+    bool is_device_data_writable_ = false;
+    DeviceAllocation device_allocation_ = DeviceAllocation::DeviceOnly;
+    MemoryArena *memory_arena_ = nullptr;
+    bool is_scratch_ = false;
+    ScratchBuffer *scratch_buffer_ = nullptr;
+
+    void allocateScratchHostData()
+    {
+        data_field_ = new DataType[data_size_];
+        std::fill_n(data_field_, data_size_, ZeroData<DataType>::value);
+    };
 
+    /** The previous data in an arena are abandoned and only released with the arena. */
     void reallocateData(size_t tentative_size)
     {
-        delete[] data_field_;
         data_size_ = tentative_size + tentative_size / 4;
+        if (data_field_ == nullptr)
+        {
+            return; // the host data of a scratch variable not used on the host yet
+        }
+        if (memory_arena_ != nullptr)
+        {
+            data_field_ = memory_arena_->allocate<DataType>(data_size_);
+            std::uninitialized_default_construct_n(data_field_, data_size_);
+            return;
+        }
+        delete[] data_field_;
         data_field_ = new DataType[data_size_];
     };
 
@@ -292,5 +505,19 @@ struct FinalizeVariablesAfterRead
         }
     };
 };
+
+template <template <typename> class ContainerType>
+struct AccumulateMemoryUsage
+{
+    template <typename DataType>
+    void operator()(DataContainerAddressKeeper<ContainerType<DataType>> &variables,
+                    MemoryUsage &memory_usage)
+    {
+        for (size_t i = 0; i != variables.size(); ++i)
+        {
+            memory_usage += variables[i]->getMemoryUsage();
+        }
+    };
+};
 } // namespace SPH
 #endif // SPHINXSYS_VARIABLE_H
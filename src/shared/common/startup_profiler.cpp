@@ -0,0 +1,140 @@
+#include "startup_profiler.h"
+
+#include <algorithm>
+#include <iomanip>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <fstream>
+#endif
+
+namespace SPH
+{
+//=================================================================================================//
+StartupProfiler &StartupProfiler::get()
+{
+    static StartupProfiler profiler;
+    return profiler;
+}
+//=================================================================================================//
+StartupProfiler::~StartupProfiler()
+{
+    if (is_enabled_ && !is_reported_ && !phase_records_.empty())
+    {
+        writeReport(std::cout);
+    }
+}
+//=================================================================================================//
+size_t &StartupProfiler::PhaseDepth()
+{
+    static thread_local size_t phase_depth = 0;
+    return phase_depth;
+}
+//=================================================================================================//
+size_t StartupProfiler::residentBytes()
+{
+#ifdef __linux__
+    size_t total_pages = 0, resident_pages = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> total_pages >> resident_pages;
+    return statm ? resident_pages * size_t(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+//=================================================================================================//
+size_t StartupProfiler::peakResidentBytes()
+{
+#ifdef __linux__
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? size_t(usage.ru_maxrss) * 1024 : 0; // in kilobytes
+#else
+    return 0;
+#endif
+}
+//=================================================================================================//
+void StartupProfiler::recordPhase(const std::string &phase_name, const std::string &owner_name, size_t depth,
+                                  const TickCount &start, const TickCount &end,
+                                  size_t resident_bytes_increase, size_t peak_resident_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    phase_records_.push_back({phase_name, owner_name, depth, (start - start_).seconds(), (end - start).seconds(),
+                              resident_bytes_increase, peak_resident_bytes});
+}
+//=================================================================================================//
+void StartupProfiler::finishStartup()
+{
+    if (isEnabled())
+    {
+        time_to_first_step_ = (TickCount::now() - start_).seconds();
+        is_finished_ = true;
+        writeReport(std::cout);
+    }
+}
+//=================================================================================================//
+void StartupProfiler::writeReport(std::ostream &output_stream)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // the phases are recorded at their end, but listed in the order of their start,
+    // i.e. the outer phases before their inner ones
+    StdVec<PhaseRecord> ordered_records = phase_records_;
+    std::stable_sort(ordered_records.begin(), ordered_records.end(),
+                     [](const PhaseRecord &a, const PhaseRecord &b)
+                     { return a.start_ < b.start_; });
+    Real total_time = is_finished_ ? time_to_first_step_ : (TickCount::now() - start_).seconds();
+    Real profiled_time = 0.0;
+    for (const PhaseRecord &record : phase_records_)
+    {
+        if (record.depth_ == 0)
+            profiled_time += record.duration_;
+    }
+
+    Real mega_bytes = 1024.0 * 1024.0;
+    output_stream << "\n Startup profile, " << total_time << " seconds before the first time step, "
+                  << profiled_time << " seconds in the phases:\n";
+    output_stream << std::setw(12) << "time[s]" << std::setw(9) << "share[%]"
+                  << std::setw(14) << "memory+[MB]" << std::setw(12) << "peak[MB]" << "  phase of owner\n";
+    for (const PhaseRecord &record : ordered_records)
+    {
+        output_stream << std::fixed << std::setprecision(4)
+                      << std::setw(12) << record.duration_
+                      << std::setprecision(1) << std::setw(9)
+                      << 100.0 * record.duration_ / SMAX(total_time, TinyReal)
+                      << std::setprecision(3) << std::setw(14) << Real(record.resident_bytes_increase_) / mega_bytes
+                      << std::setw(12) << Real(record.peak_resident_bytes_) / mega_bytes
+                      << "  " << std::string(2 * record.depth_, ' ')
+                      << record.phase_name_ << " of " << record.owner_name_ << "\n";
+    }
+    output_stream << std::defaultfloat;
+    is_reported_ = true;
+}
+//=================================================================================================//
+ScopedStartupPhase::ScopedStartupPhase(const std::string &phase_name, const std::string &owner_name)
+{
+    if (StartupProfiler::get().isEnabled())
+    {
+        is_timed_ = true;
+        phase_name_ = phase_name;
+        owner_name_ = owner_name;
+        depth_ = StartupProfiler::PhaseDepth()++;
+        start_resident_bytes_ = StartupProfiler::residentBytes();
+        start_ = TickCount::now();
+    }
+}
+//=================================================================================================//
+ScopedStartupPhase::~ScopedStartupPhase()
+{
+    if (is_timed_)
+    {
+        TickCount end = TickCount::now();
+        size_t resident_bytes = StartupProfiler::residentBytes();
+        size_t increase = resident_bytes > start_resident_bytes_ ? resident_bytes - start_resident_bytes_ : 0;
+        StartupProfiler::PhaseDepth()--;
+        StartupProfiler::get().recordPhase(phase_name_, owner_name_, depth_, start_, end,
+                                           increase, StartupProfiler::peakResidentBytes());
+    }
+}
+//=================================================================================================//
+} // namespace SPH
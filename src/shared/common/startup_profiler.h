@@ -0,0 +1,109 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	startup_profiler.h
+ * @brief 	Opt-in timing of the initialization phases before the first time step,
+ *          e.g. level set build, particle generation and reload, and initial configurations,
+ *          reported per body or shape with the growth of the resident memory.
+ * @author	Xiangyu Hu
+ */
+#ifndef STARTUP_PROFILER_H
+#define STARTUP_PROFILER_H
+
+#include "base_data_type_package.h"
+
+#include <mutex>
+
+namespace SPH
+{
+/**
+ * @class StartupProfiler
+ * @brief Records the wall-clock time and the resident memory of each startup phase.
+ * Separate from DynamicsProfiler, the phases are recorded until the first time step,
+ * when the summary is written. Nested phases are recorded with their depth
+ * so that the inner phases are shown within the outer ones but not counted twice.
+ */
+class StartupProfiler
+{
+  public:
+    static StartupProfiler &get();
+    ~StartupProfiler();
+
+    void enable(bool is_enabled = true) { is_enabled_ = is_enabled; };
+    bool isEnabled() { return is_enabled_ && !is_finished_; };
+    void recordPhase(const std::string &phase_name, const std::string &owner_name, size_t depth,
+                     const TickCount &start, const TickCount &end,
+                     size_t resident_bytes_increase, size_t peak_resident_bytes);
+    /** called at the first time step, writes the summary once */
+    void finishStartup();
+    void writeReport(std::ostream &output_stream);
+    /** current and peak resident memory of the process, zero if not available on the platform */
+    static size_t residentBytes();
+    static size_t peakResidentBytes();
+    /** nesting depth of the startup phases on the calling thread */
+    static size_t &PhaseDepth();
+
+  private:
+    StartupProfiler() : start_(TickCount::now()) {};
+
+    struct PhaseRecord
+    {
+        std::string phase_name_;
+        std::string owner_name_;
+        size_t depth_;
+        Real start_;
+        Real duration_;
+        size_t resident_bytes_increase_;
+        size_t peak_resident_bytes_;
+    };
+
+    bool is_enabled_ = false;
+    bool is_finished_ = false;
+    bool is_reported_ = false;
+    TickCount start_;
+    Real time_to_first_step_ = 0.0;
+    std::mutex mutex_;
+    StdVec<PhaseRecord> phase_records_;
+};
+
+/**
+ * @class ScopedStartupPhase
+ * @brief Time the scope of a startup phase of a body, shape or other named owner,
+ * e.g. particle relaxation in a test case. When disabled, the cost is a single flag check.
+ */
+class ScopedStartupPhase
+{
+  public:
+    ScopedStartupPhase(const std::string &phase_name, const std::string &owner_name);
+    ~ScopedStartupPhase();
+
+  private:
+    bool is_timed_ = false;
+    std::string phase_name_;
+    std::string owner_name_;
+    size_t depth_ = 0;
+    size_t start_resident_bytes_ = 0;
+    TickCount start_;
+};
+} // namespace SPH
+#endif // STARTUP_PROFILER_H
@@ -0,0 +1,52 @@
+#include "thread_pinning.h"
+
+#include "tbb/task_arena.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace SPH
+{
+//=================================================================================================//
+ThreadPinning::ThreadPinning()
+{
+#ifdef __linux__
+    cpu_set_t process_mask;
+    CPU_ZERO(&process_mask);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &process_mask) == 0)
+    {
+        for (int core = 0; core != CPU_SETSIZE; ++core)
+        {
+            if (CPU_ISSET(core, &process_mask))
+            {
+                cores_.push_back(core);
+            }
+        }
+    }
+#endif
+    observe(true);
+}
+//=================================================================================================//
+ThreadPinning::~ThreadPinning()
+{
+    observe(false);
+}
+//=================================================================================================//
+void ThreadPinning::on_scheduler_entry(bool is_worker)
+{
+#ifdef __linux__
+    int slot = tbb::this_task_arena::current_thread_index();
+    if (cores_.empty() || slot < 0)
+    {
+        return;
+    }
+    cpu_set_t thread_mask;
+    CPU_ZERO(&thread_mask);
+    CPU_SET(cores_[slot % cores_.size()], &thread_mask);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &thread_mask);
+#endif
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,54 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	thread_pinning.h
+ * @brief 	Pinning the threads of the TBB scheduler to the cores available to the process.
+ * @details Each thread is pinned, by its slot index in the arena, to one core in the order
+ *          of the affinity mask of the process, which groups the cores of each NUMA node
+ *          on the usual Linux numbering. The threads do not migrate between NUMA nodes,
+ *          so that the pages first touched by a thread stay local to it.
+ *          On other platforms the pinning has no effect.
+ * @author	Xiangyu Hu
+ */
+#ifndef THREAD_PINNING_H
+#define THREAD_PINNING_H
+
+#include "tbb/task_scheduler_observer.h"
+
+#include <vector>
+
+namespace SPH
+{
+class ThreadPinning : public tbb::task_scheduler_observer
+{
+  public:
+    ThreadPinning();
+    ~ThreadPinning() override;
+    void on_scheduler_entry(bool is_worker) override;
+    size_t NumberOfCores() { return cores_.size(); };
+
+  protected:
+    std::vector<int> cores_;
+};
+} // namespace SPH
+#endif // THREAD_PINNING_H
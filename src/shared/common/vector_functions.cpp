@@ -95,35 +95,6 @@ Mat3d inverseCholeskyDecomposition(const Mat3d &A)
     return lower.inverse();
 }
 //=================================================================================================//
-Mat2d getTransformationMatrix(const Vec2d &direction_of_y)
-{
-    Mat2d transformation_matrix = Mat2d::Zero();
-    transformation_matrix(0, 0) = direction_of_y[1];
-    transformation_matrix(0, 1) = -direction_of_y[0];
-    transformation_matrix(1, 0) = direction_of_y[0];
-    transformation_matrix(1, 1) = direction_of_y[1];
-
-    return transformation_matrix;
-}
-//=================================================================================================//
-Mat3d getTransformationMatrix(const Vec3d &direction_of_z)
-{
-    Mat3d transformation_matrix = Mat3d::Zero();
-    Real temp = 1.0 + direction_of_z[2];
-    Real fraction = temp / (temp * temp + Eps);
-    transformation_matrix(0, 0) = direction_of_z[2] + pow(direction_of_z[1], 2) * fraction;
-    transformation_matrix(0, 1) = -direction_of_z[0] * direction_of_z[1] * fraction;
-    transformation_matrix(0, 2) = -direction_of_z[0];
-    transformation_matrix(1, 0) = transformation_matrix(0, 1);
-    transformation_matrix(1, 1) = direction_of_z[2] + pow(direction_of_z[0], 2) * fraction;
-    transformation_matrix(1, 2) = -direction_of_z[1];
-    transformation_matrix(2, 0) = direction_of_z[0];
-    transformation_matrix(2, 1) = direction_of_z[1];
-    transformation_matrix(2, 2) = direction_of_z[2];
-
-    return transformation_matrix;
-}
-//=================================================================================================//
 //=================================================================================================//
 Mat3d getTransformationMatrix(const Vec3d &direction_of_z, const Vec3d &direction_of_y)
 {
@@ -29,6 +29,7 @@
 #define VECTOR_FUNCTIONS_H
 
 #include "data_type.h"
+#include "small_matrix_math.h"
 
 namespace SPH
 {
@@ -65,8 +66,35 @@ Real CalculateBiDotProduct(Mat2d Matrix1, Mat2d Matrix2); // calculate Real dot
 Real CalculateBiDotProduct(Mat3d Matrix1, Mat3d Matrix2); // calculate Real dot
 
 /** get transformation matrix. */
-Mat2d getTransformationMatrix(const Vec2d &direction_of_y);
-Mat3d getTransformationMatrix(const Vec3d &direction_of_z);
+inline Mat2d getTransformationMatrix(const Vec2d &direction_of_y)
+{
+    Mat2d transformation_matrix = Mat2d::Zero();
+    transformation_matrix(0, 0) = direction_of_y[1];
+    transformation_matrix(0, 1) = -direction_of_y[0];
+    transformation_matrix(1, 0) = direction_of_y[0];
+    transformation_matrix(1, 1) = direction_of_y[1];
+
+    return transformation_matrix;
+}
+
+inline Mat3d getTransformationMatrix(const Vec3d &direction_of_z)
+{
+    Mat3d transformation_matrix = Mat3d::Zero();
+    Real temp = 1.0 + direction_of_z[2];
+    Real fraction = temp / (temp * temp + Eps);
+    transformation_matrix(0, 0) = direction_of_z[2] + direction_of_z[1] * direction_of_z[1] * fraction;
+    transformation_matrix(0, 1) = -direction_of_z[0] * direction_of_z[1] * fraction;
+    transformation_matrix(0, 2) = -direction_of_z[0];
+    transformation_matrix(1, 0) = transformation_matrix(0, 1);
+    transformation_matrix(1, 1) = direction_of_z[2] + direction_of_z[0] * direction_of_z[0] * fraction;
+    transformation_matrix(1, 2) = -direction_of_z[1];
+    transformation_matrix(2, 0) = direction_of_z[0];
+    transformation_matrix(2, 1) = direction_of_z[1];
+    transformation_matrix(2, 2) = direction_of_z[2];
+
+    return transformation_matrix;
+}
+
 Mat3d getTransformationMatrix(const Vec3d &direction_of_z, const Vec3d &direction_of_y);
 
 template <typename VecType>
@@ -96,7 +124,7 @@ inline Real getSquaredNorm(const Real &variable) { return variable * variable; }
 template <int Dim>
 Eigen::Matrix<Real, Dim, Dim> getInverse(const Eigen::Matrix<Real, Dim, Dim> &variable)
 {
-    return variable.inverse();
+    return small_matrix::inverse(variable);
 };
 
 inline Real getInverse(const Real &variable) { return variable / (variable * variable + TinyReal); };
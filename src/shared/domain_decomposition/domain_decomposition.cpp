@@ -0,0 +1,134 @@
+#include "domain_decomposition.h"
+
+#include "sph_system.h"
+
+namespace SPH
+{
+//=================================================================================================//
+MPIEnvironment::MPIEnvironment(int *argc, char ***argv)
+{
+#if SPHINXSYS_USE_MPI
+    int is_initialized = 0;
+    MPI_Initialized(&is_initialized);
+    if (!is_initialized)
+    {
+        MPI_Init(argc, argv);
+    }
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+    MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks_);
+#endif // SPHINXSYS_USE_MPI
+}
+//=================================================================================================//
+MPIEnvironment::~MPIEnvironment()
+{
+#if SPHINXSYS_USE_MPI
+    int is_finalized = 0;
+    MPI_Finalized(&is_finalized);
+    if (!is_finalized)
+    {
+        MPI_Finalize();
+    }
+#endif // SPHINXSYS_USE_MPI
+}
+//=================================================================================================//
+DomainDecomposition::DomainDecomposition(SPHSystem &sph_system, int axis)
+    : system_domain_bounds_(sph_system.getSystemDomainBounds()), axis_(axis),
+      rank_(0), number_of_ranks_(1)
+{
+#if SPHINXSYS_USE_MPI
+    int is_initialized = 0;
+    MPI_Initialized(&is_initialized);
+    if (!is_initialized)
+    {
+        std::cout << "\n Error: MPI is not initialized, please define MPIEnvironment first!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+    MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks_);
+#endif // SPHINXSYS_USE_MPI
+
+    Real lower_bound = system_domain_bounds_.lower_[axis_];
+    Real slab_width = (system_domain_bounds_.upper_[axis_] - lower_bound) / Real(number_of_ranks_);
+    for (int k = 0; k != number_of_ranks_ + 1; ++k)
+    {
+        interface_positions_.push_back(lower_bound + Real(k) * slab_width);
+    }
+}
+//=================================================================================================//
+BoundingBoxd DomainDecomposition::SubdomainBounds()
+{
+    BoundingBoxd subdomain_bounds = system_domain_bounds_;
+    subdomain_bounds.lower_[axis_] = LowerInterface();
+    subdomain_bounds.upper_[axis_] = UpperInterface();
+    return subdomain_bounds;
+}
+//=================================================================================================//
+bool DomainDecomposition::isInSubdomain(const Vecd &position)
+{
+    // The first and last subdomains are open towards the outside of the system domain.
+    bool is_above_lower = LowerNeighborRank() == -1 || position[axis_] >= LowerInterface();
+    bool is_below_upper = UpperNeighborRank() == -1 || position[axis_] < UpperInterface();
+    return is_above_lower && is_below_upper;
+}
+//=================================================================================================//
+void DomainDecomposition::resetInterfacePositions(const StdVec<Real> &interface_positions)
+{
+    for (int k = 1; k != number_of_ranks_; ++k)
+    {
+        interface_positions_[k] = interface_positions[k];
+    }
+}
+//=================================================================================================//
+int DomainDecomposition::OwnerRank(const Vecd &position)
+{
+    // the first interface larger than the position bounds the subdomain from above
+    auto upper = std::upper_bound(interface_positions_.begin() + 1, interface_positions_.end() - 1, position[axis_]);
+    return int(upper - interface_positions_.begin()) - 1;
+}
+//=================================================================================================//
+Real DomainDecomposition::reduceMinimum(Real local_value)
+{
+    Real global_value = local_value;
+#if SPHINXSYS_USE_MPI
+    MPI_Allreduce(&local_value, &global_value, 1, MPIDataType<Real>(), MPI_MIN, MPI_COMM_WORLD);
+#endif // SPHINXSYS_USE_MPI
+    return global_value;
+}
+//=================================================================================================//
+Real DomainDecomposition::reduceMaximum(Real local_value)
+{
+    Real global_value = local_value;
+#if SPHINXSYS_USE_MPI
+    MPI_Allreduce(&local_value, &global_value, 1, MPIDataType<Real>(), MPI_MAX, MPI_COMM_WORLD);
+#endif // SPHINXSYS_USE_MPI
+    return global_value;
+}
+//=================================================================================================//
+Real DomainDecomposition::reduceSum(Real local_value)
+{
+    Real global_value = local_value;
+#if SPHINXSYS_USE_MPI
+    MPI_Allreduce(&local_value, &global_value, 1, MPIDataType<Real>(), MPI_SUM, MPI_COMM_WORLD);
+#endif // SPHINXSYS_USE_MPI
+    return global_value;
+}
+//=================================================================================================//
+UnsignedInt DomainDecomposition::reduceSum(UnsignedInt local_value)
+{
+    UnsignedInt global_value = local_value;
+#if SPHINXSYS_USE_MPI
+    MPI_Allreduce(&local_value, &global_value, 1, MPIDataType<UnsignedInt>(), MPI_SUM, MPI_COMM_WORLD);
+#endif // SPHINXSYS_USE_MPI
+    return global_value;
+}
+//=================================================================================================//
+void DomainDecomposition::reduceSum(StdVec<Real> &local_values)
+{
+#if SPHINXSYS_USE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, local_values.data(), int(local_values.size()),
+                  MPIDataType<Real>(), MPI_SUM, MPI_COMM_WORLD);
+#endif // SPHINXSYS_USE_MPI
+}
+//=================================================================================================//
+} // namespace SPH
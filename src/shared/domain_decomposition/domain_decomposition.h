@@ -0,0 +1,118 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	domain_decomposition.h
+ * @brief 	The decomposition of the system domain into subdomains for distributed-memory runs.
+ * @details The system domain is decomposed into slabs along an axis, one for each MPI rank.
+ * 			Without MPI (SPHINXSYS_USE_MPI=0), there is only one rank whose subdomain is
+ * 			the whole system domain and all global reductions return the local values.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DOMAIN_DECOMPOSITION_H
+#define DOMAIN_DECOMPOSITION_H
+
+#include "base_data_type_package.h"
+#include "sphinxsys_containers.h"
+
+#if SPHINXSYS_USE_MPI
+#include <mpi.h>
+#endif // SPHINXSYS_USE_MPI
+
+namespace SPH
+{
+class SPHSystem;
+
+#if SPHINXSYS_USE_MPI
+template <typename DataType>
+MPI_Datatype MPIDataType();
+template <>
+inline MPI_Datatype MPIDataType<float>() { return MPI_FLOAT; };
+template <>
+inline MPI_Datatype MPIDataType<double>() { return MPI_DOUBLE; };
+template <>
+inline MPI_Datatype MPIDataType<unsigned int>() { return MPI_UNSIGNED; };
+template <>
+inline MPI_Datatype MPIDataType<unsigned long>() { return MPI_UNSIGNED_LONG; };
+#endif // SPHINXSYS_USE_MPI
+
+/**
+ * @class MPIEnvironment
+ * @brief Initialize and finalize MPI. It should be defined at the beginning of main().
+ */
+class MPIEnvironment
+{
+  public:
+    MPIEnvironment(int *argc, char ***argv);
+    ~MPIEnvironment();
+    int Rank() { return rank_; };
+    int NumberOfRanks() { return number_of_ranks_; };
+
+  protected:
+    int rank_ = 0;
+    int number_of_ranks_ = 1;
+};
+
+/**
+ * @class DomainDecomposition
+ * @brief Slab decomposition of the system domain along an axis.
+ * The subdomain of rank k is bounded by interface_positions_[k] and interface_positions_[k + 1].
+ */
+class DomainDecomposition
+{
+  public:
+    DomainDecomposition(SPHSystem &sph_system, int axis = 0);
+    virtual ~DomainDecomposition() {};
+
+    int Rank() { return rank_; };
+    int NumberOfRanks() { return number_of_ranks_; };
+    int Axis() { return axis_; };
+    /** The neighbor ranks, -1 indicating no neighbor. */
+    int LowerNeighborRank() { return rank_ > 0 ? rank_ - 1 : -1; };
+    int UpperNeighborRank() { return rank_ < number_of_ranks_ - 1 ? rank_ + 1 : -1; };
+    Real LowerInterface() { return interface_positions_[rank_]; };
+    Real UpperInterface() { return interface_positions_[rank_ + 1]; };
+    BoundingBoxd SubdomainBounds();
+    bool isInSubdomain(const Vecd &position);
+    StdVec<Real> &InterfacePositions() { return interface_positions_; };
+    /** Replace the inner interfaces, the outer ones are kept at the system domain bounds. */
+    void resetInterfacePositions(const StdVec<Real> &interface_positions);
+    /** The rank whose subdomain contains the position. */
+    int OwnerRank(const Vecd &position);
+
+    /** Global reductions over all ranks, e.g. for the time-step size. */
+    Real reduceMinimum(Real local_value);
+    Real reduceMaximum(Real local_value);
+    Real reduceSum(Real local_value);
+    UnsignedInt reduceSum(UnsignedInt local_value);
+    void reduceSum(StdVec<Real> &local_values);
+
+  protected:
+    BoundingBoxd system_domain_bounds_;
+    int axis_;
+    int rank_;
+    int number_of_ranks_;
+    StdVec<Real> interface_positions_;
+};
+} // namespace SPH
+#endif // DOMAIN_DECOMPOSITION_H
@@ -0,0 +1,105 @@
+#include "load_balanced_repartition.h"
+
+#include "base_body.h"
+#include "base_particles.h"
+
+namespace SPH
+{
+//=================================================================================================//
+LoadBalancedRepartition::
+    LoadBalancedRepartition(DomainDecomposition &domain_decomposition, RealBodyVector real_bodies,
+                            StdVec<ParticleBuffer<Base> *> particle_buffers,
+                            Real imbalance_threshold, size_t number_of_bins)
+    : domain_decomposition_(domain_decomposition), real_bodies_(real_bodies),
+      imbalance_threshold_(imbalance_threshold), number_of_bins_(number_of_bins),
+      imbalance_ratio_(1.0), total_repartitions_(0)
+{
+    if (real_bodies.size() != particle_buffers.size())
+    {
+        std::cout << "\n Error: the numbers of bodies and particle buffers do not match!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    for (size_t k = 0; k != real_bodies.size(); ++k)
+    {
+        particle_redistributions_.push_back(
+            redistribution_ptrs_keeper_.createPtr<SubdomainParticleRedistribution>(
+                *real_bodies[k], domain_decomposition, *particle_buffers[k]));
+    }
+}
+//=================================================================================================//
+bool LoadBalancedRepartition::exec(Real local_step_time)
+{
+    Real max_step_time = domain_decomposition_.reduceMaximum(local_step_time);
+    Real mean_step_time = domain_decomposition_.reduceSum(local_step_time) /
+                          Real(domain_decomposition_.NumberOfRanks());
+    imbalance_ratio_ = mean_step_time > 0.0 ? max_step_time / mean_step_time : 1.0;
+
+    if (imbalance_ratio_ > imbalance_threshold_)
+    {
+        repartition(local_step_time);
+        for (auto &particle_redistribution : particle_redistributions_)
+        {
+            particle_redistribution->exec();
+        }
+        total_repartitions_++;
+        return true;
+    }
+    return false;
+}
+//=================================================================================================//
+void LoadBalancedRepartition::repartition(Real local_step_time)
+{
+    int axis = domain_decomposition_.Axis();
+    StdVec<Real> &interfaces = domain_decomposition_.InterfacePositions();
+    Real lower_bound = interfaces.front();
+    Real bin_width = (interfaces.back() - lower_bound) / Real(number_of_bins_);
+
+    UnsignedInt local_particles = 0;
+    for (auto &real_body : real_bodies_)
+    {
+        local_particles += real_body->getBaseParticles().TotalRealParticles();
+    }
+    Real cost_per_particle = local_particles > 0 ? local_step_time / Real(local_particles) : 0.0;
+
+    StdVec<Real> cost_histogram(number_of_bins_, 0.0);
+    for (auto &real_body : real_bodies_)
+    {
+        BaseParticles &particles = real_body->getBaseParticles();
+        Vecd *pos = particles.ParticlePositions();
+        for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+        {
+            int bin = int(std::floor((pos[i][axis] - lower_bound) / bin_width));
+            cost_histogram[SMIN(SMAX(bin, 0), int(number_of_bins_) - 1)] += cost_per_particle;
+        }
+    }
+    domain_decomposition_.reduceSum(cost_histogram);
+
+    Real total_cost = std::accumulate(cost_histogram.begin(), cost_histogram.end(), Real(0));
+    if (total_cost <= 0.0)
+    {
+        return;
+    }
+
+    // bisect the cumulative cost so that each subdomain has the same share
+    int number_of_ranks = domain_decomposition_.NumberOfRanks();
+    StdVec<Real> new_interfaces(interfaces);
+    Real accumulated_cost = 0.0;
+    size_t bin = 0;
+    for (int k = 1; k != number_of_ranks; ++k)
+    {
+        Real target_cost = total_cost * Real(k) / Real(number_of_ranks);
+        while (bin != number_of_bins_ - 1 && accumulated_cost + cost_histogram[bin] < target_cost)
+        {
+            accumulated_cost += cost_histogram[bin];
+            bin++;
+        }
+        Real fraction = cost_histogram[bin] > 0.0 ? (target_cost - accumulated_cost) / cost_histogram[bin] : 0.0;
+        new_interfaces[k] = lower_bound + (Real(bin) + SMIN(fraction, Real(1))) * bin_width;
+        new_interfaces[k] = SMAX(new_interfaces[k], new_interfaces[k - 1]);
+    }
+    domain_decomposition_.resetInterfacePositions(new_interfaces);
+}
+//=================================================================================================//
+} // namespace SPH
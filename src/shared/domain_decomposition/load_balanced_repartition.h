@@ -0,0 +1,68 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	load_balanced_repartition.h
+ * @brief 	Repartition of the subdomains when the per-rank step times diverge.
+ * @details The interfaces of the slab decomposition are recomputed by bisecting
+ * 			the cumulative computational cost along the decomposition axis,
+ * 			which is estimated from a global histogram of particle positions
+ * 			weighted by the measured cost per particle on each rank.
+ * 			The particles are then moved to their new owner ranks in bulk.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef LOAD_BALANCED_REPARTITION_H
+#define LOAD_BALANCED_REPARTITION_H
+
+#include "subdomain_exchange.h"
+
+namespace SPH
+{
+class LoadBalancedRepartition
+{
+    UniquePtrsKeeper<SubdomainParticleRedistribution> redistribution_ptrs_keeper_;
+
+  public:
+    LoadBalancedRepartition(DomainDecomposition &domain_decomposition, RealBodyVector real_bodies,
+                            StdVec<ParticleBuffer<Base> *> particle_buffers,
+                            Real imbalance_threshold = 1.2, size_t number_of_bins = 1024);
+    virtual ~LoadBalancedRepartition() {};
+    /** Check the imbalance by the local step time and repartition if required.
+     * Return true if the subdomains have been repartitioned. */
+    bool exec(Real local_step_time);
+    Real ImbalanceRatio() { return imbalance_ratio_; };
+    size_t TotalRepartitions() { return total_repartitions_; };
+
+  protected:
+    DomainDecomposition &domain_decomposition_;
+    RealBodyVector real_bodies_;
+    StdVec<SubdomainParticleRedistribution *> particle_redistributions_;
+    Real imbalance_threshold_;
+    size_t number_of_bins_;
+    Real imbalance_ratio_;
+    size_t total_repartitions_;
+
+    void repartition(Real local_step_time);
+};
+} // namespace SPH
+#endif // LOAD_BALANCED_REPARTITION_H
@@ -0,0 +1,296 @@
+#include "subdomain_exchange.h"
+
+#include "base_body.h"
+#include "base_particles.hpp"
+#include "cell_linked_list.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename DataType>
+void SubdomainExchange::ParticleStateSize::
+operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t &data_size)
+{
+    data_size += data_keeper.size() * sizeof(DataType);
+}
+//=================================================================================================//
+template <typename DataType>
+void SubdomainExchange::PackParticleState::
+operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper,
+           const IndexVector &particle_indices, StdVec<char> &buffer, size_t &buffer_position)
+{
+    for (size_t k = 0; k != data_keeper.size(); ++k)
+    {
+        for (size_t n = 0; n != particle_indices.size(); ++n)
+        {
+            std::memcpy(&buffer[buffer_position], &data_keeper[k][particle_indices[n]], sizeof(DataType));
+            buffer_position += sizeof(DataType);
+        }
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void SubdomainExchange::UnpackParticleState::
+operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t first_index,
+           size_t number_of_particles, const StdVec<char> &buffer, size_t &buffer_position)
+{
+    for (size_t k = 0; k != data_keeper.size(); ++k)
+    {
+        for (size_t n = 0; n != number_of_particles; ++n)
+        {
+            std::memcpy(static_cast<void *>(&data_keeper[k][first_index + n]), &buffer[buffer_position], sizeof(DataType));
+            buffer_position += sizeof(DataType);
+        }
+    }
+}
+//=================================================================================================//
+SubdomainExchange::SubdomainExchange(RealBody &real_body, DomainDecomposition &domain_decomposition)
+    : LocalDynamics(real_body), domain_decomposition_(domain_decomposition),
+      axis_(domain_decomposition.Axis()), pos_(particles_->ParticlePositions()), particle_data_size_(0)
+{
+    particle_state_size_(particles_->all_state_data_, particle_data_size_);
+}
+//=================================================================================================//
+void SubdomainExchange::packParticles(const IndexVector &particle_indices, StdVec<char> &buffer)
+{
+    buffer.resize(particle_indices.size() * particle_data_size_);
+    size_t buffer_position = 0;
+    pack_particle_state_(particles_->all_state_data_, particle_indices, buffer, buffer_position);
+}
+//=================================================================================================//
+void SubdomainExchange::unpackParticles(const StdVec<char> &buffer, size_t first_index)
+{
+    size_t buffer_position = 0;
+    unpack_particle_state_(particles_->all_state_data_, first_index, NumberOfParticles(buffer),
+                           buffer, buffer_position);
+}
+//=================================================================================================//
+StdVec<char> SubdomainExchange::
+    exchangeAlongAxis(int destination_rank, int source_rank, const StdVec<char> &send_buffer, int tag)
+{
+    StdVec<char> receive_buffer;
+#if SPHINXSYS_USE_MPI
+    int destination = destination_rank == -1 ? MPI_PROC_NULL : destination_rank;
+    int source = source_rank == -1 ? MPI_PROC_NULL : source_rank;
+    unsigned long send_size = send_buffer.size();
+    unsigned long receive_size = 0;
+    MPI_Sendrecv(&send_size, 1, MPI_UNSIGNED_LONG, destination, tag,
+                 &receive_size, 1, MPI_UNSIGNED_LONG, source, tag,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    receive_buffer.resize(receive_size);
+    MPI_Sendrecv(send_buffer.data(), int(send_size), MPI_BYTE, destination, tag + 1,
+                 receive_buffer.data(), int(receive_size), MPI_BYTE, source, tag + 1,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+#endif // SPHINXSYS_USE_MPI
+    return receive_buffer;
+}
+//=================================================================================================//
+SubdomainHaloExchange::HaloCreation::
+    HaloCreation(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                 Ghost<ReserveSizeFactor> &ghost_boundary)
+    : SubdomainExchange(real_body, domain_decomposition), BaseDynamics<void>(),
+      ghost_boundary_(ghost_boundary), ghost_bound_(ghost_boundary.GhostBound()),
+      halo_width_(real_body.getSPHAdaptation().getKernel()->CutOffRadius()),
+      cell_linked_list_(real_body.getCellLinkedList()),
+      sorted_id_(particles_->ParticleSortedIds()),
+      lower_receive_size_(0), upper_receive_size_(0)
+{
+    ghost_boundary.checkParticlesReserved();
+}
+//=================================================================================================//
+void SubdomainHaloExchange::HaloCreation::exec(Real dt)
+{
+    lower_send_indices_.clear();
+    upper_send_indices_.clear();
+    Real lower_interface = domain_decomposition_.LowerInterface();
+    Real upper_interface = domain_decomposition_.UpperInterface();
+    bool has_lower_neighbor = domain_decomposition_.LowerNeighborRank() != -1;
+    bool has_upper_neighbor = domain_decomposition_.UpperNeighborRank() != -1;
+    for (size_t i = 0; i != particles_->TotalRealParticles(); ++i)
+    {
+        if (has_lower_neighbor && pos_[i][axis_] < lower_interface + halo_width_)
+        {
+            lower_send_indices_.push_back(i);
+        }
+        if (has_upper_neighbor && pos_[i][axis_] > upper_interface - halo_width_)
+        {
+            upper_send_indices_.push_back(i);
+        }
+    }
+
+    StdVec<char> lower_send_buffer, upper_send_buffer;
+    packParticles(lower_send_indices_, lower_send_buffer);
+    packParticles(upper_send_indices_, upper_send_buffer);
+    StdVec<char> lower_receive_buffer = exchangeAlongAxis(
+        domain_decomposition_.UpperNeighborRank(), domain_decomposition_.LowerNeighborRank(), upper_send_buffer, 0);
+    StdVec<char> upper_receive_buffer = exchangeAlongAxis(
+        domain_decomposition_.LowerNeighborRank(), domain_decomposition_.UpperNeighborRank(), lower_send_buffer, 2);
+
+    lower_receive_size_ = NumberOfParticles(lower_receive_buffer);
+    upper_receive_size_ = NumberOfParticles(upper_receive_buffer);
+    ghost_bound_.second = ghost_bound_.first + lower_receive_size_ + upper_receive_size_;
+    ghost_boundary_.checkWithinGhostSize(ghost_bound_);
+
+    unpackParticles(lower_receive_buffer, ghost_bound_.first);
+    unpackParticles(upper_receive_buffer, ghost_bound_.first + lower_receive_size_);
+    for (size_t i = ghost_bound_.first; i != ghost_bound_.second; ++i)
+    {
+        /** A halo particle has no corresponding real particle in this subdomain. */
+        sorted_id_[i] = i;
+        cell_linked_list_.InsertListDataEntry(i, pos_[i]);
+    }
+}
+//=================================================================================================//
+SubdomainHaloExchange::HaloUpdate::
+    HaloUpdate(RealBody &real_body, DomainDecomposition &domain_decomposition, HaloCreation &halo_creation)
+    : SubdomainExchange(real_body, domain_decomposition), BaseDynamics<void>(),
+      halo_creation_(halo_creation) {}
+//=================================================================================================//
+void SubdomainHaloExchange::HaloUpdate::exec(Real dt)
+{
+    StdVec<char> lower_send_buffer, upper_send_buffer;
+    packParticles(halo_creation_.lower_send_indices_, lower_send_buffer);
+    packParticles(halo_creation_.upper_send_indices_, upper_send_buffer);
+    StdVec<char> lower_receive_buffer = exchangeAlongAxis(
+        domain_decomposition_.UpperNeighborRank(), domain_decomposition_.LowerNeighborRank(), upper_send_buffer, 4);
+    StdVec<char> upper_receive_buffer = exchangeAlongAxis(
+        domain_decomposition_.LowerNeighborRank(), domain_decomposition_.UpperNeighborRank(), lower_send_buffer, 6);
+
+    if (NumberOfParticles(lower_receive_buffer) != halo_creation_.lower_receive_size_ ||
+        NumberOfParticles(upper_receive_buffer) != halo_creation_.upper_receive_size_)
+    {
+        std::cout << "\n Error: the number of halo particles has changed since halo creation!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    ParticlesBound &ghost_bound = halo_creation_.ghost_bound_;
+    unpackParticles(lower_receive_buffer, ghost_bound.first);
+    unpackParticles(upper_receive_buffer, ghost_bound.first + halo_creation_.lower_receive_size_);
+}
+//=================================================================================================//
+SubdomainHaloExchange::SubdomainHaloExchange(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                                             Ghost<ReserveSizeFactor> &ghost_boundary)
+    : halo_creation_(real_body, domain_decomposition, ghost_boundary),
+      halo_update_(real_body, domain_decomposition, halo_creation_) {}
+//=================================================================================================//
+SubdomainParticleMigration::
+    SubdomainParticleMigration(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                               ParticleBuffer<Base> &particle_buffer)
+    : SubdomainExchange(real_body, domain_decomposition), BaseDynamics<void>(),
+      particle_buffer_(particle_buffer), original_id_(particles_->ParticleOriginalIds())
+{
+    particle_buffer_.checkParticlesReserved();
+}
+//=================================================================================================//
+void SubdomainParticleMigration::exec(Real dt)
+{
+    IndexVector lower_leaving_indices, upper_leaving_indices;
+    Real lower_interface = domain_decomposition_.LowerInterface();
+    Real upper_interface = domain_decomposition_.UpperInterface();
+    bool has_lower_neighbor = domain_decomposition_.LowerNeighborRank() != -1;
+    bool has_upper_neighbor = domain_decomposition_.UpperNeighborRank() != -1;
+    for (size_t i = 0; i != particles_->TotalRealParticles(); ++i)
+    {
+        if (has_lower_neighbor && pos_[i][axis_] < lower_interface)
+        {
+            lower_leaving_indices.push_back(i);
+        }
+        else if (has_upper_neighbor && pos_[i][axis_] >= upper_interface)
+        {
+            upper_leaving_indices.push_back(i);
+        }
+    }
+
+    StdVec<char> lower_send_buffer, upper_send_buffer;
+    packParticles(lower_leaving_indices, lower_send_buffer);
+    packParticles(upper_leaving_indices, upper_send_buffer);
+
+    IndexVector leaving_indices(lower_leaving_indices);
+    leaving_indices.insert(leaving_indices.end(), upper_leaving_indices.begin(), upper_leaving_indices.end());
+    removeLeavingParticles(leaving_indices);
+
+    StdVec<char> lower_receive_buffer = exchangeAlongAxis(
+        domain_decomposition_.UpperNeighborRank(), domain_decomposition_.LowerNeighborRank(), upper_send_buffer, 8);
+    StdVec<char> upper_receive_buffer = exchangeAlongAxis(
+        domain_decomposition_.LowerNeighborRank(), domain_decomposition_.UpperNeighborRank(), lower_send_buffer, 10);
+    realizeReceivedParticles(lower_receive_buffer);
+    realizeReceivedParticles(upper_receive_buffer);
+}
+//=================================================================================================//
+void SubdomainParticleMigration::removeLeavingParticles(IndexVector &leaving_indices)
+{
+    // In descending order so that the last real particle switched in is never a leaving one.
+    std::sort(leaving_indices.begin(), leaving_indices.end(), std::greater<size_t>());
+    for (size_t index_i : leaving_indices)
+    {
+        particles_->switchToBufferParticle(index_i);
+    }
+}
+//=================================================================================================//
+void SubdomainParticleMigration::realizeReceivedParticles(const StdVec<char> &receive_buffer)
+{
+    size_t first_index = particles_->TotalRealParticles();
+    for (size_t n = 0; n != NumberOfParticles(receive_buffer); ++n)
+    {
+        particle_buffer_.checkEnoughBuffer(*particles_);
+        size_t new_index = particles_->TotalRealParticles();
+        original_id_[new_index] = new_index;
+        particles_->svTotalRealParticles()->incrementValue(1);
+    }
+    unpackParticles(receive_buffer, first_index);
+}
+//=================================================================================================//
+SubdomainParticleRedistribution::
+    SubdomainParticleRedistribution(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                                    ParticleBuffer<Base> &particle_buffer)
+    : SubdomainParticleMigration(real_body, domain_decomposition, particle_buffer) {}
+//=================================================================================================//
+void SubdomainParticleRedistribution::exec(Real dt)
+{
+    int number_of_ranks = domain_decomposition_.NumberOfRanks();
+    int rank = domain_decomposition_.Rank();
+    StdVec<IndexVector> leaving_indices_by_rank(number_of_ranks);
+    for (size_t i = 0; i != particles_->TotalRealParticles(); ++i)
+    {
+        int owner_rank = domain_decomposition_.OwnerRank(pos_[i]);
+        if (owner_rank != rank)
+        {
+            leaving_indices_by_rank[owner_rank].push_back(i);
+        }
+    }
+
+    StdVec<char> send_buffer;
+    StdVec<int> send_counts(number_of_ranks, 0), send_displacements(number_of_ranks, 0);
+    IndexVector leaving_indices;
+    for (int k = 0; k != number_of_ranks; ++k)
+    {
+        StdVec<char> rank_buffer;
+        packParticles(leaving_indices_by_rank[k], rank_buffer);
+        send_displacements[k] = int(send_buffer.size());
+        send_counts[k] = int(rank_buffer.size());
+        send_buffer.insert(send_buffer.end(), rank_buffer.begin(), rank_buffer.end());
+        leaving_indices.insert(leaving_indices.end(),
+                               leaving_indices_by_rank[k].begin(), leaving_indices_by_rank[k].end());
+    }
+    removeLeavingParticles(leaving_indices);
+
+    StdVec<char> receive_buffer;
+#if SPHINXSYS_USE_MPI
+    StdVec<int> receive_counts(number_of_ranks, 0), receive_displacements(number_of_ranks, 0);
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, receive_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    int total_receive_size = 0;
+    for (int k = 0; k != number_of_ranks; ++k)
+    {
+        receive_displacements[k] = total_receive_size;
+        total_receive_size += receive_counts[k];
+    }
+    receive_buffer.resize(total_receive_size);
+    MPI_Alltoallv(send_buffer.data(), send_counts.data(), send_displacements.data(), MPI_BYTE,
+                  receive_buffer.data(), receive_counts.data(), receive_displacements.data(), MPI_BYTE,
+                  MPI_COMM_WORLD);
+#endif // SPHINXSYS_USE_MPI
+    realizeReceivedParticles(receive_buffer);
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,176 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	subdomain_exchange.h
+ * @brief 	Exchange of particles between neighboring subdomains,
+ * 			i.e. halo particles for the interactions across subdomain interfaces
+ * 			and migration of real particles crossing the interfaces.
+ * @details All state variables of a particle are packed together for exchange.
+ * 			Halo particles are received into the ghost particles reserved by Ghost<ReserveSizeFactor> and
+ * 			inserted into the cell linked list, similar to the periodic condition using ghost particles.
+ * 			Therefore, halo creation should be carried out after the update of cell linked list,
+ * 			and halo update before the interactions which use the states of neighboring particles.
+ * 			Particle migration should be carried out before the update of cell linked list.
+ * 			Note that the original particle ids are only unique within a subdomain.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef SUBDOMAIN_EXCHANGE_H
+#define SUBDOMAIN_EXCHANGE_H
+
+#include "base_general_dynamics.h"
+#include "domain_decomposition.h"
+#include "particle_reserve.h"
+
+namespace SPH
+{
+/**
+ * @class SubdomainExchange
+ * @brief Base class for packing, unpacking and exchanging particle states with neighboring subdomains.
+ */
+class SubdomainExchange : public LocalDynamics
+{
+  public:
+    SubdomainExchange(RealBody &real_body, DomainDecomposition &domain_decomposition);
+    virtual ~SubdomainExchange() {};
+
+  protected:
+    DomainDecomposition &domain_decomposition_;
+    int axis_;
+    Vecd *pos_;
+    size_t particle_data_size_; /**< the number of bytes of all states of a particle */
+
+    struct ParticleStateSize
+    {
+        template <typename DataType>
+        void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t &data_size);
+    };
+
+    struct PackParticleState
+    {
+        template <typename DataType>
+        void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper,
+                        const IndexVector &particle_indices, StdVec<char> &buffer, size_t &buffer_position);
+    };
+
+    struct UnpackParticleState
+    {
+        template <typename DataType>
+        void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t first_index,
+                        size_t number_of_particles, const StdVec<char> &buffer, size_t &buffer_position);
+    };
+
+    OperationOnDataAssemble<ParticleData, ParticleStateSize> particle_state_size_;
+    OperationOnDataAssemble<ParticleData, PackParticleState> pack_particle_state_;
+    OperationOnDataAssemble<ParticleData, UnpackParticleState> unpack_particle_state_;
+
+    void packParticles(const IndexVector &particle_indices, StdVec<char> &buffer);
+    void unpackParticles(const StdVec<char> &buffer, size_t first_index);
+    size_t NumberOfParticles(const StdVec<char> &buffer) { return buffer.size() / particle_data_size_; };
+    /** Send to the destination rank and receive from the source rank at the same time,
+     * -1 indicating no rank, so that all ranks shift data in the same direction simultaneously. */
+    StdVec<char> exchangeAlongAxis(int destination_rank, int source_rank, const StdVec<char> &send_buffer, int tag);
+};
+
+/**
+ * @class SubdomainHaloExchange
+ * @brief Creating and updating the halo particles from neighboring subdomains.
+ * The halo width is the largest cut-off radius of the body.
+ */
+class SubdomainHaloExchange
+{
+  protected:
+    class HaloCreation : public SubdomainExchange, public BaseDynamics<void>
+    {
+      public:
+        HaloCreation(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                     Ghost<ReserveSizeFactor> &ghost_boundary);
+        virtual ~HaloCreation() {};
+        virtual void exec(Real dt = 0.0) override;
+
+      protected:
+        friend class SubdomainHaloExchange;
+        Ghost<ReserveSizeFactor> &ghost_boundary_;
+        ParticlesBound &ghost_bound_;
+        Real halo_width_;
+        BaseCellLinkedList &cell_linked_list_;
+        UnsignedInt *sorted_id_;
+        IndexVector lower_send_indices_, upper_send_indices_;
+        size_t lower_receive_size_, upper_receive_size_;
+    };
+
+    class HaloUpdate : public SubdomainExchange, public BaseDynamics<void>
+    {
+      public:
+        HaloUpdate(RealBody &real_body, DomainDecomposition &domain_decomposition, HaloCreation &halo_creation);
+        virtual ~HaloUpdate() {};
+        virtual void exec(Real dt = 0.0) override;
+
+      protected:
+        HaloCreation &halo_creation_;
+    };
+
+  public:
+    SubdomainHaloExchange(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                          Ghost<ReserveSizeFactor> &ghost_boundary);
+    virtual ~SubdomainHaloExchange() {};
+
+    HaloCreation halo_creation_;
+    HaloUpdate halo_update_;
+};
+
+/**
+ * @class SubdomainParticleMigration
+ * @brief Moving the real particles which have crossed the subdomain interfaces to neighboring subdomains.
+ * The received particles are realized from the buffer particles reserved by ParticleBuffer.
+ */
+class SubdomainParticleMigration : public SubdomainExchange, public BaseDynamics<void>
+{
+  public:
+    SubdomainParticleMigration(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                               ParticleBuffer<Base> &particle_buffer);
+    virtual ~SubdomainParticleMigration() {};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    ParticleBuffer<Base> &particle_buffer_;
+    UnsignedInt *original_id_;
+    void removeLeavingParticles(IndexVector &leaving_indices);
+    void realizeReceivedParticles(const StdVec<char> &receive_buffer);
+};
+
+/**
+ * @class SubdomainParticleRedistribution
+ * @brief Moving particles in bulk to their owner ranks after the subdomains have been repartitioned.
+ * Different from SubdomainParticleMigration, the owner rank may be any rank, not only the neighboring ones.
+ */
+class SubdomainParticleRedistribution : public SubdomainParticleMigration
+{
+  public:
+    SubdomainParticleRedistribution(RealBody &real_body, DomainDecomposition &domain_decomposition,
+                                    ParticleBuffer<Base> &particle_buffer);
+    virtual ~SubdomainParticleRedistribution() {};
+    virtual void exec(Real dt = 0.0) override;
+};
+} // namespace SPH
+#endif // SUBDOMAIN_EXCHANGE_H
@@ -81,36 +81,49 @@ BoundingBoxd BinaryShapes::findBounds()
     return BoundingBoxd(lower_bound, upper_bound);
 }
 //=================================================================================================//
+bool BinaryShapes::applyBooleanOp(bool exist, SubShapeAndOp &sub_shape_and_op, const Vecd &pnt)
+{
+    Shape *geometry = sub_shape_and_op.first;
+    ShapeBooleanOps operation_string = sub_shape_and_op.second;
+    switch (operation_string)
+    {
+    case ShapeBooleanOps::add:
+    {
+        bool inside = geometry->checkContain(pnt);
+        return exist || inside;
+    }
+    case ShapeBooleanOps::sub:
+    {
+        bool inside = geometry->checkContain(pnt);
+        return exist && (!inside);
+    }
+    default:
+    {
+        std::cout << "\n FAILURE: the boolean operation is not applicable!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        throw;
+    }
+    }
+}
+//=================================================================================================//
 bool BinaryShapes::checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED)
 {
     bool exist = false;
-    bool inside = false;
 
-    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    if (sub_shape_hierarchy_ != nullptr)
     {
-        Shape *geometry = sub_shape_and_op.first;
-        ShapeBooleanOps operation_string = sub_shape_and_op.second;
-        switch (operation_string)
-        {
-        case ShapeBooleanOps::add:
-        {
-            inside = geometry->checkContain(pnt);
-            exist = exist || inside;
-            break;
-        }
-        case ShapeBooleanOps::sub:
+        StdVec<size_t> candidates;
+        sub_shape_hierarchy_->findItemsContaining(pnt, candidates);
+        for (size_t index : candidates)
         {
-            inside = geometry->checkContain(pnt);
-            exist = exist && (!inside);
-            break;
-        }
-        default:
-        {
-            std::cout << "\n FAILURE: the boolean operation is not applicable!" << std::endl;
-            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
-            throw;
-        }
+            exist = applyBooleanOp(exist, sub_shapes_and_ops_[index], pnt);
         }
+        return exist;
+    }
+
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        exist = applyBooleanOp(exist, sub_shape_and_op, pnt);
     }
     return exist;
 }
@@ -123,6 +136,27 @@ Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
     Vecd pnt_closest = Vecd::Zero();
     Vecd pnt_found = Vecd::Zero();
 
+    if (sub_shape_hierarchy_ != nullptr)
+    {
+        // the surface of a sub-shape is not closer than its bounds,
+        // and the last one is taken for equal distances as without the hierarchy
+        size_t index_closest = 0;
+        sub_shape_hierarchy_->forEachItemWithinDistance(
+            probe_point, dist_min,
+            [&](size_t index)
+            {
+                pnt_found = sub_shapes_and_ops_[index].first->findClosestPoint(probe_point);
+                Real dist = (probe_point - pnt_found).norm();
+                if (dist < dist_min || (dist == dist_min && index > index_closest))
+                {
+                    dist_min = dist;
+                    pnt_closest = pnt_found;
+                    index_closest = index;
+                }
+            });
+        return pnt_closest;
+    }
+
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
     {
         Shape *geometry = sub_shape_and_op.first;
@@ -139,6 +173,40 @@ Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
     return pnt_closest;
 }
 //=================================================================================================//
+Real BinaryShapes::findSignedDistance(const Vecd &probe_point)
+{
+    // a single added shape, e.g. one STL geometry, provides the signed distance directly
+    if (sub_shapes_and_ops_.size() == 1 && sub_shapes_and_ops_[0].second == ShapeBooleanOps::add)
+        return sub_shapes_and_ops_[0].first->findSignedDistance(probe_point);
+
+    return Shape::findSignedDistance(probe_point);
+}
+//=================================================================================================//
+size_t BinaryShapes::GeometryHash()
+{
+    size_t hash = 0;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        size_t sub_shape_hash = sub_shape_and_op.first->GeometryHash();
+        if (sub_shape_hash == 0)
+            return 0; // the whole shape is not identified if any sub-shape is not
+
+        hash = hashCombine(hash, sub_shape_hash);
+        hash = hashCombine(hash, static_cast<size_t>(sub_shape_and_op.second));
+    }
+    return hash;
+}
+//=================================================================================================//
+void BinaryShapes::buildSubShapeHierarchy()
+{
+    StdVec<BoundingBoxd> sub_shape_bounds;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
+    {
+        sub_shape_bounds.push_back(sub_shape_and_op.first->getBounds());
+    }
+    sub_shape_hierarchy_ = makeUnique<BoundingVolumeHierarchy>(sub_shape_bounds);
+}
+//=================================================================================================//
 SubShapeAndOp *BinaryShapes::getSubShapeAndOpByName(const std::string &name)
 {
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
@@ -31,6 +31,7 @@
 #define BASE_GEOMETRY_H
 
 #include "base_data_type_package.h"
+#include "bounding_volume_hierarchy.h"
 #include "sphinxsys_containers.h"
 
 #include <spdlog/spdlog.h>
@@ -79,16 +80,25 @@ class Shape
 
     bool checkNotFar(const Vecd &probe_point, Real threshold);
     bool checkNearSurface(const Vecd &probe_point, Real threshold);
-    /** Signed distance is negative for point within the shape. */
-    Real findSignedDistance(const Vecd &probe_point);
+    /** Signed distance is negative for point within the shape.
+     *  Derived shapes may override it when they obtain both sign and distance from a single query. */
+    virtual Real findSignedDistance(const Vecd &probe_point);
     /** Normal direction point toward outside of the shape. */
     Vecd findNormalDirection(const Vecd &probe_point);
     virtual BoundingBoxd findBounds() = 0;
+    /** Hash identifying the geometry, e.g. for caching level sets.
+     *  Zero, the default, means that the geometry can not be identified. */
+    virtual size_t GeometryHash() { return 0; };
 
   protected:
     std::string name_;
     bool is_bounds_found_;
     std::shared_ptr<spdlog::logger> logger_;
+
+    static size_t hashCombine(size_t seed, size_t value)
+    {
+        return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
 };
 
 using SubShapeAndOp = std::pair<Shape *, ShapeBooleanOps>;
@@ -110,6 +120,7 @@ class BinaryShapes : public Shape
     {
         SubShapeAndOp sub_shape_and_op(sub_shape, ShapeBooleanOps::add);
         sub_shapes_and_ops_.push_back(sub_shape_and_op);
+        sub_shape_hierarchy_.reset();
     };
 
     template <class SubShapeType, typename... Args>
@@ -123,6 +134,7 @@ class BinaryShapes : public Shape
     {
         SubShapeAndOp sub_shape_and_op(sub_shape, ShapeBooleanOps::sub);
         sub_shapes_and_ops_.push_back(sub_shape_and_op);
+        sub_shape_hierarchy_.reset();
     };
 
     template <class SubShapeType, typename... Args>
@@ -135,14 +147,23 @@ class BinaryShapes : public Shape
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual Real findSignedDistance(const Vecd &probe_point) override;
     virtual BoundingBoxd findBounds() override;
+    virtual size_t GeometryHash() override;
     Shape *getSubShapeByName(const std::string &name);
     SubShapeAndOp *getSubShapeAndOpByName(const std::string &name);
     size_t getSubShapeIndexByName(const std::string &name);
+    /** Optional, after all sub-shapes are defined, so that the queries only evaluate the sub-shapes
+     *  with relevant bounds, while the ordered boolean operations are kept. */
+    void buildSubShapeHierarchy();
 
   protected:
     UniquePtrsKeeper<Shape> sub_shape_ptrs_keeper_;
     StdVec<SubShapeAndOp> sub_shapes_and_ops_;
+    UniquePtr<BoundingVolumeHierarchy> sub_shape_hierarchy_;
+
+    /** A point outside the bounds of a sub-shape leaves the result unchanged for both operations. */
+    bool applyBooleanOp(bool exist, SubShapeAndOp &sub_shape_and_op, const Vecd &pnt);
 };
 
 /**
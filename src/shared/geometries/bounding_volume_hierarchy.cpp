@@ -0,0 +1,94 @@
+#include "bounding_volume_hierarchy.h"
+
+namespace SPH
+{
+//=================================================================================================//
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const StdVec<BoundingBoxd> &item_bounds)
+    : item_bounds_(item_bounds), item_indexes_(item_bounds.size())
+{
+    for (size_t i = 0; i != item_indexes_.size(); ++i)
+    {
+        item_indexes_[i] = i;
+    }
+    if (!item_indexes_.empty())
+    {
+        nodes_.reserve(2 * item_indexes_.size());
+        buildNode(0, item_indexes_.size());
+    }
+}
+//=================================================================================================//
+size_t BoundingVolumeHierarchy::buildNode(size_t first, size_t last)
+{
+    Vecd lower = MaxReal * Vecd::Ones();
+    Vecd upper = MinReal * Vecd::Ones();
+    Vecd center_lower = MaxReal * Vecd::Ones();
+    Vecd center_upper = MinReal * Vecd::Ones();
+    for (size_t k = first; k != last; ++k)
+    {
+        const BoundingBoxd &bounds = item_bounds_[item_indexes_[k]];
+        Vecd center = 0.5 * (bounds.lower_ + bounds.upper_);
+        lower = lower.cwiseMin(bounds.lower_);
+        upper = upper.cwiseMax(bounds.upper_);
+        center_lower = center_lower.cwiseMin(center);
+        center_upper = center_upper.cwiseMax(center);
+    }
+
+    size_t node_index = nodes_.size();
+    nodes_.push_back(Node{BoundingBoxd(lower, upper), MaxSize_t, MaxSize_t, first, last});
+    if (last - first <= MaxItemsInLeaf)
+        return node_index;
+
+    int axis = 0;
+    (center_upper - center_lower).maxCoeff(&axis);
+    size_t middle = first + (last - first) / 2;
+    std::nth_element(item_indexes_.begin() + first, item_indexes_.begin() + middle,
+                     item_indexes_.begin() + last,
+                     [&](size_t a, size_t b)
+                     {
+                         return item_bounds_[a].lower_[axis] + item_bounds_[a].upper_[axis] <
+                                item_bounds_[b].lower_[axis] + item_bounds_[b].upper_[axis];
+                     });
+
+    size_t left = buildNode(first, middle);
+    size_t right = buildNode(middle, last);
+    nodes_[node_index].left_ = left;
+    nodes_[node_index].right_ = right;
+    return node_index;
+}
+//=================================================================================================//
+Real BoundingVolumeHierarchy::distanceToBounds(const BoundingBoxd &bounds, const Vecd &point)
+{
+    Vecd outside = (bounds.lower_ - point).cwiseMax(point - bounds.upper_).cwiseMax(Vecd::Zero());
+    return outside.norm();
+}
+//=================================================================================================//
+void BoundingVolumeHierarchy::findItemsContaining(const Vecd &point, StdVec<size_t> &items) const
+{
+    items.clear();
+    if (nodes_.empty())
+        return;
+
+    StdVec<size_t> node_stack(1, 0);
+    while (!node_stack.empty())
+    {
+        const Node &node = nodes_[node_stack.back()];
+        node_stack.pop_back();
+        if (!node.bounds_.checkContain(point))
+            continue;
+
+        if (node.left_ == MaxSize_t)
+        {
+            for (size_t k = node.first_; k != node.last_; ++k)
+            {
+                if (item_bounds_[item_indexes_[k]].checkContain(point))
+                    items.push_back(item_indexes_[k]);
+            }
+            continue;
+        }
+        node_stack.push_back(node.left_);
+        node_stack.push_back(node.right_);
+    }
+    std::sort(items.begin(), items.end());
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,105 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	bounding_volume_hierarchy.h
+ * @brief 	A bounding volume hierarchy over axis-aligned boxes of items, e.g. sub-shapes,
+ * 			so that point queries only touch the items whose boxes are relevant.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef BOUNDING_VOLUME_HIERARCHY_H
+#define BOUNDING_VOLUME_HIERARCHY_H
+
+#include "base_data_type_package.h"
+#include "sphinxsys_containers.h"
+
+namespace SPH
+{
+/**
+ * @class BoundingVolumeHierarchy
+ * @brief Binary tree built by median splits of the box centers along the largest extent.
+ * The items are referred by their indexes in the given box list.
+ */
+class BoundingVolumeHierarchy
+{
+    struct Node
+    {
+        BoundingBoxd bounds_;
+        size_t left_, right_; /**< child nodes, MaxSize_t for a leaf */
+        size_t first_, last_; /**< range of items in a leaf */
+    };
+
+  public:
+    explicit BoundingVolumeHierarchy(const StdVec<BoundingBoxd> &item_bounds);
+    ~BoundingVolumeHierarchy() {};
+
+    /** The indexes, in ascending order, of the items whose boxes contain the point. */
+    void findItemsContaining(const Vecd &point, StdVec<size_t> &items) const;
+    /** Apply the function to the items whose boxes are not further than the distance from the point.
+     *  The function may reduce the distance, e.g. for a closest point search. */
+    template <typename FunctionOnItem>
+    void forEachItemWithinDistance(const Vecd &point, Real &distance, const FunctionOnItem &function) const;
+
+  protected:
+    static constexpr size_t MaxItemsInLeaf = 4;
+    StdVec<BoundingBoxd> item_bounds_;
+    StdVec<size_t> item_indexes_;
+    StdVec<Node> nodes_;
+
+    size_t buildNode(size_t first, size_t last);
+    static Real distanceToBounds(const BoundingBoxd &bounds, const Vecd &point);
+};
+
+template <typename FunctionOnItem>
+void BoundingVolumeHierarchy::forEachItemWithinDistance(
+    const Vecd &point, Real &distance, const FunctionOnItem &function) const
+{
+    if (nodes_.empty())
+        return;
+
+    StdVec<size_t> node_stack(1, 0);
+    while (!node_stack.empty())
+    {
+        const Node &node = nodes_[node_stack.back()];
+        node_stack.pop_back();
+        if (distanceToBounds(node.bounds_, point) > distance)
+            continue;
+
+        if (node.left_ == MaxSize_t)
+        {
+            for (size_t k = node.first_; k != node.last_; ++k)
+            {
+                if (distanceToBounds(item_bounds_[item_indexes_[k]], point) <= distance)
+                    function(item_indexes_[k]);
+            }
+            continue;
+        }
+        // visit the nearer child first to reduce the distance early
+        bool is_left_nearer = distanceToBounds(nodes_[node.left_].bounds_, point) <=
+                              distanceToBounds(nodes_[node.right_].bounds_, point);
+        node_stack.push_back(is_left_nearer ? node.right_ : node.left_);
+        node_stack.push_back(is_left_nearer ? node.left_ : node.right_);
+    }
+}
+} // namespace SPH
+#endif // BOUNDING_VOLUME_HIERARCHY_H
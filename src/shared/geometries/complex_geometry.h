@@ -90,6 +90,8 @@ class AlignedBox : public TransformGeometry<GeometricBox>
               Transform(Vecd(0.5 * (shape.bounding_box_.upper_ + shape.bounding_box_.lower_))),
               0.5 * (shape.bounding_box_.upper_ - shape.bounding_box_.lower_), std::forward<Args>(args)...),
           alignment_axis_(upper_bound_axis){};
+    /** an empty box, e.g. for the storage of boxes in discrete variables */
+    AlignedBox() : AlignedBox(0, Transform(), Vecd::Zero()) {};
     ~AlignedBox() {};
 
     Vecd HalfSize() { return halfsize_; }
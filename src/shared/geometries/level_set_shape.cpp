@@ -25,7 +25,7 @@ LevelSetShape::LevelSetShape(SPHBody &sph_body, Shape &shape,
 LevelSetShape::LevelSetShape(BoundingBoxd bounding_box, Shape &shape,
                              SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio)
     : Shape(shape.getName()), sph_adaptation_(sph_adaptation),
-      level_set_(*level_set_keeper_.movePtr(sph_adaptation->createLevelSet(shape, refinement_ratio)))
+      level_set_(*level_set_keeper_.movePtr(sph_adaptation->createLevelSet(shape, refinement_ratio, shape.getBounds())))
 {
     bounding_box_ = shape.getBounds();
     is_bounds_found_ = true;
@@ -34,13 +34,67 @@ LevelSetShape::LevelSetShape(BoundingBoxd bounding_box, Shape &shape,
 LevelSetShape::LevelSetShape(BoundingBoxd bounding_box, SPHBody &sph_body,
                              Shape &shape, Real refinement_ratio)
     : Shape(shape.getName()),
-      level_set_(*level_set_keeper_.movePtr(
-          sph_body.getSPHAdaptation().createLevelSet(shape, refinement_ratio)))
+      level_set_(*level_set_keeper_.movePtr(createLevelSet(sph_body, shape, refinement_ratio)))
 {
     bounding_box_ = shape.getBounds();
     is_bounds_found_ = true;
 }
 //=================================================================================================//
+UniquePtr<LevelSet> LevelSetShape::createLevelSet(SPHBody &sph_body, Shape &shape, Real refinement_ratio)
+{
+    SPHSystem &sph_system = sph_body.getSPHSystem();
+    SPHAdaptation &sph_adaptation = sph_body.getSPHAdaptation();
+    ScopedStartupPhase startup_phase("LevelSet", shape.getName());
+    BoundingBoxd bounds = shape.getBounds();
+    if (sph_system.LevelSetsWithinDomainBounds())
+    {
+        // a few reference spacings beyond the domain for the probes of particles near the domain bounds
+        Real margin = 4.0 * sph_adaptation.ReferenceSpacing() / refinement_ratio;
+        bounds = bounds.getIntersect(sph_system.getSystemDomainBounds().expand(margin * Vecd::Ones()));
+    }
+    size_t geometry_hash = shape.GeometryHash();
+    if (!sph_system.CacheLevelSets() || geometry_hash == 0)
+        return sph_adaptation.createLevelSet(shape, refinement_ratio, bounds);
+
+    size_t key = hashCombine(geometry_hash, std::hash<Real>{}(refinement_ratio));
+    key = hashCombine(key, std::hash<Real>{}(sph_adaptation.ReferenceSpacing()));
+    key = hashCombine(key, std::hash<Real>{}(sph_adaptation.MinimumSpacing()));
+    key = hashCombine(key, std::hash<Real>{}(sph_adaptation.ReferenceSmoothingLength()));
+    for (int i = 0; i != Dimensions; ++i)
+    {
+        key = hashCombine(key, std::hash<Real>{}(bounds.lower_[i]));
+        key = hashCombine(key, std::hash<Real>{}(bounds.upper_[i]));
+    }
+    std::stringstream key_string;
+    key_string << std::hex << key;
+    cache_file_name_ = sph_system.getIOEnvironment().LevelSetCacheFolder() +
+                       "/LevelSet_" + shape.getName() + "_" + key_string.str() + ".dat";
+
+    if (fs::exists(cache_file_name_))
+    {
+        ScopedStartupPhase reload_phase("LevelSetReloadFromCache", shape.getName());
+        std::ifstream cache_file(cache_file_name_, std::ios::binary);
+        is_restored_from_cache_ = true;
+        return makeUnique<LevelSet>(bounds, cache_file, shape, sph_adaptation, refinement_ratio);
+    }
+    return sph_adaptation.createLevelSet(shape, refinement_ratio, bounds);
+}
+//=================================================================================================//
+LevelSetShape *LevelSetShape::writeLevelSetCache()
+{
+    if (cache_file_name_.empty() || is_restored_from_cache_)
+        return this;
+
+    fs::path cache_folder = fs::path(cache_file_name_).parent_path();
+    if (!fs::exists(cache_folder))
+    {
+        fs::create_directory(cache_folder);
+    }
+    std::ofstream cache_file(cache_file_name_, std::ios::binary | std::ios::trunc);
+    level_set_.writeToCache(cache_file);
+    return this;
+}
+//=================================================================================================//
 LevelSetShape *LevelSetShape::writeLevelSet(SPHSystem &sph_system)
 {
     MeshRecordingToPlt write_level_set_to_plt(sph_system, level_set_);
@@ -57,12 +111,30 @@ LevelSetShape *LevelSetShape::writeBKGMesh(SPHSystem &sph_system)
 //=================================================================================================//
 LevelSetShape *LevelSetShape::cleanLevelSet(UnsignedInt repeat_times)
 {
+    if (is_restored_from_cache_)
+        return this;
+
+    ScopedStartupPhase startup_phase("LevelSetCleanInterface", getName());
     level_set_.cleanInterface(repeat_times);
     return this;
 }
 //=================================================================================================//
+LevelSetShape *LevelSetShape::cleanLevelSetByFastSweeping(UnsignedInt repeat_times)
+{
+    if (is_restored_from_cache_)
+        return this;
+
+    ScopedStartupPhase startup_phase("LevelSetCleanInterface", getName());
+    level_set_.cleanInterfaceByFastSweeping(repeat_times);
+    return this;
+}
+//=================================================================================================//
 LevelSetShape *LevelSetShape::correctLevelSetSign()
 {
+    if (is_restored_from_cache_)
+        return this;
+
+    ScopedStartupPhase startup_phase("LevelSetCorrectSign", getName());
     level_set_.correctTopology();
     return this;
 }
@@ -79,6 +151,11 @@ Vecd LevelSetShape::findClosestPoint(const Vecd &probe_point)
     return probe_point - phi * normal;
 }
 //=================================================================================================//
+Real LevelSetShape::findSignedDistance(const Vecd &probe_point)
+{
+    return level_set_.probeSignedDistance(probe_point);
+}
+//=================================================================================================//
 BoundingBoxd LevelSetShape::findBounds()
 {
     if (!is_bounds_found_)
@@ -31,6 +31,7 @@
 
 #include "base_geometry.h"
 #include "level_set.hpp"
+#include "startup_profiler.h"
 
 #include <string>
 
@@ -47,6 +48,8 @@ class LevelSetShape : public Shape
   private:
     UniquePtrKeeper<LevelSet> level_set_keeper_;
     SharedPtr<SPHAdaptation> sph_adaptation_;
+    std::string cache_file_name_;        /**< empty if the level set is not cached. */
+    bool is_restored_from_cache_ = false; /**< the corrections are already applied to cached level sets. */
 
   public:
     /** refinement_ratio is between body reference resolution and level set resolution */
@@ -75,23 +78,31 @@ class LevelSetShape : public Shape
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual Real findSignedDistance(const Vecd &probe_point) override;
     virtual BoundingBoxd findBounds() override;
 
     template <class ExecutionPolicy>
     void finishInitialization(const ExecutionPolicy &ex_policy, UsageType usage_type)
     {
+        ScopedStartupPhase startup_phase("LevelSetFinishInitialization", getName());
         level_set_.finishInitialization(ex_policy, usage_type);
     };
     Vecd findLevelSetGradient(const Vecd &probe_point);
+    /** rigidly move the shape without rebuilding the level set, note that the bounds are not moved. */
+    void setTransform(const Transform &transform) { level_set_.setTransform(transform); };
     Real computeKernelIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
     Vecd computeKernelGradientIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
     Matd computeKernelSecondGradientIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
     /** small_shift_factor = 1.0 by default, can be increased for difficult geometries for smoothing */
     LevelSetShape *cleanLevelSet(UnsignedInt repeat_times = 1);
+    LevelSetShape *cleanLevelSetByFastSweeping(UnsignedInt repeat_times = 1);
     /** required to build level set from triangular mesh in stl file format. */
     LevelSetShape *correctLevelSetSign();
     LevelSetShape *writeLevelSet(SPHSystem &sph_system);
     LevelSetShape *writeBKGMesh(SPHSystem &sph_system);
+    /** write the level set to the cache, which is used to skip the construction in later runs. */
+    LevelSetShape *writeLevelSetCache();
+    bool isRestoredFromCache() { return is_restored_from_cache_; };
     LevelSet &getLevelSet() { return level_set_; }
 
     template <typename DataType>
@@ -112,6 +123,7 @@ class LevelSetShape : public Shape
     LevelSetShape(BoundingBoxd bounding_box, Shape &shape,
                   SharedPtr<SPHAdaptation> sph_adaptation, Real refinement_ratio);
     LevelSetShape(BoundingBoxd bounding_box, SPHBody &sph_body, Shape &shape, Real refinement_ratio);
+    UniquePtr<LevelSet> createLevelSet(SPHBody &sph_body, Shape &shape, Real refinement_ratio);
     LevelSet &level_set_; /**< narrow bounded level set mesh. */
 };
 } // namespace SPH
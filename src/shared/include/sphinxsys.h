@@ -37,6 +37,7 @@
 #include "sphinxsys_constant_sycl.hpp"
 #include "sphinxsys_variable_array_sycl.hpp"
 #include "sphinxsys_variable_sycl.hpp"
+#include "step_graph_sycl.h"
 #endif // SPHINXSYS_USE_SYCL
 
 #include "all_bodies.h"
@@ -50,9 +51,12 @@
 #include "all_physical_dynamics.h"
 #include "all_regression_test_methods.h"
 #include "all_simbody.h"
+#include "ensemble_runner.h"
+#include "load_balanced_repartition.h"
 #include "parameterization.h"
 #include "particle_method_container.h"
 #include "sph_solver.h"
 #include "sph_system.hpp"
+#include "subdomain_exchange.h"
 
 #endif // SPHINXSYS_H
@@ -32,6 +32,8 @@
 
 #include "io_base.h"
 #include "io_base_ck.h"
+#include "io_coupling.h"
+#include "io_in_situ.h"
 #include "io_log.h"
 #include "io_observation.h"
 #include "io_observation_ck.h"
@@ -40,5 +42,6 @@
 #include "io_vtk.h"
 #include "io_vtk_mesh.h"
 #include "io_vtk_mesh_ck.h"
+#include "io_xdmf.h"
 
 #endif // ALL_IO_H
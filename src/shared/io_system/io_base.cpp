@@ -49,9 +49,10 @@ void BodyStatesRecording::writeToFile(size_t iteration_step)
     writeWithFileName(padValueWithZeros(iteration_step));
 };
 //=============================================================================================//
-RestartIO::RestartIO(SPHSystem &sph_system)
+RestartIO::RestartIO(SPHSystem &sph_system, bool binary_format)
     : BaseIO(sph_system), bodies_(sph_system.getSPHBodies()),
-      overall_file_path_(io_environment_.RestartFolder() + "/Restart_time_")
+      overall_file_path_(io_environment_.RestartFolder() + "/Restart_time_"),
+      binary_format_(binary_format)
 {
     if (sph_system_.RestartStep() == 0)
     {
@@ -60,12 +61,26 @@ RestartIO::RestartIO(SPHSystem &sph_system)
 
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        file_names_.push_back(io_environment_.RestartFolder() + "/" + bodies_[i]->getName() + "_rst_");
+        file_names_.push_back(restartFilePrefix(bodies_[i]->getName()));
     }
 }
 //=============================================================================================//
+std::string RestartIO::restartFilePrefix(const std::string &name)
+{
+    return io_environment_.RestartFolder() + "/" + name + "_rst_";
+}
+//=============================================================================================//
 void RestartIO::writeToFile(size_t iteration_step)
 {
+    bool is_full_snapshot = full_snapshot_interval_ == 0 || full_snapshot_checksums_.empty() ||
+                            ++deltas_since_full_snapshot_ == full_snapshot_interval_;
+    if (full_snapshot_interval_ != 0 && is_full_snapshot)
+    {
+        full_snapshot_checksums_.resize(bodies_.size());
+        full_snapshot_step_ = iteration_step;
+        deltas_since_full_snapshot_ = 0;
+    }
+
     std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(iteration_step) + ".dat";
     if (fs::exists(overall_filefullpath))
     {
@@ -73,19 +88,38 @@ void RestartIO::writeToFile(size_t iteration_step)
     }
     std::ofstream out_file(overall_filefullpath.c_str(), std::ios::app);
     out_file << std::fixed << std::setprecision(9) << sv_physical_time_->getValue() << "   \n";
-    out_file.close();
 
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) + ".xml";
+        BaseParticles &base_particles = bodies_[i]->getBaseParticles();
+        if (full_snapshot_interval_ != 0)
+        {
+            uint64_t checksum = base_particles.evolvingVariablesChecksum();
+            if (is_full_snapshot)
+            {
+                full_snapshot_checksums_[i] = checksum;
+            }
+            else if (checksum == full_snapshot_checksums_[i])
+            {
+                out_file << bodies_[i]->getName() << " " << full_snapshot_step_ << "\n";
+                continue;
+            }
+        }
 
+        std::string filefullpath = bodyFileName(i, iteration_step);
         if (fs::exists(filefullpath))
         {
             fs::remove(filefullpath);
         }
-        BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-        base_particles.writeParticlesToXmlForRestart(filefullpath);
+        binary_format_ ? writeParticlesToBinary(base_particles, filefullpath)
+                       : base_particles.writeParticlesToXmlForRestart(filefullpath);
     }
+    out_file.close();
+}
+//=============================================================================================//
+std::string RestartIO::bodyFileName(size_t body_index, size_t step)
+{
+    return file_names_[body_index] + padValueWithZeros(step) + (binary_format_ ? ".bin" : ".xml");
 }
 //=============================================================================================//
 Real RestartIO::readRestartTime(size_t restart_step)
@@ -105,12 +139,31 @@ Real RestartIO::readRestartTime(size_t restart_step)
     return restart_time;
 }
 //=============================================================================================//
+std::map<std::string, size_t> RestartIO::readSnapshotSteps(size_t restart_step)
+{
+    std::map<std::string, size_t> snapshot_steps;
+    std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(restart_step) + ".dat";
+    std::ifstream in_file(overall_filefullpath.c_str());
+    Real restart_time;
+    in_file >> restart_time;
+    std::string body_name;
+    size_t snapshot_step;
+    while (in_file >> body_name >> snapshot_step)
+    {
+        snapshot_steps[body_name] = snapshot_step;
+    }
+    return snapshot_steps;
+}
+//=============================================================================================//
 void RestartIO::readFromFile(size_t restart_step)
 {
     std::cout << "\n Reading restart files from the restart step = " << restart_step << std::endl;
+    std::map<std::string, size_t> snapshot_steps = readSnapshotSteps(restart_step);
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(restart_step) + ".xml";
+        auto snapshot = snapshot_steps.find(bodies_[i]->getName());
+        size_t step = snapshot != snapshot_steps.end() ? snapshot->second : restart_step;
+        std::string filefullpath = bodyFileName(i, step);
 
         if (!fs::exists(filefullpath))
         {
@@ -119,7 +172,8 @@ void RestartIO::readFromFile(size_t restart_step)
             exit(1);
         }
         BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-        base_particles.readParticlesFromXmlForRestart(filefullpath);
+        binary_format_ ? readParticlesFromBinary(base_particles, filefullpath)
+                       : base_particles.readParticlesFromXmlForRestart(filefullpath);
     }
 }
 //=============================================================================================//
@@ -128,7 +182,7 @@ ReloadParticleIO::ReloadParticleIO(SPHBodyVector bodies)
 {
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        file_names_.push_back(io_environment_.ReloadFolder() + "/" + bodies_[i]->getName() + "_rld.xml");
+        file_names_.push_back(io_environment_.ReloadFolder() + "/" + bodies_[i]->getName() + "_rld");
     }
 }
 //=============================================================================================//
@@ -138,7 +192,7 @@ ReloadParticleIO::ReloadParticleIO(SPHSystem &sph_system)
 ReloadParticleIO::ReloadParticleIO(SPHBody &sph_body, const std::string &given_body_name)
     : BaseIO(sph_body.getSPHSystem()), bodies_({&sph_body})
 {
-    file_names_.push_back(io_environment_.ReloadFolder() + "/" + given_body_name + "_rld.xml");
+    file_names_.push_back(io_environment_.ReloadFolder() + "/" + given_body_name + "_rld");
 }
 //=============================================================================================//
 ReloadParticleIO::ReloadParticleIO(SPHBody &sph_body)
@@ -148,14 +202,18 @@ void ReloadParticleIO::writeToFile(size_t iteration_step)
 {
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        std::string filefullpath = file_names_[i];
-
-        if (fs::exists(filefullpath))
+        // remove the files in both formats so that no outdated file is reloaded
+        for (const std::string extension : {".xml", ".bin"})
         {
-            fs::remove(filefullpath);
+            if (fs::exists(file_names_[i] + extension))
+            {
+                fs::remove(file_names_[i] + extension);
+            }
         }
+        std::string filefullpath = file_names_[i] + (binary_format_ ? ".bin" : ".xml");
         BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-        base_particles.writeParticlesToXmlForReload(filefullpath);
+        binary_format_ ? base_particles.writeParticlesToBinaryForReload(filefullpath)
+                       : base_particles.writeParticlesToXmlForReload(filefullpath);
     }
 }
 //=============================================================================================//
@@ -39,6 +39,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <map>
 #include <sstream>
 namespace fs = std::filesystem;
 
@@ -143,7 +144,11 @@ class BodyStatesRecording : public BaseIO
 
 /**
  * @class RestartIO
- * @brief Write and read the restart files in XML format.
+ * @brief Write and read the restart files in XML format,
+ * or in raw binary blocks with checksums for large particle numbers.
+ * With delta checkpoints, a full snapshot is written once per interval and
+ * the bodies whose restart data are unchanged since the last full snapshot,
+ * detected by checksums, are not written again but refer to that snapshot.
  */
 class RestartIO : public BaseIO
 {
@@ -151,12 +156,35 @@ class RestartIO : public BaseIO
     SPHBodyVector bodies_;
     std::string overall_file_path_;
     StdVec<std::string> file_names_;
+    bool binary_format_;
+    size_t full_snapshot_interval_ = 0; /**< zero for full snapshots only */
+    size_t deltas_since_full_snapshot_ = 0;
+    size_t full_snapshot_step_ = 0;
+    StdVec<uint64_t> full_snapshot_checksums_;
 
     Real readRestartTime(size_t restart_step);
+    std::string restartFilePrefix(const std::string &name);
+    std::string bodyFileName(size_t body_index, size_t step);
+    /** the steps of the files of the bodies, which are not written with the given restart step. */
+    std::map<std::string, size_t> readSnapshotSteps(size_t restart_step);
+    /** Binary restart file of a body, streamed from and to the data of the execution policy in derived classes. */
+    virtual void writeParticlesToBinary(BaseParticles &base_particles, const std::string &filefullpath)
+    {
+        base_particles.writeParticlesToBinaryForRestart(filefullpath);
+    };
+    virtual void readParticlesFromBinary(BaseParticles &base_particles, const std::string &filefullpath)
+    {
+        base_particles.readParticlesFromBinaryForRestart(filefullpath);
+    };
 
   public:
-    RestartIO(SPHSystem &sph_system);
+    RestartIO(SPHSystem &sph_system, bool binary_format = false);
     virtual ~RestartIO() {};
+    RestartIO &useDeltaCheckpoints(size_t full_snapshot_interval)
+    {
+        full_snapshot_interval_ = full_snapshot_interval;
+        return *this;
+    };
 
     virtual void writeToFile(size_t iteration_step = 0) override;
     virtual void readFromFile(size_t iteration_step = 0);
@@ -170,13 +198,16 @@ class RestartIO : public BaseIO
 
 /**
  * @class ReloadParticleIO
- * @brief Write and read the particle-reloading files in XML format.
+ * @brief Write and read the particle-reloading files in XML format,
+ * or in raw binary blocks with checksums for large particle numbers.
+ * The reading particle generator detects the format.
  */
 class ReloadParticleIO : public BaseIO
 {
   protected:
     SPHBodyVector bodies_;
     StdVec<std::string> file_names_;
+    bool binary_format_ = false;
 
   public:
     ReloadParticleIO(SPHSystem &sph_system);
@@ -184,6 +215,11 @@ class ReloadParticleIO : public BaseIO
     ReloadParticleIO(SPHBody &sph_body);
     ReloadParticleIO(SPHBody &sph_body, const std::string &given_body_name);
     virtual ~ReloadParticleIO() {};
+    ReloadParticleIO &useBinaryFormat(bool binary_format = true)
+    {
+        binary_format_ = binary_format;
+        return *this;
+    };
 
     template <typename DataType>
     void addToReload(SPHBody &sph_body, const std::string &name)
@@ -0,0 +1,97 @@
+#include "io_coupling.h"
+
+#include "base_particles.hpp"
+#include "particle_iterators.h"
+
+namespace SPH
+{
+//=============================================================================================//
+SurfaceCouplingAdapter::SurfaceCouplingAdapter(
+    BodyPartByParticle &surface, CouplingPartner &partner, const std::string &force_name)
+    : surface_(surface), partner_(partner), particles_(surface.getBaseParticles()),
+      pos_(particles_.getVariableDataByName<Vecd>("Position")),
+      force_(particles_.getVariableDataByName<Vecd>(force_name)),
+      vel_(particles_.getVariableDataByName<Vecd>("Velocity")),
+      is_in_flight_(false) {}
+//=================================================================================================//
+void SurfaceCouplingAdapter::initialize()
+{
+    gatherToBuffers();
+    partner_.initialize(surface_.getName(), NumberOfVertices(), pos_buffer_.data());
+}
+//=================================================================================================//
+void SurfaceCouplingAdapter::exchange(Real physical_time)
+{
+    waitForExchange();
+    size_t number_of_vertices = NumberOfVertices();
+    if (surface_.isContiguous())
+    {
+        partner_.exchange(physical_time, number_of_vertices, pos_, force_, vel_);
+    }
+    else
+    {
+        gatherToBuffers();
+        partner_.exchange(physical_time, number_of_vertices,
+                          pos_buffer_.data(), force_buffer_.data(), vel_buffer_.data());
+        scatterVelocities();
+    }
+}
+//=================================================================================================//
+void SurfaceCouplingAdapter::startExchange(Real physical_time)
+{
+    waitForExchange();
+    gatherToBuffers();
+    is_in_flight_ = true;
+    size_t number_of_vertices = NumberOfVertices();
+    exchange_task_.run(
+        [this, physical_time, number_of_vertices]()
+        {
+            partner_.exchange(physical_time, number_of_vertices,
+                              pos_buffer_.data(), force_buffer_.data(), vel_buffer_.data());
+        });
+}
+//=================================================================================================//
+void SurfaceCouplingAdapter::finishExchange()
+{
+    if (is_in_flight_)
+    {
+        waitForExchange();
+        scatterVelocities();
+    }
+}
+//=================================================================================================//
+void SurfaceCouplingAdapter::waitForExchange()
+{
+    if (is_in_flight_)
+    {
+        exchange_task_.wait();
+        is_in_flight_ = false;
+    }
+}
+//=================================================================================================//
+void SurfaceCouplingAdapter::gatherToBuffers()
+{
+    size_t number_of_vertices = NumberOfVertices();
+    UnsignedInt *particle_list = surface_.dvParticleList()->Data();
+    pos_buffer_.resize(number_of_vertices);
+    force_buffer_.resize(number_of_vertices);
+    vel_buffer_.resize(number_of_vertices);
+    particle_for(execution::ParallelPolicy(), IndexRange(0, number_of_vertices),
+                 [&](size_t i)
+                 {
+                     UnsignedInt index_i = particle_list[i];
+                     pos_buffer_[i] = pos_[index_i];
+                     force_buffer_[i] = force_[index_i];
+                     vel_buffer_[i] = vel_[index_i];
+                 });
+}
+//=================================================================================================//
+void SurfaceCouplingAdapter::scatterVelocities()
+{
+    UnsignedInt *particle_list = surface_.dvParticleList()->Data();
+    particle_for(execution::ParallelPolicy(), IndexRange(0, NumberOfVertices()),
+                 [&](size_t i)
+                 { vel_[particle_list[i]] = vel_buffer_[i]; });
+}
+//=================================================================================================//
+} // namespace SPH
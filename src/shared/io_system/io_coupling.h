@@ -0,0 +1,98 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_coupling.h
+ * @brief 	Classes for coupling a surface of a body with an external partner solver,
+ *          such as a FEM structural solver through a preCICE participant, without files.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_COUPLING_H
+#define IO_COUPLING_H
+
+#include "base_body_part.h"
+
+#include <tbb/task_group.h>
+
+namespace SPH
+{
+/**
+ * @class CouplingPartner
+ * @brief Interface of an external solver coupled at the surface particles of a body.
+ * The arrays are contiguous in the order of the surface particles and are only valid during the call.
+ * All functions are called from one thread at a time, but not necessarily the main thread.
+ */
+class CouplingPartner
+{
+  public:
+    CouplingPartner() {};
+    virtual ~CouplingPartner() {};
+
+    /** called once with the initial positions, e.g. to set the mesh vertices of the interface */
+    virtual void initialize(const std::string &interface_name, size_t number_of_vertices,
+                            const Vecd *positions) {};
+    /** send the positions and forces of a coupling step and receive the velocities of the surface */
+    virtual void exchange(Real physical_time, size_t number_of_vertices, const Vecd *positions,
+                          const Vecd *forces, Vecd *velocities) = 0;
+};
+
+/**
+ * @class SurfaceCouplingAdapter
+ * @brief Exchange the positions, forces and velocities of the particles of a surface body part
+ * with a coupling partner at each coupling step.
+ * @details For a contiguous body part, see ParticleSortCK::setContiguousBodyPart,
+ * the blocking exchange hands over the particle data directly, otherwise they are gathered to the buffers.
+ * The non-blocking exchange always uses buffers, so that the body can be advanced
+ * between startExchange and finishExchange, after which the received velocities are imposed.
+ * The host data are exchanged, so that they should be synchronized before and after for device execution.
+ */
+class SurfaceCouplingAdapter
+{
+  public:
+    SurfaceCouplingAdapter(BodyPartByParticle &surface, CouplingPartner &partner, const std::string &force_name);
+    virtual ~SurfaceCouplingAdapter() { waitForExchange(); };
+    void initialize();
+    /** Exchange and impose the received velocities before returning. */
+    void exchange(Real physical_time);
+    /** Gather the data and run the exchange on a separate task. */
+    void startExchange(Real physical_time);
+    /** Wait for the exchange started before and impose the received velocities. */
+    void finishExchange();
+    bool isExchangeInFlight() { return is_in_flight_; };
+
+  protected:
+    BodyPartByParticle &surface_;
+    CouplingPartner &partner_;
+    BaseParticles &particles_;
+    Vecd *pos_, *force_, *vel_;
+    StdVec<Vecd> pos_buffer_, force_buffer_, vel_buffer_;
+    tbb::task_group exchange_task_;
+    bool is_in_flight_;
+
+    size_t NumberOfVertices() { return surface_.svRangeSize()->getValue(); };
+    void gatherToBuffers();
+    void scatterVelocities();
+    void waitForExchange();
+};
+} // namespace SPH
+#endif // IO_COUPLING_H
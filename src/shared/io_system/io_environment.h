@@ -64,6 +64,7 @@ class IOEnvironment
     std::string OutputFolder() const { return output_folder_; }
     std::string RestartFolder() const { return restart_folder_; }
     std::string ReloadFolder() const { return reload_folder_; }
+    std::string LevelSetCacheFolder() const { return level_set_cache_folder_; }
 
   protected:
     SPHSystem &sph_system_;
@@ -71,6 +72,7 @@ class IOEnvironment
     std::string output_folder_;
     std::string restart_folder_;
     std::string reload_folder_;
+    std::string level_set_cache_folder_; /**< kept separately, as the reload folder is reinitialized for relaxation. */
 };
 } // namespace SPH
 #endif // IO_ENVIRONMENT_H
@@ -0,0 +1,23 @@
+#include "io_in_situ.h"
+
+namespace SPH
+{
+//=============================================================================================//
+void BodyStatesInSituProcessing::writeWithFileName(const std::string &sequence)
+{
+    Real physical_time = sv_physical_time_->getValue();
+    for (SPHBody *body : bodies_)
+    {
+        if (body->checkNewlyUpdated() && state_recording_)
+        {
+            BaseParticles &base_particles = body->getBaseParticles();
+            in_situ_adaptor_.execute(body->getName(), physical_time, sequence,
+                                     base_particles.TotalRealParticles(),
+                                     base_particles.ParticlePositions(), base_particles.VariablesToWrite());
+        }
+        body->setNotNewlyUpdated();
+    }
+    in_situ_adaptor_.finalizeOutput(physical_time, sequence);
+}
+//=================================================================================================//
+} // namespace SPH
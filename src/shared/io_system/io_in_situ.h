@@ -0,0 +1,74 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_in_situ.h
+ * @brief 	Classes for handing the body states to in-situ processing,
+ *          such as a ParaView Catalyst or ADIOS2 adaptor, instead of writing files.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_IN_SITU_H
+#define IO_IN_SITU_H
+
+#include "io_base.h"
+
+namespace SPH
+{
+/**
+ * @class InSituAdaptor
+ * @brief Interface of an in-situ pipeline receiving the body states.
+ * The position and variable arrays are those of the particles, not copies,
+ * and are only valid during the call.
+ */
+class InSituAdaptor
+{
+  public:
+    InSituAdaptor() {};
+    virtual ~InSituAdaptor() {};
+
+    virtual void execute(const std::string &body_name, Real physical_time, const std::string &sequence,
+                         size_t total_real_particles, Vecd *positions, ParticleVariables &variables_to_write) = 0;
+    /** called after all bodies of an output have been handed over */
+    virtual void finalizeOutput(Real physical_time, const std::string &sequence) {};
+};
+
+/**
+ * @class BodyStatesInSituProcessing
+ * @brief Hand the positions and the variables to write of the bodies
+ * to an in-situ adaptor at each record call.
+ */
+class BodyStatesInSituProcessing : public BodyStatesRecording
+{
+  public:
+    BodyStatesInSituProcessing(SPHBody &body, InSituAdaptor &in_situ_adaptor)
+        : BodyStatesRecording(body), in_situ_adaptor_(in_situ_adaptor) {};
+    BodyStatesInSituProcessing(SPHSystem &sph_system, InSituAdaptor &in_situ_adaptor)
+        : BodyStatesRecording(sph_system), in_situ_adaptor_(in_situ_adaptor) {};
+    virtual ~BodyStatesInSituProcessing() {};
+
+  protected:
+    InSituAdaptor &in_situ_adaptor_;
+    virtual void writeWithFileName(const std::string &sequence) override;
+};
+} // namespace SPH
+#endif // IO_IN_SITU_H
@@ -12,7 +12,8 @@ BaseQuantityRecording::BaseQuantityRecording(SPHSystem &sph_system,
       quantity_name_("NeedAQuantityName"),
       dynamics_identifier_name_(dynamics_identifier_name),
       filefullpath_output_(io_environment_.OutputFolder() + "/" +
-                           dynamics_identifier_name_ + "_" + "NeedAQuantityName" + ".dat") {}
+                           dynamics_identifier_name_ + "_" + "NeedAQuantityName" + ".dat"),
+      buffered_records_(0), flush_interval_(100) {}
 //=================================================================================================//
 void BaseQuantityRecording::setFullPath(const std::string &quantity_name)
 {
@@ -21,4 +22,26 @@ void BaseQuantityRecording::setFullPath(const std::string &quantity_name)
                            dynamics_identifier_name_ + "_" + quantity_name + ".dat";
 }
 //=================================================================================================//
+void BaseQuantityRecording::flushRecords()
+{
+    if (buffered_records_ != 0)
+    {
+        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
+        out_file << record_buffer_.str();
+        out_file.close();
+        record_buffer_.str(std::string());
+        record_buffer_.clear();
+        buffered_records_ = 0;
+    }
+}
+//=================================================================================================//
+void BaseQuantityRecording::finishRecord()
+{
+    buffered_records_++;
+    if (buffered_records_ >= flush_interval_)
+    {
+        flushRecords();
+    }
+}
+//=================================================================================================//
 } // namespace SPH
@@ -32,21 +32,37 @@
 #include "general_interpolation.h"
 #include "io_plt.hpp"
 
+#include <sstream>
+
 namespace SPH
 {
 
+/**
+ * @class BaseQuantityRecording
+ * @brief The records are kept in a memory buffer and appended to the file
+ * once every flush interval, and at destruction, so that the file is not
+ * reopened at every output step.
+ */
 class BaseQuantityRecording : public BaseIO
 {
   public:
     BaseQuantityRecording(SPHSystem &sph_system,
                           const std::string &dynamics_identifier_name);
+    virtual ~BaseQuantityRecording() { flushRecords(); };
     void setFullPath(const std::string &quantity_name);
+    void setFlushInterval(size_t flush_interval) { flush_interval_ = SMAX(flush_interval, size_t(1)); };
+    void flushRecords();
 
   protected:
     PltEngine plt_engine_;
     std::string quantity_name_;
     std::string dynamics_identifier_name_;
     std::string filefullpath_output_;
+    std::ostringstream record_buffer_;
+    size_t buffered_records_;
+    size_t flush_interval_;
+    /** To be called after a record line is written into the buffer. */
+    void finishRecord();
 };
 
 template <typename...>
@@ -91,16 +107,15 @@ class ObservedQuantityRecording<DataType> : public BaseQuantityRecording
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_->getValue() << "   ";
+        record_buffer_ << sv_physical_time_->getValue() << "   ";
         observation_method_.exec();
         DataType *interpolated_quantities = getObservedQuantity();
         for (size_t i = 0; i != number_of_observe_; ++i)
         {
-            plt_engine_.writeAQuantity(out_file, interpolated_quantities[i]);
+            plt_engine_.writeAQuantity(record_buffer_, interpolated_quantities[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        record_buffer_ << "\n";
+        finishRecord();
     };
 
     DataType *getObservedQuantity()
@@ -151,12 +166,11 @@ class ReducedQuantityRecording<LocalReduceMethodType> : public BaseQuantityRecor
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_->getValue() << "   ";
+        record_buffer_ << sv_physical_time_->getValue() << "   ";
         reduced_quantity_ = reduce_method_.exec();
-        plt_engine_.writeAQuantity(out_file, reduced_quantity_);
-        out_file << "\n";
-        out_file.close();
+        plt_engine_.writeAQuantity(record_buffer_, reduced_quantity_);
+        record_buffer_ << "\n";
+        finishRecord();
     };
 
     VariableType *getObservedQuantity()
@@ -197,11 +211,10 @@ class SingularVariableRecording : public BaseQuantityRecording
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_->getValue() << "   ";
-        plt_engine_.writeAQuantity(out_file, variable_->getValue());
-        out_file << "\n";
-        out_file.close();
+        record_buffer_ << sv_physical_time_->getValue() << "   ";
+        plt_engine_.writeAQuantity(record_buffer_, variable_->getValue());
+        record_buffer_ << "\n";
+        finishRecord();
     };
 };
 } // namespace SPH
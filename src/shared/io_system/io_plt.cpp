@@ -7,13 +7,13 @@ namespace SPH
 {
 //=============================================================================================//
 void PltEngine::writeAQuantityHeader(
-    std::ofstream &out_file, const Real &quantity, const std::string &quantity_name)
+    std::ostream &out_file, const Real &quantity, const std::string &quantity_name)
 {
     out_file << "\"" << quantity_name << "\"" << "   ";
 }
 //=============================================================================================//
 void PltEngine::writeAQuantityHeader(
-    std::ofstream &out_file, const SimTK::SpatialVec &quantity, const std::string &quantity_name)
+    std::ostream &out_file, const SimTK::SpatialVec &quantity, const std::string &quantity_name)
 {
     std::string torque = quantity_name + "Torque";
     for (int i = 0; i != 3; ++i)
@@ -24,12 +24,12 @@ void PltEngine::writeAQuantityHeader(
         out_file << "\"" << force << "[" << i << "]\"" << "   ";
 }
 //=============================================================================================//
-void PltEngine::writeAQuantity(std::ofstream &out_file, const Real &quantity)
+void PltEngine::writeAQuantity(std::ostream &out_file, const Real &quantity)
 {
     out_file << std::fixed << std::setprecision(9) << quantity << "   ";
 }
 //=============================================================================================//
-void PltEngine::writeAQuantity(std::ofstream &out_file, const SimTK::SpatialVec &quantity)
+void PltEngine::writeAQuantity(std::ostream &out_file, const SimTK::SpatialVec &quantity)
 {
     for (int i = 0; i < 3; ++i)
         out_file << std::fixed << std::setprecision(9) << quantity[0][i] << "   ";
@@ -49,6 +49,12 @@ void BodyStatesRecordingToPlt::writePltFileHeader(
         output_file << ",\"" << variable->Name() << "\"";
     };
 
+    constexpr int type_index_uint8 = DataTypeIndex<uint8_t>::value;
+    for (DiscreteVariable<uint8_t> *variable : std::get<type_index_uint8>(variables_to_write))
+    {
+        output_file << ",\"" << variable->Name() << "\"";
+    };
+
     constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
     for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
     {
@@ -80,6 +86,13 @@ void BodyStatesRecordingToPlt::writePltFileParticleData(
         output_file << data_field[index] << " ";
     };
 
+    constexpr int type_index_uint8 = DataTypeIndex<uint8_t>::value;
+    for (DiscreteVariable<uint8_t> *variable : std::get<type_index_uint8>(variables_to_write))
+    {
+        uint8_t *data_field = variable->Data();
+        output_file << int(data_field[index]) << " ";
+    };
+
     constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
     for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
     {
@@ -96,6 +109,163 @@ void BodyStatesRecordingToPlt::writePltFileParticleData(
     };
 }
 //=============================================================================================//
+StdVec<BodyStatesRecordingToPlt::PltColumn> BodyStatesRecordingToPlt::
+    getPltColumns(ParticleVariables &variables_to_write, Vecd *position)
+{
+    // the same variables in the same order as the ascii file
+    StdVec<PltColumn> columns;
+    std::string axis_names[3] = {"x", "y", "z"};
+    for (int k = 0; k != 3; ++k)
+    {
+        columns.push_back({axis_names[k], false, [=](size_t i)
+                           { return double(upgradeToVec3d(position[i])[k]); }});
+    }
+    columns.push_back({"ID", true, [](size_t i)
+                       { return double(i); }});
+
+    constexpr int type_index_int = DataTypeIndex<int>::value;
+    for (DiscreteVariable<int> *variable : std::get<type_index_int>(variables_to_write))
+    {
+        int *data_field = variable->Data();
+        columns.push_back({variable->Name(), true, [=](size_t i)
+                           { return double(data_field[i]); }});
+    };
+
+    constexpr int type_index_uint8 = DataTypeIndex<uint8_t>::value;
+    for (DiscreteVariable<uint8_t> *variable : std::get<type_index_uint8>(variables_to_write))
+    {
+        uint8_t *data_field = variable->Data();
+        columns.push_back({variable->Name(), true, [=](size_t i)
+                           { return double(data_field[i]); }});
+    };
+
+    constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+    for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
+    {
+        Vecd *data_field = variable->Data();
+        for (int k = 0; k != 3; ++k)
+        {
+            columns.push_back({variable->Name() + "_" + axis_names[k], false, [=](size_t i)
+                               { return double(upgradeToVec3d(data_field[i])[k]); }});
+        }
+    };
+
+    constexpr int type_index_Real = DataTypeIndex<Real>::value;
+    for (DiscreteVariable<Real> *variable : std::get<type_index_Real>(variables_to_write))
+    {
+        Real *data_field = variable->Data();
+        columns.push_back({variable->Name(), false, [=](size_t i)
+                           { return double(data_field[i]); }});
+    };
+    return columns;
+}
+//=============================================================================================//
+void BodyStatesRecordingToPlt::writeBinaryPltString(std::ofstream &output_file, const std::string &text)
+{
+    // each character as a 32-bit integer, terminated by zero
+    for (char character : text)
+    {
+        int32_t value = character;
+        output_file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+    int32_t terminator = 0;
+    output_file.write(reinterpret_cast<const char *>(&terminator), sizeof(terminator));
+}
+//=============================================================================================//
+void BodyStatesRecordingToPlt::writeBinaryPltFile(std::ofstream &output_file, const std::string &zone_name,
+                                                  ParticleVariables &variables_to_write, Vecd *position,
+                                                  size_t total_real_particles)
+{
+    StdVec<PltColumn> columns = getPltColumns(variables_to_write, position);
+    auto write_int32 = [&](int32_t value)
+    { output_file.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+    auto write_float32 = [&](float value)
+    { output_file.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+    auto write_float64 = [&](double value)
+    { output_file.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+
+    // header section
+    output_file.write("#!TDV112", 8);
+    write_int32(1); // byte order
+    write_int32(0); // full file type
+    writeBinaryPltString(output_file, "SPHBody_" + zone_name);
+    write_int32(int32_t(columns.size()));
+    for (const PltColumn &column : columns)
+    {
+        writeBinaryPltString(output_file, column.name_);
+    }
+    write_float32(299.0f); // zone marker
+    writeBinaryPltString(output_file, zone_name);
+    write_int32(-1);                              // parent zone
+    write_int32(-1);                              // strand id
+    write_float64(sv_physical_time_->getValue()); // solution time
+    write_int32(-1);                              // zone color
+    write_int32(0);                               // ordered zone
+    write_int32(0);                               // all variables at nodes
+    write_int32(0);                               // no face neighbors supplied
+    write_int32(0);                               // no user-defined face neighbor connections
+    write_int32(int32_t(total_real_particles));   // IMax
+    write_int32(1);                               // JMax
+    write_int32(1);                               // KMax
+    write_int32(0);                               // no auxiliary data
+    write_float32(357.0f);                        // end of header
+
+    // data section, the value range of each variable precedes the blocks
+    write_float32(299.0f);
+    for (const PltColumn &column : columns)
+    {
+        write_int32(column.is_integer_ ? 3 : 1); // 32-bit integer or float
+    }
+    write_int32(0);  // no passive variables
+    write_int32(0);  // no variable sharing
+    write_int32(-1); // no connectivity sharing
+    for (const PltColumn &column : columns)
+    {
+        std::pair<double, double> range = parallel_reduce(
+            IndexRange(0, total_real_particles), std::make_pair(double(MaxReal), -double(MaxReal)),
+            [&](const IndexRange &r, std::pair<double, double> local_range)
+            {
+                for (size_t i = r.begin(); i != r.end(); ++i)
+                {
+                    double value = column.value_(i);
+                    local_range = std::make_pair(SMIN(local_range.first, value), SMAX(local_range.second, value));
+                }
+                return local_range;
+            },
+            [](const std::pair<double, double> &a, const std::pair<double, double> &b)
+            { return std::make_pair(SMIN(a.first, b.first), SMAX(a.second, b.second)); });
+        write_float64(total_real_particles != 0 ? range.first : 0.0);
+        write_float64(total_real_particles != 0 ? range.second : 0.0);
+    }
+
+    // each block is filled in parallel, both data types have 4 bytes
+    StdVec<float> float_block(total_real_particles);
+    StdVec<int32_t> integer_block(total_real_particles);
+    for (const PltColumn &column : columns)
+    {
+        parallel_for(
+            IndexRange(0, total_real_particles),
+            [&](const IndexRange &r)
+            {
+                for (size_t i = r.begin(); i != r.end(); ++i)
+                {
+                    if (column.is_integer_)
+                    {
+                        integer_block[i] = int32_t(column.value_(i));
+                    }
+                    else
+                    {
+                        float_block[i] = float(column.value_(i));
+                    }
+                }
+            },
+            ap);
+        const char *block = column.is_integer_ ? reinterpret_cast<const char *>(integer_block.data())
+                                               : reinterpret_cast<const char *>(float_block.data());
+        output_file.write(block, total_real_particles * 4);
+    }
+}
+//=============================================================================================//
 void BodyStatesRecordingToPlt::writeWithFileName(const std::string &sequence)
 {
     for (SPHBody *body : bodies_)
@@ -112,17 +282,27 @@ void BodyStatesRecordingToPlt::writeWithFileName(const std::string &sequence)
                 {
                     fs::remove(filefullpath);
                 }
-                std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
-                writePltFileHeader(out_file, variables_to_write);
-                out_file << "\n";
-
                 Vecd *position = particles.ParticlePositions();
-                for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+                if (binary_format_)
                 {
-                    writePltFileParticleData(out_file, variables_to_write, position, i);
+                    std::ofstream out_file(filefullpath.c_str(), std::ios::binary | std::ios::trunc);
+                    writeBinaryPltFile(out_file, body->getName(), variables_to_write,
+                                       position, particles.TotalRealParticles());
+                    out_file.close();
+                }
+                else
+                {
+                    std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+                    writePltFileHeader(out_file, variables_to_write);
                     out_file << "\n";
-                };
-                out_file.close();
+
+                    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+                    {
+                        writePltFileParticleData(out_file, variables_to_write, position, i);
+                        out_file << "\n";
+                    };
+                    out_file.close();
+                }
             }
         }
         body->setNotNewlyUpdated();
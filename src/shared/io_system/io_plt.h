@@ -43,18 +43,18 @@ class PltEngine
     PltEngine() {};
     virtual ~PltEngine() {};
 
-    void writeAQuantityHeader(std::ofstream &out_file, const Real &quantity, const std::string &quantity_name);
+    void writeAQuantityHeader(std::ostream &out_file, const Real &quantity, const std::string &quantity_name);
     template <int N>
-    void writeAQuantityHeader(std::ofstream &out_file, const Eigen::Matrix<Real, N, 1> &quantity, const std::string &quantity_name);
+    void writeAQuantityHeader(std::ostream &out_file, const Eigen::Matrix<Real, N, 1> &quantity, const std::string &quantity_name);
     template <int N, int M>
-    void writeAQuantityHeader(std::ofstream &out_file, const Eigen::Matrix<Real, N, M> &quantity, const std::string &quantity_name);
-    void writeAQuantityHeader(std::ofstream &out_file, const SimTK::SpatialVec &quantity, const std::string &quantity_name);
-    void writeAQuantity(std::ofstream &out_file, const Real &quantity);
+    void writeAQuantityHeader(std::ostream &out_file, const Eigen::Matrix<Real, N, M> &quantity, const std::string &quantity_name);
+    void writeAQuantityHeader(std::ostream &out_file, const SimTK::SpatialVec &quantity, const std::string &quantity_name);
+    void writeAQuantity(std::ostream &out_file, const Real &quantity);
     template <int N>
-    void writeAQuantity(std::ofstream &out_file, const Eigen::Matrix<Real, N, 1> &quantity);
+    void writeAQuantity(std::ostream &out_file, const Eigen::Matrix<Real, N, 1> &quantity);
     template <int N, int M>
-    void writeAQuantity(std::ofstream &out_file, const Eigen::Matrix<Real, N, M> &quantity);
-    void writeAQuantity(std::ofstream &out_file, const SimTK::SpatialVec &quantity);
+    void writeAQuantity(std::ostream &out_file, const Eigen::Matrix<Real, N, M> &quantity);
+    void writeAQuantity(std::ostream &out_file, const SimTK::SpatialVec &quantity);
 };
 
 /**
@@ -68,10 +68,30 @@ class BodyStatesRecordingToPlt : public BodyStatesRecording
     BodyStatesRecordingToPlt(SPHBody &body) : BodyStatesRecording(body) {};
     BodyStatesRecordingToPlt(SPHSystem &sph_system) : BodyStatesRecording(sph_system) {};
     virtual ~BodyStatesRecordingToPlt() {};
+    /** write the Tecplot binary format (version 112) with one block of each variable, instead of ascii text */
+    BodyStatesRecordingToPlt &useBinaryFormat(bool binary_format = true)
+    {
+        binary_format_ = binary_format;
+        return *this;
+    };
 
   protected:
+    bool binary_format_ = false;
+
+    /** A variable written in the binary file, given by its value of each particle. */
+    struct PltColumn
+    {
+        std::string name_;
+        bool is_integer_;
+        std::function<double(size_t)> value_;
+    };
+
     void writePltFileHeader(std::ofstream &output_file, ParticleVariables &variables_to_write);
     void writePltFileParticleData(std::ofstream &output_file, ParticleVariables &variables_to_write, Vecd *position, size_t index);
+    StdVec<PltColumn> getPltColumns(ParticleVariables &variables_to_write, Vecd *position);
+    void writeBinaryPltFile(std::ofstream &output_file, const std::string &zone_name,
+                            ParticleVariables &variables_to_write, Vecd *position, size_t total_real_particles);
+    void writeBinaryPltString(std::ofstream &output_file, const std::string &text);
     virtual void writeWithFileName(const std::string &sequence) override;
 };
 
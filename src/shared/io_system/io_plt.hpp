@@ -9,7 +9,7 @@ namespace SPH
 //=============================================================================================//
 template <int N>
 void PltEngine::writeAQuantityHeader(
-    std::ofstream &out_file, const Eigen::Matrix<Real, N, 1> &quantity, const std::string &quantity_name)
+    std::ostream &out_file, const Eigen::Matrix<Real, N, 1> &quantity, const std::string &quantity_name)
 {
     for (int i = 0; i != N; ++i)
         out_file << "\"" << quantity_name << "[" << i << "]\"" << "   ";
@@ -17,7 +17,7 @@ void PltEngine::writeAQuantityHeader(
 //=============================================================================================//
 template <int N, int M>
 void PltEngine::writeAQuantityHeader(
-    std::ofstream &out_file, const Eigen::Matrix<Real, N, M> &quantity, const std::string &quantity_name)
+    std::ostream &out_file, const Eigen::Matrix<Real, N, M> &quantity, const std::string &quantity_name)
 {
     for (int i = 0; i != N; ++i)
         for (int j = 0; j != M; ++j)
@@ -25,14 +25,14 @@ void PltEngine::writeAQuantityHeader(
 }
 //=============================================================================================//
 template <int N>
-void PltEngine::writeAQuantity(std::ofstream &out_file, const Eigen::Matrix<Real, N, 1> &quantity)
+void PltEngine::writeAQuantity(std::ostream &out_file, const Eigen::Matrix<Real, N, 1> &quantity)
 {
     for (int i = 0; i < N; ++i)
         out_file << std::fixed << std::setprecision(9) << quantity[i] << "   ";
 }
 //=============================================================================================//
 template <int N, int M>
-void PltEngine::writeAQuantity(std::ofstream &out_file, const Eigen::Matrix<Real, N, M> &quantity)
+void PltEngine::writeAQuantity(std::ostream &out_file, const Eigen::Matrix<Real, N, M> &quantity)
 {
     for (int i = 0; i < N; ++i)
         for (int j = 0; j < M; ++j)
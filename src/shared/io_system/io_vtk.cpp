@@ -2,81 +2,368 @@
 
 #include "io_environment.h"
 
+#include <cstring>
+
 namespace SPH
 {
 //=============================================================================================//
+void BodyStatesRecordingToVtp::waitForWriting()
+{
+    if (writing_job_.valid())
+    {
+        writing_job_.get();
+    }
+}
+//=============================================================================================//
+size_t BodyStatesRecordingToVtp::getBodyIndex(SPHBody &sph_body)
+{
+    auto result = std::find(bodies_.begin(), bodies_.end(), &sph_body);
+    if (result == bodies_.end())
+    {
+        std::cout << "\n Error: the body:" << sph_body.getName()
+                  << " is not in the recording list" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    return result - bodies_.begin();
+}
+//=============================================================================================//
+BodyStatesRecordingToVtp &BodyStatesRecordingToVtp::
+    recordParticlesIf(SPHBody &sph_body, const ParticleOutputFilter &filter)
+{
+    output_filters_[getBodyIndex(sph_body)] = filter;
+    return *this;
+}
+//=============================================================================================//
+BodyStatesRecordingToVtp &BodyStatesRecordingToVtp::
+    recordParticlesWithStride(SPHBody &sph_body, UnsignedInt stride)
+{
+    UnsignedInt *original_id = sph_body.getBaseParticles().ParticleOriginalIds();
+    return recordParticlesIf(sph_body, [=](size_t index_i)
+                             { return original_id[index_i] % stride == 0; });
+}
+//=============================================================================================//
+BodyStatesRecordingToVtp &BodyStatesRecordingToVtp::
+    recordParticlesInRegion(SPHBody &sph_body, Shape &region, UnsignedInt stride_outside)
+{
+    BaseParticles &base_particles = sph_body.getBaseParticles();
+    Vecd *pos = base_particles.ParticlePositions();
+    UnsignedInt *original_id = base_particles.ParticleOriginalIds();
+    return recordParticlesIf(sph_body, [=, &region](size_t index_i)
+                             { return region.checkContain(pos[index_i]) ||
+                                      (stride_outside != 0 && original_id[index_i] % stride_outside == 0); });
+}
+//=============================================================================================//
+UniquePtr<BodyStatesRecordingToVtp::BodyStatesSnapshot> BodyStatesRecordingToVtp::
+    takeSnapshot(const std::string &file_path, SPHBody *body, const ParticleOutputFilter &filter)
+{
+    BaseParticles &base_particles = body->getBaseParticles();
+    size_t total_real_particles = base_particles.TotalRealParticles();
+    UniquePtr<BodyStatesSnapshot> snapshot = makeUnique<BodyStatesSnapshot>();
+    snapshot->file_path_ = file_path;
+    snapshot->body_name_ = body->getName();
+    snapshot->total_real_particles_ = total_real_particles;
+
+    IndexVector &selected = snapshot->selected_particles_;
+    if (filter)
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            if (filter(i))
+                selected.push_back(i);
+        }
+        snapshot->total_real_particles_ = selected.size();
+    }
+
+    Vecd *pos = base_particles.ParticlePositions();
+    snapshot->position_ = makeUnique<DiscreteVariable<Vecd>>(
+        "Position", snapshot->total_real_particles_, [&](UnsignedInt i)
+        { return selected.empty() ? pos[i] : pos[selected[i]]; });
+    copy_variables_to_snapshot_(base_particles.VariablesToWrite(), *snapshot);
+    return snapshot;
+}
+//=============================================================================================//
 void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
 {
-    for (SPHBody *body : bodies_)
+    StdVec<UniquePtr<BodyStatesSnapshot>> snapshots;
+    for (size_t l = 0; l != bodies_.size(); ++l)
     {
-        if (body->checkNewlyUpdated())
+        SPHBody *body = bodies_[l];
+        if (body->checkNewlyUpdated() && state_recording_)
         {
             BaseParticles &base_particles = body->getBaseParticles();
+            std::string filefullpath = io_environment_.OutputFolder() + "/" + body->getName() + "_" + sequence + ".vtp";
+            const ParticleOutputFilter &filter = output_filters_[l];
+            if (asynchronous_writing_)
+            {
+                snapshots.push_back(takeSnapshot(filefullpath, body, filter));
+            }
+            else if (filter)
+            {
+                UniquePtr<BodyStatesSnapshot> snapshot = takeSnapshot(filefullpath, body, filter);
+                writeVtpFile(filefullpath, snapshot->body_name_, snapshot->total_real_particles_,
+                             snapshot->position_->Data(), snapshot->variables_);
+            }
+            else
+            {
+                writeVtpFile(filefullpath, body->getName(), base_particles.TotalRealParticles(),
+                             base_particles.ParticlePositions(), base_particles.VariablesToWrite());
+            }
+        }
+        body->setNotNewlyUpdated();
+    }
 
-            if (state_recording_)
+    if (!snapshots.empty())
+    {
+        waitForWriting(); // only the previous output may be still in writing
+        writing_job_ = std::async(
+            std::launch::async, [this, snapshots = std::move(snapshots)]()
             {
-                std::string filefullpath = io_environment_.OutputFolder() + "/" + body->getName() + "_" + sequence + ".vtp";
-                if (fs::exists(filefullpath))
-                {
-                    fs::remove(filefullpath);
-                }
-                std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
-                // begin of the XML file
-                out_file << "<?xml version=\"1.0\"?>\n";
-                out_file << "<VTKFile type=\"PolyData\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
-                out_file << " <PolyData>\n";
-
-                size_t total_real_particles = base_particles.TotalRealParticles();
-                out_file << "  <Piece Name =\"" << body->getName() << "\" NumberOfPoints=\"" << total_real_particles
-                         << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
-
-                // write current/final particle positions first
-                out_file << "   <Points>\n";
-                out_file << "    <DataArray Name=\"Position\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
-                out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
-                {
-                    Vec3d particle_position = upgradeToVec3d(base_particles.ParticlePositions()[i]);
-                    out_file << particle_position[0] << " " << particle_position[1] << " " << particle_position[2] << " ";
-                }
-                out_file << std::endl;
-                out_file << "    </DataArray>\n";
-                out_file << "   </Points>\n";
-
-                // write header of particles data
-                out_file << "   <PointData  Vectors=\"vector\">\n";
-                writeParticlesToVtk(out_file, base_particles);
-                out_file << "   </PointData>\n";
-
-                // write empty cells
-                out_file << "   <Verts>\n";
-                out_file << "    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n";
-                out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+                for (const UniquePtr<BodyStatesSnapshot> &snapshot : snapshots)
                 {
-                    out_file << i << " ";
-                }
-                out_file << std::endl;
-                out_file << "    </DataArray>\n";
-                out_file << "    <DataArray type=\"Int32\"  Name=\"offsets\"  Format=\"ascii\">\n";
-                out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
-                {
-                    out_file << i + 1 << " ";
-                }
-                out_file << std::endl;
-                out_file << "    </DataArray>\n";
-                out_file << "   </Verts>\n";
+                    writeVtpFile(snapshot->file_path_, snapshot->body_name_, snapshot->total_real_particles_,
+                                 snapshot->position_->Data(), snapshot->variables_);
+                } });
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::writeVtpFile(const std::string &file_path, const std::string &body_name,
+                                            size_t total_real_particles, Vecd *positions,
+                                            ParticleVariables &variables_to_write)
+{
+    if (fs::exists(file_path))
+    {
+        fs::remove(file_path);
+    }
 
-                out_file << "  </Piece>\n";
-                out_file << " </PolyData>\n";
-                out_file << "</VTKFile>\n";
+    if (binary_format_)
+    {
+        std::ofstream out_file(file_path.c_str(), std::ios::trunc | std::ios::binary);
+        writeBinaryVtp(out_file, body_name, total_real_particles, positions, variables_to_write);
+    }
+    else
+    {
+        std::ofstream out_file(file_path.c_str(), std::ios::trunc);
+        writeVtp(out_file, body_name, total_real_particles, positions, variables_to_write);
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::writeVtp(std::ostream &out_file, const std::string &body_name,
+                                        size_t total_real_particles, Vecd *positions,
+                                        ParticleVariables &variables_to_write)
+{
+    // begin of the XML file
+    out_file << "<?xml version=\"1.0\"?>\n";
+    out_file << "<VTKFile type=\"PolyData\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+    out_file << " <PolyData>\n";
 
-                out_file.close();
-            }
-        }
-        body->setNotNewlyUpdated();
+    out_file << "  <Piece Name =\"" << body_name << "\" NumberOfPoints=\"" << total_real_particles
+             << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
+
+    // write current/final particle positions first
+    out_file << "   <Points>\n";
+    out_file << "    <DataArray Name=\"Position\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
+    out_file << "    ";
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        Vec3d particle_position = upgradeToVec3d(positions[i]);
+        out_file << particle_position[0] << " " << particle_position[1] << " " << particle_position[2] << " ";
+    }
+    out_file << std::endl;
+    out_file << "    </DataArray>\n";
+    out_file << "   </Points>\n";
+
+    // write header of particles data
+    out_file << "   <PointData  Vectors=\"vector\">\n";
+    writeParticlesToVtk(out_file, variables_to_write, total_real_particles);
+    out_file << "   </PointData>\n";
+
+    // write empty cells
+    out_file << "   <Verts>\n";
+    out_file << "    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n";
+    out_file << "    ";
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        out_file << i << " ";
+    }
+    out_file << std::endl;
+    out_file << "    </DataArray>\n";
+    out_file << "    <DataArray type=\"Int32\"  Name=\"offsets\"  Format=\"ascii\">\n";
+    out_file << "    ";
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        out_file << i + 1 << " ";
     }
+    out_file << std::endl;
+    out_file << "    </DataArray>\n";
+    out_file << "   </Verts>\n";
+
+    out_file << "  </Piece>\n";
+    out_file << " </PolyData>\n";
+    out_file << "</VTKFile>\n";
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::writeBinaryVtp(std::ostream &output_stream, const std::string &body_name,
+                                              size_t total_real_particles, Vecd *positions,
+                                              ParticleVariables &variables_to_write)
+{
+    std::string appended_data;
+
+    output_stream << "<?xml version=\"1.0\"?>\n";
+    output_stream << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n";
+    output_stream << " <PolyData>\n";
+    output_stream << "  <Piece Name =\"" << body_name << "\" NumberOfPoints=\"" << total_real_particles
+                  << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
+
+    output_stream << "   <Points>\n";
+    appendDataArray<float>(output_stream, appended_data, "Position", 3, total_real_particles,
+                           [&](size_t i, float *value)
+                           {
+                               Vec3d particle_position = upgradeToVec3d(positions[i]);
+                               for (int k = 0; k != 3; ++k)
+                                   value[k] = float(particle_position[k]);
+                           });
+    output_stream << "   </Points>\n";
+
+    output_stream << "   <PointData  Vectors=\"vector\">\n";
+    writeParticlesToVtkBinary(output_stream, appended_data, variables_to_write, total_real_particles);
+    output_stream << "   </PointData>\n";
+
+    output_stream << "   <Verts>\n";
+    appendDataArray<int32_t>(output_stream, appended_data, "connectivity", 1, total_real_particles,
+                             [&](size_t i, int32_t *value)
+                             { value[0] = int32_t(i); });
+    appendDataArray<int32_t>(output_stream, appended_data, "offsets", 1, total_real_particles,
+                             [&](size_t i, int32_t *value)
+                             { value[0] = int32_t(i + 1); });
+    output_stream << "   </Verts>\n";
+
+    output_stream << "  </Piece>\n";
+    output_stream << " </PolyData>\n";
+    writeAppendedData(output_stream, appended_data);
+    output_stream << "</VTKFile>\n";
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::writeParticlesToVtkBinary(std::ostream &output_stream, std::string &appended_data,
+                                                         ParticleVariables &variables_to_write,
+                                                         size_t total_real_particles)
+{
+    appendDataArray<int32_t>(output_stream, appended_data, "SortedParticle_ID", 1, total_real_particles,
+                             [&](size_t i, int32_t *value)
+                             { value[0] = int32_t(i); });
+
+    constexpr int type_index_UnsignedInt = DataTypeIndex<UnsignedInt>::value;
+    for (DiscreteVariable<UnsignedInt> *variable : std::get<type_index_UnsignedInt>(variables_to_write))
+    {
+        UnsignedInt *data_field = variable->Data();
+        appendDataArray<int32_t>(output_stream, appended_data, variable->Name(), 1, total_real_particles,
+                                 [&](size_t i, int32_t *value)
+                                 { value[0] = int32_t(data_field[i]); });
+    }
+
+    constexpr int type_index_int = DataTypeIndex<int>::value;
+    for (DiscreteVariable<int> *variable : std::get<type_index_int>(variables_to_write))
+    {
+        int *data_field = variable->Data();
+        appendDataArray<int32_t>(output_stream, appended_data, variable->Name(), 1, total_real_particles,
+                                 [&](size_t i, int32_t *value)
+                                 { value[0] = int32_t(data_field[i]); });
+    }
+
+    constexpr int type_index_uint8 = DataTypeIndex<uint8_t>::value;
+    for (DiscreteVariable<uint8_t> *variable : std::get<type_index_uint8>(variables_to_write))
+    {
+        uint8_t *data_field = variable->Data();
+        appendDataArray<int32_t>(output_stream, appended_data, variable->Name(), 1, total_real_particles,
+                                 [&](size_t i, int32_t *value)
+                                 { value[0] = int32_t(data_field[i]); });
+    }
+
+    constexpr int type_index_Real = DataTypeIndex<Real>::value;
+    for (DiscreteVariable<Real> *variable : std::get<type_index_Real>(variables_to_write))
+    {
+        Real *data_field = variable->Data();
+        const OutputTolerance *tolerance = getOutputTolerance(variable->Name());
+        appendDataArray<float>(output_stream, appended_data, variable->Name(), 1, total_real_particles,
+                               [&](size_t i, float *value)
+                               {
+                                   value[0] = tolerance == nullptr ? float(data_field[i])
+                                                                   : tolerance->quantize(data_field[i]);
+                               });
+    }
+
+    constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+    for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
+    {
+        Vecd *data_field = variable->Data();
+        const OutputTolerance *tolerance = getOutputTolerance(variable->Name());
+        appendDataArray<float>(output_stream, appended_data, variable->Name(), 3, total_real_particles,
+                               [&](size_t i, float *value)
+                               {
+                                   Vec3d vector_value = upgradeToVec3d(data_field[i]);
+                                   for (int k = 0; k != 3; ++k)
+                                       value[k] = tolerance == nullptr ? float(vector_value[k])
+                                                                       : tolerance->quantize(vector_value[k]);
+                               });
+    }
+
+    constexpr int type_index_Matd = DataTypeIndex<Matd>::value;
+    for (DiscreteVariable<Matd> *variable : std::get<type_index_Matd>(variables_to_write))
+    {
+        Matd *data_field = variable->Data();
+        appendDataArray<float>(output_stream, appended_data, variable->Name(), 9, total_real_particles,
+                               [&](size_t i, float *value)
+                               {
+                                   Mat3d matrix_value = upgradeToMat3d(data_field[i]);
+                                   for (int k = 0; k != 3; ++k)
+                                       for (int l = 0; l != 3; ++l)
+                                           value[3 * k + l] = float(matrix_value(l, k)); // column by column
+                               });
+    }
+}
+//=============================================================================================//
+const BodyStatesRecordingToVtp::OutputTolerance *
+BodyStatesRecordingToVtp::getOutputTolerance(const std::string &variable_name)
+{
+    auto tolerance = output_tolerances_.find(variable_name);
+    return tolerance != output_tolerances_.end() ? &tolerance->second : nullptr;
+}
+//=============================================================================================//
+float BodyStatesRecordingToVtp::OutputTolerance::quantize(Real value) const
+{
+    if (!is_relative_)
+    {
+        // the nearest multiple of twice the tolerance
+        Real step = 2.0 * tolerance_;
+        return float(std::round(value / step) * step);
+    }
+
+    // keep only the leading mantissa bits for the relative tolerance, rounded to nearest
+    float single_value = float(value);
+    int kept_bits = SMIN(int(std::ceil(-std::log2(tolerance_))), 23);
+    if (kept_bits < 0 || !std::isfinite(single_value))
+    {
+        return single_value;
+    }
+    uint32_t bits;
+    std::memcpy(&bits, &single_value, sizeof(bits));
+    uint32_t discarded_bits = 23 - kept_bits;
+    if (discarded_bits != 0)
+    {
+        uint32_t mask = ~((uint32_t(1) << discarded_bits) - 1);
+        bits = (bits + (uint32_t(1) << (discarded_bits - 1))) & mask;
+    }
+    std::memcpy(&single_value, &bits, sizeof(bits));
+    return single_value;
+}
+//=============================================================================================//
+void BodyStatesRecordingToVtp::writeAppendedData(std::ostream &output_stream, std::string &appended_data)
+{
+    output_stream << " <AppendedData encoding=\"raw\">\n";
+    output_stream << "  _";
+    output_stream.write(appended_data.data(), appended_data.size());
+    output_stream << "\n </AppendedData>\n";
+    appended_data.clear();
 }
 //=============================================================================================//
 void BodyStatesRecordingToVtpString::writeWithFileName(const std::string &sequence)
@@ -222,4 +509,13 @@ void ParticleGenerationRecordingToVtp::writeWithFileName(const std::string &sequ
     }
 }
 //=================================================================================================//
+MeshRecordingToVtp::MeshRecordingToVtp(SPHSystem &sph_system, BaseMeshField &mesh_field)
+    : BaseIO(sph_system), mesh_field_(mesh_field),
+      partial_file_name_(io_environment_.OutputFolder() + "/" + mesh_field.Name()) {}
+//=================================================================================================//
+void MeshRecordingToVtp::writeToFile(size_t iteration_step)
+{
+    mesh_field_.writeMeshFieldToVtp(partial_file_name_ + "_" + padValueWithZeros(iteration_step));
+}
+//=================================================================================================//
 } // namespace SPH
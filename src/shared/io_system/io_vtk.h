@@ -34,7 +34,10 @@
 #include "dynamics_algorithms.h"
 #include "general_reduce.h"
 
+#include <future>
+
 using VtuStringData = std::map<std::string, std::string>;
+using ParticleOutputFilter = std::function<bool(size_t)>;
 
 namespace SPH
 {
@@ -46,14 +49,100 @@ namespace SPH
 class BodyStatesRecordingToVtp : public BodyStatesRecording
 {
   public:
-    BodyStatesRecordingToVtp(SPHBody &body) : BodyStatesRecording(body) {};
-    BodyStatesRecordingToVtp(SPHSystem &sph_system) : BodyStatesRecording(sph_system) {};
-    virtual ~BodyStatesRecordingToVtp() {};
+    BodyStatesRecordingToVtp(SPHBody &body)
+        : BodyStatesRecording(body), output_filters_(bodies_.size()) {};
+    BodyStatesRecordingToVtp(SPHSystem &sph_system)
+        : BodyStatesRecording(sph_system), output_filters_(bodies_.size()) {};
+    virtual ~BodyStatesRecordingToVtp() { waitForWriting(); };
+    /** write data arrays as raw appended binary data instead of ascii text */
+    BodyStatesRecordingToVtp &useBinaryFormat(bool binary_format = true)
+    {
+        binary_format_ = binary_format;
+        return *this;
+    };
+    /** write files from snapshots of the body states by a background thread,
+     *  the next output waits only if the previous one is still being written. */
+    BodyStatesRecordingToVtp &useAsynchronousWriting(bool asynchronous_writing = true)
+    {
+        asynchronous_writing_ = asynchronous_writing;
+        return *this;
+    };
+    void waitForWriting();
+    /** Round the binary output of a Real or Vecd variable within the tolerance, which is absolute,
+     *  or relative to each value. The trailing zero bits then compress well, e.g. by the file system. */
+    BodyStatesRecordingToVtp &setOutputTolerance(const std::string &variable_name, Real tolerance,
+                                                 bool is_relative = false)
+    {
+        output_tolerances_[variable_name] = OutputTolerance{tolerance, is_relative};
+        return *this;
+    };
+
+    /** only write the particles of a body, given by their indices, satisfying the predicate */
+    BodyStatesRecordingToVtp &recordParticlesIf(SPHBody &sph_body, const ParticleOutputFilter &filter);
+    /** only write the particles with original ids of the stride, e.g. 27 for 1-in-27 subsample */
+    BodyStatesRecordingToVtp &recordParticlesWithStride(SPHBody &sph_body, UnsignedInt stride);
+    /** write the particles in the region at full resolution and,
+     *  if the stride is not zero, a subsample of the particles elsewhere */
+    BodyStatesRecordingToVtp &recordParticlesInRegion(SPHBody &sph_body, Shape &region,
+                                                      UnsignedInt stride_outside = 0);
 
   protected:
+    bool binary_format_ = false;
+    bool asynchronous_writing_ = false;
+    std::future<void> writing_job_;
+    StdVec<ParticleOutputFilter> output_filters_; /**< empty for writing all particles of a body */
+
+    struct OutputTolerance
+    {
+        Real tolerance_;
+        bool is_relative_;
+        float quantize(Real value) const;
+    };
+    std::map<std::string, OutputTolerance> output_tolerances_;
+    /** nullptr for lossless output */
+    const OutputTolerance *getOutputTolerance(const std::string &variable_name);
+
+    struct BodyStatesSnapshot
+    {
+        std::string file_path_;
+        std::string body_name_;
+        size_t total_real_particles_;
+        IndexVector selected_particles_; /**< empty if all real particles are selected */
+        UniquePtr<DiscreteVariable<Vecd>> position_;
+        DataContainerUniquePtrAssemble<DiscreteVariable> variable_ptrs_;
+        ParticleVariables variables_;
+    };
+
+    struct CopyVariablesToSnapshot
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BodyStatesSnapshot &snapshot);
+    };
+    OperationOnDataAssemble<ParticleVariables, CopyVariablesToSnapshot> copy_variables_to_snapshot_;
+
+    size_t getBodyIndex(SPHBody &sph_body);
+    UniquePtr<BodyStatesSnapshot> takeSnapshot(const std::string &file_path, SPHBody *body,
+                                               const ParticleOutputFilter &filter);
     virtual void writeWithFileName(const std::string &sequence) override;
+    void writeVtpFile(const std::string &file_path, const std::string &body_name, size_t total_real_particles,
+                      Vecd *positions, ParticleVariables &variables_to_write);
+    void writeVtp(std::ostream &output_stream, const std::string &body_name, size_t total_real_particles,
+                  Vecd *positions, ParticleVariables &variables_to_write);
     template <typename OutStreamType>
     void writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles);
+    template <typename OutStreamType>
+    void writeParticlesToVtk(OutStreamType &output_stream, ParticleVariables &variables_to_write,
+                             size_t total_real_particles);
+    void writeBinaryVtp(std::ostream &output_stream, const std::string &body_name, size_t total_real_particles,
+                        Vecd *positions, ParticleVariables &variables_to_write);
+    void writeParticlesToVtkBinary(std::ostream &output_stream, std::string &appended_data,
+                                   ParticleVariables &variables_to_write, size_t total_real_particles);
+    /** write the appended DataArray header and append its data block filled in parallel */
+    template <typename DataType, typename FunctionByIndex>
+    void appendDataArray(std::ostream &output_stream, std::string &appended_data, const std::string &name,
+                         int number_of_components, size_t size, const FunctionByIndex &function_by_index);
+    void writeAppendedData(std::ostream &output_stream, std::string &appended_data);
 };
 
 /**
@@ -115,5 +204,21 @@ class ParticleGenerationRecordingToVtp : public ParticleGenerationRecording
     StdVec<Vecd> &position_;
     virtual void writeWithFileName(const std::string &sequence) override;
 };
+
+/**
+ * @class MeshRecordingToVtp
+ * @brief  write the mesh data in binary VTK XML format, e.g. the core packages of a level set
+ */
+class MeshRecordingToVtp : public BaseIO
+{
+  protected:
+    BaseMeshField &mesh_field_;
+    std::string partial_file_name_;
+
+  public:
+    MeshRecordingToVtp(SPHSystem &sph_system, BaseMeshField &mesh_field);
+    virtual ~MeshRecordingToVtp() {};
+    virtual void writeToFile(size_t iteration_step = 0) override;
+};
 } // namespace SPH
 #endif // IO_VTK_H
@@ -9,9 +9,13 @@ namespace SPH
 template <typename OutStreamType>
 void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles)
 {
-    size_t total_real_particles = particles.TotalRealParticles();
-    ParticleVariables &variables_to_write = particles.VariablesToWrite();
-
+    writeParticlesToVtk(output_stream, particles.VariablesToWrite(), particles.TotalRealParticles());
+}
+//=============================================================================================//
+template <typename OutStreamType>
+void BodyStatesRecordingToVtp::writeParticlesToVtk(
+    OutStreamType &output_stream, ParticleVariables &variables_to_write, size_t total_real_particles)
+{
     // write sorted particles ID
     output_stream
         << "    <DataArray Name=\"SortedParticle_ID\" type=\"Int32\" Format=\"ascii\">\n";
@@ -53,6 +57,21 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         output_stream << "    </DataArray>\n";
     }
 
+    // write compact flags as integers
+    constexpr int type_index_uint8 = DataTypeIndex<uint8_t>::value;
+    for (DiscreteVariable<uint8_t> *variable : std::get<type_index_uint8>(variables_to_write))
+    {
+        uint8_t *data_field = variable->Data();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Int32\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            output_stream << int(data_field[i]) << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+
     // write scalars
     constexpr int type_index_Real = DataTypeIndex<Real>::value;
     for (DiscreteVariable<Real> *variable : std::get<type_index_Real>(variables_to_write))
@@ -105,5 +124,42 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
     }
 }
 //=============================================================================================//
+template <typename DataType, typename FunctionByIndex>
+void BodyStatesRecordingToVtp::appendDataArray(
+    std::ostream &output_stream, std::string &appended_data, const std::string &name,
+    int number_of_components, size_t size, const FunctionByIndex &function_by_index)
+{
+    static_assert(std::is_same_v<DataType, float> || std::is_same_v<DataType, int32_t>,
+                  "Only Float32 and Int32 data arrays are written.");
+    std::string type_name = std::is_same_v<DataType, float> ? "Float32" : "Int32";
+    output_stream << "    <DataArray Name=\"" << name << "\" type=\"" << type_name
+                  << "\" NumberOfComponents=\"" << number_of_components
+                  << "\" format=\"appended\" offset=\"" << appended_data.size() << "\"/>\n";
+
+    StdVec<DataType> block(size * number_of_components);
+    particle_for(execution::par_host, IndexRange(0, size),
+                 [&](size_t i)
+                 { function_by_index(i, &block[i * number_of_components]); });
+
+    uint64_t block_bytes = block.size() * sizeof(DataType);
+    appended_data.append(reinterpret_cast<const char *>(&block_bytes), sizeof(block_bytes));
+    appended_data.append(reinterpret_cast<const char *>(block.data()), block_bytes);
+}
+//=============================================================================================//
+template <typename DataType>
+void BodyStatesRecordingToVtp::CopyVariablesToSnapshot::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BodyStatesSnapshot &snapshot)
+{
+    IndexVector &selected = snapshot.selected_particles_;
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        DataType *data_field = variables[i]->Data();
+        addVariableToAssemble<DataType>(snapshot.variables_, snapshot.variable_ptrs_,
+                                        variables[i]->Name(), snapshot.total_real_particles_,
+                                        [&](UnsignedInt index)
+                                        { return selected.empty() ? data_field[index] : data_field[selected[index]]; });
+    }
+}
+//=============================================================================================//
 } // namespace SPH
 #endif // IO_VTK_HPP
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "io_xdmf.hpp"
+
+#include "io_environment.h"
+
+namespace SPH
+{
+//=============================================================================================//
+BodyStatesRecordingToXdmf::BodyStatesRecordingToXdmf(SPHSystem &sph_system)
+    : BodyStatesRecording(sph_system)
+{
+    initializeDataFiles();
+}
+//=============================================================================================//
+BodyStatesRecordingToXdmf::BodyStatesRecordingToXdmf(SPHBody &body)
+    : BodyStatesRecording(body)
+{
+    initializeDataFiles();
+}
+//=============================================================================================//
+void BodyStatesRecordingToXdmf::initializeDataFiles()
+{
+    for (SPHBody *body : bodies_)
+    {
+        std::string data_file_name = body->getName() + "_states.bin";
+        std::string filefullpath = io_environment_.OutputFolder() + "/" + data_file_name;
+        if (state_recording_ && fs::exists(filefullpath))
+        {
+            fs::remove(filefullpath);
+        }
+        data_file_names_.push_back(data_file_name);
+        data_file_sizes_.push_back(0);
+        recorded_steps_.push_back(StdVec<XdmfStep>());
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToXdmf::writeWithFileName(const std::string &sequence)
+{
+    for (size_t l = 0; l != bodies_.size(); ++l)
+    {
+        SPHBody *body = bodies_[l];
+        if (body->checkNewlyUpdated() && state_recording_)
+        {
+            BaseParticles &base_particles = body->getBaseParticles();
+            size_t total_real_particles = base_particles.TotalRealParticles();
+            std::string filefullpath = io_environment_.OutputFolder() + "/" + data_file_names_[l];
+            std::ofstream data_file(filefullpath.c_str(), std::ios::app | std::ios::binary);
+
+            XdmfStep step;
+            step.physical_time_ = sv_physical_time_->getValue();
+            step.total_real_particles_ = total_real_particles;
+            Vecd *pos = base_particles.ParticlePositions();
+            step.position_ = appendDataItem<float>(data_file, data_file_sizes_[l], "Position", "Vector",
+                                                   3, total_real_particles,
+                                                   [&](size_t i, float *value)
+                                                   {
+                                                       Vec3d particle_position = upgradeToVec3d(pos[i]);
+                                                       for (int k = 0; k != 3; ++k)
+                                                           value[k] = float(particle_position[k]);
+                                                   });
+            appendVariables(data_file, data_file_sizes_[l], step, base_particles.VariablesToWrite());
+            data_file.close();
+
+            recorded_steps_[l].push_back(step);
+            writeXdmfIndex(body, l);
+        }
+        body->setNotNewlyUpdated();
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToXdmf::appendVariables(std::ofstream &data_file, size_t &data_file_size,
+                                                XdmfStep &step, ParticleVariables &variables_to_write)
+{
+    size_t total_real_particles = step.total_real_particles_;
+
+    constexpr int type_index_UnsignedInt = DataTypeIndex<UnsignedInt>::value;
+    for (DiscreteVariable<UnsignedInt> *variable : std::get<type_index_UnsignedInt>(variables_to_write))
+    {
+        UnsignedInt *data_field = variable->Data();
+        step.attributes_.push_back(
+            appendDataItem<uint32_t>(data_file, data_file_size, variable->Name(), "Scalar", 1, total_real_particles,
+                                     [&](size_t i, uint32_t *value)
+                                     { value[0] = uint32_t(data_field[i]); }));
+    }
+
+    constexpr int type_index_int = DataTypeIndex<int>::value;
+    for (DiscreteVariable<int> *variable : std::get<type_index_int>(variables_to_write))
+    {
+        int *data_field = variable->Data();
+        step.attributes_.push_back(
+            appendDataItem<int32_t>(data_file, data_file_size, variable->Name(), "Scalar", 1, total_real_particles,
+                                    [&](size_t i, int32_t *value)
+                                    { value[0] = int32_t(data_field[i]); }));
+    }
+
+    constexpr int type_index_uint8 = DataTypeIndex<uint8_t>::value;
+    for (DiscreteVariable<uint8_t> *variable : std::get<type_index_uint8>(variables_to_write))
+    {
+        uint8_t *data_field = variable->Data();
+        step.attributes_.push_back(
+            appendDataItem<uint8_t>(data_file, data_file_size, variable->Name(), "Scalar", 1, total_real_particles,
+                                    [&](size_t i, uint8_t *value)
+                                    { value[0] = data_field[i]; }));
+    }
+
+    constexpr int type_index_Real = DataTypeIndex<Real>::value;
+    for (DiscreteVariable<Real> *variable : std::get<type_index_Real>(variables_to_write))
+    {
+        Real *data_field = variable->Data();
+        step.attributes_.push_back(
+            appendDataItem<float>(data_file, data_file_size, variable->Name(), "Scalar", 1, total_real_particles,
+                                  [&](size_t i, float *value)
+                                  { value[0] = float(data_field[i]); }));
+    }
+
+    constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+    for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
+    {
+        Vecd *data_field = variable->Data();
+        step.attributes_.push_back(
+            appendDataItem<float>(data_file, data_file_size, variable->Name(), "Vector", 3, total_real_particles,
+                                  [&](size_t i, float *value)
+                                  {
+                                      Vec3d vector_value = upgradeToVec3d(data_field[i]);
+                                      for (int k = 0; k != 3; ++k)
+                                          value[k] = float(vector_value[k]);
+                                  }));
+    }
+
+    constexpr int type_index_Matd = DataTypeIndex<Matd>::value;
+    for (DiscreteVariable<Matd> *variable : std::get<type_index_Matd>(variables_to_write))
+    {
+        Matd *data_field = variable->Data();
+        step.attributes_.push_back(
+            appendDataItem<float>(data_file, data_file_size, variable->Name(), "Tensor", 9, total_real_particles,
+                                  [&](size_t i, float *value)
+                                  {
+                                      Mat3d matrix_value = upgradeToMat3d(data_field[i]);
+                                      for (int k = 0; k != 3; ++k)
+                                          for (int m = 0; m != 3; ++m)
+                                              value[3 * k + m] = float(matrix_value(k, m)); // row by row
+                                  }));
+    }
+}
+//=============================================================================================//
+void BodyStatesRecordingToXdmf::writeDataItem(std::ofstream &xdmf_file, const XdmfDataItem &data_item,
+                                              size_t total_real_particles, const std::string &data_file_name)
+{
+    xdmf_file << "      <DataItem Format=\"Binary\" Endian=\"Little\" NumberType=\"" << data_item.number_type_
+              << "\" Precision=\"" << data_item.precision_ << "\" Seek=\"" << data_item.seek_
+              << "\" Dimensions=\"" << total_real_particles;
+    if (data_item.number_of_components_ != 1)
+    {
+        xdmf_file << " " << data_item.number_of_components_;
+    }
+    xdmf_file << "\">" << data_file_name << "</DataItem>\n";
+}
+//=============================================================================================//
+void BodyStatesRecordingToXdmf::writeTopology(std::ofstream &xdmf_file, size_t body_index,
+                                              size_t total_real_particles)
+{
+    xdmf_file << "    <Topology TopologyType=\"Polyvertex\" NumberOfElements=\"" << total_real_particles
+              << "\" NodesPerElement=\"1\"/>\n";
+}
+//=============================================================================================//
+void BodyStatesRecordingToXdmf::writeXdmfIndex(SPHBody *body, size_t body_index)
+{
+    std::string filefullpath = io_environment_.OutputFolder() + "/" + body->getName() + "_states.xdmf";
+    std::ofstream xdmf_file(filefullpath.c_str(), std::ios::trunc);
+    xdmf_file << "<?xml version=\"1.0\"?>\n";
+    xdmf_file << "<Xdmf Version=\"3.0\">\n";
+    xdmf_file << " <Domain>\n";
+    xdmf_file << "  <Grid Name=\"" << body->getName() << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+    const std::string &data_file_name = data_file_names_[body_index];
+    for (const XdmfStep &step : recorded_steps_[body_index])
+    {
+        size_t total_real_particles = step.total_real_particles_;
+        xdmf_file << "   <Grid Name=\"" << body->getName() << "\" GridType=\"Uniform\">\n";
+        xdmf_file << "    <Time Value=\"" << std::setprecision(9) << step.physical_time_ << "\"/>\n";
+        writeTopology(xdmf_file, body_index, total_real_particles);
+        xdmf_file << "    <Geometry GeometryType=\"XYZ\">\n";
+        writeDataItem(xdmf_file, step.position_, total_real_particles, data_file_name);
+        xdmf_file << "    </Geometry>\n";
+
+        for (const XdmfDataItem &attribute : step.attributes_)
+        {
+            xdmf_file << "    <Attribute Name=\"" << attribute.name_ << "\" AttributeType=\""
+                      << attribute.attribute_type_ << "\" Center=\"Node\">\n";
+            writeDataItem(xdmf_file, attribute, total_real_particles, data_file_name);
+            xdmf_file << "    </Attribute>\n";
+        }
+        xdmf_file << "   </Grid>\n";
+    }
+
+    xdmf_file << "  </Grid>\n";
+    xdmf_file << " </Domain>\n";
+    xdmf_file << "</Xdmf>\n";
+}
+//=================================================================================================//
+} // namespace SPH
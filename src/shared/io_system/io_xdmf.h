@@ -0,0 +1,109 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_xdmf.h
+ * @brief 	Classes for writing body states of all output steps into a single raw binary
+ *          file per body, indexed by an XDMF file readable by ParaView.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_XDMF_H
+#define IO_XDMF_H
+
+#include "io_base.h"
+
+namespace SPH
+{
+/**
+ * @class BodyStatesRecordingToXdmf
+ * @brief Write the states of bodies into one binary data file per body and run.
+ * Each output step appends its positions and the variables to write as contiguous blocks,
+ * and the XDMF index, as a temporal collection with the seek offsets of these blocks,
+ * is rewritten after each output step so that it is always valid for post-processing.
+ */
+class BodyStatesRecordingToXdmf : public BodyStatesRecording
+{
+  public:
+    BodyStatesRecordingToXdmf(SPHSystem &sph_system);
+    BodyStatesRecordingToXdmf(SPHBody &body);
+    virtual ~BodyStatesRecordingToXdmf() {};
+
+  protected:
+    struct XdmfDataItem
+    {
+        std::string name_;
+        std::string attribute_type_; // Scalar, Vector or Tensor
+        std::string number_type_;    // Float, Int or UInt
+        size_t precision_;
+        size_t number_of_components_;
+        size_t seek_;
+    };
+
+    struct XdmfStep
+    {
+        Real physical_time_;
+        size_t total_real_particles_;
+        XdmfDataItem position_;
+        StdVec<XdmfDataItem> attributes_;
+    };
+
+    StdVec<std::string> data_file_names_;
+    StdVec<size_t> data_file_sizes_;
+    StdVec<StdVec<XdmfStep>> recorded_steps_; // for each body
+
+    void initializeDataFiles();
+    virtual void writeWithFileName(const std::string &sequence) override;
+    template <typename OutDataType, typename FunctionByIndex>
+    XdmfDataItem appendDataItem(std::ofstream &data_file, size_t &data_file_size, const std::string &name,
+                                const std::string &attribute_type, size_t number_of_components,
+                                size_t total_real_particles, const FunctionByIndex &function_by_index);
+    void appendVariables(std::ofstream &data_file, size_t &data_file_size, XdmfStep &step,
+                         ParticleVariables &variables_to_write);
+    void writeDataItem(std::ofstream &xdmf_file, const XdmfDataItem &data_item,
+                       size_t total_real_particles, const std::string &data_file_name);
+    /** the topology of a step, by default every particle is a vertex */
+    virtual void writeTopology(std::ofstream &xdmf_file, size_t body_index, size_t total_real_particles);
+    void writeXdmfIndex(SPHBody *body, size_t body_index);
+};
+
+/**
+ * @class BodyStatesRecordingToTriangleMeshXdmf
+ * @brief Write the states of a surface body with the triangle mesh topology.
+ * As the topology never changes, the face connectivity is written only once
+ * at the beginning of the data file and referenced by all output steps,
+ * which only append the positions and the variables to write at the vertices.
+ */
+class TriangleMeshShape;
+class BodyStatesRecordingToTriangleMeshXdmf : public BodyStatesRecordingToXdmf
+{
+  public:
+    BodyStatesRecordingToTriangleMeshXdmf(SPHBody &body, TriangleMeshShape &triangle_mesh_shape);
+    virtual ~BodyStatesRecordingToTriangleMeshXdmf() {};
+
+  protected:
+    size_t number_of_faces_;
+    XdmfDataItem connectivity_;
+    virtual void writeTopology(std::ofstream &xdmf_file, size_t body_index, size_t total_real_particles) override;
+};
+} // namespace SPH
+#endif // IO_XDMF_H
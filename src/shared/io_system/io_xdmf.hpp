@@ -0,0 +1,37 @@
+#ifndef IO_XDMF_HPP
+#define IO_XDMF_HPP
+
+#include "io_xdmf.h"
+
+#include "particle_iterators.h"
+
+namespace SPH
+{
+//=============================================================================================//
+template <typename OutDataType, typename FunctionByIndex>
+BodyStatesRecordingToXdmf::XdmfDataItem BodyStatesRecordingToXdmf::appendDataItem(
+    std::ofstream &data_file, size_t &data_file_size, const std::string &name,
+    const std::string &attribute_type, size_t number_of_components,
+    size_t total_real_particles, const FunctionByIndex &function_by_index)
+{
+    std::string number_type = std::is_floating_point<OutDataType>::value
+                                  ? "Float"
+                                  : (sizeof(OutDataType) == 1
+                                         ? "UChar"
+                                         : (std::is_signed<OutDataType>::value ? "Int" : "UInt"));
+    XdmfDataItem data_item = {name, attribute_type, number_type, sizeof(OutDataType),
+                              number_of_components, data_file_size};
+
+    StdVec<OutDataType> block(total_real_particles * number_of_components);
+    particle_for(execution::par_host, IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 { function_by_index(i, &block[i * number_of_components]); });
+
+    size_t block_size = block.size() * sizeof(OutDataType);
+    data_file.write(reinterpret_cast<const char *>(block.data()), block_size);
+    data_file_size += block_size;
+    return data_item;
+}
+//=============================================================================================//
+} // namespace SPH
+#endif // IO_XDMF_HPP
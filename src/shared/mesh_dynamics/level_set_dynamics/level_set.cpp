@@ -51,6 +51,28 @@ LevelSet::LevelSet(
     }
 }
 //=================================================================================================//
+LevelSet::LevelSet(
+    BoundingBoxd tentative_bounds, std::ifstream &cache_file,
+    Shape &shape, SPHAdaptation &sph_adaptation, Real refinement_ratio)
+    : BaseMeshField("LevelSet_" + shape.getName()), total_levels_(0),
+      shape_(shape), refinement_ratio_(refinement_ratio)
+{
+    cache_file.read(reinterpret_cast<char *>(&total_levels_), sizeof(total_levels_));
+    for (size_t level = 0; level < total_levels_; ++level)
+    {
+        Real data_spacing = 0.0;
+        cache_file.read(reinterpret_cast<char *>(&data_spacing), sizeof(data_spacing));
+        Real global_h_ratio = sph_adaptation.ReferenceSpacing() / data_spacing / refinement_ratio;
+        Real smoothing_length = sph_adaptation.ReferenceSmoothingLength() / global_h_ratio;
+        global_h_ratio_vec_.push_back(global_h_ratio);
+        neighbor_method_set_.push_back(
+            neighbor_method_keeper_.template createPtr<NeighborMethod<SPHAdaptation, SPHAdaptation>>(
+                *sph_adaptation.getKernel(), smoothing_length, data_spacing));
+
+        initializeLevelFromCache(data_spacing, tentative_bounds, cache_file);
+    }
+}
+//=================================================================================================//
 void LevelSet::initializeLevel(
     Real data_spacing, BoundingBoxd tentative_bounds, MeshWithGridDataPackagesType *coarse_data)
 {
@@ -83,6 +105,85 @@ void LevelSet::initializeLevel(
     finish_data_packages.exec();
 }
 //=================================================================================================//
+void LevelSet::initializeLevelFromCache(
+    Real data_spacing, BoundingBoxd tentative_bounds, std::ifstream &cache_file)
+{
+    MeshWithGridDataPackagesType *mesh_data =
+        mesh_data_ptr_vector_keeper_
+            .template createPtr<MeshWithGridDataPackagesType>(
+                tentative_bounds, data_spacing, 4);
+    mesh_data_set_.push_back(mesh_data);
+
+    UnsignedInt total_cells = 0;
+    UnsignedInt total_packages = 0;
+    cache_file.read(reinterpret_cast<char *>(&total_cells), sizeof(total_cells));
+    cache_file.read(reinterpret_cast<char *>(&total_packages), sizeof(total_packages));
+    DiscreteVariable<UnsignedInt> &cell_pkg_index = mesh_data->getCellPackageIndex();
+    if (!cache_file || total_cells != cell_pkg_index.getDataSize() ||
+        total_packages < mesh_data->NumSingularPackages())
+    {
+        std::cout << "\n Error: the level set cache does not match the mesh of " << name_ << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    readVariableFromCache(cache_file, cell_pkg_index);
+
+    DiscreteVariable<UnsignedInt> pkg_1d_cell_index("Package1DCellIndex", total_packages);
+    DiscreteVariable<int> pkg_type("PackageType", total_packages);
+    readVariableFromCache(cache_file, pkg_1d_cell_index);
+    readVariableFromCache(cache_file, pkg_type);
+    ConcurrentVec<std::pair<UnsignedInt, int>> &occupied_data_pkgs = mesh_data->getOccupiedDataPackages();
+    for (UnsignedInt i = mesh_data->NumSingularPackages(); i != total_packages; ++i)
+    {
+        occupied_data_pkgs.push_back(std::make_pair(pkg_1d_cell_index.getValue(i), pkg_type.getValue(i)));
+    }
+    mesh_data->organizeOccupiedPackages(); // the packages were sorted before being cached
+
+    readVariableFromCache(cache_file, *mesh_data->registerMeshVariable<Real>("LevelSet"));
+    readVariableFromCache(cache_file, *mesh_data->registerMeshVariable<Vecd>("LevelSetGradient"));
+    mesh_data->addMeshVariableToWrite<Real>("LevelSet");
+
+    // the interface tags are only used by the corrections, which are already applied to the cached data
+    PackageData<Real, 4> *phi = mesh_data->getMeshVariable<Real>("LevelSet")->Data();
+    PackageData<int, 4> *near_interface_id = mesh_data->registerMeshVariable<int>("NearInterfaceID")->Data();
+    for (UnsignedInt i = 0; i != total_packages; ++i)
+    {
+        mesh_for_each(Arrayi::Zero(), Arrayi::Constant(4),
+                      [&](const Arrayi &data_index)
+                      { near_interface_id[i](data_index) = phi[i](data_index) < 0.0 ? -2 : 2; });
+    }
+    mesh_data->registerBKGMeshVariable<int>("CellContainID", [&](UnsignedInt index)
+                                            { return 2; });
+    mesh_data->addBKGMeshVariableToWrite<int>("CellContainID");
+
+    MeshInnerDynamics<execution::ParallelPolicy, InitializeCellNeighborhood>
+        initialize_cell_neighborhood{*mesh_data};
+    initialize_cell_neighborhood.exec();
+}
+//=================================================================================================//
+void LevelSet::writeToCache(std::ofstream &cache_file)
+{
+    sync_mesh_variables_to_probe_();
+    cache_file.write(reinterpret_cast<const char *>(&total_levels_), sizeof(total_levels_));
+    for (size_t level = 0; level < total_levels_; ++level)
+    {
+        MeshWithGridDataPackagesType *mesh_data = mesh_data_set_[level];
+        Real data_spacing = mesh_data->getIndexHandler().DataSpacing();
+        DiscreteVariable<UnsignedInt> &cell_pkg_index = mesh_data->getCellPackageIndex();
+        UnsignedInt total_cells = cell_pkg_index.getDataSize();
+        UnsignedInt total_packages = mesh_data->PackageBound();
+        cache_file.write(reinterpret_cast<const char *>(&data_spacing), sizeof(data_spacing));
+        cache_file.write(reinterpret_cast<const char *>(&total_cells), sizeof(total_cells));
+        cache_file.write(reinterpret_cast<const char *>(&total_packages), sizeof(total_packages));
+
+        writeVariableToCache(cache_file, cell_pkg_index);
+        writeVariableToCache(cache_file, mesh_data->getPackage1DCellIndex());
+        writeVariableToCache(cache_file, mesh_data->getPackageType());
+        writeVariableToCache(cache_file, *mesh_data->getMeshVariable<Real>("LevelSet"));
+        writeVariableToCache(cache_file, *mesh_data->getMeshVariable<Vecd>("LevelSetGradient"));
+    }
+}
+//=================================================================================================//
 size_t LevelSet::getCoarseLevel(Real h_ratio)
 {
     for (size_t level = total_levels_; level != 0; --level)
@@ -100,12 +201,75 @@ void LevelSet::cleanInterface(UnsignedInt repeat_times)
     DynamicCast<RepeatTimes>(this, *clean_interface_keeper_.get())(repeat_times);
     clean_interface_keeper_->exec();
     sync_mesh_variables_to_probe_();
+    updatePreparedKernelSecondGradientIntegrals();
+}
+//=============================================================================================//
+void LevelSet::cleanInterfaceByFastSweeping(UnsignedInt repeat_times)
+{
+    DynamicCast<RepeatTimes>(this, *fast_sweeping_clean_interface_keeper_.get())(repeat_times);
+    fast_sweeping_clean_interface_keeper_->exec();
+    sync_mesh_variables_to_probe_();
+    updatePreparedKernelSecondGradientIntegrals();
 }
 //=============================================================================================//
 void LevelSet::correctTopology()
 {
     correct_topology_keeper_->exec();
     sync_mesh_variables_to_probe_();
+    updatePreparedKernelSecondGradientIntegrals();
+}
+//=============================================================================================//
+void LevelSet::prepareKernelIntegrals(size_t level)
+{
+    if (is_kernel_integral_prepared_[level].load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(kernel_integral_mutex_);
+    if (!is_kernel_integral_prepared_[level].load(std::memory_order_relaxed))
+    {
+        MeshInnerDynamics<execution::SequencedPolicy, UpdateKernelIntegrals>
+            update_kernel_integrals{*mesh_data_set_[level], *neighbor_method_set_[level]};
+        update_kernel_integrals.exec();
+        registerKernelIntegralProbes(execution::par_host, level);
+        is_kernel_integral_prepared_[level].store(true, std::memory_order_release);
+    }
+}
+//=============================================================================================//
+void LevelSet::prepareKernelSecondGradientIntegrals(size_t level)
+{
+    if (is_kernel_second_gradient_prepared_[level].load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(kernel_integral_mutex_);
+    if (!is_kernel_second_gradient_prepared_[level].load(std::memory_order_relaxed))
+    {
+        MeshInnerDynamics<execution::SequencedPolicy, UpdateKernelIntegrals>
+            update_kernel_integrals{*mesh_data_set_[level], *neighbor_method_set_[level], true};
+        update_kernel_integrals.exec();
+        registerKernelSecondGradientIntegralProbe(execution::par_host, level);
+        is_kernel_second_gradient_prepared_[level].store(true, std::memory_order_release);
+    }
+}
+//=============================================================================================//
+void LevelSet::updatePreparedKernelSecondGradientIntegrals()
+{
+    size_t finest_level = total_levels_ - 1; // the only level changed by the post processes
+    if (is_kernel_second_gradient_prepared_[finest_level].load())
+    {
+        MeshInnerDynamics<execution::SequencedPolicy, UpdateKernelIntegrals>
+            update_kernel_integrals{*mesh_data_set_[finest_level], *neighbor_method_set_[finest_level], true};
+        update_kernel_integrals.exec();
+    }
+}
+//=============================================================================================//
+MemoryUsage LevelSet::getMemoryUsage()
+{
+    MemoryUsage memory_usage;
+    for (size_t level = 0; level != mesh_data_set_.size(); ++level)
+    {
+        memory_usage += mesh_data_set_[level]->getMemoryUsage();
+    }
+    return memory_usage;
 }
 //=============================================================================================//
 Real LevelSet::probeSignedDistance(const Vecd &position)
@@ -125,15 +289,24 @@ Vecd LevelSet::probeLevelSetGradient(const Vecd &position)
 //=============================================================================================//
 size_t LevelSet::getProbeLevel(const Vecd &position)
 {
+    Vecd frame_position = mesh_data_set_[0]->svMeshTransform().Data()->shiftBaseStationToFrame(position);
     for (size_t level = total_levels_; level != 0; --level)
     {
         if (mesh_index_handler_set_[level - 1]->isWithinCorePackage(
-                cell_pkg_index_set_[level - 1], pkg_type_set_[level - 1], position))
+                cell_pkg_index_set_[level - 1], pkg_type_set_[level - 1], frame_position))
             return level - 1; // jump out of the loop!
     }
     return 0;
 }
 //=================================================================================================//
+void LevelSet::setTransform(const Transform &transform)
+{
+    for (size_t level = 0; level != total_levels_; ++level)
+    {
+        mesh_data_set_[level]->svMeshTransform().setValue(transform);
+    }
+}
+//=================================================================================================//
 Real LevelSet::probeKernelIntegral(const Vecd &position, Real h_ratio)
 {
     // std::cout << "probe kernel integral" << std::endl;
@@ -142,6 +315,8 @@ Real LevelSet::probeKernelIntegral(const Vecd &position, Real h_ratio)
         return (*probe_kernel_integral_set_[0])(position);
     }
     size_t coarse_level = getCoarseLevel(h_ratio);
+    prepareKernelIntegrals(coarse_level);
+    prepareKernelIntegrals(coarse_level + 1);
     Real alpha = (global_h_ratio_vec_[coarse_level + 1] - h_ratio) /
                  (global_h_ratio_vec_[coarse_level + 1] - global_h_ratio_vec_[coarse_level]);
     Real coarse_level_value = (*probe_kernel_integral_set_[coarse_level])(position);
@@ -158,6 +333,8 @@ Vecd LevelSet::probeKernelGradientIntegral(const Vecd &position, Real h_ratio)
         return (*probe_kernel_gradient_integral_set_[0])(position);
     }
     size_t coarse_level = getCoarseLevel(h_ratio);
+    prepareKernelIntegrals(coarse_level);
+    prepareKernelIntegrals(coarse_level + 1);
     Real alpha = (global_h_ratio_vec_[coarse_level + 1] - h_ratio) /
                  (global_h_ratio_vec_[coarse_level + 1] - global_h_ratio_vec_[coarse_level]);
     Vecd coarse_level_value = (*probe_kernel_gradient_integral_set_[coarse_level])(position);
@@ -170,9 +347,12 @@ Matd LevelSet::probeKernelSecondGradientIntegral(const Vecd &position, Real h_ra
 {
     if (mesh_data_set_.size() == 1)
     {
+        prepareKernelSecondGradientIntegrals(0);
         return (*probe_kernel_second_gradient_integral_set_[0])(position);
     }
     size_t coarse_level = getCoarseLevel(h_ratio);
+    prepareKernelSecondGradientIntegrals(coarse_level);
+    prepareKernelSecondGradientIntegrals(coarse_level + 1);
     Real alpha = (global_h_ratio_vec_[coarse_level + 1] - h_ratio) /
                  (global_h_ratio_vec_[coarse_level + 1] - global_h_ratio_vec_[coarse_level]);
     Matd coarse_level_value = (*probe_kernel_second_gradient_integral_set_[coarse_level])(position);
@@ -205,4 +385,16 @@ void LevelSet::writeBKGMeshToPlt(const std::string &partial_file_name)
     }
 }
 //=============================================================================================//
+void LevelSet::writeMeshFieldToVtp(const std::string &partial_file_name)
+{
+    sync_mesh_variables_to_write_();
+    for (size_t l = 0; l != total_levels_; ++l)
+    {
+        std::string full_file_name = partial_file_name + "_" + std::to_string(l) + ".vtp";
+        std::ofstream out_file(full_file_name.c_str(), std::ios::binary | std::ios::trunc);
+        mesh_data_set_[l]->writeMeshVariableToVtp(out_file);
+        out_file.close();
+    }
+}
+//=============================================================================================//
 } // namespace SPH
@@ -31,13 +31,17 @@
 
 #include "adaptation.h"
 #include "base_geometry.h"
-#include "kernel_tabulated_ck.h"
+#include "kernel_tabulated_ck.hpp"
 #include "level_set_correction.hpp"
 #include "level_set_initialization.hpp"
 #include "level_set_transformation.hpp"
 #include "mesh_data_package_sort.h"
 #include "mesh_dynamics_algorithm.h"
 #include "sphinxsys_variable.h"
+
+#include <atomic>
+#include <mutex>
+
 namespace SPH
 {
 enum class UsageType
@@ -56,6 +60,9 @@ class LevelSet : public BaseMeshField
              Shape &shape, SPHAdaptation &sph_adaptation, Real refinement_ratio = 1.0);
     LevelSet(BoundingBoxd tentative_bounds, MeshWithGridDataPackagesType *coarse_data,
              Shape &shape, SPHAdaptation &sph_adaptation, Real refinement_ratio = 1.0);
+    /** restore the mesh levels written by writeToCache without probing the shape again. */
+    LevelSet(BoundingBoxd tentative_bounds, std::ifstream &cache_file,
+             Shape &shape, SPHAdaptation &sph_adaptation, Real refinement_ratio = 1.0);
     ~LevelSet() {};
 
     template <class ExecutionPolicy>
@@ -64,13 +71,22 @@ class LevelSet : public BaseMeshField
     template <class ExecutionPolicy>
     ProbeNormalDirection getProbeNormalDirection(const ExecutionPolicy &ex_policy);
 
+    template <class ExecutionPolicy>
+    ProbeLevelSetGradient getProbeLevelSetGradient(const ExecutionPolicy &ex_policy);
+
+    template <class ExecutionPolicy>
+    ProbeKernelIntegral getProbeKernelIntegral(const ExecutionPolicy &ex_policy);
+
     template <class ExecutionPolicy>
     ProbeKernelGradientIntegral getProbeKernelGradientIntegral(const ExecutionPolicy &ex_policy);
 
     template <class ExecutionPolicy>
     void finishInitialization(const ExecutionPolicy &ex_policy, UsageType usage_type);
     void cleanInterface(UnsignedInt repeat_times);
+    /** redistance the band by block fast sweeping instead of iterative reinitialization. */
+    void cleanInterfaceByFastSweeping(UnsignedInt repeat_times);
     void correctTopology();
+    void writeToCache(std::ofstream &cache_file);
     Real probeSignedDistance(const Vecd &position);
     Vecd probeNormalDirection(const Vecd &position);
     Vecd probeLevelSetGradient(const Vecd &position);
@@ -78,6 +94,10 @@ class LevelSet : public BaseMeshField
     Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0);
     Matd probeKernelSecondGradientIntegral(const Vecd &position, Real h_ratio = 1.0);
     StdVec<MeshWithGridDataPackagesType *> getMeshLevels() { return mesh_data_set_; };
+    /** Rigidly move the level set without rebuild, i.e. the host and device probes
+     * transform the positions into the frame in which the level set was built. */
+    void setTransform(const Transform &transform);
+    MemoryUsage getMemoryUsage();
 
     template <typename DataType>
     void addMeshVariableToWrite(const std::string &variable_name);
@@ -85,6 +105,9 @@ class LevelSet : public BaseMeshField
     template <typename DataType>
     void addBKGMeshVariableToWrite(const std::string &variable_name);
     void writeBKGMeshToPlt(const std::string &partial_file_name) override;
+    /** The core packages of each level are written to a binary VTK file,
+     *  while the level set is reloaded from the cache written by writeToCache. */
+    void writeMeshFieldToVtp(const std::string &partial_file_name) override;
     template <class ExecutionPolicy>
     void syncMeshVariablesToWrite(ExecutionPolicy &ex_policy);
     template <class ExecutionPolicy>
@@ -98,6 +121,11 @@ class LevelSet : public BaseMeshField
 
     void initializeLevel(Real reference_data_spacing, BoundingBoxd tentative_bounds,
                          MeshWithGridDataPackagesType *coarse_data = nullptr);
+    void initializeLevelFromCache(Real data_spacing, BoundingBoxd tentative_bounds, std::ifstream &cache_file);
+    template <typename DataType>
+    void writeVariableToCache(std::ofstream &cache_file, DiscreteVariable<DataType> &variable);
+    template <typename DataType>
+    void readVariableFromCache(std::ifstream &cache_file, DiscreteVariable<DataType> &variable);
     template <class ExecutionPolicy>
     void initializeMeshVariables(const ExecutionPolicy &ex_policy);
     template <class ExecutionPolicy>
@@ -105,7 +133,15 @@ class LevelSet : public BaseMeshField
     template <class ExecutionPolicy>
     void registerProbes(const ExecutionPolicy &ex_policy);
     template <class ExecutionPolicy>
-    void registerKernelIntegralProbes(const ExecutionPolicy &ex_policy);
+    void registerKernelIntegralProbes(const ExecutionPolicy &ex_policy, size_t level);
+    template <class ExecutionPolicy>
+    void registerKernelSecondGradientIntegralProbe(const ExecutionPolicy &ex_policy, size_t level);
+    /** The kernel integrals of the coarser levels and the second gradient integrals are
+     * computed on host at the first probe. As the probes may be called from parallel loops,
+     * the computing is sequenced within the lock to avoid nested parallel regions. */
+    void prepareKernelIntegrals(size_t level);
+    void prepareKernelSecondGradientIntegrals(size_t level);
+    void updatePreparedKernelSecondGradientIntegrals();
 
     size_t total_levels_; /**< level 0 is the coarsest */
     Shape &shape_;        /**< the geometry is described by the level set. */
@@ -122,6 +158,9 @@ class LevelSet : public BaseMeshField
     StdVec<ProbeKernelIntegral *> probe_kernel_integral_set_;
     StdVec<ProbeKernelGradientIntegral *> probe_kernel_gradient_integral_set_;
     StdVec<ProbeKernelSecondGradientIntegral *> probe_kernel_second_gradient_integral_set_;
+    std::vector<std::atomic<bool>> is_kernel_integral_prepared_;
+    std::vector<std::atomic<bool>> is_kernel_second_gradient_prepared_;
+    std::mutex kernel_integral_mutex_;
     UniquePtrsKeeper<MeshWithGridDataPackagesType> mesh_data_ptr_vector_keeper_;
     UniquePtrsKeeper<ProbeSignedDistance> probe_signed_distance_vector_keeper_;
     UniquePtrsKeeper<ProbeNormalDirection> probe_normal_direction_vector_keeper_;
@@ -132,6 +171,7 @@ class LevelSet : public BaseMeshField
 
     UniquePtr<BaseDynamics<void>> correct_topology_keeper_;
     UniquePtr<BaseDynamics<void>> clean_interface_keeper_;
+    UniquePtr<BaseDynamics<void>> fast_sweeping_clean_interface_keeper_;
     UniquePtrsKeeper<NeighborMethod<SPHAdaptation, SPHAdaptation>> neighbor_method_keeper_;
     std::function<void()> sync_mesh_variables_to_write_, sync_bkg_mesh_variables_to_write_, sync_mesh_variables_to_probe_;
 
@@ -6,11 +6,31 @@
 namespace SPH
 {
 //=================================================================================================//
+template <typename DataType>
+void LevelSet::writeVariableToCache(std::ofstream &cache_file, DiscreteVariable<DataType> &variable)
+{
+    cache_file.write(reinterpret_cast<const char *>(variable.Data()), variable.getDataSize() * sizeof(DataType));
+}
+//=================================================================================================//
+template <typename DataType>
+void LevelSet::readVariableFromCache(std::ifstream &cache_file, DiscreteVariable<DataType> &variable)
+{
+    cache_file.read(reinterpret_cast<char *>(variable.Data()), variable.getDataSize() * sizeof(DataType));
+    if (!cache_file)
+    {
+        std::cout << "\n Error: the level set cache is incomplete for " << variable.Name() << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy>
 void LevelSet::configLevelSetPostProcesses(const ExecutionPolicy &ex_policy)
 {
     clean_interface_keeper_ = makeUnique<CleanInterface<ExecutionPolicy>>(
         *mesh_data_set_.back(), *neighbor_method_set_.back(), refinement_ratio_);
+    fast_sweeping_clean_interface_keeper_ = makeUnique<CleanInterfaceByFastSweeping<ExecutionPolicy>>(
+        *mesh_data_set_.back(), *neighbor_method_set_.back(), refinement_ratio_);
     correct_topology_keeper_ = makeUnique<CorrectTopology<ExecutionPolicy>>(
         *mesh_data_set_.back(), *neighbor_method_set_.back());
 }
@@ -56,7 +76,6 @@ void LevelSet::finishInitialization(const ExecutionPolicy &ex_policy, UsageType
     if (usage_type == UsageType::Volumetric)
     {
         initializeKernelIntegralVariables(ex_policy);
-        registerKernelIntegralProbes(execution::par_host); // register probes on host
         configLevelSetPostProcesses(ex_policy);
     }
 
@@ -75,12 +94,21 @@ void LevelSet::finishInitialization(const ExecutionPolicy &ex_policy, UsageType
 template <class ExecutionPolicy>
 void LevelSet::initializeKernelIntegralVariables(const ExecutionPolicy &ex_policy)
 {
-    for (size_t level = 0; level < total_levels_; level++)
-    {
-        MeshInnerDynamics<ExecutionPolicy, UpdateKernelIntegrals>
-            update_kernel_integrals{*mesh_data_set_[level], *neighbor_method_set_[level]};
-        update_kernel_integrals.exec();
-    }
+    probe_kernel_integral_set_.assign(total_levels_, nullptr);
+    probe_kernel_gradient_integral_set_.assign(total_levels_, nullptr);
+    probe_kernel_second_gradient_integral_set_.assign(total_levels_, nullptr);
+    is_kernel_integral_prepared_ = std::vector<std::atomic<bool>>(total_levels_);
+    is_kernel_second_gradient_prepared_ = std::vector<std::atomic<bool>>(total_levels_);
+
+    // only the finest level is computed in advance, as it is used by the device probes and post processes
+    size_t finest_level = total_levels_ - 1;
+    MeshInnerDynamics<ExecutionPolicy, UpdateKernelIntegrals>
+        update_kernel_integrals{*mesh_data_set_[finest_level], *neighbor_method_set_[finest_level]};
+    update_kernel_integrals.exec();
+    registerKernelIntegralProbes(execution::par_host, finest_level); // register probes on host
+    mesh_data_set_[finest_level]->addMeshVariableToProbe<Real>("KernelWeight");
+    mesh_data_set_[finest_level]->addMeshVariableToProbe<Vecd>("KernelGradient");
+    is_kernel_integral_prepared_[finest_level].store(true);
 }
 //=================================================================================================//
 template <class ExecutionPolicy>
@@ -96,6 +124,18 @@ ProbeNormalDirection LevelSet::getProbeNormalDirection(const ExecutionPolicy &ex
 }
 //=================================================================================================//
 template <class ExecutionPolicy>
+ProbeLevelSetGradient LevelSet::getProbeLevelSetGradient(const ExecutionPolicy &ex_policy)
+{
+    return ProbeLevelSetGradient(ex_policy, mesh_data_set_[total_levels_ - 1]);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+ProbeKernelIntegral LevelSet::getProbeKernelIntegral(const ExecutionPolicy &ex_policy)
+{
+    return ProbeKernelIntegral(ex_policy, mesh_data_set_[total_levels_ - 1]);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
 ProbeKernelGradientIntegral LevelSet::getProbeKernelGradientIntegral(const ExecutionPolicy &ex_policy)
 {
     return ProbeKernelGradientIntegral(ex_policy, mesh_data_set_[total_levels_ - 1]);
@@ -126,23 +166,22 @@ void LevelSet::registerProbes(const ExecutionPolicy &ex_policy)
 }
 //=================================================================================================//
 template <class ExecutionPolicy>
-void LevelSet::registerKernelIntegralProbes(const ExecutionPolicy &ex_policy)
+void LevelSet::registerKernelIntegralProbes(const ExecutionPolicy &ex_policy, size_t level)
 {
-    for (size_t level = 0; level < total_levels_; level++)
-    {
-        probe_kernel_integral_set_.push_back(
-            probe_kernel_integral_vector_keeper_
-                .template createPtr<ProbeKernelIntegral>(ex_policy, mesh_data_set_[level]));
-        probe_kernel_gradient_integral_set_.push_back(
-            probe_kernel_gradient_integral_vector_keeper_
-                .template createPtr<ProbeKernelGradientIntegral>(ex_policy, mesh_data_set_[level]));
-        probe_kernel_second_gradient_integral_set_.push_back(
-            probe_kernel_second_gradient_integral_vector_keeper_
-                .template createPtr<ProbeKernelSecondGradientIntegral>(ex_policy, mesh_data_set_[level]));
-        mesh_data_set_[level]->addMeshVariableToProbe<Real>("KernelWeight");
-        mesh_data_set_[level]->addMeshVariableToProbe<Vecd>("KernelGradient");
-        mesh_data_set_[level]->addMeshVariableToProbe<Matd>("KernelSecondGradient");
-    }
+    probe_kernel_integral_set_[level] =
+        probe_kernel_integral_vector_keeper_
+            .template createPtr<ProbeKernelIntegral>(ex_policy, mesh_data_set_[level]);
+    probe_kernel_gradient_integral_set_[level] =
+        probe_kernel_gradient_integral_vector_keeper_
+            .template createPtr<ProbeKernelGradientIntegral>(ex_policy, mesh_data_set_[level]);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void LevelSet::registerKernelSecondGradientIntegralProbe(const ExecutionPolicy &ex_policy, size_t level)
+{
+    probe_kernel_second_gradient_integral_set_[level] =
+        probe_kernel_second_gradient_integral_vector_keeper_
+            .template createPtr<ProbeKernelSecondGradientIntegral>(ex_policy, mesh_data_set_[level]);
 }
 //=================================================================================================//
 template <typename DataType>
@@ -22,6 +22,17 @@ ReinitializeLevelSet::ReinitializeLevelSet(MeshWithGridDataPackagesType &data_me
       mv_near_interface_id_(*data_mesh.getMeshVariable<int>("NearInterfaceID")),
       dv_cell_neighborhood_(data_mesh.getCellNeighborhood()) {}
 //=============================================================================================//
+InitializeSweepingBand::InitializeSweepingBand(MeshWithGridDataPackagesType &data_mesh)
+    : BaseMeshLocalDynamics(data_mesh),
+      mv_phi_(*data_mesh.getMeshVariable<Real>("LevelSet")),
+      mv_near_interface_id_(*data_mesh.getMeshVariable<int>("NearInterfaceID")) {}
+//=============================================================================================//
+FastSweepLevelSet::FastSweepLevelSet(MeshWithGridDataPackagesType &data_mesh)
+    : BaseMeshLocalDynamics(data_mesh),
+      mv_phi_(*data_mesh.getMeshVariable<Real>("LevelSet")),
+      mv_near_interface_id_(*data_mesh.getMeshVariable<int>("NearInterfaceID")),
+      dv_cell_neighborhood_(data_mesh.getCellNeighborhood()) {}
+//=============================================================================================//
 RedistanceInterface::RedistanceInterface(MeshWithGridDataPackagesType &data_mesh)
     : BaseMeshLocalDynamics(data_mesh),
       mv_phi_(*data_mesh.getMeshVariable<Real>("LevelSet")),
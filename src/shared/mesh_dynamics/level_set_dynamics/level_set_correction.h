@@ -64,6 +64,71 @@ class ReinitializeLevelSet : public BaseMeshLocalDynamics
     DiscreteVariable<CellNeighborhood> &dv_cell_neighborhood_;
 };
 
+/**
+ * @class InitializeSweepingBand
+ * @brief Reset the non-cut data in the band to the far-field distance
+ * with the sign kept, so that the following sweeps only lower the magnitudes.
+ */
+class InitializeSweepingBand : public BaseMeshLocalDynamics
+{
+  public:
+    explicit InitializeSweepingBand(MeshWithGridDataPackagesType &data_mesh);
+    virtual ~InitializeSweepingBand() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(const UnsignedInt &index);
+
+      protected:
+        Real far_field_distance_;
+        MeshVariableData<Real> *phi_;
+        MeshVariableData<int> *near_interface_id_;
+    };
+
+  protected:
+    MeshVariable<Real> &mv_phi_;
+    MeshVariable<int> &mv_near_interface_id_;
+};
+
+/**
+ * @class FastSweepLevelSet
+ * @brief Block fast sweeping of the Eikonal equation |grad phi| = 1.
+ * Within a package, the data are swept in all 2^d orderings with Gauss-Seidel updates
+ * from the Godunov upwind solution. The data of the neighbor packages are only read,
+ * so that the packages are swept in parallel and the information crosses
+ * at least one package per execution. The cut cells are kept fixed.
+ */
+class FastSweepLevelSet : public BaseMeshLocalDynamics
+{
+  public:
+    explicit FastSweepLevelSet(MeshWithGridDataPackagesType &data_mesh);
+    virtual ~FastSweepLevelSet() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(const UnsignedInt &index);
+
+      protected:
+        Real data_spacing_;
+        MeshVariableData<Real> *phi_;
+        MeshVariableData<int> *near_interface_id_;
+        CellNeighborhood *cell_neighborhood_;
+
+        Real solveEikonal(Vecd upwind_distance);
+    };
+
+  protected:
+    MeshVariable<Real> &mv_phi_;
+    MeshVariable<int> &mv_near_interface_id_;
+    DiscreteVariable<CellNeighborhood> &dv_cell_neighborhood_;
+};
+
 class MarkCutInterfaces : public BaseMeshLocalDynamics
 {
   public:
@@ -226,6 +291,56 @@ class CleanInterface : public RepeatTimes, public BaseMeshDynamics, public BaseD
     MeshInnerDynamics<ExecutionPolicy, ReinitializeLevelSet> reinitialize_level_set{mesh_data_};
 };
 
+/**
+ * @class CleanInterfaceByFastSweeping
+ * @brief Clean the interface as CleanInterface but redistance the band
+ * by block fast sweeping instead of the iterative reinitialization.
+ * The number of sweeps is the buffer width so that the whole band is reached.
+ */
+template <class ExecutionPolicy>
+class CleanInterfaceByFastSweeping : public RepeatTimes, public BaseMeshDynamics, public BaseDynamics<void>
+{
+  public:
+    explicit CleanInterfaceByFastSweeping(MeshWithGridDataPackagesType &mesh_data,
+                                          NeighborMethod<SPHAdaptation, SPHAdaptation> &neighbor_method,
+                                          Real refinement_ratio)
+        : RepeatTimes(), BaseMeshDynamics(mesh_data), BaseDynamics<void>(),
+          neighbor_method_(neighbor_method), refinement_ratio_(refinement_ratio),
+          number_of_sweeps_(index_handler_.BufferWidth()) {};
+    virtual ~CleanInterfaceByFastSweeping() {};
+
+    void exec(Real dt = 0.0) override
+    {
+        for (UnsignedInt k = 0; k != repeat_times_; ++k)
+        {
+            for (UnsignedInt l = 0; l != 2; ++l)
+            {
+                mark_cut_interfaces.exec();
+                redistance_interface.exec();
+            }
+
+            initialize_sweeping_band.exec();
+            for (UnsignedInt m = 0; m != number_of_sweeps_; ++m)
+            {
+                fast_sweep_level_set.exec();
+            }
+        }
+        update_level_set_gradient.exec();
+        update_kernel_integrals.exec();
+    }
+
+  private:
+    NeighborMethod<SPHAdaptation, SPHAdaptation> &neighbor_method_;
+    Real refinement_ratio_;
+    UnsignedInt number_of_sweeps_;
+    MeshInnerDynamics<ExecutionPolicy, UpdateLevelSetGradient> update_level_set_gradient{mesh_data_};
+    MeshInnerDynamics<ExecutionPolicy, UpdateKernelIntegrals> update_kernel_integrals{mesh_data_, neighbor_method_};
+    MeshInnerDynamics<ExecutionPolicy, MarkCutInterfaces> mark_cut_interfaces{mesh_data_, 0.5 * refinement_ratio_};
+    MeshCoreDynamics<ExecutionPolicy, RedistanceInterface> redistance_interface{mesh_data_};
+    MeshInnerDynamics<ExecutionPolicy, InitializeSweepingBand> initialize_sweeping_band{mesh_data_};
+    MeshInnerDynamics<ExecutionPolicy, FastSweepLevelSet> fast_sweep_level_set{mesh_data_};
+};
+
 template <class ExecutionPolicy>
 class CorrectTopology : public BaseMeshDynamics, public BaseDynamics<void>
 {
@@ -62,6 +62,103 @@ inline void ReinitializeLevelSet::UpdateKernel::update(const UnsignedInt &packag
 }
 //=================================================================================================//
 template <class ExecutionPolicy, class EncloserType>
+InitializeSweepingBand::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : far_field_distance_(encloser.index_handler_.GridSpacing() *
+                          (Real)encloser.index_handler_.BufferWidth()),
+      phi_(encloser.mv_phi_.DelegatedData(ex_policy)),
+      near_interface_id_(encloser.mv_near_interface_id_.DelegatedData(ex_policy)) {}
+//=============================================================================================//
+inline void InitializeSweepingBand::UpdateKernel::update(const UnsignedInt &package_index)
+{
+    auto &phi_pkg = phi_[package_index];
+    auto &near_interface_id_pkg = near_interface_id_[package_index];
+    mesh_for_each(
+        Arrayi::Zero(), Arrayi::Constant(pkg_size),
+        [&](const Arrayi &index)
+        {
+            if (near_interface_id_pkg(index) != 0)
+                phi_pkg(index) = phi_pkg(index) > 0.0 ? far_field_distance_ : -far_field_distance_;
+        });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+FastSweepLevelSet::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : data_spacing_(encloser.index_handler_.DataSpacing()),
+      phi_(encloser.mv_phi_.DelegatedData(ex_policy)),
+      near_interface_id_(encloser.mv_near_interface_id_.DelegatedData(ex_policy)),
+      cell_neighborhood_(encloser.dv_cell_neighborhood_.DelegatedData(ex_policy)) {}
+//=================================================================================================//
+inline Real FastSweepLevelSet::UpdateKernel::solveEikonal(Vecd upwind_distance)
+{
+    // sort the upwind distances in ascending order
+    for (int i = 0; i != Dimensions - 1; ++i)
+        for (int j = 0; j != Dimensions - 1 - i; ++j)
+            if (upwind_distance[j] > upwind_distance[j + 1])
+            {
+                Real temp = upwind_distance[j];
+                upwind_distance[j] = upwind_distance[j + 1];
+                upwind_distance[j + 1] = temp;
+            }
+
+    // add the upwind directions one by one until the solution is below the next distance
+    Real h2 = data_spacing_ * data_spacing_;
+    Real distance = upwind_distance[0] + data_spacing_;
+    Real sum = upwind_distance[0];
+    Real sum_squares = upwind_distance[0] * upwind_distance[0];
+    for (int k = 1; k != Dimensions; ++k)
+    {
+        if (distance <= upwind_distance[k])
+            break;
+        sum += upwind_distance[k];
+        sum_squares += upwind_distance[k] * upwind_distance[k];
+        Real n = Real(k + 1);
+        distance = (sum + sqrt(SMAX(sum * sum - n * (sum_squares - h2), Real(0)))) / n;
+    }
+    return distance;
+}
+//=============================================================================================//
+inline void FastSweepLevelSet::UpdateKernel::update(const UnsignedInt &package_index)
+{
+    auto &phi_pkg = phi_[package_index];
+    auto &near_interface_id_pkg = near_interface_id_[package_index];
+    auto &neighborhood = cell_neighborhood_[package_index];
+
+    for (int ordering = 0; ordering != (1 << Dimensions); ++ordering)
+    {
+        mesh_for_each(
+            Arrayi::Zero(), Arrayi::Constant(pkg_size),
+            [&](const Arrayi &counter)
+            {
+                Arrayi index = counter;
+                for (int d = 0; d != Dimensions; ++d)
+                    if (ordering & (1 << d))
+                        index[d] = pkg_size - 1 - counter[d];
+
+                if (near_interface_id_pkg(index) != 0)
+                {
+                    Vecd upwind_distance = Vecd::Zero();
+                    for (int d = 0; d != Dimensions; ++d)
+                    {
+                        Arrayi shift = Arrayi::Zero();
+                        shift[d] = 1;
+                        DataPackagePair forward = NeighbourIndexShift<pkg_size>(index + shift, neighborhood);
+                        DataPackagePair backward = NeighbourIndexShift<pkg_size>(index - shift, neighborhood);
+                        upwind_distance[d] = SMIN(ABS(phi_[forward.first](forward.second)),
+                                                  ABS(phi_[backward.first](backward.second)));
+                    }
+
+                    Real phi_0 = phi_pkg(index);
+                    Real distance = solveEikonal(upwind_distance);
+                    if (distance < ABS(phi_0))
+                        phi_pkg(index) = phi_0 > 0.0 ? distance : -distance;
+                }
+            });
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
 MarkCutInterfaces::UpdateKernel::
     UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : index_handler_(encloser.index_handler_),
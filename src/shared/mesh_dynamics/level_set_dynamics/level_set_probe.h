@@ -63,6 +63,11 @@ class ProbeNormalDirection : public ProbeMesh<Vecd, 4>
     {
         return ProbeMesh<Vecd, 4>::operator()(position).normalized();
     }
+
+    Vecd operator()(const Vecd &position, UnsignedInt &package_hint)
+    {
+        return ProbeMesh<Vecd, 4>::operator()(position, package_hint).normalized();
+    }
 };
 
 class ProbeKernelIntegral : public ProbeMesh<Real, 4>
@@ -65,6 +65,12 @@ class UpdateLevelSetGradient : public BaseMeshLocalDynamics
     DiscreteVariable<CellNeighborhood> &dv_cell_neighborhood_;
 };
 
+/**
+ * @class UpdateKernelIntegrals
+ * @brief Compute the kernel integrals by quadrature over the cut cells.
+ * The second gradient integral, storing a full matrix per data point,
+ * is only registered and computed when requested.
+ */
 class UpdateKernelIntegrals : public BaseMeshLocalDynamics
 {
     using SmoothingKernel =
@@ -73,7 +79,8 @@ class UpdateKernelIntegrals : public BaseMeshLocalDynamics
   public:
     explicit UpdateKernelIntegrals(
         MeshWithGridDataPackagesType &data_mesh,
-        NeighborMethod<SPHAdaptation, SPHAdaptation> &neighbor_method);
+        NeighborMethod<SPHAdaptation, SPHAdaptation> &neighbor_method,
+        bool with_second_gradient = false);
     virtual ~UpdateKernelIntegrals() {};
 
     class UpdateKernel
@@ -118,7 +125,7 @@ class UpdateKernelIntegrals : public BaseMeshLocalDynamics
     DiscreteVariable<CellNeighborhood> &dv_cell_neighborhood_;
     MeshVariable<Real> &mv_kernel_weight_;
     MeshVariable<Vecd> &mv_kernel_gradient_;
-    MeshVariable<Matd> &mv_kernel_second_gradient_;
+    MeshVariable<Matd> *mv_kernel_second_gradient_;
 
     void initializeSingularPackages(UnsignedInt package_index, Real far_field_level_set);
 };
@@ -39,7 +39,9 @@ UpdateKernelIntegrals::UpdateKernel::
       phi_gradient_(encloser.mv_phi_gradient_.DelegatedData(ex_policy)),
       kernel_weight_(encloser.mv_kernel_weight_.DelegatedData(ex_policy)),
       kernel_gradient_(encloser.mv_kernel_gradient_.DelegatedData(ex_policy)),
-      kernel_second_gradient_(encloser.mv_kernel_second_gradient_.DelegatedData(ex_policy)),
+      kernel_second_gradient_(encloser.mv_kernel_second_gradient_ != nullptr
+                                  ? encloser.mv_kernel_second_gradient_->DelegatedData(ex_policy)
+                                  : nullptr),
       kernel_(ex_policy, encloser.neighbor_method_),
       data_spacing_(encloser.index_handler_.DataSpacing()),
       data_cell_volume_(math::pow(data_spacing_, Dimensions)),
@@ -56,9 +58,12 @@ inline void UpdateKernelIntegrals::UpdateKernel::update(const UnsignedInt &packa
     assignByDataIndex(
         kernel_gradient_[package_index], [&](const Arrayi &data_index) -> Vecd
         { return computeKernelGradientIntegral(package_index, data_index); });
-    assignByDataIndex(
-        kernel_second_gradient_[package_index], [&](const Arrayi &data_index) -> Matd
-        { return computeKernelSecondGradientIntegral(package_index, data_index); });
+    if (kernel_second_gradient_ != nullptr)
+    {
+        assignByDataIndex(
+            kernel_second_gradient_[package_index], [&](const Arrayi &data_index) -> Matd
+            { return computeKernelSecondGradientIntegral(package_index, data_index); });
+    }
 }
 //=================================================================================================//
 inline Real UpdateKernelIntegrals::UpdateKernel::
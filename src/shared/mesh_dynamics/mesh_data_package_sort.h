@@ -22,7 +22,7 @@
  * ------------------------------------------------------------------------- */
 /**
  * @file mesh_data_package_sort.h
- * @brief TBD
+ * @brief Sorting the data packages of a mesh for memory locality.
  * @author Xiangyu Hu
  */
 
@@ -32,9 +32,16 @@
 #include "base_configuration_dynamics.h"
 #include "mesh_dynamics_algorithm.h"
 
+#include <unordered_map>
+
 namespace SPH
 {
-template <class ExecutionPolicy>
+/**
+ * @class PackageSort
+ * @brief Sort the data packages along a space-filling curve of their cells,
+ * so that the packages probed by neighboring particles are close in memory.
+ */
+template <class ExecutionPolicy, class CellOrdering = MortonOrdering>
 class PackageSort : public BaseMeshDynamics
 {
     using SortMethodType = typename SortMethod<ExecutionPolicy>::type;
@@ -61,15 +68,19 @@ class PackageSort : public BaseMeshDynamics
         UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
             : sequence_(encloser.dv_sequence_->DelegatedData(ex_policy)),
               index_permutation_(encloser.dv_index_permutation_->DelegatedData(ex_policy)),
-              pkg_1d_cell_index_(encloser.dv_pkg_1d_cell_index_->DelegatedData(ex_policy)){};
+              pkg_1d_cell_index_(encloser.dv_pkg_1d_cell_index_->DelegatedData(ex_policy)),
+              index_handler_(encloser.index_handler_){};
         void update(UnsignedInt &pkg_index)
         {
-            sequence_[pkg_index] = pkg_1d_cell_index_[pkg_index];
+            sequence_[pkg_index] =
+                cell_ordering_(index_handler_.DimensionalCellIndex(pkg_1d_cell_index_[pkg_index]));
             index_permutation_[pkg_index] = pkg_index;
         };
 
       protected:
         UnsignedInt *sequence_, *index_permutation_, *pkg_1d_cell_index_;
+        IndexHandler index_handler_;
+        CellOrdering cell_ordering_;
     };
 
     void exec(Real dt = 0.0)
@@ -81,7 +92,24 @@ class PackageSort : public BaseMeshDynamics
                     {
                         update_kernel->update(package_index);
                     });
+        sortPackages(num_grid_pkgs);
+    };
 
+  protected:
+    ExecutionPolicy ex_policy_;
+    SingularVariable<UnsignedInt> &sv_num_grid_pkgs_;
+    using KernelImplementation = Implementation<ExecutionPolicy, PackageSort<ExecutionPolicy, CellOrdering>, UpdateKernel>;
+    KernelImplementation kernel_implementation_;
+    DiscreteVariable<UnsignedInt> *dv_sequence_;
+    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
+    MetaVariable<UnsignedInt> *dv_pkg_1d_cell_index_;
+    BKGMeshVariable<UnsignedInt> *bmv_cell_pkg_index_;
+    OperationOnDataAssemble<MetaVariableAssemble, UpdateSortableVariables<MetaVariable>> update_meta_variables_to_sort_;
+    OperationOnDataAssemble<MeshVariableAssemble, UpdateSortableVariables<MeshVariable>> update_mesh_variables_to_sort_;
+    SortMethodType sort_method_;
+
+    void sortPackages(UnsignedInt num_grid_pkgs)
+    {
         UnsignedInt sortable_size = num_grid_pkgs - num_singular_pkgs_;
         sort_method_.sort(ex_policy_, sortable_size, num_singular_pkgs_);
         update_meta_variables_to_sort_(
@@ -100,19 +128,65 @@ class PackageSort : public BaseMeshDynamics
                         cell_pkg_index[sort_index] = package_index;
                     });
     };
+};
 
-  private:
-    ExecutionPolicy ex_policy_;
-    SingularVariable<UnsignedInt> &sv_num_grid_pkgs_;
-    using KernelImplementation = Implementation<ExecutionPolicy, PackageSort<ExecutionPolicy>, UpdateKernel>;
-    KernelImplementation kernel_implementation_;
-    DiscreteVariable<UnsignedInt> *dv_sequence_;
-    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
-    MetaVariable<UnsignedInt> *dv_pkg_1d_cell_index_;
-    BKGMeshVariable<UnsignedInt> *bmv_cell_pkg_index_;
-    OperationOnDataAssemble<MetaVariableAssemble, UpdateSortableVariables<MetaVariable>> update_meta_variables_to_sort_;
-    OperationOnDataAssemble<MeshVariableAssemble, UpdateSortableVariables<MeshVariable>> update_mesh_variables_to_sort_;
-    SortMethodType sort_method_;
+/**
+ * @class PackageSortByBlocks
+ * @brief Sort the data packages by the dense blocks clustered from their cells,
+ * so that each block is a contiguous range of packages, which is iterated by one thread
+ * with package_block_for for cache reuse in sparse domains.
+ * @details The clustering is done on host, and is only to be redone when the packages change.
+ */
+template <class ExecutionPolicy>
+class PackageSortByBlocks : public PackageSort<ExecutionPolicy>
+{
+  public:
+    explicit PackageSortByBlocks(MeshWithGridDataPackagesType &data_mesh)
+        : PackageSort<ExecutionPolicy>(data_mesh) {};
+    virtual ~PackageSortByBlocks() {};
+    /** The package offsets of the blocks, starting from the first non-singular package. */
+    const StdVec<UnsignedInt> &BlockOffsets() { return block_offsets_; };
+
+    void exec(Real dt = 0.0)
+    {
+        UnsignedInt num_grid_pkgs = this->sv_num_grid_pkgs_.getValue();
+        UnsignedInt num_singular_pkgs = this->num_singular_pkgs_;
+        this->dv_pkg_1d_cell_index_->prepareForOutput(this->ex_policy_);
+        UnsignedInt *pkg_1d_cell_index = this->dv_pkg_1d_cell_index_->Data();
+        UnsignedInt *sequence = this->dv_sequence_->Data();
+        UnsignedInt *index_permutation = this->dv_index_permutation_->Data();
+
+        StdVec<Arrayi> active_cells;
+        std::unordered_map<UnsignedInt, UnsignedInt> cell_package;
+        for (UnsignedInt i = num_singular_pkgs; i != num_grid_pkgs; ++i)
+        {
+            active_cells.push_back(this->index_handler_.DimensionalCellIndex(pkg_1d_cell_index[i]));
+            cell_package[pkg_1d_cell_index[i]] = i;
+        }
+
+        block_offsets_.clear();
+        block_offsets_.push_back(num_singular_pkgs);
+        UnsignedInt count = 0;
+        for (const MeshRange &block : clusterActiveCells(active_cells))
+        {
+            mesh_for_each(block.first, block.second,
+                          [&](const Arrayi &cell_index)
+                          {
+                              UnsignedInt package_index =
+                                  cell_package[this->index_handler_.LinearCellIndex(cell_index)];
+                              sequence[package_index] = count;
+                              index_permutation[package_index] = package_index;
+                              count++;
+                          });
+            block_offsets_.push_back(num_singular_pkgs + count);
+        }
+        this->dv_sequence_->finalizeLoadIn(this->ex_policy_);
+        this->dv_index_permutation_->finalizeLoadIn(this->ex_policy_);
+        this->sortPackages(num_grid_pkgs);
+    };
+
+  protected:
+    StdVec<UnsignedInt> block_offsets_;
 };
 } // namespace SPH
 #endif // MESH_DATA_PACKAGE_SORT_H
\ No newline at end of file
@@ -54,6 +54,8 @@ class Mesh
     Mesh(BoundingBoxd tentative_bounds, Real grid_spacing,
          UnsignedInt buffer_width, UnsignedInt linear_cell_index_offset = 0);
     Mesh(Vecd mesh_lower_bound, Real grid_spacing, Arrayi all_grid_points);
+    /** only for fixed-size mesh arrays, which are assigned later. */
+    Mesh() : Mesh(Vecd::Zero(), 1.0, Arrayi::Ones()) {};
     ~Mesh() {};
 
     Vecd MeshLowerBound() const { return mesh_lower_bound_; };
@@ -63,6 +65,7 @@ class Mesh
     Arrayi AllCells() const { return all_cells_; };
     UnsignedInt NumberOfGridPoints() const { return all_grid_points_.prod(); };
     UnsignedInt NumberOfCells() const { return all_cells_.prod(); };
+    UnsignedInt LinearCellIndexOffset() const { return linear_cell_index_offset_; };
 
     Arrayi CellIndexFromPosition(const Vecd &position) const;
     UnsignedInt LinearCellIndexFromPosition(const Vecd &position) const;
@@ -88,6 +91,14 @@ class Mesh
      */
     static UnsignedInt transferMeshIndexToMortonOrder(const Array2i &mesh_index);
     static UnsignedInt transferMeshIndexToMortonOrder(const Array3i &mesh_index);
+    /** converts mesh index into a Hilbert order with 10 bits for each axis.
+     * The axes are first transposed by Skilling's algorithm
+     * (J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004)
+     * and then interleaved as the Morton order.
+     * Different from the Morton order, consecutive indexes are always neighboring cells.
+     */
+    static UnsignedInt transferMeshIndexToHilbertOrder(const Array2i &mesh_index);
+    static UnsignedInt transferMeshIndexToHilbertOrder(const Array3i &mesh_index);
 
   protected:
     Vecd mesh_lower_bound_;                /**< mesh lower bound as reference coordinate */
@@ -97,7 +108,29 @@ class Mesh
     Arrayi all_cells_;                     /**< number of cells by dimension */
     UnsignedInt linear_cell_index_offset_; /**< offset for linear cell index, used for sub-mesh */
 
-    static UnsignedInt MortonCode(const UnsignedInt &i);
+    static constexpr UnsignedInt MortonCode(const UnsignedInt &i);
+    template <int Dimensions>
+    static void transposeToHilbertAxes(UnsignedInt (&axes)[Dimensions]);
+};
+
+/** The cells are ordered along the Morton (Z-order) curve. */
+struct MortonOrdering
+{
+    template <typename CellIndexType>
+    UnsignedInt operator()(const CellIndexType &cell_index) const
+    {
+        return Mesh::transferMeshIndexToMortonOrder(cell_index);
+    };
+};
+
+/** The cells are ordered along the Hilbert curve, which gives better locality than the Morton curve. */
+struct HilbertOrdering
+{
+    template <typename CellIndexType>
+    UnsignedInt operator()(const CellIndexType &cell_index) const
+    {
+        return Mesh::transferMeshIndexToHilbertOrder(cell_index);
+    };
 };
 
 /**
@@ -119,6 +152,8 @@ class BaseMeshField
     virtual void writeMeshFieldToPlt(const std::string &partial_file_name, size_t sequence = 0) = 0;
     /** output mesh data for Tecplot visualization */
     virtual void writeBKGMeshToPlt(const std::string &partial_file_name) {};
+    /** output mesh data in binary VTK format for ParaView visualization */
+    virtual void writeMeshFieldToVtp(const std::string &partial_file_name) {};
 };
 
 class MultiLevelMeshField : public BaseMeshField
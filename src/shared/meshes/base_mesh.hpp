@@ -87,7 +87,7 @@ inline UnsignedInt Mesh::transferMeshIndexToMortonOrder(const Array3i &mesh_inde
     return MortonCode(mesh_index[0]) | (MortonCode(mesh_index[1]) << 1) | (MortonCode(mesh_index[2]) << 2);
 }
 //=================================================================================================//
-inline UnsignedInt Mesh::MortonCode(const UnsignedInt &i)
+constexpr UnsignedInt Mesh::MortonCode(const UnsignedInt &i)
 {
     UnsignedInt x = i;
     x &= 0x3ff;
@@ -97,6 +97,65 @@ inline UnsignedInt Mesh::MortonCode(const UnsignedInt &i)
     x = (x | x << 2) & 0x9249249;
     return x;
 }
+//=================================================================================================//
+template <int Dimensions>
+inline void Mesh::transposeToHilbertAxes(UnsignedInt (&axes)[Dimensions])
+{
+    constexpr UnsignedInt highest_bit = 1 << 9;
+    for (int i = 0; i != Dimensions; ++i)
+    {
+        axes[i] &= 0x3ff;
+    }
+    // inverse undo
+    for (UnsignedInt q = highest_bit; q > 1; q >>= 1)
+    {
+        UnsignedInt p = q - 1;
+        for (int i = 0; i != Dimensions; ++i)
+        {
+            if (axes[i] & q)
+            {
+                axes[0] ^= p; // invert
+            }
+            else
+            {
+                UnsignedInt t = (axes[0] ^ axes[i]) & p; // exchange
+                axes[0] ^= t;
+                axes[i] ^= t;
+            }
+        }
+    }
+    // Gray encode
+    for (int i = 1; i != Dimensions; ++i)
+    {
+        axes[i] ^= axes[i - 1];
+    }
+    UnsignedInt t = 0;
+    for (UnsignedInt q = highest_bit; q > 1; q >>= 1)
+    {
+        if (axes[Dimensions - 1] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    for (int i = 0; i != Dimensions; ++i)
+    {
+        axes[i] ^= t;
+    }
+}
+//=================================================================================================//
+inline UnsignedInt Mesh::transferMeshIndexToHilbertOrder(const Array2i &mesh_index)
+{
+    UnsignedInt axes[2] = {UnsignedInt(mesh_index[0]), UnsignedInt(mesh_index[1])};
+    transposeToHilbertAxes(axes);
+    return (MortonCode(axes[0]) << 1) | MortonCode(axes[1]);
+}
+//=================================================================================================//
+inline UnsignedInt Mesh::transferMeshIndexToHilbertOrder(const Array3i &mesh_index)
+{
+    UnsignedInt axes[3] = {UnsignedInt(mesh_index[0]), UnsignedInt(mesh_index[1]), UnsignedInt(mesh_index[2])};
+    transposeToHilbertAxes(axes);
+    return (MortonCode(axes[0]) << 2) | (MortonCode(axes[1]) << 1) | MortonCode(axes[2]);
+}
 //=============================================================================================//
 template <typename DataType>
 DiscreteVariable<DataType> *MultiLevelMeshField::getCellVariable(
@@ -1,5 +1,6 @@
 #include "cell_linked_list.h"
 #include "adaptation.h"
+#include "base_body.h"
 #include "base_kernel.h"
 #include "base_particles.h"
 #include "mesh_iterators.hpp"
@@ -24,6 +25,28 @@ BaseCellLinkedList::BaseCellLinkedList(
     cell_data_lists_.resize(total_number_of_cells_);
 }
 //=================================================================================================//
+PeriodicImage &BaseCellLinkedList::getPeriodicImage()
+{
+    return base_particles_.getSPHBody().getPeriodicImage();
+}
+//=================================================================================================//
+MemoryUsage BaseCellLinkedList::getMemoryUsage()
+{
+    MemoryUsage memory_usage = dv_particle_index_->getMemoryUsage();
+    memory_usage += dv_cell_offset_->getMemoryUsage();
+    memory_usage.host_bytes_ += cell_index_lists_.capacity() * sizeof(ConcurrentIndexVector) +
+                                cell_data_lists_.capacity() * sizeof(ListDataVector);
+    for (size_t i = 0; i != cell_index_lists_.size(); ++i)
+    {
+        memory_usage.host_bytes_ += cell_index_lists_[i].capacity() * sizeof(size_t);
+    }
+    for (size_t i = 0; i != cell_data_lists_.size(); ++i)
+    {
+        memory_usage.host_bytes_ += cell_data_lists_[i].capacity() * sizeof(ListData);
+    }
+    return memory_usage;
+}
+//=================================================================================================//
 void BaseCellLinkedList::clearCellLists()
 {
     parallel_for(
@@ -63,9 +86,18 @@ void BaseCellLinkedList::UpdateCellListData(BaseParticles &base_particles)
 void BaseCellLinkedList::tagBodyPartByCellByMesh(Mesh &mesh, ConcurrentCellLists &cell_lists,
                                                  ConcurrentIndexVector &cell_indexes,
                                                  std::function<bool(Vecd, Real)> &check_included)
+{
+    tagBodyPartByCellByMesh(mesh, MeshRange(Arrayi::Zero(), mesh.AllCells()),
+                            cell_lists, cell_indexes, check_included);
+}
+//=================================================================================================//
+void BaseCellLinkedList::tagBodyPartByCellByMesh(Mesh &mesh, const MeshRange &mesh_range,
+                                                 ConcurrentCellLists &cell_lists,
+                                                 ConcurrentIndexVector &cell_indexes,
+                                                 std::function<bool(Vecd, Real)> &check_included)
 {
     mesh_parallel_for(
-        MeshRange(Arrayi::Zero(), mesh.AllCells()),
+        mesh_range,
         [&](const Arrayi &cell_index)
         {
             bool is_included = false;
@@ -107,6 +139,29 @@ void BaseCellLinkedList::UpdateCellLists(BaseParticles &base_particles)
     UpdateCellListData(base_particles);
 }
 //=================================================================================================//
+void BaseCellLinkedList::tagOccupiedCellBand(Mesh &mesh, int search_depth, StdVec<char> &cell_band)
+{
+    cell_band.resize(cell_data_lists_.size());
+    UnsignedInt lower = mesh.LinearCellIndexOffset();
+    UnsignedInt upper = lower + mesh.NumberOfCells();
+    std::fill(cell_band.begin() + lower, cell_band.begin() + upper, 0);
+    // A few cells are occupied by the particles of a shell, the band is tagged sequentially.
+    for (UnsignedInt i = lower; i != upper; ++i)
+    {
+        if (!cell_data_lists_[i].empty())
+        {
+            Arrayi cell_index = mesh.DimensionalCellIndex(i);
+            mesh_for_each(
+                Arrayi::Zero().max(cell_index - search_depth * Arrayi::Ones()),
+                mesh.AllCells().min(cell_index + (search_depth + 1) * Arrayi::Ones()),
+                [&](const Arrayi &neighbor_cell)
+                {
+                    cell_band[mesh.LinearCellIndex(neighbor_cell)] = 1;
+                });
+        }
+    }
+}
+//=================================================================================================//
 void BaseCellLinkedList::findNearestListDataEntryByMesh(Mesh &mesh, Real &min_distance_sqr, ListData &nearest_entry,
                                                         const Vecd &position)
 {
@@ -154,6 +209,59 @@ void BaseCellLinkedList::tagBodyPartByCell(ConcurrentCellLists &cell_lists,
     }
 }
 //=================================================================================================//
+MeshRange BaseCellLinkedList::sweptCellRange(Mesh &mesh, const BoundingBoxd &swept_bounds)
+{
+    // the tagging criterion is evaluated within one grid spacing of the region
+    // and a cell is tagged when any cell of its neighbor stencil fulfills it
+    Arrayi lower = mesh.CellIndexFromPosition(swept_bounds.lower_) - 2 * Arrayi::Ones();
+    Arrayi upper = mesh.CellIndexFromPosition(swept_bounds.upper_) + 3 * Arrayi::Ones();
+    return MeshRange(Arrayi::Zero().max(lower), mesh.AllCells().min(upper));
+}
+//=================================================================================================//
+void BaseCellLinkedList::retagBodyPartByCell(ConcurrentCellLists &cell_lists,
+                                             ConcurrentIndexVector &cell_indexes,
+                                             std::function<bool(Vecd, Real)> &check_included,
+                                             const BoundingBoxd &swept_bounds)
+{
+    StdVec<MeshRange> swept_ranges;
+    for (UnsignedInt l = 0; l != meshes_.size(); ++l)
+    {
+        swept_ranges.push_back(sweptCellRange(*meshes_[l], swept_bounds));
+    }
+
+    ConcurrentCellLists retagged_cell_lists;
+    ConcurrentIndexVector retagged_cell_indexes;
+    for (size_t i = 0; i != cell_indexes.size(); ++i)
+    {
+        bool is_swept = false;
+        for (UnsignedInt l = 0; l != meshes_.size(); ++l)
+        {
+            Mesh &mesh = *meshes_[l];
+            UnsignedInt offset = mesh.LinearCellIndexOffset();
+            if (cell_indexes[i] >= offset && cell_indexes[i] < offset + mesh.NumberOfCells())
+            {
+                Arrayi cell_index = mesh.DimensionalCellIndex(cell_indexes[i]);
+                is_swept = (cell_index >= swept_ranges[l].first).all() &&
+                           (cell_index < swept_ranges[l].second).all();
+                break;
+            }
+        }
+        if (!is_swept)
+        {
+            retagged_cell_lists.push_back(cell_lists[i]);
+            retagged_cell_indexes.push_back(cell_indexes[i]);
+        }
+    }
+
+    for (UnsignedInt l = 0; l != meshes_.size(); ++l)
+    {
+        tagBodyPartByCellByMesh(*meshes_[l], swept_ranges[l],
+                                retagged_cell_lists, retagged_cell_indexes, check_included);
+    }
+    cell_lists.swap(retagged_cell_lists);
+    cell_indexes.swap(retagged_cell_indexes);
+}
+//=================================================================================================//
 void BaseCellLinkedList::tagBoundingCells(StdVec<CellLists> &cell_data_lists,
                                           const BoundingBoxd &bounding_bounds, int axis)
 {
@@ -180,6 +288,44 @@ void CellLinkedList ::InsertListDataEntry(UnsignedInt particle_index, const Vecd
     cell_data_lists_[linear_index].emplace_back(std::make_pair(particle_index, particle_position));
 }
 //=================================================================================================//
+DiscreteVariable<UnsignedInt> *CellLinkedList::enableCellBlocks(UnsignedInt block_shift)
+{
+    if (dv_block_size_ != nullptr)
+    {
+        if (block_shift != block_shift_)
+        {
+            std::cout << "\n Error: the cell blocks of " << base_particles_.getSPHBody().getName()
+                      << " are enabled with another block size!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        return dv_block_size_;
+    }
+
+    block_shift_ = block_shift;
+    UnsignedInt cells_per_block = UnsignedInt(1) << block_shift_;
+    number_of_blocks_ = (total_number_of_cells_ + cells_per_block - 1) >> block_shift_;
+    dv_block_size_ = unique_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+        "BlockSize", number_of_blocks_ + 1);
+    return dv_block_size_;
+}
+//=================================================================================================//
+MultilevelMeshes::MultilevelMeshes(StdVec<Mesh *> &meshes)
+    : total_levels_(meshes.size())
+{
+    if (total_levels_ > MaxLevels)
+    {
+        std::cout << "\n Error: the number of mesh levels exceeds " << MaxLevels << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    for (UnsignedInt level = 0; level != total_levels_; ++level)
+    {
+        meshes_[level] = *meshes[level];
+    }
+}
+//=================================================================================================//
 MultilevelCellLinkedList::MultilevelCellLinkedList(
     BoundingBoxd tentative_bounds, Real reference_grid_spacing, UnsignedInt total_levels,
     BaseParticles &base_particles, SPHAdaptation &sph_adaptation)
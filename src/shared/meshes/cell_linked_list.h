@@ -34,15 +34,19 @@
 
 #include "base_mesh.hpp"
 #include "execution_policy.h"
+#include "mesh_iterators.h"
 #include "neighborhood.h"
+#include "periodic_image.h"
 
 namespace SPH
 {
 
 class BaseParticles;
+class SPHBody;
 class Kernel;
 class SPHAdaptation;
 class CellLinkedList;
+class MultilevelCellLinkedList;
 
 /**
  * @class BaseCellLinkedList
@@ -74,6 +78,12 @@ class BaseCellLinkedList : public MultiLevelMeshField
     void tagBodyPartByCell(ConcurrentCellLists &cell_lists,
                            ConcurrentIndexVector &cell_indexes,
                            std::function<bool(Vecd, Real)> &check_included);
+    /** Re-tag body part by cell only within the swept bounds, e.g. the union of the old and new bounds of
+     *  a moving region, while the tagged cells outside are kept. */
+    void retagBodyPartByCell(ConcurrentCellLists &cell_lists,
+                             ConcurrentIndexVector &cell_indexes,
+                             std::function<bool(Vecd, Real)> &check_included,
+                             const BoundingBoxd &swept_bounds);
     /** Tag domain bounding cells in an axis direction, called by domain bounding classes */
     void tagBoundingCells(StdVec<CellLists> &cell_data_lists, const BoundingBoxd &bounding_bounds, int axis);
 
@@ -85,8 +95,29 @@ class BaseCellLinkedList : public MultiLevelMeshField
     template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
     void searchNeighborsByMesh(Mesh &mesh, DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
                                GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
+    /** particle search in the frame in which the list was built, e.g. the initial frame of a rigid body,
+     *  by transforming the query positions only */
+    template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
+    void searchNeighborsByMeshInFrame(Mesh &mesh, DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
+                                      GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation,
+                                      Transform &frame_transform);
+    /** particle search only for the particles located in the tagged cell band,
+     *  e.g. along the surface of a shell body, as the other particles have no neighbor */
+    template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
+    void searchNeighborsByMeshInBand(Mesh &mesh, DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
+                                     GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation,
+                                     const StdVec<char> &cell_band);
+    /** Tag the cells within the search depth of the occupied cells, i.e. a band along a shell surface. */
+    void tagOccupiedCellBand(Mesh &mesh, int search_depth, StdVec<char> &cell_band);
+    /** particle search for the compact configuration by neighbor counting, prefix sum and filling */
+    template <typename GetSearchDepth, typename GetNeighborRelation>
+    void searchNeighborsByMesh(Mesh &mesh, SPHBody &sph_body, CompactParticleConfiguration &compact_configuration,
+                               GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
     DiscreteVariable<UnsignedInt> *dvParticleIndex() { return dv_particle_index_; };
     DiscreteVariable<UnsignedInt> *dvCellOffset() { return dv_cell_offset_; };
+    PeriodicImage &getPeriodicImage();
+    /** Host and device bytes of the cell lists and the sorted particle index lists. */
+    MemoryUsage getMemoryUsage();
 
   protected:
     Kernel &kernel_;
@@ -104,10 +135,19 @@ class BaseCellLinkedList : public MultiLevelMeshField
     void tagBodyPartByCellByMesh(Mesh &mesh, ConcurrentCellLists &cell_lists,
                                  ConcurrentIndexVector &cell_indexes,
                                  std::function<bool(Vecd, Real)> &check_included);
+    void tagBodyPartByCellByMesh(Mesh &mesh, const MeshRange &mesh_range, ConcurrentCellLists &cell_lists,
+                                 ConcurrentIndexVector &cell_indexes,
+                                 std::function<bool(Vecd, Real)> &check_included);
+    /** The cells whose tags may change when a region moves within the swept bounds. */
+    MeshRange sweptCellRange(Mesh &mesh, const BoundingBoxd &swept_bounds);
     void tagBoundingCellsByMesh(Mesh &mesh, StdVec<CellLists> &cell_data_lists,
                                 const BoundingBoxd &bounding_bounds, int axis);
     void findNearestListDataEntryByMesh(Mesh &mesh, Real &min_distance_sqr, ListData &nearest_entry,
                                         const Vecd &position);
+    template <typename GetNeighborRelation>
+    void searchNeighborsOfParticle(Mesh &mesh, const Vecd &pos_i, UnsignedInt index_i, int search_depth,
+                                   Neighborhood &neighborhood, GetNeighborRelation &get_neighbor_relation,
+                                   const StdVec<char> *cell_band = nullptr);
     /** split algorithm */;
     template <class ExecutionPolicy, class LocalDynamicsFunction>
     void particle_for_split_by_mesh(const ExecutionPolicy &ex_policy, Mesh &mesh,
@@ -123,10 +163,23 @@ class NeighborSearch : public Mesh
     template <typename FunctionOnEach>
     void forEachSearch(const Vecd &source_pos, const FunctionOnEach &function,
                        const BoundingBoxi &search_box = BoundingBoxi(Arrayi::Ones())) const;
+    /** Whether all cells in the search box hold at least the given number of particles.
+     *  A search box reaching out of the mesh is not filled. */
+    bool isSearchBoxFilled(const Vecd &source_pos, UnsignedInt min_cell_size,
+                           const BoundingBoxi &search_box = BoundingBoxi(Arrayi::Ones())) const;
 
   protected:
     UnsignedInt *particle_index_;
     UnsignedInt *cell_offset_;
+    UnsignedInt *block_size_; /**< nullptr if the cell blocks are not used */
+    UnsignedInt block_shift_;
+    PeriodicImage periodic_image_;
+
+    /** The cell offsets within the empty blocks are not updated, see SparseUpdateCellLinkedList. */
+    bool isInEmptyBlock(UnsignedInt linear_index) const
+    {
+        return block_size_ != nullptr && block_size_[linear_index >> block_shift_] == 0;
+    };
 };
 
 /**
@@ -150,6 +203,69 @@ class CellLinkedList : public BaseCellLinkedList
     template <class ExecutionPolicy>
     NeighborSearch createNeighborSearch(const ExecutionPolicy &ex_policy);
     UnsignedInt getCellOffsetListSize() { return cell_offset_list_size_; };
+    /** Group the consecutive linear cells into blocks of 2^block_shift cells by the number of particles,
+     *  given by the sparse update, so that the empty blocks are skipped in the neighbor search.
+     *  Returns the block sizes with one more element than the blocks for the prefix sum. */
+    DiscreteVariable<UnsignedInt> *enableCellBlocks(UnsignedInt block_shift);
+    UnsignedInt BlockShift() { return block_shift_; };
+    UnsignedInt NumberOfBlocks() { return number_of_blocks_; };
+    DiscreteVariable<UnsignedInt> *dvBlockSize() { return dv_block_size_; };
+
+  protected:
+    UnsignedInt block_shift_ = 0;
+    UnsignedInt number_of_blocks_ = 0;
+    DiscreteVariable<UnsignedInt> *dv_block_size_ = nullptr; /**< nullptr if the cell blocks are not used */
+};
+
+/**
+ * @class MultilevelMeshes
+ * @brief The meshes of all levels kept by value, so that they can be copied into computing kernels.
+ */
+class MultilevelMeshes
+{
+  public:
+    static constexpr UnsignedInt MaxLevels = 8;
+    explicit MultilevelMeshes(StdVec<Mesh *> &meshes);
+
+    UnsignedInt TotalLevels() const { return total_levels_; };
+    const Mesh &getMesh(UnsignedInt level) const { return meshes_[level]; };
+    /** the finest level with the grid spacing not smaller than the cut-off radius */
+    UnsignedInt MeshLevel(Real cutoff_radius) const
+    {
+        for (UnsignedInt level = total_levels_; level != 0; --level)
+        {
+            if (cutoff_radius - meshes_[level - 1].GridSpacing() < SqrtEps)
+                return level - 1;
+        }
+        return 0;
+    };
+
+  protected:
+    UnsignedInt total_levels_;
+    Mesh meshes_[MaxLevels];
+};
+
+/**
+ * @class MultilevelNeighborSearch
+ * @brief Neighbor search visiting all levels of a multilevel cell linked list.
+ * As the linear cell indices of the levels are consecutive, all levels share one cell offset list.
+ * On each level, the stencil covers the search distance of the source particle,
+ * but at least the adjacent cells, as the cut-off radius of a particle binned on a level
+ * is up to the grid spacing of that level.
+ */
+class MultilevelNeighborSearch : public MultilevelMeshes
+{
+  public:
+    template <class ExecutionPolicy>
+    MultilevelNeighborSearch(const ExecutionPolicy &ex_policy, MultilevelCellLinkedList &cell_linked_list);
+
+    template <typename FunctionOnEach>
+    void forEachSearch(const Vecd &source_pos, Real search_distance, const FunctionOnEach &function) const;
+
+  protected:
+    UnsignedInt *particle_index_;
+    UnsignedInt *cell_offset_;
+    PeriodicImage periodic_image_;
 };
 
 /**
@@ -173,6 +289,10 @@ class MultilevelCellLinkedList : public BaseCellLinkedList
     virtual ~MultilevelCellLinkedList() {};
     void insertParticleIndex(UnsignedInt particle_index, const Vecd &particle_position) override;
     void InsertListDataEntry(UnsignedInt particle_index, const Vecd &particle_position) override;
+
+    template <class ExecutionPolicy>
+    MultilevelNeighborSearch createNeighborSearch(const ExecutionPolicy &ex_policy);
+    UnsignedInt getCellOffsetListSize() { return cell_offset_list_size_; };
 };
 } // namespace SPH
 #endif // MESH_CELL_LINKED_LIST_H
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "base_body.h"
 #include "base_particles.h"
 #include "cell_linked_list.h"
 #include "mesh_iterators.hpp"
@@ -17,6 +18,37 @@
 namespace SPH
 {
 //=================================================================================================//
+template <typename GetNeighborRelation>
+void BaseCellLinkedList::searchNeighborsOfParticle(
+    Mesh &mesh, const Vecd &pos_i, UnsignedInt index_i, int search_depth,
+    Neighborhood &neighborhood, GetNeighborRelation &get_neighbor_relation,
+    const StdVec<char> *cell_band)
+{
+    // The images of the particle across periodic bounds are searched as well,
+    // and the neighbor relation is built with the image position, i.e. the minimum image displacement.
+    const Real search_distance = Real(search_depth + 1) * mesh.GridSpacing();
+    getPeriodicImage().forEachImage(
+        pos_i, search_distance,
+        [&](const Vecd &image_pos)
+        {
+            Arrayi target_cell_index = mesh.CellIndexFromPosition(image_pos);
+            if (cell_band != nullptr && !(*cell_band)[mesh.LinearCellIndex(target_cell_index)])
+                return;
+            mesh_for_each(
+                Arrayi::Zero().max(target_cell_index - search_depth * Arrayi::Ones()),
+                mesh.AllCells().min(target_cell_index + (search_depth + 1) * Arrayi::Ones()),
+                [&](const Arrayi &cell_index)
+                {
+                    UnsignedInt linear_index = mesh.LinearCellIndex(cell_index);
+                    ListDataVector &target_particles = cell_data_lists_[linear_index];
+                    for (const ListData &data_list : target_particles)
+                    {
+                        get_neighbor_relation(neighborhood, image_pos, index_i, data_list);
+                    }
+                });
+        });
+}
+//=================================================================================================//
 template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
 void BaseCellLinkedList::searchNeighborsByMesh(
     Mesh &mesh, DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
@@ -26,25 +58,82 @@ void BaseCellLinkedList::searchNeighborsByMesh(
     particle_for(execution::ParallelPolicy(), dynamics_range.LoopRange(),
                  [&](UnsignedInt index_i)
                  {
-                     int search_depth = get_search_depth(index_i);
-                     Arrayi target_cell_index = mesh.CellIndexFromPosition(pos[index_i]);
-
-                     Neighborhood &neighborhood = particle_configuration[index_i];
-                     mesh_for_each(
-                         Arrayi::Zero().max(target_cell_index - search_depth * Arrayi::Ones()),
-                         mesh.AllCells().min(target_cell_index + (search_depth + 1) * Arrayi::Ones()),
-                         [&](const Arrayi &cell_index)
-                         {
-                             UnsignedInt linear_index = mesh.LinearCellIndex(cell_index);
-                             ListDataVector &target_particles = cell_data_lists_[linear_index];
-                             for (const ListData &data_list : target_particles)
-                             {
-                                 get_neighbor_relation(neighborhood, pos[index_i], index_i, data_list);
-                             }
-                         });
+                     searchNeighborsOfParticle(mesh, pos[index_i], index_i, get_search_depth(index_i),
+                                               particle_configuration[index_i], get_neighbor_relation);
                  });
 }
 //=================================================================================================//
+template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
+void BaseCellLinkedList::searchNeighborsByMeshInFrame(
+    Mesh &mesh, DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
+    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation, Transform &frame_transform)
+{
+    Vecd *pos = dynamics_range.getBaseParticles().ParticlePositions();
+    particle_for(execution::ParallelPolicy(), dynamics_range.LoopRange(),
+                 [&](UnsignedInt index_i)
+                 {
+                     Vecd frame_position = frame_transform.shiftBaseStationToFrame(pos[index_i]);
+                     searchNeighborsOfParticle(mesh, frame_position, index_i, get_search_depth(index_i),
+                                               particle_configuration[index_i], get_neighbor_relation);
+                 });
+}
+//=================================================================================================//
+template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
+void BaseCellLinkedList::searchNeighborsByMeshInBand(
+    Mesh &mesh, DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
+    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation, const StdVec<char> &cell_band)
+{
+    Vecd *pos = dynamics_range.getBaseParticles().ParticlePositions();
+    particle_for(execution::ParallelPolicy(), dynamics_range.LoopRange(),
+                 [&](UnsignedInt index_i)
+                 {
+                     searchNeighborsOfParticle(mesh, pos[index_i], index_i, get_search_depth(index_i),
+                                               particle_configuration[index_i], get_neighbor_relation, &cell_band);
+                 });
+}
+//=================================================================================================//
+template <typename GetSearchDepth, typename GetNeighborRelation>
+void BaseCellLinkedList::searchNeighborsByMesh(
+    Mesh &mesh, SPHBody &sph_body, CompactParticleConfiguration &compact_configuration,
+    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation)
+{
+    Vecd *pos = sph_body.getBaseParticles().ParticlePositions();
+    UnsignedInt total_real_particles = sph_body.getBaseParticles().TotalRealParticles();
+    // A scratch neighborhood of each thread is used so that the neighbor builders
+    // can be shared with the classic particle configuration without allocation in steady state.
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            Neighborhood &neighborhood = compact_configuration.ScratchNeighborhood();
+            for (UnsignedInt index_i = r.begin(); index_i != r.end(); ++index_i)
+            {
+                neighborhood.current_size_ = 0;
+                searchNeighborsOfParticle(mesh, pos[index_i], index_i, get_search_depth(index_i),
+                                          neighborhood, get_neighbor_relation);
+                compact_configuration.neighbor_size_[index_i] = neighborhood.current_size_;
+            }
+        },
+        ap);
+
+    compact_configuration.allocateNeighbors(total_real_particles);
+
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            Neighborhood &neighborhood = compact_configuration.ScratchNeighborhood();
+            for (UnsignedInt index_i = r.begin(); index_i != r.end(); ++index_i)
+            {
+                neighborhood.current_size_ = 0;
+                searchNeighborsOfParticle(mesh, pos[index_i], index_i, get_search_depth(index_i),
+                                          neighborhood, get_neighbor_relation);
+                compact_configuration.assignNeighbors(index_i, neighborhood);
+            }
+        },
+        ap);
+}
+//=================================================================================================//
 template <class ExecutionPolicy, class LocalDynamicsFunction>
 void BaseCellLinkedList::particle_for_split_by_mesh(
     const ExecutionPolicy &ex_policy, Mesh &mesh, const LocalDynamicsFunction &local_dynamics_function)
@@ -114,26 +203,66 @@ template <class ExecutionPolicy>
 NeighborSearch::NeighborSearch(const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list)
     : Mesh(cell_linked_list.getMesh()),
       particle_index_(cell_linked_list.dvParticleIndex()->DelegatedData(ex_policy)),
-      cell_offset_(cell_linked_list.dvCellOffset()->DelegatedData(ex_policy)) {}
+      cell_offset_(cell_linked_list.dvCellOffset()->DelegatedData(ex_policy)),
+      block_size_(cell_linked_list.dvBlockSize() != nullptr
+                      ? cell_linked_list.dvBlockSize()->DelegatedData(ex_policy)
+                      : nullptr),
+      block_shift_(cell_linked_list.BlockShift()),
+      periodic_image_(cell_linked_list.getPeriodicImage()) {}
 //=================================================================================================//
 template <typename FunctionOnEach>
 void NeighborSearch::forEachSearch(const Vecd &source_pos, const FunctionOnEach &function,
                                    const BoundingBoxi &search_box) const
 {
-    const BoundingBoxi search_range =
-        search_box.translate(CellIndexFromPosition(source_pos));
+    // The images of the source position across periodic bounds are searched as well.
+    const Real search_distance = Real(search_box.upper_.maxCoeff() + 1) * grid_spacing_;
+    periodic_image_.forEachImage(
+        source_pos, search_distance,
+        [&](const Vecd &image_pos)
+        {
+            const BoundingBoxi search_range =
+                search_box.translate(CellIndexFromPosition(image_pos));
+            mesh_for_each(
+                Arrayi::Zero().max(search_range.lower_), all_cells_.min(search_range.upper_ + Arrayi::Ones()),
+                [&](const Arrayi &cell_index)
+                {
+                    const UnsignedInt linear_index = LinearCellIndex(cell_index);
+                    if (isInEmptyBlock(linear_index))
+                    {
+                        return;
+                    }
+                    // Since offset_cell_size_ has linear_cell_size_+1 elements, no boundary checks are needed.
+                    // offset_cell_size_[0] == 0 && offset_cell_size_[linear_cell_size_] == total_real_particles_
+                    for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
+                    {
+                        function(particle_index_[n]);
+                    }
+                });
+        });
+}
+//=================================================================================================//
+inline bool NeighborSearch::isSearchBoxFilled(const Vecd &source_pos, UnsignedInt min_cell_size,
+                                              const BoundingBoxi &search_box) const
+{
+    const BoundingBoxi search_range = search_box.translate(CellIndexFromPosition(source_pos));
+    if ((search_range.lower_ < Arrayi::Zero()).any() || (search_range.upper_ >= all_cells_).any())
+    {
+        return false;
+    }
+
+    bool is_filled = true;
     mesh_for_each(
-        Arrayi::Zero().max(search_range.lower_), all_cells_.min(search_range.upper_ + Arrayi::Ones()),
+        search_range.lower_, search_range.upper_ + Arrayi::Ones(),
         [&](const Arrayi &cell_index)
         {
             const UnsignedInt linear_index = LinearCellIndex(cell_index);
-            // Since offset_cell_size_ has linear_cell_size_+1 elements, no boundary checks are needed.
-            // offset_cell_size_[0] == 0 && offset_cell_size_[linear_cell_size_] == total_real_particles_
-            for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
+            if (isInEmptyBlock(linear_index) ||
+                cell_offset_[linear_index + 1] - cell_offset_[linear_index] < min_cell_size)
             {
-                function(particle_index_[n]);
+                is_filled = false;
             }
         });
+    return is_filled;
 }
 //=================================================================================================//
 template <class ExecutionPolicy>
@@ -142,4 +271,47 @@ NeighborSearch CellLinkedList::createNeighborSearch(const ExecutionPolicy &ex_po
     return NeighborSearch(ex_policy, *this);
 }
 //=================================================================================================//
+template <class ExecutionPolicy>
+MultilevelNeighborSearch::MultilevelNeighborSearch(
+    const ExecutionPolicy &ex_policy, MultilevelCellLinkedList &cell_linked_list)
+    : MultilevelMeshes(cell_linked_list.getMeshes()),
+      particle_index_(cell_linked_list.dvParticleIndex()->DelegatedData(ex_policy)),
+      cell_offset_(cell_linked_list.dvCellOffset()->DelegatedData(ex_policy)),
+      periodic_image_(cell_linked_list.getPeriodicImage()) {}
+//=================================================================================================//
+template <typename FunctionOnEach>
+void MultilevelNeighborSearch::forEachSearch(
+    const Vecd &source_pos, Real search_distance, const FunctionOnEach &function) const
+{
+    for (UnsignedInt level = 0; level != total_levels_; ++level)
+    {
+        const Mesh &mesh = meshes_[level];
+        const int search_depth = SMAX(1, int(math::ceil((search_distance - Eps) / mesh.GridSpacing())));
+        const Arrayi search_extent = search_depth * Arrayi::Ones();
+        periodic_image_.forEachImage(
+            source_pos, Real(search_depth + 1) * mesh.GridSpacing(),
+            [&](const Vecd &image_pos)
+            {
+                const Arrayi cell_index = mesh.CellIndexFromPosition(image_pos);
+                mesh_for_each(
+                    Arrayi::Zero().max(cell_index - search_extent),
+                    mesh.AllCells().min(cell_index + search_extent + Arrayi::Ones()),
+                    [&](const Arrayi &neighbor_cell_index)
+                    {
+                        const UnsignedInt linear_index = mesh.LinearCellIndex(neighbor_cell_index);
+                        for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
+                        {
+                            function(particle_index_[n]);
+                        }
+                    });
+            });
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+MultilevelNeighborSearch MultilevelCellLinkedList::createNeighborSearch(const ExecutionPolicy &ex_policy)
+{
+    return MultilevelNeighborSearch(ex_policy, *this);
+}
+//=================================================================================================//
 } // namespace SPH
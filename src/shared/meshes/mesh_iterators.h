@@ -51,6 +51,8 @@ bool mesh_any_of(const Arrayi &lower, const Arrayi &upper, const FunctionOnEach
 };
 
 using MeshRange = std::pair<Arrayi, Arrayi>;
+/** Cluster the active cells into dense boxes given as mesh ranges, defined for 2D and 3D builds. */
+StdVec<MeshRange> clusterActiveCells(const StdVec<Arrayi> &active_cells);
 /** Iterator on the mesh by looping index. sequential computing. */
 template <typename LocalFunction, typename... Args>
 void mesh_for(const MeshRange &mesh_range, const LocalFunction &local_function, Args &&...args);
@@ -97,5 +99,32 @@ template <typename FunctionOnData>
 void package_for(const execution::ParallelDevicePolicy &par_device,
                  UnsignedInt start_index, UnsignedInt num_grid_pkgs,
                  const FunctionOnData &function);
+
+/** Iterator on the packages sorted by blocks, each block of packages,
+ *  given by the offsets, is handled by one thread. */
+template <typename FunctionOnData>
+void package_block_for(const execution::SequencedPolicy &seq,
+                       const StdVec<UnsignedInt> &block_offsets, const FunctionOnData &function)
+{
+    if (!block_offsets.empty())
+        package_for(seq, block_offsets.front(), block_offsets.back(), function);
+}
+
+template <typename FunctionOnData>
+void package_block_for(const execution::ParallelPolicy &par_host,
+                       const StdVec<UnsignedInt> &block_offsets, const FunctionOnData &function)
+{
+    if (block_offsets.empty())
+        return;
+    parallel_for(IndexRange(0, block_offsets.size() - 1), [&](const IndexRange &r)
+                 {
+                    for (size_t k = r.begin(); k != r.end(); ++k)
+                    {
+                        for (size_t i = block_offsets[k]; i != block_offsets[k + 1]; ++i)
+                        {
+                            function(i);
+                        }
+                    } }, ap);
+}
 } // namespace SPH
 #endif // MESH_ITERATORS_H
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "multi_body_cell_linked_list.h"
+
+#include "base_body.h"
+#include "base_particles.h"
+#include "cell_linked_list.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace SPH
+{
+//=================================================================================================//
+MultiBodyCellLinkedList::MultiBodyCellLinkedList(RealBodyVector bodies)
+    : Mesh(DynamicCast<CellLinkedList>(this, bodies.front()->getCellLinkedList()).getMesh()),
+      bodies_(bodies), periodic_image_(bodies.front()->getPeriodicImage()),
+      cell_size_(NumberOfCells(), 0), cell_offset_(NumberOfCells() + 1, 0)
+{
+    for (RealBody *body : bodies_)
+    {
+        Mesh &mesh = DynamicCast<CellLinkedList>(this, body->getCellLinkedList()).getMesh();
+        if (ABS(mesh.GridSpacing() - grid_spacing_) > Eps * grid_spacing_ ||
+            (mesh.AllCells() != all_cells_).any())
+        {
+            std::cout << "\n Error: the cell linked list of " << body->getName()
+                      << " does not match the mesh of the multi-body cell linked list!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        body_particles_.push_back(&body->getBaseParticles());
+    }
+}
+//=================================================================================================//
+UnsignedInt MultiBodyCellLinkedList::BodyIndex(SPHBody &sph_body) const
+{
+    for (UnsignedInt k = 0; k != bodies_.size(); ++k)
+    {
+        if (bodies_[k] == &sph_body)
+            return k;
+    }
+    std::cout << "\n Error: " << sph_body.getName()
+              << " is not included in the multi-body cell linked list!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+    return bodies_.size();
+}
+//=================================================================================================//
+UnsignedInt MultiBodyCellLinkedList::BodyIndexOfJointIndex(UnsignedInt joint_index) const
+{
+    return std::upper_bound(body_particle_offset_.begin(), body_particle_offset_.end(), joint_index) -
+           body_particle_offset_.begin() - 1;
+}
+//=================================================================================================//
+void MultiBodyCellLinkedList::updateCellLists()
+{
+    body_particle_offset_.assign(bodies_.size() + 1, 0);
+    for (UnsignedInt k = 0; k != bodies_.size(); ++k)
+    {
+        body_particle_offset_[k + 1] = body_particle_offset_[k] + body_particles_[k]->TotalRealParticles();
+    }
+    const UnsignedInt total_particles = body_particle_offset_.back();
+    linear_cell_index_.resize(total_particles);
+    body_index_.resize(total_particles);
+    particle_index_.resize(total_particles);
+    std::fill(cell_size_.begin(), cell_size_.end(), 0);
+
+    parallel_for(
+        IndexRange(0, total_particles),
+        [&](const IndexRange &r)
+        {
+            for (UnsignedInt n = r.begin(); n != r.end(); ++n)
+            {
+                const UnsignedInt k = BodyIndexOfJointIndex(n);
+                const Vecd &pos = body_particles_[k]->ParticlePositions()[n - body_particle_offset_[k]];
+                const UnsignedInt linear_index = LinearCellIndexFromPosition(pos);
+                linear_cell_index_[n] = linear_index;
+                AtomicRef<UnsignedInt> atomic_cell_size(cell_size_[linear_index]);
+                ++atomic_cell_size;
+            }
+        },
+        ap);
+
+    cell_offset_[0] = 0;
+    std::partial_sum(cell_size_.begin(), cell_size_.end(), cell_offset_.begin() + 1);
+    std::fill(cell_size_.begin(), cell_size_.end(), 0);
+
+    parallel_for(
+        IndexRange(0, total_particles),
+        [&](const IndexRange &r)
+        {
+            for (UnsignedInt n = r.begin(); n != r.end(); ++n)
+            {
+                const UnsignedInt k = BodyIndexOfJointIndex(n);
+                const UnsignedInt linear_index = linear_cell_index_[n];
+                AtomicRef<UnsignedInt> atomic_current_size(cell_size_[linear_index]);
+                const UnsignedInt slot = cell_offset_[linear_index] + atomic_current_size++;
+                body_index_[slot] = k;
+                particle_index_[slot] = n - body_particle_offset_[k];
+            }
+        },
+        ap);
+}
+//=================================================================================================//
+} // namespace SPH
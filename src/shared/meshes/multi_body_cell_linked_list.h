@@ -0,0 +1,82 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	multi_body_cell_linked_list.h
+ * @brief 	A cell linked list shared by several bodies.
+ * @details Each cell saves the pairs of body index and particle index of the particles
+ * 			located within the cell, so that one traversal of the cell stencil
+ * 			finds the neighbors from all the bodies, e.g. for a body having contact
+ * 			with many others. The list is built on the host once per step.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef MULTI_BODY_CELL_LINKED_LIST_H
+#define MULTI_BODY_CELL_LINKED_LIST_H
+
+#include "base_mesh.hpp"
+#include "periodic_image.h"
+#include "sphinxsys_containers.h"
+
+namespace SPH
+{
+class RealBody;
+class SPHBody;
+class BaseParticles;
+
+/**
+ * @class MultiBodyCellLinkedList
+ * @brief The bodies must have the cell linked lists with the identical mesh,
+ * i.e. the same cutoff radius, as all the cell linked lists are built on the system bounds.
+ * The periodic images, if any, follow the first body.
+ */
+class MultiBodyCellLinkedList : public Mesh
+{
+  public:
+    explicit MultiBodyCellLinkedList(RealBodyVector bodies);
+    ~MultiBodyCellLinkedList() {};
+
+    UnsignedInt NumberOfBodies() const { return bodies_.size(); };
+    RealBodyVector &getBodies() { return bodies_; };
+    UnsignedInt BodyIndex(SPHBody &sph_body) const;
+    /** Build the lists from the present particle positions of all bodies. */
+    void updateCellLists();
+
+    template <typename FunctionOnEach>
+    void forEachSearch(const Vecd &source_pos, const FunctionOnEach &function,
+                       const BoundingBoxi &search_box = BoundingBoxi(Arrayi::Ones())) const;
+
+  protected:
+    RealBodyVector bodies_;
+    StdVec<BaseParticles *> body_particles_;
+    PeriodicImage periodic_image_;
+    StdVec<UnsignedInt> body_particle_offset_; /**< prefix of real particles over bodies */
+    StdVec<UnsignedInt> linear_cell_index_;    /**< cell of each particle in the joint index */
+    StdVec<UnsignedInt> cell_size_;
+    StdVec<UnsignedInt> cell_offset_;
+    StdVec<UnsignedInt> body_index_;
+    StdVec<UnsignedInt> particle_index_;
+
+    UnsignedInt BodyIndexOfJointIndex(UnsignedInt joint_index) const;
+};
+} // namespace SPH
+#endif // MULTI_BODY_CELL_LINKED_LIST_H
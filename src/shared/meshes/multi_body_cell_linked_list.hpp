@@ -0,0 +1,42 @@
+/**
+ * @file 	multi_body_cell_linked_list.hpp
+ * @brief 	Here gives the search function of the cell linked list shared by several bodies.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef MULTI_BODY_CELL_LINKED_LIST_HPP
+#define MULTI_BODY_CELL_LINKED_LIST_HPP
+
+#include "multi_body_cell_linked_list.h"
+
+#include "mesh_iterators.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename FunctionOnEach>
+void MultiBodyCellLinkedList::forEachSearch(const Vecd &source_pos, const FunctionOnEach &function,
+                                            const BoundingBoxi &search_box) const
+{
+    const Real search_distance = Real(search_box.upper_.maxCoeff() + 1) * grid_spacing_;
+    periodic_image_.forEachImage(
+        source_pos, search_distance,
+        [&](const Vecd &image_pos)
+        {
+            const BoundingBoxi search_range =
+                search_box.translate(CellIndexFromPosition(image_pos));
+            mesh_for_each(
+                Arrayi::Zero().max(search_range.lower_), all_cells_.min(search_range.upper_ + Arrayi::Ones()),
+                [&](const Arrayi &cell_index)
+                {
+                    const UnsignedInt linear_index = LinearCellIndex(cell_index);
+                    for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
+                    {
+                        function(body_index_[n], particle_index_[n]);
+                    }
+                });
+        });
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // MULTI_BODY_CELL_LINKED_LIST_HPP
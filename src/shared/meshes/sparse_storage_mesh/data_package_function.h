@@ -66,13 +66,23 @@ class ProbeMesh
     template <class ExecutionPolicy>
     ProbeMesh(const ExecutionPolicy &ex_policy, MeshWithGridDataPackages<PKG_SIZE> *data_mesh,
               const std::string variable_name);
+    /** The position is given in the global frame and the vector or tensor data are returned in it.
+     * The data are interpolated in the mesh frame, so that a rigidly moved mesh needs no rebuild. */
     DataType operator()(const Vecd &position);
+    /** probe with a cached package index, which is reused as long as the position stays in its cell. */
+    DataType operator()(const Vecd &position, UnsignedInt &package_hint);
 
   protected:
     PackageData<DataType, PKG_SIZE> *pkg_data_;
     IndexHandler index_handler_;
     UnsignedInt *cell_pkg_index_;
+    UnsignedInt *pkg_1d_cell_index_;
     CellNeighborhood *cell_neighborhood_;
+    Transform *mesh_transform_;
+    Real xformFrameDataToBase(const Real &data) { return data; };
+    Vecd xformFrameDataToBase(const Vecd &data) { return mesh_transform_->xformFrameVecToBase(data); };
+    Matd xformFrameDataToBase(const Matd &data) { return mesh_transform_->xformFrameTensorToBase(data); };
+    UnsignedInt PackageIndexWithHint(const Arrayi &cell_index, UnsignedInt &package_hint);
     /** probe by applying bi and tri-linear interpolation within the package. */
     DataType probeDataPackage(UnsignedInt package_index, const Array2i &cell_index, const Vec2d &position);
     DataType probeDataPackage(UnsignedInt package_index, const Array3i &cell_index, const Vec3d &position);
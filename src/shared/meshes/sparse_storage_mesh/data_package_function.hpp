@@ -63,15 +63,40 @@ ProbeMesh<DataType, PKG_SIZE>::ProbeMesh(
     : pkg_data_(data_mesh->template getMeshVariable<DataType>(variable_name)->DelegatedData(ex_policy)),
       index_handler_(data_mesh->getIndexHandler()),
       cell_pkg_index_(data_mesh->getCellPackageIndex().DelegatedData(ex_policy)),
-      cell_neighborhood_(data_mesh->getCellNeighborhood().DelegatedData(ex_policy)) {}
+      pkg_1d_cell_index_(data_mesh->getPackage1DCellIndex().DelegatedData(ex_policy)),
+      cell_neighborhood_(data_mesh->getCellNeighborhood().DelegatedData(ex_policy)),
+      mesh_transform_(data_mesh->svMeshTransform().DelegatedData(ex_policy)) {}
 //=============================================================================================//
 template <typename DataType, int PKG_SIZE>
 DataType ProbeMesh<DataType, PKG_SIZE>::operator()(const Vecd &position)
 {
-    Arrayi cell_index = index_handler_.CellIndexFromPosition(position);
+    Vecd frame_position = mesh_transform_->shiftBaseStationToFrame(position);
+    Arrayi cell_index = index_handler_.CellIndexFromPosition(frame_position);
     UnsignedInt package_index = index_handler_.PackageIndexFromCellIndex(cell_pkg_index_, cell_index);
-    return package_index > 1 ? probeDataPackage(package_index, cell_index, position)
-                             : pkg_data_[package_index](Arrayi::Zero());
+    return xformFrameDataToBase(package_index > 1 ? probeDataPackage(package_index, cell_index, frame_position)
+                                                  : pkg_data_[package_index](Arrayi::Zero()));
+}
+//=============================================================================================//
+template <typename DataType, int PKG_SIZE>
+DataType ProbeMesh<DataType, PKG_SIZE>::operator()(const Vecd &position, UnsignedInt &package_hint)
+{
+    Vecd frame_position = mesh_transform_->shiftBaseStationToFrame(position);
+    Arrayi cell_index = index_handler_.CellIndexFromPosition(frame_position);
+    UnsignedInt package_index = PackageIndexWithHint(cell_index, package_hint);
+    return xformFrameDataToBase(package_index > 1 ? probeDataPackage(package_index, cell_index, frame_position)
+                                                  : pkg_data_[package_index](Arrayi::Zero()));
+}
+//=============================================================================================//
+template <typename DataType, int PKG_SIZE>
+UnsignedInt ProbeMesh<DataType, PKG_SIZE>::
+    PackageIndexWithHint(const Arrayi &cell_index, UnsignedInt &package_hint)
+{
+    UnsignedInt index_1d = index_handler_.LinearCellIndex(cell_index);
+    if (package_hint > 1 && pkg_1d_cell_index_[package_hint] == index_1d)
+        return package_hint; // still in the same package, no lookup in the background mesh
+
+    package_hint = cell_pkg_index_[index_1d];
+    return package_hint;
 }
 //=============================================================================================//
 template <typename DataType, int PKG_SIZE, typename FunctionByIndex>
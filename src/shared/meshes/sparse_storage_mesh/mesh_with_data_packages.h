@@ -109,6 +109,8 @@ class MeshWithGridDataPackages
     UnsignedInt NumSingularPackages() const { return num_singular_pkgs_; };
     UnsignedInt PackageBound() const { return pkgs_bound_; };
     SingularVariable<UnsignedInt> &svNumGridPackages();
+    /** The rigid transform from the mesh frame, in which the data are built, to the global frame. */
+    SingularVariable<Transform> &svMeshTransform() { return sv_mesh_transform_; };
     BKGMeshVariable<UnsignedInt> &getCellPackageIndex() { return *bmv_cell_pkg_index_; };
     ConcurrentVec<std::pair<UnsignedInt, int>> &getOccupiedDataPackages() { return occupied_data_pkgs_; };
     MetaVariable<CellNeighborhood> &getCellNeighborhood();
@@ -116,12 +118,15 @@ class MeshWithGridDataPackages
     MetaVariable<int> &getPackageType();
     MetaVariableAssemble &getEvolvingMetaVariables() { return evolving_meta_variables_; };
     MeshVariableAssemble &getEvolvingMeshVariables() { return evolving_mesh_variables_; };
+    /** Host and device bytes of all mesh, background mesh and meta variables. */
+    MemoryUsage getMemoryUsage();
 
   protected:
     IndexHandler index_handler_;
     UnsignedInt num_singular_pkgs_;                  /**< the number of all packages, initially only singular packages. */
     SingularVariable<UnsignedInt> sv_num_grid_pkgs_; /**< the number of all packages, initially only with singular packages. */
     UnsignedInt pkgs_bound_;
+    SingularVariable<Transform> sv_mesh_transform_; /**< identity if the mesh is not moved. */
     MetaVariable<UnsignedInt> *dv_pkg_1d_cell_index_;               /**< metadata for data pckages: cell index. */
     MetaVariable<int> *dv_pkg_type_;                                /**< metadata for data pckages: (int)core1/inner0. */
     MetaVariable<CellNeighborhood> *cell_neighborhood_;             /**< 3*3(*3) array to store indicies of neighborhood cells. */
@@ -170,6 +175,9 @@ class MeshWithGridDataPackages
     void addEvolvingMetaVariable(const std::string &variable_name);
     void writeMeshVariableToPlt(std::ofstream &output_file);
     void writeBKGMeshVariableToPlt(std::ofstream &output_file);
+    /** Write the data of the core packages as a point cloud of VTK XML PolyData
+     *  with raw appended binary data, which is much more compact than the Tecplot output. */
+    void writeMeshVariableToVtp(std::ostream &output_stream);
 
     void organizeOccupiedPackages();
 };
@@ -11,6 +11,7 @@ MeshWithGridDataPackages<PKG_SIZE>::MeshWithGridDataPackages(
     BoundingBoxd tentative_bounds, Real data_spacing, UnsignedInt buffer_size, UnsignedInt num_singular_pkgs)
     : index_handler_(tentative_bounds, data_spacing * PKG_SIZE, buffer_size, 0, data_spacing),
       num_singular_pkgs_(num_singular_pkgs), sv_num_grid_pkgs_("NumGridPackages", num_singular_pkgs),
+      sv_mesh_transform_("MeshTransform", Transform()),
       dv_pkg_1d_cell_index_(nullptr), dv_pkg_type_(nullptr), cell_neighborhood_(nullptr),
       bmv_cell_pkg_index_(registerBKGMeshVariable<UnsignedInt>("CellPackageIndex")),
       global_mesh_(index_handler_.MeshLowerBound() + 0.5 * data_spacing * Vecd::Ones(),
@@ -29,6 +30,19 @@ SingularVariable<UnsignedInt> &MeshWithGridDataPackages<PKG_SIZE>::svNumGridPack
 }
 //=============================================================================================//
 template <int PKG_SIZE>
+MemoryUsage MeshWithGridDataPackages<PKG_SIZE>::getMemoryUsage()
+{
+    MemoryUsage memory_usage;
+    OperationOnDataAssemble<MeshVariableAssemble, AccumulateMemoryUsage<MeshVariable>> accumulate_mesh_variables;
+    OperationOnDataAssemble<BKGMeshVariableAssemble, AccumulateMemoryUsage<BKGMeshVariable>> accumulate_bkg_mesh_variables;
+    OperationOnDataAssemble<MetaVariableAssemble, AccumulateMemoryUsage<MetaVariable>> accumulate_meta_variables;
+    accumulate_mesh_variables(all_mesh_variables_, memory_usage);
+    accumulate_bkg_mesh_variables(all_bkg_mesh_variables_, memory_usage);
+    accumulate_meta_variables(all_meta_variables_, memory_usage);
+    return memory_usage;
+}
+//=============================================================================================//
+template <int PKG_SIZE>
 DiscreteVariable<CellNeighborhood> &MeshWithGridDataPackages<PKG_SIZE>::getCellNeighborhood()
 {
     return checkOrganized("getCellNeighborhood", *cell_neighborhood_);
@@ -280,5 +294,120 @@ void MeshWithGridDataPackages<PKG_SIZE>::organizeOccupiedPackages()
         MetaVariable<CellNeighborhood>>("CellNeighborhood", pkgs_bound_);
 }
 //=============================================================================================//
+template <int PKG_SIZE>
+void MeshWithGridDataPackages<PKG_SIZE>::writeMeshVariableToVtp(std::ostream &output_stream)
+{
+    StdVec<UnsignedInt> core_packages;
+    auto pkg_1d_cell_index = dv_pkg_1d_cell_index_->Data();
+    auto pkg_type = dv_pkg_type_->Data();
+    package_for(execution::seq, num_singular_pkgs_, sv_num_grid_pkgs_.getValue(),
+                [&](UnsignedInt package_index)
+                {
+                    if (pkg_type[package_index] == 1)
+                    {
+                        core_packages.push_back(package_index);
+                    }
+                });
+    size_t pkg_data_size = Arrayi::Constant(PKG_SIZE).prod();
+    size_t total_points = core_packages.size() * pkg_data_size;
+
+    std::string appended_data;
+    // the data of a package are given in the order of mesh_for_each
+    auto append_data_array = [&](const std::string &name, int number_of_components,
+                                 const std::function<void(UnsignedInt, const Arrayi &, float *)> &function)
+    {
+        output_stream << "    <DataArray Name=\"" << name << "\" type=\"Float32\" NumberOfComponents=\""
+                      << number_of_components << "\" format=\"appended\" offset=\"" << appended_data.size() << "\"/>\n";
+        StdVec<float> block(total_points * number_of_components);
+        parallel_for(
+            IndexRange(0, core_packages.size()),
+            [&](const IndexRange &r)
+            {
+                for (size_t i = r.begin(); i != r.end(); ++i)
+                {
+                    float *value = &block[i * pkg_data_size * number_of_components];
+                    mesh_for_each(Arrayi::Zero(), Arrayi::Constant(PKG_SIZE),
+                                  [&](const Arrayi &data_index)
+                                  {
+                                      function(core_packages[i], data_index, value);
+                                      value += number_of_components;
+                                  });
+                }
+            },
+            ap);
+        uint64_t block_bytes = block.size() * sizeof(float);
+        appended_data.append(reinterpret_cast<const char *>(&block_bytes), sizeof(block_bytes));
+        appended_data.append(reinterpret_cast<const char *>(block.data()), block_bytes);
+    };
+
+    output_stream << "<?xml version=\"1.0\"?>\n";
+    output_stream << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n";
+    output_stream << " <PolyData>\n";
+    output_stream << "  <Piece NumberOfPoints=\"" << total_points << "\" NumberOfVerts=\"" << total_points << "\">\n";
+
+    output_stream << "   <Points>\n";
+    append_data_array("Position", 3, [&](UnsignedInt package_index, const Arrayi &data_index, float *value)
+                      {
+                          Arrayi cell_index = index_handler_.DimensionalCellIndex(pkg_1d_cell_index[package_index]);
+                          Vec3d position = upgradeToVec3d(index_handler_.DataPositionFromIndex(cell_index, data_index));
+                          for (int k = 0; k != 3; ++k)
+                              value[k] = float(position[k]);
+                      });
+    output_stream << "   </Points>\n";
+
+    output_stream << "   <PointData>\n";
+    constexpr int type_index_int = DataTypeIndex<int>::value;
+    for (MeshVariable<int> *variable : std::get<type_index_int>(mesh_variables_to_write_))
+    {
+        MeshVariableData<int> *data = variable->Data();
+        append_data_array(variable->Name(), 1, [&](UnsignedInt package_index, const Arrayi &data_index, float *value)
+                          { value[0] = float(data[package_index](data_index)); });
+    }
+    constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+    for (MeshVariable<Vecd> *variable : std::get<type_index_Vecd>(mesh_variables_to_write_))
+    {
+        MeshVariableData<Vecd> *data = variable->Data();
+        append_data_array(variable->Name(), 3, [&](UnsignedInt package_index, const Arrayi &data_index, float *value)
+                          {
+                              Vec3d vector_value = upgradeToVec3d(data[package_index](data_index));
+                              for (int k = 0; k != 3; ++k)
+                                  value[k] = float(vector_value[k]);
+                          });
+    }
+    constexpr int type_index_Real = DataTypeIndex<Real>::value;
+    for (MeshVariable<Real> *variable : std::get<type_index_Real>(mesh_variables_to_write_))
+    {
+        MeshVariableData<Real> *data = variable->Data();
+        append_data_array(variable->Name(), 1, [&](UnsignedInt package_index, const Arrayi &data_index, float *value)
+                          { value[0] = float(data[package_index](data_index)); });
+    }
+    output_stream << "   </PointData>\n";
+
+    // a single poly-vertex cell makes the points visible
+    output_stream << "   <Verts>\n";
+    output_stream << "    <DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\""
+                  << appended_data.size() << "\"/>\n";
+    StdVec<int64_t> connectivity(total_points);
+    std::iota(connectivity.begin(), connectivity.end(), int64_t(0));
+    uint64_t connectivity_bytes = total_points * sizeof(int64_t);
+    appended_data.append(reinterpret_cast<const char *>(&connectivity_bytes), sizeof(connectivity_bytes));
+    appended_data.append(reinterpret_cast<const char *>(connectivity.data()), connectivity_bytes);
+    output_stream << "    <DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\""
+                  << appended_data.size() << "\"/>\n";
+    int64_t offset = total_points;
+    uint64_t offset_bytes = sizeof(offset);
+    appended_data.append(reinterpret_cast<const char *>(&offset_bytes), sizeof(offset_bytes));
+    appended_data.append(reinterpret_cast<const char *>(&offset), offset_bytes);
+    output_stream << "   </Verts>\n";
+
+    output_stream << "  </Piece>\n";
+    output_stream << " </PolyData>\n";
+    output_stream << " <AppendedData encoding=\"raw\">\n";
+    output_stream << "  _";
+    output_stream.write(appended_data.data(), appended_data.size());
+    output_stream << "\n </AppendedData>\n";
+    output_stream << "</VTKFile>\n";
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // MESH_WITH_DATA_PACKAGES_HXX
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "particle_sorting.h"
 
 #include "base_body.h"
+#include "base_body_relation.h"
 #include "base_particle_dynamics.h"
 #include "base_particles.h"
 #include "cell_linked_list.h"
@@ -11,7 +12,8 @@ namespace SPH
 SwapSortableParticleData::SwapSortableParticleData(BaseParticles *base_particles)
     : sequence_(base_particles->getVariableDataByName<UnsignedInt>("Sequence")),
       evolving_variables_data_(base_particles->EvolvingVariablesData()),
-      swap_particle_data_value_() {}
+      swap_particle_data_value_(),
+      body_relations_(base_particles->getSPHBody().getBodyRelations()) {}
 //=================================================================================================//
 void SwapSortableParticleData::operator()(UnsignedInt *a, UnsignedInt *b)
 {
@@ -20,6 +22,10 @@ void SwapSortableParticleData::operator()(UnsignedInt *a, UnsignedInt *b)
     UnsignedInt index_a = a - sequence_;
     UnsignedInt index_b = b - sequence_;
     swap_particle_data_value_(evolving_variables_data_, index_a, index_b);
+    for (SPHRelation *relation : body_relations_)
+    {
+        relation->swapNeighborhoods(index_a, index_b);
+    }
 }
 //=================================================================================================//
 ParticleSequence::ParticleSequence(RealBody &real_body)
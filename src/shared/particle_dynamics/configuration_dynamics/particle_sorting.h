@@ -61,6 +61,8 @@ class SwapSortableParticleData
     UnsignedInt *sequence_;
     ParticleData &evolving_variables_data_;
     OperationOnDataAssemble<ParticleData, SwapParticleDataValue> swap_particle_data_value_;
+    /** the neighborhoods are swapped along so that their allocated capacities are kept */
+    StdVec<SPHRelation *> &body_relations_;
 
   public:
     explicit SwapSortableParticleData(BaseParticles *base_particles);
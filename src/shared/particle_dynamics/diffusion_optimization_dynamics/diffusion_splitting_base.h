@@ -31,6 +31,7 @@
 
 #include "all_particle_dynamics.h"
 #include "diffusion_reaction.h"
+#include "diffusion_splitting_operator.h"
 #include "particle_dynamics_dissipation.h"
 
 namespace SPH
@@ -47,9 +48,13 @@ class OptimizationBySplittingAlgorithmBase
   public:
     explicit OptimizationBySplittingAlgorithmBase(BaseInnerRelation &inner_relation, const std::string &name);
     virtual ~OptimizationBySplittingAlgorithmBase() {};
+    /** The operator is assembled at the first use and reused by the following iterations. */
+    virtual void setupDynamics(Real dt = 0.0) override;
     virtual void interaction(size_t index_i, Real dt = 0.0) = 0;
+    AssembledInnerOperator &getInnerOperator() { return inner_operator_; };
 
   protected:
+    AssembledInnerOperator inner_operator_;
     LocalIsotropicDiffusion &diffusion_;
     Real *Vol_, *mass_;
     Vecd *normal_vector_;
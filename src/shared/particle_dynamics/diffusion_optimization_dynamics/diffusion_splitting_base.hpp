@@ -53,6 +53,15 @@ OptimizationBySplittingAlgorithmBase<DataType>::
 }
 //=================================================================================================//
 template <typename DataType>
+void OptimizationBySplittingAlgorithmBase<DataType>::setupDynamics(Real dt)
+{
+    if (!inner_operator_.isAssembled())
+    {
+        inner_operator_.assemble(this->inner_configuration_, Vol_, this->particles_->TotalRealParticles());
+    }
+}
+//=================================================================================================//
+template <typename DataType>
 RegularizationByDiffusionAnalogy<DataType>::
     RegularizationByDiffusionAnalogy(BaseInnerRelation &inner_relation, const std::string &variable_name,
                                      Real initial_eta, Real variation)
@@ -65,26 +74,18 @@ ErrorAndParameters<DataType> RegularizationByDiffusionAnalogy<DataType>::
 {
     Real Vol_i = this->Vol_[index_i];
     Real mass_i = this->mass_[index_i];
-    DataType &variable_i = this->variable_[index_i];
     ErrorAndParameters<DataType> error_and_parameters;
-    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
-    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
-    {
-        size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
-        Real r_ij_ = inner_neighborhood.r_ij_[n];
+    AssembledInnerOperator &inner_operator = this->inner_operator_;
 
-        // this->eta_regularization_[index_i] = initial_eta_ * abs(this->variation_local_[index_i] + TinyReal) / averaged_variation_;
-        // this->eta_regularization_[index_i] = initial_eta_ * abs(this->variation_local_[index_i] + TinyReal) / abs(maximum_variation_);
-        this->eta_regularization_[index_i] = initial_eta_; // uniform coefficient.
+    // this->eta_regularization_[index_i] = initial_eta_ * abs(this->variation_local_[index_i] + TinyReal) / averaged_variation_;
+    // this->eta_regularization_[index_i] = initial_eta_ * abs(this->variation_local_[index_i] + TinyReal) / abs(maximum_variation_);
+    this->eta_regularization_[index_i] = initial_eta_; // uniform coefficient.
 
-        DataType variable_derivative = (variable_i - this->variable_[index_j]);
-        Real parameter_b = 2.0 * this->eta_regularization_[index_i] * dW_ijV_j * Vol_i * dt / r_ij_;
-
-        error_and_parameters.error_ -= variable_derivative * parameter_b;
-        error_and_parameters.a_ += parameter_b;
-        error_and_parameters.c_ += parameter_b * parameter_b;
-    }
+    // the parameter b of each neighbor is the row coefficient scaled with the same factor
+    Real scaling = 2.0 * this->eta_regularization_[index_i] * Vol_i * dt;
+    error_and_parameters.error_ -= scaling * inner_operator.differenceProduct(index_i, this->variable_);
+    error_and_parameters.a_ += scaling * inner_operator.RowSum(index_i);
+    error_and_parameters.c_ += scaling * scaling * inner_operator.RowSquaredSum(index_i);
     error_and_parameters.a_ -= mass_i;
     return error_and_parameters;
 }
@@ -103,14 +104,12 @@ void RegularizationByDiffusionAnalogy<DataType>::
 
     Real Vol_i = this->Vol_[index_i];
     DataType &variable_i = this->variable_[index_i];
-    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
-    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    AssembledInnerOperator &inner_operator = this->inner_operator_;
+    Real scaling = 2.0 * this->eta_regularization_[index_i] * Vol_i * dt;
+    for (size_t n = inner_operator.FirstNeighbor(index_i); n != inner_operator.LastNeighbor(index_i); ++n)
     {
-        size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
-        Real r_ij = inner_neighborhood.r_ij_[n];
-
-        Real parameter_b = 2.0 * this->eta_regularization_[index_i] * dW_ijV_j * Vol_i * dt / r_ij;
+        size_t index_j = inner_operator.NeighborIndex(n);
+        Real parameter_b = scaling * inner_operator.Coefficient(n);
 
         // predicted quantity at particle j
         DataType variable_j = this->variable_[index_j] - parameter_k * parameter_b;
@@ -144,23 +143,13 @@ ErrorAndParameters<DataType> UpdateRegularizationVariation<DataType>::
 {
     Real Vol_i = this->Vol_[index_i];
     Real mass_i = this->mass_[index_i];
-    DataType &variable_i = this->variable_[index_i];
     ErrorAndParameters<DataType> error_and_parameters;
+    AssembledInnerOperator &inner_operator = this->inner_operator_;
 
-    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
-    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
-    {
-        size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
-        Real r_ij = inner_neighborhood.r_ij_[n];
-
-        DataType variable_derivative = (variable_i - this->variable_[index_j]);
-        Real parameter_b = 2.0 * this->eta_regularization_[index_i] * dW_ijV_j * Vol_i * dt / r_ij;
-
-        error_and_parameters.error_ -= variable_derivative * parameter_b;
-        error_and_parameters.a_ += parameter_b;
-        error_and_parameters.c_ += parameter_b * parameter_b;
-    }
+    Real scaling = 2.0 * this->eta_regularization_[index_i] * Vol_i * dt;
+    error_and_parameters.error_ -= scaling * inner_operator.differenceProduct(index_i, this->variable_);
+    error_and_parameters.a_ += scaling * inner_operator.RowSum(index_i);
+    error_and_parameters.c_ += scaling * scaling * inner_operator.RowSquaredSum(index_i);
     error_and_parameters.a_ -= mass_i;
     return error_and_parameters;
 }
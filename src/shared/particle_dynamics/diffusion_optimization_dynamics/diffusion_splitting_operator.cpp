@@ -0,0 +1,43 @@
+#include "diffusion_splitting_operator.h"
+
+#include "particle_iterators.h"
+
+namespace SPH
+{
+//=================================================================================================//
+void AssembledInnerOperator::assemble(ParticleConfiguration &inner_configuration,
+                                      Real *Vol, size_t total_real_particles)
+{
+    row_offset_.resize(total_real_particles + 1);
+    row_offset_[0] = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        row_offset_[i + 1] = row_offset_[i] + inner_configuration[i].current_size_;
+    }
+    neighbor_index_.resize(row_offset_[total_real_particles]);
+    coefficient_.resize(row_offset_[total_real_particles]);
+    row_sum_.resize(total_real_particles);
+    row_squared_sum_.resize(total_real_particles);
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                 [&](size_t index_i)
+                 {
+                     Neighborhood &inner_neighborhood = inner_configuration[index_i];
+                     Real row_sum = 0.0;
+                     Real row_squared_sum = 0.0;
+                     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+                     {
+                         size_t index_j = inner_neighborhood.j_[n];
+                         Real coefficient = inner_neighborhood.dW_ij_[n] * Vol[index_j] / inner_neighborhood.r_ij_[n];
+                         neighbor_index_[row_offset_[index_i] + n] = index_j;
+                         coefficient_[row_offset_[index_i] + n] = coefficient;
+                         row_sum += coefficient;
+                         row_squared_sum += coefficient * coefficient;
+                     }
+                     row_sum_[index_i] = row_sum;
+                     row_squared_sum_[index_i] = row_squared_sum;
+                 });
+    is_assembled_ = true;
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,89 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    diffusion_splitting_operator.h
+ * @brief   The neighbor-weighted operator of the splitting based diffusion optimization
+ *          assembled once in compressed rows.
+ * @details As the geometry does not change, the coefficients dW_ij V_j / r_ij
+ *          of the inner neighborhoods are the same for all optimization iterations.
+ *          They are stored with the neighbor indices in contiguous rows
+ *          so that the products with particle data run over contiguous memory.
+ * @author  Bo Zhang and Xiangyu Hu
+ */
+
+#ifndef DIFFUSION_SPLITTING_OPERATOR_H
+#define DIFFUSION_SPLITTING_OPERATOR_H
+
+#include "base_data_type_package.h"
+#include "neighborhood.h"
+
+namespace SPH
+{
+/**
+ * @class AssembledInnerOperator
+ * @brief The inner operator with the coefficients dW_ij V_j / r_ij in compressed rows.
+ */
+class AssembledInnerOperator
+{
+  public:
+    AssembledInnerOperator() : is_assembled_(false) {};
+    ~AssembledInnerOperator() {};
+
+    /** Assemble the operator from the current inner configuration. */
+    void assemble(ParticleConfiguration &inner_configuration, Real *Vol, size_t total_real_particles);
+    /** Assemble again before the next use, e.g. after the configuration is updated. */
+    void resetAssembled() { is_assembled_ = false; };
+    bool isAssembled() { return is_assembled_; };
+
+    size_t FirstNeighbor(size_t index_i) { return row_offset_[index_i]; };
+    size_t LastNeighbor(size_t index_i) { return row_offset_[index_i + 1]; };
+    size_t NeighborIndex(size_t n) { return neighbor_index_[n]; };
+    Real Coefficient(size_t n) { return coefficient_[n]; };
+    /** The sum of the coefficients in the row of particle i. */
+    Real RowSum(size_t index_i) { return row_sum_[index_i]; };
+    /** The sum of the squared coefficients in the row of particle i. */
+    Real RowSquaredSum(size_t index_i) { return row_squared_sum_[index_i]; };
+
+    /** Matrix-free product with the differences, i.e. sum_j c_ij (phi_i - phi_j). */
+    template <typename DataType>
+    DataType differenceProduct(size_t index_i, const DataType *variable)
+    {
+        const DataType &variable_i = variable[index_i];
+        DataType sum = ZeroData<DataType>::value;
+        for (size_t n = row_offset_[index_i]; n != row_offset_[index_i + 1]; ++n)
+        {
+            sum += coefficient_[n] * (variable_i - variable[neighbor_index_[n]]);
+        }
+        return sum;
+    };
+
+  protected:
+    bool is_assembled_;
+    StdVec<size_t> row_offset_;
+    StdVec<size_t> neighbor_index_;
+    StdVec<Real> coefficient_;
+    StdVec<Real> row_sum_;
+    StdVec<Real> row_squared_sum_;
+};
+} // namespace SPH
+#endif // DIFFUSION_SPLITTING_OPERATOR_H
@@ -22,16 +22,14 @@ ErrorAndParameters<DataType> ParameterSplittingByPDEInner<DataType>::
 {
     DataType &variable_i = this->variable_[index_i];
     ErrorAndParameters<DataType> error_and_parameters;
-    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
-    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    AssembledInnerOperator &inner_operator = this->inner_operator_;
+    for (size_t n = inner_operator.FirstNeighbor(index_i); n != inner_operator.LastNeighbor(index_i); ++n)
     {
-        size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
-        Real r_ij = inner_neighborhood.r_ij_[n];
+        size_t index_j = inner_operator.NeighborIndex(n);
 
         DataType variable_derivative = variable_i + this->variable_[index_j];
         Real phi_ij = this->species_modified_[index_i] - this->species_recovery_[index_j];
-        Real parameter_b = phi_ij * dW_ijV_j * dt / r_ij;
+        Real parameter_b = phi_ij * inner_operator.Coefficient(n) * dt;
 
         error_and_parameters.error_ -= variable_derivative * parameter_b;
         error_and_parameters.a_ += parameter_b;
@@ -55,15 +53,13 @@ void ParameterSplittingByPDEInner<DataType>::
         this->variable_[index_i] = 0.1;
     } // set lower bound
 
-    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
-    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    AssembledInnerOperator &inner_operator = this->inner_operator_;
+    for (size_t n = inner_operator.FirstNeighbor(index_i); n != inner_operator.LastNeighbor(index_i); ++n)
     {
-        size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
-        Real r_ij = inner_neighborhood.r_ij_[n];
+        size_t index_j = inner_operator.NeighborIndex(n);
 
         Real phi_ij = this->species_modified_[index_i] - this->species_recovery_[index_j];
-        Real parameter_b = phi_ij * dW_ijV_j * dt / r_ij;
+        Real parameter_b = phi_ij * inner_operator.Coefficient(n) * dt;
 
         this->parameter_recovery_[index_j] = this->variable_[index_j];
         this->variable_[index_j] += parameter_k * parameter_b;
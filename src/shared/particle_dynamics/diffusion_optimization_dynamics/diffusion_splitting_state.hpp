@@ -23,16 +23,16 @@ ErrorAndParameters<DataType> TemperatureSplittingByPDEInner<DataType>::
     DataType &variable_i = this->variable_[index_i];
     ErrorAndParameters<DataType> error_and_parameters;
     Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    size_t first_coefficient = this->inner_operator_.FirstNeighbor(index_i);
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
         size_t &index_j = inner_neighborhood.j_[n];
-        Real &r_ij_ = inner_neighborhood.r_ij_[n];
         Vecd &e_ij_ = inner_neighborhood.e_ij_[n];
 
         // linear projection
         DataType variable_derivative = (variable_i - this->variable_[index_j]);
         Real diff_coff_ij = this->diffusion_.getInterParticleDiffusionCoeff(index_i, index_j, e_ij_);
-        Real parameter_b = 2.0 * diff_coff_ij * inner_neighborhood.dW_ij_[n] * this->Vol_[index_j] * dt / r_ij_;
+        Real parameter_b = 2.0 * diff_coff_ij * this->inner_operator_.Coefficient(first_coefficient + n) * dt;
 
         error_and_parameters.error_ -= variable_derivative * parameter_b;
         error_and_parameters.a_ += parameter_b;
@@ -52,14 +52,14 @@ void TemperatureSplittingByPDEInner<DataType>::
     this->variable_[index_i] += parameter_k * error_and_parameters.a_;
 
     Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    size_t first_coefficient = this->inner_operator_.FirstNeighbor(index_i);
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
         size_t &index_j = inner_neighborhood.j_[n];
-        Real &r_ij_ = inner_neighborhood.r_ij_[n];
         Vecd &e_ij_ = inner_neighborhood.e_ij_[n];
 
         Real diff_coff_ij = this->diffusion_.getInterParticleDiffusionCoeff(index_i, index_j, e_ij_);
-        Real parameter_b = 2.0 * diff_coff_ij * inner_neighborhood.dW_ij_[n] * this->Vol_[index_j] * dt / r_ij_;
+        Real parameter_b = 2.0 * diff_coff_ij * this->inner_operator_.Coefficient(first_coefficient + n) * dt;
         this->variable_[index_j] -= parameter_k * parameter_b;
     }
 }
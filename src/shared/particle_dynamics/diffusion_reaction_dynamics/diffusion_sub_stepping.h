@@ -0,0 +1,82 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    diffusion_sub_stepping.h
+ * @brief   The multi-rate sub-stepping of the inner diffusion within a larger time step,
+ *          e.g. the thermal diffusion within a fluid step of conjugate heat transfer.
+ * @details The neighbor indices and the pair transfer coefficients, i.e. the inter-particle
+ *          diffusion coefficient multiplied with the surface area 2 grad_ij V_j . e_ij / r_ij,
+ *          are packed once per call into a compact working set together with the species.
+ *          The sub-steps of the 2nd-order Runge-Kutta scheme run only on this working set,
+ *          and the species are written back to the particles after the last sub-step.
+ *          The configuration and the diffusion coefficients are frozen within the call.
+ *          If the gradient species differs from the diffusion species,
+ *          it is not evolved by the diffusion and is frozen too.
+ * @author  Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef DIFFUSION_SUB_STEPPING_H
+#define DIFFUSION_SUB_STEPPING_H
+
+#include "diffusion_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class DiffusionSubSteppingInnerRK2
+ * @brief Integrate the inner diffusion of all species by a number of RK2 sub-steps
+ * on the packed working set, with the given time step size divided equally.
+ */
+template <class KernelGradientType, class DiffusionType>
+class DiffusionSubSteppingInnerRK2 : public LocalDynamics, public DataDelegateInner, public BaseDynamics<void>
+{
+  public:
+    DiffusionSubSteppingInnerRK2(BaseInnerRelation &inner_relation, size_t number_of_sub_steps);
+    virtual ~DiffusionSubSteppingInnerRK2() {};
+    void setNumberOfSubSteps(size_t number_of_sub_steps) { number_of_sub_steps_ = number_of_sub_steps; };
+
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    size_t number_of_sub_steps_;
+    size_t number_of_species_;
+    Real *Vol_;
+    KernelGradientType kernel_gradient_;
+    StdVec<DiffusionType *> diffusions_;
+    StdVec<Real *> diffusion_species_;
+    StdVec<Real *> gradient_species_;
+    StdVec<bool> is_gradient_species_evolving_;
+    /** the working set */
+    size_t total_particles_;
+    StdVec<size_t> row_offset_;
+    StdVec<size_t> neighbor_index_;
+    StdVec<StdVec<Real>> transfer_coefficient_;
+    StdVec<StdVec<Real>> species_, species_intermediate_, change_rate_;
+
+    void packWorkingSet();
+    void computeChangeRate(size_t m, const Real *gradient_species);
+    void advanceSubStep(Real sub_dt);
+    void writeBackSpecies();
+};
+} // namespace SPH
+#endif // DIFFUSION_SUB_STEPPING_H
@@ -0,0 +1,168 @@
+/**
+ * @file 	diffusion_sub_stepping.hpp
+ * @brief 	The multi-rate sub-stepping of the inner diffusion.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef DIFFUSION_SUB_STEPPING_HPP
+#define DIFFUSION_SUB_STEPPING_HPP
+
+#include "diffusion_sub_stepping.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+DiffusionSubSteppingInnerRK2<KernelGradientType, DiffusionType>::
+    DiffusionSubSteppingInnerRK2(BaseInnerRelation &inner_relation, size_t number_of_sub_steps)
+    : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
+      BaseDynamics<void>(), number_of_sub_steps_(number_of_sub_steps),
+      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      kernel_gradient_(particles_), total_particles_(0)
+{
+    AbstractDiffusion &abstract_diffusion = DynamicCast<AbstractDiffusion>(this, sph_body_->getBaseMaterial());
+    for (auto &diffusion : abstract_diffusion.AllDiffusions())
+    {
+        diffusions_.push_back(DynamicCast<DiffusionType>(this, diffusion));
+    }
+    number_of_species_ = diffusions_.size();
+
+    for (auto &diffusion : diffusions_)
+    {
+        std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+        diffusion_species_.push_back(particles_->registerStateVariableData<Real>(diffusion_species_name));
+        particles_->addEvolvingVariable<Real>(diffusion_species_name);
+        particles_->addVariableToWrite<Real>(diffusion_species_name);
+
+        std::string gradient_species_name = diffusion->GradientSpeciesName();
+        gradient_species_.push_back(particles_->registerStateVariableData<Real>(gradient_species_name));
+        is_gradient_species_evolving_.push_back(gradient_species_name == diffusion_species_name);
+    }
+    transfer_coefficient_.resize(number_of_species_);
+    species_.resize(number_of_species_);
+    species_intermediate_.resize(number_of_species_);
+    change_rate_.resize(number_of_species_);
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionSubSteppingInnerRK2<KernelGradientType, DiffusionType>::packWorkingSet()
+{
+    total_particles_ = particles_->TotalRealParticles();
+    row_offset_.resize(total_particles_ + 1);
+    row_offset_[0] = 0;
+    for (size_t i = 0; i != total_particles_; ++i)
+    {
+        row_offset_[i + 1] = row_offset_[i] + inner_configuration_[i].current_size_;
+    }
+    size_t number_of_pairs = row_offset_[total_particles_];
+    neighbor_index_.resize(number_of_pairs);
+    for (size_t m = 0; m != number_of_species_; ++m)
+    {
+        transfer_coefficient_[m].resize(number_of_pairs);
+        species_[m].resize(total_particles_);
+        species_intermediate_[m].resize(total_particles_);
+        change_rate_[m].resize(total_particles_);
+    }
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_particles_),
+                 [&](size_t index_i)
+                 {
+                     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+                     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+                     {
+                         size_t index_j = inner_neighborhood.j_[n];
+                         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
+                         Vecd &e_ij = inner_neighborhood.e_ij_[n];
+                         const Vecd &grad_ijV_j = kernel_gradient_(index_i, index_j, dW_ijV_j, e_ij);
+                         Real surface_area_ij = 2.0 * grad_ijV_j.dot(e_ij) / inner_neighborhood.r_ij_[n];
+
+                         size_t pair = row_offset_[index_i] + n;
+                         neighbor_index_[pair] = index_j;
+                         for (size_t m = 0; m != number_of_species_; ++m)
+                         {
+                             transfer_coefficient_[m][pair] =
+                                 diffusions_[m]->getInterParticleDiffusionCoeff(index_i, index_j, e_ij) * surface_area_ij;
+                         }
+                     }
+                     for (size_t m = 0; m != number_of_species_; ++m)
+                     {
+                         species_[m][index_i] = diffusion_species_[m][index_i];
+                     }
+                 });
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionSubSteppingInnerRK2<KernelGradientType, DiffusionType>::
+    computeChangeRate(size_t m, const Real *gradient_species)
+{
+    const Real *transfer_coefficient = transfer_coefficient_[m].data();
+    Real *change_rate = change_rate_[m].data();
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_particles_),
+                 [&](size_t index_i)
+                 {
+                     Real gradient_species_i = gradient_species[index_i];
+                     Real d_species = 0.0;
+                     for (size_t n = row_offset_[index_i]; n != row_offset_[index_i + 1]; ++n)
+                     {
+                         d_species += transfer_coefficient[n] * (gradient_species_i - gradient_species[neighbor_index_[n]]);
+                     }
+                     change_rate[index_i] = d_species;
+                 });
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionSubSteppingInnerRK2<KernelGradientType, DiffusionType>::advanceSubStep(Real sub_dt)
+{
+    for (size_t m = 0; m != number_of_species_; ++m)
+    {
+        Real *species = species_[m].data();
+        Real *species_intermediate = species_intermediate_[m].data();
+        Real *change_rate = change_rate_[m].data();
+        const Real *gradient_species = is_gradient_species_evolving_[m] ? species : gradient_species_[m];
+
+        // the first stage
+        computeChangeRate(m, gradient_species);
+        particle_for(execution::ParallelPolicy(), IndexRange(0, total_particles_),
+                     [&](size_t index_i)
+                     {
+                         species_intermediate[index_i] = species[index_i];
+                         species[index_i] += sub_dt * change_rate[index_i];
+                     });
+        // the second stage
+        computeChangeRate(m, gradient_species);
+        particle_for(execution::ParallelPolicy(), IndexRange(0, total_particles_),
+                     [&](size_t index_i)
+                     {
+                         species[index_i] = 0.5 * species_intermediate[index_i] +
+                                            0.5 * (species[index_i] + sub_dt * change_rate[index_i]);
+                     });
+    }
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionSubSteppingInnerRK2<KernelGradientType, DiffusionType>::writeBackSpecies()
+{
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_particles_),
+                 [&](size_t index_i)
+                 {
+                     for (size_t m = 0; m != number_of_species_; ++m)
+                     {
+                         diffusion_species_[m][index_i] = species_[m][index_i];
+                     }
+                 });
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionSubSteppingInnerRK2<KernelGradientType, DiffusionType>::exec(Real dt)
+{
+    packWorkingSet();
+    Real sub_dt = dt / Real(SMAX(number_of_sub_steps_, size_t(1)));
+    for (size_t k = 0; k < SMAX(number_of_sub_steps_, size_t(1)); ++k)
+    {
+        advanceSubStep(sub_dt);
+    }
+    writeBackSpecies();
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // DIFFUSION_SUB_STEPPING_HPP
@@ -113,6 +113,8 @@ class SimpleDynamics : public LocalDynamicsType, public BaseDynamics<void>
 
     virtual void exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         this->setUpdated(this->identifier_->getSPHBody());
         this->setupDynamics(dt);
         particle_for(ExecutionPolicy(),
@@ -141,6 +143,8 @@ class ReduceDynamics : public LocalDynamicsType,
 
     virtual ReturnType exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         this->setupDynamics(dt);
         ReturnType temp = particle_reduce(ExecutionPolicy(),
                                           this->identifier_->LoopRange(), this->Reference(), this->getOperation(),
@@ -185,6 +189,8 @@ class BaseInteractionDynamics : public LocalDynamicsType, public BaseDynamics<vo
 
     virtual void exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         this->setUpdated(this->identifier_->getSPHBody());
         this->setupDynamics(dt);
         runInteraction(dt);
@@ -280,6 +286,8 @@ class InteractionWithUpdate : public InteractionDynamics<LocalDynamicsType, Exec
 
     virtual void exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         InteractionDynamics<LocalDynamicsType, ExecutionPolicy>::exec(dt);
         particle_for(ExecutionPolicy(),
                      this->identifier_->LoopRange(),
@@ -307,6 +315,8 @@ class InteractionWithInitialization : public InteractionDynamics<LocalDynamicsTy
 
     virtual void exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         particle_for(ExecutionPolicy(),
                      this->identifier_->LoopRange(),
                      [&](size_t i)
@@ -333,6 +343,8 @@ class Dynamics1Level : public InteractionDynamics<LocalDynamicsType, ExecutionPo
 
     virtual void exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         this->setUpdated(this->identifier_->getSPHBody());
         this->setupDynamics(dt);
 
@@ -62,6 +62,35 @@ class ElectroPhysiologyReaction : public BaseReactionModel<3>
     virtual ~ElectroPhysiologyReaction() {};
 
     void initializeElectroPhysiologyReaction();
+
+    /** The statically dispatched rates for the computing kernels of the concrete models. */
+    class ReactionKernel
+    {
+      public:
+        explicit ReactionKernel(ElectroPhysiologyReaction &encloser)
+            : k_a_(encloser.k_a_), voltage_(encloser.voltage_),
+              gate_variable_(encloser.gate_variable_),
+              active_contraction_stress_(encloser.active_contraction_stress_) {};
+
+      protected:
+        Real k_a_;
+        UnsignedInt voltage_;
+        UnsignedInt gate_variable_;
+        UnsignedInt active_contraction_stress_;
+
+        Real getProductionActiveContractionStress(const LocalSpecies &species)
+        {
+            Real voltage_dim = species[voltage_] * 100.0 - 80.0;
+            Real factor = 0.1 + (1.0 - 0.1) * math::exp(-math::exp(-voltage_dim));
+            return factor * k_a_ * (voltage_dim + 80.0);
+        };
+
+        Real getLossRateActiveContractionStress(const LocalSpecies &species)
+        {
+            Real voltage_dim = species[voltage_] * 100.0 - 80.0;
+            return 0.1 + (1.0 - 0.1) * math::exp(-math::exp(-voltage_dim));
+        };
+    };
 };
 
 /**
@@ -89,6 +118,43 @@ class AlievPanfilowModel : public ElectroPhysiologyReaction
         reaction_model_ = "AlievPanfilowModel";
     };
     virtual ~AlievPanfilowModel() {};
+
+    class ReactionKernel : public ElectroPhysiologyReaction::ReactionKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ReactionKernel(const ExecutionPolicy &ex_policy, AlievPanfilowModel &encloser)
+            : ElectroPhysiologyReaction::ReactionKernel(encloser),
+              k_(encloser.k_), a_(encloser.a_), b_(encloser.b_), mu_1_(encloser.mu_1_),
+              mu_2_(encloser.mu_2_), epsilon_(encloser.epsilon_), c_m_(encloser.c_m_) {};
+
+        Real getProductionRate(UnsignedInt k, const LocalSpecies &species)
+        {
+            Real voltage = species[voltage_];
+            if (k == voltage_)
+                return -k_ * voltage * (voltage * voltage - a_ * voltage - voltage) / c_m_;
+            if (k == gate_variable_)
+                return -gateVariableLossRate(species) * k_ * voltage * (voltage - b_ - 1.0);
+            return getProductionActiveContractionStress(species);
+        };
+
+        Real getLossRate(UnsignedInt k, const LocalSpecies &species)
+        {
+            if (k == voltage_)
+                return (k_ * a_ + species[gate_variable_]) / c_m_;
+            if (k == gate_variable_)
+                return gateVariableLossRate(species);
+            return getLossRateActiveContractionStress(species);
+        };
+
+      protected:
+        Real k_, a_, b_, mu_1_, mu_2_, epsilon_, c_m_;
+
+        Real gateVariableLossRate(const LocalSpecies &species)
+        {
+            return epsilon_ + mu_1_ * species[gate_variable_] / (mu_2_ + species[voltage_] + Eps);
+        };
+    };
 };
 
 /**
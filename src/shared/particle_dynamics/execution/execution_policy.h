@@ -77,10 +77,16 @@ inline constexpr auto seq_device = SequencedDevicePolicy{};
 #if SPHINXSYS_USE_SYCL
 using MainExecutionPolicy = ParallelDevicePolicy;
 inline constexpr auto par_ck = ParallelDevicePolicy{};
+/** Wait for the kernels submitted asynchronously before the host accesses device data. */
+void waitForDeviceSubmissions();
 #else
 using MainExecutionPolicy = ParallelPolicy;
 inline constexpr auto par_ck = ParallelPolicy{};
+inline void waitForDeviceSubmissions() {};
 #endif // SPHINXSYS_USE_SYCL
+/** For the small and branchy bodies, e.g. those coupled with multi-body dynamics,
+ *  kept on the host in a device build. See VariableSynchronizationCK for the coupling. */
+using HostExecutionPolicy = ParallelPolicy;
 
 } // namespace execution
 } // namespace SPH
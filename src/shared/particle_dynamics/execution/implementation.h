@@ -141,6 +141,64 @@ class Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernelType>
     LocalDynamicsType &local_dynamics_;
     ComputingKernelType *computing_kernel_;
 };
+
+/** The pointers to a few computing kernels of the same type, so that they are executed in one launch. */
+template <class ComputingKernelType, UnsignedInt MaxSize = 16>
+struct ComputingKernelArray
+{
+    static constexpr UnsignedInt max_size_ = MaxSize;
+    UnsignedInt size_ = 0;
+    ComputingKernelType *kernels_[MaxSize] = {};
+};
+
+/**
+ * @class ComputingKernelArrayImplementation
+ * @brief Keep a copy of the kernel array in the memory of the execution policy.
+ * The kernels are given by the implementations of each and are not owned by the array,
+ * which is copied again only if the kernel pointers have changed.
+ */
+template <class ExecutionPolicy, class ComputingKernelType, UnsignedInt MaxSize = 16>
+class ComputingKernelArrayImplementation
+{
+    using KernelArray = ComputingKernelArray<ComputingKernelType, MaxSize>;
+
+  public:
+    ComputingKernelArrayImplementation() : kernel_array_(nullptr) {};
+    ~ComputingKernelArrayImplementation()
+    {
+        if (kernel_array_ != nullptr)
+            freeComputingKernel(ExecutionPolicy{}, kernel_array_);
+    };
+
+    KernelArray *getKernelArray(const StdVec<ComputingKernelType *> &kernels)
+    {
+        if (kernels.size() > MaxSize)
+        {
+            std::cout << "\n Error: the number of kernels " << kernels.size()
+                      << " exceeds the kernel array size " << MaxSize << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        bool is_changed = kernel_array_ == nullptr || host_array_.size_ != kernels.size();
+        for (UnsignedInt k = 0; k != kernels.size(); ++k)
+        {
+            is_changed = is_changed || host_array_.kernels_[k] != kernels[k];
+            host_array_.kernels_[k] = kernels[k];
+        }
+        host_array_.size_ = kernels.size();
+
+        if (kernel_array_ == nullptr)
+            kernel_array_ = allocateComputingKernel<KernelArray>(ExecutionPolicy{});
+        if (is_changed)
+            copyComputingKernel(ExecutionPolicy{}, &host_array_, kernel_array_);
+        return kernel_array_;
+    };
+
+  protected:
+    KernelArray host_array_;
+    KernelArray *kernel_array_;
+};
 } // namespace execution
 } // namespace SPH
 #endif // IMPLEMENTATION_H
@@ -7,12 +7,13 @@ namespace fluid_dynamics
 //=================================================================================================//
 void DensitySummation<Inner<>>::interaction(size_t index_i, Real dt)
 {
-    Real sigma = W0_;
+    AccumulationReal sigma = W0_;
     const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+    SIMD_SUM_REDUCTION(sigma)
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
         sigma += inner_neighborhood.W_ij_[n];
 
-    rho_sum_[index_i] = sigma * rho0_ * inv_sigma0_;
+    rho_sum_[index_i] = storageCast(sigma * rho0_ * inv_sigma0_);
 }
 //=================================================================================================//
 void DensitySummation<Inner<>>::update(size_t index_i, Real dt)
@@ -35,13 +36,14 @@ void DensitySummation<Inner<AdaptiveSmoothingLength>>::update(size_t index_i, Re
 //=================================================================================================//
 void DensitySummation<Inner<AdaptiveSmoothingLength>>::interaction(size_t index_i, Real dt)
 {
-    Real sigma_i = mass_[index_i] * kernel_.W0(h_ratio_[index_i], ZeroVecd);
+    AccumulationReal sigma_i = mass_[index_i] * kernel_.W0(h_ratio_[index_i], ZeroVecd);
     const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+    SIMD_SUM_REDUCTION(sigma_i)
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
         sigma_i += inner_neighborhood.W_ij_[n] * mass_[inner_neighborhood.j_[n]];
 
-    rho_sum_[index_i] = sigma_i * rho0_ * inv_sigma0_ / mass_[index_i] /
-                        sph_adaptation_.NumberDensityScaleFactor(h_ratio_[index_i]);
+    rho_sum_[index_i] = storageCast(sigma_i * rho0_ * inv_sigma0_ / mass_[index_i] /
+                                    sph_adaptation_.NumberDensityScaleFactor(h_ratio_[index_i]));
 }
 //=================================================================================================//
 DensitySummation<Contact<Base>>::DensitySummation(BaseContactRelation &contact_relation)
@@ -57,18 +59,19 @@ DensitySummation<Contact<Base>>::DensitySummation(BaseContactRelation &contact_r
 //=================================================================================================//
 Real DensitySummation<Contact<Base>>::ContactSummation(size_t index_i)
 {
-    Real sigma(0.0);
+    AccumulationReal sigma(0.0);
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         Real *contact_mass_k = this->contact_mass_[k];
         Real contact_inv_rho0_k = contact_inv_rho0_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
+        SIMD_SUM_REDUCTION(sigma)
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
             sigma += contact_neighborhood.W_ij_[n] * contact_inv_rho0_k * contact_mass_k[contact_neighborhood.j_[n]];
         }
     }
-    return sigma;
+    return storageCast(sigma);
 };
 //=================================================================================================//
 void DensitySummation<Contact<>>::interaction(size_t index_i, Real dt)
@@ -34,3 +34,4 @@
 
 #include "eulerian_compressible_fluid_integration.hpp"
 #include "eulerian_fluid_integration.hpp"
+#include "overlapping_domain_coupling.h"
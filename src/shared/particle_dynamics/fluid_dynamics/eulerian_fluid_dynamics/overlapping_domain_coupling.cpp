@@ -0,0 +1,97 @@
+#include "overlapping_domain_coupling.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+Real OverlappingBlendLayer::FarFieldWeight(const Vecd &position)
+{
+    Real depth = -near_field_shape_.findSignedDistance(position);
+    return SMIN(SMAX(1.0 - depth / blend_width_, Real(0)), Real(1));
+}
+//=================================================================================================//
+BaseOverlappingInterpolation::BaseOverlappingInterpolation(BaseContactRelation &contact_relation)
+    : LocalDynamics(contact_relation.getSPHBody()), DataDelegateContact(contact_relation),
+      rho_(particles_->getVariableDataByName<Real>("Density")),
+      p_(particles_->getVariableDataByName<Real>("Pressure")),
+      vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
+      pos_(particles_->getVariableDataByName<Vecd>("Position"))
+{
+    for (size_t k = 0; k != contact_particles_.size(); ++k)
+    {
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_rho_.push_back(contact_particles_[k]->getVariableDataByName<Real>("Density"));
+        contact_p_.push_back(contact_particles_[k]->getVariableDataByName<Real>("Pressure"));
+        contact_vel_.push_back(contact_particles_[k]->getVariableDataByName<Vecd>("Velocity"));
+    }
+}
+//=================================================================================================//
+bool BaseOverlappingInterpolation::relaxToContactState(size_t index_i, Real weight)
+{
+    Real ttl_weight(0), rho_sum(0), p_sum(0);
+    Vecd vel_sum = Vecd::Zero();
+    for (size_t k = 0; k < contact_configuration_.size(); ++k)
+    {
+        Real *Vol_k = contact_Vol_[k];
+        Real *rho_k = contact_rho_[k];
+        Real *p_k = contact_p_[k];
+        Vecd *vel_k = contact_vel_[k];
+        Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
+        for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = contact_neighborhood.j_[n];
+            Real weight_j = contact_neighborhood.W_ij_[n] * Vol_k[index_j];
+            ttl_weight += weight_j;
+            rho_sum += weight_j * rho_k[index_j];
+            p_sum += weight_j * p_k[index_j];
+            vel_sum += weight_j * vel_k[index_j];
+        }
+    }
+
+    // a truncated support, e.g. close to a free surface, does not give a reliable state
+    if (ttl_weight < 0.5)
+        return false;
+
+    rho_[index_i] += weight * (rho_sum / ttl_weight - rho_[index_i]);
+    p_[index_i] += weight * (p_sum / ttl_weight - p_[index_i]);
+    vel_[index_i] += weight * (vel_sum / ttl_weight - vel_[index_i]);
+    return true;
+}
+//=================================================================================================//
+BlendFromFarField::BlendFromFarField(BaseContactRelation &contact_relation, OverlappingBlendLayer &blend_layer)
+    : BaseOverlappingInterpolation(contact_relation), blend_layer_(blend_layer) {}
+//=================================================================================================//
+void BlendFromFarField::interaction(size_t index_i, Real dt)
+{
+    Real weight = blend_layer_.FarFieldWeight(pos_[index_i]);
+    if (weight > 0.0)
+    {
+        relaxToContactState(index_i, weight);
+    }
+}
+//=================================================================================================//
+ImposeFromNearField::ImposeFromNearField(BaseContactRelation &contact_relation, OverlappingBlendLayer &blend_layer)
+    : BaseOverlappingInterpolation(contact_relation),
+      near_field_weight_(particles_->registerStateVariableData<Real>("NearFieldWeight")),
+      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      mass_(particles_->getVariableDataByName<Real>("Mass")),
+      mom_(particles_->registerStateVariableData<Vecd>("Momentum"))
+{
+    for (size_t i = 0; i != particles_->TotalRealParticles(); ++i)
+    {
+        near_field_weight_[i] = 1.0 - blend_layer.FarFieldWeight(pos_[i]);
+    }
+}
+//=================================================================================================//
+void ImposeFromNearField::interaction(size_t index_i, Real dt)
+{
+    if (near_field_weight_[index_i] > 0.0 && relaxToContactState(index_i, near_field_weight_[index_i]))
+    {
+        mass_[index_i] = rho_[index_i] * Vol_[index_i];
+        mom_[index_i] = mass_[index_i] * vel_[index_i];
+    }
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
@@ -0,0 +1,113 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file overlapping_domain_coupling.h
+ * @brief Overlapping-domain coupling of an Eulerian FVM far field and a Lagrangian SPH near field.
+ * @details The unstructured mesh covers the far field and the near-field region,
+ * in which the SPH particles are located, overlaps it.
+ * In the blend layer along the boundary of the near-field region,
+ * the SPH state is relaxed towards the Shepard interpolation from the mesh cells,
+ * and the cells inside the near-field region are relaxed towards the interpolation from the particles
+ * with the complementary weight, so that the cells deep inside are fully driven by the SPH solution.
+ * Both bodies are coupled by usual contact relations.
+ * @author Zhentong Wang and Xiangyu Hu
+ */
+
+#ifndef OVERLAPPING_DOMAIN_COUPLING_H
+#define OVERLAPPING_DOMAIN_COUPLING_H
+
+#include "base_fluid_dynamics.h"
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+/**
+ * @class OverlappingBlendLayer
+ * @brief The blend layer inside the boundary of the near-field shape.
+ */
+class OverlappingBlendLayer
+{
+  public:
+    OverlappingBlendLayer(Shape &near_field_shape, Real blend_width)
+        : near_field_shape_(near_field_shape), blend_width_(blend_width) {};
+    /** 1 outside the near field, decreasing linearly to 0 at the depth of the blend width. */
+    Real FarFieldWeight(const Vecd &position);
+
+  protected:
+    Shape &near_field_shape_;
+    Real blend_width_;
+};
+
+class BaseOverlappingInterpolation : public LocalDynamics, public DataDelegateContact
+{
+  public:
+    explicit BaseOverlappingInterpolation(BaseContactRelation &contact_relation);
+    virtual ~BaseOverlappingInterpolation() {};
+
+  protected:
+    Real *rho_, *p_;
+    Vecd *vel_, *pos_;
+    StdVec<Real *> contact_Vol_, contact_rho_, contact_p_;
+    StdVec<Vecd *> contact_vel_;
+    /** Relax the state towards the interpolation from the contact bodies, if supported by enough neighbors. */
+    bool relaxToContactState(size_t index_i, Real weight);
+};
+
+/**
+ * @class BlendFromFarField
+ * @brief Relax the SPH particles in the blend layer towards the far-field mesh solution.
+ * The contact relation is from the SPH body to the FVM body.
+ */
+class BlendFromFarField : public BaseOverlappingInterpolation
+{
+  public:
+    BlendFromFarField(BaseContactRelation &contact_relation, OverlappingBlendLayer &blend_layer);
+    virtual ~BlendFromFarField() {};
+    void interaction(size_t index_i, Real dt = 0.0);
+
+  protected:
+    OverlappingBlendLayer &blend_layer_;
+};
+
+/**
+ * @class ImposeFromNearField
+ * @brief Relax the mesh cells overlapped by the near field towards the SPH solution.
+ * The contact relation is from the FVM body to the SPH body.
+ * As the cells do not move, the weights are computed once at construction.
+ */
+class ImposeFromNearField : public BaseOverlappingInterpolation
+{
+  public:
+    ImposeFromNearField(BaseContactRelation &contact_relation, OverlappingBlendLayer &blend_layer);
+    virtual ~ImposeFromNearField() {};
+    void interaction(size_t index_i, Real dt = 0.0);
+
+  protected:
+    Real *near_field_weight_, *Vol_, *mass_;
+    Vecd *mom_;
+};
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // OVERLAPPING_DOMAIN_COUPLING_H
@@ -64,4 +64,31 @@ void PeriodicConditionUsingCellLinkedList::PeriodicCellLinkedList::exec(Real dt)
                  { InsertListDataNearUpperBound(*cell_ist, dt); });
 }
 //=================================================================================================//
+PeriodicConditionUsingMinimumImage::
+    PeriodicConditionUsingMinimumImage(RealBody &real_body, PeriodicAlongAxis &periodic_box)
+    : LocalDynamics(real_body), BaseDynamics<void>(),
+      periodic_image_(real_body.getPeriodicImage()),
+      pos_(particles_->getVariableDataByName<Vecd>("Position"))
+{
+    int axis = periodic_box.getAxis();
+    Real cut_off_radius = real_body.getSPHAdaptation().getKernel()->CutOffRadius();
+    Real period = periodic_box.getPeriodicTranslation()[axis];
+    if (period < 4.0 * cut_off_radius)
+    {
+        std::cout << "\n Error: the period " << period << " of body " << real_body.getName()
+                  << " is less than four times of the cut off radius!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    periodic_image_.setPeriodicAxis(periodic_box.getBoundingBox(), axis);
+}
+//=================================================================================================//
+void PeriodicConditionUsingMinimumImage::exec(Real dt)
+{
+    setupDynamics(dt);
+    particle_for(execution::ParallelPolicy(), sph_body_->LoopRange(),
+                 [&](size_t i)
+                 { pos_[i] = periodic_image_.insideImage(pos_[i]); });
+}
+//=================================================================================================//
 } // namespace SPH
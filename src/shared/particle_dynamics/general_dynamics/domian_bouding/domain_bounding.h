@@ -166,5 +166,27 @@ class PeriodicConditionUsingCellLinkedList : public BasePeriodicCondition<execut
     PeriodicConditionUsingCellLinkedList(RealBody &real_body, PeriodicAlongAxis &periodic_box);
     virtual ~PeriodicConditionUsingCellLinkedList() {};
 };
+
+/**
+ * @class PeriodicConditionUsingMinimumImage
+ * @brief The periodic condition without ghost particles or shifted cell list entries.
+ *	The periodic axis is registered to the periodic image of the body,
+ *	with which the neighbor search also visits the images of a particle across the periodic bounds
+ *	and builds the neighbor relation with the minimum image displacement.
+ *	Therefore, several axes can be combined, e.g. for a triply periodic box,
+ *	by defining one condition for each axis.
+ *	Only the bounding is carried out, before updating the cell linked list.
+ */
+class PeriodicConditionUsingMinimumImage : public LocalDynamics, public BaseDynamics<void>
+{
+  public:
+    PeriodicConditionUsingMinimumImage(RealBody &real_body, PeriodicAlongAxis &periodic_box);
+    virtual ~PeriodicConditionUsingMinimumImage() {};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    PeriodicImage &periodic_image_;
+    Vecd *pos_;
+};
 } // namespace SPH
 #endif // DOMAIN_BOUNDING_H
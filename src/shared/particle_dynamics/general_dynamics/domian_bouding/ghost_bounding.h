@@ -57,8 +57,8 @@ class Ghost<PeriodicAlongAxis> : public Ghost<Base>, public PeriodicAlongAxis
  *	The first step is carried out before update cell linked list and
  *	the second and third after the updating.
  *  Note that, currently, one should use this class for periodic condition in single direction.
- *  More work is required so that the class works for periodic condition in combined directions,
- *  such as periodic condition in both x and y directions.
+ *  For periodic condition in combined directions, such as in both x and y directions,
+ *  use PeriodicConditionUsingMinimumImage instead, which does not need ghost particles.
  */
 class PeriodicConditionUsingGhostParticles : public BasePeriodicCondition<execution::ParallelPolicy>
 {
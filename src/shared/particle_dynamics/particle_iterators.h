@@ -31,6 +31,7 @@
 
 #include "base_data_type_package.h"
 #include "implementation.h"
+#include "loop_scheduling.h"
 #include "sphinxsys_containers.h"
 
 namespace SPH
@@ -62,7 +63,8 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelPolicy &par_host, const IndexRange &particles_range,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
-    parallel_for(
+    static tbb::affinity_partitioner affinity_partitioner;
+    scheduled_parallel_for(
         particles_range,
         [&](const IndexRange &r)
         {
@@ -71,7 +73,7 @@ inline void particle_for(const ParallelPolicy &par_host, const IndexRange &parti
                 local_dynamics_function(i);
             }
         },
-        ap);
+        affinity_partitioner);
 };
 
 /**
@@ -89,7 +91,8 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelPolicy &par_host, const IndexVector &body_part_particles,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
-    parallel_for(
+    static tbb::affinity_partitioner affinity_partitioner;
+    scheduled_parallel_for(
         IndexRange(0, body_part_particles.size()),
         [&](const IndexRange &r)
         {
@@ -98,7 +101,7 @@ inline void particle_for(const ParallelPolicy &par_host, const IndexVector &body
                 local_dynamics_function(body_part_particles[i]);
             }
         },
-        ap);
+        affinity_partitioner);
 };
 /**
  * Bodypart By Cell-wise iterators (for sequential and parallel computing).
@@ -121,7 +124,8 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelPolicy &par_host, const ConcurrentCellLists &body_part_cells,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
-    parallel_for(
+    static tbb::affinity_partitioner affinity_partitioner;
+    scheduled_parallel_for(
         IndexRange(0, body_part_cells.size()),
         [&](const IndexRange &r)
         {
@@ -134,7 +138,7 @@ inline void particle_for(const ParallelPolicy &par_host, const ConcurrentCellLis
                 }
             }
         },
-        ap);
+        affinity_partitioner);
 };
 /**
  * BodypartByCell-wise iterators on cells (for sequential and parallel computing).
@@ -151,7 +155,8 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelPolicy &par_host, const DataListsInCells &body_part_cells,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
-    parallel_for(
+    static tbb::affinity_partitioner affinity_partitioner;
+    scheduled_parallel_for(
         IndexRange(0, body_part_cells.size()),
         [&](const IndexRange &r)
         {
@@ -160,7 +165,20 @@ inline void particle_for(const ParallelPolicy &par_host, const DataListsInCells
                 local_dynamics_function(body_part_cells[i]);
             }
         },
-        ap);
+        affinity_partitioner);
+};
+
+/**
+ * Particle-wise iterators in the order of a cell linked list, i.e. cell_sorted_index
+ * is the particle index list sorted by cells. Only used on the device, where
+ * neighboring work-items then search the same cells with coalesced memory access.
+ */
+template <class ExecutionPolicy, class LocalDynamicsFunction>
+inline void particle_for_in_cell_order(const ExecutionPolicy &ex_policy, const IndexRange &particles_range,
+                                       const UnsignedInt *cell_sorted_index,
+                                       const LocalDynamicsFunction &local_dynamics_function)
+{
+    particle_for(ex_policy, particles_range, local_dynamics_function);
 };
 
 template <class ExecutionPolicy, typename DynamicsRange, class ReturnType,
@@ -193,7 +211,7 @@ inline ReturnType particle_reduce(const ParallelPolicy &par_host, const IndexRan
                                   ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
-    return parallel_reduce(
+    return scheduled_parallel_reduce(
         particles_range,
         temp, [&](const IndexRange &r, ReturnType temp0) -> ReturnType
         {
@@ -227,7 +245,7 @@ inline ReturnType particle_reduce(const ParallelPolicy &par_host, const IndexVec
                                   ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
-    return parallel_reduce(
+    return scheduled_parallel_reduce(
         IndexRange(0, body_part_particles.size()),
         temp,
         [&](const IndexRange &r, ReturnType temp0) -> ReturnType
@@ -269,7 +287,7 @@ inline ReturnType particle_reduce(const ParallelPolicy &par_host, const Concurre
                                   ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
-    return parallel_reduce(
+    return scheduled_parallel_reduce(
         IndexRange(0, body_part_cells.size()),
         temp,
         [&](const IndexRange &r, ReturnType temp0) -> ReturnType
@@ -31,6 +31,9 @@
 
 #include "base_data_type_package.h"
 
+#include <tuple>
+#include <utility>
+
 namespace SPH
 {
 template <typename...>
@@ -144,5 +147,43 @@ struct ReduceReference<ReduceUpperBound>
     static inline const Vecd value = MinReal * Vecd::Ones();
 };
 
+struct ReduceBoundingBox : ReturnFunction<BoundingBoxd>
+{
+    BoundingBoxd operator()(const BoundingBoxd &x, const BoundingBoxd &y) const
+    {
+        return BoundingBoxd(x.lower_.cwiseMin(y.lower_), x.upper_.cwiseMax(y.upper_));
+    };
+};
+
+template <>
+struct ReduceReference<ReduceBoundingBox>
+{
+    static inline const BoundingBoxd value = BoundingBoxd(MaxReal * Vecd::Ones(), MinReal * Vecd::Ones());
+};
+
+/** Element-wise combination of several reduce operations, e.g. for reductions composed in one sweep. */
+template <typename... Operations>
+struct ReduceTuple : ReturnFunction<std::tuple<typename Operations::ReturnType...>>
+{
+    using TupleType = std::tuple<typename Operations::ReturnType...>;
+    TupleType operator()(const TupleType &x, const TupleType &y) const
+    {
+        return combine(x, y, std::index_sequence_for<Operations...>{});
+    };
+
+  private:
+    template <size_t... Is>
+    TupleType combine(const TupleType &x, const TupleType &y, std::index_sequence<Is...>) const
+    {
+        return TupleType(Operations()(std::get<Is>(x), std::get<Is>(y))...);
+    };
+};
+
+template <typename... Operations>
+struct ReduceReference<ReduceTuple<Operations...>>
+{
+    using TupleType = std::tuple<typename Operations::ReturnType...>;
+    static inline const TupleType value = TupleType(ReduceReference<Operations>::value...);
+};
 } // namespace SPH
 #endif // REDUCE_FUNCTORS_H
@@ -126,7 +126,7 @@ void RelaxationResidual<Contact<>>::interaction(size_t index_i, Real dt)
 RelaxationScaling::RelaxationScaling(SPHBody &sph_body)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       residual_(particles_->getVariableDataByName<Vecd>("ZeroOrderResidual")),
-      h_ref_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()) {}
+      h_ref_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()), max_residual_(MaxReal) {}
 //=================================================================================================//
 Real RelaxationScaling::reduce(size_t index_i, Real dt)
 {
@@ -135,9 +135,29 @@ Real RelaxationScaling::reduce(size_t index_i, Real dt)
 //=================================================================================================//
 Real RelaxationScaling::outputResult(Real reduced_value)
 {
+    max_residual_ = reduced_value;
     return 0.0625 * h_ref_ / (reduced_value + TinyReal);
 }
 //=================================================================================================//
+RelaxationConvergence::RelaxationConvergence(Real tolerance, Real plateau_ratio, size_t check_interval)
+    : tolerance_(tolerance), plateau_ratio_(plateau_ratio), check_interval_(check_interval),
+      step_count_(0), interval_minimum_(MaxReal), previous_interval_minimum_(MaxReal),
+      is_converged_(false) {}
+//=================================================================================================//
+bool RelaxationConvergence::checkConvergence(Real normalized_residual)
+{
+    interval_minimum_ = SMIN(interval_minimum_, normalized_residual);
+    step_count_++;
+    if (step_count_ % check_interval_ == 0)
+    {
+        is_converged_ = interval_minimum_ < tolerance_ &&
+                        ABS(previous_interval_minimum_ - interval_minimum_) < plateau_ratio_ * previous_interval_minimum_;
+        previous_interval_minimum_ = interval_minimum_;
+        interval_minimum_ = MaxReal;
+    }
+    return is_converged_;
+}
+//=================================================================================================//
 PositionRelaxation::PositionRelaxation(SPHBody &sph_body)
     : LocalDynamics(sph_body),
       sph_adaptation_(&sph_body.getSPHAdaptation()),
@@ -177,10 +177,38 @@ class RelaxationScaling : public LocalDynamicsReduce<ReduceMax>
     virtual ~RelaxationScaling() {};
     Real reduce(size_t index_i, Real dt = 0.0);
     virtual Real outputResult(Real reduced_value);
+    /** The maximum residual of the last step normalized by the reference smoothing length. */
+    Real NormalizedResidual() { return max_residual_ * h_ref_; };
 
   protected:
     Vecd *residual_;
     Real h_ref_;
+    Real max_residual_;
+};
+
+/**
+ * @class RelaxationConvergence
+ * @brief Check whether a relaxation has converged from the residual of each step.
+ * @details The relaxation is converged when the minimum residual over an interval of steps
+ * is under the tolerance and has changed less than the plateau ratio from the previous interval.
+ * The interval minimum is used because the maximum residual of single steps is noisy.
+ */
+class RelaxationConvergence
+{
+  public:
+    explicit RelaxationConvergence(Real tolerance, Real plateau_ratio = 0.01, size_t check_interval = 50);
+    ~RelaxationConvergence() {};
+    bool checkConvergence(Real normalized_residual);
+    bool isConverged() { return is_converged_; };
+
+  protected:
+    Real tolerance_;
+    Real plateau_ratio_;
+    size_t check_interval_;
+    size_t step_count_;
+    Real interval_minimum_;
+    Real previous_interval_minimum_;
+    bool is_converged_;
 };
 
 /**
@@ -223,6 +251,7 @@ class RelaxationStep : public BaseDynamics<void>
     explicit RelaxationStep(FirstArg &&first_arg, OtherArgs &&...other_args);
     virtual ~RelaxationStep() {};
     SimpleDynamics<ShapeSurfaceBounding> &SurfaceBounding() { return surface_bounding_; };
+    Real NormalizedResidual() { return relaxation_scaling_.NormalizedResidual(); };
     virtual void exec(Real dt = 0.0) override;
 
   protected:
@@ -243,6 +272,7 @@ class RelaxationStepImplicit : public BaseDynamics<void>
     explicit RelaxationStepImplicit(FirstArg &&first_arg, OtherArgs &&...other_args);
     virtual ~RelaxationStepImplicit() {};
     SimpleDynamics<ShapeSurfaceBounding> &SurfaceBounding() { return surface_bounding_; };
+    Real NormalizedResidual() { return relaxation_scaling_.NormalizedResidual(); };
     virtual void exec(Real dt = 0.0) override;
 
   protected:
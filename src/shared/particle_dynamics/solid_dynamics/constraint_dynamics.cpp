@@ -1,6 +1,8 @@
 #include "constraint_dynamics.h"
 #include "sph_system.hpp"
 
+#include <tbb/enumerable_thread_specific.h>
+
 namespace SPH
 {
 namespace solid_dynamics
@@ -106,5 +108,130 @@ void ConstrainSolidBodyMassCenter::update(size_t index_i, Real dt)
     vel_[index_i] -= velocity_correction_;
 }
 //=================================================================================================//
+BatchedSimBodyCoupling::
+    BatchedSimBodyCoupling(SimTK::MultibodySystem &MBsystem, SimTK::SimbodyMatterSubsystem &matter,
+                           SimTK::Force::DiscreteForces &force_on_bodies,
+                           SimTK::RungeKuttaMersonIntegrator &integ)
+    : MBsystem_(MBsystem), matter_(matter), force_on_bodies_(force_on_bodies),
+      integ_(integ), part_offset_(1, 0), is_state_update_on_demand_(false),
+      body_forces_(matter.getNumBodies(), SimTK::SpatialVec(SimTKVec3(0), SimTKVec3(0))) {}
+//=================================================================================================//
+void BatchedSimBodyCoupling::addBodyPart(BodyPartByParticle &body_part, SimTK::MobilizedBody &mobod)
+{
+    BaseParticles &particles = body_part.getBaseParticles();
+    body_parts_.push_back(&body_part);
+    mobods_.push_back(&mobod);
+    part_offset_.push_back(part_offset_.back() + body_part.body_part_particles_.size());
+
+    pos_.push_back(particles.getVariableDataByName<Vecd>("Position"));
+    pos0_.push_back(particles.registerStateVariableDataFrom<Vecd>("InitialPosition", "Position"));
+    vel_.push_back(particles.registerStateVariableData<Vecd>("Velocity"));
+    acc_.push_back(particles.registerStateVariableData<Vecd>("Acceleration"));
+    n_.push_back(particles.getVariableDataByName<Vecd>("NormalDirection"));
+    n0_.push_back(particles.registerStateVariableDataFrom<Vecd>("InitialNormalDirection", "NormalDirection"));
+    force_.push_back(particles.registerStateVariableData<Vecd>("Force"));
+    force_prior_.push_back(particles.registerStateVariableData<Vecd>("ForcePrior"));
+
+    const SimTK::State &state = integ_.getState();
+    MBsystem_.realize(state, SimTK::Stage::Acceleration);
+    simbody_states_.push_back(SimbodyState(mobod.getBodyOriginLocation(state), mobod, state));
+
+    local_forces_ = tbb::enumerable_thread_specific<StdVec<Vec3d>>(StdVec<Vec3d>(body_parts_.size(), Vec3d::Zero()));
+    local_torques_ = tbb::enumerable_thread_specific<StdVec<Vec3d>>(StdVec<Vec3d>(body_parts_.size(), Vec3d::Zero()));
+}
+//=================================================================================================//
+void BatchedSimBodyCoupling::readSimbodyStates()
+{
+    const SimTK::State &state = integ_.getState();
+    MBsystem_.realize(state, SimTK::Stage::Acceleration);
+    for (size_t p = 0; p != mobods_.size(); ++p)
+    {
+        Vec3d initial_origin_location = simbody_states_[p].initial_origin_location_;
+        simbody_states_[p] = SimbodyState(mobods_[p]->getBodyOriginLocation(state), *mobods_[p], state);
+        simbody_states_[p].initial_origin_location_ = initial_origin_location;
+    }
+}
+//=================================================================================================//
+void BatchedSimBodyCoupling::updateSimbodyStates()
+{
+    readSimbodyStates();
+}
+//=================================================================================================//
+UnsignedInt BatchedSimBodyCoupling::PartIndexOfJointIndex(UnsignedInt joint_index)
+{
+    return std::upper_bound(part_offset_.begin(), part_offset_.end(), joint_index) - part_offset_.begin() - 1;
+}
+//=================================================================================================//
+template <typename FunctionOnEach>
+void BatchedSimBodyCoupling::forEachParticle(const FunctionOnEach &function)
+{
+    parallel_for(
+        IndexRange(0, part_offset_.back()),
+        [&](const IndexRange &r)
+        {
+            UnsignedInt p = PartIndexOfJointIndex(r.begin());
+            for (UnsignedInt n = r.begin(); n != r.end(); ++n)
+            {
+                while (n >= part_offset_[p + 1])
+                    ++p;
+                function(p, body_parts_[p]->body_part_particles_[n - part_offset_[p]]);
+            }
+        },
+        ap);
+}
+//=================================================================================================//
+void BatchedSimBodyCoupling::applyForcesToSimBody()
+{
+    if (!is_state_update_on_demand_)
+        readSimbodyStates();
+
+    // the thread-local buffers are only reset, they are allocated once by the first use of each thread
+    UnsignedInt number_of_parts = body_parts_.size();
+    for (auto &local : local_forces_)
+        std::fill(local.begin(), local.end(), Vec3d::Zero());
+    for (auto &local : local_torques_)
+        std::fill(local.begin(), local.end(), Vec3d::Zero());
+    forEachParticle(
+        [&](UnsignedInt p, UnsignedInt index_i)
+        {
+            Vecd total_force = force_[p][index_i] + force_prior_[p][index_i];
+            Vec3d force = upgradeToVec3d(total_force);
+            Vec3d displacement = upgradeToVec3d(pos_[p][index_i]) - simbody_states_[p].origin_location_;
+            local_forces_.local()[p] += force;
+            local_torques_.local()[p] += displacement.cross(force);
+        });
+
+    body_forces_.setTo(SimTK::SpatialVec(SimTKVec3(0), SimTKVec3(0)));
+    for (UnsignedInt p = 0; p != number_of_parts; ++p)
+    {
+        Vec3d force = Vec3d::Zero();
+        Vec3d torque = Vec3d::Zero();
+        for (const auto &local : local_forces_)
+            force += local[p];
+        for (const auto &local : local_torques_)
+            torque += local[p];
+        body_forces_[mobods_[p]->getMobilizedBodyIndex()] +=
+            SimTK::SpatialVec(EigenToSimTK(torque), EigenToSimTK(force));
+    }
+    force_on_bodies_.setAllBodyForces(integ_.updAdvancedState(), body_forces_);
+}
+//=================================================================================================//
+void BatchedSimBodyCoupling::constrainBodyParts()
+{
+    if (!is_state_update_on_demand_)
+        readSimbodyStates();
+    forEachParticle(
+        [&](UnsignedInt p, UnsignedInt index_i)
+        {
+            Vec3d pos, vel, acc, n;
+            simbody_states_[p].findStationLocationVelocityAndAccelerationInGround(
+                upgradeToVec3d(pos0_[p][index_i]), upgradeToVec3d(n0_[p][index_i]), pos, vel, acc, n);
+            pos_[p][index_i] = degradeToVecd(pos);
+            vel_[p][index_i] = degradeToVecd(vel);
+            acc_[p][index_i] = degradeToVecd(acc);
+            n_[p][index_i] = degradeToVecd(n);
+        });
+}
+//=================================================================================================//
 } // namespace solid_dynamics
 } // namespace SPH
@@ -201,6 +201,55 @@ class TotalForceForSimBody
 };
 using TotalForceOnBodyForSimBody = TotalForceForSimBody<SPHBody>;
 using TotalForceOnBodyPartForSimBody = TotalForceForSimBody<BodyPartByParticle>;
+
+/**
+ * @class BatchedSimBodyCoupling
+ * @brief Couple many body parts, e.g. SolidBodyPartForSimbody, with their Simbody mobilized bodies
+ * in batch, instead of a pair of TotalForceForSimBody and ConstraintBySimBody for each part.
+ * The Simbody state is realized once and all mobilized body states are read in one pass,
+ * the forces and torques of all parts are obtained by one parallel reduction
+ * over the particles of all parts and set to Simbody by one call.
+ * The force buffers are kept between calls so that no allocation is required per step.
+ * With setStateUpdateOnDemand(true), the Simbody states are only read by updateSimbodyStates(),
+ * e.g. once per advection step, and reused by the acoustic sub-steps in between.
+ */
+class BatchedSimBodyCoupling
+{
+  public:
+    BatchedSimBodyCoupling(SimTK::MultibodySystem &MBsystem, SimTK::SimbodyMatterSubsystem &matter,
+                           SimTK::Force::DiscreteForces &force_on_bodies,
+                           SimTK::RungeKuttaMersonIntegrator &integ);
+    ~BatchedSimBodyCoupling() {};
+
+    void addBodyPart(BodyPartByParticle &body_part, SimTK::MobilizedBody &mobod);
+    UnsignedInt NumberOfBodyParts() { return body_parts_.size(); };
+    /** Reduce the forces and torques of all parts and set them as the body forces in Simbody. */
+    void applyForcesToSimBody();
+    /** Constrain the particles of all parts by the present Simbody state. */
+    void constrainBodyParts();
+    /** Realize the Simbody state and read the states of all mobilized bodies. */
+    void updateSimbodyStates();
+    void setStateUpdateOnDemand(bool is_on_demand) { is_state_update_on_demand_ = is_on_demand; };
+
+  protected:
+    SimTK::MultibodySystem &MBsystem_;
+    SimTK::SimbodyMatterSubsystem &matter_;
+    SimTK::Force::DiscreteForces &force_on_bodies_;
+    SimTK::RungeKuttaMersonIntegrator &integ_;
+    StdVec<BodyPartByParticle *> body_parts_;
+    StdVec<SimTK::MobilizedBody *> mobods_;
+    StdVec<SimbodyState> simbody_states_;
+    StdVec<UnsignedInt> part_offset_; /**< prefix of particle numbers over the parts */
+    StdVec<Vecd *> pos_, pos0_, vel_, acc_, n_, n0_, force_, force_prior_;
+    bool is_state_update_on_demand_;
+    tbb::enumerable_thread_specific<StdVec<Vec3d>> local_forces_, local_torques_;
+    SimTK::Vector_<SimTK::SpatialVec> body_forces_;
+
+    void readSimbodyStates();
+    UnsignedInt PartIndexOfJointIndex(UnsignedInt joint_index);
+    template <typename FunctionOnEach>
+    void forEachParticle(const FunctionOnEach &function);
+};
 } // namespace solid_dynamics
 } // namespace SPH
 #endif // CONSTRAINT_DYNAMICS_H
\ No newline at end of file
@@ -89,5 +89,23 @@ AverageVelocityAndAcceleration::
     : initialize_displacement_(sph_body),
       update_averages_(sph_body) {}
 //=================================================================================================//
+FluidStructureCoupling::
+    FluidStructureCoupling(SPHBody &solid_body,
+                           BaseDynamics<void> &fluid_integration_1st_half,
+                           BaseDynamics<void> &pressure_force_from_fluid,
+                           BaseDynamics<void> &fluid_integration_2nd_half,
+                           BaseDynamics<Real> &structure_time_step)
+    : average_velocity_and_acceleration_(solid_body),
+      fluid_integration_1st_half_(fluid_integration_1st_half),
+      pressure_force_from_fluid_(pressure_force_from_fluid),
+      fluid_integration_2nd_half_(fluid_integration_2nd_half),
+      structure_time_step_(structure_time_step) {}
+//=================================================================================================//
+UnsignedInt FluidStructureCoupling::SubStepNumber(Real dt)
+{
+    Real dt_s = structure_time_step_.exec();
+    return SMAX(UnsignedInt(1), UnsignedInt(std::ceil(dt / (dt_s + TinyReal))));
+}
+//=================================================================================================//
 } // namespace solid_dynamics
 } // namespace SPH
@@ -151,6 +151,56 @@ class AverageVelocityAndAcceleration
     explicit AverageVelocityAndAcceleration(SPHBody &sph_body);
     ~AverageVelocityAndAcceleration() {};
 };
+
+/**
+ * @class FluidStructureCoupling
+ * @brief Advance one fluid acoustic step and sub-cycle the structure within it.
+ * The pressure force from fluid is computed once per fluid step and,
+ * together with the viscous force computed once per advection step,
+ * is kept as a time-averaged load over all structure sub-steps.
+ * The number of sub-steps is chosen from the ratio of the fluid step to the structure
+ * acoustic time step, so that the sub-steps are of equal size matching the fluid step.
+ * The structure integrator, called as structure_integrator(dt_s),
+ * gives the stress relaxation and the constraints of the structure.
+ */
+class FluidStructureCoupling
+{
+  public:
+    FluidStructureCoupling(SPHBody &solid_body,
+                           BaseDynamics<void> &fluid_integration_1st_half,
+                           BaseDynamics<void> &pressure_force_from_fluid,
+                           BaseDynamics<void> &fluid_integration_2nd_half,
+                           BaseDynamics<Real> &structure_time_step);
+    ~FluidStructureCoupling() {};
+
+    /** Returns the number of structure sub-steps. */
+    template <class StructureIntegrator>
+    UnsignedInt exec(Real dt, const StructureIntegrator &structure_integrator)
+    {
+        fluid_integration_1st_half_.exec(dt);
+        pressure_force_from_fluid_.exec();
+        fluid_integration_2nd_half_.exec(dt);
+
+        average_velocity_and_acceleration_.initialize_displacement_.exec();
+        UnsignedInt sub_steps = SubStepNumber(dt);
+        Real dt_s = dt / Real(sub_steps);
+        for (UnsignedInt n = 0; n != sub_steps; ++n)
+        {
+            structure_integrator(dt_s);
+        }
+        average_velocity_and_acceleration_.update_averages_.exec(dt);
+        return sub_steps;
+    };
+
+  protected:
+    AverageVelocityAndAcceleration average_velocity_and_acceleration_;
+    BaseDynamics<void> &fluid_integration_1st_half_;
+    BaseDynamics<void> &pressure_force_from_fluid_;
+    BaseDynamics<void> &fluid_integration_2nd_half_;
+    BaseDynamics<Real> &structure_time_step_;
+
+    UnsignedInt SubStepNumber(Real dt);
+};
 } // namespace solid_dynamics
 } // namespace SPH
 #endif // FLUID_STRUCTURE_INTERACTION_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "thin_structure_dynamics.h"
 #include "base_particles.hpp"
+#include "surface_particles.h"
 
 namespace SPH
 {
@@ -11,7 +12,7 @@ UpdateShellNormalDirection::UpdateShellNormalDirection(SPHBody &sph_body)
     : LocalDynamics(sph_body),
       n_(particles_->getVariableDataByName<Vecd>("NormalDirection")),
       F_(particles_->getVariableDataByName<Matd>("DeformationGradient")),
-      transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")) {}
+      transformation_matrix0_(DynamicCast<SurfaceParticles>(this, particles_)->getTransformationMatrix0()) {}
 //=========================================================================================//
 void UpdateShellNormalDirection::update(size_t index_i, Real dt)
 {
@@ -56,7 +57,7 @@ ShellCorrectConfiguration::
       Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
       B_(particles_->registerStateVariableData<Matd>("LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)),
       n0_(particles_->registerStateVariableDataFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
-      transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")) {}
+      transformation_matrix0_(DynamicCast<SurfaceParticles>(this, particles_)->getTransformationMatrix0()) {}
 //=================================================================================================//
 ShellDeformationGradientTensor::
     ShellDeformationGradientTensor(BaseInnerRelation &inner_relation)
@@ -68,7 +69,7 @@ ShellDeformationGradientTensor::
       B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")),
       F_(particles_->registerStateVariableData<Matd>("DeformationGradient", IdentityMatrix<Matd>::value)),
       F_bending_(particles_->registerStateVariableData<Matd>("BendingDeformationGradient")),
-      transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")) {}
+      transformation_matrix0_(DynamicCast<SurfaceParticles>(this, particles_)->getTransformationMatrix0()) {}
 //=================================================================================================//
 BaseShellRelaxation::BaseShellRelaxation(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
@@ -85,7 +86,7 @@ BaseShellRelaxation::BaseShellRelaxation(BaseInnerRelation &inner_relation)
       rotation_(particles_->registerStateVariableData<Vecd>("Rotation")),
       angular_vel_(particles_->registerStateVariableData<Vecd>("AngularVelocity")),
       dangular_vel_dt_(particles_->registerStateVariableData<Vecd>("AngularAcceleration")),
-      transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")),
+      transformation_matrix0_(DynamicCast<SurfaceParticles>(this, particles_)->getTransformationMatrix0()),
       B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")),
       F_(particles_->registerStateVariableData<Matd>("DeformationGradient", IdentityMatrix<Matd>::value)),
       dF_dt_(particles_->registerStateVariableData<Matd>("DeformationRate")),
@@ -272,7 +273,7 @@ InitialShellCurvature::InitialShellCurvature(BaseInnerRelation &inner_relation)
       Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
       n0_(particles_->registerStateVariableDataFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")),
-      transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")),
+      transformation_matrix0_(DynamicCast<SurfaceParticles>(this, particles_)->getTransformationMatrix0()),
       n_(particles_->getVariableDataByName<Vecd>("NormalDirection")),
       F_(particles_->getVariableDataByName<Matd>("DeformationGradient")),
       F_bending_(particles_->getVariableDataByName<Matd>("BendingDeformationGradient")),
@@ -301,7 +302,7 @@ void InitialShellCurvature::update(size_t index_i, Real)
 //=================================================================================================//
 ShellCurvatureUpdate::ShellCurvatureUpdate(SPHBody &sph_body)
     : LocalDynamics(sph_body),
-      transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")),
+      transformation_matrix0_(DynamicCast<SurfaceParticles>(this, particles_)->getTransformationMatrix0()),
       F_(particles_->getVariableDataByName<Matd>("DeformationGradient")),
       F_bending_(particles_->getVariableDataByName<Matd>("BendingDeformationGradient")),
       k1_(particles_->registerStateVariableData<Real>("1stPrincipleCurvature")),
@@ -23,19 +23,21 @@ ParticleGenerator<ParticlesType, Reload>::
         exit(1);
     }
 
-    file_path_ = reload_folder + "/" + reload_body_name + "_rld.xml";
+    // the binary reload file is preferred if both formats are present
+    std::string file_path_base = reload_folder + "/" + reload_body_name + "_rld";
+    file_path_ = fs::exists(file_path_base + ".bin") ? file_path_base + ".bin" : file_path_base + ".xml";
 }
 //=================================================================================================//
 template <typename ParticlesType>
 void ParticleGenerator<ParticlesType, Reload>::prepareGeometricData()
 {
-    this->base_particles_.readReloadXmlFile(file_path_);
+    this->base_particles_.readReloadFile(file_path_);
 }
 //=================================================================================================//
 template <typename ParticlesType>
 void ParticleGenerator<ParticlesType, Reload>::setAllParticleBounds()
 {
-    this->base_particles_.initializeAllParticlesBoundsFromReloadXml();
+    this->base_particles_.initializeAllParticlesBoundsFromReload();
 };
 //=================================================================================================//
 template <typename ParticlesType>
@@ -2,7 +2,9 @@
 
 #include "adaptation.h"
 #include "base_body.h"
+#include "base_particles.h"
 #include "complex_geometry.h"
+#include "mesh_iterators.hpp"
 
 namespace SPH
 {
@@ -20,11 +22,66 @@ GeneratingMethod<Lattice>::GeneratingMethod(SPHBody &sph_body)
     }
 }
 //=================================================================================================//
+StdVec<char> GeneratingMethod<Lattice>::classifyLatticeCells(const Mesh &lattice_mesh)
+{
+    Arrayi all_cells = lattice_mesh.AllCells();
+    StdVec<char> is_contained(lattice_mesh.NumberOfCells(), 0);
+    Arrayi number_of_blocks = (all_cells + (block_size_ - 1) * Arrayi::Ones()) / block_size_;
+    mesh_parallel_for(
+        MeshRange(Arrayi::Zero(), number_of_blocks),
+        [&](const Arrayi &block_index)
+        {
+            Arrayi lower = block_index * block_size_;
+            Arrayi upper = (lower + block_size_ * Arrayi::Ones()).min(all_cells);
+            Vecd lower_position = lattice_mesh.CellPositionFromIndex(lower);
+            Vecd upper_position = lattice_mesh.CellPositionFromIndex(upper - Arrayi::Ones());
+            Vecd block_center = 0.5 * (lower_position + upper_position);
+            Real block_radius = 0.5 * (upper_position - lower_position).norm();
+            // the closest point of a shape never overestimates the distance to the surface
+            Real distance_to_surface = (block_center - initial_shape_.findClosestPoint(block_center)).norm();
+            if (distance_to_surface > block_radius + lattice_spacing_)
+            {
+                char is_block_contained = initial_shape_.checkContain(block_center) ? 1 : 0;
+                mesh_for_each(lower, upper, [&](const Arrayi &cell_index)
+                              { is_contained[Mesh::transferMeshIndexTo1D(all_cells, cell_index)] = is_block_contained; });
+            }
+            else
+            {
+                mesh_for_each(
+                    lower, upper,
+                    [&](const Arrayi &cell_index)
+                    {
+                        Vecd lattice_position = lattice_mesh.CellPositionFromIndex(cell_index);
+                        is_contained[Mesh::transferMeshIndexTo1D(all_cells, cell_index)] =
+                            initial_shape_.checkContain(lattice_position) ? 1 : 0;
+                    });
+            }
+        });
+    return is_contained;
+}
+//=================================================================================================//
 ParticleGenerator<BaseParticles, Lattice>::
     ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles)
     : ParticleGenerator<BaseParticles>(sph_body, base_particles),
       GeneratingMethod<Lattice>(sph_body) {}
 //=================================================================================================//
+void ParticleGenerator<BaseParticles, Lattice>::prepareGeometricData()
+{
+    Mesh mesh(domain_bounds_, lattice_spacing_, 0);
+    Real particle_volume = pow(lattice_spacing_, Dimensions);
+    Arrayi number_of_lattices = mesh.AllCells();
+    StdVec<char> is_contained = classifyLatticeCells(mesh);
+    // sequential compaction keeps the lattice order of the generated particles
+    mesh_for(MeshRange(Arrayi::Zero(), number_of_lattices),
+             [&](const Arrayi &cell_index)
+             {
+                 if (is_contained[Mesh::transferMeshIndexTo1D(number_of_lattices, cell_index)])
+                 {
+                     addPositionAndVolumetricMeasure(mesh.CellPositionFromIndex(cell_index), particle_volume);
+                 }
+             });
+}
+//=================================================================================================//
 ParticleGenerator<BaseParticles, Lattice, AdaptiveByShape>::
     ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, Shape &target_shape)
     : ParticleGenerator<BaseParticles, Lattice>(sph_body, base_particles),
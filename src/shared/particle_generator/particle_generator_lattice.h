@@ -36,6 +36,7 @@ namespace SPH
 {
 
 class Shape;
+class Mesh;
 class AdaptiveByShape;
 class SurfaceParticles;
 
@@ -50,6 +51,12 @@ class GeneratingMethod<Lattice>
     Real lattice_spacing_;      /**< Initial particle spacing. */
     BoundingBoxd domain_bounds_; /**< Domain bounds. */
     Shape &initial_shape_;      /**< Geometry shape for body. */
+    int block_size_ = 8;        /**< Number of lattices in each direction of a coarse block. */
+
+    /** Flags of the lattice cells contained by the shape, classified in parallel.
+     * All cells of a coarse block far from the shape surface are classified by one probe at the block center.
+     * The flags are addressed by the 1D index of the cells. */
+    StdVec<char> classifyLatticeCells(const Mesh &lattice_mesh);
 };
 
 template <>
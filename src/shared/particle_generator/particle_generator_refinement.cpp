@@ -0,0 +1,40 @@
+#include "particle_generator_refinement.h"
+
+#include "base_body.h"
+#include "base_geometry.h"
+#include "base_particles.hpp"
+#include "mesh_iterators.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+ParticleGenerator<BaseParticles, SplitFromCoarse>::
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, BaseParticles &coarse_particles)
+    : ParticleGenerator<BaseParticles>(sph_body, base_particles),
+      coarse_particles_(coarse_particles), initial_shape_(sph_body.getInitialShape()) {}
+//=================================================================================================//
+void ParticleGenerator<BaseParticles, SplitFromCoarse>::prepareGeometricData()
+{
+    Vecd *coarse_pos = coarse_particles_.getVariableDataByName<Vecd>("Position");
+    Real *coarse_Vol = coarse_particles_.getVariableDataByName<Real>("VolumetricMeasure");
+    for (size_t i = 0; i != coarse_particles_.TotalRealParticles(); ++i)
+    {
+        Real coarse_spacing = pow(coarse_Vol[i], 1.0 / Real(Dimensions));
+        int split_number = SMAX(int(std::round(coarse_spacing / particle_spacing_ref_)), 1);
+        Real spacing = coarse_spacing / Real(split_number);
+        Real volume = pow(spacing, Dimensions);
+        mesh_for_each(
+            Arrayi::Zero(), split_number * Arrayi::Ones(),
+            [&](const Arrayi &split_index)
+            {
+                Vecd offset = (split_index.cast<Real>() + 0.5 - 0.5 * Real(split_number)).matrix();
+                Vecd position = coarse_pos[i] + spacing * offset;
+                if (initial_shape_.checkContain(position))
+                {
+                    addPositionAndVolumetricMeasure(position, volume);
+                }
+            });
+    }
+}
+//=================================================================================================//
+} // namespace SPH
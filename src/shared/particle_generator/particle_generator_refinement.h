@@ -0,0 +1,56 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file particle_generator_refinement.h
+ * @brief The refinement particle generator generates particles
+ * by splitting the particles of a relaxed coarser body,
+ * so that the fine body only needs a few relaxation steps.
+ * @details The coarse body shares the shape of the fine body, and is
+ * defined with a coarser resolution, e.g. by defineAdaptation<SPHAdaptation>(1.3, 0.5).
+ * @author Xiangyu Hu
+ */
+
+#ifndef PARTICLE_GENERATOR_REFINEMENT_H
+#define PARTICLE_GENERATOR_REFINEMENT_H
+
+#include "base_particle_generator.h"
+
+namespace SPH
+{
+class Shape;
+class SplitFromCoarse;
+
+template <> // For generating particles by splitting each coarse particle into a local lattice
+class ParticleGenerator<BaseParticles, SplitFromCoarse> : public ParticleGenerator<BaseParticles>
+{
+  public:
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, BaseParticles &coarse_particles);
+    virtual ~ParticleGenerator() {};
+    virtual void prepareGeometricData() override;
+
+  protected:
+    BaseParticles &coarse_particles_;
+    Shape &initial_shape_; /**< Only the split particles within the shape are kept. */
+};
+} // namespace SPH
+#endif // PARTICLE_GENERATOR_REFINEMENT_H
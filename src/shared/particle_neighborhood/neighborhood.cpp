@@ -5,6 +5,7 @@
 
 #include "neighborhood.h"
 
+#include "algorithm_primitive.h"
 #include "all_complex_bodies.h"
 #include "base_particle_dynamics.h"
 #include "base_particles.hpp"
@@ -22,6 +23,116 @@ void Neighborhood::removeANeighbor(size_t neighbor_n)
     e_ij_[neighbor_n] = e_ij_[current_size_];
 }
 //=================================================================================================//
+void Neighborhood::swap(Neighborhood &other)
+{
+    std::swap(current_size_, other.current_size_);
+    std::swap(allocated_size_, other.allocated_size_);
+    j_.swap(other.j_);
+    W_ij_.swap(other.W_ij_);
+    dW_ij_.swap(other.dW_ij_);
+    r_ij_.swap(other.r_ij_);
+    e_ij_.swap(other.e_ij_);
+}
+//=================================================================================================//
+size_t Neighborhood::MemoryBytes() const
+{
+    return sizeof(Neighborhood) + j_.capacity() * sizeof(size_t) +
+           (W_ij_.capacity() + dW_ij_.capacity() + r_ij_.capacity()) * sizeof(Real) +
+           e_ij_.capacity() * sizeof(Vecd);
+}
+//=================================================================================================//
+size_t configurationMemoryBytes(const ParticleConfiguration &particle_configuration)
+{
+    size_t bytes = (particle_configuration.capacity() - particle_configuration.size()) * sizeof(Neighborhood);
+    for (const Neighborhood &neighborhood : particle_configuration)
+    {
+        bytes += neighborhood.MemoryBytes();
+    }
+    return bytes;
+}
+//=================================================================================================//
+size_t configurationHighWaterMark(const ParticleConfiguration &particle_configuration)
+{
+    size_t high_water_mark = 0;
+    for (const Neighborhood &neighborhood : particle_configuration)
+    {
+        high_water_mark = SMAX(high_water_mark, neighborhood.allocated_size_);
+    }
+    return high_water_mark;
+}
+//=================================================================================================//
+CompactParticleConfiguration::
+    CompactParticleConfiguration(size_t particles_bound, bool store_kernel_values)
+    : store_kernel_values_(store_kernel_values), total_neighbors_(0)
+{
+    resize(particles_bound);
+}
+//=================================================================================================//
+size_t CompactParticleConfiguration::MemoryBytes() const
+{
+    return (neighbor_size_.capacity() + offset_.capacity() + j_.capacity()) * sizeof(size_t) +
+           (W_ij_.capacity() + dW_ij_.capacity() + r_ij_.capacity()) * sizeof(Real) +
+           e_ij_.capacity() * sizeof(Vecd);
+}
+//=================================================================================================//
+void CompactParticleConfiguration::resize(size_t particles_bound)
+{
+    neighbor_size_.resize(particles_bound + 1, 0);
+    offset_.resize(particles_bound + 1, 0);
+}
+//=================================================================================================//
+void CompactParticleConfiguration::allocateNeighbors(size_t total_particles)
+{
+    total_neighbors_ = exclusive_scan(execution::ParallelPolicy(), neighbor_size_.data(), offset_.data(),
+                                      total_particles + 1, std::plus<size_t>());
+    if (total_neighbors_ > j_.size())
+    {
+        j_.resize(total_neighbors_);
+        r_ij_.resize(total_neighbors_);
+        if (store_kernel_values_)
+        {
+            W_ij_.resize(total_neighbors_);
+            dW_ij_.resize(total_neighbors_);
+            e_ij_.resize(total_neighbors_);
+        }
+    }
+}
+//=================================================================================================//
+void CompactParticleConfiguration::assignNeighbors(size_t index_i, const Neighborhood &neighborhood)
+{
+    size_t first = offset_[index_i];
+    for (size_t n = 0; n != neighborhood.current_size_; ++n)
+    {
+        j_[first + n] = neighborhood.j_[n];
+        r_ij_[first + n] = neighborhood.r_ij_[n];
+    }
+
+    if (store_kernel_values_)
+    {
+        for (size_t n = 0; n != neighborhood.current_size_; ++n)
+        {
+            W_ij_[first + n] = neighborhood.W_ij_[n];
+            dW_ij_[first + n] = neighborhood.dW_ij_[n];
+            e_ij_[first + n] = neighborhood.e_ij_[n];
+        }
+    }
+}
+//=================================================================================================//
+CompactNeighborhood CompactParticleConfiguration::operator[](size_t index_i)
+{
+    size_t first = offset_[index_i];
+    return store_kernel_values_
+               ? CompactNeighborhood{NeighborSize(index_i), j_.data() + first, W_ij_.data() + first,
+                                     dW_ij_.data() + first, r_ij_.data() + first, e_ij_.data() + first}
+               : CompactNeighborhood{NeighborSize(index_i), j_.data() + first, nullptr,
+                                     nullptr, r_ij_.data() + first, nullptr};
+}
+//=================================================================================================//
+OnTheFlyKernel::OnTheFlyKernel(Kernel &kernel)
+    : SmoothingKernelCK(kernel), inv_h_(1.0 / kernel.SmoothingLength()),
+      inv_h_squared_(inv_h_ * inv_h_), inv_h_cubed_(inv_h_squared_ * inv_h_),
+      inv_h_fourth_(inv_h_cubed_ * inv_h_) {}
+//=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
                                      const Vecd &displacement, size_t index_j)
 {
@@ -71,6 +182,16 @@ void NeighborBuilder::initializeNeighbor(Neighborhood &neighborhood, const Real
     neighborhood.e_ij_[current_size] = displacement / (distance + TinyReal);
 }
 //=================================================================================================//
+void NeighborBuilder::updateNeighbor(Neighborhood &neighborhood, size_t neighbor_n,
+                                     const Real &distance, const Vecd &displacement)
+{
+    bool is_within_cutoff = distance < kernel_->CutOffRadius();
+    neighborhood.W_ij_[neighbor_n] = is_within_cutoff ? kernel_->W(distance, displacement) : 0.0;
+    neighborhood.dW_ij_[neighbor_n] = is_within_cutoff ? kernel_->dW(distance, displacement) : 0.0;
+    neighborhood.r_ij_[neighbor_n] = distance;
+    neighborhood.e_ij_[neighbor_n] = kernel_->e(distance, displacement);
+}
+//=================================================================================================//
 Kernel *NeighborBuilder::chooseKernel(SPHBody &body, SPHBody &target_body)
 {
     Kernel *kernel = body.getSPHAdaptation().getKernel();
@@ -158,6 +279,54 @@ void NeighborBuilderContact::operator()(Neighborhood &neighborhood,
     }
 };
 //=================================================================================================//
+NeighborBuilderContactRigid::
+    NeighborBuilderContactRigid(SPHBody &body, SPHBody &contact_body, Transform &rigid_transform)
+    : NeighborBuilder(NeighborBuilder::chooseKernel(body, contact_body)),
+      rigid_transform_(rigid_transform) {}
+//=================================================================================================//
+void NeighborBuilderContactRigid::operator()(Neighborhood &neighborhood,
+                                             const Vecd &pos_i, size_t index_i, const ListData &list_data_j)
+{
+    size_t index_j = list_data_j.first;
+    Vecd frame_displacement = pos_i - list_data_j.second;
+    if (kernel_->checkIfWithinCutOffRadius(frame_displacement))
+    {
+        Real distance = frame_displacement.norm();
+        Vecd displacement = rigid_transform_.xformFrameVecToBase(frame_displacement);
+        neighborhood.current_size_ >= neighborhood.allocated_size_
+            ? createNeighbor(neighborhood, distance, displacement, index_j)
+            : initializeNeighbor(neighborhood, distance, displacement, index_j);
+        neighborhood.current_size_++;
+    }
+};
+//=================================================================================================//
+NeighborBuilderWithSkin::NeighborBuilderWithSkin(Kernel *kernel, Real skin_ratio, bool is_inner)
+    : NeighborBuilder(kernel), cutoff_radius_with_skin_((1.0 + skin_ratio) * kernel->CutOffRadius()),
+      is_inner_(is_inner) {}
+//=================================================================================================//
+void NeighborBuilderWithSkin::operator()(Neighborhood &neighborhood,
+                                         const Vecd &pos_i, size_t index_i, const ListData &list_data_j)
+{
+    size_t index_j = list_data_j.first;
+    Vecd displacement = pos_i - list_data_j.second;
+    Real distance = displacement.norm();
+    if (distance < cutoff_radius_with_skin_ && (!is_inner_ || index_i != index_j))
+    {
+        if (neighborhood.current_size_ >= neighborhood.allocated_size_)
+        {
+            neighborhood.j_.push_back(index_j);
+            neighborhood.W_ij_.push_back(0.0);
+            neighborhood.dW_ij_.push_back(0.0);
+            neighborhood.r_ij_.push_back(distance);
+            neighborhood.e_ij_.push_back(ZeroData<Vecd>::value);
+            neighborhood.allocated_size_++;
+        }
+        neighborhood.j_[neighborhood.current_size_] = index_j;
+        updateNeighbor(neighborhood, neighborhood.current_size_, distance, displacement);
+        neighborhood.current_size_++;
+    }
+};
+//=================================================================================================//
 NeighborBuilderSurfaceContact::NeighborBuilderSurfaceContact(SPHBody &body, SPHBody &contact_body)
     : NeighborBuilderContact(body, contact_body)
 {
@@ -33,8 +33,11 @@
 
 #include "all_kernels.h"
 #include "base_data_type_package.h"
+#include "kernel_analytic_ck.hpp"
 #include "sphinxsys_containers.h"
 
+#include <tbb/enumerable_thread_specific.h>
+
 namespace SPH
 {
 
@@ -62,8 +65,109 @@ class Neighborhood
     ~Neighborhood() {};
 
     void removeANeighbor(size_t neighbor_n);
+    /** exchange the neighbor lists with another neighborhood without copying or reallocating */
+    void swap(Neighborhood &other);
+    /** bytes allocated for the neighbors, including the reserved capacity */
+    size_t MemoryBytes() const;
 };
 using ParticleConfiguration = StdVec<Neighborhood>;
+size_t configurationMemoryBytes(const ParticleConfiguration &particle_configuration);
+/** the largest number of neighbors a particle has ever had, i.e. the high-water mark of the allocated neighbors */
+size_t configurationHighWaterMark(const ParticleConfiguration &particle_configuration);
+
+/**
+ * @class CompactNeighborhood
+ * @brief A light-weight view of the neighbors of particle i in a compact particle configuration.
+ * The members have the same names as those of Neighborhood,
+ * so that the neighbor loops of a local dynamics can be used for both.
+ */
+struct CompactNeighborhood
+{
+    size_t current_size_; /**< the number of neighbors */
+    size_t *j_;           /**< index of the neighbor particle. */
+    Real *W_ij_;          /**< kernel value or particle volume contribution */
+    Real *dW_ij_;         /**< derivative of kernel function or inter-particle surface contribution */
+    Real *r_ij_;          /**< distance between j and i. */
+    Vecd *e_ij_;          /**< unit vector pointing from j to i or inter-particle surface direction */
+};
+
+/**
+ * @class CompactParticleConfiguration
+ * @brief The particle configuration in compressed sparse row (CSR) layout.
+ * @details The neighbors of all particles are saved contiguously in structure-of-arrays
+ * and the neighbors of particle i are located in [offset_[i], offset_[i + 1]).
+ * The offset list is obtained by a prefix sum of the neighbor sizes,
+ * and the neighbor arrays only grow so that no allocation is required
+ * when the total number of neighbors does not increase.
+ * If kernel values are not stored, only j_ and r_ij_ are saved
+ * and the kernel values are evaluated on the fly with OnTheFlyKernel.
+ */
+class CompactParticleConfiguration
+{
+  public:
+    StdVec<size_t> neighbor_size_; /**< neighbor size of each particle, one extra for prefix sum */
+    StdVec<size_t> offset_;        /**< offset of the first neighbor of each particle */
+    StdVec<size_t> j_;
+    StdVec<Real> W_ij_;
+    StdVec<Real> dW_ij_;
+    StdVec<Real> r_ij_;
+    StdVec<Vecd> e_ij_;
+
+    explicit CompactParticleConfiguration(size_t particles_bound = 0, bool store_kernel_values = true);
+    ~CompactParticleConfiguration() {};
+
+    void resize(size_t particles_bound);
+    /** compute the offsets from neighbor sizes and allocate the neighbor arrays if needed */
+    void allocateNeighbors(size_t total_particles);
+    size_t NeighborSize(size_t index_i) const { return offset_[index_i + 1] - offset_[index_i]; };
+    size_t TotalNeighbors() const { return total_neighbors_; };
+    bool isKernelValueStored() const { return store_kernel_values_; };
+    size_t MemoryBytes() const;
+    /** copy the neighbors collected in a (scratch) neighborhood to the location of particle i */
+    void assignNeighbors(size_t index_i, const Neighborhood &neighborhood);
+    /** the scratch neighborhood of the calling thread, kept so that its memory is reused in later searches */
+    Neighborhood &ScratchNeighborhood() { return scratch_neighborhoods_.local(); };
+    CompactNeighborhood operator[](size_t index_i);
+
+  protected:
+    bool store_kernel_values_;
+    size_t total_neighbors_;
+    tbb::enumerable_thread_specific<Neighborhood> scratch_neighborhoods_;
+};
+
+/**
+ * @class OnTheFlyKernel
+ * @brief Evaluating kernel values from the pair distance with the computing-kernel smoothing kernel.
+ * It is used with the particle configuration without stored kernel values.
+ */
+class OnTheFlyKernel : public SmoothingKernelCK
+{
+    Real inv_h_, inv_h_squared_, inv_h_cubed_, inv_h_fourth_;
+
+  public:
+    explicit OnTheFlyKernel(Kernel &kernel);
+
+    inline Real W(Real r_ij, const Vecd &displacement) const
+    {
+        return Factor(displacement) * normalized_W(r_ij * inv_h_);
+    };
+
+    inline Real dW(Real r_ij, const Vecd &displacement) const
+    {
+        return GradientFactor(displacement) * normalized_dW(r_ij * inv_h_);
+    };
+
+    inline Vecd e(Real r_ij, const Vecd &displacement) const
+    {
+        return displacement / (r_ij + TinyReal);
+    };
+
+  protected:
+    inline Real Factor(const Vec2d &) const { return inv_h_squared_ * dimension_factor_2D_; };
+    inline Real Factor(const Vec3d &) const { return inv_h_cubed_ * dimension_factor_3D_; };
+    inline Real GradientFactor(const Vec2d &) const { return inv_h_cubed_ * dimension_factor_2D_; };
+    inline Real GradientFactor(const Vec3d &) const { return inv_h_fourth_ * dimension_factor_3D_; };
+};
 
 /**
  * @class NeighborBuilder
@@ -85,9 +189,13 @@ class NeighborBuilder
                         const Vecd &displacement, size_t j_index, Real i_h_ratio, Real h_ratio_min);
     void initializeNeighbor(Neighborhood &neighborhood, const Real &distance,
                             const Vecd &displacement, size_t j_index, Real i_h_ratio, Real h_ratio_min);
-    static Kernel *chooseKernel(SPHBody &body, SPHBody &target_body);
 
   public:
+    static Kernel *chooseKernel(SPHBody &body, SPHBody &target_body);
+    /** update pair geometry and kernel values of an existing neighbor, zero kernel values beyond cut-off radius */
+    void updateNeighbor(Neighborhood &neighborhood, size_t neighbor_n, const Real &distance, const Vecd &displacement);
+    Kernel *getKernel() { return kernel_; };
+
     NeighborBuilder(Kernel *kernel) : kernel_(kernel) {};
     virtual ~NeighborBuilder() {};
     virtual void operator()(Neighborhood &neighborhood,
@@ -150,6 +258,44 @@ class NeighborBuilderContact : public NeighborBuilder
                             const Vecd &pos_i, size_t index_i, const ListData &list_data_j) override;
 };
 
+/**
+ * @class NeighborBuilderContactRigid
+ * @brief A contact neighbor builder functor for a rigid contact body whose cell linked list
+ * is kept in its initial frame. The query position is given in that frame and
+ * the displacement is rotated back to the present frame.
+ */
+class NeighborBuilderContactRigid : public NeighborBuilder
+{
+  public:
+    NeighborBuilderContactRigid(SPHBody &body, SPHBody &contact_body, Transform &rigid_transform);
+    virtual ~NeighborBuilderContactRigid() {};
+    virtual void operator()(Neighborhood &neighborhood,
+                            const Vecd &pos_i, size_t index_i, const ListData &list_data_j) override;
+
+  protected:
+    Transform &rigid_transform_;
+};
+
+/**
+ * @class NeighborBuilderWithSkin
+ * @brief A neighbor builder functor which also saves the neighbors in a skin layer beyond the cut-off radius,
+ * so that the neighbor list can be reused as a Verlet list until particles have moved across the skin.
+ * The kernel values of the neighbors beyond the cut-off radius are zero.
+ */
+class NeighborBuilderWithSkin : public NeighborBuilder
+{
+  public:
+    NeighborBuilderWithSkin(Kernel *kernel, Real skin_ratio, bool is_inner);
+    virtual ~NeighborBuilderWithSkin() {};
+    void operator()(Neighborhood &neighborhood,
+                    const Vecd &pos_i, size_t index_i, const ListData &list_data_j) override;
+    Real CutOffRadiusWithSkin() { return cutoff_radius_with_skin_; };
+
+  protected:
+    Real cutoff_radius_with_skin_;
+    bool is_inner_;
+};
+
 /**
  * @class NeighborBuilderSurfaceContact
  * @brief A solid contact neighbor builder functor when bodies having surface contact.
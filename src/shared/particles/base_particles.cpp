@@ -1,21 +1,26 @@
 #include "base_particles.hpp"
 
 #include "base_body.h"
+#include "sph_system.h"
 
 namespace SPH
 {
 //=================================================================================================//
 BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
     : sv_total_real_particles_(nullptr),
-      particles_bound_(0), original_id_(nullptr), sorted_id_(nullptr),
+      particles_bound_(0), original_id_(nullptr), sorted_id_(nullptr), memory_arena_(nullptr),
       dv_pos_(nullptr), Vol_(nullptr), rho_(nullptr), mass_(nullptr),
       sph_body_(sph_body), body_name_(sph_body.getName()),
       base_material_(*base_material),
       restart_xml_parser_("xml_restart", "particles"),
-      reload_xml_parser_("xml_particle_reload", "particles"),
+      reload_xml_parser_("xml_particle_reload", "particles"), reload_binary_particles_(0),
       total_body_parts_(0)
 {
     sph_body.assignBaseParticles(this);
+    if (sph_body.getSPHSystem().UseParticleMemoryArena())
+    {
+        memory_arena_ = memory_arena_keeper_.createPtr<MemoryArena>();
+    }
     sv_total_real_particles_ = registerSingularVariable<UnsignedInt>("TotalRealParticles");
 }
 //=================================================================================================//
@@ -61,15 +66,42 @@ void BaseParticles::registerPositionAndVolumetricMeasureFromReload()
     Vol_ = registerStateVariableDataFromReload<Real>("VolumetricMeasure");
 }
 //=================================================================================================//
+MemoryUsage BaseParticles::getMemoryUsage()
+{
+    MemoryUsage memory_usage;
+    OperationOnDataAssemble<ParticleVariables, AccumulateMemoryUsage<DiscreteVariable>> accumulate_memory_usage;
+    accumulate_memory_usage(all_discrete_variables_, memory_usage);
+    for (auto &scratch_buffer : scratch_buffers_)
+    {
+        memory_usage += MemoryUsage{0, scratch_buffer->DeviceBytes()};
+    }
+    return memory_usage;
+}
+//=================================================================================================//
+ScratchBuffer *BaseParticles::getScratchBuffer(const std::string &lifetime_group)
+{
+    for (auto &scratch_buffer : scratch_buffers_)
+    {
+        if (scratch_buffer->Name() == lifetime_group)
+        {
+            return scratch_buffer;
+        }
+    }
+    scratch_buffers_.push_back(scratch_buffer_ptrs_.createPtr<ScratchBuffer>(lifetime_group));
+    return scratch_buffers_.back();
+}
+//=================================================================================================//
 void BaseParticles::initializeAllParticlesBounds(size_t number_of_particles)
 {
     sv_total_real_particles_->setValue(number_of_particles);
     particles_bound_ = number_of_particles;
 }
 //=================================================================================================//
-void BaseParticles::initializeAllParticlesBoundsFromReloadXml()
+void BaseParticles::initializeAllParticlesBoundsFromReload()
 {
-    initializeAllParticlesBounds(reload_xml_parser_.Size(reload_xml_parser_.first_element_));
+    reload_binary_file_.empty()
+        ? initializeAllParticlesBounds(reload_xml_parser_.Size(reload_xml_parser_.first_element_))
+        : initializeAllParticlesBounds(reload_binary_particles_);
 }
 //=================================================================================================//
 void BaseParticles::increaseParticlesBounds(size_t extra_size)
@@ -170,6 +202,45 @@ void BaseParticles::readParticlesFromXmlForRestart(const std::string &filefullpa
     read_restart_variable_from_xml_(evolving_variables_, this, restart_xml_parser_);
 }
 //=================================================================================================//
+void BaseParticles::writeParticlesToBinaryForRestart(const std::string &filefullpath)
+{
+    writeParticlesToBinaryForRestart(execution::par_host, filefullpath);
+}
+//=================================================================================================//
+void BaseParticles::readParticlesFromBinaryForRestart(const std::string &filefullpath)
+{
+    readParticlesFromBinaryForRestart(execution::par_host, filefullpath);
+}
+//=================================================================================================//
+void BaseParticles::snapshotParticles()
+{
+    snapshotParticles(execution::par_host);
+}
+//=================================================================================================//
+size_t BaseParticles::restoreParticles()
+{
+    return restoreParticles(execution::par_host);
+}
+//=================================================================================================//
+uint64_t BaseParticles::evolvingVariablesChecksum()
+{
+    UnsignedInt total_real_particles = TotalRealParticles();
+    uint64_t checksum = binaryChecksum(reinterpret_cast<const char *>(&total_real_particles),
+                                       sizeof(total_real_particles));
+    checksum_restart_variables_(evolving_variables_, checksum, total_real_particles);
+    return checksum;
+}
+//=================================================================================================//
+uint64_t BaseParticles::binaryChecksum(const char *data, size_t size, uint64_t hash)
+{
+    for (size_t i = 0; i != size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull; // FNV-1a prime
+    }
+    return hash;
+}
+//=================================================================================================//
 void BaseParticles::writeParticlesToXmlForReload(const std::string &filefullpath)
 {
     resizeXmlDocForParticles(reload_xml_parser_);
@@ -182,4 +253,109 @@ void BaseParticles::readReloadXmlFile(const std::string &filefullpath)
     reload_xml_parser_.loadXmlFile(filefullpath);
 }
 //=================================================================================================//
+static const char reload_binary_mark[8] = {'S', 'P', 'H', 'R', 'L', 'D', '0', '1'};
+//=================================================================================================//
+void BaseParticles::writeParticlesToBinaryForReload(const std::string &filefullpath)
+{
+    std::ofstream out_file(filefullpath, std::ios::binary | std::ios::trunc);
+    UnsignedInt total_real_particles = TotalRealParticles();
+    out_file.write(reload_binary_mark, sizeof(reload_binary_mark));
+    out_file.write(reinterpret_cast<const char *>(&total_real_particles), sizeof(total_real_particles));
+    write_restart_variable_to_binary_(evolving_variables_, execution::par_host, out_file, total_real_particles);
+}
+//=================================================================================================//
+void BaseParticles::readReloadBinaryFile(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath, std::ios::binary);
+    char mark[sizeof(reload_binary_mark)] = {};
+    in_file.read(mark, sizeof(mark));
+    in_file.read(reinterpret_cast<char *>(&reload_binary_particles_), sizeof(reload_binary_particles_));
+    if (!in_file || !std::equal(mark, mark + sizeof(mark), reload_binary_mark))
+    {
+        std::cout << "\n Error: the binary reload file " << filefullpath << " is not valid!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    reload_binary_blocks_.clear();
+    uint32_t name_length = 0;
+    while (in_file.read(reinterpret_cast<char *>(&name_length), sizeof(name_length)))
+    {
+        ReloadBinaryBlock block;
+        block.name_.resize(name_length);
+        in_file.read(block.name_.data(), name_length);
+        in_file.read(reinterpret_cast<char *>(&block.type_index_), sizeof(block.type_index_));
+        in_file.read(reinterpret_cast<char *>(&block.type_size_), sizeof(block.type_size_));
+        in_file.read(reinterpret_cast<char *>(&block.count_), sizeof(block.count_));
+        in_file.read(reinterpret_cast<char *>(&block.checksum_), sizeof(block.checksum_));
+        block.data_offset_ = in_file.tellg();
+        in_file.seekg(std::streamoff(block.count_) * block.type_size_, std::ios::cur);
+        if (!in_file)
+        {
+            std::cout << "\n Error: the binary reload file " << filefullpath << " is truncated!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        reload_binary_blocks_.push_back(block);
+    }
+    reload_binary_file_ = filefullpath;
+}
+//=================================================================================================//
+void BaseParticles::readReloadFile(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath, std::ios::binary);
+    char mark[sizeof(reload_binary_mark)] = {};
+    in_file.read(mark, sizeof(mark));
+    in_file.close();
+    std::equal(mark, mark + sizeof(mark), reload_binary_mark)
+        ? readReloadBinaryFile(filefullpath)
+        : readReloadXmlFile(filefullpath);
+}
+//=================================================================================================//
+void BaseParticles::readReloadBinaryBlock(const std::string &name, int32_t type_index, uint32_t type_size, char *data)
+{
+    auto block = std::find_if(reload_binary_blocks_.begin(), reload_binary_blocks_.end(),
+                              [&](const ReloadBinaryBlock &entry)
+                              { return entry.name_ == name; });
+    if (block == reload_binary_blocks_.end() || block->type_index_ != type_index ||
+        block->type_size_ != type_size || block->count_ != reload_binary_particles_)
+    {
+        std::cout << "\n Error: the variable " << name << " is not found with matching type in the binary reload file "
+                  << reload_binary_file_ << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    // read chunks in parallel directly into the variable data
+    size_t data_bytes = size_t(block->count_) * type_size;
+    size_t chunk_bytes = 64 * 1024 * 1024;
+    size_t number_of_chunks = (data_bytes + chunk_bytes - 1) / chunk_bytes;
+    std::atomic<bool> is_read_failed(false);
+    parallel_for(
+        IndexRange(0, number_of_chunks),
+        [&](const IndexRange &r)
+        {
+            std::ifstream in_file(reload_binary_file_, std::ios::binary);
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                size_t chunk_begin = k * chunk_bytes;
+                size_t chunk_size = SMIN(chunk_bytes, data_bytes - chunk_begin);
+                in_file.seekg(block->data_offset_ + std::streamoff(chunk_begin));
+                in_file.read(data + chunk_begin, chunk_size);
+                if (!in_file)
+                {
+                    is_read_failed = true;
+                }
+            }
+        },
+        ap);
+
+    if (is_read_failed || block->checksum_ != binaryChecksum(data, data_bytes))
+    {
+        std::cout << "\n Error: the binary reload data of " << name << " is corrupted!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
 } // namespace SPH
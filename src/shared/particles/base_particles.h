@@ -74,6 +74,8 @@ class BodyPartByParticle;
 class BaseParticles
 {
   private:
+    UniquePtrKeeper<MemoryArena> memory_arena_keeper_;
+    UniquePtrsKeeper<ScratchBuffer> scratch_buffer_ptrs_;
     DataContainerUniquePtrAssemble<DiscreteVariable> all_discrete_variable_ptrs_;
     DataContainerUniquePtrAssemble<SingularVariable> all_singular_variable_ptrs_;
     UniquePtrsKeeper<Entity> unique_variable_ptrs_;
@@ -104,7 +106,7 @@ class BaseParticles
     UnsignedInt TotalRealParticles() { return sv_total_real_particles_->getValue(); };
     UnsignedInt ParticlesBound() { return particles_bound_; };
     void initializeAllParticlesBounds(size_t total_real_particles);
-    void initializeAllParticlesBoundsFromReloadXml();
+    void initializeAllParticlesBoundsFromReload();
     void increaseParticlesBounds(size_t extra_size);
     void checkEnoughReserve();
     //----------------------------------------------------------------------
@@ -119,6 +121,13 @@ class BaseParticles
     DiscreteVariable<DataType> *registerDiscreteVariable(const std::string &name, size_t data_size, Args &&...args);
     template <typename DataType, typename... Args>
     DiscreteVariable<DataType> *registerStateVariable(const std::string &name, Args &&...args);
+    /** Scratch variables hold the intermediate results within a time step only,
+     *  and are not sorted, copied or written out with the states of particles.
+     *  Those in the same lifetime group, which must not be in use at the same time,
+     *  are aliased onto the same device memory. A variable already registered is returned as it is. */
+    template <typename DataType>
+    DiscreteVariable<DataType> *registerScratchVariable(const std::string &name, const std::string &lifetime_group = "");
+    ScratchBuffer *getScratchBuffer(const std::string &lifetime_group);
     template <typename DataType>
     DiscreteVariable<DataType> *registerStateVariableFrom(const std::string &new_name, const std::string &old_name);
     template <typename DataType>
@@ -170,8 +179,37 @@ class BaseParticles
     void resetTotalRealParticlesFromXmlDoc(XmlParser &xml_parser);
     void writeParticlesToXmlForRestart(const std::string &filefullpath);
     void readParticlesFromXmlForRestart(const std::string &filefullpath);
+    /** Raw binary blocks of the evolving variables, each with name, type, count and checksum. */
+    void writeParticlesToBinaryForRestart(const std::string &filefullpath);
+    void readParticlesFromBinaryForRestart(const std::string &filefullpath);
+    /** The blocks are streamed from and to the data of the execution policy,
+     *  i.e. the device data are not synchronized with the host data as a whole. */
+    template <class ExecutionPolicy>
+    void writeParticlesToBinaryForRestart(const ExecutionPolicy &ex_policy, const std::string &filefullpath);
+    template <class ExecutionPolicy>
+    void readParticlesFromBinaryForRestart(const ExecutionPolicy &ex_policy, const std::string &filefullpath);
+    /** Checksum over the restart data, i.e. the number of real particles and the evolving variables,
+     * used to skip unchanged bodies in delta restart checkpoints. */
+    uint64_t evolvingVariablesChecksum();
+    /** In-memory snapshot of the restart data, streamed from the data of the execution policy
+     *  into host buffers which are reused by later snapshots. */
+    template <class ExecutionPolicy>
+    void snapshotParticles(const ExecutionPolicy &ex_policy);
+    /** Only the variables changed since the snapshot are written back, i.e. the unchanged
+     *  device data are not uploaded again. Returns the number of the restored variables. */
+    template <class ExecutionPolicy>
+    size_t restoreParticles(const ExecutionPolicy &ex_policy);
+    void snapshotParticles();
+    size_t restoreParticles();
+    bool hasSnapshot() { return has_snapshot_; };
     void writeParticlesToXmlForReload(const std::string &filefullpath);
     void readReloadXmlFile(const std::string &filefullpath);
+    /** The binary reload file has the blocks of the binary restart file after a format mark.
+     * Only the block headers are read first, the data are read into the variables on request. */
+    void writeParticlesToBinaryForReload(const std::string &filefullpath);
+    void readReloadBinaryFile(const std::string &filefullpath);
+    /** Read a reload file in either format, detected from the format mark. */
+    void readReloadFile(const std::string &filefullpath);
     template <typename DataType>
     BaseParticles *reloadExtraVariable(const std::string &name);
     //----------------------------------------------------------------------
@@ -180,8 +218,13 @@ class BaseParticles
     void registerPositionAndVolumetricMeasure(StdVec<Vecd> &pos, StdVec<Real> &Vol);
     void registerPositionAndVolumetricMeasureFromReload();
     DiscreteVariable<Vecd> *dvParticlePosition() { return dv_pos_; }
+    /** Host and device bytes of all discrete variables and scratch buffers. */
+    MemoryUsage getMemoryUsage();
+    /** The arena for the host data of the discrete variables, nullptr if not used. */
+    MemoryArena *getMemoryArena() { return memory_arena_; };
 
   protected:
+    MemoryArena *memory_arena_;
     DiscreteVariable<Vecd> *dv_pos_; /**< Discrete variable position */
     Real *Vol_;                      /**< Volumetric measure, also area and length of surface and linear particle */
     Real *rho_;                      /**< Density as a fundamental property of phyiscal matter */
@@ -192,9 +235,31 @@ class BaseParticles
     BaseMaterial &base_material_;
     XmlParser restart_xml_parser_;
     XmlParser reload_xml_parser_;
+    struct ReloadBinaryBlock
+    {
+        std::string name_;
+        int32_t type_index_;
+        uint32_t type_size_;
+        UnsignedInt count_;
+        uint64_t checksum_;
+        std::streamoff data_offset_;
+    };
+    std::string reload_binary_file_; /**< empty if reloading from XML */
+    UnsignedInt reload_binary_particles_;
+    StdVec<ReloadBinaryBlock> reload_binary_blocks_;
+    void readReloadBinaryBlock(const std::string &name, int32_t type_index, uint32_t type_size, char *data);
+    bool has_snapshot_ = false;
+    UnsignedInt snapshot_total_real_particles_ = 0;
+    struct SnapshotBuffer
+    {
+        std::string name_;
+        StdVec<char> data_;
+    };
+    StdVec<SnapshotBuffer> snapshot_buffers_; /**< one buffer for each evolving variable */
     ParticleVariables all_discrete_variables_;
     SingularVariables all_singular_variables_;
     ParticleVariables variables_to_write_;
+    StdVec<ScratchBuffer *> scratch_buffers_;
 
   protected:
     int total_body_parts_;                                /**< total number of body parts indicated particle groups*/
@@ -228,9 +293,53 @@ class BaseParticles
         void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles, XmlParser &xml_parser);
     };
 
+    struct WriteAParticleVariableToBinary
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        const ExecutionPolicy &ex_policy, std::ofstream &out_file, UnsignedInt total_real_particles);
+    };
+
+    struct ReadAParticleVariableFromBinary
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        const ExecutionPolicy &ex_policy, std::ifstream &in_file, UnsignedInt total_real_particles);
+    };
+
+    struct ChecksumAParticleVariable
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        uint64_t &checksum, UnsignedInt total_real_particles);
+    };
+
+    struct SnapshotAParticleVariable
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, const ExecutionPolicy &ex_policy,
+                        StdVec<SnapshotBuffer> &buffers, size_t &buffer_index, UnsignedInt total_real_particles);
+    };
+
+    struct RestoreAParticleVariable
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, const ExecutionPolicy &ex_policy,
+                        StdVec<SnapshotBuffer> &buffers, size_t &buffer_index, size_t &restored_variables,
+                        UnsignedInt total_real_particles);
+    };
+
+    /** FNV-1a hash, which can be continued over consecutive chunks by the hash of the previous ones. */
+    static uint64_t binaryChecksum(const char *data, size_t size, uint64_t hash = 14695981039346656037ull);
+
     OperationOnDataAssemble<ParticleData, CopyParticleState> copy_particle_state_;
     OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_restart_variable_to_xml_, write_reload_variable_to_xml_;
     OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromXml> read_restart_variable_from_xml_;
+    OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToBinary> write_restart_variable_to_binary_;
+    OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromBinary> read_restart_variable_from_binary_;
+    OperationOnDataAssemble<ParticleVariables, ChecksumAParticleVariable> checksum_restart_variables_;
+    OperationOnDataAssemble<ParticleVariables, SnapshotAParticleVariable> snapshot_variables_;
+    OperationOnDataAssemble<ParticleVariables, RestoreAParticleVariable> restore_variables_;
     //----------------------------------------------------------------------
     // Functions for old CPU code compatibility
     //----------------------------------------------------------------------
@@ -33,9 +33,14 @@ template <typename DataType, typename... Args>
 DiscreteVariable<DataType> *BaseParticles::
     registerDiscreteVariable(const std::string &name, size_t data_size, Args &&...args)
 {
-    return registerVariable<DiscreteVariable, DataType>(
+    DiscreteVariable<DataType> *variable = registerVariable<DiscreteVariable, DataType>(
         all_discrete_variables_, all_discrete_variable_ptrs_,
         name, data_size, std::forward<Args>(args)...);
+    if (memory_arena_ != nullptr)
+    {
+        variable->relocateData(*memory_arena_);
+    }
+    return variable;
 }
 //=================================================================================================//
 template <typename DataType, typename... Args>
@@ -54,6 +59,14 @@ DiscreteVariable<DataType> *BaseParticles::registerStateVariable(const std::stri
 }
 //=================================================================================================//
 template <typename DataType>
+DiscreteVariable<DataType> *BaseParticles::
+    registerScratchVariable(const std::string &name, const std::string &lifetime_group)
+{
+    ScratchBuffer *scratch_buffer = lifetime_group.empty() ? nullptr : getScratchBuffer(lifetime_group);
+    return registerDiscreteVariable<DataType>(name, particles_bound_, ScratchVariable{scratch_buffer});
+}
+//=================================================================================================//
+template <typename DataType>
 DiscreteVariable<DataType> *BaseParticles::registerStateVariableFrom(
     const std::string &new_name, const std::string &old_name)
 {
@@ -79,6 +92,12 @@ DiscreteVariable<DataType> *BaseParticles::registerStateVariableFromReload(const
 {
     DiscreteVariable<DataType> *new_variable = registerStateVariable<DataType>(name);
     DataType *data_field = new_variable->Data();
+    if (!reload_binary_file_.empty())
+    {
+        readReloadBinaryBlock(name, DataTypeIndex<DataType>::value, sizeof(DataType),
+                              reinterpret_cast<char *>(data_field));
+        return new_variable;
+    }
     size_t index = 0;
     for (auto child = reload_xml_parser_.first_element_->FirstChildElement(); child; child = child->NextSiblingElement())
     {
@@ -256,6 +275,232 @@ operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
     }
 }
 //=================================================================================================//
+template <typename DataType, class ExecutionPolicy>
+void BaseParticles::WriteAParticleVariableToBinary::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           const ExecutionPolicy &ex_policy, std::ofstream &out_file, UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        const std::string &name = variables[i]->Name();
+        uint32_t name_length = name.size();
+        int32_t type_index = DataTypeIndex<DataType>::value;
+        uint32_t type_size = sizeof(DataType);
+        uint64_t checksum = binaryChecksum(nullptr, 0);
+
+        out_file.write(reinterpret_cast<const char *>(&name_length), sizeof(name_length));
+        out_file.write(name.data(), name_length);
+        out_file.write(reinterpret_cast<const char *>(&type_index), sizeof(type_index));
+        out_file.write(reinterpret_cast<const char *>(&type_size), sizeof(type_size));
+        out_file.write(reinterpret_cast<const char *>(&total_real_particles), sizeof(total_real_particles));
+        // the checksum is known only after the data are streamed
+        std::streampos checksum_position = out_file.tellp();
+        out_file.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+        variables[i]->streamOutData(
+            ex_policy, total_real_particles,
+            [&](const DataType *chunk, size_t chunk_size)
+            {
+                const char *data = reinterpret_cast<const char *>(chunk);
+                size_t data_bytes = chunk_size * sizeof(DataType);
+                checksum = binaryChecksum(data, data_bytes, checksum);
+                out_file.write(data, data_bytes);
+            });
+        std::streampos end_position = out_file.tellp();
+        out_file.seekp(checksum_position);
+        out_file.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+        out_file.seekp(end_position);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void BaseParticles::ChecksumAParticleVariable::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           uint64_t &checksum, UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        const char *data = reinterpret_cast<const char *>(variables[i]->Data());
+        uint64_t block_checksum = binaryChecksum(data, total_real_particles * sizeof(DataType));
+        checksum ^= block_checksum + 0x9e3779b97f4a7c15ull + (checksum << 6) + (checksum >> 2);
+    }
+}
+//=================================================================================================//
+template <typename DataType, class ExecutionPolicy>
+void BaseParticles::SnapshotAParticleVariable::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, const ExecutionPolicy &ex_policy,
+           StdVec<SnapshotBuffer> &buffers, size_t &buffer_index, UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        if (buffer_index == buffers.size())
+        {
+            buffers.emplace_back();
+        }
+        buffers[buffer_index].name_ = variables[i]->Name();
+        StdVec<char> &buffer = buffers[buffer_index].data_;
+        buffer.resize(total_real_particles * sizeof(DataType));
+        size_t offset = 0;
+        variables[i]->streamOutData(
+            ex_policy, total_real_particles,
+            [&](const DataType *chunk, size_t chunk_size)
+            {
+                size_t data_bytes = chunk_size * sizeof(DataType);
+                std::memcpy(buffer.data() + offset, chunk, data_bytes);
+                offset += data_bytes;
+            });
+        buffer_index++;
+    }
+}
+//=================================================================================================//
+template <typename DataType, class ExecutionPolicy>
+void BaseParticles::RestoreAParticleVariable::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, const ExecutionPolicy &ex_policy,
+           StdVec<SnapshotBuffer> &buffers, size_t &buffer_index, size_t &restored_variables,
+           UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        if (buffer_index == buffers.size() || buffers[buffer_index].name_ != variables[i]->Name() ||
+            buffers[buffer_index].data_.size() != total_real_particles * sizeof(DataType))
+        {
+            std::cout << "\n Error: the snapshot does not match the variable " << variables[i]->Name() << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        StdVec<char> &buffer = buffers[buffer_index].data_;
+        bool is_changed = false;
+        size_t offset = 0;
+        variables[i]->streamOutData(
+            ex_policy, total_real_particles,
+            [&](const DataType *chunk, size_t chunk_size)
+            {
+                size_t data_bytes = chunk_size * sizeof(DataType);
+                is_changed = is_changed || std::memcmp(buffer.data() + offset, chunk, data_bytes) != 0;
+                offset += data_bytes;
+            });
+
+        if (is_changed)
+        {
+            offset = 0;
+            variables[i]->streamInData(
+                ex_policy, total_real_particles,
+                [&](DataType *chunk, size_t chunk_size)
+                {
+                    size_t data_bytes = chunk_size * sizeof(DataType);
+                    std::memcpy(reinterpret_cast<char *>(chunk), buffer.data() + offset, data_bytes);
+                    offset += data_bytes;
+                });
+            restored_variables++;
+        }
+        buffer_index++;
+    }
+}
+//=================================================================================================//
+template <typename DataType, class ExecutionPolicy>
+void BaseParticles::ReadAParticleVariableFromBinary::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           const ExecutionPolicy &ex_policy, std::ifstream &in_file, UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        uint32_t name_length = 0;
+        in_file.read(reinterpret_cast<char *>(&name_length), sizeof(name_length));
+        std::string name(name_length, ' ');
+        in_file.read(name.data(), name_length);
+        int32_t type_index = -1;
+        uint32_t type_size = 0;
+        UnsignedInt count = 0;
+        uint64_t checksum = 0;
+        in_file.read(reinterpret_cast<char *>(&type_index), sizeof(type_index));
+        in_file.read(reinterpret_cast<char *>(&type_size), sizeof(type_size));
+        in_file.read(reinterpret_cast<char *>(&count), sizeof(count));
+        in_file.read(reinterpret_cast<char *>(&checksum), sizeof(checksum));
+
+        if (!in_file || name != variables[i]->Name() || type_index != DataTypeIndex<DataType>::value ||
+            type_size != sizeof(DataType) || count != total_real_particles)
+        {
+            std::cout << "\n Error: the binary restart block " << name
+                      << " does not match the variable " << variables[i]->Name() << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        uint64_t data_checksum = binaryChecksum(nullptr, 0);
+        variables[i]->streamInData(
+            ex_policy, count,
+            [&](DataType *chunk, size_t chunk_size)
+            {
+                char *data = reinterpret_cast<char *>(chunk);
+                size_t data_bytes = chunk_size * sizeof(DataType);
+                in_file.read(data, data_bytes);
+                data_checksum = binaryChecksum(data, data_bytes, data_checksum);
+            });
+        if (!in_file || checksum != data_checksum)
+        {
+            std::cout << "\n Error: the binary restart data of " << name << " is corrupted!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void BaseParticles::writeParticlesToBinaryForRestart(const ExecutionPolicy &ex_policy, const std::string &filefullpath)
+{
+    std::ofstream out_file(filefullpath, std::ios::binary | std::ios::trunc);
+    UnsignedInt total_real_particles = TotalRealParticles();
+    std::cout << "\n Total real particles of body" << getBodyName()
+              << "write to restart is " << total_real_particles << "\n";
+    out_file.write(reinterpret_cast<const char *>(&total_real_particles), sizeof(total_real_particles));
+    write_restart_variable_to_binary_(evolving_variables_, ex_policy, out_file, total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void BaseParticles::readParticlesFromBinaryForRestart(const ExecutionPolicy &ex_policy, const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath, std::ios::binary);
+    UnsignedInt total_real_particles = 0;
+    in_file.read(reinterpret_cast<char *>(&total_real_particles), sizeof(total_real_particles));
+    if (!in_file || total_real_particles > ParticlesBound())
+    {
+        std::cout << "\n Error: the binary restart file " << filefullpath << " is not valid!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    sv_total_real_particles_->setValue(total_real_particles);
+    std::cout << "\n Total real particles of body" << getBodyName()
+              << "from restart is " << TotalRealParticles() << "\n";
+    read_restart_variable_from_binary_(evolving_variables_, ex_policy, in_file, total_real_particles);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void BaseParticles::snapshotParticles(const ExecutionPolicy &ex_policy)
+{
+    snapshot_total_real_particles_ = TotalRealParticles();
+    size_t buffer_index = 0;
+    snapshot_variables_(evolving_variables_, ex_policy, snapshot_buffers_, buffer_index, snapshot_total_real_particles_);
+    snapshot_buffers_.resize(buffer_index);
+    has_snapshot_ = true;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+size_t BaseParticles::restoreParticles(const ExecutionPolicy &ex_policy)
+{
+    if (!has_snapshot_)
+    {
+        std::cout << "\n Error: no snapshot of the particles of body " << getBodyName() << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    sv_total_real_particles_->setValue(snapshot_total_real_particles_);
+    size_t buffer_index = 0;
+    size_t restored_variables = 0;
+    restore_variables_(evolving_variables_, ex_policy, snapshot_buffers_, buffer_index,
+                       restored_variables, snapshot_total_real_particles_);
+    return restored_variables;
+}
+//=================================================================================================//
 template <class DataType, typename... Args>
 DataType *BaseParticles::
     addUniqueDiscreteVariableData(const std::string &name, size_t data_size, Args &&...args)
@@ -16,4 +16,16 @@ RemoveRealParticle::RemoveRealParticle(BaseParticles *particles)
       dv_original_id_(particles->getVariableByName<UnsignedInt>("OriginalID")),
       sv_total_real_particles_(particles->svTotalRealParticles()) {}
 //=================================================================================================//
+RemoveRealParticles::RemoveRealParticles(BaseParticles *particles, DiscreteVariable<int> *dv_life_status)
+    : evolving_variables_(particles->EvolvingVariables()),
+      copyable_states_(),
+      dv_original_id_(particles->getVariableByName<UnsignedInt>("OriginalID")),
+      dv_life_status_(dv_life_status),
+      dv_removal_flag_(particles->registerDiscreteVariable<UnsignedInt>(
+          "RemovalFlag", particles->ParticlesBound() + 1)),
+      dv_removal_offset_(particles->registerDiscreteVariable<UnsignedInt>(
+          "RemovalOffset", particles->ParticlesBound() + 1)),
+      dv_remaining_index_(particles->registerDiscreteVariable<UnsignedInt>(
+          "RemainingIndex", particles->ParticlesBound())) {}
+//=================================================================================================//
 } // namespace SPH
@@ -53,7 +53,7 @@ class SpawnRealParticle
   public:
     SpawnRealParticle(BaseParticles *particles);
 
-    class ComputingKernel // only run with sequenced policy for now
+    class ComputingKernel // each spawn takes a unique slot by atomic increment, for any policy
     {
       public:
         template <class ExecutionPolicy, class EncloserType>
@@ -90,7 +90,7 @@ class RemoveRealParticle
   public:
     RemoveRealParticle(BaseParticles *particles);
 
-    class ComputingKernel // only run with sequenced policy for now
+    class ComputingKernel // only run with sequenced policy, see RemoveRealParticles for parallel removal
     {
       public:
         template <class ExecutionPolicy, class EncloserType>
@@ -122,5 +122,73 @@ class RemoveRealParticle
         OperationOnDataAssemble<VariableDataArrayAssemble, CopyParticleStateCK> copy_particle_state_;
     };
 };
+
+/**
+ * @class RemoveRealParticles
+ * @brief Bulk removal of the real particles flagged by the life status.
+ * The flags are scanned for the number of removed particles before each particle.
+ * The remaining particles beyond the new total then fill the removed ones below the new total
+ * in one parallel pass, so that all removals of a step are done without atomic operations.
+ */
+class RemoveRealParticles
+{
+    ParticleVariables &evolving_variables_;
+    DiscreteVariableArrayAssemble copyable_states_;
+    DiscreteVariable<UnsignedInt> *dv_original_id_;
+    DiscreteVariable<int> *dv_life_status_;
+    DiscreteVariable<UnsignedInt> *dv_removal_flag_;
+    DiscreteVariable<UnsignedInt> *dv_removal_offset_;
+    DiscreteVariable<UnsignedInt> *dv_remaining_index_;
+
+  public:
+    RemoveRealParticles(BaseParticles *particles, DiscreteVariable<int> *dv_life_status);
+    DiscreteVariable<UnsignedInt> *dvRemovalFlag() { return dv_removal_flag_; };
+    DiscreteVariable<UnsignedInt> *dvRemovalOffset() { return dv_removal_offset_; };
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+        void flagRemoval(UnsignedInt index_i)
+        {
+            removal_flag_[index_i] = life_status_[index_i] == 1 ? 1 : 0; // 1: to delete
+        };
+
+        /** For the particles beyond the new total, i.e. remaining bound. */
+        void indexRemaining(UnsignedInt index_i, UnsignedInt remaining_bound)
+        {
+            life_status_[index_i] = 0; // reset the life status
+            if (removal_flag_[index_i] == 0)
+            {
+                UnsignedInt removed_beyond = removal_offset_[index_i] - removal_offset_[remaining_bound];
+                remaining_index_[index_i - remaining_bound - removed_beyond] = index_i;
+            }
+        };
+
+        /** For the particles below the new total. */
+        void fillRemoved(UnsignedInt index_i)
+        {
+            if (removal_flag_[index_i] == 1)
+            {
+                UnsignedInt index_j = remaining_index_[removal_offset_[index_i]];
+                UnsignedInt old_original_id = original_id_[index_i];
+                copy_particle_state_(copyable_state_data_arrays_, index_i, index_j);
+                life_status_[index_i] = 0;               // reset the life status
+                original_id_[index_j] = old_original_id; // swap the original id
+            }
+        };
+
+      protected:
+        UnsignedInt *original_id_;
+        int *life_status_;
+        UnsignedInt *removal_flag_;
+        UnsignedInt *removal_offset_;
+        UnsignedInt *remaining_index_;
+        VariableDataArrayAssemble copyable_state_data_arrays_;
+        OperationOnDataAssemble<VariableDataArrayAssemble, CopyParticleStateCK> copy_particle_state_;
+    };
+};
 } // namespace SPH
 #endif // PARTICLE_OPERATION_H
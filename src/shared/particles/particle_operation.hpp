@@ -45,5 +45,23 @@ RemoveRealParticle::ComputingKernel::
         initialize_variable_data_array;
     initialize_variable_data_array(encloser.copyable_states_, copyable_state_data_arrays_, ex_policy);
 }
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+RemoveRealParticles::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : original_id_(encloser.dv_original_id_->DelegatedData(ex_policy)),
+      life_status_(encloser.dv_life_status_->DelegatedData(ex_policy)),
+      removal_flag_(encloser.dv_removal_flag_->DelegatedData(ex_policy)),
+      removal_offset_(encloser.dv_removal_offset_->DelegatedData(ex_policy)),
+      remaining_index_(encloser.dv_remaining_index_->DelegatedData(ex_policy))
+{
+    OperationBetweenDataAssembles<ParticleVariables, DiscreteVariableArrayAssemble, DiscreteVariableArrayAssembleInitialization>
+        initialize_discrete_variable_array;
+    initialize_discrete_variable_array(encloser.evolving_variables_, encloser.copyable_states_);
+    OperationBetweenDataAssembles<DiscreteVariableArrayAssemble, VariableDataArrayAssemble, VariableDataArrayAssembleInitialization>
+        initialize_variable_data_array;
+    initialize_variable_data_array(encloser.copyable_states_, copyable_state_data_arrays_, ex_policy);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // PARTICLE_OPERATION_HPP
\ No newline at end of file
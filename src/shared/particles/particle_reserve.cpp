@@ -21,17 +21,35 @@ void ParticleReserve::checkParticlesReserved()
 //=================================================================================================//
 void ParticleBuffer<Base>::checkEnoughBuffer(BaseParticles &base_particles)
 {
-    if (base_particles.TotalRealParticles() >= base_particles.ParticlesBound())
+    size_t total_real_particles = base_particles.TotalRealParticles();
+    size_t particles_bound = base_particles.ParticlesBound();
+    if (total_real_particles >= particles_bound)
     {
         std::cout << "\n ERROR: Not enough buffer particles have been reserved!" << std::endl;
         std::cout << "\n You may need to increase the particle reserve." << std::endl;
+        std::cout << " Total real particles: " << total_real_particles
+                  << ", particles bound: " << particles_bound
+                  << ", buffer size: " << buffer_size_ << std::endl;
         std::cout << __FILE__ << ':' << __LINE__ << std::endl;
         exit(1);
     }
+
+    if (!is_watermark_reached_ &&
+        Real(particles_bound - total_real_particles) < watermark_ * Real(buffer_size_))
+    {
+        is_watermark_reached_ = true;
+        std::cout << "\n WARNING: The free buffer particles fall below the watermark!" << std::endl;
+        std::cout << " Total real particles: " << total_real_particles
+                  << ", particles bound: " << particles_bound
+                  << ", buffer size: " << buffer_size_ << std::endl;
+        std::cout << " The run will abort when the buffer is used up, "
+                  << "you may need to increase the particle reserve." << std::endl;
+    }
 }
 //=================================================================================================//
 void ParticleBuffer<Base>::allocateBufferParticles(BaseParticles &base_particles, size_t buffer_size)
 {
+    buffer_size_ += buffer_size;
     base_particles.increaseParticlesBounds(buffer_size);
 }
 //=================================================================================================//
@@ -70,6 +70,14 @@ class ParticleBuffer<Base> : public ParticleReserve
     virtual ~ParticleBuffer() {};
     void checkEnoughBuffer(BaseParticles &base_particles);
     void allocateBufferParticles(BaseParticles &base_particles, size_t buffer_size);
+    size_t getBufferSize() { return buffer_size_; };
+    /** Warn once when the free buffer falls below the fraction of the buffer size. */
+    void setBufferWatermark(Real watermark) { watermark_ = watermark; };
+
+  protected:
+    size_t buffer_size_ = 0;
+    Real watermark_ = 0.1;
+    bool is_watermark_reached_ = false;
 };
 
 template <class BufferSizeEstimator>
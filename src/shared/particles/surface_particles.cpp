@@ -7,7 +7,7 @@ namespace SPH
 //=============================================================================================//
 SurfaceParticles::SurfaceParticles(SPHBody &sph_body, BaseMaterial *base_material)
     : BaseParticles(sph_body, base_material), n_(nullptr), thickness_(nullptr),
-      transformation_matrix0_(nullptr)
+      n0_(nullptr), transformation_matrix0_(nullptr)
 {
     //----------------------------------------------------------------------
     //		modify kernel function for surface particles
@@ -37,9 +37,18 @@ void SurfaceParticles::registerSurfacePropertiesFromReload()
 //=================================================================================================//
 void SurfaceParticles::registerTransformationMatrix()
 {
-    transformation_matrix0_ = registerStateVariableData<Matd>(
-        "TransformationMatrix", [&](size_t index_i) -> Matd
-        { return getTransformationMatrix(n_[index_i]); });
+    n0_ = registerStateVariableDataFrom<Vecd>("InitialNormalDirection", "NormalDirection");
+}
+//=================================================================================================//
+Matd *SurfaceParticles::getTransformationMatrix0()
+{
+    if (transformation_matrix0_ == nullptr)
+    {
+        transformation_matrix0_ = registerStateVariableData<Matd>(
+            "TransformationMatrix", [&](size_t index_i) -> Matd
+            { return getTransformationMatrix(n0_[index_i]); });
+    }
+    return transformation_matrix0_;
 }
 //=================================================================================================//
 } // namespace SPH
@@ -45,12 +45,17 @@ class SurfaceParticles : public BaseParticles
 
     Vecd *n_;                      /**< normal direction */
     Real *thickness_;              /**< shell thickness */
+    Vecd *n0_;                     /**< initial normal direction, which defines the initial local frame */
     Matd *transformation_matrix0_; /**< initial transformation matrix from global to local coordinates */
 
     void registerSurfaceProperties(StdVec<Vecd> &n, StdVec<Real> &thickness);
     void registerSurfacePropertiesFromReload();
     virtual Real ParticleVolume(size_t index_i) override { return Vol_[index_i] * thickness_[index_i]; }
+    /** The initial local frame is stored compactly by the initial normal direction,
+     *  and expanded to the transformation matrix on the fly by getTransformationMatrix(n0). */
     virtual void registerTransformationMatrix();
+    /** The full transformation matrix is only registered when required, e.g. by the legacy dynamics. */
+    Matd *getTransformationMatrix0();
     virtual void initializeBasicParticleVariables() override;
 };
 
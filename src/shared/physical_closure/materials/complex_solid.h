@@ -43,6 +43,8 @@ class ActiveMuscle : public MuscleType
 {
   protected:
     Real *active_contraction_stress_; /**<  active contraction stress */
+    DiscreteVariable<Real> *dv_active_contraction_stress_;
+    DiscreteVariable<Matd> *dv_muscle_fiber_tensor_;
 
   public:
     template <typename... Args>
@@ -53,6 +55,25 @@ class ActiveMuscle : public MuscleType
     virtual void initializeLocalParameters(BaseParticles *base_particles) override;
     /** compute the stress through Constitutive relation. */
     virtual Matd StressPK2(Matd &deformation, size_t index_i) override;
+
+    /** The active part of the second Piola-Kirchhoff stress for computing kernels. */
+    class ActiveStressKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ActiveStressKernel(const ExecutionPolicy &ex_policy, ActiveMuscle<MuscleType> &encloser)
+            : active_contraction_stress_(encloser.dv_active_contraction_stress_->DelegatedData(ex_policy)),
+              muscle_fiber_tensor_(encloser.dv_muscle_fiber_tensor_->DelegatedData(ex_policy)) {};
+
+        inline Matd StressPK2(size_t index_i) const
+        {
+            return active_contraction_stress_[index_i] * muscle_fiber_tensor_[index_i];
+        };
+
+      protected:
+        Real *active_contraction_stress_;
+        Matd *muscle_fiber_tensor_;
+    };
 };
 
 /**
@@ -10,7 +10,8 @@ template <class MuscleType>
 template <typename... Args>
 ActiveMuscle<MuscleType>::ActiveMuscle(Args &&...args)
     : MuscleType(std::forward<Args>(args)...),
-      active_contraction_stress_(nullptr)
+      active_contraction_stress_(nullptr), dv_active_contraction_stress_(nullptr),
+      dv_muscle_fiber_tensor_(nullptr)
 {
     MuscleType::material_type_name_ = "ActiveMuscle";
 }
@@ -19,7 +20,11 @@ template <class MuscleType>
 void ActiveMuscle<MuscleType>::initializeLocalParameters(BaseParticles *base_particles)
 {
     MuscleType::initializeLocalParameters(base_particles);
-    active_contraction_stress_ = base_particles->registerStateVariableData<Real>("ActiveContractionStress");
+    dv_active_contraction_stress_ = base_particles->registerStateVariable<Real>("ActiveContractionStress");
+    active_contraction_stress_ = dv_active_contraction_stress_->Data();
+    dv_muscle_fiber_tensor_ = base_particles->registerStateVariable<Matd>(
+        "MuscleFiberTensor", [&](size_t i) -> Matd
+        { return MuscleType::MuscleFiberDirection(i); });
 }
 //=============================================================================================//
 template <class MuscleType>
@@ -22,4 +22,7 @@ Real CompressibleFluid::getSoundSpeed(Real p, Real rho)
     return std::sqrt(gamma_ * p / rho);
 }
 //=============================================================================================//
+CompressibleFluid::EosKernel::EosKernel(CompressibleFluid &encloser)
+    : Fluid::EosKernel(encloser), gamma_(encloser.gamma_) {}
+//=============================================================================================//
 } // namespace SPH
@@ -52,5 +52,18 @@ class CompressibleFluid : public Fluid
     virtual Real getPressure(Real rho) override { return 0.0; };
     virtual Real DensityFromPressure(Real p) override { return 0.0; };
     virtual Real getSoundSpeed(Real p, Real rho) override;
+
+    class EosKernel : Fluid::EosKernel
+    {
+      public:
+        EosKernel(CompressibleFluid &encloser);
+
+        Real HeatCapacityRatio() { return gamma_; };
+        Real getPressure(Real rho, Real rho_e) { return rho_e * (gamma_ - 1.0); };
+        Real getSoundSpeed(Real p, Real rho) { return sqrt(gamma_ * p / rho); };
+
+      protected:
+        Real gamma_;
+    };
 };
 } // namespace SPH
@@ -84,7 +84,8 @@ LocalDirectionalDiffusion::LocalDirectionalDiffusion(const std::string &diffusio
                                                      Vecd bias_direction, Real cv)
     : DirectionalDiffusion(diffusion_species_name, gradient_species_name,
                            d_coeff, bias_d_coeff_, bias_direction, cv),
-      local_bias_direction_(nullptr), local_transformed_diffusivity_(nullptr) {}
+      local_bias_direction_(nullptr), local_transformed_diffusivity_(nullptr),
+      dv_local_transformed_diffusivity_(nullptr) {}
 //=================================================================================================//
 LocalDirectionalDiffusion::LocalDirectionalDiffusion(const std::string &species_name,
                                                      Real d_coeff, Real bias_d_coeff_,
@@ -104,7 +105,7 @@ void LocalDirectionalDiffusion::registerLocalParametersFromReload(BaseParticles
 void LocalDirectionalDiffusion::initializeLocalParameters(BaseParticles *base_particles)
 {
     DirectionalDiffusion::initializeLocalParameters(base_particles);
-    local_transformed_diffusivity_ = base_particles->registerStateVariableData<Matd>(
+    dv_local_transformed_diffusivity_ = base_particles->registerStateVariable<Matd>(
         "LocalTransformedDiffusivity",
         [&](size_t i) -> Matd
         {
@@ -112,6 +113,7 @@ void LocalDirectionalDiffusion::initializeLocalParameters(BaseParticles *base_pa
                           bias_d_coeff_ * local_bias_direction_[i] * local_bias_direction_[i].transpose();
             return inverseCholeskyDecomposition(diff_i);
         });
+    local_transformed_diffusivity_ = dv_local_transformed_diffusivity_->Data();
 
     std::cout << "\n Local diffusion parameters setup finished " << std::endl;
 };
@@ -223,6 +223,7 @@ class LocalDirectionalDiffusion : public DirectionalDiffusion
   protected:
     Vecd *local_bias_direction_;
     Matd *local_transformed_diffusivity_;
+    DiscreteVariable<Matd> *dv_local_transformed_diffusivity_;
 
   public:
     LocalDirectionalDiffusion(const std::string &diffusion_species_name,
@@ -245,6 +246,26 @@ class LocalDirectionalDiffusion : public DirectionalDiffusion
         Vecd grad_ij = trans_diffusivity * e_ij;
         return 1.0 / grad_ij.squaredNorm();
     };
+
+    /** The fiber tensor of each particle is delegated to the execution policy. */
+    class InterParticleDiffusionCoeff
+    {
+        Matd *local_transformed_diffusivity_;
+
+      public:
+        InterParticleDiffusionCoeff() : local_transformed_diffusivity_(nullptr) {};
+        template <class ExecutionPolicy>
+        InterParticleDiffusionCoeff(const ExecutionPolicy &ex_policy, LocalDirectionalDiffusion &encloser)
+            : local_transformed_diffusivity_(
+                  encloser.dv_local_transformed_diffusivity_->DelegatedData(ex_policy)) {};
+        Real operator()(size_t index_i, size_t index_j, const Vecd &e_ij)
+        {
+            Matd trans_diffusivity = 0.5 * (local_transformed_diffusivity_[index_i] +
+                                            local_transformed_diffusivity_[index_j]);
+            Vecd grad_ij = trans_diffusivity * e_ij;
+            return 1.0 / grad_ij.squaredNorm();
+        };
+    };
 };
 
 /**
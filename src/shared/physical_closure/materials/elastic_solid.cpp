@@ -49,6 +49,11 @@ LinearElasticSolid::
     LinearElasticSolid(Real rho0, Real youngs_modulus, Real poisson_ratio) : ElasticSolid(rho0)
 {
     material_type_name_ = "LinearElasticSolid";
+    resetElasticModuli(youngs_modulus, poisson_ratio);
+}
+//=================================================================================================//
+void LinearElasticSolid::resetElasticModuli(Real youngs_modulus, Real poisson_ratio)
+{
     E0_ = youngs_modulus;
     nu_ = poisson_ratio;
     G0_ = getShearModulus(youngs_modulus, poisson_ratio);
@@ -110,6 +110,38 @@ class ElasticSolid : public Solid
     virtual DiscreteVariable<Vecd> *AverageVelocityVariable(BaseParticles *base_particles) override;
     /** Get average acceleration when interacting with fluid. */
     virtual DiscreteVariable<Vecd> *AverageAccelerationVariable(BaseParticles *base_particles) override;
+
+    /** The constitutive functions without virtual calls used in computing kernels. */
+    class ConstituteKernel
+    {
+      public:
+        ConstituteKernel(ElasticSolid &encloser)
+            : rho0_(encloser.rho0_), c0_(encloser.c0_), cs0_(encloser.cs0_),
+              G0_(encloser.G0_), K0_(encloser.K0_) {};
+
+        inline Real ShearModulus() const { return G0_; };
+        inline Real PairNumericalDamping(Real dE_dt_ij, Real smoothing_length) const
+        {
+            return 0.5 * rho0_ * c0_ * dE_dt_ij * smoothing_length;
+        };
+        template <typename ScalingType>
+        inline Matd NumericalDampingRightCauchy(const Matd &deformation, const Matd &deformation_rate, const ScalingType &scaling) const
+        {
+            Matd strain_rate = 0.5 * (deformation_rate.transpose() * deformation + deformation.transpose() * deformation_rate);
+            Matd normal_rate = strain_rate.diagonal().asDiagonal();
+            return 0.5 * rho0_ * (cs0_ * (strain_rate - normal_rate) + c0_ * normal_rate) * scaling;
+        };
+        inline Matd NumericalDampingLeftCauchy(const Matd &deformation, const Matd &deformation_rate, Real scaling) const
+        {
+            Matd strain_rate = 0.5 * (deformation_rate * deformation.transpose() + deformation * deformation_rate.transpose());
+            Matd normal_rate = strain_rate.diagonal().asDiagonal();
+            return 0.5 * rho0_ * (cs0_ * (strain_rate - normal_rate) + c0_ * normal_rate) * scaling;
+        };
+        inline Matd DeviatoricKirchhoff(const Matd &deviatoric_be) const { return G0_ * deviatoric_be; };
+
+      protected:
+        Real rho0_, c0_, cs0_, G0_, K0_;
+    };
 };
 
 /**
@@ -131,11 +163,36 @@ class LinearElasticSolid : public ElasticSolid
     /** Define the calculation of the stress matrix for postprocessing */
     virtual std::string getRelevantStressMeasureName() override { return "PK2"; };
 
+    /** Reset the moduli and sound speeds with the density unchanged, e.g. for a parameter sweep. */
+    void resetElasticModuli(Real youngs_modulus, Real poisson_ratio);
+
     /** get methods */
     Real getYoungsModulus() { return E0_; };
     Real getPoissonRatio() { return nu_; };
     Real getDensity() { return rho0_; };
 
+    class ConstituteKernel : public ElasticSolid::ConstituteKernel
+    {
+      public:
+        ConstituteKernel(LinearElasticSolid &encloser)
+            : ElasticSolid::ConstituteKernel(encloser), lambda0_(encloser.lambda0_) {};
+
+        inline Matd StressPK2(const Matd &F) const
+        {
+            Matd strain = 0.5 * (F.transpose() + F) - Matd::Identity();
+            return lambda0_ * strain.trace() * Matd::Identity() + 2.0 * G0_ * strain;
+        };
+        inline Matd StressPK1(const Matd &F) const { return F * StressPK2(F); };
+        inline Matd StressCauchy(const Matd &almansi_strain) const
+        {
+            return lambda0_ * almansi_strain.trace() * Matd::Identity() + 2.0 * G0_ * almansi_strain;
+        };
+        inline Real VolumetricKirchhoff(Real J) const { return K0_ * J * (J - 1); };
+
+      protected:
+        Real lambda0_;
+    };
+
   protected:
     Real lambda0_; /*< first Lame parameter */
     Real getBulkModulus(Real youngs_modulus, Real poisson_ratio);
@@ -161,6 +218,20 @@ class SaintVenantKirchhoffSolid : public LinearElasticSolid
 
     /** second Piola-Kirchhoff stress related with green-lagrangian deformation tensor */
     virtual Matd StressPK2(Matd &deformation, size_t particle_index_i) override;
+
+    class ConstituteKernel : public LinearElasticSolid::ConstituteKernel
+    {
+      public:
+        ConstituteKernel(SaintVenantKirchhoffSolid &encloser)
+            : LinearElasticSolid::ConstituteKernel(encloser) {};
+
+        inline Matd StressPK2(const Matd &F) const
+        {
+            Matd strain = 0.5 * (F.transpose() * F - Matd::Identity());
+            return lambda0_ * strain.trace() * Matd::Identity() + 2.0 * G0_ * strain;
+        };
+        inline Matd StressPK1(const Matd &F) const { return F * StressPK2(F); };
+    };
 };
 
 /**
@@ -184,6 +255,30 @@ class NeoHookeanSolid : public LinearElasticSolid
     virtual Real VolumetricKirchhoff(Real J) override;
     /** Define the calculation of the stress matrix for postprocessing */
     virtual std::string getRelevantStressMeasureName() override { return "Cauchy"; };
+
+    class ConstituteKernel : public LinearElasticSolid::ConstituteKernel
+    {
+      public:
+        ConstituteKernel(NeoHookeanSolid &encloser)
+            : LinearElasticSolid::ConstituteKernel(encloser) {};
+
+        inline Matd StressPK2(const Matd &F) const
+        {
+            Matd right_cauchy = F.transpose() * F;
+            Real J = F.determinant();
+            return G0_ * Matd::Identity() + (lambda0_ * (J - 1.0) - G0_) * J * right_cauchy.inverse();
+        };
+        inline Matd StressPK1(const Matd &F) const { return F * StressPK2(F); };
+        inline Matd StressCauchy(const Matd &almansi_strain) const
+        {
+            Matd B = (-2.0 * almansi_strain + Matd::Identity()).inverse();
+            Real J = math::sqrt(B.determinant());
+            return 0.5 * K0_ * (J - 1.0 / J) * Matd::Identity() +
+                   G0_ * math::pow(J, -2.0 * OneOverDimensions - 1.0) *
+                       (B - OneOverDimensions * B.trace() * Matd::Identity());
+        };
+        inline Real VolumetricKirchhoff(Real J) const { return 0.5 * K0_ * (J * J - 1); };
+    };
 };
 
 /**
@@ -283,6 +378,37 @@ class Muscle : public NeoHookeanSolid
     /** Define the calculation of the stress matrix for postprocessing */
     virtual std::string getRelevantStressMeasureName() override { return "Cauchy"; };
 
+    class ConstituteKernel : public NeoHookeanSolid::ConstituteKernel
+    {
+      public:
+        ConstituteKernel(Muscle &encloser)
+            : NeoHookeanSolid::ConstituteKernel(encloser),
+              f0_(encloser.f0_), s0_(encloser.s0_), f0f0_(encloser.f0f0_),
+              s0s0_(encloser.s0s0_), f0s0_(encloser.f0s0_), a0_(encloser.a0_), b0_(encloser.b0_) {};
+
+        inline Matd StressPK2(const Matd &F) const
+        {
+            Matd right_cauchy = F.transpose() * F;
+            Real I_ff_1 = (right_cauchy * f0_).dot(f0_) - 1.0;
+            Real I_ss_1 = (right_cauchy * s0_).dot(s0_) - 1.0;
+            Real I_fs = (right_cauchy * f0_).dot(s0_);
+            Real I_1_1 = right_cauchy.trace() - Real(Dimensions);
+            Real J = F.determinant();
+            return a0_[0] * exp(b0_[0] * I_1_1) * Matd::Identity() +
+                   (lambda0_ * (J - 1.0) - a0_[0]) * J * right_cauchy.inverse() +
+                   2.0 * a0_[1] * I_ff_1 * exp(b0_[1] * I_ff_1 * I_ff_1) * f0f0_ +
+                   2.0 * a0_[2] * I_ss_1 * exp(b0_[2] * I_ss_1 * I_ss_1) * s0s0_ +
+                   a0_[3] * I_fs * exp(b0_[3] * I_fs * I_fs) * f0s0_;
+        };
+        inline Matd StressPK1(const Matd &F) const { return F * StressPK2(F); };
+        inline Real VolumetricKirchhoff(Real J) const { return K0_ * J * (J - 1); };
+
+      protected:
+        Vecd f0_, s0_;
+        Matd f0f0_, s0s0_, f0s0_;
+        std::array<Real, 4> a0_, b0_;
+    };
+
   protected:
     Vecd f0_, s0_;                /**< Reference fiber and sheet directions as basic parameter. */
     Matd f0f0_, s0s0_, f0s0_;     /**< Tensor products of fiber and sheet directions as basic parameter.. */
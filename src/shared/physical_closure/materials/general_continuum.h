@@ -122,7 +122,8 @@ class PlasticContinuum : public GeneralContinuum
       public:
         PlasticKernel(PlasticContinuum &encloser) : GeneralContinuum::GeneralContinuumKernel(encloser),
                                                     c_(encloser.c_), phi_(encloser.phi_),
-                                                    psi_(encloser.psi_), alpha_phi_(encloser.alpha_phi_), k_c_(encloser.k_c_) {};
+                                                    psi_(encloser.psi_), alpha_phi_(encloser.alpha_phi_), k_c_(encloser.k_c_),
+                                                    alpha_psi_(encloser.getDPConstantsA(encloser.psi_)) {};
 
         inline Real getDPConstantsA(Real friction_angle);
         inline Mat3d ConstitutiveRelation(Mat3d &velocity_gradient, Mat3d &stress_tensor);
@@ -135,6 +136,7 @@ class PlasticContinuum : public GeneralContinuum
         Real psi_;                                                 /* dilatancy angle  */
         Real alpha_phi_;                                           /* Drucker-Prager's constants */
         Real k_c_;                                                 /* Drucker-Prager's constants */
+        Real alpha_psi_;                                           /* Drucker-Prager's constant of the dilatancy angle */
         Real stress_dimension_ = 3.0; /* plain strain condition */ // Temporarily cancel const --need to check
     };
 };
@@ -162,6 +164,25 @@ class J2Plasticity : public GeneralContinuum
     virtual Matd ReturnMappingShearStress(Matd &shear_stress, Real &hardening_factor);
     virtual Real ScalePenaltyForce(Matd &shear_stress, Real &hardening_factor);
     virtual Real HardeningFactorRate(const Matd &shear_stress, Real &hardening_factor);
+
+    class J2PlasticityKernel : public GeneralContinuum::GeneralContinuumKernel
+    {
+      public:
+        J2PlasticityKernel(J2Plasticity &encloser) : GeneralContinuum::GeneralContinuumKernel(encloser),
+                                                     yield_stress_(encloser.yield_stress_),
+                                                     hardening_modulus_(encloser.hardening_modulus_),
+                                                     sqrt_2_over_3_(encloser.sqrt_2_over_3_) {};
+
+        inline Matd ConstitutiveRelationShearStressWithHardening(const Matd &velocity_gradient, const Matd &shear_stress, Real hardening_factor);
+        inline Matd ReturnMappingShearStress(const Matd &shear_stress, Real hardening_factor);
+        inline Real ScalePenaltyForce(const Matd &shear_stress, Real hardening_factor);
+        inline Real HardeningFactorRate(const Matd &shear_stress, Real hardening_factor);
+
+      protected:
+        Real yield_stress_;
+        Real hardening_modulus_;
+        Real sqrt_2_over_3_;
+    };
 };
 } // namespace SPH
 #endif // GENERAL_CONTINUUM_H
\ No newline at end of file
@@ -41,8 +41,8 @@ Mat3d PlasticContinuum::PlasticKernel::ConstitutiveRelation(Mat3d &velocity_grad
     {
         Real deviatoric_stress_times_strain_rate = (deviatoric_stress_tensor.cwiseProduct(strain_rate)).sum();
         // non-associate flow rule
-        lambda_dot_ = (3.0 * alpha_phi_ * K_ * strain_rate.trace() + (G_ / (sqrt(stress_tensor_J2)+TinyReal)) * deviatoric_stress_times_strain_rate) / (9.0 * alpha_phi_ * K_ * getDPConstantsA(psi_) + G_);
-        g = lambda_dot_ * (3.0 * K_ * getDPConstantsA(psi_) * Mat3d::Identity() + G_ * deviatoric_stress_tensor / (sqrt(stress_tensor_J2+ TinyReal)));
+        lambda_dot_ = (3.0 * alpha_phi_ * K_ * strain_rate.trace() + (G_ / (sqrt(stress_tensor_J2)+TinyReal)) * deviatoric_stress_times_strain_rate) / (9.0 * alpha_phi_ * K_ * alpha_psi_ + G_);
+        g = lambda_dot_ * (3.0 * K_ * alpha_psi_ * Mat3d::Identity() + G_ * deviatoric_stress_tensor / (sqrt(stress_tensor_J2+ TinyReal)));
     }
     Mat3d stress_rate_temp = stress_rate_elastic - g;
     return stress_rate_temp;
@@ -63,5 +63,44 @@ Mat3d PlasticContinuum::PlasticKernel::ReturnMapping(Mat3d &stress_tensor)
     }
     return stress_tensor;
 }
+//=================================================================================================//
+Matd J2Plasticity::J2PlasticityKernel::ConstitutiveRelationShearStressWithHardening(
+    const Matd &velocity_gradient, const Matd &shear_stress, Real hardening_factor)
+{
+    Matd strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    Matd deviatoric_strain_rate = strain_rate - (1.0 / (Real)Dimensions) * strain_rate.trace() * Matd::Identity();
+    Matd spin_rate = 0.5 * (velocity_gradient - velocity_gradient.transpose());
+    Matd shear_stress_rate_elastic = 2.0 * G_ * deviatoric_strain_rate + shear_stress * (spin_rate.transpose()) + spin_rate * shear_stress;
+    Real stress_tensor_J2 = 0.5 * (shear_stress.cwiseProduct(shear_stress.transpose())).sum();
+    Real f = sqrt(2.0 * stress_tensor_J2) - sqrt_2_over_3_ * (hardening_modulus_ * hardening_factor + yield_stress_);
+    Real lambda_dot_ = 0;
+    Matd g = Matd::Zero();
+    if (f > TinyReal)
+    {
+        Real deviatoric_stress_times_strain_rate = (shear_stress.cwiseProduct(strain_rate)).sum();
+        lambda_dot_ = deviatoric_stress_times_strain_rate / (sqrt(2.0 * stress_tensor_J2) * (1.0 + hardening_modulus_ / (3.0 * G_)));
+        g = lambda_dot_ * (sqrt(2.0) * G_ * shear_stress / (sqrt(stress_tensor_J2)));
+    }
+    return shear_stress_rate_elastic - g;
+}
+//=================================================================================================//
+Matd J2Plasticity::J2PlasticityKernel::ReturnMappingShearStress(const Matd &shear_stress, Real hardening_factor)
+{
+    return ScalePenaltyForce(shear_stress, hardening_factor) * shear_stress;
+}
+//=================================================================================================//
+Real J2Plasticity::J2PlasticityKernel::ScalePenaltyForce(const Matd &shear_stress, Real hardening_factor)
+{
+    Real stress_tensor_J2 = 0.5 * (shear_stress.cwiseProduct(shear_stress.transpose())).sum();
+    Real f = sqrt(2.0 * stress_tensor_J2) - sqrt_2_over_3_ * (hardening_modulus_ * hardening_factor + yield_stress_);
+    return (f > TinyReal) ? (sqrt_2_over_3_ * (hardening_modulus_ * hardening_factor + yield_stress_)) / (sqrt(2.0 * stress_tensor_J2) + TinyReal) : 1.0;
+}
+//=================================================================================================//
+Real J2Plasticity::J2PlasticityKernel::HardeningFactorRate(const Matd &shear_stress, Real hardening_factor)
+{
+    Real stress_tensor_J2 = 0.5 * (shear_stress.cwiseProduct(shear_stress.transpose())).sum();
+    Real f = sqrt(2.0 * stress_tensor_J2) - sqrt_2_over_3_ * (hardening_modulus_ * hardening_factor + yield_stress_);
+    return (f > TinyReal) ? 0.5 * f / (G_ + hardening_modulus_ / 3.0) : 0.0;
+}
 }// namespace SPH
 #endif //GENERAL_CONTINUUM_HPP
\ No newline at end of file
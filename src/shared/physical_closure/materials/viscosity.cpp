@@ -27,12 +27,14 @@ HerschelBulkleyViscosity::HerschelBulkleyViscosity(ConstructArgs<Real, Real, Rea
 //=================================================================================================//
 Real HerschelBulkleyViscosity::getViscosity(Real shear_rate)
 {
-
-    Real effective_shear_rate = SMAX(SMIN(shear_rate, max_shear_rate_), min_shear_rate_);
-    return (yield_stress_ + consistency_index_ * (std::pow(effective_shear_rate, power_index_))) /
-           effective_shear_rate;
+    return ViscosityKernel(*this)(shear_rate);
 }
 //=================================================================================================//
+HerschelBulkleyViscosity::ViscosityKernel::ViscosityKernel(HerschelBulkleyViscosity &encloser)
+    : min_shear_rate_(encloser.min_shear_rate_), max_shear_rate_(encloser.max_shear_rate_),
+      consistency_index_(encloser.consistency_index_), power_index_(encloser.power_index_),
+      yield_stress_(encloser.yield_stress_) {}
+//=================================================================================================//
 CarreauViscosity::CarreauViscosity(Real min_shear_rate_, Real max_shear_rate_,
                                    Real characteristic_time, Real mu_infty, Real mu0, Real power_index)
     : GeneralizedNewtonianViscosity(min_shear_rate_, max_shear_rate_),
@@ -41,10 +43,12 @@ CarreauViscosity::CarreauViscosity(Real min_shear_rate_, Real max_shear_rate_,
 //=================================================================================================//
 Real CarreauViscosity::getViscosity(Real shear_rate)
 {
-    Real effective_shear_rate = SMAX(SMIN(shear_rate, max_shear_rate_), min_shear_rate_);
-    return mu_infty_ + (mu0_ - mu_infty_) *
-                           std::pow(1.0 + std::pow(characteristic_time_ * effective_shear_rate, 2),
-                                    0.5 * (power_index_ - 1.0));
+    return ViscosityKernel(*this)(shear_rate);
 }
 //=================================================================================================//
+CarreauViscosity::ViscosityKernel::ViscosityKernel(CarreauViscosity &encloser)
+    : min_shear_rate_(encloser.min_shear_rate_), max_shear_rate_(encloser.max_shear_rate_),
+      characteristic_time_(encloser.characteristic_time_), mu_infty_(encloser.mu_infty_),
+      mu0_(encloser.mu0_), power_index_(encloser.power_index_) {}
+//=================================================================================================//
 } // namespace SPH
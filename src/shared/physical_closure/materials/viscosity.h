@@ -114,6 +114,22 @@ class HerschelBulkleyViscosity : public GeneralizedNewtonianViscosity
     Real getPowerIndex() { return power_index_; };
     Real getYieldStress() { return yield_stress_; };
     Real getViscosity(Real shear_rate) override;
+
+    class ViscosityKernel
+    {
+      public:
+        explicit ViscosityKernel(HerschelBulkleyViscosity &encloser);
+        Real operator()(Real shear_rate)
+        {
+            Real effective_shear_rate = SMAX(SMIN(shear_rate, max_shear_rate_), min_shear_rate_);
+            return (yield_stress_ + consistency_index_ * math::pow(effective_shear_rate, power_index_)) /
+                   effective_shear_rate;
+        };
+
+      protected:
+        Real min_shear_rate_, max_shear_rate_;
+        Real consistency_index_, power_index_, yield_stress_;
+    };
 };
 
 /**
@@ -137,6 +153,23 @@ class CarreauViscosity : public GeneralizedNewtonianViscosity
     Real getMu0() { return mu0_; };
     Real getPowerIndex() { return power_index_; };
     Real getViscosity(Real shear_rate) override;
+
+    class ViscosityKernel
+    {
+      public:
+        explicit ViscosityKernel(CarreauViscosity &encloser);
+        Real operator()(Real shear_rate)
+        {
+            Real effective_shear_rate = SMAX(SMIN(shear_rate, max_shear_rate_), min_shear_rate_);
+            return mu_infty_ + (mu0_ - mu_infty_) *
+                                   math::pow(Real(1) + math::pow(characteristic_time_ * effective_shear_rate, 2),
+                                             Real(0.5) * (power_index_ - Real(1)));
+        };
+
+      protected:
+        Real min_shear_rate_, max_shear_rate_;
+        Real characteristic_time_, mu_infty_, mu0_, power_index_;
+    };
 };
 } // namespace SPH
 #endif // VISCOSITY_H
\ No newline at end of file
@@ -62,8 +62,9 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
         return (variable_a - variable_b).norm();
     };
 
-    /** the local constrained method used for calculating the dtw distance between two lines. */
-    StdVec<Real> calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_);
+    /** the local constrained method used for calculating the dtw distance between two lines,
+     * with the memory proportional to the length of one line. */
+    StdVec<Real> calculateDTWDistance(const BiVector<VariableType> &dataset_a_, const BiVector<VariableType> &dataset_b_);
 
   public:
     template <typename... Args>
@@ -15,7 +15,7 @@ namespace SPH
 //=================================================================================================//
 template <class ObserveMethodType>
 StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::
-    calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_)
+    calculateDTWDistance(const BiVector<VariableType> &dataset_a_, const BiVector<VariableType> &dataset_b_)
 {
     /* define the container to hold the dtw distance.*/
     StdVec<Real> dtw_distance;
@@ -32,24 +32,29 @@ StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::
             exit(1);
         }
 
-        /** create a 2D vector with [a_length, b_length] to contain the local DTW distance value. */
-        BiVector<Real> local_distance(a_length, StdVec<Real>(b_length, 0));
-        local_distance[0][0] = calculatePNorm(dataset_a_[k][0], dataset_b_[k][0]);
-        for (int i = 1; i < a_length; ++i)
-            local_distance[i][0] = local_distance[i - 1][0] +
-                                       calculatePNorm(dataset_a_[k][i], dataset_b_[k][0]);
+        /** Only two rows of the [a_length, b_length] local DTW distance matrix are kept,
+         * as each row depends on the previous one only. The entries out of the window are zero
+         * except the first column, the same as for the full matrix. */
+        StdVec<Real> previous_row(b_length, 0);
+        StdVec<Real> current_row(b_length, 0);
+        previous_row[0] = calculatePNorm(dataset_a_[k][0], dataset_b_[k][0]);
         for (int j = 1; j < b_length; ++j)
-            local_distance[0][j] = local_distance[0][j - 1] +
-                                       calculatePNorm(dataset_a_[k][0], dataset_b_[k][j]);
+            previous_row[j] = previous_row[j - 1] +
+                              calculatePNorm(dataset_a_[k][0], dataset_b_[k][j]);
 
         /** add locality constraint */
         window_size_ = SMAX(window_size_, ABS(a_length - b_length));
         for (int i = 1; i != a_length; ++i)
-            for (int j = SMAX(1, i - window_size_); j != SMIN(b_length, i + window_size_); ++j)
-                local_distance[i][j] =
+        {
+            std::fill(current_row.begin(), current_row.end(), Real(0));
+            current_row[0] = previous_row[0] + calculatePNorm(dataset_a_[k][i], dataset_b_[k][0]);
+            for (int j = SMAX(1, i - window_size_); j < SMIN(b_length, i + window_size_); ++j)
+                current_row[j] =
                     calculatePNorm(dataset_a_[k][i], dataset_b_[k][j]) +
-                    SMIN(local_distance[i - 1][j], local_distance[i][j - 1], local_distance[i - 1][j - 1]);
-        dtw_distance.push_back(local_distance[a_length - 1][b_length - 1]);
+                    SMIN(previous_row[j], current_row[j - 1], previous_row[j - 1]);
+            std::swap(previous_row, current_row);
+        }
+        dtw_distance.push_back(previous_row[b_length - 1]);
     }
     return dtw_distance;
 };
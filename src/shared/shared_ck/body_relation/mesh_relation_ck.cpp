@@ -0,0 +1,96 @@
+#include "mesh_relation_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class DataType, class InitializationFunction>
+DiscreteVariable<DataType> *Inner<UnstructuredMesh>::addRelationVariable(
+    const std::string &name, size_t data_size, const InitializationFunction &initialization)
+{
+    return relation_variable_ptrs_.createPtr<DiscreteVariable<DataType>>(name, data_size, initialization);
+}
+//=================================================================================================//
+Inner<UnstructuredMesh>::Inner(InnerRelationInFVM &fvm_inner_relation)
+    : RelationBase(*fvm_inner_relation.real_body_), real_body_(*fvm_inner_relation.real_body_),
+      particles_(real_body_.getBaseParticles()), number_of_faces_(0)
+{
+    fvm_inner_relation.updateConfiguration();
+    ParticleConfiguration &configuration = fvm_inner_relation.inner_configuration_;
+    UnsignedInt total_real_particles = particles_.TotalRealParticles();
+
+    StdVec<UnsignedInt> particle_offset(particles_.ParticlesBound() + 1, 0);
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        particle_offset[i + 1] = particle_offset[i] + configuration[i].current_size_;
+    }
+    for (UnsignedInt i = total_real_particles; i != particles_.ParticlesBound(); ++i)
+    {
+        particle_offset[i + 1] = particle_offset[i];
+    }
+    number_of_faces_ = particle_offset[total_real_particles];
+
+    StdVec<UnsignedInt> neighbor_index(number_of_faces_);
+    StdVec<Vecd> face_normal(number_of_faces_);
+    StdVec<Real> face_dW(number_of_faces_);
+    StdVec<Real> face_distance(number_of_faces_);
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        Neighborhood &neighborhood = configuration[i];
+        for (UnsignedInt k = 0; k != neighborhood.current_size_; ++k)
+        {
+            UnsignedInt n = particle_offset[i] + k;
+            neighbor_index[n] = neighborhood.j_[k];
+            face_normal[n] = neighborhood.e_ij_[k];
+            face_dW[n] = neighborhood.dW_ij_[k];
+            face_distance[n] = neighborhood.r_ij_[k];
+        }
+    }
+
+    std::string name = real_body_.getName() + "Mesh";
+    dv_particle_offset_ = addRelationVariable<UnsignedInt>(
+        name + "ParticleOffset", particle_offset.size(),
+        [&](UnsignedInt index)
+        { return particle_offset[index]; });
+    // one more entry as the lists may be empty
+    dv_neighbor_index_ = addRelationVariable<UnsignedInt>(
+        name + "NeighborIndex", number_of_faces_ + 1,
+        [&](UnsignedInt index)
+        { return index < number_of_faces_ ? neighbor_index[index] : 0; });
+    dv_face_normal_ = addRelationVariable<Vecd>(
+        name + "FaceNormal", number_of_faces_ + 1,
+        [&](UnsignedInt index)
+        { return index < number_of_faces_ ? face_normal[index] : Vecd::Zero(); });
+    dv_face_dW_ = addRelationVariable<Real>(
+        name + "FaceKernelGradient", number_of_faces_ + 1,
+        [&](UnsignedInt index)
+        { return index < number_of_faces_ ? face_dW[index] : Real(0); });
+    dv_face_distance_ = addRelationVariable<Real>(
+        name + "FaceDistance", number_of_faces_ + 1,
+        [&](UnsignedInt index)
+        { return index < number_of_faces_ ? face_distance[index] : Real(0); });
+}
+//=================================================================================================//
+void Inner<UnstructuredMesh>::registerComputingKernel(execution::Implementation<Base> *implementation)
+{
+    registered_computing_kernels_.push_back(implementation);
+}
+//=================================================================================================//
+void Inner<UnstructuredMesh>::resetComputingKernelUpdated()
+{
+    for (size_t k = 0; k != registered_computing_kernels_.size(); ++k)
+    {
+        registered_computing_kernels_[k]->resetUpdated();
+    }
+}
+//=================================================================================================//
+MemoryUsage Inner<UnstructuredMesh>::getMemoryUsage()
+{
+    MemoryUsage memory_usage = dv_particle_offset_->getMemoryUsage();
+    memory_usage += dv_neighbor_index_->getMemoryUsage();
+    memory_usage += dv_face_normal_->getMemoryUsage();
+    memory_usage += dv_face_dW_->getMemoryUsage();
+    memory_usage += dv_face_distance_->getMemoryUsage();
+    return memory_usage;
+}
+//=================================================================================================//
+} // namespace SPH
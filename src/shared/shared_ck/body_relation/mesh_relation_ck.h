@@ -0,0 +1,120 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file mesh_relation_ck.h
+ * @brief The inner relation of the cells of an unstructured mesh for computing kernels.
+ * @details The connectivity of an unstructured mesh never changes.
+ * Therefore, the neighbor lists and the face geometry are stored once
+ * in compressed rows, i.e. the same particle offset and neighbor index lists
+ * as for the particle relations, and are not updated during the simulation.
+ * @author Xiangyu Hu
+ */
+
+#ifndef MESH_RELATION_CK_H
+#define MESH_RELATION_CK_H
+
+#include "relation_ck.hpp"
+#include "unstructured_mesh.h"
+
+namespace SPH
+{
+template <>
+class Inner<UnstructuredMesh> : public RelationBase
+{
+    UniquePtrsKeeper<Entity> relation_variable_ptrs_;
+
+    template <class DataType, class InitializationFunction>
+    DiscreteVariable<DataType> *addRelationVariable(
+        const std::string &name, size_t data_size, const InitializationFunction &initialization);
+
+  public:
+    typedef RealBody SourceType;
+    typedef Inner<UnstructuredMesh> NeighborhoodType;
+    /** The face geometry is taken from the host relation once for all. */
+    explicit Inner(InnerRelationInFVM &fvm_inner_relation);
+    virtual ~Inner() {};
+    RealBody &getDynamicsIdentifier() { return real_body_; };
+    SPHBody &getSPHBody() { return real_body_; };
+    Inner<UnstructuredMesh> &getNeighborhood() { return *this; };
+    UnsignedInt NumberOfFaces() { return number_of_faces_; };
+    DiscreteVariable<UnsignedInt> *dvNeighborIndex() { return dv_neighbor_index_; };
+    DiscreteVariable<UnsignedInt> *dvParticleOffset() { return dv_particle_offset_; };
+    bool isSlicedEllLayout() { return false; };
+    DiscreteVariable<Vecd> *dvFaceNormal() { return dv_face_normal_; };
+    DiscreteVariable<Real> *dvFaceKernelGradient() { return dv_face_dW_; };
+    DiscreteVariable<Real> *dvFaceDistance() { return dv_face_distance_; };
+    void registerComputingKernel(execution::Implementation<Base> *implementation);
+    void resetComputingKernelUpdated();
+    virtual MemoryUsage getMemoryUsage() override;
+
+    class NeighborList
+    {
+      public:
+        template <class ExecutionPolicy>
+        NeighborList(const ExecutionPolicy &ex_policy, Inner<UnstructuredMesh> &encloser)
+            : neighbor_index_(encloser.dv_neighbor_index_->DelegatedData(ex_policy)),
+              particle_offset_(encloser.dv_particle_offset_->DelegatedData(ex_policy)){};
+
+      protected:
+        UnsignedInt *neighbor_index_;
+        UnsignedInt *particle_offset_;
+        static constexpr UnsignedInt neighbor_stride_ = 1;
+        inline UnsignedInt FirstNeighbor(UnsignedInt i) { return particle_offset_[i]; };
+        inline UnsignedInt LastNeighbor(UnsignedInt i) { return particle_offset_[i + 1]; };
+        template <typename... DataTypes>
+        inline void prefetchNeighbor(UnsignedInt i, UnsignedInt n, const DataTypes *...data){};
+    };
+
+    /** The face quantities are addressed by the neighbor index n, not by the particle pair. */
+    class NeighborKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        NeighborKernel(const ExecutionPolicy &ex_policy, Inner<UnstructuredMesh> &encloser)
+            : face_normal_(encloser.dv_face_normal_->DelegatedData(ex_policy)),
+              face_dW_(encloser.dv_face_dW_->DelegatedData(ex_policy)),
+              face_distance_(encloser.dv_face_distance_->DelegatedData(ex_policy)){};
+
+        inline Vecd e_ij(UnsignedInt n) const { return face_normal_[n]; };
+        inline Real dW_ij(UnsignedInt n) const { return face_dW_[n]; };
+        inline Real r_ij(UnsignedInt n) const { return face_distance_[n]; };
+
+      protected:
+        Vecd *face_normal_;
+        Real *face_dW_;
+        Real *face_distance_;
+    };
+
+  protected:
+    RealBody &real_body_;
+    BaseParticles &particles_;
+    UnsignedInt number_of_faces_;
+    DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+    DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
+    DiscreteVariable<Vecd> *dv_face_normal_;
+    DiscreteVariable<Real> *dv_face_dW_;
+    DiscreteVariable<Real> *dv_face_distance_;
+    StdVec<execution::Implementation<Base> *> registered_computing_kernels_;
+};
+} // namespace SPH
+#endif // MESH_RELATION_CK_H
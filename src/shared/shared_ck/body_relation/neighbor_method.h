@@ -30,7 +30,9 @@
 #define NEIGHBOR_METHOD_H
 
 #include "adaptation.h"
-#include "kernel_tabulated_ck.h"
+#include "base_particles.hpp"
+#include "kernel_analytic_ck.hpp"
+#include "periodic_image.h"
 #include "sphinxsys_containers.h"
 
 namespace SPH
@@ -75,14 +77,14 @@ class NeighborMethod<SPHAdaptation, SPHAdaptation> : public NeighborMethod<Base>
         return base_kernel_->KernelSize() / inv_h_;
     }
 
-    class SmoothingKernel : public KernelTabulatedCK
+    class SmoothingKernel : public SmoothingKernelCK
     {
         Real inv_h_, inv_h_squared_, inv_h_cubed_, inv_h_fourth_, inv_h_fifth_;
 
       public:
         template <class ExecutionPolicy, class EncloserType>
         SmoothingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
-            : KernelTabulatedCK(*encloser.base_kernel_),
+            : SmoothingKernelCK(*encloser.base_kernel_),
               inv_h_(encloser.inv_h_), inv_h_squared_(inv_h_ * inv_h_),
               inv_h_cubed_(inv_h_squared_ * inv_h_), inv_h_fourth_(inv_h_cubed_ * inv_h_),
               inv_h_fifth_(inv_h_fourth_ * inv_h_){};
@@ -116,19 +118,28 @@ class NeighborMethod<SPHAdaptation, SPHAdaptation> : public NeighborMethod<Base>
         Vecd *source_pos_;
         Vecd *target_pos_;
         Real kernel_size_squared_, inv_h_;
+        PeriodicImage periodic_image_;
+        bool is_periodic_;
 
       public:
         template <class ExecutionPolicy, class EncloserType>
         NeighborCriterion(const ExecutionPolicy &ex_policy, EncloserType &encloser,
-                          DiscreteVariable<Vecd> *dv_source_pos, DiscreteVariable<Vecd> *dv_target_pos)
+                          DiscreteVariable<Vecd> *dv_source_pos, DiscreteVariable<Vecd> *dv_target_pos,
+                          const PeriodicImage &periodic_image = PeriodicImage())
             : source_pos_(dv_source_pos->DelegatedData(ex_policy)),
               target_pos_(dv_target_pos->DelegatedData(ex_policy)),
               kernel_size_squared_(math::pow(encloser.base_kernel_->KernelSize(), 2)),
-              inv_h_(encloser.inv_h_) {}
+              inv_h_(encloser.inv_h_), periodic_image_(periodic_image),
+              is_periodic_(periodic_image.isPeriodic()) {}
 
         inline bool operator()(UnsignedInt i, UnsignedInt j) const
         {
-            return (inv_h_ * (source_pos_[i] - target_pos_[j])).squaredNorm() < kernel_size_squared_;
+            Vecd displacement = source_pos_[i] - target_pos_[j];
+            if (is_periodic_)
+            {
+                displacement = periodic_image_.minimumImage(displacement);
+            }
+            return (inv_h_ * displacement).squaredNorm() < kernel_size_squared_;
         };
     };
 
@@ -168,5 +179,105 @@ class NeighborMethod<SPHAdaptation, SPHAdaptation> : public NeighborMethod<Base>
     int search_depth_;
     BoundingBoxi search_box_; /**< Search depth for neighbor search. */
 };
+
+/**
+ * @class NeighborMethod<AdaptiveSmoothingLength, SPHAdaptation>
+ * @brief Neighbor method for a source with variable smoothing length.
+ * @details The pair cutoff radius is given by the smaller smoothing length ratio of the pair,
+ * as for the host adaptive neighbor builder, so that the neighbor criterion is symmetric.
+ * The search box of each source particle is computed from its own smoothing length
+ * and the coarsest smoothing length of the target, instead of the reference one of the source.
+ * The kernel values are still evaluated with the reference smoothing length.
+ */
+template <>
+class NeighborMethod<AdaptiveSmoothingLength, SPHAdaptation> : public NeighborMethod<SPHAdaptation, SPHAdaptation>
+{
+  public:
+    template <typename SourceIdentifier, typename TargetIdentifier>
+    NeighborMethod(SourceIdentifier &source_identifier, TargetIdentifier &target_identifier)
+        : NeighborMethod<SPHAdaptation, SPHAdaptation>(source_identifier, target_identifier),
+          h_source_ref_(source_identifier.getSPHAdaptation().ReferenceSmoothingLength()),
+          h_target_ref_(target_identifier.getSPHAdaptation().ReferenceSmoothingLength()),
+          relative_h_ref_(h_source_ref_ / h_target_ref_),
+          dv_source_h_ratio_(source_identifier.getSPHBody().getBaseParticles().template getVariableByName<Real>("SmoothingLengthRatio")),
+          dv_target_h_ratio_(findVariableByName<Real>(
+              target_identifier.getSPHBody().getBaseParticles().EvolvingVariables(), "SmoothingLengthRatio")) {}
+
+    class NeighborCriterion
+    {
+        Vecd *source_pos_;
+        Vecd *target_pos_;
+        Real *source_h_ratio_;
+        Real *target_h_ratio_; /**< nullptr for a target with uniform smoothing length */
+        Real kernel_size_squared_, inv_h_ref_, relative_h_ref_;
+        PeriodicImage periodic_image_;
+        bool is_periodic_;
+
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        NeighborCriterion(const ExecutionPolicy &ex_policy, EncloserType &encloser,
+                          DiscreteVariable<Vecd> *dv_source_pos, DiscreteVariable<Vecd> *dv_target_pos,
+                          const PeriodicImage &periodic_image = PeriodicImage())
+            : source_pos_(dv_source_pos->DelegatedData(ex_policy)),
+              target_pos_(dv_target_pos->DelegatedData(ex_policy)),
+              source_h_ratio_(encloser.dv_source_h_ratio_->DelegatedData(ex_policy)),
+              target_h_ratio_(encloser.dv_target_h_ratio_ != nullptr
+                                  ? encloser.dv_target_h_ratio_->DelegatedData(ex_policy)
+                                  : nullptr),
+              kernel_size_squared_(math::pow(encloser.base_kernel_->KernelSize(), 2)),
+              inv_h_ref_(1.0 / encloser.h_source_ref_), relative_h_ref_(encloser.relative_h_ref_),
+              periodic_image_(periodic_image), is_periodic_(periodic_image.isPeriodic()) {}
+
+        inline bool operator()(UnsignedInt i, UnsignedInt j) const
+        {
+            Vecd displacement = source_pos_[i] - target_pos_[j];
+            if (is_periodic_)
+            {
+                displacement = periodic_image_.minimumImage(displacement);
+            }
+            Real target_h_ratio = target_h_ratio_ != nullptr ? target_h_ratio_[j] : Real(1);
+            Real h_ratio_min = SMIN(source_h_ratio_[i], relative_h_ref_ * target_h_ratio);
+            return (inv_h_ref_ * h_ratio_min * displacement).squaredNorm() < kernel_size_squared_;
+        };
+    };
+
+    class SmoothingRatio
+    {
+        Real *h_ratio_;
+
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        SmoothingRatio(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : h_ratio_(encloser.dv_source_h_ratio_->DelegatedData(ex_policy)){};
+
+        inline Real operator()(UnsignedInt i) const { return h_ratio_[i]; };
+    };
+
+    /** The target cells are not finer than the coarsest target smoothing length. */
+    class SearchBox
+    {
+        Real *h_ratio_;
+        Real h_source_ref_, h_target_ref_, inv_h_target_ref_;
+
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        SearchBox(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : h_ratio_(encloser.dv_source_h_ratio_->DelegatedData(ex_policy)),
+              h_source_ref_(encloser.h_source_ref_), h_target_ref_(encloser.h_target_ref_),
+              inv_h_target_ref_(1.0 / h_target_ref_){};
+
+        inline BoundingBoxi operator()(UnsignedInt i) const
+        {
+            Real h_i = SMAX(h_source_ref_ / h_ratio_[i], h_target_ref_);
+            int search_depth = static_cast<int>(math::ceil((h_i - Eps) * inv_h_target_ref_));
+            return BoundingBoxi(Arrayi::Constant(search_depth));
+        };
+    };
+
+  protected:
+    Real h_source_ref_, h_target_ref_, relative_h_ref_;
+    DiscreteVariable<Real> *dv_source_h_ratio_;
+    DiscreteVariable<Real> *dv_target_h_ratio_;
+};
 } // namespace SPH
 #endif // NEIGHBOR_METHOD_H
@@ -43,7 +43,8 @@ class Neighbor : public NeighborMethodType
     Neighbor(SourceIdentifier &source_identifier, TargetIdentifier &contact_identifier,
              DiscreteVariable<Vecd> *dv_source_pos, DiscreteVariable<Vecd> *dv_target_pos)
         : NeighborMethodType(source_identifier, contact_identifier),
-          dv_source_pos_(dv_source_pos), dv_target_pos_(dv_target_pos){};
+          dv_source_pos_(dv_source_pos), dv_target_pos_(dv_target_pos),
+          periodic_image_(&contact_identifier.getSPHBody().getPeriodicImage()){};
 
     class NeighborKernel : public NeighborMethodType::SmoothingKernel
     {
@@ -54,9 +55,15 @@ class Neighbor : public NeighborMethodType
         NeighborKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
             : BaseKernel(ex_policy, encloser),
               source_pos_(encloser.dv_source_pos_->DelegatedData(ex_policy)),
-              target_pos_(encloser.dv_target_pos_->DelegatedData(ex_policy)){};
+              target_pos_(encloser.dv_target_pos_->DelegatedData(ex_policy)),
+              periodic_image_(*encloser.periodic_image_),
+              is_periodic_(periodic_image_.isPeriodic()){};
 
-        inline Vecd vec_r_ij(UnsignedInt i, UnsignedInt j) const { return source_pos_[i] - target_pos_[j]; };
+        inline Vecd vec_r_ij(UnsignedInt i, UnsignedInt j) const
+        {
+            Vecd displacement = source_pos_[i] - target_pos_[j];
+            return is_periodic_ ? periodic_image_.minimumImage(displacement) : displacement;
+        };
         inline Vecd e_ij(UnsignedInt i, UnsignedInt j) const { return vec_r_ij(i, j).normalized(); };
         inline Real W_ij(UnsignedInt i, UnsignedInt j) const { return BaseKernel::W(vec_r_ij(i, j)); };
         inline Real dW_ij(UnsignedInt i, UnsignedInt j) const { return BaseKernel::dW(vec_r_ij(i, j)); };
@@ -64,6 +71,8 @@ class Neighbor : public NeighborMethodType
       protected:
         Vecd *source_pos_;
         Vecd *target_pos_;
+        PeriodicImage periodic_image_;
+        bool is_periodic_;
     };
 
     class NeighborCriterion : public NeighborMethodType::NeighborCriterion
@@ -73,7 +82,8 @@ class Neighbor : public NeighborMethodType
       public:
         template <class ExecutionPolicy, class EncloserType>
         NeighborCriterion(const ExecutionPolicy &ex_policy, EncloserType &encloser)
-            : BaseKernel(ex_policy, encloser, encloser.dv_source_pos_, encloser.dv_target_pos_){};
+            : BaseKernel(ex_policy, encloser, encloser.dv_source_pos_, encloser.dv_target_pos_,
+                         *encloser.periodic_image_){};
 
         inline bool operator()(UnsignedInt target_index, UnsignedInt source_index) const
         {
@@ -84,6 +94,7 @@ class Neighbor : public NeighborMethodType
   protected:
     DiscreteVariable<Vecd> *dv_source_pos_;
     DiscreteVariable<Vecd> *dv_target_pos_;
+    PeriodicImage *periodic_image_;
 };
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_H
\ No newline at end of file
@@ -35,21 +35,68 @@
 #include "neighbor_method.h"
 #include "neighborhood_ck.h"
 
+#include <tbb/task_group.h>
+
 namespace SPH
 {
 enum class ConfigType
 {
     Eulerian,
     Lagrangian,
+    Static, /**< particles never move, neighbor lists and pair geometry built once */
 };
 
+/** The number of consecutive particles whose neighbor lists are interleaved in the sliced ELLPACK layout. */
+constexpr UnsignedInt EllSliceWidth = 32;
+
+/** Hint the host to load the data into the cache for reading, no effect on device. */
+inline void prefetchForRead(const void *address)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__SYCL_DEVICE_ONLY__)
+    __builtin_prefetch(address, 0, 3);
+#endif
+}
+
 template <typename...>
 class Relation;
 
 class RelationBase
 {
   public:
-    virtual ~RelationBase() {};
+    explicit RelationBase(SPHBody &sph_body) : relation_body_(sph_body)
+    {
+        relation_body_.getBodyRelationsCK().push_back(this);
+    };
+    virtual ~RelationBase()
+    {
+        waitForPendingUpdate();
+        StdVec<RelationBase *> &relations = relation_body_.getBodyRelationsCK();
+        relations.erase(std::remove(relations.begin(), relations.end(), this), relations.end());
+    };
+    /** Host and device bytes of the neighbor lists owned by the relation. */
+    virtual MemoryUsage getMemoryUsage() = 0;
+    /** Run the update of the neighbor lists on a separate task, after the previous one is finished. */
+    template <class UpdateFunction>
+    void runPendingUpdate(const UpdateFunction &update_function)
+    {
+        waitForPendingUpdate();
+        has_pending_update_ = true;
+        pending_update_.run(update_function);
+    };
+    /** Called by the interactions before they use the neighbor lists. */
+    void waitForPendingUpdate()
+    {
+        if (has_pending_update_)
+        {
+            pending_update_.wait();
+            has_pending_update_ = false;
+        }
+    };
+
+  protected:
+    SPHBody &relation_body_;
+    tbb::task_group pending_update_;
+    bool has_pending_update_ = false;
 };
 
 template <typename... AdaptationParameters>
@@ -62,6 +109,14 @@ class Relation<NeighborMethod<AdaptationParameters...>> : public RelationBase
 
     template <class DataType>
     DiscreteVariable<DataType> *addRelationVariable(const std::string &name, size_t data_size);
+    std::string TargetRelationName(UnsignedInt target_index);
+    template <class ExecutionPolicy, class DataType>
+    void writeVariableToBinary(const ExecutionPolicy &ex_policy, std::ofstream &out_file,
+                               DiscreteVariable<DataType> *variable);
+    /** return false if the data are inconsistent, reallocated is set if kernels should be updated. */
+    template <class ExecutionPolicy, class DataType>
+    bool readVariableFromBinary(const ExecutionPolicy &ex_policy, std::ifstream &in_file,
+                                DiscreteVariable<DataType> *variable, bool &reallocated);
 
   public:
     typedef Neighbor<NeighborMethodType> NeighborhoodType;
@@ -75,9 +130,95 @@ class Relation<NeighborMethod<AdaptationParameters...>> : public RelationBase
     DiscreteVariable<Vecd> *dvTargetPosition(UnsignedInt target_index = 0) { return dv_target_pos_[target_index]; };
     DiscreteVariable<UnsignedInt> *dvNeighborIndex(UnsignedInt target_index = 0) { return dv_target_neighbor_index_[target_index]; };
     DiscreteVariable<UnsignedInt> *dvParticleOffset(UnsignedInt target_index = 0) { return dv_target_particle_offset_[target_index]; };
+    /**
+     * Use the sliced ELLPACK layout for the neighbor lists, in which the n-th neighbors of EllSliceWidth
+     * consecutive particles are stored contiguously so that the device accesses are coalesced.
+     * Each slice is padded to its largest neighbor size, so it is meant for nearly uniform neighbor sizes.
+     * The layout should be chosen before the relation is first updated.
+     */
+    void useSlicedEllLayout();
+    bool isSlicedEllLayout() { return !dv_target_neighbor_end_.empty(); };
+    UnsignedInt NeighborStride() { return isSlicedEllLayout() ? EllSliceWidth : 1; };
+    UnsignedInt NumberOfSlices() { return (offset_list_size_ + EllSliceWidth - 2) / EllSliceWidth; };
+    /** The end of each neighbor list in the sliced ELLPACK layout, nullptr for the compressed rows. */
+    DiscreteVariable<UnsignedInt> *dvNeighborEnd(UnsignedInt target_index = 0)
+    {
+        return isSlicedEllLayout() ? dv_target_neighbor_end_[target_index] : nullptr;
+    };
+    DiscreteVariable<UnsignedInt> *dvSliceOffset(UnsignedInt target_index = 0)
+    {
+        return isSlicedEllLayout() ? dv_target_slice_offset_[target_index] : nullptr;
+    };
     Neighbor<NeighborMethodType> &getNeighborhood(UnsignedInt target_index = 0) { return *neighborhoods_[target_index]; }
+    /**
+     * The host interaction kernels prefetch the neighbor data by the given number of neighbors ahead,
+     * as the hardware prefetchers do not follow the neighbor indices. Zero, as by default, for no prefetching.
+     */
+    void setNeighborPrefetchDistance(UnsignedInt distance);
+    UnsignedInt NeighborPrefetchDistance() { return neighbor_prefetch_distance_; };
+    /**
+     * The interactions with a cooperative kernel loop the neighbor list of each particle by a sub-group
+     * on device, if the mean neighbor size, recorded at the update of the relation, reaches the threshold.
+     * It is meant for large neighbor lists, e.g. in 3D, for which one work item per particle diverges.
+     */
+    void setCooperativeNeighborThreshold(Real threshold) { cooperative_neighbor_threshold_ = threshold; };
+    void setMeanNeighborSize(UnsignedInt target_index, Real mean_neighbor_size)
+    {
+        if (mean_neighbor_size_.size() <= target_index)
+            mean_neighbor_size_.resize(target_index + 1, 0);
+        mean_neighbor_size_[target_index] = mean_neighbor_size;
+    };
+    bool isCooperative(UnsignedInt target_index = 0)
+    {
+        return target_index < mean_neighbor_size_.size() &&
+               mean_neighbor_size_[target_index] >= cooperative_neighbor_threshold_;
+    };
     void registerComputingKernel(execution::Implementation<Base> *implementation, UnsignedInt target_index = 0);
     void resetComputingKernelUpdated(UnsignedInt target_index = 0);
+    virtual MemoryUsage getMemoryUsage() override;
+    /**
+     * For the static configuration, the relation is updated only once and later updates are skipped.
+     * The pair geometry, together with the kernel value, is cached when the relation is constructed.
+     * Note that the particles should not be sorted afterwards.
+     */
+    bool isStatic() { return config_type_ == ConfigType::Static; };
+    /**
+     * For a Lagrangian relation, the neighbor lists and the pair geometry are evaluated
+     * with the reference positions, and so are fixed after the first update.
+     * This caches the reference pair geometry and the kernel values, and the later updates are skipped.
+     */
+    void cacheReferenceGeometry();
+    bool isConfigurationFixed() { return isStatic() || is_reference_geometry_cached_; };
+    bool isKernelValueCached() { return isConfigurationFixed(); };
+    bool isFixedConfigured() { return is_fixed_configured_; };
+    void setConfigured() { is_fixed_configured_ = isConfigurationFixed(); };
+    /**
+     * Cache the pair direction, distance and kernel gradient for all neighbor pairs.
+     * The cache is filled by the relation update and is valid for the kernels
+     * executed before the positions change, which then read the cache instead of recomputing.
+     */
+    void cachePairGeometry();
+    bool isPairGeometryCached() { return !dv_pair_e_ij_.empty(); };
+    /**
+     * Write the neighbor lists, together with the sliced ELLPACK offsets and the cached pair geometry
+     * if used, so that a restart does not need to rebuild the cell linked list and the relation.
+     */
+    template <class ExecutionPolicy>
+    void writeNeighborListsToBinary(const ExecutionPolicy &ex_policy, std::ofstream &out_file);
+    /** Restore the neighbor lists only if the particle number and the layout match, return whether restored. */
+    template <class ExecutionPolicy>
+    bool readNeighborListsFromBinary(const ExecutionPolicy &ex_policy, std::ifstream &in_file);
+    /** Grow the cache with the neighbor index list, return whether reallocated. */
+    template <class ExecutionPolicy>
+    bool resizePairGeometry(const ExecutionPolicy &ex_policy, UnsignedInt target_index = 0);
+    DiscreteVariable<Vecd> *dvPairDirection(UnsignedInt target_index = 0) { return dv_pair_e_ij_[target_index]; };
+    DiscreteVariable<Real> *dvPairDistance(UnsignedInt target_index = 0) { return dv_pair_r_ij_[target_index]; };
+    DiscreteVariable<Real> *dvPairKernelGradient(UnsignedInt target_index = 0) { return dv_pair_dW_ij_[target_index]; };
+    /** The pair kernel values are cached only for fixed configurations, nullptr otherwise. */
+    DiscreteVariable<Real> *dvPairKernelValue(UnsignedInt target_index = 0)
+    {
+        return dv_pair_W_ij_.empty() ? nullptr : dv_pair_W_ij_[target_index];
+    };
 
     class NeighborList
     {
@@ -89,11 +230,43 @@ class Relation<NeighborMethod<AdaptationParameters...>> : public RelationBase
       protected:
         UnsignedInt *neighbor_index_;
         UnsignedInt *particle_offset_;
+        UnsignedInt *neighbor_end_; /**< shifted particle offsets for the compressed rows */
+        UnsignedInt neighbor_stride_;
+        UnsignedInt prefetch_distance_; /**< zero on device or if not prefetched */
         inline UnsignedInt FirstNeighbor(UnsignedInt i) { return particle_offset_[i]; };
-        inline UnsignedInt LastNeighbor(UnsignedInt i) { return particle_offset_[i + 1]; };
+        inline UnsignedInt LastNeighbor(UnsignedInt i) { return neighbor_end_[i]; };
+        /** Prefetch the data arrays declared by a kernel for the neighbor ahead of the neighbor n. */
+        template <typename... DataTypes>
+        inline void prefetchNeighbor(UnsignedInt i, UnsignedInt n, const DataTypes *...data)
+        {
+            UnsignedInt ahead = n + prefetch_distance_ * neighbor_stride_;
+            if (prefetch_distance_ != 0 && ahead < neighbor_end_[i])
+            {
+                UnsignedInt index_j = neighbor_index_[ahead];
+                (prefetchForRead(data + index_j), ...);
+            }
+        };
+    };
+
+    /** The cached pair geometry addressed by the neighbor index n, nullptr if not cached. */
+    class PairGeometry
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        PairGeometry(const ExecutionPolicy &ex_policy, EncloserType &encloser,
+                     UnsignedInt target_index = 0);
+
+      protected:
+        Vecd *pair_e_ij_;
+        Real *pair_r_ij_;
+        Real *pair_dW_ij_;
+        Real *pair_W_ij_;
     };
 
   protected:
+    ConfigType config_type_;
+    bool is_reference_geometry_cached_;
+    bool is_fixed_configured_;
     SPHBody *sph_body_;
     BaseParticles *particles_;
     DiscreteVariable<Vecd> *dv_source_pos_;
@@ -102,8 +275,17 @@ class Relation<NeighborMethod<AdaptationParameters...>> : public RelationBase
     UnsignedInt offset_list_size_;
     StdVec<DiscreteVariable<UnsignedInt> *> dv_target_neighbor_index_;
     StdVec<DiscreteVariable<UnsignedInt> *> dv_target_particle_offset_;
+    StdVec<DiscreteVariable<UnsignedInt> *> dv_target_neighbor_end_;
+    StdVec<DiscreteVariable<UnsignedInt> *> dv_target_slice_offset_;
+    StdVec<DiscreteVariable<Vecd> *> dv_pair_e_ij_;
+    StdVec<DiscreteVariable<Real> *> dv_pair_r_ij_;
+    StdVec<DiscreteVariable<Real> *> dv_pair_dW_ij_;
+    StdVec<DiscreteVariable<Real> *> dv_pair_W_ij_;
     StdVec<Neighbor<NeighborMethodType> *> neighborhoods_;
     StdVec<StdVec<execution::Implementation<Base> *>> registered_computing_kernels_;
+    UnsignedInt neighbor_prefetch_distance_ = 0;
+    Real cooperative_neighbor_threshold_ = MaxReal;
+    StdVec<Real> mean_neighbor_size_;
 };
 
 template <typename DynamicsIdentifier, typename... AdaptationParameters>
@@ -153,8 +335,16 @@ class Contact<SourceIdentifier, TargetIdentifier, NeighborMethod<AdaptationParam
     BaseParticles &getContactParticles(UnsignedInt target_index) { return *contact_particles_[target_index]; };
     SPHAdaptation &getContactAdaptation(UnsignedInt target_index) { return *contact_adaptations_[target_index]; };
     TargetIdentifier &getContactIdentifier(UnsignedInt target_index) { return *contact_identifiers_[target_index]; };
+    /**
+     * The interactions and the relation update on all contact targets are executed in one kernel launch,
+     * in which each source particle loops over the targets, so that the launches do not grow with
+     * the number of the contact bodies. It is meant for many contact bodies on device.
+     */
+    void fuseContactTargets() { is_targets_fused_ = true; };
+    bool isTargetsFused() { return is_targets_fused_; };
 
   protected:
+    bool is_targets_fused_ = false;
     SourceIdentifier *source_identifier_;
     StdVec<SPHBody *> contact_bodies_;
     StdVec<BaseParticles *> contact_particles_;
@@ -10,7 +10,8 @@ template <typename... AdaptationParameters>
 template <class SourceIdentifier, class TargetIdentifier>
 Relation<NeighborMethod<AdaptationParameters...>>::Relation(
     SourceIdentifier &source_identifier, StdVec<TargetIdentifier *> contact_identifiers, ConfigType config_type)
-    : sph_body_(&source_identifier.getSPHBody()),
+    : RelationBase(source_identifier.getSPHBody()), config_type_(config_type),
+      is_reference_geometry_cached_(false), is_fixed_configured_(false), sph_body_(&source_identifier.getSPHBody()),
       particles_(&sph_body_->getBaseParticles()),
       dv_source_pos_(this->assignConfigPosition(*particles_, config_type)),
       dv_neighbor_size_(addRelationVariable<UnsignedInt>(
@@ -36,13 +37,18 @@ Relation<NeighborMethod<AdaptationParameters...>>::Relation(
                 source_identifier, *contact_identifiers[k], dv_source_pos_, dv_target_pos_.back()));
     }
     registered_computing_kernels_.resize(contact_identifiers.size());
+
+    if (isStatic())
+    {
+        cachePairGeometry();
+    }
 }
 //=================================================================================================//
 template <typename... AdaptationParameters>
 DiscreteVariable<Vecd> *Relation<NeighborMethod<AdaptationParameters...>>::
     assignConfigPosition(BaseParticles &particles, ConfigType config_type)
 {
-    if (config_type == ConfigType::Eulerian)
+    if (config_type != ConfigType::Lagrangian)
     {
         return particles.getVariableByName<Vecd>("Position");
     }
@@ -62,6 +68,30 @@ DiscreteVariable<DataType> *Relation<NeighborMethod<AdaptationParameters...>>::
 }
 //=================================================================================================//
 template <typename... AdaptationParameters>
+std::string Relation<NeighborMethod<AdaptationParameters...>>::TargetRelationName(UnsignedInt target_index)
+{
+    std::string neighbor_index_name = dv_target_neighbor_index_[target_index]->Name();
+    return neighbor_index_name.substr(0, neighbor_index_name.size() - std::string("NeighborIndex").size());
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+void Relation<NeighborMethod<AdaptationParameters...>>::useSlicedEllLayout()
+{
+    if (isSlicedEllLayout())
+        return;
+
+    for (size_t k = 0; k != dv_target_neighbor_index_.size(); ++k)
+    {
+        std::string name = TargetRelationName(k);
+        dv_target_neighbor_end_.push_back(addRelationVariable<UnsignedInt>(
+            name + "NeighborEnd", offset_list_size_));
+        dv_target_slice_offset_.push_back(addRelationVariable<UnsignedInt>(
+            name + "SliceOffset", NumberOfSlices() + 1));
+        resetComputingKernelUpdated(k);
+    }
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
 void Relation<NeighborMethod<AdaptationParameters...>>::registerComputingKernel(
     execution::Implementation<Base> *implementation, UnsignedInt target_index)
 {
@@ -69,6 +99,92 @@ void Relation<NeighborMethod<AdaptationParameters...>>::registerComputingKernel(
 }
 //=================================================================================================//
 template <typename... AdaptationParameters>
+MemoryUsage Relation<NeighborMethod<AdaptationParameters...>>::getMemoryUsage()
+{
+    MemoryUsage memory_usage = dv_neighbor_size_->getMemoryUsage();
+    for (size_t k = 0; k != dv_target_neighbor_index_.size(); ++k)
+    {
+        memory_usage += dv_target_neighbor_index_[k]->getMemoryUsage();
+        memory_usage += dv_target_particle_offset_[k]->getMemoryUsage();
+    }
+    for (size_t k = 0; k != dv_target_neighbor_end_.size(); ++k)
+    {
+        memory_usage += dv_target_neighbor_end_[k]->getMemoryUsage();
+        memory_usage += dv_target_slice_offset_[k]->getMemoryUsage();
+    }
+    for (size_t k = 0; k != dv_pair_e_ij_.size(); ++k)
+    {
+        memory_usage += dv_pair_e_ij_[k]->getMemoryUsage();
+        memory_usage += dv_pair_r_ij_[k]->getMemoryUsage();
+        memory_usage += dv_pair_dW_ij_[k]->getMemoryUsage();
+    }
+    for (size_t k = 0; k != dv_pair_W_ij_.size(); ++k)
+    {
+        memory_usage += dv_pair_W_ij_[k]->getMemoryUsage();
+    }
+    return memory_usage;
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+void Relation<NeighborMethod<AdaptationParameters...>>::cachePairGeometry()
+{
+    bool is_cached = isPairGeometryCached();
+    bool is_kernel_value_to_cache = isKernelValueCached() && dv_pair_W_ij_.empty();
+    if (is_cached && !is_kernel_value_to_cache)
+        return;
+
+    for (size_t k = 0; k != dv_target_neighbor_index_.size(); ++k)
+    {
+        std::string name = TargetRelationName(k);
+        size_t data_size = dv_target_neighbor_index_[k]->getDataSize();
+        if (!is_cached)
+        {
+            dv_pair_e_ij_.push_back(addRelationVariable<Vecd>(name + "PairDirection", data_size));
+            dv_pair_r_ij_.push_back(addRelationVariable<Real>(name + "PairDistance", data_size));
+            dv_pair_dW_ij_.push_back(addRelationVariable<Real>(name + "PairKernelGradient", data_size));
+        }
+        if (is_kernel_value_to_cache)
+        {
+            dv_pair_W_ij_.push_back(addRelationVariable<Real>(name + "PairKernelValue", data_size));
+        }
+        resetComputingKernelUpdated(k);
+    }
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+void Relation<NeighborMethod<AdaptationParameters...>>::cacheReferenceGeometry()
+{
+    if (config_type_ != ConfigType::Lagrangian)
+    {
+        std::cout << "\n Error: the reference geometry is cached only for Lagrangian relations!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    is_reference_geometry_cached_ = true;
+    cachePairGeometry();
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+template <class ExecutionPolicy>
+bool Relation<NeighborMethod<AdaptationParameters...>>::
+    resizePairGeometry(const ExecutionPolicy &ex_policy, UnsignedInt target_index)
+{
+    size_t data_size = dv_target_neighbor_index_[target_index]->getDataSize();
+    if (dv_pair_e_ij_[target_index]->getDataSize() < data_size)
+    {
+        dv_pair_e_ij_[target_index]->reallocateData(ex_policy, data_size);
+        dv_pair_r_ij_[target_index]->reallocateData(ex_policy, data_size);
+        dv_pair_dW_ij_[target_index]->reallocateData(ex_policy, data_size);
+        if (!dv_pair_W_ij_.empty())
+        {
+            dv_pair_W_ij_[target_index]->reallocateData(ex_policy, data_size);
+        }
+        return true;
+    }
+    return false;
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
 void Relation<NeighborMethod<AdaptationParameters...>>::
     resetComputingKernelUpdated(UnsignedInt target_index)
 {
@@ -80,11 +196,159 @@ void Relation<NeighborMethod<AdaptationParameters...>>::
 }
 //=================================================================================================//
 template <typename... AdaptationParameters>
+void Relation<NeighborMethod<AdaptationParameters...>>::
+    setNeighborPrefetchDistance(UnsignedInt distance)
+{
+    neighbor_prefetch_distance_ = distance;
+    for (size_t k = 0; k != registered_computing_kernels_.size(); ++k)
+    {
+        resetComputingKernelUpdated(k);
+    }
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+template <class ExecutionPolicy, class DataType>
+void Relation<NeighborMethod<AdaptationParameters...>>::writeVariableToBinary(
+    const ExecutionPolicy &ex_policy, std::ofstream &out_file, DiscreteVariable<DataType> *variable)
+{
+    variable->prepareForOutput(ex_policy);
+    uint64_t data_size = variable->getDataSize();
+    out_file.write(reinterpret_cast<const char *>(&data_size), sizeof(uint64_t));
+    out_file.write(reinterpret_cast<const char *>(variable->Data()), data_size * sizeof(DataType));
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+template <class ExecutionPolicy, class DataType>
+bool Relation<NeighborMethod<AdaptationParameters...>>::readVariableFromBinary(
+    const ExecutionPolicy &ex_policy, std::ifstream &in_file,
+    DiscreteVariable<DataType> *variable, bool &reallocated)
+{
+    uint64_t data_size = 0;
+    in_file.read(reinterpret_cast<char *>(&data_size), sizeof(uint64_t));
+    if (!in_file)
+        return false;
+
+    if (variable->getDataSize() < data_size)
+    {
+        variable->reallocateData(ex_policy, data_size);
+        reallocated = true;
+    }
+    in_file.read(reinterpret_cast<char *>(variable->Data()), data_size * sizeof(DataType));
+    if (!in_file)
+        return false;
+
+    variable->finalizeLoadIn(ex_policy);
+    return true;
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+template <class ExecutionPolicy>
+void Relation<NeighborMethod<AdaptationParameters...>>::
+    writeNeighborListsToBinary(const ExecutionPolicy &ex_policy, std::ofstream &out_file)
+{
+    uint64_t header[4] = {particles_->TotalRealParticles(), dv_target_neighbor_index_.size(),
+                          isSlicedEllLayout(), isPairGeometryCached() + !dv_pair_W_ij_.empty()};
+    out_file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    writeVariableToBinary(ex_policy, out_file, dv_neighbor_size_);
+    for (size_t k = 0; k != dv_target_neighbor_index_.size(); ++k)
+    {
+        writeVariableToBinary(ex_policy, out_file, dv_target_particle_offset_[k]);
+        writeVariableToBinary(ex_policy, out_file, dv_target_neighbor_index_[k]);
+        if (isSlicedEllLayout())
+        {
+            writeVariableToBinary(ex_policy, out_file, dv_target_neighbor_end_[k]);
+            writeVariableToBinary(ex_policy, out_file, dv_target_slice_offset_[k]);
+        }
+        if (isPairGeometryCached())
+        {
+            writeVariableToBinary(ex_policy, out_file, dv_pair_e_ij_[k]);
+            writeVariableToBinary(ex_policy, out_file, dv_pair_r_ij_[k]);
+            writeVariableToBinary(ex_policy, out_file, dv_pair_dW_ij_[k]);
+        }
+        if (!dv_pair_W_ij_.empty())
+        {
+            writeVariableToBinary(ex_policy, out_file, dv_pair_W_ij_[k]);
+        }
+    }
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+template <class ExecutionPolicy>
+bool Relation<NeighborMethod<AdaptationParameters...>>::
+    readNeighborListsFromBinary(const ExecutionPolicy &ex_policy, std::ifstream &in_file)
+{
+    uint64_t header[4] = {0, 0, 0, 0};
+    in_file.read(reinterpret_cast<char *>(header), sizeof(header));
+    if (!in_file || header[0] != particles_->TotalRealParticles() ||
+        header[1] != dv_target_neighbor_index_.size() || header[2] != uint64_t(isSlicedEllLayout()) ||
+        header[3] != uint64_t(isPairGeometryCached() + !dv_pair_W_ij_.empty()))
+        return false;
+
+    bool reallocated = false;
+    if (!readVariableFromBinary(ex_policy, in_file, dv_neighbor_size_, reallocated))
+        return false;
+    for (size_t k = 0; k != dv_target_neighbor_index_.size(); ++k)
+    {
+        reallocated = false;
+        bool is_read = readVariableFromBinary(ex_policy, in_file, dv_target_particle_offset_[k], reallocated) &&
+                       readVariableFromBinary(ex_policy, in_file, dv_target_neighbor_index_[k], reallocated);
+        if (is_read && isSlicedEllLayout())
+        {
+            is_read = readVariableFromBinary(ex_policy, in_file, dv_target_neighbor_end_[k], reallocated) &&
+                      readVariableFromBinary(ex_policy, in_file, dv_target_slice_offset_[k], reallocated);
+        }
+        if (is_read && isPairGeometryCached())
+        {
+            is_read = readVariableFromBinary(ex_policy, in_file, dv_pair_e_ij_[k], reallocated) &&
+                      readVariableFromBinary(ex_policy, in_file, dv_pair_r_ij_[k], reallocated) &&
+                      readVariableFromBinary(ex_policy, in_file, dv_pair_dW_ij_[k], reallocated);
+        }
+        if (is_read && !dv_pair_W_ij_.empty())
+        {
+            is_read = readVariableFromBinary(ex_policy, in_file, dv_pair_W_ij_[k], reallocated);
+        }
+        if (reallocated)
+        {
+            resetComputingKernelUpdated(k);
+        }
+        if (!is_read)
+            return false;
+    }
+    setConfigured();
+    return true;
+}
+//=================================================================================================//
+template <typename... AdaptationParameters>
 template <class ExecutionPolicy, class EncloserType>
 Relation<NeighborMethod<AdaptationParameters...>>::NeighborList::NeighborList(
     const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt target_index)
     : neighbor_index_(encloser.dv_target_neighbor_index_[target_index]->DelegatedData(ex_policy)),
-      particle_offset_(encloser.dv_target_particle_offset_[target_index]->DelegatedData(ex_policy)) {}
+      particle_offset_(encloser.dv_target_particle_offset_[target_index]->DelegatedData(ex_policy)),
+      neighbor_end_(encloser.isSlicedEllLayout()
+                        ? encloser.dv_target_neighbor_end_[target_index]->DelegatedData(ex_policy)
+                        : particle_offset_ + 1),
+      neighbor_stride_(encloser.NeighborStride()),
+      prefetch_distance_(std::is_base_of_v<execution::DeviceExecution<>, ExecutionPolicy>
+                             ? 0
+                             : encloser.NeighborPrefetchDistance()) {}
+//=================================================================================================//
+template <typename... AdaptationParameters>
+template <class ExecutionPolicy, class EncloserType>
+Relation<NeighborMethod<AdaptationParameters...>>::PairGeometry::PairGeometry(
+    const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt target_index)
+    : pair_e_ij_(nullptr), pair_r_ij_(nullptr), pair_dW_ij_(nullptr), pair_W_ij_(nullptr)
+{
+    if (encloser.isPairGeometryCached())
+    {
+        pair_e_ij_ = encloser.dv_pair_e_ij_[target_index]->DelegatedData(ex_policy);
+        pair_r_ij_ = encloser.dv_pair_r_ij_[target_index]->DelegatedData(ex_policy);
+        pair_dW_ij_ = encloser.dv_pair_dW_ij_[target_index]->DelegatedData(ex_policy);
+    }
+    if (!encloser.dv_pair_W_ij_.empty())
+    {
+        pair_W_ij_ = encloser.dv_pair_W_ij_[target_index]->DelegatedData(ex_policy);
+    }
+}
 //=================================================================================================//
 template <typename DynamicsIdentifier, typename... AdaptationParameters>
 template <typename... Args>
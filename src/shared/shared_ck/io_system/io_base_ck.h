@@ -30,7 +30,9 @@
 #define IO_BASE_CK_H
 
 #include "execution_policy.h"
+#include "health_check_ck.h"
 #include "io_base.h"
+#include "io_in_situ.h"
 #include "io_vtk.h"
 
 namespace SPH
@@ -79,6 +81,97 @@ class BodyStatesRecordingToVtpCK : public BodyStatesRecordingToVtp
     }
 };
 
+/**
+ * @class WriteToVtpIfHealthCheckTriggeredCK
+ * @brief Output the body states only if one of the health checks is triggered,
+ * so that no device data is prepared for output otherwise.
+ */
+template <class ExecutionPolicy>
+class WriteToVtpIfHealthCheckTriggeredCK : public BodyStatesRecordingToVtpCK<ExecutionPolicy>
+{
+  protected:
+    StdVec<HealthCheckCK *> health_checks_;
+    bool is_triggered_;
+
+    bool checkHealth()
+    {
+        for (auto &health_check : health_checks_)
+        {
+            is_triggered_ = is_triggered_ || health_check->isTriggered();
+        }
+        return is_triggered_;
+    };
+
+  public:
+    WriteToVtpIfHealthCheckTriggeredCK(SPHSystem &sph_system, StdVec<HealthCheckCK *> health_checks)
+        : BodyStatesRecordingToVtpCK<ExecutionPolicy>(sph_system),
+          health_checks_(health_checks), is_triggered_(false) {};
+    virtual ~WriteToVtpIfHealthCheckTriggeredCK() {};
+    bool isTriggered() { return is_triggered_; };
+
+    virtual void writeToFile() override
+    {
+        if (checkHealth())
+        {
+            BodyStatesRecordingToVtpCK<ExecutionPolicy>::writeToFile();
+            std::cout << "\n Health check is triggered and the body states have been outputted. \n";
+        }
+    };
+
+    virtual void writeToFile(size_t iteration_step) override
+    {
+        if (checkHealth())
+        {
+            BodyStatesRecordingToVtpCK<ExecutionPolicy>::writeToFile(iteration_step);
+            std::cout << "\n Health check is triggered at iteration step " << iteration_step
+                      << "\n The body states have been outputted. \n";
+        }
+    };
+};
+
+template <class ExecutionPolicy>
+class BodyStatesInSituProcessingCK : public BodyStatesInSituProcessing
+{
+  protected:
+    OperationOnDataAssemble<ParticleVariables, PrepareVariablesToWrite<DiscreteVariable>> prepare_variable_to_write_;
+
+    void prepareToWrite()
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            if (bodies_[i]->checkNewlyUpdated())
+            {
+                BaseParticles &base_particles = bodies_[i]->getBaseParticles();
+                base_particles.dvParticlePosition()->prepareForOutput(ExecutionPolicy{});
+                prepare_variable_to_write_(base_particles.VariablesToWrite(), ExecutionPolicy{});
+            }
+        }
+    }
+
+  public:
+    template <typename... Args>
+    BodyStatesInSituProcessingCK(Args &&...args) : BodyStatesInSituProcessing(std::forward<Args>(args)...){};
+    virtual ~BodyStatesInSituProcessingCK() {};
+
+    virtual void writeToFile() override
+    {
+        if (state_recording_)
+        {
+            prepareToWrite();
+            BodyStatesInSituProcessing::writeToFile();
+        }
+    };
+
+    virtual void writeToFile(size_t iteration_step) override
+    {
+        if (state_recording_)
+        {
+            prepareToWrite();
+            BodyStatesInSituProcessing::writeToFile(iteration_step);
+        }
+    }
+};
+
 template <class ExecutionPolicy>
 class RestartIOCK : public RestartIO
 {
@@ -86,31 +179,90 @@ class RestartIOCK : public RestartIO
     template <typename... Args>
     RestartIOCK(Args &&...args) : RestartIO(std::forward<Args>(args)...){};
     virtual ~RestartIOCK() {};
+    /**
+     * The neighbor lists of the relation are written with the restart files,
+     * and reloaded to avoid rebuilding the configuration if the particle number matches.
+     */
+    template <class RelationType>
+    RestartIOCK &addRelationToRestart(RelationType &relation)
+    {
+        relation_file_names_.push_back(restartFilePrefix(
+            relation.getSPHBody().getName() + "_relation_" + std::to_string(relation_file_names_.size())));
+        write_relations_.push_back(
+            [&](std::ofstream &out_file)
+            { relation.writeNeighborListsToBinary(ExecutionPolicy{}, out_file); });
+        read_relations_.push_back(
+            [&](std::ifstream &in_file)
+            { return relation.readNeighborListsFromBinary(ExecutionPolicy{}, in_file); });
+        return *this;
+    };
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        for (size_t i = 0; i < bodies_.size(); ++i)
+        // the binary blocks are streamed from the device data,
+        // while the checksums of delta checkpoints are computed from the host data
+        if (!binary_format_ || full_snapshot_interval_ != 0)
         {
-            BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-            prepare_variable_to_write_(base_particles.EvolvingVariables(), ExecutionPolicy{});
+            for (size_t i = 0; i < bodies_.size(); ++i)
+            {
+                BaseParticles &base_particles = bodies_[i]->getBaseParticles();
+                prepare_variable_to_write_(base_particles.EvolvingVariables(), ExecutionPolicy{});
+            }
         }
         RestartIO::writeToFile(iteration_step);
+
+        for (size_t k = 0; k < write_relations_.size(); ++k)
+        {
+            std::ofstream out_file(relationFileName(k, iteration_step), std::ios::binary | std::ios::trunc);
+            write_relations_[k](out_file);
+        }
     };
 
     virtual void readFromFile(size_t iteration_step = 0) override
     {
         RestartIO::readFromFile(iteration_step);
 
-        for (size_t i = 0; i < bodies_.size(); ++i)
+        if (!binary_format_) // the binary blocks are streamed to the device data directly
         {
-            BaseParticles &base_particles = bodies_[i]->getBaseParticles();
-            finalize_variables_after_read_(base_particles.EvolvingVariables(), ExecutionPolicy{});
+            for (size_t i = 0; i < bodies_.size(); ++i)
+            {
+                BaseParticles &base_particles = bodies_[i]->getBaseParticles();
+                finalize_variables_after_read_(base_particles.EvolvingVariables(), ExecutionPolicy{});
+            }
+        }
+
+        for (size_t k = 0; k < read_relations_.size(); ++k)
+        {
+            std::string file_name = relationFileName(k, iteration_step);
+            std::ifstream in_file(file_name, std::ios::binary);
+            if (!in_file || !read_relations_[k](in_file))
+            {
+                std::cout << "\n Warning: the neighbor lists in " << file_name
+                          << " are not reloaded and will be rebuilt." << std::endl;
+            }
         }
     };
 
   protected:
+    virtual void writeParticlesToBinary(BaseParticles &base_particles, const std::string &filefullpath) override
+    {
+        base_particles.writeParticlesToBinaryForRestart(ExecutionPolicy{}, filefullpath);
+    };
+    virtual void readParticlesFromBinary(BaseParticles &base_particles, const std::string &filefullpath) override
+    {
+        base_particles.readParticlesFromBinaryForRestart(ExecutionPolicy{}, filefullpath);
+    };
+
     OperationOnDataAssemble<ParticleVariables, PrepareVariablesToWrite<DiscreteVariable>> prepare_variable_to_write_;
     OperationOnDataAssemble<ParticleVariables, FinalizeVariablesAfterRead<DiscreteVariable>> finalize_variables_after_read_;
+    StdVec<std::string> relation_file_names_;
+    StdVec<std::function<void(std::ofstream &)>> write_relations_;
+    StdVec<std::function<bool(std::ifstream &)>> read_relations_;
+
+    std::string relationFileName(size_t relation_index, size_t step)
+    {
+        return relation_file_names_[relation_index] + padValueWithZeros(step) + ".bin";
+    };
 };
 
 template <class ExecutionPolicy>
@@ -76,17 +76,16 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType, Parameters...>
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_->getValue() << "   ";
+        record_buffer_ << sv_physical_time_->getValue() << "   ";
         observation_method_.exec();
         dv_interpolated_quantities_->prepareForOutput(ExecutionPolicy{});
         DataType *interpolated_quantities = getObservedQuantity();
         for (size_t i = 0; i != number_of_observe_; ++i)
         {
-            plt_engine_.writeAQuantity(out_file, interpolated_quantities[i]);
+            plt_engine_.writeAQuantity(record_buffer_, interpolated_quantities[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        record_buffer_ << "\n";
+        finishRecord();
     };
 
     DataType *getObservedQuantity()
@@ -132,12 +131,11 @@ class ReducedQuantityRecording<ExecutionPolicy, LocalReduceMethodType> : public
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_->getValue() << "   ";
+        record_buffer_ << sv_physical_time_->getValue() << "   ";
         reduced_quantity_ = reduce_method_.exec();
-        plt_engine_.writeAQuantity(out_file, reduced_quantity_);
-        out_file << "\n";
-        out_file.close();
+        plt_engine_.writeAQuantity(record_buffer_, reduced_quantity_);
+        record_buffer_ << "\n";
+        finishRecord();
     };
 
     VariableType *getObservedQuantity()
@@ -0,0 +1,82 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_python_async_ck.h
+ * @brief 	Asynchronous running of a case from the pybind11 modules.
+ * @details The case runs on a worker thread without the global interpreter lock,
+ *          so that Python does its own work in the meantime and several cases run concurrently.
+ *          The variable views of a running case are not to be read until the step is waited for.
+ *          Only to be included by the pybind11 modules, as the library does not depend on pybind11.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_PYTHON_ASYNC_CK_H
+#define IO_PYTHON_ASYNC_CK_H
+
+#include <future>
+#include <pybind11/pybind11.h>
+
+namespace SPH
+{
+class AsyncStep
+{
+  public:
+    explicit AsyncStep(std::future<void> &&future) : future_(std::move(future)) {};
+    /** Blocks until the case has finished the step if not waited for. */
+    ~AsyncStep() {};
+
+    bool isDone() const
+    {
+        return !future_.valid() || future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    };
+    /** Wait without the interpreter lock and rethrow the exception of the case, if any. */
+    void wait()
+    {
+        if (future_.valid())
+        {
+            pybind11::gil_scoped_release release;
+            future_.get();
+        }
+    };
+
+  protected:
+    std::future<void> future_;
+};
+
+/** Run a member function of the case, e.g. runCase, on a worker thread.
+ *  The case is to be kept alive until the step is waited for, see py::keep_alive. */
+template <class CaseType, typename... Args>
+AsyncStep launchAsyncStep(CaseType &sph_case, void (CaseType::*step_function)(Args...), Args... args)
+{
+    return AsyncStep(std::async(std::launch::async, [&sph_case, step_function, args...]()
+                                { (sph_case.*step_function)(args...); }));
+};
+
+inline void bindAsyncStep(pybind11::module_ &m, const std::string &class_name)
+{
+    pybind11::class_<AsyncStep>(m, class_name.c_str())
+        .def("done", &AsyncStep::isDone)
+        .def("wait", &AsyncStep::wait);
+};
+} // namespace SPH
+#endif // IO_PYTHON_ASYNC_CK_H
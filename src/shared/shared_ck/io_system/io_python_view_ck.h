@@ -0,0 +1,111 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_python_view_ck.h
+ * @brief 	Zero-copy NumPy views of particle variables for the pybind11 modules.
+ * @details The views share the host data of the variables, so they are valid as long as the particles
+ *          and should be taken again if the number of real particles changes.
+ *          For device execution, sync() copies the viewed variables from the device before reading.
+ *          Only to be included by the pybind11 modules, as the library does not depend on pybind11.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_PYTHON_VIEW_CK_H
+#define IO_PYTHON_VIEW_CK_H
+
+#include "base_particles.hpp"
+#include "execution_policy.h"
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+namespace SPH
+{
+template <typename DataType>
+struct PythonArrayLayout
+{
+    using ScalarType = DataType;
+    static constexpr size_t components_ = 1;
+};
+
+template <>
+struct PythonArrayLayout<Vecd>
+{
+    using ScalarType = Real;
+    static constexpr size_t components_ = Dimensions;
+};
+
+/** A NumPy array over the first data_size entries of a variable, without copy and without ownership. */
+template <typename DataType>
+pybind11::array variableArrayView(DiscreteVariable<DataType> &variable, size_t data_size)
+{
+    using Layout = PythonArrayLayout<DataType>;
+    using ScalarType = typename Layout::ScalarType;
+    ScalarType *data = reinterpret_cast<ScalarType *>(variable.Data());
+    pybind11::capsule no_ownership(data, [](void *) {});
+    if constexpr (Layout::components_ == 1)
+    {
+        return pybind11::array_t<ScalarType>({data_size}, {sizeof(DataType)}, data, no_ownership);
+    }
+    else
+    {
+        return pybind11::array_t<ScalarType>({data_size, Layout::components_},
+                                             {sizeof(DataType), sizeof(ScalarType)}, data, no_ownership);
+    }
+};
+
+template <class ExecutionPolicy>
+class ParticleVariableViews
+{
+  public:
+    explicit ParticleVariableViews(BaseParticles &particles) : particles_(particles) {};
+    ~ParticleVariableViews() {};
+
+    template <typename DataType>
+    pybind11::array View(const std::string &name)
+    {
+        DiscreteVariable<DataType> *variable = particles_.getVariableByName<DataType>(name);
+        addVariableToList<DiscreteVariable, DataType>(viewed_variables_, variable);
+        return variableArrayView(*variable, particles_.TotalRealParticles());
+    };
+    /** Copy the viewed variables from the device, nothing to do for host execution. */
+    void sync() { prepare_variable_to_write_(viewed_variables_, ExecutionPolicy{}); };
+
+  protected:
+    BaseParticles &particles_;
+    ParticleVariables viewed_variables_;
+    OperationOnDataAssemble<ParticleVariables, PrepareVariablesToWrite<DiscreteVariable>> prepare_variable_to_write_;
+};
+
+template <class ExecutionPolicy>
+void bindParticleVariableViews(pybind11::module_ &m, const std::string &class_name)
+{
+    using ViewsType = ParticleVariableViews<ExecutionPolicy>;
+    pybind11::class_<ViewsType>(m, class_name.c_str())
+        .def("real", &ViewsType::template View<Real>)
+        .def("vector", &ViewsType::template View<Vecd>)
+        .def("integer", &ViewsType::template View<int>)
+        .def("sync", &ViewsType::sync);
+};
+} // namespace SPH
+#endif // IO_PYTHON_VIEW_CK_H
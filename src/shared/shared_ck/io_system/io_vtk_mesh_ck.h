@@ -31,6 +31,7 @@
 
 #include "execution_policy.h"
 #include "io_vtk_mesh.h"
+#include "io_xdmf.h"
 
 namespace SPH
 {
@@ -63,5 +64,35 @@ class BodyStatesRecordingToTriangleMeshVtpCK : public BodyStatesRecordingToTrian
   protected:
     OperationOnDataAssemble<ParticleVariables, PrepareVariablesToWrite<DiscreteVariable>> prepare_variable_to_write_;
 };
+
+template <class ExecutionPolicy>
+class BodyStatesRecordingToTriangleMeshXdmfCK : public BodyStatesRecordingToTriangleMeshXdmf
+{
+  public:
+    template <typename... Args>
+    BodyStatesRecordingToTriangleMeshXdmfCK(Args &&...args)
+        : BodyStatesRecordingToTriangleMeshXdmf(std::forward<Args>(args)...){};
+    virtual ~BodyStatesRecordingToTriangleMeshXdmfCK() {};
+
+    virtual void writeToFile()
+    {
+        if (state_recording_)
+        {
+            for (size_t i = 0; i < bodies_.size(); ++i)
+            {
+                if (bodies_[i]->checkNewlyUpdated())
+                {
+                    BaseParticles &base_particles = bodies_[i]->getBaseParticles();
+                    base_particles.dvParticlePosition()->prepareForOutput(ExecutionPolicy{});
+                    prepare_variable_to_write_(base_particles.VariablesToWrite(), ExecutionPolicy{});
+                }
+            }
+            BodyStatesRecordingToXdmf::writeToFile();
+        }
+    };
+
+  protected:
+    OperationOnDataAssemble<ParticleVariables, PrepareVariablesToWrite<DiscreteVariable>> prepare_variable_to_write_;
+};
 } // namespace SPH
 #endif // IO_VTK_MESH_CK_H
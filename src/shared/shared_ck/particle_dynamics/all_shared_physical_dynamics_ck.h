@@ -39,9 +39,15 @@
 #include "all_solid_dynamics_ck.h"
 #include "complex_algorithms_ck.h"
 #include "diffusion_dynamics_ck.hpp"
+#include "electro_physiology_ck.h"
+#include "implicit_diffusion_ck.hpp"
 #include "interaction_algorithms_ck.hpp"
+#include "mesh_relation_ck.h"
+#include "neighbor_statistics.hpp"
 #include "particle_functors_ck.h"
 #include "particle_sort_ck.hpp"
+#include "particle_sort_scheduler.hpp"
+#include "reaction_dynamics_ck.hpp"
 #include "simple_algorithms_ck.h"
 #include "sph_solver.h"
 
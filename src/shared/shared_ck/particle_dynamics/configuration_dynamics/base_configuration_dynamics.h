@@ -40,17 +40,17 @@ using namespace execution;
 template <typename... T>
 struct SortMethod;
 
-class QuickSort;
+class HostRadixSort;
 template <>
 struct SortMethod<SequencedPolicy>
 {
-    typedef QuickSort type;
+    typedef HostRadixSort type;
 };
 
 template <>
 struct SortMethod<ParallelPolicy>
 {
-    typedef QuickSort type;
+    typedef HostRadixSort type;
 };
 
 template <typename... T>
@@ -68,49 +68,52 @@ struct PlusUnsignedInt<ParallelPolicy>
     typedef std::plus<UnsignedInt> type;
 };
 
+/**
+ * @class UpdateSortableVariables
+ * @brief Permute the sortable variables by the index permutation,
+ * within the index range from the start index to the sorted bound.
+ * All variables share one scratch array, sized to the largest contained data type,
+ * other than a temporary array for each data type.
+ */
 template <template <typename> class ContainerType>
 class UpdateSortableVariables
 {
-    typedef DataAssemble<UniquePtr, ContainerType> TemporaryVariables;
-
-    struct InitializeTemporaryVariables
+    template <typename... VariableKeepers>
+    static constexpr size_t maxContainedDataSize(std::tuple<VariableKeepers...> *)
     {
-        template <typename DataType>
-        void operator()(UniquePtr<ContainerType<DataType>> &variable_ptr, UnsignedInt data_size)
-        {
-            variable_ptr = makeUnique<ContainerType<DataType>>("Temporary", data_size);
-        };
+        return std::max({sizeof(typename std::remove_pointer_t<
+                                typename VariableKeepers::value_type>::ContainedDataType)...});
     };
+    static constexpr size_t max_contained_data_size_ =
+        maxContainedDataSize(static_cast<DataContainerAddressAssemble<ContainerType> *>(nullptr));
 
-    TemporaryVariables temp_variables_;
-    OperationOnDataAssemble<TemporaryVariables, InitializeTemporaryVariables> initialize_temp_variables_;
+    DiscreteVariable<UnsignedInt> scratch_;
 
   public:
-    UpdateSortableVariables(UnsignedInt data_size) : initialize_temp_variables_()
-    {
-        initialize_temp_variables_(temp_variables_, data_size);
-    };
+    UpdateSortableVariables(UnsignedInt data_size)
+        : scratch_("SortingScratch",
+                   (data_size * max_contained_data_size_ + sizeof(UnsignedInt) - 1) / sizeof(UnsignedInt)) {};
 
     template <class ExecutionPolicy, typename DataType>
     void operator()(DataContainerAddressKeeper<ContainerType<DataType>> &variables,
-                    ExecutionPolicy &ex_policy, UnsignedInt sorted_size,
-                    DiscreteVariable<UnsignedInt> *dv_index_permutation)
+                    ExecutionPolicy &ex_policy, UnsignedInt sorted_bound,
+                    DiscreteVariable<UnsignedInt> *dv_index_permutation, UnsignedInt start_index = 0)
     {
         using ContainedDataType = typename ContainerType<DataType>::ContainedDataType;
-        constexpr int type_index = DataTypeIndex<DataType>::value;
-        ContainedDataType *temp_data_field = std::get<type_index>(temp_variables_)->DelegatedData(ex_policy);
+        ContainedDataType *temp_data_field =
+            reinterpret_cast<ContainedDataType *>(scratch_.DelegatedData(ex_policy));
 
         UnsignedInt *index_permutation = dv_index_permutation->DelegatedData(ex_policy);
 
         for (size_t k = 0; k != variables.size(); ++k)
         {
             ContainedDataType *sorted_data_field = variables[k]->DelegatedData(ex_policy);
-            generic_for(ex_policy, IndexRange(0, sorted_size),
+            generic_for(ex_policy, IndexRange(start_index, sorted_bound),
                         [=](size_t i)
-                        { temp_data_field[i] = sorted_data_field[i]; });
-            generic_for(ex_policy, IndexRange(0, sorted_size),
+                        { temp_data_field[i] = sorted_data_field[index_permutation[i]]; });
+            generic_for(ex_policy, IndexRange(start_index, sorted_bound),
                         [=](size_t i)
-                        { sorted_data_field[i] = temp_data_field[index_permutation[i]]; });
+                        { sorted_data_field[i] = temp_data_field[i]; });
         }
     };
 };
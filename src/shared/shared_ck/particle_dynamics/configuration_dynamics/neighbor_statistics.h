@@ -0,0 +1,92 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file neighbor_statistics.h
+ * @brief Opt-in diagnostic of the neighbor lists of a relation.
+ * @details For each target, the minimum, mean, maximum and the histogram of the neighbor sizes,
+ * the candidates visited by the cell linked list search per accepted neighbor, which measures
+ * the efficiency of the cell size, and the mean index distance of the neighbors, which measures
+ * the sorting locality, are evaluated in one reduction and recorded in the dynamics profiler.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef NEIGHBOR_STATISTICS_H
+#define NEIGHBOR_STATISTICS_H
+
+#include "base_dynamics.h"
+#include "cell_linked_list.h"
+#include "relation_ck.h"
+
+namespace SPH
+{
+/**
+ * @class NeighborStatistics
+ * @brief The statistics of the neighbor lists for the decisions of the cell size,
+ * the search depth, e.g. for a Verlet skin, and the sorting frequency.
+ * The index distance is |i - j| for an inner relation, and for a contact relation
+ * is taken to the first neighbor of the list, as the source and target indices are unrelated.
+ * The evaluation is on host, after the data are copied from device if executed there,
+ * and so is meant to be called once in a while, not every step.
+ */
+template <class ExecutionPolicy, class RelationType>
+class NeighborStatistics : public BaseDynamics<void>
+{
+    using NeighborList = typename RelationType::NeighborList;
+    using SearchBox = typename RelationType::NeighborhoodType::SearchBox;
+
+    class StatisticsKernel : public NeighborList
+    {
+      public:
+        StatisticsKernel(NeighborStatistics &encloser, UnsignedInt target_index);
+        void accumulate(UnsignedInt source_index, NeighborStatisticsRecord &record);
+
+      protected:
+        Vecd *src_pos_;
+        NeighborSearch neighbor_search_;
+        SearchBox search_box_;
+        bool is_inner_;
+    };
+
+  public:
+    explicit NeighborStatistics(RelationType &relation, UnsignedInt bin_width = 4);
+    virtual ~NeighborStatistics() {};
+    virtual void exec(Real dt = 0.0) override;
+    const NeighborStatisticsRecord &getRecord(UnsignedInt target_index = 0) { return records_[target_index]; };
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    RelationType &relation_;
+    UnsignedInt bin_width_;
+    bool is_inner_;
+    StdVec<CellLinkedList *> target_cell_linked_lists_;
+    StdVec<std::string> record_names_;
+    StdVec<NeighborStatisticsRecord> records_;
+
+    template <typename... Parameters>
+    void setTargets(Inner<Parameters...> &inner_relation);
+    template <typename... Parameters>
+    void setTargets(Contact<Parameters...> &contact_relation);
+    void prepareData(UnsignedInt target_index);
+};
+} // namespace SPH
+#endif // NEIGHBOR_STATISTICS_H
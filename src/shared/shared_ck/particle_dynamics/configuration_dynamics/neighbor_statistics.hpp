@@ -0,0 +1,132 @@
+#ifndef NEIGHBOR_STATISTICS_HPP
+#define NEIGHBOR_STATISTICS_HPP
+
+#include "neighbor_statistics.h"
+
+#include "cell_linked_list.hpp"
+#include "relation_ck.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+NeighborStatistics<ExecutionPolicy, RelationType>::StatisticsKernel::
+    StatisticsKernel(NeighborStatistics &encloser, UnsignedInt target_index)
+    : NeighborList(par_host, encloser.relation_, target_index),
+      src_pos_(encloser.relation_.dvSourcePosition()->DelegatedData(par_host)),
+      neighbor_search_(encloser.target_cell_linked_lists_[target_index]->createNeighborSearch(par_host)),
+      search_box_(par_host, encloser.relation_.getNeighborhood(target_index)),
+      is_inner_(encloser.is_inner_) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+void NeighborStatistics<ExecutionPolicy, RelationType>::StatisticsKernel::
+    accumulate(UnsignedInt src_index, NeighborStatisticsRecord &record)
+{
+    UnsignedInt first_neighbor = this->FirstNeighbor(src_index);
+    UnsignedInt last_neighbor = this->LastNeighbor(src_index);
+    size_t neighbor_size = (last_neighbor - first_neighbor) / this->neighbor_stride_;
+
+    size_t candidates = 0;
+    neighbor_search_.forEachSearch(
+        src_pos_[src_index],
+        [&](size_t tar_index)
+        {
+            if (!is_inner_ || tar_index != src_index)
+                ++candidates;
+        },
+        search_box_(src_index));
+
+    size_t index_distance = 0;
+    if (neighbor_size != 0)
+    {
+        UnsignedInt reference_index = is_inner_ ? src_index : this->neighbor_index_[first_neighbor];
+        for (UnsignedInt n = first_neighbor; n != last_neighbor; n += this->neighbor_stride_)
+        {
+            UnsignedInt tar_index = this->neighbor_index_[n];
+            index_distance += tar_index > reference_index ? tar_index - reference_index : reference_index - tar_index;
+        }
+    }
+    record.addParticle(neighbor_size, candidates, index_distance);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+NeighborStatistics<ExecutionPolicy, RelationType>::
+    NeighborStatistics(RelationType &relation, UnsignedInt bin_width)
+    : BaseDynamics<void>(), ex_policy_(ExecutionPolicy{}), relation_(relation),
+      bin_width_(SMAX(bin_width, UnsignedInt(1))), is_inner_(false)
+{
+    setTargets(relation);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+template <typename... Parameters>
+void NeighborStatistics<ExecutionPolicy, RelationType>::setTargets(Inner<Parameters...> &inner_relation)
+{
+    is_inner_ = true;
+    target_cell_linked_lists_.push_back(DynamicCast<CellLinkedList>(
+        this, &inner_relation.getDynamicsIdentifier().getCellLinkedList()));
+    record_names_.push_back("Inner of " + inner_relation.getSPHBody().getName());
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+template <typename... Parameters>
+void NeighborStatistics<ExecutionPolicy, RelationType>::setTargets(Contact<Parameters...> &contact_relation)
+{
+    for (size_t k = 0; k != contact_relation.getContactBodies().size(); ++k)
+    {
+        target_cell_linked_lists_.push_back(DynamicCast<CellLinkedList>(
+            this, &contact_relation.getContactIdentifier(k).getCellLinkedList()));
+        record_names_.push_back("Contact of " + contact_relation.getSPHBody().getName() +
+                                " to " + contact_relation.getContactBody(k).getName());
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+void NeighborStatistics<ExecutionPolicy, RelationType>::prepareData(UnsignedInt target_index)
+{
+    relation_.dvSourcePosition()->prepareForOutput(ex_policy_);
+    relation_.dvNeighborIndex(target_index)->prepareForOutput(ex_policy_);
+    relation_.dvParticleOffset(target_index)->prepareForOutput(ex_policy_);
+    if (relation_.isSlicedEllLayout())
+    {
+        relation_.dvNeighborEnd(target_index)->prepareForOutput(ex_policy_);
+    }
+    CellLinkedList &cell_linked_list = *target_cell_linked_lists_[target_index];
+    cell_linked_list.dvParticleIndex()->prepareForOutput(ex_policy_);
+    cell_linked_list.dvCellOffset()->prepareForOutput(ex_policy_);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+void NeighborStatistics<ExecutionPolicy, RelationType>::exec(Real dt)
+{
+    relation_.waitForPendingUpdate();
+    UnsignedInt total_real_particles = relation_.getSPHBody().getBaseParticles().TotalRealParticles();
+    records_.clear();
+    for (UnsignedInt k = 0; k != target_cell_linked_lists_.size(); ++k)
+    {
+        prepareData(k);
+        StatisticsKernel statistics_kernel(*this, k);
+        NeighborStatisticsRecord initial_record;
+        initial_record.bin_width_ = bin_width_;
+        NeighborStatisticsRecord record = parallel_reduce(
+            IndexRange(0, total_real_particles), initial_record,
+            [&](const IndexRange &r, NeighborStatisticsRecord local_record) -> NeighborStatisticsRecord
+            {
+                for (size_t i = r.begin(); i != r.end(); ++i)
+                {
+                    statistics_kernel.accumulate(i, local_record);
+                }
+                return local_record;
+            },
+            [](NeighborStatisticsRecord x, const NeighborStatisticsRecord &y) -> NeighborStatisticsRecord
+            {
+                x.join(y);
+                return x;
+            });
+        records_.push_back(record);
+        DynamicsProfiler::get().recordNeighborStatistics(record_names_[k], record);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // NEIGHBOR_STATISTICS_HPP
@@ -37,7 +37,7 @@
  */
 namespace SPH
 {
-template <class ExecutionPolicy>
+template <class ExecutionPolicy, class CellOrdering = MortonOrdering>
 class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
 {
     using SortMethodType = typename SortMethod<ExecutionPolicy>::type;
@@ -45,23 +45,43 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
   public:
     explicit ParticleSortCK(RealBody &real_body);
     virtual ~ParticleSortCK() {};
+    /** The particles of the body part are stably partitioned to the front of the particle range
+     *  before the others, each group in the cell order, so that the body part can be looped
+     *  as a contiguous index range without indirection. Only one body part can be contiguous. */
+    void setContiguousBodyPart(BodyPartByParticle &body_part);
+    /** Only the particles appended after the last full sort, such as those spawned by emitters,
+     *  are sorted in the cell order among themselves. This cheap partial sort keeps the locality
+     *  of the newly spawned particles in the steps between two full sorts. */
+    void sortAppendedParticles();
+    /** The particles are sorted by the cell keys of the mesh of another body, usually the primary
+     *  contact source such as the fluid of a wall, with the same origin, spacing and cell ordering.
+     *  The contact neighbors gathered by the source particles are then in matching order in both
+     *  particle arrays. Target particles outside the source mesh are clamped into its boundary cells. */
+    void sortByCellKeysOf(RealBody &contact_source);
 
     class ComputingKernel
     {
       public:
         ComputingKernel(const ExecutionPolicy &ex_policy,
-                        ParticleSortCK<ExecutionPolicy> &encloser);
+                        ParticleSortCK<ExecutionPolicy, CellOrdering> &encloser);
         void prepareSequence(UnsignedInt index_i);
         void updateSortedID(UnsignedInt index_i);
+        void clearBodyPartMember(UnsignedInt index_i) { body_part_member_[index_i] = 0; };
+        void markBodyPartMember(UnsignedInt index_i) { body_part_member_[index_i] = 1; };
+        void flagBodyPartMember(UnsignedInt index_i);
+        void partitionPermutation(UnsignedInt index_i, UnsignedInt total_members);
+        void copyPartitionedPermutation(UnsignedInt index_i) { index_permutation_[index_i] = sequence_[index_i]; };
 
       protected:
         Mesh mesh_;
+        CellOrdering cell_ordering_;
 
         Vecd *pos_;
         UnsignedInt *sequence_;
         UnsignedInt *index_permutation_;
         UnsignedInt *original_id_;
         UnsignedInt *sorted_id_;
+        UnsignedInt *body_part_member_, *member_flag_, *member_offset_;
     };
 
     class UpdateBodyPartByParticle
@@ -71,23 +91,28 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
         UpdateBodyPartByParticle(const ExecutionPolicy &ex_policy,
                                  EncloserType &encloser, UnsignedInt body_part_i);
         void update(UnsignedInt index_i);
+        void updateContiguous(UnsignedInt index_i);
 
       protected:
         UnsignedInt *particle_list_, *original_id_list_;
-        UnsignedInt *sorted_id_;
+        UnsignedInt *sorted_id_, *original_id_;
     };
 
     virtual void exec(Real dt = 0.0) override;
-    typedef ParticleSortCK<ExecutionPolicy> LocalDynamicsType;
+    typedef ParticleSortCK<ExecutionPolicy, CellOrdering> LocalDynamicsType;
 
   protected:
     ExecutionPolicy ex_policy_;
     CellLinkedList &cell_linked_list_;
+    Mesh *cell_key_mesh_; /**< the mesh giving the cell keys, by default that of the own cell linked list */
     DiscreteVariable<Vecd> *dv_pos_;
     DiscreteVariable<UnsignedInt> *dv_sequence_;
     DiscreteVariable<UnsignedInt> *dv_index_permutation_;
     DiscreteVariable<UnsignedInt> *dv_original_id_;
     DiscreteVariable<UnsignedInt> *dv_sorted_id_;
+    DiscreteVariable<UnsignedInt> *dv_body_part_member_, *dv_member_flag_, *dv_member_offset_;
+    BodyPartByParticle *contiguous_body_part_;
+    size_t contiguous_body_part_index_;
     OperationOnDataAssemble<ParticleVariables, UpdateSortableVariables<DiscreteVariable>> update_variables_to_sort_;
     SortMethodType sort_method_;
     Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernel> kernel_implementation_;
@@ -98,6 +123,12 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
         Implementation<ExecutionPolicy, LocalDynamicsType, UpdateBodyPartByParticle>;
     UniquePtrsKeeper<UpdateBodyPartParticleImplementation> update_body_part_by_particle_implementation_ptrs_;
     StdVec<UpdateBodyPartParticleImplementation *> update_body_part_by_particle_implementations_;
+
+    UnsignedInt sorted_bound_; /**< the total real particles at the last full sort */
+
+    void sortParticleRange(UnsignedInt start_index, UnsignedInt end_index);
+    void partitionContiguousBodyPart(UnsignedInt total_real_particles);
+    void updateBodyPartsByParticle();
 };
 } // namespace SPH
 #endif // PARTICLE_SORT_H
@@ -6,11 +6,12 @@
 namespace SPH
 {
 //=================================================================================================//
-template <class ExecutionPolicy>
-ParticleSortCK<ExecutionPolicy>::ParticleSortCK(RealBody &real_body)
+template <class ExecutionPolicy, class CellOrdering>
+ParticleSortCK<ExecutionPolicy, CellOrdering>::ParticleSortCK(RealBody &real_body)
     : LocalDynamics(real_body), BaseDynamics<void>(),
       ex_policy_(ExecutionPolicy{}),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      cell_key_mesh_(&cell_linked_list_.getMesh()),
       dv_pos_(particles_->getVariableByName<Vecd>("Position")),
       dv_sequence_(particles_->registerDiscreteVariable<UnsignedInt>(
           "Sequence", particles_->ParticlesBound())),
@@ -18,9 +19,11 @@ ParticleSortCK<ExecutionPolicy>::ParticleSortCK(RealBody &real_body)
           "IndexPermutation", particles_->ParticlesBound())),
       dv_original_id_(particles_->getVariableByName<UnsignedInt>("OriginalID")),
       dv_sorted_id_(particles_->getVariableByName<UnsignedInt>("SortedID")),
+      dv_body_part_member_(nullptr), dv_member_flag_(nullptr), dv_member_offset_(nullptr),
+      contiguous_body_part_(nullptr), contiguous_body_part_index_(0),
       update_variables_to_sort_(particles_->ParticlesBound()),
       sort_method_(ExecutionPolicy{}, dv_sequence_, dv_index_permutation_),
-      kernel_implementation_(*this)
+      kernel_implementation_(*this), sorted_bound_(0)
 {
     particles_->addEvolvingVariable<UnsignedInt>("OriginalID");
 
@@ -46,75 +49,226 @@ ParticleSortCK<ExecutionPolicy>::ParticleSortCK(RealBody &real_body)
     }
 }
 //=================================================================================================//
-template <class ExecutionPolicy>
-ParticleSortCK<ExecutionPolicy>::ComputingKernel::
-    ComputingKernel(const ExecutionPolicy &ex_policy, ParticleSortCK<ExecutionPolicy> &encloser)
-    : mesh_(encloser.cell_linked_list_.getMesh()),
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::setContiguousBodyPart(BodyPartByParticle &body_part)
+{
+    auto registered = std::find(body_parts_by_particle_.begin(), body_parts_by_particle_.end(), &body_part);
+    if (registered == body_parts_by_particle_.end())
+    {
+        std::cout << "\n Error: the body part " << body_part.getName()
+                  << " is not a body part by particle of " << sph_body_->getName() << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    if (contiguous_body_part_ != nullptr)
+    {
+        contiguous_body_part_->setContiguous(false);
+    }
+    contiguous_body_part_ = &body_part;
+    contiguous_body_part_index_ = registered - body_parts_by_particle_.begin();
+
+    if (dv_body_part_member_ == nullptr)
+    {
+        dv_body_part_member_ = particles_->registerDiscreteVariable<UnsignedInt>(
+            "BodyPartMember", particles_->ParticlesBound());
+        dv_member_flag_ = particles_->registerDiscreteVariable<UnsignedInt>(
+            "BodyPartMemberFlag", particles_->ParticlesBound() + 1);
+        dv_member_offset_ = particles_->registerDiscreteVariable<UnsignedInt>(
+            "BodyPartMemberOffset", particles_->ParticlesBound() + 1);
+        kernel_implementation_.resetUpdated();
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::sortByCellKeysOf(RealBody &contact_source)
+{
+    cell_key_mesh_ = &DynamicCast<CellLinkedList>(this, contact_source.getCellLinkedList()).getMesh();
+    kernel_implementation_.resetUpdated();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+ParticleSortCK<ExecutionPolicy, CellOrdering>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, ParticleSortCK<ExecutionPolicy, CellOrdering> &encloser)
+    : mesh_(*encloser.cell_key_mesh_),
       pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
       sequence_(encloser.dv_sequence_->DelegatedData(ex_policy)),
       index_permutation_(encloser.dv_index_permutation_->DelegatedData(ex_policy)),
       original_id_(encloser.dv_original_id_->DelegatedData(ex_policy)),
-      sorted_id_(encloser.dv_sorted_id_->DelegatedData(ex_policy)) {}
+      sorted_id_(encloser.dv_sorted_id_->DelegatedData(ex_policy)),
+      body_part_member_(encloser.dv_body_part_member_ != nullptr
+                            ? encloser.dv_body_part_member_->DelegatedData(ex_policy)
+                            : nullptr),
+      member_flag_(encloser.dv_member_flag_ != nullptr
+                       ? encloser.dv_member_flag_->DelegatedData(ex_policy)
+                       : nullptr),
+      member_offset_(encloser.dv_member_offset_ != nullptr
+                         ? encloser.dv_member_offset_->DelegatedData(ex_policy)
+                         : nullptr) {}
 //=================================================================================================//
-template <class ExecutionPolicy>
-void ParticleSortCK<ExecutionPolicy>::ComputingKernel::
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::ComputingKernel::
     prepareSequence(UnsignedInt index_i)
 {
-    sequence_[index_i] = Mesh::transferMeshIndexToMortonOrder(mesh_.CellIndexFromPosition(pos_[index_i]));
+    sequence_[index_i] = cell_ordering_(mesh_.CellIndexFromPosition(pos_[index_i]));
     index_permutation_[index_i] = index_i;
 }
 //=================================================================================================//
-template <class ExecutionPolicy>
-void ParticleSortCK<ExecutionPolicy>::ComputingKernel::
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::ComputingKernel::
     updateSortedID(UnsignedInt index_i)
 {
     sorted_id_[original_id_[index_i]] = index_i;
 }
 //=================================================================================================//
-template <class ExecutionPolicy>
-void ParticleSortCK<ExecutionPolicy>::exec(Real dt)
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::ComputingKernel::
+    flagBodyPartMember(UnsignedInt index_i)
+{
+    member_flag_[index_i] = body_part_member_[index_permutation_[index_i]];
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::ComputingKernel::
+    partitionPermutation(UnsignedInt index_i, UnsignedInt total_members)
+{
+    UnsignedInt partitioned_index = member_flag_[index_i] == 1
+                                        ? member_offset_[index_i]
+                                        : total_members + index_i - member_offset_[index_i];
+    sequence_[partitioned_index] = index_permutation_[index_i];
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::
+    partitionContiguousBodyPart(UnsignedInt total_real_particles)
 {
-    UnsignedInt total_real_particles = particles_->TotalRealParticles();
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+    UnsignedInt total_members = contiguous_body_part_->svRangeSize()->getValue();
+    UnsignedInt *particle_list = dv_particle_lists_[contiguous_body_part_index_]->DelegatedData(ex_policy_);
 
     particle_for(ex_policy_, IndexRange(0, total_real_particles),
                  [=](size_t i)
-                 { computing_kernel->prepareSequence(i); });
+                 { computing_kernel->clearBodyPartMember(i); });
 
-    sort_method_.sort(ex_policy_, total_real_particles);
-    update_variables_to_sort_(particles_->EvolvingVariables(), ex_policy_, total_real_particles, dv_index_permutation_);
+    particle_for(ex_policy_, IndexRange(0, total_members),
+                 [=](size_t i)
+                 { computing_kernel->markBodyPartMember(particle_list[i]); });
 
     particle_for(ex_policy_, IndexRange(0, total_real_particles),
                  [=](size_t i)
-                 { computing_kernel->updateSortedID(i); });
+                 { computing_kernel->flagBodyPartMember(i); });
+
+    UnsignedInt *member_flag = dv_member_flag_->DelegatedData(ex_policy_);
+    UnsignedInt *member_offset = dv_member_offset_->DelegatedData(ex_policy_);
+    exclusive_scan(ex_policy_, member_flag, member_offset, total_real_particles + 1,
+                   typename PlusUnsignedInt<ExecutionPolicy>::type());
 
+    // the sequence is not used after sorting and holds the partitioned permutation temporarily
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->partitionPermutation(i, total_members); });
+
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->copyPartitionedPermutation(i); });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::
+    sortParticleRange(UnsignedInt start_index, UnsignedInt end_index)
+{
+    ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+
+    particle_for(ex_policy_, IndexRange(start_index, end_index),
+                 [=](size_t i)
+                 { computing_kernel->prepareSequence(i); });
+
+    sort_method_.sort(ex_policy_, end_index - start_index, start_index);
+    if (contiguous_body_part_ != nullptr && start_index == 0)
+    {
+        partitionContiguousBodyPart(end_index);
+    }
+    update_variables_to_sort_(particles_->EvolvingVariables(), ex_policy_,
+                              end_index, dv_index_permutation_, start_index);
+
+    particle_for(ex_policy_, IndexRange(start_index, end_index),
+                 [=](size_t i)
+                 { computing_kernel->updateSortedID(i); });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::updateBodyPartsByParticle()
+{
     for (size_t k = 0; k != body_parts_by_particle_.size(); ++k)
     {
         UnsignedInt total_particles = body_parts_by_particle_[k]->svRangeSize()->getValue();
         UpdateBodyPartByParticle *update_body_part_by_particle =
             update_body_part_by_particle_implementations_[k]->getComputingKernel(k);
 
-        particle_for(ex_policy_, IndexRange(0, total_particles),
-                     [=](size_t i)
-                     { update_body_part_by_particle->update(i); });
+        if (body_parts_by_particle_[k] == contiguous_body_part_)
+        {
+            particle_for(ex_policy_, IndexRange(0, total_particles),
+                         [=](size_t i)
+                         { update_body_part_by_particle->updateContiguous(i); });
+            contiguous_body_part_->setContiguous(true);
+        }
+        else
+        {
+            particle_for(ex_policy_, IndexRange(0, total_particles),
+                         [=](size_t i)
+                         { update_body_part_by_particle->update(i); });
+        }
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<ParticleSortCK>(), *this->sph_body_);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    sortParticleRange(0, total_real_particles);
+    updateBodyPartsByParticle();
+    sorted_bound_ = total_real_particles;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::sortAppendedParticles()
+{
+    ScopedDynamicsTimer timer(type_name<ParticleSortCK>(), *this->sph_body_);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    // particles deleted since the last full sort only shorten the sorted range
+    UnsignedInt start_index = SMIN(sorted_bound_, total_real_particles);
+    if (total_real_particles - start_index > 1)
+    {
+        sortParticleRange(start_index, total_real_particles);
+        updateBodyPartsByParticle();
     }
 }
 //=================================================================================================//
-template <class ExecutionPolicy>
+template <class ExecutionPolicy, class CellOrdering>
 template <class EncloserType>
-ParticleSortCK<ExecutionPolicy>::UpdateBodyPartByParticle::
+ParticleSortCK<ExecutionPolicy, CellOrdering>::UpdateBodyPartByParticle::
     UpdateBodyPartByParticle(const ExecutionPolicy &ex_policy,
                              EncloserType &encloser, UnsignedInt body_part_i)
     : particle_list_(encloser.dv_particle_lists_[body_part_i]->DelegatedData(ex_policy)),
       original_id_list_(encloser.dv_original_id_lists_[body_part_i]->DelegatedData(ex_policy)),
-      sorted_id_(encloser.dv_sorted_id_->DelegatedData(ex_policy)) {}
+      sorted_id_(encloser.dv_sorted_id_->DelegatedData(ex_policy)),
+      original_id_(encloser.dv_original_id_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
-template <class ExecutionPolicy>
-void ParticleSortCK<ExecutionPolicy>::UpdateBodyPartByParticle::
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::UpdateBodyPartByParticle::
     update(UnsignedInt index_i)
 {
     particle_list_[index_i] = sorted_id_[original_id_list_[index_i]];
 }
 //=================================================================================================//
+template <class ExecutionPolicy, class CellOrdering>
+void ParticleSortCK<ExecutionPolicy, CellOrdering>::UpdateBodyPartByParticle::
+    updateContiguous(UnsignedInt index_i)
+{
+    particle_list_[index_i] = index_i;
+    original_id_list_[index_i] = original_id_[index_i];
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // PARTICLE_SORT_HPP
\ No newline at end of file
@@ -0,0 +1,110 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file particle_sort_scheduler.h
+ * @brief Trigger particle sorting by a locality metric of the neighbor list
+ * instead of a fixed interval of iterations.
+ * @details The metric is the mean index distance |i - j| between particles and their neighbors
+ * over a sampled subset of particles. Sorting is carried out when the metric
+ * exceeds the reference value measured after the previous sorting by a given ratio.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_SORT_SCHEDULER_H
+#define PARTICLE_SORT_SCHEDULER_H
+
+#include "base_local_dynamics.h"
+#include "particle_sort_ck.h"
+#include "relation_ck.h"
+#include "simple_algorithms_ck.h"
+
+namespace SPH
+{
+template <class InnerRelationType>
+class NeighborIndexDistance
+    : public BaseLocalDynamicsReduce<ReduceSum<std::pair<Real, Real>>, typename InnerRelationType::SourceType>
+{
+    using ReduceReturnType = std::pair<Real, Real>;
+    using BaseDynamicsType =
+        BaseLocalDynamicsReduce<ReduceSum<ReduceReturnType>, typename InnerRelationType::SourceType>;
+
+  public:
+    NeighborIndexDistance(InnerRelationType &inner_relation, UnsignedInt sample_stride = 16);
+    virtual ~NeighborIndexDistance() {};
+
+    class FinishDynamics
+    {
+      public:
+        using OutputType = Real;
+        template <class EncloserType>
+        FinishDynamics(EncloserType &encloser){};
+        OutputType Result(const ReduceReturnType &reduced_value)
+        {
+            return reduced_value.second > 0.0 ? reduced_value.first / reduced_value.second : 0.0;
+        }
+    };
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        ReduceReturnType reduce(size_t index_i, Real dt = 0.0);
+
+      protected:
+        UnsignedInt sample_stride_;
+        UnsignedInt *neighbor_index_;
+        UnsignedInt *particle_offset_;
+        UnsignedInt *neighbor_end_;
+        UnsignedInt neighbor_stride_;
+    };
+
+  protected:
+    UnsignedInt sample_stride_;
+    DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
+    DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+    DiscreteVariable<UnsignedInt> *dv_neighbor_end_; /**< nullptr for the compressed rows */
+    UnsignedInt neighbor_stride_;
+};
+
+template <class ExecutionPolicy, class InnerRelationType, class CellOrdering = MortonOrdering>
+class ParticleSortScheduler : public BaseDynamics<void>
+{
+  public:
+    ParticleSortScheduler(InnerRelationType &inner_relation, Real degradation_ratio = 1.5,
+                          UnsignedInt sample_stride = 16);
+    virtual ~ParticleSortScheduler() {};
+    virtual void exec(Real dt = 0.0) override;
+    Real LocalityMetric() { return locality_metric_; };
+    size_t TotalSorts() { return total_sorts_; };
+
+  protected:
+    Real degradation_ratio_;
+    Real reference_metric_;
+    Real locality_metric_;
+    size_t total_sorts_;
+    ReduceDynamicsCK<ExecutionPolicy, NeighborIndexDistance<InnerRelationType>> neighbor_index_distance_;
+    ParticleSortCK<ExecutionPolicy, CellOrdering> particle_sort_;
+};
+} // namespace SPH
+#endif // PARTICLE_SORT_SCHEDULER_H
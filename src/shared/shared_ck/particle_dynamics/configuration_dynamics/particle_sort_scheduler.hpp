@@ -0,0 +1,82 @@
+#ifndef PARTICLE_SORT_SCHEDULER_HPP
+#define PARTICLE_SORT_SCHEDULER_HPP
+
+#include "particle_sort_scheduler.h"
+
+#include "particle_sort_ck.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class InnerRelationType>
+NeighborIndexDistance<InnerRelationType>::
+    NeighborIndexDistance(InnerRelationType &inner_relation, UnsignedInt sample_stride)
+    : BaseDynamicsType(inner_relation.getDynamicsIdentifier()),
+      sample_stride_(SMAX(sample_stride, UnsignedInt(1))),
+      dv_neighbor_index_(inner_relation.dvNeighborIndex()),
+      dv_particle_offset_(inner_relation.dvParticleOffset()),
+      dv_neighbor_end_(inner_relation.dvNeighborEnd()),
+      neighbor_stride_(inner_relation.NeighborStride())
+{
+    this->quantity_name_ = "NeighborIndexDistance";
+}
+//=================================================================================================//
+template <class InnerRelationType>
+template <class ExecutionPolicy, class EncloserType>
+NeighborIndexDistance<InnerRelationType>::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : sample_stride_(encloser.sample_stride_),
+      neighbor_index_(encloser.dv_neighbor_index_->DelegatedData(ex_policy)),
+      particle_offset_(encloser.dv_particle_offset_->DelegatedData(ex_policy)),
+      neighbor_end_(encloser.dv_neighbor_end_ != nullptr
+                        ? encloser.dv_neighbor_end_->DelegatedData(ex_policy)
+                        : particle_offset_ + 1),
+      neighbor_stride_(encloser.neighbor_stride_) {}
+//=================================================================================================//
+template <class InnerRelationType>
+std::pair<Real, Real> NeighborIndexDistance<InnerRelationType>::ReduceKernel::
+    reduce(size_t index_i, Real dt)
+{
+    Real index_distance = 0.0;
+    Real number_of_neighbors = 0.0;
+    if (index_i % sample_stride_ == 0)
+    {
+        for (UnsignedInt n = particle_offset_[index_i]; n != neighbor_end_[index_i]; n += neighbor_stride_)
+        {
+            UnsignedInt index_j = neighbor_index_[n];
+            index_distance += index_j > index_i ? Real(index_j - index_i) : Real(index_i - index_j);
+            number_of_neighbors += 1.0;
+        }
+    }
+    return ReduceReturnType(index_distance, number_of_neighbors);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class InnerRelationType, class CellOrdering>
+ParticleSortScheduler<ExecutionPolicy, InnerRelationType, CellOrdering>::
+    ParticleSortScheduler(InnerRelationType &inner_relation, Real degradation_ratio, UnsignedInt sample_stride)
+    : BaseDynamics<void>(), degradation_ratio_(degradation_ratio),
+      reference_metric_(0.0), locality_metric_(0.0), total_sorts_(0),
+      neighbor_index_distance_(inner_relation, sample_stride),
+      particle_sort_(DynamicCast<RealBody>(this, inner_relation.getSPHBody())) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class InnerRelationType, class CellOrdering>
+void ParticleSortScheduler<ExecutionPolicy, InnerRelationType, CellOrdering>::exec(Real dt)
+{
+    locality_metric_ = neighbor_index_distance_.exec();
+    // The reference is taken from the first valid neighbor list after sorting.
+    if (reference_metric_ <= 0.0)
+    {
+        reference_metric_ = locality_metric_;
+        return;
+    }
+
+    if (locality_metric_ > degradation_ratio_ * reference_metric_)
+    {
+        particle_sort_.exec();
+        reference_metric_ = 0.0;
+        total_sorts_++;
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // PARTICLE_SORT_SCHEDULER_HPP
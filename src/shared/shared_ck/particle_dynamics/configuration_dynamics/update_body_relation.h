@@ -35,6 +35,7 @@
 #include "base_configuration_dynamics.h"
 #include "base_local_dynamics.h"
 #include "base_particles.hpp"
+#include "multi_body_cell_linked_list.h"
 #include "neighborhood_ck.h"
 #include "relation_ck.hpp"
 
@@ -44,6 +45,36 @@ namespace SPH
 template <typename... T>
 class UpdateRelation;
 
+/**
+ * Set the particle offsets of a relation to a target from the neighbor sizes, which are stored
+ * temporarily in the neighbor index list. The offsets of the compressed rows are the prefix sums,
+ * while those of the sliced ELLPACK layout are given by the slice capacities, i.e. the largest neighbor sizes.
+ * Return the required size of the neighbor index list.
+ */
+template <class ExecutionPolicy, class RelationType>
+UnsignedInt setupParticleOffsets(const ExecutionPolicy &ex_policy, RelationType &relation,
+                                 UnsignedInt total_real_particles, UnsignedInt target_index = 0);
+
+/** Fill the pair geometry cache of a relation to a target after its neighbor lists are built. */
+template <class RelationType>
+class PairGeometryFilling : public RelationType::NeighborList,
+                            public RelationType::NeighborhoodType::NeighborKernel
+{
+    using NeighborList = typename RelationType::NeighborList;
+    using NeighborKernel = typename RelationType::NeighborhoodType::NeighborKernel;
+
+  public:
+    template <class ExecutionPolicy>
+    PairGeometryFilling(const ExecutionPolicy &ex_policy, RelationType &relation, UnsignedInt target_index = 0);
+    void update(UnsignedInt source_index);
+
+  protected:
+    Vecd *pair_e_ij_;
+    Real *pair_r_ij_;
+    Real *pair_dW_ij_;
+    Real *pair_W_ij_;
+};
+
 template <class ExecutionPolicy, typename... Parameters>
 class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
     : public BaseLocalDynamics<typename Inner<Parameters...>::SourceType>, public BaseDynamics<void>
@@ -56,6 +87,7 @@ class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
     using NeighborMethodType = typename InnerRelationType::NeighborhoodType;
     using NeighborCriterion = typename NeighborMethodType::NeighborCriterion;
     using MaskedCriterion = typename Identifier::template TargetParticleMask<NeighborCriterion>;
+    using SearchBox = typename NeighborMethodType::SearchBox;
 
     class OneSidedCheck
     {
@@ -75,6 +107,17 @@ class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
     UpdateRelation(Inner<Parameters...> &inner_relation);
     virtual ~UpdateRelation() {};
     virtual void exec(Real dt = 0.0) override;
+    /**
+     * Build the neighbor lists with a single search, in which the neighbors are stored in
+     * a scratch buffer of fixed capacity per particle while counted, and then compacted.
+     * If a particle overflows, the lists are built by the second search as before,
+     * and the capacity is increased to the largest neighbor size plus the margin.
+     */
+    void setSinglePassBuild(bool is_single_pass, UnsignedInt capacity_margin = 4)
+    {
+        is_single_pass_ = is_single_pass;
+        capacity_margin_ = capacity_margin;
+    };
 
   protected:
     class InteractKernel : public NeighborList
@@ -85,6 +128,8 @@ class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
         void clearNeighborSize(UnsignedInt source_index);
         void incrementNeighborSize(UnsignedInt source_index);
         void updateNeighborList(UnsignedInt source_index);
+        void incrementAndStoreNeighbor(UnsignedInt source_index, UnsignedInt capacity);
+        void copyStoredNeighborList(UnsignedInt source_index, UnsignedInt capacity);
 
       protected:
         Vecd *src_pos_;
@@ -93,14 +138,27 @@ class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
         OneSidedCheck is_one_sided_;
         MaskedCriterion masked_criterion_;
         NeighborSearch neighbor_search_;
+        SearchBox search_box_;
+        UnsignedInt *neighbor_scratch_;
+        UnsignedInt *max_neighbor_size_;
     };
     typedef UpdateRelation<ExecutionPolicy, Inner<Parameters...>> LocalDynamicsType;
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
+    using PairGeometryImplementation =
+        Implementation<ExecutionPolicy, InnerRelationType, PairGeometryFilling<InnerRelationType>>;
 
     ExecutionPolicy ex_policy_;
     InnerRelationType &inner_relation_;
     CellLinkedList &cell_linked_list_;
+    bool is_single_pass_;
+    UnsignedInt capacity_margin_;
+    UnsignedInt scratch_capacity_;
+    DiscreteVariable<UnsignedInt> dv_neighbor_scratch_;
+    SingularVariable<UnsignedInt> sv_max_neighbor_size_;
     Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel> kernel_implementation_;
+    PairGeometryImplementation pair_geometry_implementation_;
+
+    void updatePairGeometry(UnsignedInt total_real_particles);
 };
 
 template <class ExecutionPolicy, typename... Parameters>
@@ -121,6 +179,10 @@ class UpdateRelation<ExecutionPolicy, Contact<Parameters...>>
 
   public:
     UpdateRelation(ContactRelationType &contact_relation);
+    /** Searching all contact bodies by one stencil traversal of the shared cell linked list,
+     * which is updated by the user once per step before this update. Host execution only. */
+    UpdateRelation(ContactRelationType &contact_relation,
+                   MultiBodyCellLinkedList &multi_body_cell_linked_list);
     virtual ~UpdateRelation() {};
     virtual void exec(Real dt = 0.0) override;
 
@@ -132,6 +194,12 @@ class UpdateRelation<ExecutionPolicy, Contact<Parameters...>>
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
         void incrementNeighborSize(UnsignedInt source_index);
         void updateNeighborList(UnsignedInt source_index);
+        /** The functions below are for the search by the shared multi-body cell linked list. */
+        bool isSourceIncluded(UnsignedInt source_index) { return masked_src_(source_index); };
+        BoundingBoxi getSearchBox(UnsignedInt source_index) { return search_box_(source_index); };
+        void resetNeighborSize(UnsignedInt source_index) { this->neighbor_index_[source_index] = 0; };
+        void countNeighbor(UnsignedInt source_index, UnsignedInt target_index);
+        void insertNeighbor(UnsignedInt source_index, UnsignedInt target_index, UnsignedInt &neighbor_count);
 
       protected:
         Vecd *src_pos_;
@@ -143,11 +211,24 @@ class UpdateRelation<ExecutionPolicy, Contact<Parameters...>>
 
     typedef UpdateRelation<ExecutionPolicy, Contact<Parameters...>> LocalDynamicsType;
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
+    using PairGeometryImplementation =
+        Implementation<ExecutionPolicy, ContactRelationType, PairGeometryFilling<ContactRelationType>>;
     UniquePtrsKeeper<KernelImplementation> contact_kernel_implementation_ptrs_;
+    UniquePtrsKeeper<PairGeometryImplementation> pair_geometry_implementation_ptrs_;
     ExecutionPolicy ex_policy_;
     ContactRelationType &contact_relation_;
     StdVec<CellLinkedList *> contact_cell_linked_list_;
     StdVec<KernelImplementation *> contact_kernel_implementation_;
+    StdVec<PairGeometryImplementation *> pair_geometry_implementation_;
+    ComputingKernelArrayImplementation<ExecutionPolicy, InteractKernel> contact_kernel_array_;
+    MultiBodyCellLinkedList *multi_body_cell_linked_list_;
+    StdVec<UnsignedInt> contact_index_of_body_; /**< contact index or number of contacts if not a contact */
+
+    void resizeNeighborList(UnsignedInt contact_index, UnsignedInt total_real_particles);
+    void updateByMultiBodyCellLinkedList(UnsignedInt total_real_particles);
+    /** The neighbor sizes and lists of all contact targets in one launch each, see Contact::fuseContactTargets. */
+    void updateFusedTargets(UnsignedInt total_real_particles);
+    void updatePairGeometry(UnsignedInt contact_index, UnsignedInt total_real_particles);
 };
 
 template <class ExecutionPolicy>
@@ -169,5 +250,32 @@ class UpdateRelation<ExecutionPolicy, FirstRelation, OtherRelations...>
     explicit UpdateRelation(FirstRelation &first_relation, OtherRelations &...other_relations);
     virtual void exec(Real dt = 0.0) override;
 };
+
+/**
+ * @class OverlappedUpdateRelation
+ * @brief Update a relation on a separate task, overlapped with the dynamics run afterwards
+ * which do not use the relation, e.g. prior forces, observations or time step sizes.
+ * The interactions on the relation wait for the update to finish before using the neighbor lists.
+ * The overlapped dynamics must not change the positions or the cell linked lists used by the update.
+ */
+template <class ExecutionPolicy, class RelationType>
+class OverlappedUpdateRelation : public UpdateRelation<ExecutionPolicy, RelationType>
+{
+    using UpdateRelationType = UpdateRelation<ExecutionPolicy, RelationType>;
+
+  public:
+    template <typename... Args>
+    explicit OverlappedUpdateRelation(RelationType &relation, Args &&...args)
+        : UpdateRelationType(relation, std::forward<Args>(args)...), relation_(relation){};
+    virtual ~OverlappedUpdateRelation() {};
+    virtual void exec(Real dt = 0.0) override
+    {
+        relation_.runPendingUpdate([this, dt]()
+                                   { UpdateRelationType::exec(dt); });
+    };
+
+  protected:
+    RelationType &relation_;
+};
 } // namespace SPH
 #endif // UPDATE_BODY_RELATION_H
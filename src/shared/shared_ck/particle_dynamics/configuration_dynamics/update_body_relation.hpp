@@ -4,11 +4,89 @@
 #include "update_body_relation.h"
 
 #include "cell_linked_list.hpp"
+#include "multi_body_cell_linked_list.hpp"
 #include "particle_iterators_ck.h"
 
+#include <tbb/enumerable_thread_specific.h>
+
 namespace SPH
 {
 //=================================================================================================//
+template <class ExecutionPolicy, class RelationType>
+UnsignedInt setupParticleOffsets(const ExecutionPolicy &ex_policy, RelationType &relation,
+                                 UnsignedInt total_real_particles, UnsignedInt target_index)
+{
+    UnsignedInt *neighbor_index = relation.dvNeighborIndex(target_index)->DelegatedData(ex_policy);
+    UnsignedInt *particle_offset = relation.dvParticleOffset(target_index)->DelegatedData(ex_policy);
+    if (!relation.isSlicedEllLayout())
+    {
+        UnsignedInt neighbor_index_size =
+            exclusive_scan(ex_policy, neighbor_index, particle_offset, total_real_particles + 1,
+                           typename PlusUnsignedInt<ExecutionPolicy>::type());
+        relation.setMeanNeighborSize(target_index, Real(neighbor_index_size) / Real(SMAX(total_real_particles, UnsignedInt(1))));
+        return neighbor_index_size;
+    }
+
+    // Here, the neighbor end list takes role of temporary storage for the slice sizes.
+    UnsignedInt *neighbor_end = relation.dvNeighborEnd(target_index)->DelegatedData(ex_policy);
+    UnsignedInt *slice_offset = relation.dvSliceOffset(target_index)->DelegatedData(ex_policy);
+    UnsignedInt number_of_slices = (total_real_particles + EllSliceWidth - 1) / EllSliceWidth;
+    particle_for(ex_policy,
+                 IndexRange(0, number_of_slices),
+                 [=](size_t s)
+                 {
+                     UnsignedInt first = s * EllSliceWidth;
+                     UnsignedInt last = SMIN(first + EllSliceWidth, total_real_particles);
+                     UnsignedInt capacity = 0;
+                     for (UnsignedInt i = first; i != last; ++i)
+                         capacity = SMAX(capacity, neighbor_index[i]);
+                     neighbor_end[s] = capacity * EllSliceWidth;
+                 });
+    UnsignedInt neighbor_index_size =
+        exclusive_scan(ex_policy, neighbor_end, slice_offset, number_of_slices + 1,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+    particle_for(ex_policy,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     particle_offset[i] = slice_offset[i / EllSliceWidth] + i % EllSliceWidth;
+                     neighbor_end[i] = particle_offset[i] + neighbor_index[i] * EllSliceWidth;
+                 });
+    // including the padding of the slices
+    relation.setMeanNeighborSize(target_index, Real(neighbor_index_size) / Real(SMAX(total_real_particles, UnsignedInt(1))));
+    return neighbor_index_size;
+}
+//=================================================================================================//
+template <class RelationType>
+template <class ExecutionPolicy>
+PairGeometryFilling<RelationType>::PairGeometryFilling(
+    const ExecutionPolicy &ex_policy, RelationType &relation, UnsignedInt target_index)
+    : NeighborList(ex_policy, relation, target_index),
+      NeighborKernel(ex_policy, relation.getNeighborhood(target_index)),
+      pair_e_ij_(relation.dvPairDirection(target_index)->DelegatedData(ex_policy)),
+      pair_r_ij_(relation.dvPairDistance(target_index)->DelegatedData(ex_policy)),
+      pair_dW_ij_(relation.dvPairKernelGradient(target_index)->DelegatedData(ex_policy)),
+      pair_W_ij_(relation.dvPairKernelValue(target_index) != nullptr
+                     ? relation.dvPairKernelValue(target_index)->DelegatedData(ex_policy)
+                     : nullptr) {}
+//=================================================================================================//
+template <class RelationType>
+void PairGeometryFilling<RelationType>::update(UnsignedInt src_index)
+{
+    for (UnsignedInt n = this->FirstNeighbor(src_index); n != this->LastNeighbor(src_index); n += this->neighbor_stride_)
+    {
+        UnsignedInt tar_index = this->neighbor_index_[n];
+        Vecd vec_r_ij = this->vec_r_ij(src_index, tar_index);
+        pair_r_ij_[n] = vec_r_ij.norm();
+        pair_e_ij_[n] = vec_r_ij.normalized();
+        pair_dW_ij_[n] = this->dW_ij(src_index, tar_index);
+        if (pair_W_ij_ != nullptr)
+        {
+            pair_W_ij_[n] = this->W_ij(src_index, tar_index);
+        }
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
     UpdateRelation(Inner<Parameters...> &inner_relation)
@@ -17,7 +95,9 @@ UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
       inner_relation_(inner_relation),
       cell_linked_list_(DynamicCast<CellLinkedList>(
           this, inner_relation.getDynamicsIdentifier().getCellLinkedList())),
-      kernel_implementation_(*this) {}
+      is_single_pass_(false), capacity_margin_(4), scratch_capacity_(0),
+      dv_neighbor_scratch_("NeighborScratch", 1), sv_max_neighbor_size_("MaxNeighborSize", 0),
+      kernel_implementation_(*this), pair_geometry_implementation_(inner_relation) {}
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 template <class EncloserType>
@@ -31,7 +111,10 @@ UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::InteractKernel::InteractK
       masked_criterion_(
           ex_policy, encloser.inner_relation_.getDynamicsIdentifier(),
           ex_policy, encloser.inner_relation_.getNeighborhood()),
-      neighbor_search_(encloser.cell_linked_list_.createNeighborSearch(ex_policy)) {}
+      neighbor_search_(encloser.cell_linked_list_.createNeighborSearch(ex_policy)),
+      search_box_(ex_policy, encloser.inner_relation_.getNeighborhood()),
+      neighbor_scratch_(encloser.dv_neighbor_scratch_.DelegatedData(ex_policy)),
+      max_neighbor_size_(encloser.sv_max_neighbor_size_.DelegatedData(ex_policy)) {}
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
@@ -59,7 +142,8 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
                     AtomicRef<UnsignedInt> atomic_tar_size(this->neighbor_index_[tar_index]);
                     ++atomic_tar_size;
                 }
-            });
+            },
+            search_box_(src_index));
     }
     AtomicRef<UnsignedInt> atomic_src_size(this->neighbor_index_[src_index]);
     atomic_src_size.fetch_add(neighbor_count);
@@ -78,17 +162,73 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
                 if (is_one_sided_(src_index, tar_index) && masked_criterion_(tar_index, src_index))
                 {
                     AtomicRef<UnsignedInt> atomic_src_size(this->neighbor_size_[src_index]);
-                    this->neighbor_index_[this->particle_offset_[src_index] + atomic_src_size++] = tar_index;
+                    this->neighbor_index_[this->particle_offset_[src_index] +
+                                          this->neighbor_stride_ * atomic_src_size++] = tar_index;
                     AtomicRef<UnsignedInt> atomic_tar_size(this->neighbor_size_[tar_index]);
-                    this->neighbor_index_[this->particle_offset_[tar_index] + atomic_tar_size++] = src_index;
+                    this->neighbor_index_[this->particle_offset_[tar_index] +
+                                          this->neighbor_stride_ * atomic_tar_size++] = src_index;
                 }
-            });
+            },
+            search_box_(src_index));
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    InteractKernel::incrementAndStoreNeighbor(UnsignedInt src_index, UnsignedInt capacity)
+{
+    // Here, neighbor_index_ takes role of temporary storage for neighbor size list.
+    if (masked_src_(src_index))
+    {
+        UnsignedInt *neighbor_scratch = neighbor_scratch_;
+        auto store_neighbor = [&](UnsignedInt index, UnsignedInt neighbor_index)
+        {
+            AtomicRef<UnsignedInt> atomic_size(this->neighbor_index_[index]);
+            UnsignedInt slot = atomic_size++;
+            if (slot < capacity)
+            {
+                neighbor_scratch[index * capacity + slot] = neighbor_index;
+            }
+            else
+            {
+                atomicMax(*max_neighbor_size_, slot + 1); // only the overflowing sizes are recorded
+            }
+        };
+
+        neighbor_search_.forEachSearch(
+            src_pos_[src_index],
+            [&](size_t tar_index)
+            {
+                if (is_one_sided_(src_index, tar_index) && masked_criterion_(tar_index, src_index))
+                {
+                    store_neighbor(src_index, tar_index);
+                    store_neighbor(tar_index, src_index);
+                }
+            },
+            search_box_(src_index));
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    InteractKernel::copyStoredNeighborList(UnsignedInt src_index, UnsignedInt capacity)
+{
+    UnsignedInt first_neighbor = this->FirstNeighbor(src_index);
+    UnsignedInt neighbor_size = (this->LastNeighbor(src_index) - first_neighbor) / this->neighbor_stride_;
+    for (UnsignedInt n = 0; n != neighbor_size; ++n)
+    {
+        this->neighbor_index_[first_neighbor + n * this->neighbor_stride_] = neighbor_scratch_[src_index * capacity + n];
     }
+    neighbor_size_[src_index] = neighbor_size;
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
 {
+    if (inner_relation_.isFixedConfigured())
+        return;
+
+    ScopedDynamicsTimer timer(type_name<UpdateRelation>(), *this->sph_body_);
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
     InteractKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
@@ -97,22 +237,44 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
                  [=](size_t i)
                  { computing_kernel->clearNeighborSize(i); });
 
-    particle_for(ex_policy_,
-                 IndexRange(0, total_real_particles),
-                 [=](size_t i)
-                 { computing_kernel->incrementNeighborSize(i); });
+    UnsignedInt capacity = 0;
+    if (is_single_pass_)
+    {
+        capacity = scratch_capacity_;
+        if (total_real_particles * capacity > dv_neighbor_scratch_.getDataSize())
+        {
+            dv_neighbor_scratch_.reallocateData(ex_policy_, total_real_particles * capacity);
+            kernel_implementation_.overwriteComputingKernel();
+        }
+        sv_max_neighbor_size_.setValue(0);
+    }
+
+    const UnsignedInt *cell_sorted_index = cell_linked_list_.dvParticleIndex()->ConstDelegatedData(ex_policy_);
+    if (is_single_pass_)
+    {
+        particle_for_in_cell_order(ex_policy_,
+                                   IndexRange(0, total_real_particles), cell_sorted_index,
+                                   [=](size_t i)
+                                   { computing_kernel->incrementAndStoreNeighbor(i, capacity); });
+    }
+    else
+    {
+        particle_for_in_cell_order(ex_policy_,
+                                   IndexRange(0, total_real_particles), cell_sorted_index,
+                                   [=](size_t i)
+                                   { computing_kernel->incrementNeighborSize(i); });
+    }
 
     this->logger_->debug("UpdateCellLinkedList: incrementNeighborSize done at {} for Relation {}.",
                          this->sph_body_->getName(), type_name<Inner<Parameters...>>());
 
     auto *dv_neighbor_index = this->inner_relation_.dvNeighborIndex();
-    auto *dv_particle_offset = this->inner_relation_.dvParticleOffset();
-    UnsignedInt *neighbor_index = dv_neighbor_index->DelegatedData(ex_policy_);
-    UnsignedInt *particle_offset = dv_particle_offset->DelegatedData(ex_policy_);
-    UnsignedInt current_offset_list_size = total_real_particles + 1;
     UnsignedInt current_neighbor_index_size =
-        exclusive_scan(ex_policy_, neighbor_index, particle_offset, current_offset_list_size,
-                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+        setupParticleOffsets(ex_policy_, inner_relation_, total_real_particles);
+    if (DynamicsProfiler::get().isEnabled())
+    {
+        DynamicsProfiler::get().recordPairCount(this->sph_body_->getName(), current_neighbor_index_size);
+    }
 
     if (current_neighbor_index_size > dv_neighbor_index->getDataSize())
     {
@@ -126,13 +288,50 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
             old_size, dv_neighbor_index->getDataSize(), this->sph_body_->getName());
     }
 
-    particle_for(ex_policy_,
-                 IndexRange(0, total_real_particles),
-                 [=](size_t i)
-                 { computing_kernel->updateNeighborList(i); });
+    UnsignedInt overflow_neighbor_size = is_single_pass_ ? sv_max_neighbor_size_.getValue() : 0;
+    if (is_single_pass_ && overflow_neighbor_size == 0)
+    {
+        particle_for(ex_policy_,
+                     IndexRange(0, total_real_particles),
+                     [=](size_t i)
+                     { computing_kernel->copyStoredNeighborList(i, capacity); });
+    }
+    else
+    {
+        particle_for_in_cell_order(ex_policy_,
+                                   IndexRange(0, total_real_particles), cell_sorted_index,
+                                   [=](size_t i)
+                                   { computing_kernel->updateNeighborList(i); });
+    }
+    if (overflow_neighbor_size != 0)
+    {
+        scratch_capacity_ = overflow_neighbor_size + capacity_margin_;
+    }
 
     this->logger_->debug("UpdateCellLinkedList: updateNeighborList done at {} for Relation {}.",
                          this->sph_body_->getName(), type_name<Inner<Parameters...>>());
+
+    updatePairGeometry(total_real_particles);
+    inner_relation_.setConfigured();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
+    updatePairGeometry(UnsignedInt total_real_particles)
+{
+    if (!inner_relation_.isPairGeometryCached())
+        return;
+
+    if (inner_relation_.resizePairGeometry(ex_policy_))
+    {
+        inner_relation_.resetComputingKernelUpdated();
+        pair_geometry_implementation_.resetUpdated();
+    }
+    PairGeometryFilling<InnerRelationType> *pair_geometry = pair_geometry_implementation_.getComputingKernel();
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { pair_geometry->update(i); });
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
@@ -140,7 +339,7 @@ UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
     UpdateRelation(ContactRelationType &contact_relation)
     : BaseLocalDynamicsType(contact_relation.getSourceIdentifier()),
       BaseDynamics<void>(), ex_policy_(ExecutionPolicy{}),
-      contact_relation_(contact_relation)
+      contact_relation_(contact_relation), multi_body_cell_linked_list_(nullptr)
 {
     for (size_t k = 0; k != contact_relation.getContactBodies().size(); ++k)
     {
@@ -149,6 +348,26 @@ UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
                 this, &contact_relation.getContactIdentifier(k).getCellLinkedList()));
         contact_kernel_implementation_.push_back(
             contact_kernel_implementation_ptrs_.template createPtr<KernelImplementation>(*this));
+        pair_geometry_implementation_.push_back(
+            pair_geometry_implementation_ptrs_.template createPtr<PairGeometryImplementation>(contact_relation));
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    UpdateRelation(ContactRelationType &contact_relation,
+                   MultiBodyCellLinkedList &multi_body_cell_linked_list)
+    : UpdateRelation(contact_relation)
+{
+    static_assert(!std::is_base_of_v<execution::DeviceExecution<>, ExecutionPolicy>,
+                  "The multi-body cell linked list is only available on the host.");
+    multi_body_cell_linked_list_ = &multi_body_cell_linked_list;
+    const UnsignedInt number_of_contacts = contact_relation.getContactBodies().size();
+    contact_index_of_body_.assign(multi_body_cell_linked_list.NumberOfBodies(), number_of_contacts);
+    for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+    {
+        SPHBody &contact_body = contact_relation.getContactIdentifier(k).getSPHBody();
+        contact_index_of_body_[multi_body_cell_linked_list.BodyIndex(contact_body)] = k;
     }
 }
 //=================================================================================================//
@@ -200,7 +419,8 @@ void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
             {
                 if (masked_criterion_(tar_index, src_index))
                 {
-                    this->neighbor_index_[this->particle_offset_[src_index] + neighbor_count] = tar_index;
+                    this->neighbor_index_[this->particle_offset_[src_index] +
+                                          this->neighbor_stride_ * neighbor_count] = tar_index;
                     neighbor_count++;
                 }
             },
@@ -209,10 +429,198 @@ void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    InteractKernel::countNeighbor(UnsignedInt src_index, UnsignedInt tar_index)
+{
+    if (masked_criterion_(tar_index, src_index))
+        this->neighbor_index_[src_index]++;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    InteractKernel::insertNeighbor(UnsignedInt src_index, UnsignedInt tar_index, UnsignedInt &neighbor_count)
+{
+    if (masked_criterion_(tar_index, src_index))
+    {
+        this->neighbor_index_[this->particle_offset_[src_index] +
+                              this->neighbor_stride_ * neighbor_count] = tar_index;
+        neighbor_count++;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    resizeNeighborList(UnsignedInt k, UnsignedInt total_real_particles)
+{
+    auto *dv_neighbor_index = this->contact_relation_.dvNeighborIndex(k);
+    UnsignedInt current_neighbor_index_size =
+        setupParticleOffsets(ex_policy_, contact_relation_, total_real_particles, k);
+
+    if (current_neighbor_index_size > dv_neighbor_index->getDataSize())
+    {
+        UnsignedInt old_size = dv_neighbor_index->getDataSize();
+        dv_neighbor_index->reallocateData(ex_policy_, current_neighbor_index_size);
+        this->contact_relation_.resetComputingKernelUpdated(k);
+        contact_kernel_implementation_[k]->overwriteComputingKernel(k);
+
+        this->logger_->info(
+            "UpdateRelation: increase neighbor index size from {} to {} at .",
+            old_size, dv_neighbor_index->getDataSize(), this->sph_body_->getName());
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    updateByMultiBodyCellLinkedList(UnsignedInt total_real_particles)
+{
+    const UnsignedInt number_of_contacts = contact_relation_.getContactBodies().size();
+    if (number_of_contacts == 0)
+        return;
+
+    StdVec<InteractKernel *> kernels(number_of_contacts);
+    for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+    {
+        kernels[k] = contact_kernel_implementation_[k]->getComputingKernel(k);
+    }
+    Vecd *src_pos = contact_relation_.dvSourcePosition()->DelegatedData(ex_policy_);
+    MultiBodyCellLinkedList &multi_body_cell_linked_list = *multi_body_cell_linked_list_;
+    const StdVec<UnsignedInt> &contact_index_of_body = contact_index_of_body_;
+    // The search box covering those of all contacts, which filter the targets by their own criteria.
+    auto joint_search_box = [&](UnsignedInt i)
+    {
+        BoundingBoxi search_box = kernels[0]->getSearchBox(i);
+        for (UnsignedInt k = 1; k != number_of_contacts; ++k)
+        {
+            BoundingBoxi contact_search_box = kernels[k]->getSearchBox(i);
+            search_box = BoundingBoxi(search_box.lower_.min(contact_search_box.lower_),
+                                      search_box.upper_.max(contact_search_box.upper_));
+        }
+        return search_box;
+    };
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+                         kernels[k]->resetNeighborSize(i);
+                     if (kernels[0]->isSourceIncluded(i))
+                     {
+                         multi_body_cell_linked_list.forEachSearch(
+                             src_pos[i],
+                             [&](UnsignedInt body_index, UnsignedInt tar_index)
+                             {
+                                 const UnsignedInt k = contact_index_of_body[body_index];
+                                 if (k != number_of_contacts)
+                                     kernels[k]->countNeighbor(i, tar_index);
+                             },
+                             joint_search_box(i));
+                     }
+                 });
+
+    for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+    {
+        resizeNeighborList(k, total_real_particles);
+    }
+
+    tbb::enumerable_thread_specific<StdVec<UnsignedInt>> neighbor_counts(number_of_contacts, 0);
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     if (kernels[0]->isSourceIncluded(i))
+                     {
+                         StdVec<UnsignedInt> &neighbor_count = neighbor_counts.local();
+                         std::fill(neighbor_count.begin(), neighbor_count.end(), 0);
+                         multi_body_cell_linked_list.forEachSearch(
+                             src_pos[i],
+                             [&](UnsignedInt body_index, UnsignedInt tar_index)
+                             {
+                                 const UnsignedInt k = contact_index_of_body[body_index];
+                                 if (k != number_of_contacts)
+                                     kernels[k]->insertNeighbor(i, tar_index, neighbor_count[k]);
+                             },
+                             joint_search_box(i));
+                     }
+                 });
+
+    this->logger_->debug("UpdateRelation: updateNeighborList by multi-body cell linked list done at {}.",
+                         this->sph_body_->getName());
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    updateFusedTargets(UnsignedInt total_real_particles)
+{
+    const UnsignedInt number_of_contacts = contact_relation_.getContactBodies().size();
+    StdVec<InteractKernel *> kernels;
+    for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+    {
+        kernels.push_back(contact_kernel_implementation_[k]->getComputingKernel(k));
+    }
+    auto *kernel_array = contact_kernel_array_.getKernelArray(kernels);
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     for (UnsignedInt k = 0; k != kernel_array->size_; ++k)
+                         kernel_array->kernels_[k]->incrementNeighborSize(i);
+                 });
+
+    this->logger_->debug("UpdateRelation: fused incrementNeighborSize done at {} for Relation {}.",
+                         this->sph_body_->getName(), type_name<Contact<Parameters...>>());
+
+    // the kernels are overwritten in place if the neighbor lists are reallocated
+    for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+    {
+        resizeNeighborList(k, total_real_particles);
+    }
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     for (UnsignedInt k = 0; k != kernel_array->size_; ++k)
+                         kernel_array->kernels_[k]->updateNeighborList(i);
+                 });
+
+    this->logger_->debug("UpdateRelation: fused updateNeighborList done at {} for Relation {}.",
+                         this->sph_body_->getName(), type_name<Contact<Parameters...>>());
+
+    for (UnsignedInt k = 0; k != number_of_contacts; ++k)
+    {
+        updatePairGeometry(k, total_real_particles);
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::exec(Real dt)
 {
+    if (contact_relation_.isFixedConfigured())
+        return;
+
+    ScopedDynamicsTimer timer(type_name<UpdateRelation>(), *this->sph_body_);
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
 
+    if (multi_body_cell_linked_list_ != nullptr)
+    {
+        updateByMultiBodyCellLinkedList(total_real_particles);
+        for (size_t k = 0; k != contact_relation_.getContactBodies().size(); ++k)
+        {
+            updatePairGeometry(k, total_real_particles);
+        }
+        contact_relation_.setConfigured();
+        return;
+    }
+
+    if (contact_relation_.isTargetsFused())
+    {
+        updateFusedTargets(total_real_particles);
+        contact_relation_.setConfigured();
+        return;
+    }
+
     for (size_t k = 0; k != contact_relation_.getContactBodies().size(); ++k)
     {
         InteractKernel *computing_kernel = contact_kernel_implementation_[k]->getComputingKernel(k);
@@ -225,26 +633,7 @@ void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::exec(Real dt)
                              this->sph_body_->getName(), type_name<Contact<Parameters...>>(),
                              contact_relation_.getContactIdentifier(k).getName());
 
-        auto *dv_neighbor_index = this->contact_relation_.dvNeighborIndex(k);
-        auto *dv_particle_offset = this->contact_relation_.dvParticleOffset(k);
-        UnsignedInt *neighbor_index = dv_neighbor_index->DelegatedData(ex_policy_);
-        UnsignedInt *particle_offset = dv_particle_offset->DelegatedData(ex_policy_);
-        UnsignedInt current_offset_list_size = total_real_particles + 1;
-        UnsignedInt current_neighbor_index_size =
-            exclusive_scan(ex_policy_, neighbor_index, particle_offset, current_offset_list_size,
-                           typename PlusUnsignedInt<ExecutionPolicy>::type());
-
-        if (current_neighbor_index_size > dv_neighbor_index->getDataSize())
-        {
-            UnsignedInt old_size = dv_neighbor_index->getDataSize();
-            dv_neighbor_index->reallocateData(ex_policy_, current_neighbor_index_size);
-            this->contact_relation_.resetComputingKernelUpdated(k);
-            contact_kernel_implementation_[k]->overwriteComputingKernel(k);
-
-            this->logger_->info(
-                "UpdateRelation: increase neighbor index size from {} to {} at .",
-                old_size, dv_neighbor_index->getDataSize(), this->sph_body_->getName());
-        }
+        resizeNeighborList(k, total_real_particles);
 
         particle_for(ex_policy_,
                      IndexRange(0, total_real_particles),
@@ -255,7 +644,30 @@ void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::exec(Real dt)
             "UpdateRelation: updateNeighborList done at {} for Relation {} to {}.",
             this->sph_body_->getName(), type_name<Contact<Parameters...>>(),
             contact_relation_.getContactIdentifier(k).getName());
+
+        updatePairGeometry(k, total_real_particles);
+    }
+    contact_relation_.setConfigured();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... Parameters>
+void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
+    updatePairGeometry(UnsignedInt k, UnsignedInt total_real_particles)
+{
+    if (!contact_relation_.isPairGeometryCached())
+        return;
+
+    if (contact_relation_.resizePairGeometry(ex_policy_, k))
+    {
+        contact_relation_.resetComputingKernelUpdated(k);
+        pair_geometry_implementation_[k]->resetUpdated();
     }
+    PairGeometryFilling<ContactRelationType> *pair_geometry =
+        pair_geometry_implementation_[k]->getComputingKernel(k);
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { pair_geometry->update(i); });
 }
 //=================================================================================================//
 template <class ExecutionPolicy, class FirstRelation, class... OtherRelations>
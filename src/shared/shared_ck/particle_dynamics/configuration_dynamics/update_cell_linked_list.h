@@ -85,5 +85,208 @@ class UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>
     Implementation<ExecutionPolicy, EncloserType, ComputingKernel> kernel_implementation_;
 };
 
+/**
+ * @class UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>
+ * @brief Bin each particle into the level of the multilevel cell linked list
+ * matching the cut-off radius from its smoothing length ratio.
+ * The level is also recorded for the particle as for the host version.
+ * The offset and index lists are built over the cells of all levels at once.
+ */
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+class UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>
+    : public BaseLocalDynamics<DynamicsIdentifier>, public BaseDynamics<void>
+{
+    typedef UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList> EncloserType;
+    using ParticleMask = typename DynamicsIdentifier::ListedParticleMask;
+
+  protected:
+    MultilevelCellLinkedList &cell_linked_list_;
+    MultilevelMeshes meshes_;
+    Real reference_cutoff_radius_;
+    UnsignedInt total_number_of_cells_;
+    UnsignedInt cell_offset_list_size_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<Real> *dv_h_ratio_;
+    DiscreteVariable<int> *dv_mesh_level_;
+    DiscreteVariable<UnsignedInt> *dv_particle_index_;
+    DiscreteVariable<UnsignedInt> *dv_cell_offset_;
+    DiscreteVariable<UnsignedInt> *cell_dv_current_list_size_;
+
+  public:
+    UpdateCellLinkedList(DynamicsIdentifier &identifier);
+    virtual ~UpdateCellLinkedList() {};
+
+    class ComputingKernel
+    {
+      public:
+        ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void clearAllLists(UnsignedInt index_i);
+        void incrementCellSize(UnsignedInt index_i);
+        void updateCellList(UnsignedInt index_i);
+
+      protected:
+        MultilevelMeshes meshes_;
+        Real reference_cutoff_radius_;
+        ParticleMask particle_mask_;
+
+        Vecd *pos_;
+        Real *h_ratio_;
+        int *mesh_level_;
+        UnsignedInt *particle_index_;
+        UnsignedInt *cell_offset_;
+        UnsignedInt *current_list_size_;
+
+        /** The mesh level recorded by incrementCellSize is used. */
+        UnsignedInt LinearCellIndex(UnsignedInt index_i);
+    };
+
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    DynamicsIdentifier &identifier_;
+    Implementation<ExecutionPolicy, EncloserType, ComputingKernel> kernel_implementation_;
+};
+
+/**
+ * @class IncrementalUpdateCellLinkedList
+ * @brief Update the cell linked list by moving only the particles which have changed their cells.
+ * The linear cell index of each particle is kept as a discrete variable and compared
+ * with the current one to build a compact list of movers.
+ * Nothing is done if no particle has moved to another cell.
+ * Otherwise, the cell offsets and particle indices are updated by a delta pass.
+ * A full update is carried out for the first time, when the number of particles has changed,
+ * when the movers are too many, or when requested after particle sorting.
+ */
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+class IncrementalUpdateCellLinkedList : public UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>
+{
+    typedef UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier> BaseDynamicsType;
+    typedef IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier> EncloserType;
+    using ParticleMask = typename DynamicsIdentifier::ListedParticleMask;
+    UniquePtrsKeeper<DiscreteVariable<UnsignedInt>> buffer_variable_ptrs_;
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_linear_cell_index_;
+    DiscreteVariable<UnsignedInt> *dv_movers_;
+    DiscreteVariable<UnsignedInt> *dv_mover_previous_cell_;
+    DiscreteVariable<UnsignedInt> *dv_previous_particle_index_;
+    DiscreteVariable<UnsignedInt> *dv_previous_cell_offset_;
+    DiscreteVariable<UnsignedInt> *dv_cell_size_;
+    SingularVariable<UnsignedInt> sv_total_movers_;
+    Real full_update_fraction_;
+    bool is_full_update_requested_;
+    UnsignedInt total_real_particles_at_update_;
+
+  public:
+    IncrementalUpdateCellLinkedList(DynamicsIdentifier &identifier, Real full_update_fraction = 0.25);
+    virtual ~IncrementalUpdateCellLinkedList() {};
+    /** Required after the particle indices have been changed, e.g. by particle sorting. */
+    void requestFullUpdate() { is_full_update_requested_ = true; };
+
+    class ComputingKernel
+    {
+      public:
+        ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void recordLinearCellIndex(UnsignedInt index_i);
+        void identifyMover(UnsignedInt index_i);
+        void copyPreviousParticleIndex(UnsignedInt index_i);
+        void copyPreviousCellOffset(UnsignedInt index_i);
+        void updateCellSizeByMover(UnsignedInt mover_n);
+        void retainCellList(UnsignedInt index_i);
+        void insertMover(UnsignedInt mover_n);
+
+      protected:
+        Mesh mesh_;
+        ParticleMask particle_mask_;
+        UnsignedInt total_number_of_cells_;
+
+        Vecd *pos_;
+        UnsignedInt *particle_index_;
+        UnsignedInt *cell_offset_;
+        UnsignedInt *current_list_size_;
+        UnsignedInt *linear_cell_index_;
+        UnsignedInt *movers_;
+        UnsignedInt *mover_previous_cell_;
+        UnsignedInt *previous_particle_index_;
+        UnsignedInt *previous_cell_offset_;
+        UnsignedInt *cell_size_;
+        UnsignedInt *total_movers_;
+
+        /** The particles not included by the mask are given the index beyond the last cell. */
+        UnsignedInt currentLinearCellIndex(UnsignedInt index_i);
+    };
+
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    Implementation<ExecutionPolicy, EncloserType, ComputingKernel> incremental_kernel_implementation_;
+    void fullUpdate();
+};
+
+/**
+ * @class SparseUpdateCellLinkedList
+ * @brief Update the cell linked list with a two-level block layout for sparse domains,
+ * e.g. free-surface flows in which most cells are empty most of the time.
+ * The consecutive linear cells are grouped into blocks and the prefix sum is carried out
+ * over the block sizes, followed by a local scan only within the occupied blocks.
+ * Also, only the cells of the blocks occupied at the previous update are cleared.
+ * The cell offsets within the empty blocks are not updated and are skipped by NeighborSearch.
+ * Therefore, it is to be the only update of the cell linked list, and constructed before
+ * the neighbor searches are created, e.g. before any relation is updated.
+ */
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+class SparseUpdateCellLinkedList : public UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>
+{
+    typedef UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier> BaseDynamicsType;
+    typedef SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier> EncloserType;
+    using ParticleMask = typename DynamicsIdentifier::ListedParticleMask;
+    UniquePtrsKeeper<DiscreteVariable<UnsignedInt>> buffer_variable_ptrs_;
+
+  protected:
+    UnsignedInt block_shift_;
+    DiscreteVariable<UnsignedInt> *dv_block_size_;
+    UnsignedInt number_of_blocks_;
+    DiscreteVariable<UnsignedInt> *dv_block_offset_;
+    DiscreteVariable<UnsignedInt> *dv_cell_size_;
+
+  public:
+    /** The blocks have 2^block_shift consecutive linear cells. */
+    SparseUpdateCellLinkedList(DynamicsIdentifier &identifier, UnsignedInt block_shift = 6);
+    virtual ~SparseUpdateCellLinkedList() {};
+
+    class ComputingKernel
+    {
+      public:
+        ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void clearOccupiedBlock(UnsignedInt block_n);
+        void incrementCellSize(UnsignedInt index_i);
+        void updateBlockCellOffset(UnsignedInt block_n);
+
+      protected:
+        Mesh mesh_;
+        ParticleMask particle_mask_;
+        UnsignedInt total_number_of_cells_;
+        UnsignedInt block_shift_;
+        UnsignedInt number_of_blocks_;
+
+        Vecd *pos_;
+        UnsignedInt *cell_offset_;
+        UnsignedInt *current_list_size_;
+        UnsignedInt *block_size_;
+        UnsignedInt *block_offset_;
+        UnsignedInt *cell_size_;
+
+        UnsignedInt BlockFirstCell(UnsignedInt block_n) { return block_n << block_shift_; };
+        UnsignedInt BlockEndCell(UnsignedInt block_n)
+        {
+            return SMIN((block_n + 1) << block_shift_, total_number_of_cells_);
+        };
+    };
+
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    Implementation<ExecutionPolicy, EncloserType, ComputingKernel> sparse_kernel_implementation_;
+};
 } // namespace SPH
 #endif // UPDATE_CELL_LINKED_LIST_H
@@ -73,6 +73,7 @@ void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel:
 template <class ExecutionPolicy, typename DynamicsIdentifier>
 void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::exec(Real dt)
 {
+    ScopedDynamicsTimer timer(type_name<UpdateCellLinkedList>(), *this->sph_body_);
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
@@ -103,5 +104,435 @@ void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::exec(Real dt)
                          this->sph_body_->getName());
 }
 //=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::
+    UpdateCellLinkedList(DynamicsIdentifier &identifier)
+    : BaseLocalDynamics<DynamicsIdentifier>(identifier), BaseDynamics<void>(),
+      cell_linked_list_(DynamicCast<MultilevelCellLinkedList>(this, identifier.getCellLinkedList())),
+      meshes_(cell_linked_list_.getMeshes()),
+      reference_cutoff_radius_(this->sph_adaptation_->getKernel()->CutOffRadius()),
+      total_number_of_cells_(cell_linked_list_.TotalNumberOfCells()),
+      cell_offset_list_size_(cell_linked_list_.getCellOffsetListSize()),
+      dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
+      dv_h_ratio_(this->particles_->template getVariableByName<Real>("SmoothingLengthRatio")),
+      dv_mesh_level_(this->particles_->template getVariableByName<int>("ParticleMeshLevel")),
+      dv_particle_index_(cell_linked_list_.dvParticleIndex()),
+      dv_cell_offset_(cell_linked_list_.dvCellOffset()),
+      cell_dv_current_list_size_(
+          cell_linked_list_.template registerCellVariable<UnsignedInt>("CurrentListSize")),
+      identifier_(identifier), kernel_implementation_(*this) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : meshes_(encloser.meshes_), reference_cutoff_radius_(encloser.reference_cutoff_radius_),
+      particle_mask_(ex_policy, encloser.identifier_),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      h_ratio_(encloser.dv_h_ratio_->DelegatedData(ex_policy)),
+      mesh_level_(encloser.dv_mesh_level_->DelegatedData(ex_policy)),
+      particle_index_(encloser.dv_particle_index_->DelegatedData(ex_policy)),
+      cell_offset_(encloser.dv_cell_offset_->DelegatedData(ex_policy)),
+      current_list_size_(encloser.cell_dv_current_list_size_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+UnsignedInt UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::
+    ComputingKernel::LinearCellIndex(UnsignedInt index_i)
+{
+    return meshes_.getMesh(mesh_level_[index_i]).LinearCellIndexFromPosition(pos_[index_i]);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::
+    ComputingKernel::clearAllLists(UnsignedInt index_i)
+{
+    cell_offset_[index_i] = 0;
+    current_list_size_[index_i] = 0;
+    particle_index_[index_i] = 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::
+    ComputingKernel::incrementCellSize(UnsignedInt index_i)
+{
+    if (particle_mask_(index_i))
+    {
+        // Here, particle_index_ takes role of current_list_size_.
+        mesh_level_[index_i] = meshes_.MeshLevel(reference_cutoff_radius_ / h_ratio_[index_i]);
+        AtomicRef<UnsignedInt> atomic_cell_size(particle_index_[LinearCellIndex(index_i)]);
+        ++atomic_cell_size;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::
+    ComputingKernel::updateCellList(UnsignedInt index_i)
+{
+    if (particle_mask_(index_i))
+    {
+        // Here, particle_index_ takes its original role.
+        const UnsignedInt linear_index = LinearCellIndex(index_i);
+        AtomicRef<UnsignedInt> atomic_current_list_size(current_list_size_[linear_index]);
+        particle_index_[cell_offset_[linear_index] + atomic_current_list_size++] = index_i;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void UpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier, MultilevelCellLinkedList>::exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<UpdateCellLinkedList>(), *this->sph_body_);
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_number_of_cells_),
+                 [=](size_t i)
+                 { computing_kernel->clearAllLists(i); });
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->incrementCellSize(i); });
+
+    UnsignedInt *particle_index = this->dv_particle_index_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *cell_offset = this->dv_cell_offset_->DelegatedData(ExecutionPolicy{});
+    exclusive_scan(ExecutionPolicy{}, particle_index, cell_offset,
+                   cell_offset_list_size_,
+                   typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->updateCellList(i); });
+    this->logger_->debug("UpdateCellLinkedList: multilevel updateCellList done at {}.",
+                         this->sph_body_->getName());
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::
+    IncrementalUpdateCellLinkedList(DynamicsIdentifier &identifier, Real full_update_fraction)
+    : BaseDynamicsType(identifier),
+      dv_linear_cell_index_(this->particles_->template registerDiscreteVariable<UnsignedInt>(
+          identifier.getName() + "LinearCellIndex", this->particles_->ParticlesBound())),
+      dv_movers_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "Movers", this->particles_->ParticlesBound())),
+      dv_mover_previous_cell_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "MoverPreviousCell", this->particles_->ParticlesBound())),
+      dv_previous_particle_index_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "PreviousParticleIndex", this->dv_particle_index_->getDataSize())),
+      dv_previous_cell_offset_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "PreviousCellOffset", this->cell_offset_list_size_)),
+      dv_cell_size_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "CellSize", this->cell_offset_list_size_)),
+      sv_total_movers_("TotalMovers", UnsignedInt(0)),
+      full_update_fraction_(full_update_fraction), is_full_update_requested_(true),
+      total_real_particles_at_update_(0), incremental_kernel_implementation_(*this) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : mesh_(encloser.mesh_), particle_mask_(ex_policy, encloser.identifier_),
+      total_number_of_cells_(encloser.total_number_of_cells_),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      particle_index_(encloser.dv_particle_index_->DelegatedData(ex_policy)),
+      cell_offset_(encloser.dv_cell_offset_->DelegatedData(ex_policy)),
+      current_list_size_(encloser.cell_dv_current_list_size_->DelegatedData(ex_policy)),
+      linear_cell_index_(encloser.dv_linear_cell_index_->DelegatedData(ex_policy)),
+      movers_(encloser.dv_movers_->DelegatedData(ex_policy)),
+      mover_previous_cell_(encloser.dv_mover_previous_cell_->DelegatedData(ex_policy)),
+      previous_particle_index_(encloser.dv_previous_particle_index_->DelegatedData(ex_policy)),
+      previous_cell_offset_(encloser.dv_previous_cell_offset_->DelegatedData(ex_policy)),
+      cell_size_(encloser.dv_cell_size_->DelegatedData(ex_policy)),
+      total_movers_(encloser.sv_total_movers_.DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+UnsignedInt IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    currentLinearCellIndex(UnsignedInt index_i)
+{
+    return particle_mask_(index_i) ? mesh_.LinearCellIndexFromPosition(pos_[index_i])
+                                   : total_number_of_cells_;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    recordLinearCellIndex(UnsignedInt index_i)
+{
+    linear_cell_index_[index_i] = currentLinearCellIndex(index_i);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    identifyMover(UnsignedInt index_i)
+{
+    const UnsignedInt linear_index = currentLinearCellIndex(index_i);
+    if (linear_index != linear_cell_index_[index_i])
+    {
+        AtomicRef<UnsignedInt> atomic_total_movers(*total_movers_);
+        const UnsignedInt mover_n = atomic_total_movers++;
+        movers_[mover_n] = index_i;
+        mover_previous_cell_[mover_n] = linear_cell_index_[index_i];
+        linear_cell_index_[index_i] = linear_index;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    copyPreviousParticleIndex(UnsignedInt index_i)
+{
+    previous_particle_index_[index_i] = particle_index_[index_i];
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    copyPreviousCellOffset(UnsignedInt index_i)
+{
+    previous_cell_offset_[index_i] = cell_offset_[index_i];
+    cell_size_[index_i] = index_i < total_number_of_cells_
+                              ? cell_offset_[index_i + 1] - cell_offset_[index_i]
+                              : 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    updateCellSizeByMover(UnsignedInt mover_n)
+{
+    const UnsignedInt previous_cell = mover_previous_cell_[mover_n];
+    if (previous_cell != total_number_of_cells_)
+    {
+        AtomicRef<UnsignedInt> atomic_previous_cell_size(cell_size_[previous_cell]);
+        --atomic_previous_cell_size;
+    }
+
+    const UnsignedInt current_cell = linear_cell_index_[movers_[mover_n]];
+    if (current_cell != total_number_of_cells_)
+    {
+        AtomicRef<UnsignedInt> atomic_current_cell_size(cell_size_[current_cell]);
+        ++atomic_current_cell_size;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    retainCellList(UnsignedInt index_i)
+{
+    // Here, index_i is the linear cell index and only the particles still in the cell are retained.
+    UnsignedInt list_size = 0;
+    for (UnsignedInt n = previous_cell_offset_[index_i]; n != previous_cell_offset_[index_i + 1]; ++n)
+    {
+        const UnsignedInt particle_index = previous_particle_index_[n];
+        if (linear_cell_index_[particle_index] == index_i)
+        {
+            particle_index_[cell_offset_[index_i] + list_size] = particle_index;
+            list_size++;
+        }
+    }
+    current_list_size_[index_i] = list_size;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    insertMover(UnsignedInt mover_n)
+{
+    const UnsignedInt particle_index = movers_[mover_n];
+    const UnsignedInt current_cell = linear_cell_index_[particle_index];
+    if (current_cell != total_number_of_cells_)
+    {
+        AtomicRef<UnsignedInt> atomic_current_list_size(current_list_size_[current_cell]);
+        particle_index_[cell_offset_[current_cell] + atomic_current_list_size++] = particle_index;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::fullUpdate()
+{
+    BaseDynamicsType::exec();
+
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = incremental_kernel_implementation_.getComputingKernel();
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->recordLinearCellIndex(i); });
+
+    total_real_particles_at_update_ = total_real_particles;
+    is_full_update_requested_ = false;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<IncrementalUpdateCellLinkedList>(), *this->sph_body_);
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    if (is_full_update_requested_ || total_real_particles != total_real_particles_at_update_)
+    {
+        fullUpdate();
+        return;
+    }
+
+    ComputingKernel *computing_kernel = incremental_kernel_implementation_.getComputingKernel();
+    sv_total_movers_.setValue(0);
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->identifyMover(i); });
+
+    UnsignedInt total_movers = sv_total_movers_.getValue();
+    if (total_movers == 0)
+    {
+        return;
+    }
+
+    if (Real(total_movers) > full_update_fraction_ * Real(total_real_particles))
+    {
+        fullUpdate();
+        return;
+    }
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->copyPreviousParticleIndex(i); });
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, this->cell_offset_list_size_),
+                 [=](size_t i)
+                 { computing_kernel->copyPreviousCellOffset(i); });
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_movers),
+                 [=](size_t i)
+                 { computing_kernel->updateCellSizeByMover(i); });
+
+    UnsignedInt *cell_size = dv_cell_size_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *cell_offset = this->dv_cell_offset_->DelegatedData(ExecutionPolicy{});
+    exclusive_scan(ExecutionPolicy{}, cell_size, cell_offset,
+                   this->cell_offset_list_size_,
+                   typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, this->total_number_of_cells_),
+                 [=](size_t i)
+                 { computing_kernel->retainCellList(i); });
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_movers),
+                 [=](size_t i)
+                 { computing_kernel->insertMover(i); });
+    this->logger_->debug("IncrementalUpdateCellLinkedList: {} movers updated at {}.",
+                         total_movers, this->sph_body_->getName());
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::
+    SparseUpdateCellLinkedList(DynamicsIdentifier &identifier, UnsignedInt block_shift)
+    : BaseDynamicsType(identifier), block_shift_(block_shift),
+      dv_block_size_(this->cell_linked_list_.enableCellBlocks(block_shift)),
+      number_of_blocks_(this->cell_linked_list_.NumberOfBlocks()),
+      dv_block_offset_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "BlockOffset", number_of_blocks_ + 1)),
+      dv_cell_size_(buffer_variable_ptrs_.createPtr<DiscreteVariable<UnsignedInt>>(
+          "CellSize", this->total_number_of_cells_)),
+      sparse_kernel_implementation_(*this) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : mesh_(encloser.mesh_), particle_mask_(ex_policy, encloser.identifier_),
+      total_number_of_cells_(encloser.total_number_of_cells_),
+      block_shift_(encloser.block_shift_), number_of_blocks_(encloser.number_of_blocks_),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      cell_offset_(encloser.dv_cell_offset_->DelegatedData(ex_policy)),
+      current_list_size_(encloser.cell_dv_current_list_size_->DelegatedData(ex_policy)),
+      block_size_(encloser.dv_block_size_->DelegatedData(ex_policy)),
+      block_offset_(encloser.dv_block_offset_->DelegatedData(ex_policy)),
+      cell_size_(encloser.dv_cell_size_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    clearOccupiedBlock(UnsignedInt block_n)
+{
+    if (block_size_[block_n] != 0)
+    {
+        for (UnsignedInt i = BlockFirstCell(block_n); i != BlockEndCell(block_n); ++i)
+        {
+            cell_size_[i] = 0;
+            current_list_size_[i] = 0;
+        }
+        block_size_[block_n] = 0;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    incrementCellSize(UnsignedInt index_i)
+{
+    if (particle_mask_(index_i))
+    {
+        const UnsignedInt linear_index = mesh_.LinearCellIndexFromPosition(pos_[index_i]);
+        AtomicRef<UnsignedInt> atomic_cell_size(cell_size_[linear_index]);
+        ++atomic_cell_size;
+        AtomicRef<UnsignedInt> atomic_block_size(block_size_[linear_index >> block_shift_]);
+        ++atomic_block_size;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::ComputingKernel::
+    updateBlockCellOffset(UnsignedInt block_n)
+{
+    if (block_size_[block_n] != 0)
+    {
+        UnsignedInt offset = block_offset_[block_n];
+        for (UnsignedInt i = BlockFirstCell(block_n); i != BlockEndCell(block_n); ++i)
+        {
+            cell_offset_[i] = offset;
+            offset += cell_size_[i];
+        }
+        // the end of the last cell is given here if the next block is empty and not updated
+        if (block_n + 1 == number_of_blocks_ || block_size_[block_n + 1] == 0)
+        {
+            cell_offset_[BlockEndCell(block_n)] = offset;
+        }
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename DynamicsIdentifier>
+void SparseUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>::exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<SparseUpdateCellLinkedList>(), *this->sph_body_);
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = sparse_kernel_implementation_.getComputingKernel();
+    typename BaseDynamicsType::ComputingKernel *base_kernel =
+        this->kernel_implementation_.getComputingKernel();
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, number_of_blocks_),
+                 [=](size_t i)
+                 { computing_kernel->clearOccupiedBlock(i); });
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->incrementCellSize(i); });
+
+    // the last block size is always zero, so that the offsets have the number of blocks plus one
+    UnsignedInt *block_size = dv_block_size_->DelegatedData(ExecutionPolicy{});
+    UnsignedInt *block_offset = dv_block_offset_->DelegatedData(ExecutionPolicy{});
+    exclusive_scan(ExecutionPolicy{}, block_size, block_offset,
+                   number_of_blocks_ + 1,
+                   typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, number_of_blocks_),
+                 [=](size_t i)
+                 { computing_kernel->updateBlockCellOffset(i); });
+
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { base_kernel->updateCellList(i); });
+    this->logger_->debug("SparseUpdateCellLinkedList: updateCellList done at {}.",
+                         this->sph_body_->getName());
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // UPDATE_CELL_LINKED_LIST_HPP
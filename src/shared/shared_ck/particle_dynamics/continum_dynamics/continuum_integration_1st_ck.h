@@ -90,7 +90,8 @@ class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
       protected:
         KernelCorrectionType correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *p_, *drho_dt_, *mass_;
+        Real *Vol_, *rho_, *p_, *drho_dt_;
+        const Real *mass_;
         Vecd *force_;
         Mat3d *stress_tensor_3D_;
     };
@@ -103,7 +104,7 @@ class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
         void update(size_t index_i, Real dt = 0.0);
 
       protected:
-        Real *mass_;
+        const Real *mass_;
         Vecd *vel_, *force_, *force_prior_;
     };
 
@@ -132,7 +133,8 @@ class PlasticAcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrecti
       protected:
         KernelCorrectionType correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *mass_, *p_, *drho_dt_;
+        Real *Vol_, *rho_, *p_, *drho_dt_;
+        const Real *mass_;
         Vecd *force_, *force_prior_;
         Mat3d *stress_tensor_3D_;
 
@@ -53,7 +53,7 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Real density_change_rate(0);
     Vecd p_dissipation = Vecd::Zero();
     Matd velocity_gradient = Matd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
@@ -129,7 +129,7 @@ void PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectio
     Vecd p_dissipation = Vecd::Zero();
     Vecd vel_i = vel_[index_i];
     Matd velocity_gradient = Matd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd e_ij = this->e_ij(index_i, index_j);
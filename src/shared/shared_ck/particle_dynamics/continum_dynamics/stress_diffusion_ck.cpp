@@ -0,0 +1,22 @@
+#include "stress_diffusion_ck.h"
+
+namespace SPH
+{
+namespace continuum_dynamics
+{
+//=================================================================================================//
+InlineStressDiffusionCK::InlineStressDiffusionCK(SPHBody &sph_body)
+    : smoothing_length_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()),
+      dv_mass_(sph_body.getBaseParticles().getVariableByName<Real>("Mass")),
+      dv_pos_(sph_body.getBaseParticles().getVariableByName<Vecd>("Position")),
+      dv_force_prior_(sph_body.getBaseParticles().registerStateVariable<Vecd>("ForcePrior")),
+      dv_stress_tensor_3D_(sph_body.getBaseParticles().registerStateVariable<Mat3d>("StressTensor3D"))
+{
+    PlasticContinuum &plastic_continuum = DynamicCast<PlasticContinuum>(this, sph_body.getBaseMaterial());
+    phi_ = plastic_continuum.getFrictionAngle();
+    sound_speed_ = plastic_continuum.ReferenceSoundSpeed();
+    density_ = plastic_continuum.getDensity();
+}
+//=================================================================================================//
+} // namespace continuum_dynamics
+} // namespace SPH
@@ -41,14 +41,50 @@ namespace SPH
 {
 namespace continuum_dynamics
 {
+/**
+ * @class InlineStressDiffusionCK
+ * @brief The pairwise stress diffusion evaluated inline in a neighbor loop
+ * by the stress diffusion itself or fused into the first half step, see PlasticAcousticStep1stHalf.
+ */
+class InlineStressDiffusionCK
+{
+  public:
+    explicit InlineStressDiffusionCK(SPHBody &sph_body);
+    ~InlineStressDiffusionCK() {};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, InlineStressDiffusionCK &encloser);
+        /** The gravity acceleration estimated from the prior force of the particle. */
+        Real GravityAcceleration(size_t index_i) { return abs((force_prior_[index_i] / mass_[index_i])(1, 0)); };
+        Mat3d operator()(size_t index_i, size_t index_j, Real gravity, Real r_ij, Real dW_ijV_j);
+
+      protected:
+        Real zeta_, phi_;
+        Real smoothing_length_, sound_speed_, density_;
+        const Real *mass_;
+        Vecd *pos_, *force_prior_;
+        Mat3d *stress_tensor_3D_;
+    };
+
+  protected:
+    Real zeta_ = 0.1, phi_; /*diffusion coefficient*/
+    Real smoothing_length_, sound_speed_, density_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<Vecd> *dv_pos_, *dv_force_prior_;
+    DiscreteVariable<Mat3d> *dv_stress_tensor_3D_;
+};
+
 template <typename...>
 class StressDiffusionCK;
 
 template <typename... Parameters>
 class StressDiffusionCK<Inner<Parameters...>> : public PlasticAcousticStep<Interaction<Inner<Parameters...>>>
 {
-    using PlasticKernel = typename PlasticContinuum::PlasticKernel;
     using BaseInteraction = PlasticAcousticStep<Interaction<Inner<Parameters...>>>;
+    using StressDiffusionKernel = typename InlineStressDiffusionCK::ComputingKernel;
 
   public:
     explicit StressDiffusionCK(Inner<Parameters...> &inner_relation);
@@ -62,21 +98,56 @@ class StressDiffusionCK<Inner<Parameters...>> : public PlasticAcousticStep<Inter
         void interact(size_t index_i, Real dt = 0.0);
 
       protected:
-        PlasticKernel plastic_kernel_;
-        Real zeta_, phi_;
-        Real smoothing_length_, sound_speed_;
-        Real *mass_, *Vol_;
-        Vecd *pos_, *force_prior_;
-        Mat3d *stress_tensor_3D_, *stress_rate_3D_;
+        StressDiffusionKernel stress_diffusion_;
+        Real *Vol_;
+        Mat3d *stress_rate_3D_;
     };
 
   protected:
-    Real dv_zeta_ = 0.1, dv_phi_; /*diffusion coefficient*/
-    Real dv_smoothing_length_, dv_sound_speed_;
-    DiscreteVariable<Vecd> *dv_pos_;
+    InlineStressDiffusionCK stress_diffusion_method_;
 };
 
 using StressDiffusionInnerCK = StressDiffusionCK<Inner<>>;
+/**
+ * The stress diffusion is fused into the neighbor loop of the first half step.
+ * Note that the stress diffusion has to be evaluated from the stress tensor
+ * before the update in the second half step and its stress rate is only used by that update.
+ * As the first half step does not change the stress tensor, the positions and the prior forces,
+ * the results are identical to those given by a separate StressDiffusionCK right before the first half step,
+ * which is not the case for fusing into the second half step.
+ */
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType,
+                                       InlineStressDiffusionCK, Parameters...>>
+    : public PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>
+{
+    using BaseDynamicsType =
+        PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>;
+    using StressDiffusionKernel = typename InlineStressDiffusionCK::ComputingKernel;
+
+  public:
+    explicit PlasticAcousticStep1stHalf(Inner<Parameters...> &inner_relation);
+    virtual ~PlasticAcousticStep1stHalf() {};
+
+    class InteractKernel : public BaseDynamicsType::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        StressDiffusionKernel stress_diffusion_;
+        Mat3d *stress_rate_3D_;
+    };
+
+  protected:
+    InlineStressDiffusionCK stress_diffusion_method_;
+};
+
+using PlasticAcousticStep1stHalfWithWallRiemannStressDiffusionCK =
+    PlasticAcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolverCK, NoKernelCorrection, InlineStressDiffusionCK>,
+                               Contact<Wall, AcousticRiemannSolverCK, NoKernelCorrection>>;
 } // namespace continuum_dynamics
 } // namespace SPH
 #endif // STRESS_DIFFUSION_CK_H
\ No newline at end of file
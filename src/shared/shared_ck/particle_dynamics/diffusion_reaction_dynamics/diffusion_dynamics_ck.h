@@ -122,7 +122,7 @@ class DiffusionRelaxationCK<Inner<InteractionOnly, DiffusionType, KernelCorrecti
 
   protected:
     KernelCorrectionType kernel_correction_method_;
-    ConstantArray<InterParticleDiffusionCoeff> ca_inter_particle_diffusion_coeff_;
+    PolicyConstantArray<InterParticleDiffusionCoeff, DiffusionType> ca_inter_particle_diffusion_coeff_;
     Real smoothing_length_sq_;
 };
 
@@ -278,7 +278,7 @@ class Dirichlet<DiffusionType>
     Real smoothing_length_sq_;
     DiscreteVariableArray<Real> &dv_gradient_species_array_;
     DiscreteVariableArray<Real> contact_dv_gradient_species_array_;
-    ConstantArray<InterParticleDiffusionCoeff> ca_inter_particle_diffusion_coeff_;
+    PolicyConstantArray<InterParticleDiffusionCoeff, DiffusionType> ca_inter_particle_diffusion_coeff_;
 };
 
 template <class DiffusionType>
@@ -118,22 +118,22 @@ template <class DiffusionType, class KernelCorrectionType, class... Parameters>
 void DiffusionRelaxationCK<Inner<InteractionOnly, DiffusionType, KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(UnsignedInt index_i, Real dt)
 {
-    for (UnsignedInt m = 0; m < this->number_of_species_; ++m)
+    // The pair geometry is evaluated once for all species.
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
-        Real d_species = 0.0;
-        for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-        {
-            UnsignedInt index_j = this->neighbor_index_[n];
-            Real dW_ijV_j = this->dW_ij(index_i, index_j) * this->Vol_[index_j];
-            Vecd e_ij = this->e_ij(index_i, index_j);
-            Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real dW_ijV_j = this->dW_ij(index_i, index_j) * this->Vol_[index_j];
+        Vecd e_ij = this->e_ij(index_i, index_j);
+        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
 
-            Vecd surface_area = dW_ijV_j * (correction_(index_i) + correction_(index_j)) * e_ij;
-            Vecd derivative = (this->gradient_species_[m][index_i] - this->gradient_species_[m][index_j]) *
-                              vec_r_ij / (vec_r_ij.squaredNorm() + 0.01 * this->smoothing_length_sq_);
-            d_species += (inter_particle_diffusion_coeff_[m](index_i, index_j, e_ij) * derivative).dot(surface_area);
+        Vecd surface_area = dW_ijV_j * (correction_(index_i) + correction_(index_j)) * e_ij;
+        Vecd scaled_r_ij = vec_r_ij / (vec_r_ij.squaredNorm() + 0.01 * this->smoothing_length_sq_);
+        for (UnsignedInt m = 0; m < this->number_of_species_; ++m)
+        {
+            Vecd derivative = (this->gradient_species_[m][index_i] - this->gradient_species_[m][index_j]) * scaled_r_ij;
+            this->diffusion_dt_[m][index_i] +=
+                (inter_particle_diffusion_coeff_[m](index_i, index_j, e_ij) * derivative).dot(surface_area);
         }
-        this->diffusion_dt_[m][index_i] += d_species;
     }
 }
 //=================================================================================================//
@@ -173,16 +173,25 @@ void DiffusionRelaxationCK<Contact<InteractionOnly, BoundaryType<DiffusionType>,
     for (UnsignedInt m = 0; m < this->number_of_species_; ++m)
     {
         contact_transfer_[m][index_i] = 0.0;
-        for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-        {
-            UnsignedInt index_j = this->neighbor_index_[n];
-            Real dW_ijV_j = this->dW_ij(index_i, index_j) * this->contact_Vol_[index_j];
-            Vecd e_ij = this->e_ij(index_i, index_j);
-            Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
+    }
+
+    // The pair geometry is evaluated once for all species.
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real dW_ijV_j = this->dW_ij(index_i, index_j) * this->contact_Vol_[index_j];
+        Vecd e_ij = this->e_ij(index_i, index_j);
+        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
 
-            Vecd surface_area = 2.0 * dW_ijV_j * correction_(index_i) * e_ij;
+        Vecd surface_area = 2.0 * dW_ijV_j * correction_(index_i) * e_ij;
+        for (UnsignedInt m = 0; m < this->number_of_species_; ++m)
+        {
             contact_transfer_[m][index_i] += boundary_flux_(m, index_i, index_j, e_ij, vec_r_ij).dot(surface_area);
         }
+    }
+
+    for (UnsignedInt m = 0; m < this->number_of_species_; ++m)
+    {
         this->diffusion_dt_[m][index_i] += contact_transfer_[m][index_i];
     }
 }
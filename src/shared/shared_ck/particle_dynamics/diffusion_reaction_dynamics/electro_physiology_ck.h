@@ -0,0 +1,107 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    electro_physiology_ck.h
+ * @brief   The mono-field electrophysiology pipeline for computing kernels.
+ * @details The trans-membrane voltage is diffused with the fiber-aligned
+ *          local directional diffusion and reacted with the Aliev-Panfilow model,
+ *          both on the execution policy of the kernels. The activation time is
+ *          recorded on the same policy so that it is not copied back every step.
+ * @author  Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef ELECTRO_PHYSIOLOGY_CK_H
+#define ELECTRO_PHYSIOLOGY_CK_H
+
+#include "base_general_dynamics.h"
+#include "electro_physiology.h"
+#include "reaction_dynamics_ck.h"
+
+namespace SPH
+{
+namespace electro_physiology
+{
+/**
+ * @class ActivationTimeCK
+ * @brief Record the physical time at which the voltage of a particle
+ * exceeds the threshold for the first time. Not yet activated particles have negative values.
+ */
+template <class DynamicsIdentifier>
+class ActivationTimeCK : public BaseLocalDynamics<DynamicsIdentifier>
+{
+  public:
+    ActivationTimeCK(DynamicsIdentifier &identifier, Real threshold_voltage)
+        : BaseLocalDynamics<DynamicsIdentifier>(identifier),
+          sv_physical_time_(this->sph_system_->template getSystemVariableByName<Real>("PhysicalTime")),
+          dv_voltage_(this->particles_->template getVariableByName<Real>("Voltage")),
+          dv_activation_time_(this->particles_->template registerStateVariable<Real>("ActivationTime", Real(-1))),
+          threshold_voltage_(threshold_voltage)
+    {
+        this->particles_->template addVariableToWrite<Real>("ActivationTime");
+    };
+    virtual ~ActivationTimeCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : physical_time_(encloser.sv_physical_time_->DelegatedData(ex_policy)),
+              voltage_(encloser.dv_voltage_->DelegatedData(ex_policy)),
+              activation_time_(encloser.dv_activation_time_->DelegatedData(ex_policy)),
+              threshold_voltage_(encloser.threshold_voltage_){};
+
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            if (activation_time_[index_i] < 0.0 && voltage_[index_i] > threshold_voltage_)
+            {
+                activation_time_[index_i] = *physical_time_;
+            }
+        };
+
+      protected:
+        Real *physical_time_;
+        Real *voltage_;
+        Real *activation_time_;
+        Real threshold_voltage_;
+    };
+
+  protected:
+    SingularVariable<Real> *sv_physical_time_;
+    DiscreteVariable<Real> *dv_voltage_;
+    DiscreteVariable<Real> *dv_activation_time_;
+    Real threshold_voltage_;
+};
+
+/** Solve the reaction ODE equation of trans-membrane potential using forward sweeping */
+using AlievPanfilowReactionForwardCK = ReactionRelaxationForwardCK<AlievPanfilowModel>;
+/** Solve the reaction ODE equation of trans-membrane potential using backward sweeping */
+using AlievPanfilowReactionBackwardCK = ReactionRelaxationBackwardCK<AlievPanfilowModel>;
+/** Solve the reaction ODE equation of trans-membrane potential with symmetric half steps */
+using AlievPanfilowReactionSymmetricCK = ReactionRelaxationSymmetricCK<AlievPanfilowModel>;
+/** The fiber-aligned diffusion of the mono-field model on cardiac meshes,
+ *  used as addRK2Sequence<DiffusionRelaxationCK, MonoFieldDiffusionCK, LinearCorrectionCK> */
+using MonoFieldDiffusionCK = LocalDirectionalDiffusion;
+} // namespace electro_physiology
+} // namespace SPH
+#endif // ELECTRO_PHYSIOLOGY_CK_H
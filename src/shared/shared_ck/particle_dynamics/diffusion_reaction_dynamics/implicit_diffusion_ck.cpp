@@ -0,0 +1,65 @@
+#include "implicit_diffusion_ck.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+ImplicitDiffusionVariables::
+    ImplicitDiffusionVariables(SPHBody &sph_body, AbstractDiffusion &abstract_diffusion)
+    : diffusion_species_names_(obtainDiffusionSpeciesNames(abstract_diffusion)),
+      dv_diffusion_species_array_(sph_body.getBaseParticles().registerStateVariables<Real>(
+          diffusion_species_names_, "")),
+      dv_diffusion_dt_array_(sph_body.getBaseParticles().registerStateVariables<Real>(
+          diffusion_species_names_, "ChangeRate")),
+      dv_residual_(sph_body.getBaseParticles().registerDiscreteVariable<Real>(
+          "ImplicitDiffusionResidual", sph_body.getBaseParticles().ParticlesBound())),
+      dv_preconditioned_residual_(sph_body.getBaseParticles().registerDiscreteVariable<Real>(
+          "ImplicitDiffusionPreconditionedResidual", sph_body.getBaseParticles().ParticlesBound())),
+      dv_search_direction_(sph_body.getBaseParticles().registerDiscreteVariable<Real>(
+          "ImplicitDiffusionSearchDirection", sph_body.getBaseParticles().ParticlesBound())),
+      dv_operator_product_(sph_body.getBaseParticles().registerDiscreteVariable<Real>(
+          "ImplicitDiffusionOperatorProduct", sph_body.getBaseParticles().ParticlesBound())),
+      dv_diagonal_(sph_body.getBaseParticles().registerDiscreteVariable<Real>(
+          "ImplicitDiffusionDiagonal", sph_body.getBaseParticles().ParticlesBound())),
+      sv_species_index_(sph_body.getBaseParticles().registerSingularVariable<UnsignedInt>(
+          "ImplicitDiffusionSpeciesIndex")),
+      sv_step_size_(sph_body.getBaseParticles().registerSingularVariable<Real>(
+          "ImplicitDiffusionStepSize")),
+      sv_direction_ratio_(sph_body.getBaseParticles().registerSingularVariable<Real>(
+          "ImplicitDiffusionDirectionRatio")) {}
+//=================================================================================================//
+StdVec<std::string> ImplicitDiffusionVariables::
+    obtainDiffusionSpeciesNames(AbstractDiffusion &abstract_diffusion)
+{
+    StdVec<std::string> diffusion_species_names;
+    for (auto &diffusion : abstract_diffusion.AllDiffusions())
+    {
+        BaseDiffusion *base_diffusion = DynamicCast<BaseDiffusion>(this, diffusion);
+        if (base_diffusion->DiffusionSpeciesName() != base_diffusion->GradientSpeciesName())
+        {
+            std::cout << "\n Error: the implicit diffusion requires identical diffusion and gradient species, "
+                      << "which is not the case for " << base_diffusion->DiffusionSpeciesName() << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        diffusion_species_names.push_back(base_diffusion->DiffusionSpeciesName());
+    }
+    return diffusion_species_names;
+}
+//=================================================================================================//
+ImplicitDiffusionCurvatureCK::
+    ImplicitDiffusionCurvatureCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion)
+    : LocalDynamicsReduce<ReduceSum<Real>>(sph_body), ImplicitDiffusionVariables(sph_body, *abstract_diffusion) {}
+//=================================================================================================//
+ImplicitDiffusionResidualNormCK::
+    ImplicitDiffusionResidualNormCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion)
+    : LocalDynamicsReduce<ReduceSum<std::pair<Real, Real>>>(sph_body), ImplicitDiffusionVariables(sph_body, *abstract_diffusion) {}
+//=================================================================================================//
+ImplicitDiffusionStepCK::
+    ImplicitDiffusionStepCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion)
+    : LocalDynamics(sph_body), ImplicitDiffusionVariables(sph_body, *abstract_diffusion) {}
+//=================================================================================================//
+ImplicitDiffusionDirectionCK::
+    ImplicitDiffusionDirectionCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion)
+    : LocalDynamics(sph_body), ImplicitDiffusionVariables(sph_body, *abstract_diffusion) {}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,336 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    implicit_diffusion_ck.h
+ * @brief   Implicit diffusion by the theta scheme, i.e. backward Euler for theta = 1
+ *          and Crank-Nicolson for theta = 0.5, so that the time step is not limited
+ *          by the diffusion stability condition.
+ * @details Scaled by the particle volumes and the inverse volumetric capacities,
+ *          the linear system is symmetric positive definite and solved by
+ *          the Jacobi preconditioned conjugate gradient method species by species.
+ *          The sparse matrix has the pattern of the inner neighbor list,
+ *          i.e. particle offsets and neighbor indices as the row offsets and column indices
+ *          of a CSR matrix. The matrix coefficients are evaluated on the fly in each product,
+ *          as the neighbor list is reallocated with the relation update.
+ *          The change rates accumulated before the solution, e.g. by the contact
+ *          interactions for boundary conditions, are treated explicitly and reset afterwards.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef IMPLICIT_DIFFUSION_CK_H
+#define IMPLICIT_DIFFUSION_CK_H
+
+#include "diffusion_reaction.h"
+#include "interaction_algorithms_ck.hpp"
+#include "simple_algorithms_ck.h"
+#include "sphinxsys_constant.h"
+#include "sphinxsys_variable_array.h"
+
+namespace SPH
+{
+/**
+ * @class ImplicitDiffusionVariables
+ * @brief The variables of the species, the solver vectors of the present species
+ * and the solver scalars shared by the local dynamics of the implicit diffusion.
+ */
+class ImplicitDiffusionVariables
+{
+    StdVec<std::string> obtainDiffusionSpeciesNames(AbstractDiffusion &abstract_diffusion);
+
+  public:
+    ImplicitDiffusionVariables(SPHBody &sph_body, AbstractDiffusion &abstract_diffusion);
+    virtual ~ImplicitDiffusionVariables() {};
+    StdVec<std::string> &getDiffusionSpeciesNames() { return diffusion_species_names_; };
+    SingularVariable<UnsignedInt> *svSpeciesIndex() { return sv_species_index_; };
+    SingularVariable<Real> *svStepSize() { return sv_step_size_; };
+    SingularVariable<Real> *svDirectionRatio() { return sv_direction_ratio_; };
+
+  protected:
+    StdVec<std::string> diffusion_species_names_;
+    DiscreteVariableArray<Real> dv_diffusion_species_array_;
+    DiscreteVariableArray<Real> dv_diffusion_dt_array_;
+    DiscreteVariable<Real> *dv_residual_;
+    DiscreteVariable<Real> *dv_preconditioned_residual_;
+    DiscreteVariable<Real> *dv_search_direction_;
+    DiscreteVariable<Real> *dv_operator_product_;
+    DiscreteVariable<Real> *dv_diagonal_;
+    SingularVariable<UnsignedInt> *sv_species_index_;
+    SingularVariable<Real> *sv_step_size_;
+    SingularVariable<Real> *sv_direction_ratio_;
+};
+
+template <typename... T>
+class ImplicitDiffusionCK;
+
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+class ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>
+    : public Interaction<Inner<Parameters...>>, public ImplicitDiffusionVariables
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+    using CorrectionKernel = typename KernelCorrectionType::ComputingKernel;
+    using InverseVolumetricCapacity = typename DiffusionType::InverseVolumetricCapacity;
+    using InterParticleDiffusionCoeff = typename DiffusionType::InterParticleDiffusionCoeff;
+    StdVec<DiffusionType *> obtainConcreteDiffusions(AbstractDiffusion &abstract_diffusion);
+
+  public:
+    ImplicitDiffusionCK(Inner<Parameters...> &inner_relation, AbstractDiffusion *abstract_diffusion, Real theta);
+    virtual ~ImplicitDiffusionCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+      protected:
+        CorrectionKernel correction_;
+        InverseVolumetricCapacity *cv1_;
+        InterParticleDiffusionCoeff *inter_particle_diffusion_coeff_;
+        Real *Vol_;
+        Real smoothing_length_sq_;
+        Real theta_;
+        DataArray<Real> *diffusion_species_, *diffusion_dt_;
+        Real *residual_, *preconditioned_residual_, *search_direction_, *operator_product_, *diagonal_;
+        UnsignedInt *species_index_;
+        /** The non-negative transfer coefficient with which the explicit change rate of particle i
+         *  is the sum of the coefficients multiplied by the species differences from j to i. */
+        Real transferCoefficient(UnsignedInt m, UnsignedInt index_i, UnsignedInt index_j);
+    };
+
+  protected:
+    StdVec<DiffusionType *> diffusions_;
+    KernelCorrectionType kernel_correction_method_;
+    ConstantArray<InverseVolumetricCapacity> ca_inverse_volume_capacity_;
+    PolicyConstantArray<InterParticleDiffusionCoeff, DiffusionType> ca_inter_particle_diffusion_coeff_;
+    Real smoothing_length_sq_;
+    Real theta_;
+};
+
+/**
+ * @class ImplicitDiffusionResidualCK
+ * @brief The initial residual with the present species as the initial guess,
+ * which is also the initial search direction after preconditioning,
+ * and the diagonal of the matrix as the preconditioner.
+ */
+template <typename... T>
+class ImplicitDiffusionResidualCK;
+
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+class ImplicitDiffusionResidualCK<Inner<DiffusionType, KernelCorrectionType, Parameters...>>
+    : public ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>
+{
+    using BaseDynamicsType = ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>;
+
+  public:
+    template <typename... Args>
+    ImplicitDiffusionResidualCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ImplicitDiffusionResidualCK() {};
+
+    class InteractKernel : public BaseDynamicsType::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::InteractKernel(ex_policy, encloser){};
+        void interact(UnsignedInt index_i, Real dt = 0.0);
+    };
+};
+
+/**
+ * @class ImplicitDiffusionProductCK
+ * @brief The product of the matrix and the search direction.
+ */
+template <typename... T>
+class ImplicitDiffusionProductCK;
+
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+class ImplicitDiffusionProductCK<Inner<DiffusionType, KernelCorrectionType, Parameters...>>
+    : public ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>
+{
+    using BaseDynamicsType = ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>;
+
+  public:
+    template <typename... Args>
+    ImplicitDiffusionProductCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ImplicitDiffusionProductCK() {};
+
+    class InteractKernel : public BaseDynamicsType::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::InteractKernel(ex_policy, encloser){};
+        void interact(UnsignedInt index_i, Real dt = 0.0);
+    };
+};
+
+/**
+ * @class ImplicitDiffusionCurvatureCK
+ * @brief The inner product of the search direction and the matrix product,
+ * which gives the step size along the search direction.
+ */
+class ImplicitDiffusionCurvatureCK
+    : public LocalDynamicsReduce<ReduceSum<Real>>, public ImplicitDiffusionVariables
+{
+  public:
+    ImplicitDiffusionCurvatureCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion);
+    virtual ~ImplicitDiffusionCurvatureCK() {};
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        Real reduce(size_t index_i, Real dt = 0.0)
+        {
+            return search_direction_[index_i] * operator_product_[index_i];
+        };
+
+      protected:
+        Real *search_direction_, *operator_product_;
+    };
+};
+
+/**
+ * @class ImplicitDiffusionResidualNormCK
+ * @brief The inner products of the residual with the preconditioned residual and itself.
+ */
+class ImplicitDiffusionResidualNormCK
+    : public LocalDynamicsReduce<ReduceSum<std::pair<Real, Real>>>, public ImplicitDiffusionVariables
+{
+    using ReduceReturnType = std::pair<Real, Real>;
+
+  public:
+    ImplicitDiffusionResidualNormCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion);
+    virtual ~ImplicitDiffusionResidualNormCK() {};
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        ReduceReturnType reduce(size_t index_i, Real dt = 0.0)
+        {
+            return ReduceReturnType(residual_[index_i] * preconditioned_residual_[index_i],
+                                    residual_[index_i] * residual_[index_i]);
+        };
+
+      protected:
+        Real *residual_, *preconditioned_residual_;
+    };
+};
+
+/**
+ * @class ImplicitDiffusionStepCK
+ * @brief Advance the species along the search direction, update the residual and precondition it.
+ */
+class ImplicitDiffusionStepCK : public LocalDynamics, public ImplicitDiffusionVariables
+{
+  public:
+    ImplicitDiffusionStepCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion);
+    virtual ~ImplicitDiffusionStepCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            UnsignedInt m = *species_index_;
+            diffusion_species_[m][index_i] += *step_size_ * search_direction_[index_i];
+            residual_[index_i] -= *step_size_ * operator_product_[index_i];
+            preconditioned_residual_[index_i] = residual_[index_i] / diagonal_[index_i];
+        };
+
+      protected:
+        DataArray<Real> *diffusion_species_;
+        Real *residual_, *preconditioned_residual_, *search_direction_, *operator_product_, *diagonal_;
+        UnsignedInt *species_index_;
+        Real *step_size_;
+    };
+};
+
+/**
+ * @class ImplicitDiffusionDirectionCK
+ * @brief Update the search direction from the preconditioned residual.
+ */
+class ImplicitDiffusionDirectionCK : public LocalDynamics, public ImplicitDiffusionVariables
+{
+  public:
+    ImplicitDiffusionDirectionCK(SPHBody &sph_body, AbstractDiffusion *abstract_diffusion);
+    virtual ~ImplicitDiffusionDirectionCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            search_direction_[index_i] =
+                preconditioned_residual_[index_i] + *direction_ratio_ * search_direction_[index_i];
+        };
+
+      protected:
+        Real *preconditioned_residual_, *search_direction_;
+        Real *direction_ratio_;
+    };
+};
+
+/**
+ * @class ImplicitDiffusionSolverCK
+ * @brief The conjugate gradient solver of the implicit diffusion for all species.
+ * The contact interactions for boundary conditions, if any, are carried out before,
+ * so that their change rates are included explicitly.
+ */
+template <class ExecutionPolicy, class DiffusionType, class KernelCorrectionType>
+class ImplicitDiffusionSolverCK : public BaseDynamics<void>
+{
+  public:
+    ImplicitDiffusionSolverCK(Inner<> &inner_relation, AbstractDiffusion *abstract_diffusion, Real theta = 1.0,
+                              Real tolerance = 1.0e-6, UnsignedInt max_iterations = 200);
+    explicit ImplicitDiffusionSolverCK(Inner<> &inner_relation, Real theta = 1.0,
+                                       Real tolerance = 1.0e-6, UnsignedInt max_iterations = 200);
+    virtual ~ImplicitDiffusionSolverCK() {};
+    virtual void exec(Real dt = 0.0) override;
+    /** The largest number of iterations among the species in the last solution. */
+    UnsignedInt Iterations() { return iterations_; };
+
+  protected:
+    UnsignedInt number_of_species_;
+    Real tolerance_;
+    UnsignedInt max_iterations_;
+    UnsignedInt iterations_;
+    InteractionDynamicsCK<ExecutionPolicy, ImplicitDiffusionResidualCK<Inner<DiffusionType, KernelCorrectionType>>> residual_;
+    InteractionDynamicsCK<ExecutionPolicy, ImplicitDiffusionProductCK<Inner<DiffusionType, KernelCorrectionType>>> product_;
+    ReduceDynamicsCK<ExecutionPolicy, ImplicitDiffusionCurvatureCK> curvature_;
+    ReduceDynamicsCK<ExecutionPolicy, ImplicitDiffusionResidualNormCK> residual_norm_;
+    StateDynamics<ExecutionPolicy, ImplicitDiffusionStepCK> step_;
+    StateDynamics<ExecutionPolicy, ImplicitDiffusionDirectionCK> direction_;
+    SingularVariable<UnsignedInt> *sv_species_index_;
+    SingularVariable<Real> *sv_step_size_;
+    SingularVariable<Real> *sv_direction_ratio_;
+};
+} // namespace SPH
+#endif // IMPLICIT_DIFFUSION_CK_H
@@ -0,0 +1,204 @@
+/**
+ * @file 	implicit_diffusion_ck.hpp
+ * @brief 	The implicit diffusion by the theta scheme and conjugate gradient solver.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IMPLICIT_DIFFUSION_CK_HPP
+#define IMPLICIT_DIFFUSION_CK_HPP
+
+#include "implicit_diffusion_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>::
+    ImplicitDiffusionCK(Inner<Parameters...> &inner_relation, AbstractDiffusion *abstract_diffusion, Real theta)
+    : BaseInteraction(inner_relation),
+      ImplicitDiffusionVariables(inner_relation.getSPHBody(), *abstract_diffusion),
+      diffusions_(this->obtainConcreteDiffusions(*abstract_diffusion)),
+      kernel_correction_method_(this->particles_),
+      ca_inverse_volume_capacity_(diffusions_),
+      ca_inter_particle_diffusion_coeff_(diffusions_),
+      smoothing_length_sq_(pow(this->sph_adaptation_->ReferenceSmoothingLength(), 2)),
+      theta_(theta) {}
+//=================================================================================================//
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+StdVec<DiffusionType *>
+ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>::
+    obtainConcreteDiffusions(AbstractDiffusion &abstract_diffusion)
+{
+    StdVec<AbstractDiffusion *> all_diffusions = abstract_diffusion.AllDiffusions();
+    StdVec<DiffusionType *> diffusions;
+    for (auto &diffusion : all_diffusions)
+    {
+        diffusions.push_back(DynamicCast<DiffusionType>(this, diffusion));
+    }
+    return diffusions;
+}
+//=================================================================================================//
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      correction_(ex_policy, encloser.kernel_correction_method_),
+      cv1_(encloser.ca_inverse_volume_capacity_.DelegatedData(ex_policy)),
+      inter_particle_diffusion_coeff_(encloser.ca_inter_particle_diffusion_coeff_.DelegatedData(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      smoothing_length_sq_(encloser.smoothing_length_sq_), theta_(encloser.theta_),
+      diffusion_species_(encloser.dv_diffusion_species_array_.DelegatedDataArray(ex_policy)),
+      diffusion_dt_(encloser.dv_diffusion_dt_array_.DelegatedDataArray(ex_policy)),
+      residual_(encloser.dv_residual_->DelegatedData(ex_policy)),
+      preconditioned_residual_(encloser.dv_preconditioned_residual_->DelegatedData(ex_policy)),
+      search_direction_(encloser.dv_search_direction_->DelegatedData(ex_policy)),
+      operator_product_(encloser.dv_operator_product_->DelegatedData(ex_policy)),
+      diagonal_(encloser.dv_diagonal_->DelegatedData(ex_policy)),
+      species_index_(encloser.sv_species_index_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+Real ImplicitDiffusionCK<DiffusionType, KernelCorrectionType, Interaction<Inner<Parameters...>>>::
+    InteractKernel::transferCoefficient(UnsignedInt m, UnsignedInt index_i, UnsignedInt index_j)
+{
+    Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
+    Vecd e_ij = this->e_ij(index_i, index_j);
+    Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
+
+    Vecd surface_area = dW_ijV_j * (correction_(index_i) + correction_(index_j)) * e_ij;
+    return -(inter_particle_diffusion_coeff_[m](index_i, index_j, e_ij) * vec_r_ij).dot(surface_area) /
+           (vec_r_ij.squaredNorm() + 0.01 * smoothing_length_sq_);
+}
+//=================================================================================================//
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+void ImplicitDiffusionResidualCK<Inner<DiffusionType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::interact(UnsignedInt index_i, Real dt)
+{
+    UnsignedInt m = *this->species_index_;
+    Real change_rate = 0.0;
+    Real coefficient_sum = 0.0;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real transfer_coefficient = this->transferCoefficient(m, index_i, index_j);
+        change_rate += transfer_coefficient *
+                       (this->diffusion_species_[m][index_j] - this->diffusion_species_[m][index_i]);
+        coefficient_sum += transfer_coefficient;
+    }
+
+    Real Vol_i = this->Vol_[index_i];
+    this->residual_[index_i] = dt * Vol_i * (change_rate + this->diffusion_dt_[m][index_i]);
+    this->diffusion_dt_[m][index_i] = 0.0;
+    this->diagonal_[index_i] = Vol_i / this->cv1_[m](index_i) + this->theta_ * dt * Vol_i * coefficient_sum;
+    this->preconditioned_residual_[index_i] = this->residual_[index_i] / this->diagonal_[index_i];
+    this->search_direction_[index_i] = this->preconditioned_residual_[index_i];
+}
+//=================================================================================================//
+template <class DiffusionType, class KernelCorrectionType, class... Parameters>
+void ImplicitDiffusionProductCK<Inner<DiffusionType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::interact(UnsignedInt index_i, Real dt)
+{
+    UnsignedInt m = *this->species_index_;
+    Real transfer = 0.0;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        transfer += this->transferCoefficient(m, index_i, index_j) *
+                    (this->search_direction_[index_i] - this->search_direction_[index_j]);
+    }
+
+    Real Vol_i = this->Vol_[index_i];
+    this->operator_product_[index_i] = Vol_i * this->search_direction_[index_i] / this->cv1_[m](index_i) +
+                                       this->theta_ * dt * Vol_i * transfer;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+ImplicitDiffusionCurvatureCK::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : search_direction_(encloser.dv_search_direction_->DelegatedData(ex_policy)),
+      operator_product_(encloser.dv_operator_product_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+ImplicitDiffusionResidualNormCK::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : residual_(encloser.dv_residual_->DelegatedData(ex_policy)),
+      preconditioned_residual_(encloser.dv_preconditioned_residual_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+ImplicitDiffusionStepCK::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : diffusion_species_(encloser.dv_diffusion_species_array_.DelegatedDataArray(ex_policy)),
+      residual_(encloser.dv_residual_->DelegatedData(ex_policy)),
+      preconditioned_residual_(encloser.dv_preconditioned_residual_->DelegatedData(ex_policy)),
+      search_direction_(encloser.dv_search_direction_->DelegatedData(ex_policy)),
+      operator_product_(encloser.dv_operator_product_->DelegatedData(ex_policy)),
+      diagonal_(encloser.dv_diagonal_->DelegatedData(ex_policy)),
+      species_index_(encloser.sv_species_index_->DelegatedData(ex_policy)),
+      step_size_(encloser.sv_step_size_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+ImplicitDiffusionDirectionCK::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : preconditioned_residual_(encloser.dv_preconditioned_residual_->DelegatedData(ex_policy)),
+      search_direction_(encloser.dv_search_direction_->DelegatedData(ex_policy)),
+      direction_ratio_(encloser.sv_direction_ratio_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class DiffusionType, class KernelCorrectionType>
+ImplicitDiffusionSolverCK<ExecutionPolicy, DiffusionType, KernelCorrectionType>::
+    ImplicitDiffusionSolverCK(Inner<> &inner_relation, AbstractDiffusion *abstract_diffusion,
+                              Real theta, Real tolerance, UnsignedInt max_iterations)
+    : BaseDynamics<void>(), tolerance_(tolerance), max_iterations_(max_iterations), iterations_(0),
+      residual_(inner_relation, abstract_diffusion, theta),
+      product_(inner_relation, abstract_diffusion, theta),
+      curvature_(inner_relation.getSPHBody(), abstract_diffusion),
+      residual_norm_(inner_relation.getSPHBody(), abstract_diffusion),
+      step_(inner_relation.getSPHBody(), abstract_diffusion),
+      direction_(inner_relation.getSPHBody(), abstract_diffusion),
+      sv_species_index_(residual_.svSpeciesIndex()),
+      sv_step_size_(residual_.svStepSize()),
+      sv_direction_ratio_(residual_.svDirectionRatio())
+{
+    number_of_species_ = residual_.getDiffusionSpeciesNames().size();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class DiffusionType, class KernelCorrectionType>
+ImplicitDiffusionSolverCK<ExecutionPolicy, DiffusionType, KernelCorrectionType>::
+    ImplicitDiffusionSolverCK(Inner<> &inner_relation, Real theta, Real tolerance, UnsignedInt max_iterations)
+    : ImplicitDiffusionSolverCK(inner_relation,
+                                DynamicCast<AbstractDiffusion>(this, &inner_relation.getSPHBody().getBaseMaterial()),
+                                theta, tolerance, max_iterations) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class DiffusionType, class KernelCorrectionType>
+void ImplicitDiffusionSolverCK<ExecutionPolicy, DiffusionType, KernelCorrectionType>::exec(Real dt)
+{
+    iterations_ = 0;
+    for (UnsignedInt m = 0; m != number_of_species_; ++m)
+    {
+        sv_species_index_->setValue(m);
+        residual_.exec(dt);
+        std::pair<Real, Real> residual_norm = residual_norm_.exec();
+        Real residual_projection = residual_norm.first;
+        Real convergence_threshold = tolerance_ * tolerance_ * residual_norm.second;
+
+        UnsignedInt iteration = 0;
+        while (iteration != max_iterations_ && residual_norm.second > convergence_threshold)
+        {
+            product_.exec(dt);
+            Real curvature = curvature_.exec();
+            if (curvature <= 0.0) // no further descent in finite precision
+                break;
+
+            sv_step_size_->setValue(residual_projection / curvature);
+            step_.exec();
+            residual_norm = residual_norm_.exec();
+            sv_direction_ratio_->setValue(residual_norm.first / residual_projection);
+            residual_projection = residual_norm.first;
+            direction_.exec();
+            iteration++;
+        }
+        iterations_ = SMAX(iterations_, iteration);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // IMPLICIT_DIFFUSION_CK_HPP
@@ -0,0 +1,151 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    reaction_dynamics_ck.h
+ * @brief   The reaction dynamics of all species by operator splitting with computing kernels.
+ * @details The reaction model is given as template parameter and its ReactionKernel
+ *          provides the production and loss rates without virtual dispatch,
+ *          so that the same model runs on host and device. Each species is advanced
+ *          by the exponential (Rush-Larsen) update with production and loss rates
+ *          frozen within the step, sweeping the species forward or backward.
+ * @author  Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef REACTION_DYNAMICS_CK_H
+#define REACTION_DYNAMICS_CK_H
+
+#include "base_general_dynamics.h"
+#include "sphinxsys_variable_array.h"
+
+namespace SPH
+{
+template <class ReactionModelType>
+class BaseReactionRelaxationCK : public LocalDynamics
+{
+  protected:
+    static constexpr UnsignedInt NumReactiveSpecies = ReactionModelType::NumSpecies;
+    using LocalSpecies = typename ReactionModelType::LocalSpecies;
+    using ReactionKernel = typename ReactionModelType::ReactionKernel;
+    StdVec<std::string> obtainSpeciesNames(ReactionModelType &reaction_model);
+
+  public:
+    BaseReactionRelaxationCK(SPHBody &sph_body, ReactionModelType &reaction_model);
+    virtual ~BaseReactionRelaxationCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+      protected:
+        ReactionKernel reaction_kernel_;
+        DataArray<Real> *reactive_species_;
+
+        void loadLocalSpecies(LocalSpecies &local_species, UnsignedInt index_i);
+        void applyGlobalSpecies(LocalSpecies &local_species, UnsignedInt index_i);
+        void advanceSpecies(UnsignedInt k, LocalSpecies &local_species, Real dt);
+        void advanceForwardStep(LocalSpecies &local_species, Real dt);
+        void advanceBackwardStep(LocalSpecies &local_species, Real dt);
+    };
+
+  protected:
+    ReactionModelType &reaction_model_;
+    DiscreteVariableArray<Real> dv_reactive_species_array_;
+};
+
+/**
+ * @class ReactionRelaxationForwardCK
+ * @brief Compute the reaction process of all species by forward splitting
+ */
+template <class ReactionModelType>
+class ReactionRelaxationForwardCK : public BaseReactionRelaxationCK<ReactionModelType>
+{
+    using BaseDynamicsType = BaseReactionRelaxationCK<ReactionModelType>;
+
+  public:
+    template <typename... Args>
+    ReactionRelaxationForwardCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ReactionRelaxationForwardCK() {};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::UpdateKernel(ex_policy, encloser){};
+        void update(UnsignedInt index_i, Real dt = 0.0);
+    };
+};
+
+/**
+ * @class ReactionRelaxationBackwardCK
+ * @brief Compute the reaction process of all species by backward splitting
+ */
+template <class ReactionModelType>
+class ReactionRelaxationBackwardCK : public BaseReactionRelaxationCK<ReactionModelType>
+{
+    using BaseDynamicsType = BaseReactionRelaxationCK<ReactionModelType>;
+
+  public:
+    template <typename... Args>
+    ReactionRelaxationBackwardCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ReactionRelaxationBackwardCK() {};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::UpdateKernel(ex_policy, encloser){};
+        void update(UnsignedInt index_i, Real dt = 0.0);
+    };
+};
+
+/**
+ * @class ReactionRelaxationSymmetricCK
+ * @brief Compute the reaction process of all species by a forward splitting of half step
+ * followed by a backward splitting of the other half, which is second-order accurate
+ * and loads and stores the species only once per step.
+ */
+template <class ReactionModelType>
+class ReactionRelaxationSymmetricCK : public BaseReactionRelaxationCK<ReactionModelType>
+{
+    using BaseDynamicsType = BaseReactionRelaxationCK<ReactionModelType>;
+
+  public:
+    template <typename... Args>
+    ReactionRelaxationSymmetricCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ReactionRelaxationSymmetricCK() {};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::UpdateKernel(ex_policy, encloser){};
+        void update(UnsignedInt index_i, Real dt = 0.0);
+    };
+};
+} // namespace SPH
+#endif // REACTION_DYNAMICS_CK_H
@@ -0,0 +1,115 @@
+/**
+ * @file 	reaction_dynamics_ck.hpp
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef REACTION_DYNAMICS_CK_HPP
+#define REACTION_DYNAMICS_CK_HPP
+
+#include "reaction_dynamics_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ReactionModelType>
+BaseReactionRelaxationCK<ReactionModelType>::
+    BaseReactionRelaxationCK(SPHBody &sph_body, ReactionModelType &reaction_model)
+    : LocalDynamics(sph_body), reaction_model_(reaction_model),
+      dv_reactive_species_array_(this->particles_->template registerStateVariables<Real>(
+          obtainSpeciesNames(reaction_model), "")) {}
+//=================================================================================================//
+template <class ReactionModelType>
+StdVec<std::string> BaseReactionRelaxationCK<ReactionModelType>::
+    obtainSpeciesNames(ReactionModelType &reaction_model)
+{
+    auto &species_names = reaction_model.getSpeciesNames();
+    return StdVec<std::string>(species_names.begin(), species_names.end());
+}
+//=================================================================================================//
+template <class ReactionModelType>
+template <class ExecutionPolicy, class EncloserType>
+BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : reaction_kernel_(ex_policy, encloser.reaction_model_),
+      reactive_species_(encloser.dv_reactive_species_array_.DelegatedDataArray(ex_policy)) {}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    loadLocalSpecies(LocalSpecies &local_species, UnsignedInt index_i)
+{
+    for (UnsignedInt k = 0; k != NumReactiveSpecies; ++k)
+    {
+        local_species[k] = reactive_species_[k][index_i];
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    applyGlobalSpecies(LocalSpecies &local_species, UnsignedInt index_i)
+{
+    for (UnsignedInt k = 0; k != NumReactiveSpecies; ++k)
+    {
+        reactive_species_[k][index_i] = local_species[k];
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    advanceSpecies(UnsignedInt k, LocalSpecies &local_species, Real dt)
+{
+    Real production_rate = reaction_kernel_.getProductionRate(k, local_species);
+    Real loss_rate = reaction_kernel_.getLossRate(k, local_species);
+    Real alpha = math::exp(-loss_rate * dt);
+    local_species[k] = local_species[k] * alpha + production_rate * (1.0 - alpha) / (loss_rate + TinyReal);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    advanceForwardStep(LocalSpecies &local_species, Real dt)
+{
+    for (UnsignedInt k = 0; k != NumReactiveSpecies; ++k)
+    {
+        advanceSpecies(k, local_species, dt);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    advanceBackwardStep(LocalSpecies &local_species, Real dt)
+{
+    for (UnsignedInt k = NumReactiveSpecies; k != 0; --k)
+    {
+        advanceSpecies(k - 1, local_species, dt);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationForwardCK<ReactionModelType>::UpdateKernel::update(UnsignedInt index_i, Real dt)
+{
+    typename BaseDynamicsType::LocalSpecies local_species;
+    this->loadLocalSpecies(local_species, index_i);
+    this->advanceForwardStep(local_species, dt);
+    this->applyGlobalSpecies(local_species, index_i);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationBackwardCK<ReactionModelType>::UpdateKernel::update(UnsignedInt index_i, Real dt)
+{
+    typename BaseDynamicsType::LocalSpecies local_species;
+    this->loadLocalSpecies(local_species, index_i);
+    this->advanceBackwardStep(local_species, dt);
+    this->applyGlobalSpecies(local_species, index_i);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationSymmetricCK<ReactionModelType>::UpdateKernel::update(UnsignedInt index_i, Real dt)
+{
+    typename BaseDynamicsType::LocalSpecies local_species;
+    this->loadLocalSpecies(local_species, index_i);
+    this->advanceForwardStep(local_species, 0.5 * dt);
+    this->advanceBackwardStep(local_species, 0.5 * dt);
+    this->applyGlobalSpecies(local_species, index_i);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // REACTION_DYNAMICS_CK_HPP
@@ -31,6 +31,7 @@
 #define ACOUSTIC_STEP_1ST_HALF_H
 
 #include "base_fluid_dynamics.h"
+#include "force_prior_ck.hpp"
 #include "interaction_ck.hpp"
 #include "kernel_correction_ck.hpp"
 #include "riemann_solver_ck.hpp"
@@ -88,7 +89,10 @@ class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
       public:
         template <class ExecutionPolicy, class EncloserType>
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
-        void interact(size_t index_i, Real dt = 0.0);
+        void interact(size_t index_i, Real dt = 0.0) { interact(index_i, dt, SingleNeighborLane{}); };
+        /** The neighbor list is looped by the lanes cooperatively, see SingleNeighborLane. */
+        template <class NeighborLanes>
+        void interact(size_t index_i, Real dt, const NeighborLanes &lanes);
 
       protected:
         CorrectionKernel correction_;
@@ -105,7 +109,7 @@ class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
         void update(size_t index_i, Real dt = 0.0);
 
       protected:
-        Real *mass_;
+        const Real *mass_;
         Vecd *vel_, *force_, *force_prior_;
     };
 
@@ -115,6 +119,34 @@ class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
     RiemannSolverType riemann_solver_;
 };
 
+/** The prior forces given by InlineForce are evaluated in the update kernel. */
+template <class RiemannSolverType, class KernelCorrectionType, class... InlineForceTypes, typename... Parameters>
+class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType,
+                                InlineForce<InlineForceTypes...>, Parameters...>>
+    : public AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>,
+      public InlineForce<InlineForceTypes...>
+{
+    using BaseDynamicsType =
+        AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>;
+    using InlineForceKernel = typename InlineForce<InlineForceTypes...>::ComputingKernel;
+
+  public:
+    AcousticStep1stHalf(Inner<Parameters...> &inner_relation, InlineForceTypes &...inline_forces);
+    explicit AcousticStep1stHalf(const std::tuple<Inner<Parameters...> &, InlineForceTypes &...> &parameter_set);
+    virtual ~AcousticStep1stHalf() {};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        InlineForceKernel inline_force_;
+    };
+};
+
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 class AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>
     : public AcousticStep<Interaction<Contact<Parameters...>>>, public Interaction<Wall>
@@ -137,7 +169,8 @@ class AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
       protected:
         CorrectionKernel correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *mass_, *p_, *drho_dt_;
+        Real *Vol_, *rho_, *p_, *drho_dt_;
+        const Real *mass_;
         Vecd *vel_, *force_, *force_prior_;
         Real *contact_Vol_;
         Vecd *wall_acc_ave_;
@@ -192,6 +225,12 @@ using AcousticStep1stHalfWithWallRiemannCK =
 using AcousticStep1stHalfWithWallRiemannCorrectionCK =
     AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolverCK, LinearCorrectionCK>,
                         Contact<Wall, AcousticRiemannSolverCK, LinearCorrectionCK>>;
+/** Multi-phase acoustic step with a contact interaction for each target phase,
+ *  given by the contact relations in the same order as the target fluid types. */
+template <class KernelCorrectionType, class SourceFluid, class... TargetFluids>
+using MultiPhaseAcousticStep1stHalfCK =
+    AcousticStep1stHalf<Inner<OneLevel, PhasePairRiemannSolverCK<SourceFluid, SourceFluid>, KernelCorrectionType>,
+                        Contact<PhasePairRiemannSolverCK<SourceFluid, TargetFluids>, KernelCorrectionType>...>;
 } // namespace fluid_dynamics
 } // namespace SPH
 #endif // ACOUSTIC_STEP_1ST_HALF_H
@@ -83,29 +83,38 @@ AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Par
       force_(encloser.dv_force_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+template <class NeighborLanes>
 void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
-    InteractKernel::interact(size_t index_i, Real dt)
+    InteractKernel::interact(size_t index_i, Real dt, const NeighborLanes &lanes)
 {
-    Vecd force = Vecd::Zero();
-    Real rho_dissipation(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    AccumulationVecd force = AccumulationVecd::Zero();
+    AccumulationReal rho_dissipation(0);
+    const UnsignedInt lane_stride = lanes.Size() * this->neighbor_stride_;
+    for (UnsignedInt n = this->FirstNeighbor(index_i) + lanes.Lane() * this->neighbor_stride_;
+         n < this->LastNeighbor(index_i); n += lane_stride)
     {
+        this->prefetchNeighbor(index_i, n, p_, Vol_);
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
         Vecd e_ij = this->e_ij(index_i, index_j);
 
-        force -= (p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) * dW_ijV_j * e_ij;
+        force -= accumulationCast((p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) * dW_ijV_j * e_ij);
         rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
     }
-    force_[index_i] += force * Vol_[index_i];
-    drho_dt_[index_i] = rho_dissipation * rho_[index_i];
+    force = lanes.reduce(force);
+    rho_dissipation = lanes.reduce(rho_dissipation);
+    if (lanes.isLeader())
+    {
+        force_[index_i] += storageCast(force) * Vol_[index_i];
+        drho_dt_[index_i] = storageCast(rho_dissipation * rho_[index_i]);
+    }
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 template <class ExecutionPolicy, class EncloserType>
 AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
-    : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+    : mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
       vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
       force_(encloser.dv_force_->DelegatedData(ex_policy)),
       force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
@@ -117,6 +126,34 @@ void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType
     vel_[index_i] += (force_prior_[index_i] + force_[index_i]) / mass_[index_i] * dt;
 }
 //=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, class... InlineForceTypes, typename... Parameters>
+AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType,
+                          InlineForce<InlineForceTypes...>, Parameters...>>::
+    AcousticStep1stHalf(Inner<Parameters...> &inner_relation, InlineForceTypes &...inline_forces)
+    : BaseDynamicsType(inner_relation), InlineForce<InlineForceTypes...>(inline_forces...) {}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, class... InlineForceTypes, typename... Parameters>
+AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType,
+                          InlineForce<InlineForceTypes...>, Parameters...>>::
+    AcousticStep1stHalf(const std::tuple<Inner<Parameters...> &, InlineForceTypes &...> &parameter_set)
+    : BaseDynamicsType(std::get<0>(parameter_set)), InlineForce<InlineForceTypes...>(parameter_set) {}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, class... InlineForceTypes, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType,
+                          InlineForce<InlineForceTypes...>, Parameters...>>::
+    UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseDynamicsType::UpdateKernel(ex_policy, encloser), inline_force_(ex_policy, encloser) {}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, class... InlineForceTypes, typename... Parameters>
+void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType,
+                               InlineForce<InlineForceTypes...>, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    this->vel_[index_i] += (this->force_prior_[index_i] + this->force_[index_i] + inline_force_(index_i)) /
+                           this->mass_[index_i] * dt;
+}
+//=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     AcousticStep1stHalf(Contact<Parameters...> &wall_contact_relation)
@@ -135,7 +172,7 @@ AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Param
       riemann_solver_(encloser.riemann_solver_),
       Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
       rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
-      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
       p_(encloser.dv_p_->DelegatedData(ex_policy)),
       drho_dt_(encloser.dv_drho_dt_->DelegatedData(ex_policy)),
       force_(encloser.dv_force_->DelegatedData(ex_policy)),
@@ -147,9 +184,9 @@ template <class RiemannSolverType, class KernelCorrectionType, typename... Param
 void AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
-    Vecd force = Vecd::Zero();
-    Real rho_dissipation(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    AccumulationVecd force = AccumulationVecd::Zero();
+    AccumulationReal rho_dissipation(0);
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
@@ -158,11 +195,11 @@ void AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
 
         Real face_wall_external_acceleration = (force_prior_[index_i] / mass_[index_i] - wall_acc_ave_[index_j]).dot(-e_ij);
         Real p_j_in_wall = p_[index_i] + rho_[index_i] * r_ij * SMAX(Real(0), face_wall_external_acceleration);
-        force -= (p_[index_i] + p_j_in_wall) * correction_(index_i) * dW_ijV_j * e_ij;
+        force -= accumulationCast((p_[index_i] + p_j_in_wall) * correction_(index_i) * dW_ijV_j * e_ij);
         rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_j_in_wall) * dW_ijV_j;
     }
-    force_[index_i] += force * Vol_[index_i];
-    drho_dt_[index_i] += rho_dissipation * rho_[index_i];
+    force_[index_i] += storageCast(force) * Vol_[index_i];
+    drho_dt_[index_i] += storageCast(rho_dissipation * rho_[index_i]);
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
@@ -204,22 +241,22 @@ template <class RiemannSolverType, class KernelCorrectionType, typename... Param
 void AcousticStep1stHalf<Contact<RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
-    Vecd force = Vecd::Zero();
-    Real rho_dissipation(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    AccumulationVecd force = AccumulationVecd::Zero();
+    AccumulationReal rho_dissipation(0);
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
         Vecd e_ij = this->e_ij(index_i, index_j);
 
-        force -= riemann_solver_.AverageP(
-                     static_cast<CorrectionDataType>(contact_correction_(index_j) * p_[index_i]),
-                     static_cast<CorrectionDataType>(correction_(index_i) * contact_p_[index_j])) *
-                 2.0 * dW_ijV_j * e_ij;
+        force -= accumulationCast(riemann_solver_.AverageP(
+                                      static_cast<CorrectionDataType>(contact_correction_(index_j) * p_[index_i]),
+                                      static_cast<CorrectionDataType>(correction_(index_i) * contact_p_[index_j])) *
+                                  2.0 * dW_ijV_j * e_ij);
         rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - contact_p_[index_j]) * dW_ijV_j;
     }
-    force_[index_i] += force * Vol_[index_i];
-    drho_dt_[index_i] += rho_dissipation * rho_[index_i];
+    force_[index_i] += storageCast(force) * Vol_[index_i];
+    drho_dt_[index_i] += storageCast(rho_dissipation * rho_[index_i]);
 }
 //=================================================================================================//
 } // namespace fluid_dynamics
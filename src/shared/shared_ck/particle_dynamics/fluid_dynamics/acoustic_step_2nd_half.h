@@ -181,6 +181,12 @@ using AcousticStep2ndHalfWithWallRiemannCK =
 using AcousticStep2ndHalfWithWallRiemannCorrectionCK =
     AcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolverCK, LinearCorrectionCK>,
                         Contact<Wall, AcousticRiemannSolverCK, LinearCorrectionCK>>;
+/** Multi-phase acoustic step with a contact interaction for each target phase,
+ *  given by the contact relations in the same order as the target fluid types. */
+template <class KernelCorrectionType, class SourceFluid, class... TargetFluids>
+using MultiPhaseAcousticStep2ndHalfCK =
+    AcousticStep2ndHalf<Inner<OneLevel, PhasePairRiemannSolverCK<SourceFluid, SourceFluid>, KernelCorrectionType>,
+                        Contact<PhasePairRiemannSolverCK<SourceFluid, TargetFluids>, KernelCorrectionType>...>;
 } // namespace fluid_dynamics
 } // namespace SPH
 #endif // ACOUSTIC_STEP_2ND_HALF_H
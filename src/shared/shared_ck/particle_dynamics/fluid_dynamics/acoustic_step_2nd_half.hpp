@@ -51,20 +51,21 @@ template <class RiemannSolverType, class KernelCorrectionType, typename... Param
 void AcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
-    Real density_change_rate(0);
-    Vecd p_dissipation = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    AccumulationReal density_change_rate(0);
+    AccumulationVecd p_dissipation = AccumulationVecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
+        this->prefetchNeighbor(index_i, n, vel_, Vol_);
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
         Vecd corrected_e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
 
         Real u_jump = (vel_[index_i] - vel_[index_j]).dot(corrected_e_ij);
         density_change_rate += u_jump * dW_ijV_j;
-        p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * corrected_e_ij;
+        p_dissipation += accumulationCast(riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * corrected_e_ij);
     }
-    drho_dt_[index_i] += density_change_rate * rho_[index_i];
-    force_[index_i] = p_dissipation * Vol_[index_i];
+    drho_dt_[index_i] += storageCast(density_change_rate * rho_[index_i]);
+    force_[index_i] = storageCast(p_dissipation) * Vol_[index_i];
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
@@ -110,9 +111,9 @@ template <class RiemannSolverType, class KernelCorrectionType, typename... Param
 void AcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
-    Real density_change_rate = 0.0;
-    Vecd p_dissipation = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    AccumulationReal density_change_rate(0);
+    AccumulationVecd p_dissipation = AccumulationVecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
@@ -122,10 +123,10 @@ void AcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
         Vecd vel_j_in_wall = 2.0 * wall_vel_ave_[index_j] - vel_[index_i];
         density_change_rate += (vel_[index_i] - vel_j_in_wall).dot(corrected_e_ij) * dW_ijV_j;
         Real u_jump = 2.0 * (vel_[index_i] - wall_vel_ave_[index_j]).dot(face_to_fluid_n);
-        p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * face_to_fluid_n;
+        p_dissipation += accumulationCast(riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * face_to_fluid_n);
     }
-    drho_dt_[index_i] += density_change_rate * rho_[index_i];
-    force_[index_i] += p_dissipation * Vol_[index_i];
+    drho_dt_[index_i] += storageCast(density_change_rate * rho_[index_i]);
+    force_[index_i] += storageCast(p_dissipation) * Vol_[index_i];
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
@@ -165,9 +166,9 @@ template <class RiemannSolverType, class KernelCorrectionType, typename... Param
 void AcousticStep2ndHalf<Contact<RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
-    Real density_change_rate(0);
-    Vecd p_dissipation = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    AccumulationReal density_change_rate(0);
+    AccumulationVecd p_dissipation = AccumulationVecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
@@ -175,10 +176,10 @@ void AcousticStep2ndHalf<Contact<RiemannSolverType, KernelCorrectionType, Parame
 
         Vecd vel_diff = (vel_[index_i] - riemann_solver_.AverageV(this->vel_[index_i], contact_vel_[index_j]));
         density_change_rate += 2.0 * vel_diff.dot(correction_(index_i) * e_ij) * dW_ijV_j;
-        p_dissipation += riemann_solver_.DissipativePJump((vel_[index_i] - contact_vel_[index_j]).dot(e_ij)) * dW_ijV_j * e_ij;
+        p_dissipation += accumulationCast(riemann_solver_.DissipativePJump((vel_[index_i] - contact_vel_[index_j]).dot(e_ij)) * dW_ijV_j * e_ij);
     }
-    drho_dt_[index_i] += density_change_rate * rho_[index_i];
-    force_[index_i] += p_dissipation * Vol_[index_i];
+    drho_dt_[index_i] += storageCast(density_change_rate * rho_[index_i]);
+    force_[index_i] += storageCast(p_dissipation) * Vol_[index_i];
 }
 //=================================================================================================//
 } // namespace fluid_dynamics
@@ -0,0 +1,25 @@
+#include "acoustic_step_instantiation_ck.h"
+
+#if SPHINXSYS_EXPLICIT_INSTANTIATION
+namespace SPH
+{
+//=================================================================================================//
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Contact<Wall, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Contact<Wall, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Contact<Wall, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Contact<Wall, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+//=================================================================================================//
+} // namespace SPH
+#endif // SPHINXSYS_EXPLICIT_INSTANTIATION
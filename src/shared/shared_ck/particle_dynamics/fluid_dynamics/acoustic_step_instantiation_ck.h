@@ -0,0 +1,62 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    acoustic_step_instantiation_ck.h
+ * @brief   Explicit instantiations of the commonly used acoustic step dynamics.
+ * @details The host parallel versions of the acoustic steps used by most weakly compressible
+ *          fluid cases are compiled once in the library and declared as extern templates here,
+ *          so that a case only instantiates the constructors but not the particle loops.
+ *          Other combinations and the device policies are still instantiated implicitly.
+ *          Switched off by the build option SPHINXSYS_EXPLICIT_INSTANTIATION.
+ * @author  Xiangyu Hu
+ */
+
+#ifndef ACOUSTIC_STEP_INSTANTIATION_CK_H
+#define ACOUSTIC_STEP_INSTANTIATION_CK_H
+
+#include "acoustic_step_1st_half.hpp"
+#include "acoustic_step_2nd_half.hpp"
+#include "interaction_algorithms_ck.hpp"
+
+#if SPHINXSYS_EXPLICIT_INSTANTIATION
+namespace SPH
+{
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Contact<Wall, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep1stHalf<Contact<Wall, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Contact<Wall, AcousticRiemannSolverCK, NoKernelCorrectionCK>>>;
+extern template class InteractionDynamicsCK<
+    execution::ParallelPolicy, fluid_dynamics::AcousticStep2ndHalf<Contact<Wall, AcousticRiemannSolverCK, LinearCorrectionCK>>>;
+} // namespace SPH
+#endif // SPHINXSYS_EXPLICIT_INSTANTIATION
+#endif // ACOUSTIC_STEP_INSTANTIATION_CK_H
@@ -33,9 +33,13 @@
 
 #include "acoustic_step_1st_half.hpp"
 #include "acoustic_step_2nd_half.hpp"
+#include "acoustic_step_instantiation_ck.h"
 #include "all_fluid_boundary_condition_ck.h"
 #include "density_regularization.hpp"
+#include "eulerian_compressible_step_ck.hpp"
 #include "fluid_time_step_ck.hpp"
+#include "non_newtonian_dynamics_ck.hpp"
+#include "surface_tension_ck.hpp"
 #include "transport_velocity_correction_ck.hpp"
 #include "viscous_force.hpp"
 
@@ -33,5 +33,8 @@
 
 #include "bidirectional_boundary_ck.hpp"
 #include "emitter_boundary_ck.hpp"
+#include "level_set_wall_ck.hpp"
+#include "reduced_order_coupling_ck.hpp"
+#include "relaxation_zone_ck.hpp"
 
 #endif // ALL_FLUID_BOUNDARY_CONDITION_CK_H
@@ -31,6 +31,28 @@ BufferOutflowIndication::UpdateKernel::
     : part_id_(part_id), aligned_box_(aligned_box), pos_(pos),
       buffer_indicator_(buffer_particle_indicator) {}
 //=================================================================================================//
+MultipleBufferIndicationCK::MultipleBufferIndicationCK(AlignedBoxPartsByCell &aligned_box_parts)
+    : BaseLocalDynamics<AlignedBoxPartsByCell>(aligned_box_parts),
+      number_of_parts_(aligned_box_parts.NumberOfParts()),
+      dv_aligned_boxes_(aligned_box_parts.dvAlignedBoxes()),
+      dv_part_ids_(aligned_box_parts.dvPartIDs()),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_buffer_indicator_(particles_->registerStateVariable<int>("BufferIndicator"))
+{
+    particles_->addEvolvingVariable<int>("BufferIndicator");
+}
+//=================================================================================================//
+MultipleBufferOutflowIndication::MultipleBufferOutflowIndication(AlignedBoxPartsByCell &aligned_box_parts)
+    : BaseLocalDynamics<AlignedBoxPartsByCell>(aligned_box_parts),
+      number_of_parts_(aligned_box_parts.NumberOfParts()),
+      dv_aligned_boxes_(aligned_box_parts.dvAlignedBoxes()),
+      dv_part_ids_(aligned_box_parts.dvPartIDs()),
+      sv_total_real_particles_(particles_->svTotalRealParticles()),
+      dv_buffer_indicator_(
+          particles_->registerStateVariable<int>("BufferIndicator")),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_life_status_(particles_->registerStateVariable<int>("LifeStatus", 0)) {}
+//=================================================================================================//
 OutflowParticleDeletion::OutflowParticleDeletion(SPHBody &sph_body)
     : LocalDynamics(sph_body),
       remove_real_particle_method_(particles_),
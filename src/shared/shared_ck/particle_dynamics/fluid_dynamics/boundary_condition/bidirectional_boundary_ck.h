@@ -30,6 +30,7 @@
 #define BIDIRECTIONAL_BOUNDARY_CK_H
 
 #include "base_body_part.h"
+#include "base_configuration_dynamics.h"
 #include "base_fluid_dynamics.h"
 #include "fluid_boundary_state.hpp"
 #include "particle_operation.hpp"
@@ -171,6 +172,78 @@ class BufferOutflowIndication : public BaseLocalDynamics<AlignedBoxByCell>
     DiscreteVariable<int> *dv_life_status_; // 0: alive, 1: to delete
 };
 
+/**
+ * @class MultipleBufferIndicationCK
+ * @brief Buffer indication for all aligned box parts in one pass,
+ * equivalent to BufferIndicationCK of each part in order.
+ */
+class MultipleBufferIndicationCK : public BaseLocalDynamics<AlignedBoxPartsByCell>
+{
+  public:
+    MultipleBufferIndicationCK(AlignedBoxPartsByCell &aligned_box_parts);
+    virtual ~MultipleBufferIndicationCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        UnsignedInt number_of_parts_;
+        AlignedBox *aligned_boxes_;
+        int *part_ids_;
+        Vecd *pos_;
+        int *buffer_indicator_;
+    };
+
+  protected:
+    UnsignedInt number_of_parts_;
+    DiscreteVariable<AlignedBox> *dv_aligned_boxes_;
+    DiscreteVariable<int> *dv_part_ids_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<int> *dv_buffer_indicator_;
+};
+
+/**
+ * @class MultipleBufferOutflowIndication
+ * @brief Outflow indication for all aligned box parts in one pass,
+ * equivalent to BufferOutflowIndication of each part.
+ */
+class MultipleBufferOutflowIndication : public BaseLocalDynamics<AlignedBoxPartsByCell>
+{
+  public:
+    MultipleBufferOutflowIndication(AlignedBoxPartsByCell &aligned_box_parts);
+    virtual ~MultipleBufferOutflowIndication() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        UnsignedInt number_of_parts_;
+        AlignedBox *aligned_boxes_;
+        int *part_ids_;
+        Vecd *pos_;
+        int *buffer_indicator_;
+        int *life_status_;
+        UnsignedInt *total_real_particles_;
+    };
+
+  protected:
+    UnsignedInt number_of_parts_;
+    DiscreteVariable<AlignedBox> *dv_aligned_boxes_;
+    DiscreteVariable<int> *dv_part_ids_;
+    SingularVariable<UnsignedInt> *sv_total_real_particles_;
+    DiscreteVariable<int> *dv_buffer_indicator_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<int> *dv_life_status_; // 0: alive, 1: to delete
+};
+
 class OutflowParticleDeletion : public LocalDynamics
 {
     using RemoveRealParticleKernel = typename RemoveRealParticle::ComputingKernel;
@@ -188,13 +261,36 @@ class OutflowParticleDeletion : public LocalDynamics
       protected:
         RemoveRealParticleKernel remove_real_particle_;
         int *life_status_;
-      };
+    };
 
   protected:
     RemoveRealParticle remove_real_particle_method_;
     DiscreteVariable<int> *dv_life_status_;
 };
 
+/**
+ * @class OutflowParticleDeletionCK
+ * @brief Deletes all particles marked by the outflow indication at once,
+ * by flagging, prefix scan and compaction, on any execution policy.
+ */
+template <class ExecutionPolicy>
+class OutflowParticleDeletionCK : public LocalDynamics, public BaseDynamics<void>
+{
+    using ComputingKernel = typename RemoveRealParticles::ComputingKernel;
+
+  public:
+    explicit OutflowParticleDeletionCK(SPHBody &sph_body);
+    virtual ~OutflowParticleDeletionCK() {};
+    virtual void exec(Real dt = 0.0) override;
+    typedef OutflowParticleDeletionCK<ExecutionPolicy> LocalDynamicsType;
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    SingularVariable<UnsignedInt> *sv_total_real_particles_;
+    RemoveRealParticles remove_real_particles_method_;
+    Implementation<ExecutionPolicy, RemoveRealParticles, ComputingKernel> kernel_implementation_;
+};
+
 template <class KernelCorrectionType, typename ConditionType>
 class PressureVelocityCondition : public BaseLocalDynamics<AlignedBoxByCell>,
                                   public BaseStateCondition
@@ -100,6 +100,54 @@ inline void BufferOutflowIndication::UpdateKernel::update(size_t index_i, Real d
 }
 //=================================================================================================//
 template <class ExecutionPolicy, class EncloserType>
+MultipleBufferIndicationCK::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : number_of_parts_(encloser.number_of_parts_),
+      aligned_boxes_(encloser.dv_aligned_boxes_->DelegatedData(ex_policy)),
+      part_ids_(encloser.dv_part_ids_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      buffer_indicator_(encloser.dv_buffer_indicator_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+inline void MultipleBufferIndicationCK::UpdateKernel::update(size_t index_i, Real dt)
+{
+    for (UnsignedInt k = 0; k != number_of_parts_; ++k)
+    {
+        if (aligned_boxes_[k].checkContain(pos_[index_i]))
+        {
+            buffer_indicator_[index_i] = part_ids_[k];
+        }
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+MultipleBufferOutflowIndication::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : number_of_parts_(encloser.number_of_parts_),
+      aligned_boxes_(encloser.dv_aligned_boxes_->DelegatedData(ex_policy)),
+      part_ids_(encloser.dv_part_ids_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      buffer_indicator_(encloser.dv_buffer_indicator_->DelegatedData(ex_policy)),
+      life_status_(encloser.dv_life_status_->DelegatedData(ex_policy)),
+      total_real_particles_(encloser.sv_total_real_particles_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+inline void MultipleBufferOutflowIndication::UpdateKernel::update(size_t index_i, Real dt)
+{
+    for (UnsignedInt k = 0; k != number_of_parts_; ++k)
+    {
+        if (buffer_indicator_[index_i] == part_ids_[k]) // a particle is in the buffer of one part at most
+        {
+            AlignedBox &aligned_box = aligned_boxes_[k];
+            if (!aligned_box.checkInBounds(pos_[index_i]) &&
+                aligned_box.checkLowerBound(pos_[index_i]) && index_i < *total_real_particles_)
+            {
+                life_status_[index_i] = 1; // mark as to delete but will not delete immediately
+            }
+            break;
+        }
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
 OutflowParticleDeletion::UpdateKernel::
     UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : remove_real_particle_(ex_policy, encloser.remove_real_particle_method_),
@@ -113,6 +161,49 @@ inline void OutflowParticleDeletion::UpdateKernel::update(UnsignedInt index_i, R
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy>
+OutflowParticleDeletionCK<ExecutionPolicy>::OutflowParticleDeletionCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body), BaseDynamics<void>(),
+      ex_policy_(ExecutionPolicy{}),
+      sv_total_real_particles_(particles_->svTotalRealParticles()),
+      remove_real_particles_method_(particles_, particles_->getVariableByName<int>("LifeStatus")),
+      kernel_implementation_(remove_real_particles_method_) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void OutflowParticleDeletionCK<ExecutionPolicy>::exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<OutflowParticleDeletionCK>(), *this->sph_body_);
+    this->setUpdated(*this->sph_body_);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->flagRemoval(i); });
+
+    UnsignedInt *removal_flag = remove_real_particles_method_.dvRemovalFlag()->DelegatedData(ex_policy_);
+    UnsignedInt *removal_offset = remove_real_particles_method_.dvRemovalOffset()->DelegatedData(ex_policy_);
+    UnsignedInt total_removed =
+        exclusive_scan(ex_policy_, removal_flag, removal_offset, total_real_particles + 1,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    if (total_removed != 0)
+    {
+        UnsignedInt remaining_bound = total_real_particles - total_removed;
+        particle_for(ex_policy_, IndexRange(remaining_bound, total_real_particles),
+                     [=](size_t i)
+                     { computing_kernel->indexRemaining(i, remaining_bound); });
+
+        particle_for(ex_policy_, IndexRange(0, remaining_bound),
+                     [=](size_t i)
+                     { computing_kernel->fillRemoved(i); });
+        sv_total_real_particles_->setValue(remaining_bound);
+    }
+
+    this->logger_->debug("OutflowParticleDeletionCK::exec() removes {} particles at {}",
+                         total_removed, this->sph_body_->getName());
+}
+//=================================================================================================//
 template <class KernelCorrectionType, typename ConditionType>
 template <typename... Args>
 PressureVelocityCondition<KernelCorrectionType, ConditionType>::
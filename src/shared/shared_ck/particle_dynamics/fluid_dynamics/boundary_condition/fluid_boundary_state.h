@@ -69,6 +69,24 @@ struct PressurePrescribed
     };
 };
 
+/**
+ * @brief Pressure given by a reduced-order far-field model.
+ * The pointer is delegated to the execution policy of the boundary
+ * and the value is updated on host once per exchange.
+ */
+template <class FluidType = WeaklyCompressibleFluid>
+struct ReducedOrderPressure
+{
+    typedef FluidType Fluid;
+    Real *far_field_pressure_;
+    ReducedOrderPressure(Real *far_field_pressure) : far_field_pressure_(far_field_pressure) {};
+    Real getPressure(const Real &input_pressure, Real time) { return *far_field_pressure_; };
+    Real getAxisVelocity(const Vecd &input_position, const Real &input_axis_velocity, Real time)
+    {
+        return input_axis_velocity;
+    };
+};
+
 template <class FluidType = WeaklyCompressibleFluid>
 struct VelocityPrescribed
 {
@@ -0,0 +1,17 @@
+#include "level_set_wall_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+LevelSetWallBase::LevelSetWallBase(NearShapeSurface &near_surface)
+    : BaseLocalDynamics<BodyPartByCell>(near_surface),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_package_hint_(particles_->registerDiscreteVariable<UnsignedInt>(
+          "LevelSetPackageHint" + near_surface.getLevelSetShape().getName(), particles_->ParticlesBound())),
+      level_set_(near_surface.getLevelSetShape().getLevelSet()),
+      half_spacing_(0.5 * getSPHAdaptation().ReferenceSpacing()) {}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
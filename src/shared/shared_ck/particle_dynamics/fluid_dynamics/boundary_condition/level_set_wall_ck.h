@@ -0,0 +1,275 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	level_set_wall_ck.h
+ * @brief 	Static wall boundary given by the level set of a shape for computing kernels.
+ * @details The wall contributions are obtained from the kernel integrals over the wall region
+ *          which are probed by the level-set mesh of the shape, instead of summed over wall particles.
+ *          Therefore, no wall body, wall particles or fluid-wall contact relation is required.
+ *          Each class updates the fluid particles near the shape surface and is executed
+ *          just after the corresponding fluid dynamics with inner relation only,
+ *          so that the results are the same as the wall contribution being included in the latter.
+ *          The wall is static and the level-set shape is required to be volumetric,
+ *          with the fluid located in its negative region, i.e. inside the shape.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef LEVEL_SET_WALL_CK_H
+#define LEVEL_SET_WALL_CK_H
+
+#include "base_body_part.h"
+#include "base_fluid_dynamics.h"
+#include "density_regularization.h"
+#include "force_prior_ck.h"
+#include "particle_functors_ck.h"
+#include "riemann_solver_ck.h"
+#include "viscosity.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+class LevelSetWallBase : public BaseLocalDynamics<BodyPartByCell>
+{
+  public:
+    explicit LevelSetWallBase(NearShapeSurface &near_surface);
+    virtual ~LevelSetWallBase() {};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+        /** The distance to the replaced wall particles, whose first layer is half of the spacing behind the surface. */
+        Real WallDistance(Real signed_distance) { return SMAX(-signed_distance, Real(0)) + half_spacing_; };
+
+      protected:
+        Vecd *pos_;
+        UnsignedInt *package_hint_;
+        Real half_spacing_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<UnsignedInt> *dv_package_hint_; /**< cached level-set package of each particle */
+    LevelSet &level_set_;
+    Real half_spacing_;
+};
+
+/**
+ * @class LevelSetWallDensityCK
+ * @brief Adds the wall contribution to the density summation and regularizes the density again.
+ * Executed after DensityRegularization with inner relation only.
+ */
+template <class FlowType>
+class LevelSetWallDensityCK : public LevelSetWallBase
+{
+    using RegularizationKernel = typename Regularization<FlowType>::ComputingKernel;
+
+  public:
+    explicit LevelSetWallDensityCK(NearShapeSurface &near_surface);
+    virtual ~LevelSetWallDensityCK() {};
+
+    class UpdateKernel : public LevelSetWallBase::ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+        Real InitialDensity() { return rho0_; };
+
+      protected:
+        ProbeKernelIntegral kernel_integral_;
+        Real *rho_, *rho_sum_;
+        const Real *mass_;
+        Real rho0_, inv_sigma0_;
+        RegularizationKernel regularization_;
+    };
+
+  protected:
+    DiscreteVariable<Real> *dv_rho_, *dv_rho_sum_, *dv_mass_;
+    Real rho0_, inv_sigma0_;
+    Regularization<FlowType> regularization_method_;
+};
+
+/**
+ * @class LevelSetWallAcousticStep1stHalfCK
+ * @brief Wall pressure force, with the wall pressure extrapolated as in the wall contact version.
+ * Executed after AcousticStep1stHalf with inner relation only, and updates the velocity directly.
+ */
+template <class RiemannSolverType>
+class LevelSetWallAcousticStep1stHalfCK : public LevelSetWallBase
+{
+    using FluidType = typename RiemannSolverType::SourceFluid;
+
+  public:
+    explicit LevelSetWallAcousticStep1stHalfCK(NearShapeSurface &near_surface);
+    virtual ~LevelSetWallAcousticStep1stHalfCK() {};
+
+    class UpdateKernel : public LevelSetWallBase::ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ProbeSignedDistance signed_distance_;
+        ProbeNormalDirection normal_direction_;
+        ProbeKernelGradientIntegral kernel_gradient_integral_;
+        RiemannSolverType riemann_solver_;
+        Real *Vol_, *rho_, *p_, *drho_dt_;
+        const Real *mass_;
+        Vecd *vel_, *force_, *force_prior_;
+    };
+
+  protected:
+    FluidType &fluid_;
+    RiemannSolverType riemann_solver_;
+    DiscreteVariable<Real> *dv_Vol_, *dv_rho_, *dv_p_, *dv_drho_dt_, *dv_mass_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_force_, *dv_force_prior_;
+};
+
+/**
+ * @class LevelSetWallAcousticStep2ndHalfCK
+ * @brief Wall contribution to the density change rate with the mirrored velocity in the wall.
+ * Executed after AcousticStep2ndHalf with inner relation only, and updates the density directly.
+ */
+template <class RiemannSolverType>
+class LevelSetWallAcousticStep2ndHalfCK : public LevelSetWallBase
+{
+    using FluidType = typename RiemannSolverType::SourceFluid;
+
+  public:
+    explicit LevelSetWallAcousticStep2ndHalfCK(NearShapeSurface &near_surface);
+    virtual ~LevelSetWallAcousticStep2ndHalfCK() {};
+
+    class UpdateKernel : public LevelSetWallBase::ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ProbeNormalDirection normal_direction_;
+        ProbeKernelGradientIntegral kernel_gradient_integral_;
+        RiemannSolverType riemann_solver_;
+        Real *Vol_, *rho_, *drho_dt_;
+        Vecd *vel_, *force_;
+    };
+
+  protected:
+    FluidType &fluid_;
+    RiemannSolverType riemann_solver_;
+    DiscreteVariable<Real> *dv_Vol_, *dv_rho_, *dv_drho_dt_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_force_;
+};
+
+/**
+ * @class LevelSetWallViscousForceCK
+ * @brief No-slip wall viscous force as a prior force.
+ */
+template <class ViscosityType>
+class LevelSetWallViscousForceCK : public LevelSetWallBase, public ForcePriorCK
+{
+    using OneSideViscosity = typename ViscosityType::OneSideViscosity;
+
+  public:
+    explicit LevelSetWallViscousForceCK(NearShapeSurface &near_surface);
+    virtual ~LevelSetWallViscousForceCK() {};
+
+    class UpdateKernel : public LevelSetWallBase::ComputingKernel, public ForcePriorCK::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        OneSideViscosity one_side_viscosity_;
+        ProbeSignedDistance signed_distance_;
+        ProbeKernelGradientIntegral kernel_gradient_integral_;
+        Real *Vol_;
+        Vecd *vel_, *wall_viscous_force_;
+        Real smoothing_length_sq_;
+    };
+
+  protected:
+    ViscosityType &viscosity_model_;
+    DiscreteVariable<Real> *dv_Vol_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_wall_viscous_force_;
+    Real smoothing_length_sq_;
+};
+
+/**
+ * @class LevelSetWallTransportVelocityCorrectionCK
+ * @brief Adds the wall contribution to the kernel gradient integral and
+ * corrects the displacement by the difference of the limited corrections.
+ * Executed after TransportVelocityCorrectionCK with inner relation only,
+ * with the same limiter, particle scope and coefficient, and for single resolution only.
+ */
+template <class LimiterType, class ParticleScopeType>
+class LevelSetWallTransportVelocityCorrectionCK : public LevelSetWallBase
+{
+    using ParticleScopeTypeKernel = typename ParticleScopeTypeCK<ParticleScopeType>::ComputingKernel;
+
+  public:
+    explicit LevelSetWallTransportVelocityCorrectionCK(NearShapeSurface &near_surface, Real coefficient = 0.2);
+    virtual ~LevelSetWallTransportVelocityCorrectionCK() {};
+
+    class UpdateKernel : public LevelSetWallBase::ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ProbeKernelGradientIntegral kernel_gradient_integral_probe_;
+        Real correction_scaling_;
+        LimiterType limiter_;
+        Vecd *dpos_, *kernel_gradient_integral_;
+        ParticleScopeTypeKernel within_scope_;
+    };
+
+  protected:
+    Real h_ref_, correction_scaling_;
+    LimiterType limiter_;
+    ParticleScopeTypeCK<ParticleScopeType> within_scope_method_;
+    DiscreteVariable<Vecd> *dv_dpos_, *dv_kernel_gradient_integral_;
+};
+
+using LevelSetWallDensityInternalCK = LevelSetWallDensityCK<Internal>;
+using LevelSetWallDensityFreeSurfaceCK = LevelSetWallDensityCK<FreeSurface>;
+using LevelSetWallAcousticStep1stHalfRiemannCK = LevelSetWallAcousticStep1stHalfCK<AcousticRiemannSolverCK>;
+using LevelSetWallAcousticStep2ndHalfRiemannCK = LevelSetWallAcousticStep2ndHalfCK<AcousticRiemannSolverCK>;
+using LevelSetWallNewtonianViscousForceCK = LevelSetWallViscousForceCK<Viscosity>;
+using LevelSetWallTransportVelocityCorrectionBulkParticlesCK =
+    LevelSetWallTransportVelocityCorrectionCK<NoLimiter, BulkParticles>;
+using LevelSetWallTransportVelocityLimitedCorrectionBulkParticlesCK =
+    LevelSetWallTransportVelocityCorrectionCK<TruncatedLinear, BulkParticles>;
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // LEVEL_SET_WALL_CK_H
@@ -0,0 +1,224 @@
+#ifndef LEVEL_SET_WALL_CK_HPP
+#define LEVEL_SET_WALL_CK_HPP
+
+#include "level_set_wall_ck.h"
+
+#include "density_regularization.hpp"
+#include "force_prior_ck.hpp"
+#include "level_set.hpp"
+#include "riemann_solver_ck.hpp"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+LevelSetWallBase::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      package_hint_(encloser.dv_package_hint_->DelegatedData(ex_policy)),
+      half_spacing_(encloser.half_spacing_) {}
+//=================================================================================================//
+template <class FlowType>
+LevelSetWallDensityCK<FlowType>::LevelSetWallDensityCK(NearShapeSurface &near_surface)
+    : LevelSetWallBase(near_surface),
+      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_rho_sum_(particles_->registerScratchVariable<Real>("DensitySummation")),
+      dv_mass_(particles_->getVariableByName<Real>("Mass")),
+      rho0_(sph_body_->getBaseMaterial().ReferenceDensity()),
+      inv_sigma0_(1.0 / getSPHAdaptation().LatticeNumberDensity()),
+      regularization_method_(particles_) {}
+//=================================================================================================//
+template <class FlowType>
+template <class ExecutionPolicy, class EncloserType>
+LevelSetWallDensityCK<FlowType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : LevelSetWallBase::ComputingKernel(ex_policy, encloser),
+      kernel_integral_(encloser.level_set_.getProbeKernelIntegral(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      rho_sum_(encloser.dv_rho_sum_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
+      rho0_(encloser.rho0_), inv_sigma0_(encloser.inv_sigma0_),
+      regularization_(ex_policy, encloser.regularization_method_, *this) {}
+//=================================================================================================//
+template <class FlowType>
+void LevelSetWallDensityCK<FlowType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    Real sigma = kernel_integral_(pos_[index_i], package_hint_[index_i]);
+    rho_sum_[index_i] += sigma * rho0_ * rho0_ * inv_sigma0_ / mass_[index_i];
+    rho_[index_i] = regularization_(index_i, rho_sum_[index_i]);
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+LevelSetWallAcousticStep1stHalfCK<RiemannSolverType>::
+    LevelSetWallAcousticStep1stHalfCK(NearShapeSurface &near_surface)
+    : LevelSetWallBase(near_surface),
+      fluid_(DynamicCast<FluidType>(this, sph_body_->getBaseMaterial())),
+      riemann_solver_(fluid_, fluid_),
+      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure")),
+      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_p_(particles_->registerStateVariable<Real>("Pressure")),
+      dv_drho_dt_(particles_->registerStateVariable<Real>("DensityChangeRate")),
+      dv_mass_(particles_->getVariableByName<Real>("Mass")),
+      dv_vel_(particles_->registerStateVariable<Vecd>("Velocity")),
+      dv_force_(particles_->registerStateVariable<Vecd>("Force")),
+      dv_force_prior_(particles_->registerStateVariable<Vecd>("ForcePrior")) {}
+//=================================================================================================//
+template <class RiemannSolverType>
+template <class ExecutionPolicy, class EncloserType>
+LevelSetWallAcousticStep1stHalfCK<RiemannSolverType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : LevelSetWallBase::ComputingKernel(ex_policy, encloser),
+      signed_distance_(encloser.level_set_.getProbeSignedDistance(ex_policy)),
+      normal_direction_(encloser.level_set_.getProbeNormalDirection(ex_policy)),
+      kernel_gradient_integral_(encloser.level_set_.getProbeKernelGradientIntegral(ex_policy)),
+      riemann_solver_(encloser.riemann_solver_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      p_(encloser.dv_p_->DelegatedData(ex_policy)),
+      drho_dt_(encloser.dv_drho_dt_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType>
+void LevelSetWallAcousticStep1stHalfCK<RiemannSolverType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    UnsignedInt &package_hint = package_hint_[index_i];
+    // pointing to the wall, as the summation of dW_ijV_j * e_ij over the wall particles
+    Vecd kernel_gradient = kernel_gradient_integral_(pos_[index_i], package_hint);
+    Vecd wall_n = normal_direction_(pos_[index_i], package_hint);
+    Real r_iw = this->WallDistance(signed_distance_(pos_[index_i], package_hint));
+
+    Real face_wall_external_acceleration = (force_prior_[index_i] / mass_[index_i]).dot(wall_n);
+    Real p_in_wall = p_[index_i] + rho_[index_i] * r_iw * SMAX(Real(0), face_wall_external_acceleration);
+    Vecd force = -(p_[index_i] + p_in_wall) * kernel_gradient * Vol_[index_i];
+    // the summation of dW_ijV_j over the wall particles is approximated by the negative magnitude
+    Real rho_dissipation = -riemann_solver_.DissipativeUJump(p_[index_i] - p_in_wall) * kernel_gradient.norm();
+
+    force_[index_i] += force;
+    vel_[index_i] += force / mass_[index_i] * dt;
+    drho_dt_[index_i] += rho_dissipation * rho_[index_i];
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+LevelSetWallAcousticStep2ndHalfCK<RiemannSolverType>::
+    LevelSetWallAcousticStep2ndHalfCK(NearShapeSurface &near_surface)
+    : LevelSetWallBase(near_surface),
+      fluid_(DynamicCast<FluidType>(this, sph_body_->getBaseMaterial())),
+      riemann_solver_(fluid_, fluid_),
+      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure")),
+      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_drho_dt_(particles_->registerStateVariable<Real>("DensityChangeRate")),
+      dv_vel_(particles_->registerStateVariable<Vecd>("Velocity")),
+      dv_force_(particles_->registerStateVariable<Vecd>("Force")) {}
+//=================================================================================================//
+template <class RiemannSolverType>
+template <class ExecutionPolicy, class EncloserType>
+LevelSetWallAcousticStep2ndHalfCK<RiemannSolverType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : LevelSetWallBase::ComputingKernel(ex_policy, encloser),
+      normal_direction_(encloser.level_set_.getProbeNormalDirection(ex_policy)),
+      kernel_gradient_integral_(encloser.level_set_.getProbeKernelGradientIntegral(ex_policy)),
+      riemann_solver_(encloser.riemann_solver_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      drho_dt_(encloser.dv_drho_dt_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType>
+void LevelSetWallAcousticStep2ndHalfCK<RiemannSolverType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    UnsignedInt &package_hint = package_hint_[index_i];
+    Vecd kernel_gradient = kernel_gradient_integral_(pos_[index_i], package_hint);
+    Vecd face_to_fluid_n = -normal_direction_(pos_[index_i], package_hint);
+
+    // the velocity in the static wall is mirrored, i.e. -vel_[index_i]
+    Real density_change_rate = 2.0 * vel_[index_i].dot(kernel_gradient) * rho_[index_i];
+    Real u_jump = 2.0 * vel_[index_i].dot(face_to_fluid_n);
+    Vecd p_dissipation = -riemann_solver_.DissipativePJump(u_jump) * kernel_gradient.norm() * face_to_fluid_n;
+
+    drho_dt_[index_i] += density_change_rate;
+    rho_[index_i] += density_change_rate * dt * 0.5;
+    force_[index_i] += p_dissipation * Vol_[index_i];
+}
+//=================================================================================================//
+template <class ViscosityType>
+LevelSetWallViscousForceCK<ViscosityType>::LevelSetWallViscousForceCK(NearShapeSurface &near_surface)
+    : LevelSetWallBase(near_surface),
+      ForcePriorCK(particles_, "ViscousForceFrom" + near_surface.getLevelSetShape().getName()),
+      viscosity_model_(DynamicCast<ViscosityType>(this, particles_->getBaseMaterial())),
+      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure")),
+      dv_vel_(particles_->registerStateVariable<Vecd>("Velocity")),
+      dv_wall_viscous_force_(this->getCurrentForce()),
+      smoothing_length_sq_(pow(getSPHAdaptation().ReferenceSmoothingLength(), 2)) {}
+//=================================================================================================//
+template <class ViscosityType>
+template <class ExecutionPolicy, class EncloserType>
+LevelSetWallViscousForceCK<ViscosityType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : LevelSetWallBase::ComputingKernel(ex_policy, encloser),
+      ForcePriorCK::UpdateKernel(ex_policy, encloser),
+      one_side_viscosity_(encloser.viscosity_model_.getOneSideViscosity(ex_policy)),
+      signed_distance_(encloser.level_set_.getProbeSignedDistance(ex_policy)),
+      kernel_gradient_integral_(encloser.level_set_.getProbeKernelGradientIntegral(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      wall_viscous_force_(encloser.dv_wall_viscous_force_->DelegatedData(ex_policy)),
+      smoothing_length_sq_(encloser.smoothing_length_sq_) {}
+//=================================================================================================//
+template <class ViscosityType>
+void LevelSetWallViscousForceCK<ViscosityType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    UnsignedInt &package_hint = package_hint_[index_i];
+    Vecd kernel_gradient = kernel_gradient_integral_(pos_[index_i], package_hint);
+    Real r_iw = this->WallDistance(signed_distance_(pos_[index_i], package_hint));
+
+    Vecd vel_derivative = 2.0 * vel_[index_i] / (r_iw * r_iw + 0.01 * smoothing_length_sq_);
+    wall_viscous_force_[index_i] = -2.0 * r_iw * one_side_viscosity_(index_i) * vel_derivative *
+                                   kernel_gradient.norm() * Vol_[index_i];
+    ForcePriorCK::UpdateKernel::update(index_i, dt);
+}
+//=================================================================================================//
+template <class LimiterType, class ParticleScopeType>
+LevelSetWallTransportVelocityCorrectionCK<LimiterType, ParticleScopeType>::
+    LevelSetWallTransportVelocityCorrectionCK(NearShapeSurface &near_surface, Real coefficient)
+    : LevelSetWallBase(near_surface),
+      h_ref_(getSPHAdaptation().ReferenceSmoothingLength()),
+      correction_scaling_(coefficient * h_ref_ * h_ref_),
+      limiter_(h_ref_ * h_ref_), within_scope_method_(particles_),
+      dv_dpos_(particles_->getVariableByName<Vecd>("Displacement")),
+      dv_kernel_gradient_integral_(particles_->registerScratchVariable<Vecd>("KernelGradientIntegral")) {}
+//=================================================================================================//
+template <class LimiterType, class ParticleScopeType>
+template <class ExecutionPolicy, class EncloserType>
+LevelSetWallTransportVelocityCorrectionCK<LimiterType, ParticleScopeType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : LevelSetWallBase::ComputingKernel(ex_policy, encloser),
+      kernel_gradient_integral_probe_(encloser.level_set_.getProbeKernelGradientIntegral(ex_policy)),
+      correction_scaling_(encloser.correction_scaling_), limiter_(encloser.limiter_),
+      dpos_(encloser.dv_dpos_->DelegatedData(ex_policy)),
+      kernel_gradient_integral_(encloser.dv_kernel_gradient_integral_->DelegatedData(ex_policy)),
+      within_scope_(ex_policy, encloser.within_scope_method_, *this) {}
+//=================================================================================================//
+template <class LimiterType, class ParticleScopeType>
+void LevelSetWallTransportVelocityCorrectionCK<LimiterType, ParticleScopeType>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    Vecd previous = kernel_gradient_integral_[index_i];
+    Vecd current = previous - 2.0 * kernel_gradient_integral_probe_(pos_[index_i], package_hint_[index_i]);
+    kernel_gradient_integral_[index_i] = current;
+    if (within_scope_(index_i))
+    {
+        // replaces the correction already done without the wall contribution
+        dpos_[index_i] += correction_scaling_ * (limiter_(current.squaredNorm()) * current -
+                                                 limiter_(previous.squaredNorm()) * previous);
+    }
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // LEVEL_SET_WALL_CK_HPP
@@ -0,0 +1,43 @@
+#include "reduced_order_coupling_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+WindkesselFarField::WindkesselFarField(Real proximal_resistance, Real compliance, Real distal_resistance,
+                                       Real reference_pressure, Real initial_compliance_pressure)
+    : proximal_resistance_(proximal_resistance), compliance_(compliance),
+      distal_resistance_(distal_resistance), reference_pressure_(reference_pressure),
+      compliance_pressure_(initial_compliance_pressure)
+{
+    if (compliance_ <= 0.0 || distal_resistance_ <= 0.0)
+    {
+        std::cout << "\n Error: WindkesselFarField requires positive compliance and distal resistance!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+Real WindkesselFarField::advance(Real outflow_rate, Real dt)
+{
+    Real relaxation = dt / (compliance_ * distal_resistance_);
+    compliance_pressure_ = (compliance_pressure_ + dt * outflow_rate / compliance_ +
+                            relaxation * reference_pressure_) /
+                           (1.0 + relaxation);
+    return compliance_pressure_ + proximal_resistance_ * outflow_rate;
+}
+//=================================================================================================//
+BufferFlowRateCK::BufferFlowRateCK(AlignedBoxByCell &aligned_box_part)
+    : BaseLocalDynamicsReduce<ReduceSum<Real>, AlignedBoxByCell>(aligned_box_part),
+      sv_aligned_box_(aligned_box_part.svAlignedBox()),
+      buffer_length_(2.0 * sv_aligned_box_->getValue().HalfSize()[sv_aligned_box_->getValue().AlignmentAxis()]),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_vel_(particles_->getVariableByName<Vecd>("Velocity")),
+      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure"))
+{
+    quantity_name_ = aligned_box_part.getName() + "FlowRate";
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
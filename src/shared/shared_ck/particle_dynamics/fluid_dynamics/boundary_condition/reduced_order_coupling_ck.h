@@ -0,0 +1,151 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	reduced_order_coupling_ck.h
+ * @brief 	Bidirectional buffer coupled with a reduced-order far-field model.
+ * @details The flow rate through the buffer is reduced and passed to a cheap lumped
+ *          (or analytical) model of the truncated downstream domain every exchange,
+ *          which returns the pressure imposed by the buffer in the next steps.
+ *          Hence the SPH domain can be cut down to the region of interest.
+ *          The alignment axis of the buffer points into the fluid domain as for the emitters,
+ *          so that the flow rate leaving the domain is positive for the far-field model.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef REDUCED_ORDER_COUPLING_CK_H
+#define REDUCED_ORDER_COUPLING_CK_H
+
+#include "bidirectional_boundary_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+/** A purely resistive far-field, p = p_ref + R Q. */
+class ResistanceFarField
+{
+  public:
+    ResistanceFarField(Real resistance, Real reference_pressure = 0.0)
+        : resistance_(resistance), reference_pressure_(reference_pressure) {};
+    Real InitialPressure() { return reference_pressure_; };
+    Real advance(Real outflow_rate, Real dt) { return reference_pressure_ + resistance_ * outflow_rate; };
+
+  protected:
+    Real resistance_, reference_pressure_;
+};
+
+/**
+ * @class WindkesselFarField
+ * @brief Three-element Windkessel model: a proximal resistance in series with
+ * a parallel compliance and distal resistance, the latter leading to the reference pressure.
+ */
+class WindkesselFarField
+{
+  public:
+    WindkesselFarField(Real proximal_resistance, Real compliance, Real distal_resistance,
+                       Real reference_pressure = 0.0, Real initial_compliance_pressure = 0.0);
+    Real InitialPressure() { return compliance_pressure_; };
+    /** Implicit Euler for the compliance pressure, which is unconditionally stable. */
+    Real advance(Real outflow_rate, Real dt);
+
+  protected:
+    Real proximal_resistance_, compliance_, distal_resistance_, reference_pressure_;
+    Real compliance_pressure_;
+};
+
+class BufferFlowRateCK : public BaseLocalDynamicsReduce<ReduceSum<Real>, AlignedBoxByCell>
+{
+  public:
+    explicit BufferFlowRateCK(AlignedBoxByCell &aligned_box_part);
+    virtual ~BufferFlowRateCK() {};
+
+    class FinishDynamics
+    {
+        Real buffer_length_;
+
+      public:
+        using OutputType = Real;
+        template <class EncloserType>
+        FinishDynamics(EncloserType &encloser) : buffer_length_(encloser.buffer_length_){};
+        /** The volume flux averaged over the buffer length, positive leaving the domain. */
+        Real Result(const Real &reduced_value) { return -reduced_value / buffer_length_; };
+    };
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        Real reduce(size_t index_i, Real dt = 0.0);
+
+      protected:
+        AlignedBox *aligned_box_;
+        Vecd *pos_, *vel_;
+        Real *Vol_;
+    };
+
+  protected:
+    SingularVariable<AlignedBox> *sv_aligned_box_;
+    Real buffer_length_;
+    DiscreteVariable<Vecd> *dv_pos_, *dv_vel_;
+    DiscreteVariable<Real> *dv_Vol_;
+};
+
+template <class ReducedModelType>
+class ReducedOrderFarField
+{
+  public:
+    template <typename... Args>
+    ReducedOrderFarField(AlignedBoxByCell &aligned_box_part, Args &&...args)
+        : reduced_model_(std::forward<Args>(args)...),
+          sv_far_field_pressure_(aligned_box_part.getName() + "FarFieldPressure",
+                                 reduced_model_.InitialPressure()){};
+    ReducedModelType &getReducedModel() { return reduced_model_; };
+    SingularVariable<Real> *svFarFieldPressure() { return &sv_far_field_pressure_; };
+
+  protected:
+    ReducedModelType reduced_model_;
+    SingularVariable<Real> sv_far_field_pressure_;
+};
+
+template <typename ExecutionPolicy, class KernelCorrectionType,
+          class ReducedModelType, class FluidType = WeaklyCompressibleFluid>
+class ReducedOrderCoupledBoundaryCK
+    : public ReducedOrderFarField<ReducedModelType>,
+      public BidirectionalBoundaryCK<ExecutionPolicy, KernelCorrectionType, ReducedOrderPressure<FluidType>>
+{
+    ReduceDynamicsCK<ExecutionPolicy, BufferFlowRateCK> buffer_flow_rate_;
+
+  public:
+    template <typename... Args>
+    ReducedOrderCoupledBoundaryCK(AlignedBoxByCell &aligned_box_part, Args &&...args);
+    /** Exchange with the far-field model, called once per advection step before the boundary condition. */
+    Real exchangeFarField(Real dt);
+    Real FlowRate() { return flow_rate_; };
+
+  protected:
+    Real flow_rate_;
+};
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // REDUCED_ORDER_COUPLING_CK_H
@@ -0,0 +1,52 @@
+#ifndef REDUCED_ORDER_COUPLING_CK_HPP
+#define REDUCED_ORDER_COUPLING_CK_HPP
+
+#include "reduced_order_coupling_ck.h"
+
+#include "bidirectional_boundary_ck.hpp"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+BufferFlowRateCK::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : aligned_box_(encloser.sv_aligned_box_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+inline Real BufferFlowRateCK::ReduceKernel::reduce(size_t index_i, Real dt)
+{
+    if (aligned_box_->checkContain(pos_[index_i]))
+    {
+        Vecd frame_velocity = aligned_box_->getTransform().xformBaseVecToFrame(vel_[index_i]);
+        return frame_velocity[aligned_box_->AlignmentAxis()] * Vol_[index_i];
+    }
+    return Real(0);
+}
+//=================================================================================================//
+template <typename ExecutionPolicy, class KernelCorrectionType, class ReducedModelType, class FluidType>
+template <typename... Args>
+ReducedOrderCoupledBoundaryCK<ExecutionPolicy, KernelCorrectionType, ReducedModelType, FluidType>::
+    ReducedOrderCoupledBoundaryCK(AlignedBoxByCell &aligned_box_part, Args &&...args)
+    : ReducedOrderFarField<ReducedModelType>(aligned_box_part, std::forward<Args>(args)...),
+      BidirectionalBoundaryCK<ExecutionPolicy, KernelCorrectionType, ReducedOrderPressure<FluidType>>(
+          aligned_box_part, this->sv_far_field_pressure_.DelegatedData(ExecutionPolicy{})),
+      buffer_flow_rate_(aligned_box_part), flow_rate_(0) {}
+//=================================================================================================//
+template <typename ExecutionPolicy, class KernelCorrectionType, class ReducedModelType, class FluidType>
+Real ReducedOrderCoupledBoundaryCK<ExecutionPolicy, KernelCorrectionType, ReducedModelType, FluidType>::
+    exchangeFarField(Real dt)
+{
+    flow_rate_ = buffer_flow_rate_.exec();
+    Real far_field_pressure = this->reduced_model_.advance(flow_rate_, dt);
+    this->sv_far_field_pressure_.setValue(far_field_pressure);
+    return far_field_pressure;
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // REDUCED_ORDER_COUPLING_CK_HPP
@@ -0,0 +1,32 @@
+#include "relaxation_zone_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+LinearWaveVelocityTarget::
+    LinearWaveVelocityTarget(Real wave_height, Real wave_period, Real water_depth,
+                             Real still_water_level, Real gravity, Real start_x)
+    : wave_number_(1.0), angular_frequency_(2.0 * Pi / wave_period), amplitude_factor_(0),
+      still_water_level_(still_water_level), bottom_level_(still_water_level - water_depth),
+      start_x_(start_x)
+{
+    // solve the linear dispersion relation by Newton iteration
+    Real target = angular_frequency_ * angular_frequency_ / gravity;
+    wave_number_ = SMAX(target, 2.0 * Pi / (wave_period * std::sqrt(gravity * water_depth)));
+    for (int i = 0; i != 50; ++i)
+    {
+        Real tanh_kd = std::tanh(wave_number_ * water_depth);
+        Real residual = wave_number_ * tanh_kd - target;
+        Real derivative = tanh_kd + wave_number_ * water_depth * (1.0 - tanh_kd * tanh_kd);
+        Real wave_number_old = wave_number_;
+        wave_number_ = wave_number_old - residual / derivative;
+        if (ABS(wave_number_ - wave_number_old) <= 1.0e-10 * wave_number_)
+            break;
+    }
+    amplitude_factor_ = 0.5 * wave_height * angular_frequency_ / std::sinh(wave_number_ * water_depth);
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
@@ -0,0 +1,119 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	relaxation_zone_ck.h
+ * @brief 	Relaxation zones for wave generation and absorption in numerical wave tanks
+ *          for computing kernels.
+ * @details The fluid velocity in an aligned box is relaxed toward a target velocity
+ *          with a weight growing from zero at the lower bound to one at the upper bound
+ *          of the alignment axis. Therefore, the upper bound is set to the outer end of the zone,
+ *          i.e. the wave maker side of a generation zone or the tank end of an absorption zone.
+ *          The free surface follows the relaxed velocity, so that it is not imposed directly.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef RELAXATION_ZONE_CK_H
+#define RELAXATION_ZONE_CK_H
+
+#include "base_body_part.h"
+#include "base_fluid_dynamics.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+/** Target velocity for the absorption zone, in which the waves are damped out. */
+struct ZeroVelocityTarget
+{
+    Vecd operator()(const Vecd &position, Real time) { return Vecd::Zero(); };
+};
+
+/**
+ * @class LinearWaveVelocityTarget
+ * @brief The orbital velocity of a linear (Airy) wave propagating along the positive x-axis,
+ * with the vertical axis being the last coordinate axis.
+ */
+class LinearWaveVelocityTarget
+{
+  public:
+    LinearWaveVelocityTarget(Real wave_height, Real wave_period, Real water_depth,
+                             Real still_water_level, Real gravity, Real start_x = 0.0);
+    Vecd operator()(const Vecd &position, Real time)
+    {
+        Real phase = wave_number_ * (position[0] - start_x_) - angular_frequency_ * time;
+        Real depth_factor = wave_number_ * (SMIN(position[Dimensions - 1], still_water_level_) - bottom_level_);
+        Vecd velocity = Vecd::Zero();
+        velocity[0] = amplitude_factor_ * math::cosh(depth_factor) * math::cos(phase);
+        velocity[Dimensions - 1] = amplitude_factor_ * math::sinh(depth_factor) * math::sin(phase);
+        return velocity;
+    };
+    Real WaveNumber() { return wave_number_; };
+    Real AngularFrequency() { return angular_frequency_; };
+
+  protected:
+    Real wave_number_, angular_frequency_, amplitude_factor_;
+    Real still_water_level_, bottom_level_, start_x_;
+};
+
+template <class TargetVelocityType>
+class RelaxationZoneCK : public BaseLocalDynamics<AlignedBoxByCell>
+{
+  public:
+    template <typename... Args>
+    RelaxationZoneCK(AlignedBoxByCell &aligned_box_part, Real relaxation_rate, Args &&...args);
+    virtual ~RelaxationZoneCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        AlignedBox *aligned_box_;
+        TargetVelocityType target_velocity_;
+        Real relaxation_rate_;
+        Real *physical_time_;
+        Vecd *pos_, *vel_;
+
+        /** The relaxation function of Jacobsen et al. (2012) with the normalized coordinate. */
+        Real RelaxationWeight(Real coordinate)
+        {
+            return (math::exp(math::pow(coordinate, Real(3.5))) - Real(1)) / (math::exp(Real(1)) - Real(1));
+        };
+    };
+
+  protected:
+    SingularVariable<AlignedBox> *sv_aligned_box_;
+    TargetVelocityType target_velocity_;
+    Real relaxation_rate_; /**< inverse of the relaxation time at the upper bound */
+    SingularVariable<Real> *sv_physical_time_;
+    DiscreteVariable<Vecd> *dv_pos_, *dv_vel_;
+};
+
+using WaveAbsorptionZoneCK = RelaxationZoneCK<ZeroVelocityTarget>;
+using LinearWaveGenerationZoneCK = RelaxationZoneCK<LinearWaveVelocityTarget>;
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // RELAXATION_ZONE_CK_H
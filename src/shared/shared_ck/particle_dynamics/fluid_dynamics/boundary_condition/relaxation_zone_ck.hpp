@@ -0,0 +1,49 @@
+#ifndef RELAXATION_ZONE_CK_HPP
+#define RELAXATION_ZONE_CK_HPP
+
+#include "relaxation_zone_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class TargetVelocityType>
+template <typename... Args>
+RelaxationZoneCK<TargetVelocityType>::
+    RelaxationZoneCK(AlignedBoxByCell &aligned_box_part, Real relaxation_rate, Args &&...args)
+    : BaseLocalDynamics<AlignedBoxByCell>(aligned_box_part),
+      sv_aligned_box_(aligned_box_part.svAlignedBox()),
+      target_velocity_(std::forward<Args>(args)...), relaxation_rate_(relaxation_rate),
+      sv_physical_time_(sph_system_->getSystemVariableByName<Real>("PhysicalTime")),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_vel_(particles_->getVariableByName<Vecd>("Velocity")) {}
+//=================================================================================================//
+template <class TargetVelocityType>
+template <class ExecutionPolicy, class EncloserType>
+RelaxationZoneCK<TargetVelocityType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : aligned_box_(encloser.sv_aligned_box_->DelegatedData(ex_policy)),
+      target_velocity_(encloser.target_velocity_),
+      relaxation_rate_(encloser.relaxation_rate_),
+      physical_time_(encloser.sv_physical_time_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class TargetVelocityType>
+void RelaxationZoneCK<TargetVelocityType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    if (aligned_box_->checkContain(pos_[index_i]))
+    {
+        int axis = aligned_box_->AlignmentAxis();
+        Real halfsize = aligned_box_->HalfSize()[axis];
+        Vecd position_in_frame = aligned_box_->getTransform().shiftBaseStationToFrame(pos_[index_i]);
+        Real coordinate = SMIN(SMAX(0.5 * (position_in_frame[axis] + halfsize) / halfsize, Real(0)), Real(1));
+        Real relaxation = SMIN(dt * relaxation_rate_ * RelaxationWeight(coordinate), Real(1));
+        vel_[index_i] += relaxation * (target_velocity_(pos_[index_i], *physical_time_) - vel_[index_i]);
+    }
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // RELAXATION_ZONE_CK_HPP
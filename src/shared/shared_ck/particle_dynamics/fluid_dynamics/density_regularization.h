@@ -109,7 +109,8 @@ class DensityRegularization<Base, RelationType<Parameters...>>
         Real InitialDensity() { return rho0_; };
 
       protected:
-        Real *rho_, *mass_, *rho_sum_, *Vol_;
+        Real *rho_, *rho_sum_, *Vol_;
+        const Real *mass_;
         Real rho0_, inv_sigma0_;
     };
 
@@ -181,7 +182,7 @@ class DensityRegularization<Contact<Parameters...>>
 
       protected:
         Real contact_inv_rho0_k_;
-        Real *contact_mass_k_;
+        const Real *contact_mass_k_;
     };
 
   protected:
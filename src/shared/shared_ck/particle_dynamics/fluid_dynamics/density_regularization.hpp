@@ -17,7 +17,7 @@ DensityRegularization<Base, RelationType<Parameters...>>::
     : Interaction<RelationType<Parameters...>>(identifier),
       dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
       dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
-      dv_rho_sum_(this->particles_->template registerStateVariable<Real>("DensitySummation")),
+      dv_rho_sum_(this->particles_->template registerScratchVariable<Real>("DensitySummation")),
       rho0_(this->sph_body_->getBaseMaterial().ReferenceDensity()),
       inv_sigma0_(1.0 / this->sph_adaptation_->LatticeNumberDensity()) {}
 //=================================================================================================//
@@ -30,7 +30,7 @@ DensityRegularization<Base, RelationType<Parameters...>>::InteractKernel::
     : Interaction<RelationType<Parameters...>>::
           InteractKernel(ex_policy, encloser, std::forward<Args>(args)...),
       rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
-      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
       rho_sum_(encloser.dv_rho_sum_->DelegatedData(ex_policy)),
       Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
       rho0_(encloser.rho0_), inv_sigma0_(encloser.inv_sigma0_) {}
@@ -57,8 +57,9 @@ void DensityRegularization<Inner<WithUpdate, RegularizationType, ParticleScopeTy
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Real sigma = W0_;
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-        sigma += this->W_ij(index_i, this->neighbor_index_[n]);
+    SIMD_SUM_REDUCTION(sigma)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+        sigma += this->W_ij(index_i, this->neighbor_index_[n], n);
 
     this->rho_sum_[index_i] = sigma * this->rho0_ * this->inv_sigma0_;
 }
@@ -104,17 +105,18 @@ DensityRegularization<Contact<Parameters...>>::InteractKernel::
     : DensityRegularization<Base, Contact<Parameters...>>::
           InteractKernel(ex_policy, encloser, contact_index),
       contact_inv_rho0_k_(encloser.contact_inv_rho0_[contact_index]),
-      contact_mass_k_(encloser.dv_contact_mass_[contact_index]->DelegatedData(ex_policy)) {}
+      contact_mass_k_(encloser.dv_contact_mass_[contact_index]->ConstDelegatedData(ex_policy)) {}
 //=================================================================================================//
 template <typename... Parameters>
 void DensityRegularization<Contact<Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Real sigma(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    SIMD_SUM_REDUCTION(sigma)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        sigma += this->W_ij(index_i, index_j) * contact_inv_rho0_k_ * contact_mass_k_[index_j];
+        sigma += this->W_ij(index_i, index_j, n) * contact_inv_rho0_k_ * contact_mass_k_[index_j];
     }
     this->rho_sum_[index_i] += sigma * this->rho0_ * this->rho0_ *
                                this->inv_sigma0_ / this->mass_[index_i];
@@ -0,0 +1,222 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	eulerian_compressible_step_ck.h
+ * @brief 	Here, we define the integration classes for compressible fluids in the Eulerian method,
+ *          as the computing kernels of EulerianCompressibleIntegration1stHalf and 2ndHalf.
+ * @details The pair geometry is read from the relation cache if available,
+ *          e.g. for a static relation, as the particles do not move in the Eulerian method.
+ * @author	Zhentong Wang and Xiangyu Hu
+ */
+
+#ifndef EULERIAN_COMPRESSIBLE_STEP_CK_H
+#define EULERIAN_COMPRESSIBLE_STEP_CK_H
+
+#include "base_fluid_dynamics.h"
+#include "compressible_fluid.h"
+#include "compressible_riemann_solver_ck.hpp"
+#include "interaction_ck.hpp"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+template <class BaseInteractionType>
+class EulerianCompressibleStep : public BaseInteractionType
+{
+  public:
+    template <class DynamicsIdentifier>
+    explicit EulerianCompressibleStep(DynamicsIdentifier &identifier);
+    virtual ~EulerianCompressibleStep() {};
+
+  protected:
+    DiscreteVariable<Real> *dv_rho_, *dv_mass_, *dv_p_, *dv_E_, *dv_dE_dt_, *dv_dmass_dt_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_mom_, *dv_force_, *dv_force_prior_;
+};
+
+template <typename...>
+class EulerianCompressibleStep1stHalf;
+
+template <class RiemannSolverType, typename... Parameters>
+class EulerianCompressibleStep1stHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>
+    : public EulerianCompressibleStep<Interaction<Inner<Parameters...>>>
+{
+    using FluidType = typename RiemannSolverType::SourceFluid;
+    using BaseInteraction = EulerianCompressibleStep<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit EulerianCompressibleStep1stHalf(Inner<Parameters...> &inner_relation, Real limiter_parameter = 5.0);
+    virtual ~EulerianCompressibleStep1stHalf() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser){};
+        void initialize(size_t index_i, Real dt = 0.0){};
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        RiemannSolverType riemann_solver_;
+        Real *Vol_, *rho_, *p_, *E_;
+        Vecd *vel_, *force_, *force_prior_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *mass_;
+        Vecd *vel_, *mom_, *force_;
+    };
+
+  protected:
+    FluidType &fluid_;
+    RiemannSolverType riemann_solver_;
+};
+
+template <typename...>
+class EulerianCompressibleStep2ndHalf;
+
+template <class RiemannSolverType, typename... Parameters>
+class EulerianCompressibleStep2ndHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>
+    : public EulerianCompressibleStep<Interaction<Inner<Parameters...>>>
+{
+    using FluidType = typename RiemannSolverType::SourceFluid;
+    using EosKernel = typename FluidType::EosKernel;
+    using BaseInteraction = EulerianCompressibleStep<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit EulerianCompressibleStep2ndHalf(Inner<Parameters...> &inner_relation, Real limiter_parameter = 5.0);
+    virtual ~EulerianCompressibleStep2ndHalf() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser){};
+        void initialize(size_t index_i, Real dt = 0.0){};
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        RiemannSolverType riemann_solver_;
+        Real *Vol_, *rho_, *p_, *E_, *dE_dt_, *dmass_dt_;
+        Vecd *vel_, *force_prior_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        EosKernel eos_;
+        Real *Vol_, *rho_, *mass_, *p_, *E_, *dE_dt_, *dmass_dt_;
+        Vecd *mom_;
+    };
+
+  protected:
+    FluidType &fluid_;
+    RiemannSolverType riemann_solver_;
+};
+
+using EulerianCompressibleStep1stHalfHLLCRiemannCK =
+    EulerianCompressibleStep1stHalf<Inner<OneLevel, HLLCRiemannSolverCK>>;
+using EulerianCompressibleStep1stHalfHLLCWithLimiterRiemannCK =
+    EulerianCompressibleStep1stHalf<Inner<OneLevel, HLLCWithLimiterRiemannSolverCK>>;
+using EulerianCompressibleStep2ndHalfHLLCRiemannCK =
+    EulerianCompressibleStep2ndHalf<Inner<OneLevel, HLLCRiemannSolverCK>>;
+using EulerianCompressibleStep2ndHalfHLLCWithLimiterRiemannCK =
+    EulerianCompressibleStep2ndHalf<Inner<OneLevel, HLLCWithLimiterRiemannSolverCK>>;
+
+template <class FluidType = CompressibleFluid>
+class EulerianCompressibleAcousticTimeStepCK : public LocalDynamicsReduce<ReduceMax>
+{
+    using EosKernel = typename FluidType::EosKernel;
+
+  public:
+    explicit EulerianCompressibleAcousticTimeStepCK(SPHBody &sph_body, Real acousticCFL = 0.6);
+    virtual ~EulerianCompressibleAcousticTimeStepCK() {};
+
+    class FinishDynamics
+    {
+        Real h_ref_, acousticCFL_;
+
+      public:
+        using OutputType = Real;
+        FinishDynamics(EulerianCompressibleAcousticTimeStepCK<FluidType> &encloser)
+            : h_ref_(encloser.h_ref_), acousticCFL_(encloser.acousticCFL_){};
+        Real Result(Real reduced_value) { return acousticCFL_ / Dimensions * h_ref_ / (reduced_value + TinyReal); };
+    };
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EulerianCompressibleAcousticTimeStepCK<FluidType> &encloser)
+            : eos_(encloser.fluid_),
+              rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+              p_(encloser.dv_p_->DelegatedData(ex_policy)),
+              vel_(encloser.dv_vel_->DelegatedData(ex_policy)){};
+
+        Real reduce(size_t index_i, Real dt = 0.0)
+        {
+            return eos_.getSoundSpeed(p_[index_i], rho_[index_i]) + vel_[index_i].norm();
+        };
+
+      protected:
+        EosKernel eos_;
+        Real *rho_, *p_;
+        Vecd *vel_;
+    };
+
+  protected:
+    FluidType &fluid_;
+    DiscreteVariable<Real> *dv_rho_, *dv_p_;
+    DiscreteVariable<Vecd> *dv_vel_;
+    Real h_ref_;
+    Real acousticCFL_;
+};
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // EULERIAN_COMPRESSIBLE_STEP_CK_H
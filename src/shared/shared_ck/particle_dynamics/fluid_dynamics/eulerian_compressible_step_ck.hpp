@@ -0,0 +1,169 @@
+#ifndef EULERIAN_COMPRESSIBLE_STEP_CK_HPP
+#define EULERIAN_COMPRESSIBLE_STEP_CK_HPP
+
+#include "eulerian_compressible_step_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class BaseInteractionType>
+template <class DynamicsIdentifier>
+EulerianCompressibleStep<BaseInteractionType>::EulerianCompressibleStep(DynamicsIdentifier &identifier)
+    : BaseInteractionType(identifier),
+      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_p_(this->particles_->template registerStateVariable<Real>("Pressure")),
+      dv_E_(this->particles_->template registerStateVariable<Real>("TotalEnergy")),
+      dv_dE_dt_(this->particles_->template registerStateVariable<Real>("TotalEnergyChangeRate")),
+      dv_dmass_dt_(this->particles_->template registerStateVariable<Real>("MassChangeRate")),
+      dv_vel_(this->particles_->template registerStateVariable<Vecd>("Velocity")),
+      dv_mom_(this->particles_->template registerStateVariable<Vecd>("Momentum")),
+      dv_force_(this->particles_->template registerStateVariable<Vecd>("Force")),
+      dv_force_prior_(this->particles_->template registerStateVariable<Vecd>("ForcePrior")) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+EulerianCompressibleStep1stHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    EulerianCompressibleStep1stHalf(Inner<Parameters...> &inner_relation, Real limiter_parameter)
+    : BaseInteraction(inner_relation),
+      fluid_(DynamicCast<FluidType>(this, this->sph_body_->getBaseMaterial())),
+      riemann_solver_(this->fluid_, this->fluid_, limiter_parameter) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+EulerianCompressibleStep1stHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      riemann_solver_(encloser.riemann_solver_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      p_(encloser.dv_p_->DelegatedData(ex_policy)),
+      E_(encloser.dv_E_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+void EulerianCompressibleStep1stHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    CompressibleStateCK state_i{rho_[index_i], vel_[index_i], p_[index_i], E_[index_i] / Vol_[index_i]};
+    Vecd momentum_change_rate = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real dW_ijV_j = this->dW_ij(index_i, index_j, n) * Vol_[index_j];
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+
+        CompressibleStateCK state_j{rho_[index_j], vel_[index_j], p_[index_j], E_[index_j] / Vol_[index_j]};
+        CompressibleStateCK interface_state = riemann_solver_.getInterfaceState(state_i, state_j, e_ij);
+        // the convective flux is projected on e_ij directly instead of assembling the matrix
+        momentum_change_rate -= dW_ijV_j * (interface_state.rho_ * interface_state.vel_.dot(e_ij) * interface_state.vel_ +
+                                             interface_state.p_ * e_ij);
+    }
+    force_[index_i] = force_prior_[index_i] + 2.0 * Vol_[index_i] * momentum_change_rate;
+}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+EulerianCompressibleStep1stHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      mom_(encloser.dv_mom_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+void EulerianCompressibleStep1stHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    mom_[index_i] += force_[index_i] * dt;
+    vel_[index_i] = mom_[index_i] / mass_[index_i];
+}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+EulerianCompressibleStep2ndHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    EulerianCompressibleStep2ndHalf(Inner<Parameters...> &inner_relation, Real limiter_parameter)
+    : BaseInteraction(inner_relation),
+      fluid_(DynamicCast<FluidType>(this, this->sph_body_->getBaseMaterial())),
+      riemann_solver_(this->fluid_, this->fluid_, limiter_parameter) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+EulerianCompressibleStep2ndHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      riemann_solver_(encloser.riemann_solver_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      p_(encloser.dv_p_->DelegatedData(ex_policy)),
+      E_(encloser.dv_E_->DelegatedData(ex_policy)),
+      dE_dt_(encloser.dv_dE_dt_->DelegatedData(ex_policy)),
+      dmass_dt_(encloser.dv_dmass_dt_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+void EulerianCompressibleStep2ndHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    CompressibleStateCK state_i{rho_[index_i], vel_[index_i], p_[index_i], E_[index_i] / Vol_[index_i]};
+    Real mass_change_rate = 0.0;
+    Real energy_change_rate = 0.0;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real dW_ijV_j = this->dW_ij(index_i, index_j, n) * Vol_[index_j];
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+
+        CompressibleStateCK state_j{rho_[index_j], vel_[index_j], p_[index_j], E_[index_j] / Vol_[index_j]};
+        CompressibleStateCK interface_state = riemann_solver_.getInterfaceState(state_i, state_j, e_ij);
+        Real normal_velocity = interface_state.vel_.dot(e_ij);
+        mass_change_rate -= dW_ijV_j * interface_state.rho_ * normal_velocity;
+        energy_change_rate -= dW_ijV_j * (interface_state.E_ + interface_state.p_) * normal_velocity;
+    }
+    dmass_dt_[index_i] = 2.0 * Vol_[index_i] * mass_change_rate;
+    // TODO: the work of the prior force is not in conservative formulation
+    dE_dt_[index_i] = force_prior_[index_i].dot(vel_[index_i]) + 2.0 * Vol_[index_i] * energy_change_rate;
+}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+EulerianCompressibleStep2ndHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : eos_(encloser.fluid_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      p_(encloser.dv_p_->DelegatedData(ex_policy)),
+      E_(encloser.dv_E_->DelegatedData(ex_policy)),
+      dE_dt_(encloser.dv_dE_dt_->DelegatedData(ex_policy)),
+      dmass_dt_(encloser.dv_dmass_dt_->DelegatedData(ex_policy)),
+      mom_(encloser.dv_mom_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class RiemannSolverType, typename... Parameters>
+void EulerianCompressibleStep2ndHalf<Inner<OneLevel, RiemannSolverType, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    E_[index_i] += dE_dt_[index_i] * dt;
+    mass_[index_i] += dmass_dt_[index_i] * dt;
+    rho_[index_i] = mass_[index_i] / Vol_[index_i];
+    Real rho_e = E_[index_i] / Vol_[index_i] - 0.5 * (mom_[index_i] / mass_[index_i]).squaredNorm() * rho_[index_i];
+    p_[index_i] = eos_.getPressure(rho_[index_i], rho_e);
+}
+//=================================================================================================//
+template <class FluidType>
+EulerianCompressibleAcousticTimeStepCK<FluidType>::
+    EulerianCompressibleAcousticTimeStepCK(SPHBody &sph_body, Real acousticCFL)
+    : LocalDynamicsReduce<ReduceMax>(sph_body),
+      fluid_(DynamicCast<FluidType>(this, particles_->getBaseMaterial())),
+      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_p_(particles_->getVariableByName<Real>("Pressure")),
+      dv_vel_(particles_->getVariableByName<Vecd>("Velocity")),
+      h_ref_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()),
+      acousticCFL_(acousticCFL) {}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // EULERIAN_COMPRESSIBLE_STEP_CK_HPP
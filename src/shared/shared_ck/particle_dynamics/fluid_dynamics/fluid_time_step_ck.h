@@ -33,6 +33,7 @@
 #define FLUID_TIME_STEP_CK_H
 
 #include "base_fluid_dynamics.h"
+#include "health_check_ck.h"
 #include "weakly_compressible_fluid.h"
 
 namespace SPH
@@ -40,7 +41,7 @@ namespace SPH
 namespace fluid_dynamics
 {
 template <class FluidType = WeaklyCompressibleFluid>
-class AcousticTimeStepCK : public LocalDynamicsReduce<ReduceMax>
+class AcousticTimeStepCK : public LocalDynamicsReduce<ReduceMax>, public WithHealthCheckCK
 {
     using EosKernel = typename FluidType::EosKernel;
 
@@ -66,10 +67,14 @@ class AcousticTimeStepCK : public LocalDynamicsReduce<ReduceMax>
 
         Real reduce(size_t index_i, Real dt = 0.0)
         {
-            return eos_.getSoundSpeed(p_[index_i], rho_[index_i]) + vel_[index_i].norm();
+            Real squared_velocity = vel_[index_i].squaredNorm();
+            Real signal_speed = eos_.getSoundSpeed(p_[index_i], rho_[index_i]) + sqrt(squared_velocity);
+            health_check_.check(signal_speed, squared_velocity);
+            return signal_speed;
         };
 
       protected:
+        HealthCheckCK::ComputingKernel health_check_;
         EosKernel eos_;
         Real *rho_, *p_;
         Vecd *vel_;
@@ -84,7 +89,7 @@ class AcousticTimeStepCK : public LocalDynamicsReduce<ReduceMax>
     Real acousticCFL_;
 };
 
-class AdvectionTimeStepCK : public LocalDynamicsReduce<ReduceMax>
+class AdvectionTimeStepCK : public LocalDynamicsReduce<ReduceMax>, public WithHealthCheckCK
 {
   public:
     AdvectionTimeStepCK(SPHBody &sph_body, Real U_ref, Real advectionCFL = 0.25);
@@ -106,8 +111,9 @@ class AdvectionTimeStepCK : public LocalDynamicsReduce<ReduceMax>
       public:
         template <class ExecutionPolicy>
         ReduceKernel(const ExecutionPolicy &ex_policy, AdvectionTimeStepCK &encloser)
-            : h_min_(encloser.h_min_),
-              mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+            : health_check_(ex_policy, encloser.health_check_),
+              h_min_(encloser.h_min_),
+              mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
               vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
               force_(encloser.dv_force_->DelegatedData(ex_policy)),
               force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)){};
@@ -116,12 +122,15 @@ class AdvectionTimeStepCK : public LocalDynamicsReduce<ReduceMax>
         {
             Real acceleration_scale =
                 4.0 * h_min_ * (force_[index_i] + force_prior_[index_i]).norm() / mass_[index_i];
-            return SMAX(vel_[index_i].squaredNorm(), acceleration_scale);
+            Real squared_velocity = vel_[index_i].squaredNorm();
+            health_check_.check(acceleration_scale, squared_velocity);
+            return SMAX(squared_velocity, acceleration_scale);
         };
 
       protected:
+        HealthCheckCK::ComputingKernel health_check_;
         Real h_min_;
-        Real *mass_;
+        const Real *mass_;
         Vecd *vel_, *force_, *force_prior_;
     };
 
@@ -162,7 +171,8 @@ class AdvectionStepSetup : public LocalDynamics
         };
 
       protected:
-        Real *Vol_, *mass_, *rho_;
+        Real *Vol_, *rho_;
+        const Real *mass_;
         Vecd *dpos_;
     };
 
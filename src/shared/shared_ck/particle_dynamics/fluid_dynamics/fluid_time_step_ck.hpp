@@ -35,7 +35,7 @@ template <class FluidType>
 template <class ExecutionPolicy>
 AcousticTimeStepCK<FluidType>::ReduceKernel::ReduceKernel(
     const ExecutionPolicy &ex_policy, AcousticTimeStepCK<FluidType> &encloser)
-    : eos_(encloser.fluid_),
+    : health_check_(ex_policy, encloser.health_check_), eos_(encloser.fluid_),
       rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
       p_(encloser.dv_p_->DelegatedData(ex_policy)),
       vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
@@ -45,7 +45,7 @@ template <class ExecutionPolicy>
 AdvectionStepSetup::UpdateKernel::
     UpdateKernel(const ExecutionPolicy &ex_policy, AdvectionStepSetup &encloser)
     : Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
-      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
       rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
       dpos_(encloser.dv_dpos_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
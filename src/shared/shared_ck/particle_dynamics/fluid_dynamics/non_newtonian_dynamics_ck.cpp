@@ -0,0 +1,24 @@
+#include "non_newtonian_dynamics_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+SRDViscousTimeStepSizeCK::SRDViscousTimeStepSizeCK(SPHBody &sph_body, Real diffusionCFL)
+    : LocalDynamicsReduce<ReduceMax>(sph_body),
+      smoothing_length_(sph_body.getSPHAdaptation().ReferenceSmoothingLength()),
+      diffusionCFL_(diffusionCFL),
+      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_mu_srd_(particles_->getVariableByName<Real>("VariableViscosity")) {}
+//=================================================================================================//
+SRDViscousTimeStepSizeCK::FinishDynamics::FinishDynamics(SRDViscousTimeStepSizeCK &encloser)
+    : smoothing_length_(encloser.smoothing_length_), diffusionCFL_(encloser.diffusionCFL_) {}
+//=================================================================================================//
+Real SRDViscousTimeStepSizeCK::FinishDynamics::Result(Real reduced_value)
+{
+    return diffusionCFL_ * smoothing_length_ * smoothing_length_ / (reduced_value + TinyReal);
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
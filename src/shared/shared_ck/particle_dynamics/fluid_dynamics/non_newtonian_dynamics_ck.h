@@ -0,0 +1,166 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	non_newtonian_dynamics_ck.h
+ * @brief 	Shear-rate dependent viscosity and the corresponding viscous time step
+ *          for computing kernels.
+ * @details The viscosity is evaluated by the device-copyable kernel of the generalized
+ *          Newtonian viscosity model. With the Tabulated option, the viscosity curve is sampled
+ *          once at logarithmically uniform shear rates between the cutoff shear rates,
+ *          and linearly interpolated instead of evaluating the powers of the model.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef NON_NEWTONIAN_DYNAMICS_CK_H
+#define NON_NEWTONIAN_DYNAMICS_CK_H
+
+#include "base_fluid_dynamics.h"
+#include "viscosity.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+class ShearRateCK
+{
+  public:
+    Real operator()(const Matd &vel_grad)
+    {
+        Matd D = 0.5 * (vel_grad + vel_grad.transpose());
+        D -= D.trace() / Real(Dimensions) * Matd::Identity();
+        return math::sqrt(Real(2) * (D * D).trace());
+    };
+};
+
+template <typename...>
+class ShearRateDependentViscosityCK;
+
+template <class ViscosityType>
+class ShearRateDependentViscosityCK<ViscosityType> : public LocalDynamics
+{
+    using ViscosityKernel = typename ViscosityType::ViscosityKernel;
+
+  public:
+    explicit ShearRateDependentViscosityCK(SPHBody &sph_body);
+    virtual ~ShearRateDependentViscosityCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            mu_srd_[index_i] = viscosity_(shear_rate_(vel_grad_[index_i]));
+        };
+
+      protected:
+        ShearRateCK shear_rate_;
+        ViscosityKernel viscosity_;
+        Matd *vel_grad_;
+        Real *mu_srd_;
+    };
+
+  protected:
+    ViscosityType &viscosity_model_;
+    DiscreteVariable<Matd> *dv_vel_grad_;
+    DiscreteVariable<Real> *dv_mu_srd_;
+};
+
+template <class ViscosityType>
+class ShearRateDependentViscosityCK<Tabulated, ViscosityType> : public LocalDynamics
+{
+    UniquePtrKeeper<DiscreteVariable<Real>> viscosity_table_keeper_;
+
+  public:
+    explicit ShearRateDependentViscosityCK(SPHBody &sph_body, UnsignedInt table_size = 1024);
+    virtual ~ShearRateDependentViscosityCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ShearRateCK shear_rate_;
+        UnsignedInt last_interval_;
+        Real min_shear_rate_, max_shear_rate_, log_min_shear_rate_, inv_log_interval_;
+        Real *viscosity_table_;
+        Matd *vel_grad_;
+        Real *mu_srd_;
+    };
+
+  protected:
+    UnsignedInt table_size_;
+    Real min_shear_rate_, max_shear_rate_, log_min_shear_rate_, log_interval_;
+    DiscreteVariable<Real> *dv_viscosity_table_;
+    DiscreteVariable<Matd> *dv_vel_grad_;
+    DiscreteVariable<Real> *dv_mu_srd_;
+};
+
+/**
+ * @class SRDViscousTimeStepSizeCK
+ * @brief Computing the viscous time step size using the shear-rate dependent viscosity
+ */
+class SRDViscousTimeStepSizeCK : public LocalDynamicsReduce<ReduceMax>
+{
+  public:
+    explicit SRDViscousTimeStepSizeCK(SPHBody &sph_body, Real diffusionCFL = 0.125);
+    virtual ~SRDViscousTimeStepSizeCK() {};
+
+    class FinishDynamics
+    {
+        Real smoothing_length_, diffusionCFL_;
+
+      public:
+        using OutputType = Real;
+        FinishDynamics(SRDViscousTimeStepSizeCK &encloser);
+        Real Result(Real reduced_value);
+    };
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ReduceKernel(const ExecutionPolicy &ex_policy, SRDViscousTimeStepSizeCK &encloser)
+            : rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+              mu_srd_(encloser.dv_mu_srd_->DelegatedData(ex_policy)){};
+
+        Real reduce(size_t index_i, Real dt = 0.0)
+        {
+            return mu_srd_[index_i] / rho_[index_i];
+        };
+
+      protected:
+        Real *rho_, *mu_srd_;
+    };
+
+  protected:
+    Real smoothing_length_, diffusionCFL_;
+    DiscreteVariable<Real> *dv_rho_, *dv_mu_srd_;
+};
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // NON_NEWTONIAN_DYNAMICS_CK_H
@@ -0,0 +1,86 @@
+#ifndef NON_NEWTONIAN_DYNAMICS_CK_HPP
+#define NON_NEWTONIAN_DYNAMICS_CK_HPP
+
+#include "non_newtonian_dynamics_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class ViscosityType>
+ShearRateDependentViscosityCK<ViscosityType>::ShearRateDependentViscosityCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body),
+      viscosity_model_(DynamicCast<ViscosityType>(this, particles_->getBaseMaterial())),
+      dv_vel_grad_(particles_->getVariableByName<Matd>("VelocityGradient")),
+      dv_mu_srd_(particles_->registerStateVariable<Real>("VariableViscosity"))
+{
+    particles_->addVariableToWrite<Real>("VariableViscosity");
+}
+//=================================================================================================//
+template <class ViscosityType>
+template <class ExecutionPolicy, class EncloserType>
+ShearRateDependentViscosityCK<ViscosityType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : viscosity_(encloser.viscosity_model_),
+      vel_grad_(encloser.dv_vel_grad_->DelegatedData(ex_policy)),
+      mu_srd_(encloser.dv_mu_srd_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ViscosityType>
+ShearRateDependentViscosityCK<Tabulated, ViscosityType>::
+    ShearRateDependentViscosityCK(SPHBody &sph_body, UnsignedInt table_size)
+    : LocalDynamics(sph_body), table_size_(SMAX(table_size, UnsignedInt(2))),
+      min_shear_rate_(0), max_shear_rate_(0), log_min_shear_rate_(0), log_interval_(0),
+      dv_viscosity_table_(nullptr),
+      dv_vel_grad_(particles_->getVariableByName<Matd>("VelocityGradient")),
+      dv_mu_srd_(particles_->registerStateVariable<Real>("VariableViscosity"))
+{
+    particles_->addVariableToWrite<Real>("VariableViscosity");
+    ViscosityType &viscosity_model = DynamicCast<ViscosityType>(this, particles_->getBaseMaterial());
+    min_shear_rate_ = viscosity_model.getMinShearRate();
+    max_shear_rate_ = viscosity_model.getMaxShearRate();
+    if (min_shear_rate_ <= 0.0 || max_shear_rate_ <= min_shear_rate_)
+    {
+        std::cout << "\n Error: the tabulated viscosity requires 0 < min_shear_rate < max_shear_rate!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    log_min_shear_rate_ = std::log(min_shear_rate_);
+    log_interval_ = (std::log(max_shear_rate_) - log_min_shear_rate_) / Real(table_size_ - 1);
+
+    typename ViscosityType::ViscosityKernel viscosity(viscosity_model);
+    dv_viscosity_table_ = viscosity_table_keeper_.template createPtr<DiscreteVariable<Real>>(
+        sph_body.getName() + "ViscosityTable", table_size_,
+        [&](UnsignedInt index)
+        {
+            return index == table_size_ - 1
+                       ? viscosity(max_shear_rate_)
+                       : viscosity(std::exp(log_min_shear_rate_ + Real(index) * log_interval_));
+        });
+}
+//=================================================================================================//
+template <class ViscosityType>
+template <class ExecutionPolicy, class EncloserType>
+ShearRateDependentViscosityCK<Tabulated, ViscosityType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : last_interval_(encloser.table_size_ - 2),
+      min_shear_rate_(encloser.min_shear_rate_), max_shear_rate_(encloser.max_shear_rate_),
+      log_min_shear_rate_(encloser.log_min_shear_rate_), inv_log_interval_(1.0 / encloser.log_interval_),
+      viscosity_table_(encloser.dv_viscosity_table_->DelegatedData(ex_policy)),
+      vel_grad_(encloser.dv_vel_grad_->DelegatedData(ex_policy)),
+      mu_srd_(encloser.dv_mu_srd_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ViscosityType>
+void ShearRateDependentViscosityCK<Tabulated, ViscosityType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    Real effective_shear_rate = SMAX(SMIN(shear_rate_(vel_grad_[index_i]), max_shear_rate_), min_shear_rate_);
+    Real location = (math::log(effective_shear_rate) - log_min_shear_rate_) * inv_log_interval_;
+    UnsignedInt interval = SMIN(UnsignedInt(SMAX(location, Real(0))), last_interval_);
+    Real fraction = SMIN(SMAX(location - Real(interval), Real(0)), Real(1));
+    mu_srd_[index_i] = viscosity_table_[interval] +
+                       fraction * (viscosity_table_[interval + 1] - viscosity_table_[interval]);
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // NON_NEWTONIAN_DYNAMICS_CK_HPP
@@ -0,0 +1,96 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	compressible_riemann_solver_ck.h
+ * @brief 	The Riemann solvers for compressible fluids in the Eulerian method,
+ *          inlinable on device and with the wave cases selected without branching on the star states.
+ * @author	Zhentong Wang and Xiangyu Hu
+ */
+
+#ifndef COMPRESSIBLE_RIEMANN_SOLVER_CK_H
+#define COMPRESSIBLE_RIEMANN_SOLVER_CK_H
+
+#include "base_data_type_package.h"
+#include "compressible_fluid.h"
+#include "riemann_solver_ck.h"
+
+namespace SPH
+{
+/** The state of a compressible fluid, in which the total energy is per volume. */
+struct CompressibleStateCK
+{
+    Real rho_;
+    Vecd vel_;
+    Real p_;
+    Real E_;
+};
+
+template <typename...>
+class CompressibleRiemannSolver;
+
+template <class FluidI, class FluidJ>
+class CompressibleRiemannSolver<NotUsed, FluidI, FluidJ>
+{
+  public:
+    typedef FluidI SourceFluid;
+    typedef FluidJ TargetFluid;
+    template <typename... Args>
+    CompressibleRiemannSolver(FluidI &fluid_i, FluidJ &fluid_j, Args &&...args){};
+
+    CompressibleStateCK getInterfaceState(const CompressibleStateCK &state_i,
+                                          const CompressibleStateCK &state_j, const Vecd &e_ij)
+    {
+        return CompressibleStateCK{0.5 * (state_i.rho_ + state_j.rho_), 0.5 * (state_i.vel_ + state_j.vel_),
+                                   0.5 * (state_i.p_ + state_j.p_), 0.5 * (state_i.E_ + state_j.E_)};
+    };
+};
+using NoRiemannSolverCompressibleCK = CompressibleRiemannSolver<NotUsed, CompressibleFluid, CompressibleFluid>;
+
+/**
+ * @class CompressibleRiemannSolver
+ * @brief HLLC Riemann solver. With NoLimiter, the wave speeds are estimated from the sound speeds
+ * of both sides, as HLLCRiemannSolver. With TruncatedLinear, the wave speeds are extended by the
+ * Roe-averaged state and the dissipation is limited by the compression, as HLLCWithLimiterRiemannSolver.
+ */
+template <class FluidI, class FluidJ, typename LimiterType>
+class CompressibleRiemannSolver<FluidI, FluidJ, LimiterType>
+{
+    using EosKernelI = typename FluidI::EosKernel;
+    using EosKernelJ = typename FluidJ::EosKernel;
+
+  public:
+    typedef FluidI SourceFluid;
+    typedef FluidJ TargetFluid;
+    CompressibleRiemannSolver(FluidI &fluid_i, FluidJ &fluid_j, Real limiter_parameter = 5.0);
+    CompressibleStateCK getInterfaceState(const CompressibleStateCK &state_i,
+                                          const CompressibleStateCK &state_j, const Vecd &e_ij);
+
+  protected:
+    EosKernelI eos_i_;
+    EosKernelJ eos_j_;
+    LimiterType limiter_;
+};
+using HLLCRiemannSolverCK = CompressibleRiemannSolver<CompressibleFluid, CompressibleFluid, NoLimiter>;
+using HLLCWithLimiterRiemannSolverCK = CompressibleRiemannSolver<CompressibleFluid, CompressibleFluid, TruncatedLinear>;
+} // namespace SPH
+#endif // COMPRESSIBLE_RIEMANN_SOLVER_CK_H
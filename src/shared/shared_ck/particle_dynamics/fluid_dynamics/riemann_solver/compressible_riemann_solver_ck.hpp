@@ -0,0 +1,64 @@
+#ifndef COMPRESSIBLE_RIEMANN_SOLVER_CK_HPP
+#define COMPRESSIBLE_RIEMANN_SOLVER_CK_HPP
+
+#include "compressible_riemann_solver_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class FluidI, class FluidJ, typename LimiterType>
+CompressibleRiemannSolver<FluidI, FluidJ, LimiterType>::
+    CompressibleRiemannSolver(FluidI &fluid_i, FluidJ &fluid_j, Real limiter_parameter)
+    : eos_i_(fluid_i), eos_j_(fluid_j), limiter_(1.0, limiter_parameter) {}
+//=================================================================================================//
+template <class FluidI, class FluidJ, typename LimiterType>
+CompressibleStateCK CompressibleRiemannSolver<FluidI, FluidJ, LimiterType>::
+    getInterfaceState(const CompressibleStateCK &state_i, const CompressibleStateCK &state_j, const Vecd &e_ij)
+{
+    Real ul = -e_ij.dot(state_i.vel_);
+    Real ur = -e_ij.dot(state_j.vel_);
+    Real cl = eos_i_.getSoundSpeed(state_i.p_, state_i.rho_);
+    Real cr = eos_j_.getSoundSpeed(state_j.p_, state_j.rho_);
+    Real s_l = ul - cl;
+    Real s_r = ur + cr;
+    if constexpr (!std::is_same_v<LimiterType, NoLimiter>)
+    {
+        Real R_lf = state_j.rho_ / state_i.rho_;
+        Real inv_R_sum = 1.0 / (1.0 + R_lf);
+        Real u_tilde = (ul + ur * R_lf) * inv_R_sum;
+        Real v_tilde = ((state_i.vel_ + ul * e_ij).norm() + (state_j.vel_ + ur * e_ij).norm() * R_lf) * inv_R_sum;
+        Real hl = (state_i.E_ + state_i.p_) / state_i.rho_;
+        Real hr = (state_j.E_ + state_j.p_) / state_j.rho_;
+        Real h_tilde = (hl + hr * R_lf) * inv_R_sum;
+        Real sound_tilde = sqrt((eos_i_.HeatCapacityRatio() - 1.0) *
+                                (h_tilde - 0.5 * (u_tilde * u_tilde + v_tilde * v_tilde)));
+        s_l = SMIN(s_l, u_tilde - sound_tilde);
+        s_r = SMAX(s_r, u_tilde + sound_tilde);
+    }
+    // the dissipation limiter is one, i.e. the standard HLLC, without limiter
+    Real clr = (state_i.rho_ * cl + state_j.rho_ * cr) / (state_i.rho_ + state_j.rho_);
+    Real limiter = limiter_(SMAX((ul - ur) / clr, Real(0)));
+    Real rho_ds_l = state_i.rho_ * (s_l - ul);
+    Real rho_ds_r = state_j.rho_ * (s_r - ur);
+    Real s_star = ((state_j.p_ - state_i.p_) * limiter * limiter + rho_ds_l * ul - rho_ds_r * ur) /
+                  (rho_ds_l - rho_ds_r);
+    Real p_star = 0.5 * (state_i.p_ + state_j.p_) +
+                  0.5 * (rho_ds_l * (s_star - ul) + rho_ds_r * (s_star - ur)) * limiter;
+
+    // Here, the wave cases are given by selecting the side instead of branching on each star state.
+    bool is_left = s_star > 0.0;
+    const CompressibleStateCK &state_k = is_left ? state_i : state_j;
+    Real u_k = is_left ? ul : ur;
+    Real s_k = is_left ? s_l : s_r;
+    bool is_supersonic = is_left ? 0.0 < s_l : s_r < 0.0;
+    Real inv_ds_star = 1.0 / (s_k - s_star);
+    CompressibleStateCK star_state{
+        state_k.rho_ * (s_k - u_k) * inv_ds_star,
+        state_k.vel_ - e_ij * (s_star - u_k),
+        p_star,
+        ((s_k - u_k) * state_k.E_ - state_k.p_ * u_k + p_star * s_star) * inv_ds_star};
+    return is_supersonic ? state_k : star_state;
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // COMPRESSIBLE_RIEMANN_SOLVER_CK_HPP
@@ -84,5 +84,9 @@ class RiemannSolver<FluidI, FluidJ, LimiterType> : public RiemannSolver<NotUsed,
 };
 using AcousticRiemannSolverCK = RiemannSolver<WeaklyCompressibleFluid, WeaklyCompressibleFluid, TruncatedLinear>;
 using DissipativeRiemannSolverCK = RiemannSolver<WeaklyCompressibleFluid, WeaklyCompressibleFluid, NoLimiter>;
+/** The fluid types of a phase pair are known at compile time, so that each contact interaction
+ *  between two phases is compiled with its own equation of state and Riemann solver. */
+template <class SourceFluid, class TargetFluid, typename LimiterType = TruncatedLinear>
+using PhasePairRiemannSolverCK = RiemannSolver<SourceFluid, TargetFluid, LimiterType>;
 } // namespace SPH
 #endif // RIEMANN_SOLVER_CK_H
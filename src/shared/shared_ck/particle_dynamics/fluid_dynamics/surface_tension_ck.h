@@ -0,0 +1,250 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	surface_tension_ck.h
+ * @brief 	Surface tension of multi-phase flows for computing kernels,
+ * 			evaluated only for the particles near the phase interface.
+ * @details The interface particles, i.e. those with contact neighbors, and the interface band,
+ * 			i.e. the interface particles and their inner neighbors, are flagged in each step
+ * 			and compacted into particle lists by prefix scan, so that the stress and force
+ * 			kernels only iterate the lists. Beyond the interface, the color gradient and
+ * 			the stress are zero, and so is the force beyond the band,
+ * 			as those evaluated over all particles.
+ * @author	Shuaihao Zhang and Xiangyu Hu
+ */
+
+#ifndef SURFACE_TENSION_CK_H
+#define SURFACE_TENSION_CK_H
+
+#include "base_fluid_dynamics.h"
+#include "force_prior_ck.hpp"
+#include "interaction_ck.hpp"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+template <typename...>
+class SurfaceTensionStressCK;
+
+template <typename... Parameters>
+class SurfaceTensionStressCK<Contact<Parameters...>> : public Interaction<Contact<Parameters...>>
+{
+    using BaseInteraction = Interaction<Contact<Parameters...>>;
+
+  public:
+    SurfaceTensionStressCK(Contact<Parameters...> &contact_relation, Real surface_tension_coeff);
+    virtual ~SurfaceTensionStressCK() {};
+
+    /** Flag the particles with contact neighbors. */
+    class FlagKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        FlagKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void flag(size_t index_i)
+        {
+            UnsignedInt is_interface = is_first_contact_ ? 0 : interface_flag_[index_i];
+            if (this->FirstNeighbor(index_i) != this->LastNeighbor(index_i))
+                is_interface = 1;
+            interface_flag_[index_i] = is_interface;
+        };
+
+      protected:
+        bool is_first_contact_;
+        UnsignedInt *interface_flag_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        bool is_first_contact_;
+        Real contact_fraction_, surface_tension_coeff_;
+        Real *contact_Vol_;
+        Vecd *color_gradient_, *norm_direction_;
+        Matd *surface_tension_stress_;
+    };
+
+  protected:
+    Real surface_tension_coeff_;
+    StdVec<Real> contact_fraction_;
+    DiscreteVariable<UnsignedInt> *dv_interface_flag_;
+    DiscreteVariable<Vecd> *dv_color_gradient_, *dv_norm_direction_;
+    DiscreteVariable<Matd> *dv_surface_tension_stress_;
+};
+
+template <typename...>
+class SurfaceStressForceCK;
+
+template <typename... Parameters>
+class SurfaceStressForceCK<Inner<Parameters...>>
+    : public Interaction<Inner<Parameters...>>, public ForcePriorCK
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit SurfaceStressForceCK(Inner<Parameters...> &inner_relation, Real hourglass_control_coeff = 4.5);
+    virtual ~SurfaceStressForceCK() {};
+
+    /** Flag the band particles, and clear the data left beyond the interface and the band. */
+    class FlagKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        FlagKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void flag(size_t index_i);
+
+      protected:
+        ForcePriorCK::UpdateKernel force_prior_update_;
+        UnsignedInt *interface_flag_, *band_flag_;
+        Vecd *color_gradient_, *norm_direction_, *surface_tension_force_;
+        Matd *surface_tension_stress_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real hourglass_control_coeff_, surface_tension_coeff_;
+        Real *rho_, *mass_, *Vol_;
+        Vecd *color_gradient_, *norm_direction_, *surface_tension_force_;
+        Matd *surface_tension_stress_;
+    };
+
+  protected:
+    Real hourglass_control_coeff_, surface_tension_coeff_;
+    DiscreteVariable<UnsignedInt> *dv_interface_flag_, *dv_band_flag_;
+    DiscreteVariable<Real> *dv_rho_, *dv_mass_;
+    DiscreteVariable<Vecd> *dv_color_gradient_, *dv_norm_direction_, *dv_surface_tension_force_;
+    DiscreteVariable<Matd> *dv_surface_tension_stress_;
+};
+
+template <typename... Parameters>
+class SurfaceStressForceCK<Contact<Parameters...>> : public Interaction<Contact<Parameters...>>
+{
+    using BaseInteraction = Interaction<Contact<Parameters...>>;
+
+  public:
+    explicit SurfaceStressForceCK(Contact<Parameters...> &contact_relation, Real hourglass_control_coeff = 4.5);
+    virtual ~SurfaceStressForceCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real hourglass_control_coeff_, surface_tension_coeff_, contact_fraction_;
+        Real *rho_, *mass_, *contact_Vol_;
+        Vecd *color_gradient_, *norm_direction_, *surface_tension_force_;
+        Matd *surface_tension_stress_;
+        Vecd *contact_color_gradient_, *contact_norm_direction_;
+        Matd *contact_surface_tension_stress_;
+    };
+
+  protected:
+    Real hourglass_control_coeff_, surface_tension_coeff_;
+    StdVec<Real> contact_fraction_;
+    DiscreteVariable<Real> *dv_rho_, *dv_mass_;
+    DiscreteVariable<Vecd> *dv_color_gradient_, *dv_norm_direction_, *dv_surface_tension_force_;
+    DiscreteVariable<Matd> *dv_surface_tension_stress_;
+    StdVec<DiscreteVariable<Vecd> *> dv_contact_color_gradient_, dv_contact_norm_direction_;
+    StdVec<DiscreteVariable<Matd> *> dv_contact_surface_tension_stress_;
+};
+
+template <typename...>
+class InterfaceSurfaceTensionCK;
+
+/**
+ * @class InterfaceSurfaceTensionCK
+ * @brief The surface tension stress and force of a phase, including the force prior update,
+ * evaluated on the compacted interface and band particle lists.
+ * As the force requires the stress of all phases, computeStress() is called for all phases
+ * before computeForce(), and exec() runs both only for the two-step usage of a single phase.
+ */
+template <class ExecutionPolicy, typename... InnerParameters, typename... ContactParameters>
+class InterfaceSurfaceTensionCK<ExecutionPolicy, Inner<InnerParameters...>, Contact<ContactParameters...>>
+    : public BaseDynamics<void>
+{
+    using StressType = SurfaceTensionStressCK<Contact<ContactParameters...>>;
+    using InnerForceType = SurfaceStressForceCK<Inner<InnerParameters...>>;
+    using ContactForceType = SurfaceStressForceCK<Contact<ContactParameters...>>;
+    using InterfaceFlagKernel = typename StressType::FlagKernel;
+    using StressKernel = typename StressType::InteractKernel;
+    using BandFlagKernel = typename InnerForceType::FlagKernel;
+    using InnerForceKernel = typename InnerForceType::InteractKernel;
+    using ForcePriorUpdateKernel = ForcePriorCK::UpdateKernel;
+    using ContactForceKernel = typename ContactForceType::InteractKernel;
+    template <class LocalDynamicsType, class ComputingKernelType>
+    using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernelType>;
+    UniquePtrsKeeper<KernelImplementation<StressType, InterfaceFlagKernel>> interface_flag_implementation_ptrs_;
+    UniquePtrsKeeper<KernelImplementation<StressType, StressKernel>> stress_implementation_ptrs_;
+    UniquePtrsKeeper<KernelImplementation<ContactForceType, ContactForceKernel>> contact_force_implementation_ptrs_;
+
+  public:
+    InterfaceSurfaceTensionCK(Inner<InnerParameters...> &inner_relation,
+                              Contact<ContactParameters...> &contact_relation,
+                              Real surface_tension_coeff, Real hourglass_control_coeff = 4.5);
+    virtual ~InterfaceSurfaceTensionCK() {};
+    void computeStress();
+    void computeForce();
+    virtual void exec(Real dt = 0.0) override;
+    UnsignedInt NumberOfInterfaceParticles() { return number_of_interface_particles_; };
+    UnsignedInt NumberOfBandParticles() { return number_of_band_particles_; };
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    SPHBody &sph_body_;
+    BaseParticles &particles_;
+    StressType stress_;
+    InnerForceType inner_force_;
+    ContactForceType contact_force_;
+    DiscreteVariable<UnsignedInt> *dv_interface_flag_, *dv_interface_offset_, *dv_interface_list_;
+    DiscreteVariable<UnsignedInt> *dv_band_flag_, *dv_band_offset_, *dv_band_list_;
+    UnsignedInt number_of_interface_particles_, number_of_band_particles_;
+    StdVec<KernelImplementation<StressType, InterfaceFlagKernel> *> interface_flag_implementation_;
+    StdVec<KernelImplementation<StressType, StressKernel> *> stress_implementation_;
+    KernelImplementation<InnerForceType, BandFlagKernel> band_flag_implementation_;
+    KernelImplementation<InnerForceType, InnerForceKernel> inner_force_implementation_;
+    KernelImplementation<InnerForceType, ForcePriorUpdateKernel> force_prior_implementation_;
+    StdVec<KernelImplementation<ContactForceType, ContactForceKernel> *> contact_force_implementation_;
+
+    /** Compact the flagged particles into the list and return the list size. */
+    UnsignedInt compactFlaggedParticles(DiscreteVariable<UnsignedInt> *dv_flag,
+                                        DiscreteVariable<UnsignedInt> *dv_offset,
+                                        DiscreteVariable<UnsignedInt> *dv_list);
+};
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // SURFACE_TENSION_CK_H
@@ -0,0 +1,382 @@
+#ifndef SURFACE_TENSION_CK_HPP
+#define SURFACE_TENSION_CK_HPP
+
+#include "surface_tension_ck.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <typename... Parameters>
+SurfaceTensionStressCK<Contact<Parameters...>>::
+    SurfaceTensionStressCK(Contact<Parameters...> &contact_relation, Real surface_tension_coeff)
+    : BaseInteraction(contact_relation), surface_tension_coeff_(surface_tension_coeff),
+      dv_interface_flag_(this->particles_->template registerDiscreteVariable<UnsignedInt>(
+          "SurfaceTensionInterfaceFlag", this->particles_->ParticlesBound() + 1)),
+      dv_color_gradient_(this->particles_->template registerStateVariable<Vecd>("ColorGradient")),
+      dv_norm_direction_(this->particles_->template registerStateVariable<Vecd>("NormDirection")),
+      dv_surface_tension_stress_(this->particles_->template registerStateVariable<Matd>("SurfaceTensionStress"))
+{
+    this->particles_->template registerSingularVariable<Real>("SurfaceTensionCoef", surface_tension_coeff);
+    this->particles_->template addEvolvingVariable<Vecd>("ColorGradient");
+    this->particles_->template addVariableToWrite<Vecd>("ColorGradient");
+    this->particles_->template addEvolvingVariable<Matd>("SurfaceTensionStress");
+    this->particles_->template addVariableToWrite<Matd>("SurfaceTensionStress");
+    Real rho0 = this->sph_body_->getBaseMaterial().ReferenceDensity();
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        Real rho0_k = this->contact_bodies_[k]->getBaseMaterial().ReferenceDensity();
+        contact_fraction_.push_back(rho0 / (rho0 + rho0_k));
+    }
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+SurfaceTensionStressCK<Contact<Parameters...>>::FlagKernel::
+    FlagKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseInteraction::InteractKernel(ex_policy, encloser, contact_index),
+      is_first_contact_(contact_index == 0),
+      interface_flag_(encloser.dv_interface_flag_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+SurfaceTensionStressCK<Contact<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseInteraction::InteractKernel(ex_policy, encloser, contact_index),
+      is_first_contact_(contact_index == 0),
+      contact_fraction_(encloser.contact_fraction_[contact_index]),
+      surface_tension_coeff_(encloser.surface_tension_coeff_),
+      contact_Vol_(encloser.dv_contact_Vol_[contact_index]->DelegatedData(ex_policy)),
+      color_gradient_(encloser.dv_color_gradient_->DelegatedData(ex_policy)),
+      norm_direction_(encloser.dv_norm_direction_->DelegatedData(ex_policy)),
+      surface_tension_stress_(encloser.dv_surface_tension_stress_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void SurfaceTensionStressCK<Contact<Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    if (is_first_contact_)
+    {
+        color_gradient_[index_i] = ZeroData<Vecd>::value;
+        surface_tension_stress_[index_i] = ZeroData<Matd>::value;
+    }
+
+    Vecd weighted_color_gradient = ZeroData<Vecd>::value;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        weighted_color_gradient -= 2 * contact_fraction_ * this->dW_ij(index_i, index_j, n) *
+                                   contact_Vol_[index_j] * this->e_ij(index_i, index_j, n);
+    }
+    color_gradient_[index_i] = weighted_color_gradient;
+    norm_direction_[index_i] = weighted_color_gradient / (weighted_color_gradient.norm() + Eps);
+    surface_tension_stress_[index_i] += surface_tension_coeff_ *
+                                        (Matd::Identity() - norm_direction_[index_i] * norm_direction_[index_i].transpose()) *
+                                        weighted_color_gradient.norm();
+}
+//=================================================================================================//
+template <typename... Parameters>
+SurfaceStressForceCK<Inner<Parameters...>>::
+    SurfaceStressForceCK(Inner<Parameters...> &inner_relation, Real hourglass_control_coeff)
+    : BaseInteraction(inner_relation),
+      ForcePriorCK(this->particles_, this->particles_->template registerStateVariable<Vecd>("SurfaceTensionForce")),
+      hourglass_control_coeff_(hourglass_control_coeff),
+      surface_tension_coeff_(*this->particles_->template getSingularVariableByName<Real>("SurfaceTensionCoef")->Data()),
+      dv_interface_flag_(this->particles_->template getVariableByName<UnsignedInt>("SurfaceTensionInterfaceFlag")),
+      dv_band_flag_(this->particles_->template registerDiscreteVariable<UnsignedInt>(
+          "SurfaceTensionBandFlag", this->particles_->ParticlesBound() + 1)),
+      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_color_gradient_(this->particles_->template getVariableByName<Vecd>("ColorGradient")),
+      dv_norm_direction_(this->particles_->template getVariableByName<Vecd>("NormDirection")),
+      dv_surface_tension_force_(this->particles_->template getVariableByName<Vecd>("SurfaceTensionForce")),
+      dv_surface_tension_stress_(this->particles_->template getVariableByName<Matd>("SurfaceTensionStress")) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+SurfaceStressForceCK<Inner<Parameters...>>::FlagKernel::
+    FlagKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      force_prior_update_(ex_policy, encloser),
+      interface_flag_(encloser.dv_interface_flag_->DelegatedData(ex_policy)),
+      band_flag_(encloser.dv_band_flag_->DelegatedData(ex_policy)),
+      color_gradient_(encloser.dv_color_gradient_->DelegatedData(ex_policy)),
+      norm_direction_(encloser.dv_norm_direction_->DelegatedData(ex_policy)),
+      surface_tension_force_(encloser.dv_surface_tension_force_->DelegatedData(ex_policy)),
+      surface_tension_stress_(encloser.dv_surface_tension_stress_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void SurfaceStressForceCK<Inner<Parameters...>>::FlagKernel::flag(size_t index_i)
+{
+    UnsignedInt is_band = interface_flag_[index_i];
+    if (is_band == 0)
+    {
+        color_gradient_[index_i] = ZeroData<Vecd>::value;
+        norm_direction_[index_i] = ZeroData<Vecd>::value;
+        surface_tension_stress_[index_i] = ZeroData<Matd>::value;
+        for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+        {
+            if (interface_flag_[this->neighbor_index_[n]] != 0)
+            {
+                is_band = 1;
+                break;
+            }
+        }
+    }
+    band_flag_[index_i] = is_band;
+
+    if (is_band == 0) // the force vanishes and is removed from the force prior
+    {
+        surface_tension_force_[index_i] = ZeroData<Vecd>::value;
+        force_prior_update_.update(index_i);
+    }
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+SurfaceStressForceCK<Inner<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      hourglass_control_coeff_(encloser.hourglass_control_coeff_),
+      surface_tension_coeff_(encloser.surface_tension_coeff_),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      color_gradient_(encloser.dv_color_gradient_->DelegatedData(ex_policy)),
+      norm_direction_(encloser.dv_norm_direction_->DelegatedData(ex_policy)),
+      surface_tension_force_(encloser.dv_surface_tension_force_->DelegatedData(ex_policy)),
+      surface_tension_stress_(encloser.dv_surface_tension_stress_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void SurfaceStressForceCK<Inner<Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    Vecd summation = ZeroData<Vecd>::value;
+    Matd tangential_direction_i = Matd::Identity() - norm_direction_[index_i] * norm_direction_[index_i].transpose();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j, n);
+        Real r_ij = vec_r_ij.norm();
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+        Matd tangential_direction_j = Matd::Identity() - norm_direction_[index_j] * norm_direction_[index_j].transpose();
+        Vecd color_gradient_average = 0.5 * (color_gradient_[index_i] + color_gradient_[index_j]);
+        Matd color_gradient_projection = color_gradient_average * e_ij.transpose() * r_ij;
+        Matd mismatch = Matd::Zero() - color_gradient_projection * color_gradient_projection /
+                                           (color_gradient_projection.norm() + Eps);
+        Matd hourglass_correction = hourglass_control_coeff_ * surface_tension_coeff_ * 0.5 *
+                                    (tangential_direction_i + tangential_direction_j) * mismatch / (r_ij + Eps);
+        summation += mass_[index_i] * this->dW_ij(index_i, index_j, n) * Vol_[index_j] *
+                     (surface_tension_stress_[index_i] + surface_tension_stress_[index_j] + hourglass_correction) * e_ij;
+    }
+    surface_tension_force_[index_i] = summation / rho_[index_i];
+}
+//=================================================================================================//
+template <typename... Parameters>
+SurfaceStressForceCK<Contact<Parameters...>>::
+    SurfaceStressForceCK(Contact<Parameters...> &contact_relation, Real hourglass_control_coeff)
+    : BaseInteraction(contact_relation), hourglass_control_coeff_(hourglass_control_coeff),
+      surface_tension_coeff_(*this->particles_->template getSingularVariableByName<Real>("SurfaceTensionCoef")->Data()),
+      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_color_gradient_(this->particles_->template getVariableByName<Vecd>("ColorGradient")),
+      dv_norm_direction_(this->particles_->template getVariableByName<Vecd>("NormDirection")),
+      dv_surface_tension_force_(this->particles_->template getVariableByName<Vecd>("SurfaceTensionForce")),
+      dv_surface_tension_stress_(this->particles_->template getVariableByName<Matd>("SurfaceTensionStress"))
+{
+    Real rho0 = this->sph_body_->getBaseMaterial().ReferenceDensity();
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        Real rho0_k = this->contact_bodies_[k]->getBaseMaterial().ReferenceDensity();
+        contact_fraction_.push_back(rho0 / (rho0 + rho0_k));
+        dv_contact_color_gradient_.push_back(
+            this->contact_particles_[k]->template getVariableByName<Vecd>("ColorGradient"));
+        dv_contact_norm_direction_.push_back(
+            this->contact_particles_[k]->template getVariableByName<Vecd>("NormDirection"));
+        dv_contact_surface_tension_stress_.push_back(
+            this->contact_particles_[k]->template getVariableByName<Matd>("SurfaceTensionStress"));
+    }
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+SurfaceStressForceCK<Contact<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseInteraction::InteractKernel(ex_policy, encloser, contact_index),
+      hourglass_control_coeff_(encloser.hourglass_control_coeff_),
+      surface_tension_coeff_(encloser.surface_tension_coeff_),
+      contact_fraction_(encloser.contact_fraction_[contact_index]),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      contact_Vol_(encloser.dv_contact_Vol_[contact_index]->DelegatedData(ex_policy)),
+      color_gradient_(encloser.dv_color_gradient_->DelegatedData(ex_policy)),
+      norm_direction_(encloser.dv_norm_direction_->DelegatedData(ex_policy)),
+      surface_tension_force_(encloser.dv_surface_tension_force_->DelegatedData(ex_policy)),
+      surface_tension_stress_(encloser.dv_surface_tension_stress_->DelegatedData(ex_policy)),
+      contact_color_gradient_(encloser.dv_contact_color_gradient_[contact_index]->DelegatedData(ex_policy)),
+      contact_norm_direction_(encloser.dv_contact_norm_direction_[contact_index]->DelegatedData(ex_policy)),
+      contact_surface_tension_stress_(
+          encloser.dv_contact_surface_tension_stress_[contact_index]->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void SurfaceStressForceCK<Contact<Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    Vecd summation = ZeroData<Vecd>::value;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j, n);
+        Real r_ij = vec_r_ij.norm();
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+        Vecd color_gradient_average = 0.5 * (color_gradient_[index_i] + contact_color_gradient_[index_j]);
+        Matd color_gradient_projection = color_gradient_average * e_ij.transpose() * r_ij;
+        Matd mismatch = Matd::Identity() - color_gradient_projection * color_gradient_projection /
+                                               (color_gradient_projection.norm() + Eps);
+        Matd hourglass_correction = -4 * contact_fraction_ * (1 - contact_fraction_) * hourglass_control_coeff_ * 0.5 *
+                                    (norm_direction_[index_i] * norm_direction_[index_i].transpose() +
+                                     contact_norm_direction_[index_j] * contact_norm_direction_[index_j].transpose()) *
+                                    mismatch * surface_tension_coeff_ / r_ij;
+        summation += mass_[index_i] *
+                     (2 * (Real(1) - contact_fraction_) * surface_tension_stress_[index_i] +
+                      2 * contact_fraction_ * contact_surface_tension_stress_[index_j] + hourglass_correction) *
+                     this->dW_ij(index_i, index_j, n) * e_ij * contact_Vol_[index_j];
+    }
+    surface_tension_force_[index_i] += summation / rho_[index_i];
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... InnerParameters, typename... ContactParameters>
+InterfaceSurfaceTensionCK<ExecutionPolicy, Inner<InnerParameters...>, Contact<ContactParameters...>>::
+    InterfaceSurfaceTensionCK(Inner<InnerParameters...> &inner_relation,
+                              Contact<ContactParameters...> &contact_relation,
+                              Real surface_tension_coeff, Real hourglass_control_coeff)
+    : BaseDynamics<void>(), ex_policy_(ExecutionPolicy{}),
+      sph_body_(inner_relation.getSPHBody()), particles_(sph_body_.getBaseParticles()),
+      stress_(contact_relation, surface_tension_coeff),
+      inner_force_(inner_relation, hourglass_control_coeff),
+      contact_force_(contact_relation, hourglass_control_coeff),
+      dv_interface_flag_(particles_.getVariableByName<UnsignedInt>("SurfaceTensionInterfaceFlag")),
+      dv_interface_offset_(particles_.registerDiscreteVariable<UnsignedInt>(
+          "SurfaceTensionInterfaceOffset", particles_.ParticlesBound() + 1)),
+      dv_interface_list_(particles_.registerDiscreteVariable<UnsignedInt>(
+          "SurfaceTensionInterfaceList", particles_.ParticlesBound())),
+      dv_band_flag_(particles_.getVariableByName<UnsignedInt>("SurfaceTensionBandFlag")),
+      dv_band_offset_(particles_.registerDiscreteVariable<UnsignedInt>(
+          "SurfaceTensionBandOffset", particles_.ParticlesBound() + 1)),
+      dv_band_list_(particles_.registerDiscreteVariable<UnsignedInt>(
+          "SurfaceTensionBandList", particles_.ParticlesBound())),
+      number_of_interface_particles_(0), number_of_band_particles_(0),
+      band_flag_implementation_(inner_force_), inner_force_implementation_(inner_force_),
+      force_prior_implementation_(inner_force_)
+{
+    inner_force_.registerComputingKernel(&band_flag_implementation_);
+    inner_force_.registerComputingKernel(&inner_force_implementation_);
+    for (UnsignedInt k = 0; k != contact_relation.getContactBodies().size(); ++k)
+    {
+        interface_flag_implementation_.push_back(
+            interface_flag_implementation_ptrs_.template createPtr<
+                KernelImplementation<StressType, InterfaceFlagKernel>>(stress_));
+        stress_.registerComputingKernel(interface_flag_implementation_.back(), k);
+        stress_implementation_.push_back(
+            stress_implementation_ptrs_.template createPtr<
+                KernelImplementation<StressType, StressKernel>>(stress_));
+        stress_.registerComputingKernel(stress_implementation_.back(), k);
+        contact_force_implementation_.push_back(
+            contact_force_implementation_ptrs_.template createPtr<
+                KernelImplementation<ContactForceType, ContactForceKernel>>(contact_force_));
+        contact_force_.registerComputingKernel(contact_force_implementation_.back(), k);
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... InnerParameters, typename... ContactParameters>
+UnsignedInt InterfaceSurfaceTensionCK<ExecutionPolicy, Inner<InnerParameters...>, Contact<ContactParameters...>>::
+    compactFlaggedParticles(DiscreteVariable<UnsignedInt> *dv_flag,
+                            DiscreteVariable<UnsignedInt> *dv_offset,
+                            DiscreteVariable<UnsignedInt> *dv_list)
+{
+    UnsignedInt total_real_particles = particles_.TotalRealParticles();
+    UnsignedInt *flag = dv_flag->DelegatedData(ex_policy_);
+    UnsignedInt *offset = dv_offset->DelegatedData(ex_policy_);
+    UnsignedInt *list = dv_list->DelegatedData(ex_policy_);
+    UnsignedInt total_flagged =
+        exclusive_scan(ex_policy_, flag, offset, total_real_particles + 1,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     if (flag[i] != 0)
+                         list[offset[i]] = i;
+                 });
+    return total_flagged;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... InnerParameters, typename... ContactParameters>
+void InterfaceSurfaceTensionCK<ExecutionPolicy, Inner<InnerParameters...>, Contact<ContactParameters...>>::
+    computeStress()
+{
+    stress_.waitForRelationUpdate();
+    inner_force_.waitForRelationUpdate();
+    UnsignedInt total_real_particles = particles_.TotalRealParticles();
+    for (size_t k = 0; k != interface_flag_implementation_.size(); ++k)
+    {
+        InterfaceFlagKernel *flag_kernel = interface_flag_implementation_[k]->getComputingKernel(k);
+        particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                     [=](size_t i)
+                     { flag_kernel->flag(i); });
+    }
+    number_of_interface_particles_ =
+        compactFlaggedParticles(dv_interface_flag_, dv_interface_offset_, dv_interface_list_);
+
+    UnsignedInt *interface_list = dv_interface_list_->DelegatedData(ex_policy_);
+    for (size_t k = 0; k != stress_implementation_.size(); ++k)
+    {
+        StressKernel *stress_kernel = stress_implementation_[k]->getComputingKernel(k);
+        particle_for(ex_policy_, IndexRange(0, number_of_interface_particles_),
+                     [=](size_t n)
+                     { stress_kernel->interact(interface_list[n]); });
+    }
+
+    BandFlagKernel *band_flag_kernel = band_flag_implementation_.getComputingKernel();
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { band_flag_kernel->flag(i); });
+    number_of_band_particles_ = compactFlaggedParticles(dv_band_flag_, dv_band_offset_, dv_band_list_);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... InnerParameters, typename... ContactParameters>
+void InterfaceSurfaceTensionCK<ExecutionPolicy, Inner<InnerParameters...>, Contact<ContactParameters...>>::
+    computeForce()
+{
+    UnsignedInt *band_list = dv_band_list_->DelegatedData(ex_policy_);
+    InnerForceKernel *inner_force_kernel = inner_force_implementation_.getComputingKernel();
+    particle_for(ex_policy_, IndexRange(0, number_of_band_particles_),
+                 [=](size_t n)
+                 { inner_force_kernel->interact(band_list[n]); });
+
+    UnsignedInt *interface_list = dv_interface_list_->DelegatedData(ex_policy_);
+    for (size_t k = 0; k != contact_force_implementation_.size(); ++k)
+    {
+        ContactForceKernel *contact_force_kernel = contact_force_implementation_[k]->getComputingKernel(k);
+        particle_for(ex_policy_, IndexRange(0, number_of_interface_particles_),
+                     [=](size_t n)
+                     { contact_force_kernel->interact(interface_list[n]); });
+    }
+
+    ForcePriorUpdateKernel *force_prior_kernel = force_prior_implementation_.getComputingKernel();
+    particle_for(ex_policy_, IndexRange(0, number_of_band_particles_),
+                 [=](size_t n)
+                 { force_prior_kernel->update(band_list[n]); });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, typename... InnerParameters, typename... ContactParameters>
+void InterfaceSurfaceTensionCK<ExecutionPolicy, Inner<InnerParameters...>, Contact<ContactParameters...>>::
+    exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<InterfaceSurfaceTensionCK>(), sph_body_);
+    this->setUpdated(sph_body_);
+    computeStress();
+    computeForce();
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // SURFACE_TENSION_CK_HPP
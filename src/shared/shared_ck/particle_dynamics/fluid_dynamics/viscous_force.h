@@ -90,6 +90,52 @@ class ViscousForceCK<Inner<WithUpdate, ViscosityType, KernelCorrectionType, Para
     };
 };
 
+/**
+ * @class ViscousForceCK
+ * @brief Pair-symmetric version of the inner viscous force, which halves the pair evaluations.
+ * It requires that the dynamics covers all particles of the inner relation,
+ * so that each pair is found from its lower index.
+ */
+template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
+class ViscousForceCK<Inner<OneLevel, PairSymmetric, ViscosityType, KernelCorrectionType, Parameters...>>
+    : public ViscousForceCK<Base, ViscosityType, KernelCorrectionType, Inner<Parameters...>>,
+      public ForcePriorCK
+{
+    using CorrectionKernel = typename KernelCorrectionType::ComputingKernel;
+    using InterParticleViscosity = typename ViscosityType::InterParticleViscosity;
+    using BaseViscousForceType = ViscousForceCK<Base, ViscosityType, KernelCorrectionType, Inner<Parameters...>>;
+
+  public:
+    explicit ViscousForceCK(Inner<Parameters...> &inner_relation);
+    virtual ~ViscousForceCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0) { viscous_force_[index_i] = Vecd::Zero(); };
+
+      protected:
+        Vecd *viscous_force_;
+    };
+
+    class InteractKernel : public BaseViscousForceType::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        InterParticleViscosity inter_particle_viscosity_;
+        CorrectionKernel correction_;
+        Real *Vol_;
+        Vecd *vel_, *viscous_force_;
+        Real smoothing_length_sq_;
+    };
+};
+
 template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
 class ViscousForceCK<Contact<Wall, ViscosityType, KernelCorrectionType, Parameters...>>
     : public ViscousForceCK<Base, ViscosityType, KernelCorrectionType, Contact<Parameters...>>,
@@ -126,6 +172,11 @@ class ViscousForceCK<Contact<Wall, ViscosityType, KernelCorrectionType, Paramete
 using ViscousForceInnerCK = ViscousForceCK<Inner<WithUpdate, Viscosity, NoKernelCorrectionCK>>;
 using ViscousForceWithWallCK = ViscousForceCK<Inner<WithUpdate, Viscosity, NoKernelCorrectionCK>,
                                               Contact<Wall, Viscosity, NoKernelCorrectionCK>>;
+using ViscousForceInnerPairSymmetricCK =
+    ViscousForceCK<Inner<OneLevel, PairSymmetric, Viscosity, NoKernelCorrectionCK>>;
+using ViscousForceWithWallPairSymmetricCK =
+    ViscousForceCK<Inner<OneLevel, PairSymmetric, Viscosity, NoKernelCorrectionCK>,
+                   Contact<Wall, Viscosity, NoKernelCorrectionCK>>;
 } // namespace fluid_dynamics
 } // namespace SPH
 #endif // VISCOUS_FORCE_H
\ No newline at end of file
@@ -43,12 +43,12 @@ void ViscousForceCK<Inner<WithUpdate, ViscosityType, KernelCorrectionType, Param
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Vecd force = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        Vecd e_ij = this->e_ij(index_i, index_j);
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
-        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+        Real dW_ijV_j = this->dW_ij(index_i, index_j, n) * Vol_[index_j];
+        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j, n);
 
         Vecd vel_derivative = (vel_[index_i] - vel_[index_j]) /
                               (vec_r_ij.squaredNorm() + 0.01 * smoothing_length_sq_);
@@ -60,6 +60,57 @@ void ViscousForceCK<Inner<WithUpdate, ViscosityType, KernelCorrectionType, Param
 }
 //=================================================================================================//
 template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
+ViscousForceCK<Inner<OneLevel, PairSymmetric, ViscosityType, KernelCorrectionType, Parameters...>>::
+    ViscousForceCK(Inner<Parameters...> &inner_relation)
+    : BaseViscousForceType(inner_relation),
+      ForcePriorCK(this->particles_, this->dv_viscous_force_) {}
+//=================================================================================================//
+template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ViscousForceCK<Inner<OneLevel, PairSymmetric, ViscosityType, KernelCorrectionType, Parameters...>>::
+    InitializeKernel::InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : viscous_force_(encloser.dv_viscous_force_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ViscousForceCK<Inner<OneLevel, PairSymmetric, ViscosityType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseViscousForceType::InteractKernel(ex_policy, encloser),
+      inter_particle_viscosity_(
+          encloser.viscosity_model_.getInterParticleViscosity(ex_policy, encloser.viscosity_model_)),
+      correction_(ex_policy, encloser.kernel_correction_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      viscous_force_(encloser.dv_viscous_force_->DelegatedData(ex_policy)),
+      smoothing_length_sq_(encloser.smoothing_length_sq_) {}
+//=================================================================================================//
+template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
+void ViscousForceCK<Inner<OneLevel, PairSymmetric, ViscosityType, KernelCorrectionType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Vecd force = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        if (index_j > index_i)
+        {
+            Vecd e_ij = this->e_ij(index_i, index_j, n);
+            Real dW_ijV_iV_j = this->dW_ij(index_i, index_j, n) * Vol_[index_i] * Vol_[index_j];
+            Vecd vec_r_ij = this->vec_r_ij(index_i, index_j, n);
+
+            Vecd vel_derivative = (vel_[index_i] - vel_[index_j]) /
+                                  (vec_r_ij.squaredNorm() + 0.01 * smoothing_length_sq_);
+
+            Vecd pair_force = vec_r_ij.dot((correction_(index_i) + correction_(index_j)) * e_ij) *
+                              inter_particle_viscosity_(index_i, index_j) * vel_derivative * dW_ijV_iV_j;
+            force += pair_force;
+            atomicAdd(viscous_force_[index_j], Vecd(-pair_force));
+        }
+    }
+    atomicAdd(viscous_force_[index_i], force);
+}
+//=================================================================================================//
+template <typename ViscosityType, class KernelCorrectionType, typename... Parameters>
 ViscousForceCK<Contact<Wall, ViscosityType, KernelCorrectionType, Parameters...>>::
     ViscousForceCK(Contact<Parameters...> &contact_relation)
     : BaseViscousForceType(contact_relation), Interaction<Wall>(contact_relation) {}
@@ -83,12 +134,12 @@ void ViscousForceCK<Contact<Wall, ViscosityType, KernelCorrectionType, Parameter
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Vecd force = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        Vecd e_ij = this->e_ij(index_i, index_j);
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
-        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+        Real dW_ijV_j = this->dW_ij(index_i, index_j, n) * contact_Vol_[index_j];
+        Vecd vec_r_ij = this->vec_r_ij(index_i, index_j, n);
 
         Vecd vel_derivative = 2.0 * (vel_[index_i] - wall_vel_ave_[index_j]) /
                               (vec_r_ij.squaredNorm() + 0.01 * smoothing_length_sq_);
@@ -39,6 +39,12 @@ namespace SPH
 {
 namespace FSI
 {
+/**
+ * The structure can be given by a body part, e.g. BodySurfaceLayer, with the relation
+ * Contact<BodyPartByParticle, RealBody> as the last parameters, such as
+ * PressureForceFromFluid<Contact<WithUpdate, AcousticRiemannSolverCK, NoKernelCorrectionCK, BodyPartByParticle, RealBody>>,
+ * so that the relation update and the interaction loop over the surface particles only.
+ */
 template <class KernelCorrectionType, typename... Parameters>
 class ForceFromFluid : public Interaction<Contact<Parameters...>>, public ForcePriorCK
 {
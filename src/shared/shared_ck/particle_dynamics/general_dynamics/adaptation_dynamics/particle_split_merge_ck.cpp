@@ -0,0 +1,15 @@
+#include "particle_split_merge_ck.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+ParticleSplitCK::ParticleSplitCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body), target_volume_(*sph_adaptation_),
+      split_ratio_(0.5 * Real(1 << Dimensions)),
+      spawn_real_particle_method_(particles_),
+      dv_adapt_level_(particles_->getVariableByName<int>("AdaptLevel")),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure")),
+      dv_mass_(particles_->getVariableByName<Real>("Mass")) {}
+//=================================================================================================//
+} // namespace SPH
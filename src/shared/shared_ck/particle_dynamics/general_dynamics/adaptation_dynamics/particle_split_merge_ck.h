@@ -0,0 +1,186 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    particle_split_merge_ck.h
+ * @brief   Split and merge particles at runtime following the adapt level.
+ * @details The target particle volume is obtained from the adapt level given by AdaptLevelIndication,
+ * i.e. the reference spacing is halved for each level. A particle much larger than the target volume
+ * is split into 2^d children on a sub-lattice. Two mutually nearest neighbors much smaller than
+ * the target volume are merged, so that the particle number changes with the resolution.
+ * Mass, volume and momentum are conserved, while other states are taken from the parent or
+ * the surviving particle. Enough reserve particles are required for splitting.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_SPLIT_MERGE_CK_H
+#define PARTICLE_SPLIT_MERGE_CK_H
+
+#include "base_general_dynamics.h"
+#include "interaction_ck.hpp"
+#include "particle_operation.hpp"
+#include "simple_algorithms_ck.h"
+
+namespace SPH
+{
+class AdaptTargetVolume
+{
+  public:
+    explicit AdaptTargetVolume(SPHAdaptation &sph_adaptation)
+        : reference_volume_(math::pow(sph_adaptation.ReferenceSpacing(), Real(Dimensions))) {};
+
+    Real operator()(int adapt_level)
+    {
+        return reference_volume_ * math::pow(Real(0.5), Real(Dimensions * adapt_level));
+    };
+
+  protected:
+    Real reference_volume_;
+};
+
+class ParticleSplitCK : public LocalDynamics
+{
+    using SpawnRealParticleKernel = typename SpawnRealParticle::ComputingKernel;
+
+  public:
+    explicit ParticleSplitCK(SPHBody &sph_body);
+    virtual ~ParticleSplitCK() {};
+
+    class FinishDynamics
+    {
+      public:
+        FinishDynamics(ParticleSplitCK &encloser)
+            : particles_(encloser.particles_) {}
+        void operator()() { particles_->checkEnoughReserve(); }
+
+      private:
+        BaseParticles *particles_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        AdaptTargetVolume target_volume_;
+        Real split_ratio_;
+        UnsignedInt particles_bound_;
+        SpawnRealParticleKernel spawn_real_particle_;
+        int *adapt_level_;
+        Vecd *pos_;
+        Real *Vol_, *mass_;
+    };
+
+  protected:
+    AdaptTargetVolume target_volume_;
+    Real split_ratio_; /**< split if the children are not smaller than the half target volume. */
+    SpawnRealParticle spawn_real_particle_method_;
+    DiscreteVariable<int> *dv_adapt_level_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<Real> *dv_Vol_, *dv_mass_;
+};
+
+template <typename...>
+class ParticleMergePairingCK;
+
+/**
+ * @class ParticleMergePairingCK
+ * @brief Each particle much smaller than its target volume points to its nearest neighbor
+ * with which the merged volume is still acceptable for both. A particle without such a neighbor
+ * points to itself. Only mutual pairs are merged later, so that each particle merges at most once.
+ * The partners are not sorted with the particles, so ParticleMergeCK should follow immediately.
+ */
+template <typename... Parameters>
+class ParticleMergePairingCK<Inner<Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+  public:
+    explicit ParticleMergePairingCK(Inner<Parameters...> &inner_relation);
+    virtual ~ParticleMergePairingCK() {};
+
+    class InteractKernel : public Interaction<Inner<Parameters...>>::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        AdaptTargetVolume target_volume_;
+        Real merge_ratio_;
+        int *adapt_level_;
+        Real *Vol_;
+        UnsignedInt *merge_partner_;
+    };
+
+  protected:
+    AdaptTargetVolume target_volume_;
+    Real merge_ratio_; /**< the merged volume should not exceed this ratio of the target volume. */
+    DiscreteVariable<int> *dv_adapt_level_;
+    DiscreteVariable<UnsignedInt> *dv_merge_partner_;
+};
+
+/**
+ * @class ParticleMergeCK
+ * @brief The particle with the smaller index of a mutual pair absorbs its partner,
+ * which is then removed with the other merged particles by flagging, prefix scan and compaction.
+ */
+template <class ExecutionPolicy>
+class ParticleMergeCK : public LocalDynamics, public BaseDynamics<void>
+{
+    using RemoveKernel = typename RemoveRealParticles::ComputingKernel;
+
+  public:
+    explicit ParticleMergeCK(SPHBody &sph_body);
+    virtual ~ParticleMergeCK() {};
+    virtual void exec(Real dt = 0.0) override;
+    typedef ParticleMergeCK<ExecutionPolicy> LocalDynamicsType;
+
+    class MergeKernel
+    {
+      public:
+        template <class EncloserType>
+        MergeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void merge(UnsignedInt index_i);
+
+      protected:
+        UnsignedInt *merge_partner_;
+        int *life_status_;
+        Vecd *pos_, *vel_;
+        Real *Vol_, *mass_;
+    };
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    SingularVariable<UnsignedInt> *sv_total_real_particles_;
+    DiscreteVariable<UnsignedInt> *dv_merge_partner_;
+    DiscreteVariable<int> *dv_life_status_; // 0: alive, 1: to delete
+    DiscreteVariable<Vecd> *dv_pos_, *dv_vel_;
+    DiscreteVariable<Real> *dv_Vol_, *dv_mass_;
+    RemoveRealParticles remove_real_particles_method_;
+    Implementation<ExecutionPolicy, ParticleMergeCK<ExecutionPolicy>, MergeKernel> merge_implementation_;
+    Implementation<ExecutionPolicy, RemoveRealParticles, RemoveKernel> remove_implementation_;
+};
+} // namespace SPH
+#endif // PARTICLE_SPLIT_MERGE_CK_H
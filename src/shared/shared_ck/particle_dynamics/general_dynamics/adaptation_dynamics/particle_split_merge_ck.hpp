@@ -0,0 +1,170 @@
+#ifndef PARTICLE_SPLIT_MERGE_CK_HPP
+#define PARTICLE_SPLIT_MERGE_CK_HPP
+
+#include "particle_split_merge_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+ParticleSplitCK::UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : target_volume_(encloser.target_volume_), split_ratio_(encloser.split_ratio_),
+      particles_bound_(encloser.particles_->ParticlesBound()),
+      spawn_real_particle_(ex_policy, encloser.spawn_real_particle_method_),
+      adapt_level_(encloser.dv_adapt_level_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+inline void ParticleSplitCK::UpdateKernel::update(size_t index_i, Real dt)
+{
+    if (Vol_[index_i] > split_ratio_ * target_volume_(adapt_level_[index_i]))
+    {
+        constexpr int number_of_children = 1 << Dimensions;
+        Real child_Vol = Vol_[index_i] / Real(number_of_children);
+        Real child_mass = mass_[index_i] / Real(number_of_children);
+        Real quarter_spacing = 0.25 * math::pow(Vol_[index_i], OneOverDimensions);
+        Vecd parent_pos = pos_[index_i];
+        // child 0 stays at the parent index, the others are spawned as copies of the parent
+        for (int k = number_of_children - 1; k >= 0; --k)
+        {
+            Vecd offset = Vecd::Zero();
+            for (int d = 0; d != Dimensions; ++d)
+            {
+                offset[d] = (k >> d) & 1 ? quarter_spacing : -quarter_spacing;
+            }
+
+            UnsignedInt child_index = k == 0 ? index_i : spawn_real_particle_(index_i);
+            if (child_index < particles_bound_)
+            {
+                pos_[child_index] = parent_pos + offset;
+                Vol_[child_index] = child_Vol;
+                mass_[child_index] = child_mass;
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <typename... Parameters>
+ParticleMergePairingCK<Inner<Parameters...>>::
+    ParticleMergePairingCK(Inner<Parameters...> &inner_relation)
+    : Interaction<Inner<Parameters...>>(inner_relation),
+      target_volume_(this->getSPHAdaptation()), merge_ratio_(1.5),
+      dv_adapt_level_(this->particles_->template getVariableByName<int>("AdaptLevel")),
+      dv_merge_partner_(this->particles_->template registerDiscreteVariable<UnsignedInt>(
+          "MergePartner", this->particles_->ParticlesBound())) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ParticleMergePairingCK<Inner<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : Interaction<Inner<Parameters...>>::InteractKernel(ex_policy, encloser),
+      target_volume_(encloser.target_volume_), merge_ratio_(encloser.merge_ratio_),
+      adapt_level_(encloser.dv_adapt_level_->DelegatedData(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      merge_partner_(encloser.dv_merge_partner_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ParticleMergePairingCK<Inner<Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    UnsignedInt partner = index_i;
+    Real merge_limit_i = merge_ratio_ * target_volume_(adapt_level_[index_i]);
+    Real nearest_distance_sqr = MaxReal;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real merged_Vol = Vol_[index_i] + Vol_[index_j];
+        if (merged_Vol < merge_limit_i && merged_Vol < merge_ratio_ * target_volume_(adapt_level_[index_j]))
+        {
+            Real distance_sqr = this->vec_r_ij(index_i, index_j).squaredNorm();
+            if (distance_sqr < nearest_distance_sqr)
+            {
+                nearest_distance_sqr = distance_sqr;
+                partner = index_j;
+            }
+        }
+    }
+    merge_partner_[index_i] = partner;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+ParticleMergeCK<ExecutionPolicy>::ParticleMergeCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body), BaseDynamics<void>(),
+      ex_policy_(ExecutionPolicy{}),
+      sv_total_real_particles_(particles_->svTotalRealParticles()),
+      dv_merge_partner_(particles_->getVariableByName<UnsignedInt>("MergePartner")),
+      dv_life_status_(particles_->registerStateVariable<int>("LifeStatus", 0)),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_vel_(particles_->registerStateVariable<Vecd>("Velocity")),
+      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure")),
+      dv_mass_(particles_->getVariableByName<Real>("Mass")),
+      remove_real_particles_method_(particles_, dv_life_status_),
+      merge_implementation_(*this), remove_implementation_(remove_real_particles_method_) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+template <class EncloserType>
+ParticleMergeCK<ExecutionPolicy>::MergeKernel::
+    MergeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : merge_partner_(encloser.dv_merge_partner_->DelegatedData(ex_policy)),
+      life_status_(encloser.dv_life_status_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void ParticleMergeCK<ExecutionPolicy>::MergeKernel::merge(UnsignedInt index_i)
+{
+    UnsignedInt index_j = merge_partner_[index_i];
+    if (index_j > index_i && merge_partner_[index_j] == index_i) // the partner touches nothing
+    {
+        Real merged_mass = mass_[index_i] + mass_[index_j];
+        pos_[index_i] = (mass_[index_i] * pos_[index_i] + mass_[index_j] * pos_[index_j]) / merged_mass;
+        vel_[index_i] = (mass_[index_i] * vel_[index_i] + mass_[index_j] * vel_[index_j]) / merged_mass;
+        Vol_[index_i] += Vol_[index_j];
+        mass_[index_i] = merged_mass;
+        life_status_[index_j] = 1; // to delete
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void ParticleMergeCK<ExecutionPolicy>::exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<ParticleMergeCK>(), *this->sph_body_);
+    this->setUpdated(*this->sph_body_);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    MergeKernel *merge_kernel = merge_implementation_.getComputingKernel();
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { merge_kernel->merge(i); });
+
+    RemoveKernel *remove_kernel = remove_implementation_.getComputingKernel();
+    particle_for(ex_policy_, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { remove_kernel->flagRemoval(i); });
+
+    UnsignedInt *removal_flag = remove_real_particles_method_.dvRemovalFlag()->DelegatedData(ex_policy_);
+    UnsignedInt *removal_offset = remove_real_particles_method_.dvRemovalOffset()->DelegatedData(ex_policy_);
+    UnsignedInt total_removed =
+        exclusive_scan(ex_policy_, removal_flag, removal_offset, total_real_particles + 1,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    if (total_removed != 0)
+    {
+        UnsignedInt remaining_bound = total_real_particles - total_removed;
+        particle_for(ex_policy_, IndexRange(remaining_bound, total_real_particles),
+                     [=](size_t i)
+                     { remove_kernel->indexRemaining(i, remaining_bound); });
+
+        particle_for(ex_policy_, IndexRange(0, remaining_bound),
+                     [=](size_t i)
+                     { remove_kernel->fillRemoved(i); });
+        sv_total_real_particles_->setValue(remaining_bound);
+    }
+
+    this->logger_->debug("ParticleMergeCK::exec() merges {} particle pairs at {}",
+                         total_removed, this->sph_body_->getName());
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // PARTICLE_SPLIT_MERGE_CK_HPP
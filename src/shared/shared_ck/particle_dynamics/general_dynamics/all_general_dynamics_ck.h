@@ -31,6 +31,7 @@
 
 #include "adapt_criterion.h"
 #include "adapt_indication.h"
+#include "particle_split_merge_ck.hpp"
 #include "all_surface_indication_ck.h"
 #include "force_prior_ck.hpp"
 #include "general_assignment.h"
@@ -38,6 +39,11 @@
 #include "general_gradient.hpp"
 #include "general_reduce_ck.hpp"
 #include "geometric_dynamics.hpp"
+#include "health_check_ck.h"
+#include "hot_variable_pack.hpp"
 #include "hessian_correction_ck.hpp"
 #include "interpolation_dynamics.hpp"
-#include "kernel_correction_ck.hpp"
\ No newline at end of file
+#include "kernel_correction_ck.hpp"
+#include "particle_activity_ck.hpp"
+#include "periodic_bounding_ck.h"
+#include "variable_synchronization_ck.h"
\ No newline at end of file
@@ -15,4 +15,8 @@ ForcePriorCK::ForcePriorCK(BaseParticles *particles, DiscreteVariable<Vecd> *dv_
 ForcePriorCK::ForcePriorCK(BaseParticles *particles, const std::string &force_name)
     : ForcePriorCK(particles, particles->template registerStateVariable<Vecd>(force_name)) {}
 //=================================================================================================//
+InlineBodyForceCK::InlineBodyForceCK(SPHBody &sph_body, const Vecd &acceleration)
+    : acceleration_(acceleration),
+      dv_mass_(sph_body.getBaseParticles().getVariableByName<Real>("Mass")) {}
+//=================================================================================================//
 } // namespace SPH
@@ -79,7 +79,7 @@ class GravityForceCK : public LocalDynamics, public ForcePriorCK
         GravityType gravity_;
         Real *physical_time_;
         Vecd *pos_;
-        Real *mass_;
+        const Real *mass_;
     };
 
   protected:
@@ -88,5 +88,119 @@ class GravityForceCK : public LocalDynamics, public ForcePriorCK
     DiscreteVariable<Vecd> *dv_pos_;
     DiscreteVariable<Real> *dv_mass_;
 };
+
+/**
+ * @class InlineGravityForceCK
+ * @brief The gravity force evaluated inline in the update kernel of a first half step,
+ * see InlineForcePriorCK.
+ */
+template <class GravityType>
+class InlineGravityForceCK
+{
+  public:
+    InlineGravityForceCK(SPHBody &sph_body, const GravityType &gravity);
+    ~InlineGravityForceCK() {};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, InlineGravityForceCK<GravityType> &encloser);
+        Vecd operator()(size_t index_i)
+        {
+            return mass_[index_i] * gravity_.InducedAcceleration(pos_[index_i], *physical_time_);
+        };
+
+      protected:
+        GravityType gravity_;
+        Real *physical_time_;
+        Vecd *pos_;
+        const Real *mass_;
+    };
+
+  protected:
+    const GravityType gravity_;
+    SingularVariable<Real> *sv_physical_time_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<Real> *dv_mass_;
+};
+
+/**
+ * @class InlineBodyForceCK
+ * @brief The constant body force per unit mass evaluated inline, see InlineForcePriorCK.
+ */
+class InlineBodyForceCK
+{
+  public:
+    InlineBodyForceCK(SPHBody &sph_body, const Vecd &acceleration);
+    ~InlineBodyForceCK() {};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, InlineBodyForceCK &encloser)
+            : acceleration_(encloser.acceleration_),
+              mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)) {};
+        Vecd operator()(size_t index_i) { return mass_[index_i] * acceleration_; };
+
+      protected:
+        Vecd acceleration_;
+        const Real *mass_;
+    };
+
+  protected:
+    Vecd acceleration_;
+    DiscreteVariable<Real> *dv_mass_;
+};
+
+/**
+ * @class InlineForce
+ * @brief The prior forces, such as InlineGravityForceCK and InlineBodyForceCK,
+ * evaluated inline in the update kernel of a first half step,
+ * e.g. fluid_dynamics::AcousticStep1stHalf or solid_dynamics::Integration1stHalfPK2CK,
+ * instead of being accumulated into the prior force by separate sweeps.
+ * Note that the inline forces are not included in the variable "ForcePrior"
+ * and hence not seen by other dynamics reading it.
+ */
+template <class... InlineForceTypes>
+class InlineForce
+{
+  public:
+    explicit InlineForce(InlineForceTypes &...inline_forces) : inline_forces_(inline_forces...) {};
+    /** Constructed from a parameter set led by the relation, as used for complex interactions. */
+    template <class RelationType>
+    explicit InlineForce(const std::tuple<RelationType &, InlineForceTypes &...> &parameter_set)
+        : inline_forces_(std::apply(
+              [](auto &, auto &...inline_forces)
+              { return std::tuple<InlineForceTypes &...>(inline_forces...); },
+              parameter_set)) {};
+    ~InlineForce() {};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, InlineForce<InlineForceTypes...> &encloser)
+            : inline_force_kernels_(std::apply(
+                  [&](auto &...inline_forces)
+                  { return std::make_tuple(typename InlineForceTypes::ComputingKernel(ex_policy, inline_forces)...); },
+                  encloser.inline_forces_)) {};
+
+        Vecd operator()(size_t index_i)
+        {
+            return std::apply(
+                [&](auto &...inline_force_kernels)
+                { return (ZeroData<Vecd>::value + ... + inline_force_kernels(index_i)); },
+                inline_force_kernels_);
+        };
+
+      protected:
+        std::tuple<typename InlineForceTypes::ComputingKernel...> inline_force_kernels_;
+    };
+
+  protected:
+    std::tuple<InlineForceTypes &...> inline_forces_;
+};
 } // namespace SPH
 #endif // FORCE_PRIOR_CK_H
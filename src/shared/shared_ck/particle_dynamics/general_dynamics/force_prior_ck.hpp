@@ -31,7 +31,7 @@ GravityForceCK<GravityType>::UpdateKernel::
       gravity_(encloser.gravity_),
       physical_time_(encloser.sv_physical_time_->DelegatedData(ex_policy)),
       pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
-      mass_(encloser.dv_mass_->DelegatedData(ex_policy)) {}
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)) {}
 //=================================================================================================//
 template <class GravityType>
 void GravityForceCK<GravityType>::UpdateKernel::update(size_t index_i, Real dt)
@@ -41,5 +41,21 @@ void GravityForceCK<GravityType>::UpdateKernel::update(size_t index_i, Real dt)
     ForcePriorCK::UpdateKernel::update(index_i, dt);
 }
 //=================================================================================================//
+template <class GravityType>
+InlineGravityForceCK<GravityType>::InlineGravityForceCK(SPHBody &sph_body, const GravityType &gravity)
+    : gravity_(gravity),
+      sv_physical_time_(sph_body.getSPHSystem().getSystemVariableByName<Real>("PhysicalTime")),
+      dv_pos_(sph_body.getBaseParticles().getVariableByName<Vecd>("Position")),
+      dv_mass_(sph_body.getBaseParticles().getVariableByName<Real>("Mass")) {}
+//=================================================================================================//
+template <class GravityType>
+template <class ExecutionPolicy>
+InlineGravityForceCK<GravityType>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, InlineGravityForceCK<GravityType> &encloser)
+    : gravity_(encloser.gravity_),
+      physical_time_(encloser.sv_physical_time_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)) {}
+//=================================================================================================//
 } // namespace SPH
 #endif // FORCE_PRIOR_CK_HPP
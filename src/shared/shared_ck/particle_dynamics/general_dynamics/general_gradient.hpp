@@ -31,7 +31,7 @@ void LinearGradient<Inner<DataType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Grad<DataType> summation = Grad<DataType>::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd corrected_gradW_ijV_j = this->dW_ij(index_i, index_j) * this->Vol_[index_j] *
@@ -67,7 +67,7 @@ void LinearGradient<Contact<DataType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Grad<DataType> summation = Grad<DataType>::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd corrected_gradW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j] *
@@ -99,7 +99,7 @@ void Hessian<Inner<DataType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Hess<DataType> summation = Hess<DataType>::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd r_ij = this->vec_r_ij(index_i, index_j);
@@ -138,7 +138,7 @@ void Hessian<Contact<DataType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Hess<DataType> summation = Hess<DataType>::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd r_ij = this->vec_r_ij(index_i, index_j);
@@ -157,7 +157,7 @@ void SecondOrderGradient<Inner<DataType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Grad<DataType> summation = Grad<DataType>::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd r_ij = this->vec_r_ij(index_i, index_j);
@@ -195,7 +195,7 @@ void SecondOrderGradient<Contact<DataType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Grad<DataType> summation = Grad<DataType>::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd r_ij = this->vec_r_ij(index_i, index_j);
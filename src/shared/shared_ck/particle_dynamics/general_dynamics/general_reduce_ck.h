@@ -30,11 +30,12 @@
 #define GENERAL_REDUCE_CK_H
 
 #include "base_general_dynamics.h"
+#include "health_check_ck.h"
 
 namespace SPH
 {
 class TotalKineticEnergyCK
-    : public LocalDynamicsReduce<ReduceSum<Real>>
+    : public LocalDynamicsReduce<ReduceSum<Real>>, public WithHealthCheckCK
 {
 
   public:
@@ -48,11 +49,15 @@ class TotalKineticEnergyCK
         ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
         Real reduce(size_t index_i, Real dt = 0.0)
         {
-            return 0.5 * mass_[index_i] * vel_[index_i].squaredNorm();
+            Real squared_velocity = vel_[index_i].squaredNorm();
+            Real kinetic_energy = 0.5 * mass_[index_i] * squared_velocity;
+            health_check_.check(kinetic_energy, squared_velocity);
+            return kinetic_energy;
         };
 
       protected:
-        Real *mass_;
+        HealthCheckCK::ComputingKernel health_check_;
+        const Real *mass_;
         Vecd *vel_;
     };
 
@@ -9,7 +9,8 @@ namespace SPH
 template <class ExecutionPolicy, class EncloserType>
 TotalKineticEnergyCK::ReduceKernel::
     ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
-    : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+    : health_check_(ex_policy, encloser.health_check_),
+      mass_(encloser.dv_mass_->ConstDelegatedData(ex_policy)),
       vel_(encloser.dv_vel_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
 template <class ExecutionPolicy, class EncloserType>
@@ -0,0 +1,10 @@
+#include "health_check_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+HealthCheckCK::HealthCheckCK(SPHBody &sph_body, Real velocity_bound)
+    : sph_body_(sph_body), squared_velocity_bound_(velocity_bound * velocity_bound),
+      sv_health_flag_(sph_body.getBaseParticles().registerSingularVariable<UnsignedInt>("HealthCheckFlag", 0)) {}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,98 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	health_check_ck.h
+ * @brief 	The opt-in health check channel for the reductions already sweeping
+ * 			the particles, such as the time step sizes and the energies.
+ * 			A not-a-number or an out-of-bound velocity met in the sweep is flagged
+ * 			without extra passes over the particles.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef HEALTH_CHECK_CK_H
+#define HEALTH_CHECK_CK_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class HealthCheckCK
+ * @brief The flag of a body set by the reductions with the health check enabled.
+ */
+class HealthCheckCK
+{
+  public:
+    HealthCheckCK(SPHBody &sph_body, Real velocity_bound);
+    ~HealthCheckCK() {};
+    SPHBody &getSPHBody() { return sph_body_; };
+    bool isTriggered() { return sv_health_flag_->getValue() != 0; };
+    void reset() { sv_health_flag_->setValue(0); };
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, HealthCheckCK *health_check)
+            : health_flag_(health_check != nullptr
+                               ? health_check->sv_health_flag_->DelegatedData(ex_policy)
+                               : nullptr),
+              squared_velocity_bound_(health_check != nullptr ? health_check->squared_velocity_bound_ : MaxReal) {};
+
+        /** All writers write the same value, so that no atomic operation is required. */
+        void check(Real reduced_value, Real squared_velocity) const
+        {
+            if (health_flag_ != nullptr &&
+                (Not_a_number(reduced_value) || !(squared_velocity <= squared_velocity_bound_)))
+            {
+                *health_flag_ = 1;
+            }
+        };
+
+      protected:
+        UnsignedInt *health_flag_;
+        Real squared_velocity_bound_;
+    };
+
+  protected:
+    SPHBody &sph_body_;
+    Real squared_velocity_bound_;
+    SingularVariable<UnsignedInt> *sv_health_flag_;
+};
+
+/**
+ * @class WithHealthCheckCK
+ * @brief The reductions able to carry the health check.
+ * The health check is to be enabled before the first execution.
+ */
+class WithHealthCheckCK
+{
+  public:
+    WithHealthCheckCK() : health_check_(nullptr) {};
+    void enableHealthCheck(HealthCheckCK &health_check) { health_check_ = &health_check; };
+
+  protected:
+    HealthCheckCK *health_check_;
+};
+} // namespace SPH
+#endif // HEALTH_CHECK_CK_H
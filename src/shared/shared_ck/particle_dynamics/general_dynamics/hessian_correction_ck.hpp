@@ -35,7 +35,7 @@ void DisplacementMatrixGradient<Inner<Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     VecMatGrad grad_displacement_matrix = VecMatGrad::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd corrected_gradW_ij = this->dW_ij(index_i, index_j) * this->Vol_[index_j] *
@@ -56,7 +56,7 @@ void DisplacementMatrixGradient<Contact<Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     VecMatGrad grad_displacement_matrix = VecMatGrad::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd corrected_gradW_ij = this->dW_ij(index_i, index_j) * contact_Vol_[index_j] *
@@ -73,7 +73,7 @@ void HessianCorrectionMatrix<Inner<WithUpdate, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     MatTend summation = MatTend::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd corrected_gradW_ij = this->dW_ij(index_i, index_j) * this->Vol_[index_j] *
@@ -95,8 +95,7 @@ void HessianCorrectionMatrix<Inner<WithUpdate, Parameters...>>::
 {
     Real det_sqr = math::pow(this->M_[index_i].determinant(), 2);
     Real min_det_sqr = SMAX(alpha_ - det_sqr, Real(0));
-    MatTend M_T = this->M_[index_i].transpose(); // for Tikhonov regularization
-    MatTend inverse = (M_T * this->M_[index_i] + TinyReal * MatTend::Identity()).inverse() * M_T;
+    MatTend inverse = small_matrix::regularizedInverse(this->M_[index_i], TinyReal); // Tikhonov regularization
     Real weight = det_sqr / (det_sqr + min_det_sqr);
     this->M_[index_i] = weight * inverse + (1.0 - weight) * MatTend::Identity();
 }
@@ -111,7 +110,7 @@ void HessianCorrectionMatrix<Contact<Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     MatTend summation = MatTend::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd corrected_gradW_ij = this->dW_ij(index_i, index_j) * contact_Vol_[index_j] *
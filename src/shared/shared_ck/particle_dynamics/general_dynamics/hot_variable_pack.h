@@ -0,0 +1,136 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file hot_variable_pack.h
+ * @brief The opt-in packing of the variables gathered per neighbor by the hot kernels of a body.
+ * @details Each registered variable is stored in its own array, so that a kernel
+ * gathering several variables per neighbor touches one cache line per variable.
+ * Here, the declared variables are copied into a record per particle,
+ * so that they are gathered from contiguous memory instead.
+ * The pack is a read-only mirror held as a scratch variable. It is refreshed by exec()
+ * after the variables are updated and before the kernels gather from it.
+ * Therefore, sorting, I/O and the transfer of the states between host and device
+ * work on the original variables only and do not need to know the packed layout.
+ * @author Xiangyu Hu
+ */
+
+#ifndef HOT_VARIABLE_PACK_H
+#define HOT_VARIABLE_PACK_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @struct HotRecord
+ * @brief The packed variables of a particle in the declared order.
+ */
+template <typename...>
+struct HotRecord;
+
+template <typename LastType>
+struct HotRecord<LastType>
+{
+    LastType first_;
+
+    void assign(const LastType &last) { first_ = last; };
+    template <UnsignedInt K>
+    const LastType &get() const
+    {
+        static_assert(K == 0, "The index of the packed variable is out of range!");
+        return first_;
+    };
+};
+
+template <typename FirstType, typename... OtherTypes>
+struct HotRecord<FirstType, OtherTypes...>
+{
+    FirstType first_;
+    HotRecord<OtherTypes...> others_;
+
+    void assign(const FirstType &first, const OtherTypes &...others)
+    {
+        first_ = first;
+        others_.assign(others...);
+    };
+    template <UnsignedInt K>
+    const auto &get() const
+    {
+        if constexpr (K == 0)
+            return first_;
+        else
+            return others_.template get<K - 1>();
+    };
+};
+
+/**
+ * @class HotVariablePack
+ * @brief Pack the given variables, e.g. HotVariablePack<Vecd, Vecd, Real, Real, Real>
+ * with "Position", "Velocity", "Density", "Pressure" and "VolumetricMeasure".
+ * The kernels read the packed data through ComputingKernel, e.g. get<1>(index_j) for the velocity.
+ * Note that the pack is sized by the particles bound at construction.
+ */
+template <typename... DataTypes>
+class HotVariablePack : public LocalDynamics
+{
+    using Record = HotRecord<DataTypes...>;
+
+  public:
+    template <typename... NameTypes>
+    HotVariablePack(SPHBody &sph_body, const NameTypes &...variable_names);
+    virtual ~HotVariablePack() {};
+    DiscreteVariable<Record> *dvRecords() { return dv_records_; };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Record *records_;
+        std::tuple<DataTypes *...> variables_;
+    };
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, HotVariablePack<DataTypes...> &encloser)
+            : records_(encloser.dv_records_->ConstDelegatedData(ex_policy)) {};
+
+        template <UnsignedInt K>
+        const auto &get(UnsignedInt index_j) const { return records_[index_j].template get<K>(); };
+        const Record &operator[](UnsignedInt index_j) const { return records_[index_j]; };
+
+      protected:
+        const Record *records_;
+    };
+
+  protected:
+    std::tuple<DiscreteVariable<DataTypes> *...> dv_variables_;
+    DiscreteVariable<Record> *dv_records_;
+};
+} // namespace SPH
+#endif // HOT_VARIABLE_PACK_H
@@ -0,0 +1,40 @@
+#ifndef HOT_VARIABLE_PACK_HPP
+#define HOT_VARIABLE_PACK_HPP
+
+#include "hot_variable_pack.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename... DataTypes>
+template <typename... NameTypes>
+HotVariablePack<DataTypes...>::HotVariablePack(SPHBody &sph_body, const NameTypes &...variable_names)
+    : LocalDynamics(sph_body),
+      dv_variables_(particles_->template getVariableByName<DataTypes>(variable_names)...),
+      dv_records_(particles_->template addUniqueDiscreteVariable<Record>(
+          "HotVariablePack", particles_->ParticlesBound(), ScratchVariable{}))
+{
+    static_assert(sizeof...(DataTypes) == sizeof...(NameTypes),
+                  "One variable name is required for each packed data type.");
+}
+//=================================================================================================//
+template <typename... DataTypes>
+template <class ExecutionPolicy, class EncloserType>
+HotVariablePack<DataTypes...>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : records_(encloser.dv_records_->DelegatedData(ex_policy)),
+      variables_(std::apply(
+          [&](auto &...dv_variables)
+          { return std::make_tuple(dv_variables->DelegatedData(ex_policy)...); },
+          encloser.dv_variables_)) {}
+//=================================================================================================//
+template <typename... DataTypes>
+void HotVariablePack<DataTypes...>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    std::apply([&](auto &...variables)
+               { records_[index_i].assign(variables[index_i]...); },
+               variables_);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // HOT_VARIABLE_PACK_HPP
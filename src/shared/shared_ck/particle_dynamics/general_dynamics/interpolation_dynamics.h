@@ -119,6 +119,57 @@ class Interpolation<Contact<DataType, RestoringCorrection, Parameters...>> : pub
     };
 };
 
+/**
+ * @class Interpolation
+ * @brief The interpolation for very large observer sets. The neighbors are searched
+ * in the cell linked list of the observed body during the interpolation and no neighbor list is stored.
+ * Therefore, the contact relation only provides the positions, the kernel and the search criterion,
+ * and it is not updated. However, the cell linked list of the observed body should be up to date.
+ */
+class OnTheFlySearch;
+template <typename DataType, typename... Parameters>
+class Interpolation<Contact<DataType, OnTheFlySearch, Parameters...>>
+    : public BaseLocalDynamics<typename Contact<Parameters...>::SourceType>
+{
+    using ContactRelationType = Contact<Parameters...>;
+    using BaseLocalDynamicsType = BaseLocalDynamics<typename ContactRelationType::SourceType>;
+    using Neighborhood = typename ContactRelationType::NeighborhoodType;
+    using NeighborKernel = typename Neighborhood::NeighborKernel;
+    using SearchBox = typename Neighborhood::SearchBox;
+    using TargetType = typename ContactRelationType::TargetType;
+    using MaskedCriterion = typename TargetType::template TargetParticleMask<typename Neighborhood::NeighborCriterion>;
+
+  public:
+    Interpolation(ContactRelationType &contact_relation, const std::string &variable_name);
+    virtual ~Interpolation() {};
+    DiscreteVariable<DataType> *dvInterpolatedQuantities() { return dv_interpolated_quantities_; };
+
+    class UpdateKernel : public NeighborKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        DataType zero_value_;
+        DataType *interpolated_quantities_;
+        Vecd *src_pos_;
+        Real *contact_Vol_;
+        DataType *contact_data_;
+        MaskedCriterion masked_criterion_;
+        NeighborSearch neighbor_search_;
+        SearchBox search_box_;
+    };
+
+  protected:
+    ContactRelationType &contact_relation_;
+    CellLinkedList &contact_cell_linked_list_;
+    DiscreteVariable<DataType> *dv_interpolated_quantities_;
+    DiscreteVariable<Real> *dv_contact_Vol_;
+    DiscreteVariable<DataType> *dv_contact_data_;
+};
+
 template <class ExecutionPolicy, typename DataType, typename... Parameters>
 class ObservingQuantityCK : public InteractionDynamicsCK<ExecutionPolicy, Interpolation<Contact<DataType, Parameters...>>>
 {
@@ -129,5 +180,17 @@ class ObservingQuantityCK : public InteractionDynamicsCK<ExecutionPolicy, Interp
     ObservingQuantityCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
     virtual ~ObservingQuantityCK() {};
 };
+
+template <class ExecutionPolicy, typename DataType, typename... Parameters>
+class ObservingQuantityCK<ExecutionPolicy, DataType, OnTheFlySearch, Parameters...>
+    : public StateDynamics<ExecutionPolicy, Interpolation<Contact<DataType, OnTheFlySearch, Parameters...>>>
+{
+    using BaseDynamicsType = StateDynamics<ExecutionPolicy, Interpolation<Contact<DataType, OnTheFlySearch, Parameters...>>>;
+
+  public:
+    template <typename... Args>
+    ObservingQuantityCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ObservingQuantityCK() {};
+};
 } // namespace SPH
 #endif // INTERPOLATION_DYNAMICS_H
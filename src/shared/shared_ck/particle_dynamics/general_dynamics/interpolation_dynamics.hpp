@@ -3,6 +3,8 @@
 
 #include "interpolation_dynamics.h"
 
+#include "cell_linked_list.hpp"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -37,7 +39,7 @@ void Interpolation<Contact<DataType, Parameters...>>::InteractKernel::interact(s
     DataType interpolated_quantity(zero_value_);
     Real ttl_weight(0);
 
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real weight_j = this->W_ij(index_i, index_j) * contact_Vol_[index_j];
@@ -64,7 +66,7 @@ void Interpolation<Contact<DataType, RestoringCorrection, Parameters...>>::Inter
     PredictVecd prediction = zero_prediction_;
     RestoreMatd restoring_matrix = Eps * RestoreMatd::Identity();
 
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Vecd e_ij = this->e_ij(index_i, index_j);
@@ -87,5 +89,62 @@ void Interpolation<Contact<DataType, RestoringCorrection, Parameters...>>::Inter
     interpolated_quantities_[index_i] = dotProduct(restoring_vector, prediction).get();
 }
 //=================================================================================================//
+template <typename DataType, typename... Parameters>
+Interpolation<Contact<DataType, OnTheFlySearch, Parameters...>>::Interpolation(
+    ContactRelationType &contact_relation, const std::string &variable_name)
+    : BaseLocalDynamicsType(contact_relation.getSourceIdentifier()),
+      contact_relation_(contact_relation),
+      contact_cell_linked_list_(*DynamicCast<CellLinkedList>(
+          this, &contact_relation.getContactIdentifier(0).getCellLinkedList())),
+      dv_interpolated_quantities_(this->particles_->template registerStateVariable<DataType>(variable_name))
+{
+    if (contact_relation.getContactBodies().size() > 1)
+    {
+        std::cout << "\n Error: Interpolation only works for single contact body!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    BaseParticles &contact_particles = contact_relation.getContactBodies()[0]->getBaseParticles();
+    dv_contact_Vol_ = contact_particles.getVariableByName<Real>("VolumetricMeasure");
+    dv_contact_data_ = contact_particles.getVariableByName<DataType>(variable_name);
+}
+//=================================================================================================//
+template <typename DataType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Interpolation<Contact<DataType, OnTheFlySearch, Parameters...>>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : NeighborKernel(ex_policy, encloser.contact_relation_.getNeighborhood(0)),
+      zero_value_(ZeroData<DataType>::value),
+      interpolated_quantities_(encloser.dv_interpolated_quantities_->DelegatedData(ex_policy)),
+      src_pos_(encloser.contact_relation_.dvSourcePosition()->DelegatedData(ex_policy)),
+      contact_Vol_(encloser.dv_contact_Vol_->DelegatedData(ex_policy)),
+      contact_data_(encloser.dv_contact_data_->DelegatedData(ex_policy)),
+      masked_criterion_(
+          ex_policy, encloser.contact_relation_.getContactIdentifier(0),
+          ex_policy, encloser.contact_relation_.getNeighborhood(0)),
+      neighbor_search_(encloser.contact_cell_linked_list_.createNeighborSearch(ex_policy)),
+      search_box_(ex_policy, encloser.contact_relation_.getNeighborhood(0)) {}
+//=================================================================================================//
+template <typename DataType, typename... Parameters>
+void Interpolation<Contact<DataType, OnTheFlySearch, Parameters...>>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    DataType interpolated_quantity(zero_value_);
+    Real ttl_weight(0);
+
+    neighbor_search_.forEachSearch(
+        src_pos_[index_i],
+        [&](size_t index_j)
+        {
+            if (masked_criterion_(index_j, index_i))
+            {
+                Real weight_j = this->W_ij(index_i, index_j) * contact_Vol_[index_j];
+                interpolated_quantity += weight_j * contact_data_[index_j];
+                ttl_weight += weight_j;
+            }
+        },
+        search_box_(index_i));
+    interpolated_quantities_[index_i] = interpolated_quantity / (ttl_weight + TinyReal);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // INTERPOLATION_DYNAMICS_HPP
@@ -37,11 +37,11 @@ void LinearCorrectionMatrix<Inner<WithUpdate, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Matd local_configuration = Matd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        Vecd gradW_ij = this->dW_ij(index_i, index_j) * this->Vol_[index_j] * this->e_ij(index_i, index_j);
-        local_configuration -= this->vec_r_ij(index_i, index_j) * gradW_ij.transpose();
+        Vecd gradW_ij = this->dW_ij(index_i, index_j, n) * this->Vol_[index_j] * this->e_ij(index_i, index_j, n);
+        local_configuration -= this->vec_r_ij(index_i, index_j, n) * gradW_ij.transpose();
     }
     this->B_[index_i] = local_configuration;
 }
@@ -60,8 +60,7 @@ void LinearCorrectionMatrix<Inner<WithUpdate, Parameters...>>::
 {
     Real determinant = this->B_[index_i].determinant();
     Real det_sqr = SMAX(alpha_ - determinant, Real(0));
-    Matd B_T = this->B_[index_i].transpose(); // for Tikhonov regularization
-    Matd inverse = (B_T * this->B_[index_i] + SqrtEps * Matd::Identity()).inverse() * B_T;
+    Matd inverse = small_matrix::regularizedInverse(this->B_[index_i], SqrtEps); // Tikhonov regularization
     Real weight = determinant / (determinant + det_sqr);
     this->B_[index_i] = weight * inverse + (1.0 - weight) * Matd::Identity();
 }
@@ -86,11 +85,11 @@ void LinearCorrectionMatrix<Contact<Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Matd local_configuration = Matd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        Vecd gradW_ij = this->dW_ij(index_i, index_j) * contact_Vol_k_[index_j] * this->e_ij(index_i, index_j);
-        local_configuration -= this->vec_r_ij(index_i, index_j) * gradW_ij.transpose();
+        Vecd gradW_ij = this->dW_ij(index_i, index_j, n) * contact_Vol_k_[index_j] * this->e_ij(index_i, index_j, n);
+        local_configuration -= this->vec_r_ij(index_i, index_j, n) * gradW_ij.transpose();
     }
     this->B_[index_i] += local_configuration;
 }
@@ -11,7 +11,7 @@ template <class DynamicsIdentifier>
 KernelGradientIntegralBase<BaseInteractionType>::KernelGradientIntegralBase(DynamicsIdentifier &identifier)
     : BaseInteractionType(identifier),
       dv_kernel_gradient_integral_(
-          this->particles_->template registerStateVariable<Vecd>("KernelGradientIntegral")) {}
+          this->particles_->template registerScratchVariable<Vecd>("KernelGradientIntegral")) {}
 //=================================================================================================//
 template <class KernelCorrectionType, typename... Parameters>
 KernelGradientIntegral<Inner<KernelCorrectionType, Parameters...>>::KernelGradientIntegral(
@@ -37,11 +37,11 @@ void KernelGradientIntegral<Inner<KernelCorrectionType, Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Vecd inconsistency = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        const Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
-        const Vecd e_ij = this->e_ij(index_i, index_j);
+        const Real dW_ijV_j = this->dW_ij(index_i, index_j, n) * Vol_[index_j];
+        const Vecd e_ij = this->e_ij(index_i, index_j, n);
         inconsistency -= (correction_(index_i) + correction_(index_j)) * dW_ijV_j * e_ij;
     }
     kernel_gradient_integral_[index_i] = inconsistency;
@@ -71,11 +71,11 @@ void KernelGradientIntegral<Contact<Boundary, KernelCorrectionType, Parameters..
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Vecd inconsistency = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
-        const Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
-        const Vecd e_ij = this->e_ij(index_i, index_j);
+        const Real dW_ijV_j = this->dW_ij(index_i, index_j, n) * contact_Vol_[index_j];
+        const Vecd e_ij = this->e_ij(index_i, index_j, n);
         inconsistency -= 2.0 * correction_(index_i) * dW_ijV_j * e_ij;
     }
     kernel_gradient_integral_[index_i] += inconsistency;
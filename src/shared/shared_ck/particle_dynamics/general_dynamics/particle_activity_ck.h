@@ -0,0 +1,92 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	particle_activity_ck.h
+ * @brief 	Deactivating the particles in quiescent regions.
+ * @details A particle becomes quiet when its velocity and pressure changes between two calls
+ * 			are below the thresholds, and falls asleep after being quiet for a given number of calls,
+ * 			unless one of its neighbors is still awake. Therefore, a ring of active particles
+ * 			within the cut-off radius is kept around the moving regions,
+ * 			which wakes up the sleeping particles when the motion arrives.
+ * 			The activity is used by the dynamics on BodyActivityPartition.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_ACTIVITY_CK_H
+#define PARTICLE_ACTIVITY_CK_H
+
+#include "base_general_dynamics.h"
+#include "body_partition.h"
+#include "interaction_ck.hpp"
+
+namespace SPH
+{
+template <typename...>
+class ParticleActivityCK;
+
+template <typename... Parameters>
+class ParticleActivityCK<Inner<WithUpdate, Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    ParticleActivityCK(Inner<Parameters...> &inner_relation, Real velocity_threshold,
+                       Real pressure_threshold, int quiet_steps_to_sleep = 20);
+    virtual ~ParticleActivityCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        int quiet_steps_to_sleep_;
+        int *quiet_steps_, *particle_activity_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real velocity_threshold_sq_, pressure_threshold_;
+        int quiet_steps_to_sleep_;
+        Vecd *vel_, *reference_vel_;
+        Real *p_, *reference_p_;
+        int *quiet_steps_;
+    };
+
+  protected:
+    Real velocity_threshold_sq_, pressure_threshold_;
+    int quiet_steps_to_sleep_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_reference_vel_;
+    DiscreteVariable<Real> *dv_p_, *dv_reference_p_;
+    DiscreteVariable<int> *dv_quiet_steps_, *dv_particle_activity_;
+};
+} // namespace SPH
+#endif // PARTICLE_ACTIVITY_CK_H
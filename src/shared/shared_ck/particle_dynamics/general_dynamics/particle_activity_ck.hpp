@@ -0,0 +1,77 @@
+#ifndef PARTICLE_ACTIVITY_CK_HPP
+#define PARTICLE_ACTIVITY_CK_HPP
+
+#include "particle_activity_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename... Parameters>
+ParticleActivityCK<Inner<WithUpdate, Parameters...>>::
+    ParticleActivityCK(Inner<Parameters...> &inner_relation, Real velocity_threshold,
+                       Real pressure_threshold, int quiet_steps_to_sleep)
+    : BaseInteraction(inner_relation),
+      velocity_threshold_sq_(velocity_threshold * velocity_threshold),
+      pressure_threshold_(pressure_threshold),
+      quiet_steps_to_sleep_(SMAX(quiet_steps_to_sleep, 1)),
+      dv_vel_(this->particles_->template getVariableByName<Vecd>("Velocity")),
+      dv_reference_vel_(this->particles_->template registerStateVariable<Vecd>("ActivityReferenceVelocity")),
+      dv_p_(this->particles_->template getVariableByName<Real>("Pressure")),
+      dv_reference_p_(this->particles_->template registerStateVariable<Real>("ActivityReferencePressure")),
+      dv_quiet_steps_(this->particles_->template registerStateVariable<int>("QuietSteps")),
+      dv_particle_activity_(this->particles_->template registerStateVariable<int>("ParticleActivity", 1))
+{
+    this->particles_->template addEvolvingVariable<Vecd>("ActivityReferenceVelocity");
+    this->particles_->template addEvolvingVariable<Real>("ActivityReferencePressure");
+    this->particles_->template addEvolvingVariable<int>("QuietSteps");
+    this->particles_->template addEvolvingVariable<int>("ParticleActivity");
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ParticleActivityCK<Inner<WithUpdate, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      quiet_steps_to_sleep_(encloser.quiet_steps_to_sleep_),
+      quiet_steps_(encloser.dv_quiet_steps_->DelegatedData(ex_policy)),
+      particle_activity_(encloser.dv_particle_activity_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ParticleActivityCK<Inner<WithUpdate, Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    int is_active = quiet_steps_[index_i] < quiet_steps_to_sleep_ ? 1 : 0;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        if (is_active != 0)
+            break;
+        if (quiet_steps_[this->neighbor_index_[n]] < quiet_steps_to_sleep_)
+            is_active = 1;
+    }
+    particle_activity_[index_i] = is_active;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ParticleActivityCK<Inner<WithUpdate, Parameters...>>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : velocity_threshold_sq_(encloser.velocity_threshold_sq_),
+      pressure_threshold_(encloser.pressure_threshold_),
+      quiet_steps_to_sleep_(encloser.quiet_steps_to_sleep_),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      reference_vel_(encloser.dv_reference_vel_->DelegatedData(ex_policy)),
+      p_(encloser.dv_p_->DelegatedData(ex_policy)),
+      reference_p_(encloser.dv_reference_p_->DelegatedData(ex_policy)),
+      quiet_steps_(encloser.dv_quiet_steps_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ParticleActivityCK<Inner<WithUpdate, Parameters...>>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    bool is_quiet = (vel_[index_i] - reference_vel_[index_i]).squaredNorm() < velocity_threshold_sq_ &&
+                    ABS(p_[index_i] - reference_p_[index_i]) < pressure_threshold_;
+    quiet_steps_[index_i] = is_quiet ? SMIN(quiet_steps_[index_i] + 1, quiet_steps_to_sleep_) : 0;
+    reference_vel_[index_i] = vel_[index_i];
+    reference_p_[index_i] = p_[index_i];
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // PARTICLE_ACTIVITY_CK_HPP
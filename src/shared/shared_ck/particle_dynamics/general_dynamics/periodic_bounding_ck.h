@@ -0,0 +1,87 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file periodic_bounding_ck.h
+ * @brief Periodic condition for the computing kernels without ghost particles.
+ * The particles are bounded into the periodic box, and the periodic axis is
+ * registered to the periodic image of the body, with which the neighbor search
+ * finds the neighbors across the periodic bounds and the particle pair
+ * displacements are the minimum images.
+ * The dynamics should be defined before the relations of the body are updated.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PERIODIC_BOUNDING_CK_H
+#define PERIODIC_BOUNDING_CK_H
+
+#include "base_general_dynamics.h"
+#include "domain_bounding.h"
+
+namespace SPH
+{
+class PeriodicBoundingCK : public LocalDynamics
+{
+  public:
+    PeriodicBoundingCK(RealBody &real_body, PeriodicAlongAxis &periodic_box)
+        : LocalDynamics(real_body),
+          dv_pos_(particles_->getVariableByName<Vecd>("Position"))
+    {
+        int axis = periodic_box.getAxis();
+        Real cut_off_radius = real_body.getSPHAdaptation().getKernel()->CutOffRadius();
+        Real period = periodic_box.getPeriodicTranslation()[axis];
+        if (period < 4.0 * cut_off_radius)
+        {
+            std::cout << "\n Error: the period " << period << " of body " << real_body.getName()
+                      << " is less than four times of the cut off radius!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        real_body.getPeriodicImage().setPeriodicAxis(periodic_box.getBoundingBox(), axis);
+        periodic_image_ = real_body.getPeriodicImage();
+    };
+    virtual ~PeriodicBoundingCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+              periodic_image_(encloser.periodic_image_){};
+
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            pos_[index_i] = periodic_image_.insideImage(pos_[index_i]);
+        };
+
+      protected:
+        Vecd *pos_;
+        PeriodicImage periodic_image_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+    PeriodicImage periodic_image_;
+};
+} // namespace SPH
+#endif // PERIODIC_BOUNDING_CK_H
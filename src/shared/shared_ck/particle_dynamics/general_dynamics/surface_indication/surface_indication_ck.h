@@ -75,6 +75,8 @@ class FreeSurfaceIndicationCK<Base, RelationType<Parameters...>>
  * @class FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>
  * @brief Extends the base free-surface indication for inner relations that also require
  *        an updating step (e.g., "WithUpdate").
+ * @details Particles whose cell stencil is fully filled, i.e. all cells hold nearly
+ *          the lattice number of particles, are in the bulk and are not evaluated.
  */
 template <typename... Parameters>
 class FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>
@@ -84,6 +86,28 @@ class FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>
     explicit FreeSurfaceIndicationCK(Inner<Parameters...> &inner_relation);
     virtual ~FreeSurfaceIndicationCK() {}
 
+    /** Check with the cell linked list whether a particle is in the bulk. */
+    class InteriorCheck
+    {
+      public:
+        template <class ExecutionPolicy>
+        InteriorCheck(const ExecutionPolicy &ex_policy,
+                      FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>> &encloser)
+            : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+              neighbor_search_(encloser.cell_linked_list_.createNeighborSearch(ex_policy)),
+              interior_cell_size_(encloser.interior_cell_size_){};
+
+        bool operator()(size_t index_i) const
+        {
+            return neighbor_search_.isSearchBoxFilled(pos_[index_i], interior_cell_size_);
+        };
+
+      protected:
+        Vecd *pos_;
+        NeighborSearch neighbor_search_;
+        UnsignedInt interior_cell_size_;
+    };
+
     //------------------------------------------------------------------------------------------//
     /**
      * @class InteractKernel
@@ -101,6 +125,9 @@ class FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>
 
         /// Pointer to the previously stored surface indicator.
         int *previous_surface_indicator_;
+
+      protected:
+        InteriorCheck is_interior_;
     };
 
     //------------------------------------------------------------------------------------------//
@@ -122,10 +149,14 @@ class FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>
       protected:
         int *previous_surface_indicator_;
         FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>> *outer_;
+        InteriorCheck is_interior_;
     };
 
   protected:
     DiscreteVariable<int> *dv_previous_surface_indicator_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    CellLinkedList &cell_linked_list_;
+    UnsignedInt interior_cell_size_; /**< the least particles in a filled cell */
 };
 //=================================================================================================//
 // Contact relation version
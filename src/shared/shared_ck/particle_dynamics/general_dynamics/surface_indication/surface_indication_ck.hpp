@@ -2,6 +2,7 @@
 #define SURFACE_INDICATION_CK_HPP
 
 #include "base_particles.hpp"
+#include "cell_linked_list.hpp"
 #include "surface_indication_ck.h"
 
 namespace SPH
@@ -37,9 +38,17 @@ FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>::
     FreeSurfaceIndicationCK(Inner<Parameters...> &inner_relation)
     : FreeSurfaceIndicationCK<Base, Inner<Parameters...>>(inner_relation),
       dv_previous_surface_indicator_(
-          this->particles_->template registerStateVariable<int>("PreviousSurfaceIndicator"))
+          this->particles_->template registerStateVariable<int>("PreviousSurfaceIndicator")),
+      dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, inner_relation.getDynamicsIdentifier().getCellLinkedList())),
+      interior_cell_size_(0)
 {
     this->particles_->template addEvolvingVariable<int>("PreviousSurfaceIndicator");
+    // a cell of the bulk holds nearly the lattice number of particles
+    Real lattice_cell_size = std::pow(cell_linked_list_.getMesh().GridSpacing() /
+                                          this->getSPHAdaptation().ReferenceSpacing(),
+                                      Dimensions);
+    interior_cell_size_ = static_cast<UnsignedInt>(std::ceil(0.9 * lattice_cell_size));
 }
 //=================================================================================================//
 template <typename... Parameters>
@@ -48,14 +57,21 @@ FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>::InteractKernel::
     InteractKernel(const ExecutionPolicy &ex_policy,
                    FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>> &encloser)
     : FreeSurfaceIndicationCK<Base, Inner<Parameters...>>::InteractKernel(ex_policy, encloser),
-      previous_surface_indicator_(encloser.dv_previous_surface_indicator_->DelegatedData(ex_policy)) {}
+      previous_surface_indicator_(encloser.dv_previous_surface_indicator_->DelegatedData(ex_policy)),
+      is_interior_(ex_policy, encloser) {}
 //=================================================================================================//
 template <typename... Parameters>
 void FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>::InteractKernel::
     interact(size_t index_i, Real dt)
 {
+    if (is_interior_(index_i))
+    {
+        this->pos_div_[index_i] = 2.0 * this->threshold_by_dimensions_;
+        return;
+    }
+
     Real pos_div = 0.0;
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real r_ij = this->vec_r_ij(index_i, index_j).norm();
@@ -71,15 +87,23 @@ FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>::UpdateKernel::
                  FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>> &encloser)
     : FreeSurfaceIndicationCK<Base, Inner<Parameters...>>::InteractKernel(ex_policy, encloser),
       previous_surface_indicator_(encloser.dv_previous_surface_indicator_->DelegatedData(ex_policy)),
-      outer_(&encloser) {}
+      outer_(&encloser), is_interior_(ex_policy, encloser) {}
 //=================================================================================================//
 template <typename... Parameters>
 void FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>::UpdateKernel::
     update(size_t index_i, Real dt)
 {
+    // Bulk particles are neither near a surface nor near a previous surface
+    if (is_interior_(index_i))
+    {
+        this->indicator_[index_i] = 0;
+        this->previous_surface_indicator_[index_i] = 0;
+        return;
+    }
+
     // Detect if near surface based on neighbors
     bool is_near_surface = false;
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         const UnsignedInt index_j = this->neighbor_index_[n];
         Real r_ij = this->vec_r_ij(index_i, index_j).norm();
@@ -94,7 +118,7 @@ void FreeSurfaceIndicationCK<Inner<WithUpdate, Parameters...>>::UpdateKernel::
 
     // Check if near a previously marked surface
     bool is_near_previous_surface = false;
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         const UnsignedInt index_j = this->neighbor_index_[n];
         if (this->previous_surface_indicator_[index_j] == 1)
@@ -143,7 +167,7 @@ void FreeSurfaceIndicationCK<Contact<Parameters...>>::InteractKernel::
     interact(size_t index_i, Real dt)
 {
     Real pos_div = 0.0;
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real r_ij = this->vec_r_ij(index_i, index_j).norm();
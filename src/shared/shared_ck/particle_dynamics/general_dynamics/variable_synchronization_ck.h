@@ -0,0 +1,81 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file variable_synchronization_ck.h
+ * @brief Synchronization of selected variables of a body between two execution policies.
+ * @details In a hybrid build, a large body can be executed on the device while
+ * the small bodies, e.g. those coupled with multi-body dynamics, are executed on the host.
+ * Only the variables read across the policy boundary by the contact relations and
+ * the coupling dynamics, such as positions, velocities and normal directions,
+ * are synchronized, other than the whole states of the bodies.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef VARIABLE_SYNCHRONIZATION_CK_H
+#define VARIABLE_SYNCHRONIZATION_CK_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class VariableSynchronizationCK
+ * @brief The variables last updated by the source execution policy are made available
+ * to the target execution policy. Nothing is done if the two policies are the same.
+ */
+template <class SourceExecutionPolicy, class TargetExecutionPolicy>
+class VariableSynchronizationCK : public BaseDynamics<void>
+{
+  public:
+    explicit VariableSynchronizationCK(SPHBody &sph_body)
+        : BaseDynamics<void>(), sph_body_(sph_body),
+          particles_(sph_body.getBaseParticles()) {};
+    virtual ~VariableSynchronizationCK() {};
+
+    template <typename DataType>
+    VariableSynchronizationCK &addVariable(const std::string &name)
+    {
+        addVariableToList<DiscreteVariable, DataType>(
+            variables_to_synchronize_, particles_.getVariableByName<DataType>(name));
+        return *this;
+    };
+
+    virtual void exec(Real dt = 0.0) override
+    {
+        if constexpr (!std::is_same_v<SourceExecutionPolicy, TargetExecutionPolicy>)
+        {
+            ScopedDynamicsTimer timer(type_name<VariableSynchronizationCK>(), sph_body_);
+            prepare_variables_to_synchronize_(variables_to_synchronize_, SourceExecutionPolicy{});
+            finalize_variables_synchronized_(variables_to_synchronize_, TargetExecutionPolicy{});
+        }
+    };
+
+  protected:
+    SPHBody &sph_body_;
+    BaseParticles &particles_;
+    ParticleVariables variables_to_synchronize_;
+    OperationOnDataAssemble<ParticleVariables, PrepareVariablesToWrite<DiscreteVariable>> prepare_variables_to_synchronize_;
+    OperationOnDataAssemble<ParticleVariables, FinalizeVariablesAfterRead<DiscreteVariable>> finalize_variables_synchronized_;
+};
+} // namespace SPH
+#endif // VARIABLE_SYNCHRONIZATION_CK_H
@@ -36,12 +36,27 @@
 
 namespace SPH
 {
+/** The neighbor lists are looped cooperatively only on device, see particle_iterators_sycl.h. */
+template <class ExecutionPolicy, class Identifier, class LanesFunc>
+void particle_for_cooperative(const LoopRangeCK<ExecutionPolicy, Identifier> &loop_range,
+                              const LanesFunc &lanes_func)
+{
+    particle_for(loop_range, [=](size_t i)
+                 { lanes_func(i, SingleNeighborLane{}); });
+};
+
 template <typename...>
 class InteractionDynamicsCK;
 
+template <class ExecutionPolicy, class... InteractionTypes>
+class ComposedInteractionDynamicsCK;
+
 template <>
 class InteractionDynamicsCK<Base>
 {
+    template <class ExecutionPolicy, class... InteractionTypes>
+    friend class ComposedInteractionDynamicsCK;
+
   public:
     InteractionDynamicsCK() {};
 
@@ -59,6 +74,9 @@ class InteractionDynamicsCK<Base>
 template <>
 class InteractionDynamicsCK<WithUpdate> : public InteractionDynamicsCK<Base>
 {
+    template <class ExecutionPolicy, class... InteractionTypes>
+    friend class ComposedInteractionDynamicsCK;
+
   public:
     InteractionDynamicsCK() : InteractionDynamicsCK<Base>() {};
     virtual void runAllSteps(Real dt) override;
@@ -126,14 +144,18 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramet
     using Identifier = typename LocalDynamicsType::Identifier;
     using InteractKernel = typename LocalDynamicsType::InteractKernel;
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
-    KernelImplementation kernel_implementation_;
 
   public:
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
     virtual ~InteractionDynamicsCK() {};
+    InteractKernel *getInteractKernel() { return kernel_implementation_.getComputingKernel(); };
+    /** Run a function on each particle with the loop balanced by the neighbor list sizes. */
+    template <class FunctionOnEach>
+    void particleForNeighborLists(const FunctionOnEach &function);
 
   protected:
+    KernelImplementation kernel_implementation_;
     void runInteraction(Real dt);
 };
 
@@ -147,14 +169,22 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Param
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InteractKernel>;
     UniquePtrsKeeper<KernelImplementation> contact_kernel_implementation_ptrs_;
     StdVec<KernelImplementation *> contact_kernel_implementation_;
+    ComputingKernelArrayImplementation<ExecutionPolicy, InteractKernel> contact_kernel_array_;
 
   public:
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
     virtual ~InteractionDynamicsCK() {};
+    size_t NumberOfContacts() { return contact_kernel_implementation_.size(); };
+    InteractKernel *getInteractKernel(UnsignedInt contact_index)
+    {
+        return contact_kernel_implementation_[contact_index]->getComputingKernel(contact_index);
+    };
 
   protected:
     void runInteraction(Real dt);
+    /** All contact targets in one launch, see Contact::fuseContactTargets. */
+    void runFusedInteraction(Real dt);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -198,6 +228,32 @@ class InteractionDynamicsCK<
     virtual void runUpdateStep(Real dt) override;
 };
 
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+class InteractionDynamicsCK<
+    ExecutionPolicy, InteractionType<RelationType<WithInitialization, OtherParameters...>>>
+    : public InteractionDynamicsCK<
+          ExecutionPolicy, Base, InteractionType<RelationType<WithInitialization, OtherParameters...>>>,
+      public InteractionDynamicsCK<ExecutionPolicy, InteractionType<WithInitialization>>
+{
+    using LocalDynamicsType = InteractionType<RelationType<WithInitialization, OtherParameters...>>;
+    using Identifier = typename LocalDynamicsType::Identifier;
+    using InitializeKernel = typename LocalDynamicsType::InitializeKernel;
+    using BaseInteractKernel = typename LocalDynamicsType::BaseInteractKernel;
+    using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, InitializeKernel>;
+    KernelImplementation kernel_implementation_;
+
+  public:
+    template <typename... Args>
+    InteractionDynamicsCK(Args &&...args);
+    virtual ~InteractionDynamicsCK() {};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    virtual void runInitializationStep(Real dt) override;
+    virtual void runInteractionStep(Real dt = 0.0) override;
+};
+
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 class InteractionDynamicsCK<
@@ -216,9 +272,6 @@ class InteractionDynamicsCK<
     using UpdateKernelImplementation =
         Implementation<ExecutionPolicy, LocalDynamicsType, UpdateKernel>;
 
-    InitializeKernelImplementation initialize_kernel_implementation_;
-    UpdateKernelImplementation update_kernel_implementation_;
-
   public:
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
@@ -226,6 +279,9 @@ class InteractionDynamicsCK<
     virtual void exec(Real dt = 0.0) override;
 
   protected:
+    InitializeKernelImplementation initialize_kernel_implementation_;
+    UpdateKernelImplementation update_kernel_implementation_;
+
     virtual void runInitializationStep(Real dt) override;
     virtual void runInteractionStep(Real dt = 0.0) override;
     virtual void runUpdateStep(Real dt) override;
@@ -253,5 +309,70 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, O
         FirstParameterSet &&first_parameter_set, OtherParameterSets &&...other_parameter_sets);
     virtual void runInteractionStep(Real dt = 0.0) override;
 };
+
+template <typename...>
+class FusedInteractionDynamicsCK;
+
+/**
+ * @class FusedInteractionDynamicsCK
+ * @brief One-level inner interaction and its contact partner with the inner interaction,
+ * the contact interaction and the update executed in a single particle sweep,
+ * so that the particle data are streamed only once after the initialization step.
+ * It is valid only if the update does not change the data read from the neighbors
+ * in the interactions, e.g. for AcousticStep1stHalf, which reads pressure and updates velocity.
+ * With post processes or more than one contact body, the steps are executed separately.
+ */
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          typename... InnerParameters, typename... ContactParameters>
+class FusedInteractionDynamicsCK<
+    ExecutionPolicy, InteractionType<Inner<OneLevel, InnerParameters...>, Contact<ContactParameters...>>>
+    : public InteractionDynamicsCK<
+          ExecutionPolicy, InteractionType<Inner<OneLevel, InnerParameters...>, Contact<ContactParameters...>>>
+{
+    using BaseDynamicsType = InteractionDynamicsCK<
+        ExecutionPolicy, InteractionType<Inner<OneLevel, InnerParameters...>, Contact<ContactParameters...>>>;
+    using InnerInteractionType = InteractionType<Inner<OneLevel, InnerParameters...>>;
+    using Identifier = typename InnerInteractionType::Identifier;
+
+  public:
+    template <class InnerParameterSet, class ContactParameterSet>
+    FusedInteractionDynamicsCK(InnerParameterSet &&inner_parameter_set,
+                               ContactParameterSet &&contact_parameter_set);
+    virtual ~FusedInteractionDynamicsCK() {};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    void runFusedSteps(Real dt);
+};
+
+/**
+ * @class ComposedInteractionDynamicsCK
+ * @brief Several inner interactions of the same body with their interaction steps
+ * executed in a single particle sweep, so that the neighbor lists are streamed only once.
+ * It is valid only if none of the interactions reads the data written by another one,
+ * e.g. not for the linear correction matrix together with an interaction using it.
+ * The pre and post processes and the update steps are executed separately as usual.
+ */
+template <class ExecutionPolicy, class... InteractionTypes>
+class ComposedInteractionDynamicsCK : public BaseDynamics<void>
+{
+    using Components = std::tuple<InteractionDynamicsCK<ExecutionPolicy, InteractionTypes>...>;
+    using FirstComponent = std::tuple_element_t<0, Components>;
+
+  public:
+    template <typename... ParameterSets>
+    explicit ComposedInteractionDynamicsCK(ParameterSets &&...parameter_sets);
+    virtual ~ComposedInteractionDynamicsCK() {};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    Components components_;
+    std::shared_ptr<spdlog::logger> logger_;
+
+    template <class ComponentType>
+    void setupComponent(ComponentType &component, Real dt);
+    template <class ComponentType>
+    void finishComponent(ComponentType &component, Real dt);
+};
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_H
@@ -85,9 +85,19 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
     runInteraction(Real dt)
 {
     InteractKernel *interact_kernel = kernel_implementation_.getComputingKernel();
-    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
-                 [=](size_t i)
-                 { interact_kernel->interact(i, dt); });
+    if constexpr (std::is_same_v<ExecutionPolicy, ParallelDevicePolicy> &&
+                  is_cooperative_kernel<InteractKernel>::value)
+    {
+        if (this->inner_relation_->isCooperative())
+        {
+            particle_for_cooperative(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                                     [=](size_t i, const auto &lanes)
+                                     { interact_kernel->interact(i, dt, lanes); });
+            return;
+        }
+    }
+    particleForNeighborLists([=](size_t i)
+                             { interact_kernel->interact(i, dt); });
 
     this->logger_->debug(
         "InteractionDynamicsCK::runInteraction() for {} at {}",
@@ -96,6 +106,18 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+template <class FunctionOnEach>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
+    particleForNeighborLists(const FunctionOnEach &function)
+{
+    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                 this->inner_relation_->isSlicedEllLayout()
+                     ? nullptr
+                     : this->inner_relation_->dvParticleOffset()->ConstDelegatedData(ExecutionPolicy{}),
+                 function);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
@@ -114,12 +136,32 @@ template <class ExecutionPolicy, template <typename...> class InteractionType, t
 void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
     runInteraction(Real dt)
 {
+    if (this->contact_relation_->isTargetsFused())
+    {
+        runFusedInteraction(dt);
+        return;
+    }
+
     for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
     {
         InteractKernel *interact_kernel =
             contact_kernel_implementation_[k]->getComputingKernel(k);
 
+        if constexpr (std::is_same_v<ExecutionPolicy, ParallelDevicePolicy> &&
+                      is_cooperative_kernel<InteractKernel>::value)
+        {
+            if (this->contact_relation_->isCooperative(k))
+            {
+                particle_for_cooperative(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                                         [=](size_t i, const auto &lanes)
+                                         { interact_kernel->interact(i, dt, lanes); });
+                continue;
+            }
+        }
         particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                     this->contact_relation_->isSlicedEllLayout()
+                         ? nullptr
+                         : this->contact_relation_->dvParticleOffset(k)->ConstDelegatedData(ExecutionPolicy{}),
                      [=](size_t i)
                      { interact_kernel->interact(i, dt); });
 
@@ -130,6 +172,30 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parame
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
+    runFusedInteraction(Real dt)
+{
+    StdVec<InteractKernel *> interact_kernels;
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        interact_kernels.push_back(contact_kernel_implementation_[k]->getComputingKernel(k));
+    }
+    auto *kernel_array = contact_kernel_array_.getKernelArray(interact_kernels);
+
+    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                 [=](size_t i)
+                 {
+                     for (UnsignedInt k = 0; k != kernel_array->size_; ++k)
+                         kernel_array->kernels_[k]->interact(i, dt);
+                 });
+
+    this->logger_->debug(
+        "InteractionDynamicsCK::runFusedInteraction() for {} at {}",
+        type_name<InteractionType<Contact<Parameters...>>>(),
+        this->sph_body_->getName());
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... Parameters>
 template <typename... Args>
@@ -145,6 +211,9 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parameters...>>>::
     exec(Real dt)
 {
+    ScopedDynamicsTimer timer(type_name<InteractionType<RelationType<Parameters...>>>(), this->identifier_->getSPHBody());
+    ScopedExecutionHint hint(this->execution_hint_);
+    waitForRelationUpdate<InteractionType<RelationType<Parameters...>>>(*this);
     this->setUpdated(this->identifier_->getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<Base>::runAllSteps(dt);
@@ -180,6 +249,9 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpdate, OtherParameters...>>>::
     exec(Real dt)
 {
+    ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+    ScopedExecutionHint hint(this->execution_hint_);
+    waitForRelationUpdate<LocalDynamicsType>(*this);
     this->setUpdated(this->identifier_->getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<WithUpdate>::runAllSteps(dt);
@@ -212,6 +284,60 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpd
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 template <typename... Args>
+InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithInitialization, OtherParameters...>>>::
+    InteractionDynamicsCK(Args &&...args)
+    : InteractionDynamicsCK<
+          ExecutionPolicy, Base, InteractionType<RelationType<WithInitialization, OtherParameters...>>>(
+          std::forward<Args>(args)...),
+      InteractionDynamicsCK<ExecutionPolicy, InteractionType<WithInitialization>>(),
+      kernel_implementation_(*this)
+{
+    if constexpr (std::is_base_of_v<BaseInteractKernel, InitializeKernel>)
+    {
+        this->registerComputingKernel(&kernel_implementation_);
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithInitialization, OtherParameters...>>>::
+    exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+    ScopedExecutionHint hint(this->execution_hint_);
+    waitForRelationUpdate<LocalDynamicsType>(*this);
+    this->setUpdated(this->identifier_->getSPHBody());
+    this->setupDynamics(dt);
+    InteractionDynamicsCK<WithInitialization>::runAllSteps(dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithInitialization, OtherParameters...>>>::
+    runInitializationStep(Real dt)
+{
+    InitializeKernel *initialize_kernel = kernel_implementation_.getComputingKernel();
+    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                 [=](size_t i)
+                 { initialize_kernel->initialize(i, dt); });
+
+    this->logger_->debug(
+        "InteractionDynamicsCK::runInitializationStep() for {} at {}",
+        type_name<InteractionType<RelationType<WithInitialization, OtherParameters...>>>(),
+        this->sph_body_->getName());
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithInitialization, OtherParameters...>>>::
+    runInteractionStep(Real dt)
+{
+    this->runInteraction(dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
     InteractionDynamicsCK(Args &&...args)
     : InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<RelationType<OneLevel, OtherParameters...>>>(
@@ -235,6 +361,9 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
     exec(Real dt)
 {
+    ScopedDynamicsTimer timer(type_name<LocalDynamicsType>(), this->identifier_->getSPHBody());
+    ScopedExecutionHint hint(this->execution_hint_);
+    waitForRelationUpdate<LocalDynamicsType>(*this);
     this->setUpdated(this->identifier_->getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<OneLevel>::runAllSteps(dt);
@@ -298,5 +427,145 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Ot
     other_interactions_.runInteractionStep(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          typename... InnerParameters, typename... ContactParameters>
+template <class InnerParameterSet, class ContactParameterSet>
+FusedInteractionDynamicsCK<
+    ExecutionPolicy, InteractionType<Inner<OneLevel, InnerParameters...>, Contact<ContactParameters...>>>::
+    FusedInteractionDynamicsCK(InnerParameterSet &&inner_parameter_set,
+                               ContactParameterSet &&contact_parameter_set)
+    : BaseDynamicsType(std::forward<InnerParameterSet>(inner_parameter_set),
+                       std::forward<ContactParameterSet>(contact_parameter_set)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          typename... InnerParameters, typename... ContactParameters>
+void FusedInteractionDynamicsCK<
+    ExecutionPolicy, InteractionType<Inner<OneLevel, InnerParameters...>, Contact<ContactParameters...>>>::
+    exec(Real dt)
+{
+    ScopedDynamicsTimer timer(type_name<FusedInteractionDynamicsCK>(), this->identifier_->getSPHBody());
+    if (!this->post_processes_.empty() || this->other_interactions_.NumberOfContacts() != 1)
+    {
+        BaseDynamicsType::exec(dt);
+        return;
+    }
+
+    this->setUpdated(this->identifier_->getSPHBody());
+    this->setupDynamics(dt);
+    this->runInitializationStep(dt);
+
+    for (size_t k = 0; k < this->pre_processes_.size(); ++k)
+        this->pre_processes_[k]->exec(dt);
+
+    runFusedSteps(dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          typename... InnerParameters, typename... ContactParameters>
+void FusedInteractionDynamicsCK<
+    ExecutionPolicy, InteractionType<Inner<OneLevel, InnerParameters...>, Contact<ContactParameters...>>>::
+    runFusedSteps(Real dt)
+{
+    auto *interact_kernel = this->kernel_implementation_.getComputingKernel();
+    auto *contact_interact_kernel = this->other_interactions_.getInteractKernel(0);
+    auto *update_kernel = this->update_kernel_implementation_.getComputingKernel();
+    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
+                 [=](size_t i)
+                 {
+                     interact_kernel->interact(i, dt);
+                     contact_interact_kernel->interact(i, dt);
+                     update_kernel->update(i, dt);
+                 });
+
+    this->logger_->debug(
+        "FusedInteractionDynamicsCK::runFusedSteps() for {} at {}",
+        type_name<InnerInteractionType>(), this->sph_body_->getName());
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class... InteractionTypes>
+template <typename... ParameterSets>
+ComposedInteractionDynamicsCK<ExecutionPolicy, InteractionTypes...>::
+    ComposedInteractionDynamicsCK(ParameterSets &&...parameter_sets)
+    : BaseDynamics<void>(), components_(std::forward<ParameterSets>(parameter_sets)...),
+      logger_(Log::get())
+{
+    static_assert(sizeof...(InteractionTypes) == sizeof...(ParameterSets),
+                  "One parameter set is required for each composed interaction.");
+    static_assert(((!std::is_base_of_v<InteractionDynamicsCK<OneLevel>, InteractionDynamicsCK<ExecutionPolicy, InteractionTypes>> &&
+                    !std::is_base_of_v<InteractionDynamicsCK<WithInitialization>, InteractionDynamicsCK<ExecutionPolicy, InteractionTypes>>) &&
+                   ...),
+                  "Only the interactions without initialization step can be composed.");
+
+    SPHBody *sph_body = &std::get<0>(components_).getSPHBody();
+    std::apply(
+        [&](auto &...components)
+        {
+            if (((&components.getSPHBody() != sph_body) || ...))
+            {
+                std::cout << "\n Error: the composed interactions are not of the same body!" << std::endl;
+                std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                exit(1);
+            }
+        },
+        components_);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class... InteractionTypes>
+template <class ComponentType>
+void ComposedInteractionDynamicsCK<ExecutionPolicy, InteractionTypes...>::
+    setupComponent(ComponentType &component, Real dt)
+{
+    component.setUpdated(component.getSPHBody());
+    component.setupDynamics(dt);
+    InteractionDynamicsCK<Base> &base_component = component;
+    for (size_t k = 0; k < base_component.pre_processes_.size(); ++k)
+        base_component.pre_processes_[k]->exec(dt);
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class... InteractionTypes>
+template <class ComponentType>
+void ComposedInteractionDynamicsCK<ExecutionPolicy, InteractionTypes...>::
+    finishComponent(ComponentType &component, Real dt)
+{
+    InteractionDynamicsCK<Base> &base_component = component;
+    for (size_t k = 0; k < base_component.post_processes_.size(); ++k)
+        base_component.post_processes_[k]->exec(dt);
+
+    if constexpr (std::is_base_of_v<InteractionDynamicsCK<WithUpdate>, ComponentType>)
+    {
+        InteractionDynamicsCK<WithUpdate> &update_component = component;
+        update_component.runUpdateStep(dt);
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class... InteractionTypes>
+void ComposedInteractionDynamicsCK<ExecutionPolicy, InteractionTypes...>::exec(Real dt)
+{
+    FirstComponent &first_component = std::get<0>(components_);
+    ScopedDynamicsTimer timer(type_name<ComposedInteractionDynamicsCK>(), first_component.getSPHBody());
+
+    std::apply([&](auto &...components)
+               { (setupComponent(components, dt), ...); },
+               components_);
+
+    auto interact_kernels = std::apply([](auto &...components)
+                                       { return std::make_tuple(components.getInteractKernel()...); },
+                                       components_);
+    first_component.particleForNeighborLists(
+        [=](size_t i)
+        {
+            std::apply([&](auto *...interact_kernel)
+                       { (interact_kernel->interact(i, dt), ...); },
+                       interact_kernels);
+        });
+
+    logger_->debug("ComposedInteractionDynamicsCK::exec() for {} interactions at {}",
+                   sizeof...(InteractionTypes), first_component.getSPHBody().getName());
+
+    std::apply([&](auto &...components)
+               { (finishComponent(components, dt), ...); },
+               components_);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_HPP
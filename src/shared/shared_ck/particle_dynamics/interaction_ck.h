@@ -54,10 +54,63 @@ class UpdateOnly
 class InitializationOnly
 {
 };
+/** Each pair of an inner relation is evaluated once from its lower index
+ *  and the antisymmetric contribution is scattered to both particles. */
+class PairSymmetric
+{
+};
+
+/**
+ * @class SingleNeighborLane
+ * @brief The neighbor list of a particle is looped by a single work item.
+ * A cooperative interaction kernel provides interact(index_i, dt, lanes), in which the lanes
+ * loop the neighbor list with the stride of their size, reduce the partial sums
+ * and the leader writes the results, see SubGroupNeighborLanes for device.
+ */
+struct SingleNeighborLane
+{
+    UnsignedInt Lane() const { return 0; };
+    UnsignedInt Size() const { return 1; };
+    bool isLeader() const { return true; };
+    template <typename DataType>
+    DataType reduce(const DataType &value) const { return value; };
+};
+
+template <class KernelType, class = void>
+struct is_cooperative_kernel : std::false_type
+{
+};
+
+template <class KernelType>
+struct is_cooperative_kernel<
+    KernelType, std::void_t<decltype(std::declval<KernelType &>().interact(
+                    size_t(0), Real(0), SingleNeighborLane{}))>> : std::true_type
+{
+};
 
 template <typename... T>
 class Interaction;
 
+template <class T, class = void>
+struct has_relation_update_wait : std::false_type
+{
+};
+
+template <class T>
+struct has_relation_update_wait<T, std::void_t<decltype(&T::waitForRelationUpdate)>> : std::true_type
+{
+};
+
+/** Wait for the overlapped update of the relation used by an interaction, see OverlappedUpdateRelation. */
+template <class InteractionType>
+void waitForRelationUpdate(InteractionType &interaction)
+{
+    if constexpr (has_relation_update_wait<InteractionType>::value)
+    {
+        interaction.waitForRelationUpdate();
+    }
+};
+
 template <typename... Parameters>
 class Interaction<Inner<Parameters...>>
     : public BaseLocalDynamics<typename Inner<Parameters...>::SourceType>
@@ -67,21 +120,45 @@ class Interaction<Inner<Parameters...>>
     using NeighborList = typename InnerRelationType::NeighborList;
     using Neighborhood = typename InnerRelationType::NeighborhoodType;
     using NeighborKernel = typename Neighborhood::NeighborKernel;
+    using PairGeometry = typename InnerRelationType::PairGeometry;
 
   public:
     explicit Interaction(InnerRelationType &inner_relation);
     virtual ~Interaction() {};
 
-    class InteractKernel : public NeighborList, public NeighborKernel
+    class InteractKernel : public NeighborList, public NeighborKernel, public PairGeometry
     {
       public:
         template <class ExecutionPolicy, class EncloserType>
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+        using NeighborKernel::W_ij;
+        using NeighborKernel::dW_ij;
+        using NeighborKernel::e_ij;
+        using NeighborKernel::vec_r_ij;
+        /** Read from the pair geometry cache of the relation if available. */
+        inline Vecd vec_r_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_e_ij_ != nullptr ? this->pair_r_ij_[n] * this->pair_e_ij_[n] : vec_r_ij(i, j);
+        };
+        inline Vecd e_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_e_ij_ != nullptr ? this->pair_e_ij_[n] : e_ij(i, j);
+        };
+        inline Real dW_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_dW_ij_ != nullptr ? this->pair_dW_ij_[n] : dW_ij(i, j);
+        };
+        inline Real W_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_W_ij_ != nullptr ? this->pair_W_ij_[n] : W_ij(i, j);
+        };
     };
 
     typedef InteractKernel BaseInteractKernel;
     void registerComputingKernel(Implementation<Base> *implementation);
     void resetComputingKernelUpdated();
+    void waitForRelationUpdate() { inner_relation_->waitForPendingUpdate(); };
 
   protected:
     InnerRelationType *inner_relation_;
@@ -97,22 +174,46 @@ class Interaction<Contact<Parameters...>>
     using NeighborList = typename ContactRelationType::NeighborList;
     using Neighborhood = typename ContactRelationType::NeighborhoodType;
     using NeighborKernel = typename Neighborhood::NeighborKernel;
+    using PairGeometry = typename ContactRelationType::PairGeometry;
 
   public:
     explicit Interaction(ContactRelationType &contact_relation);
     virtual ~Interaction() {};
 
-    class InteractKernel : public NeighborList, public NeighborKernel
+    class InteractKernel : public NeighborList, public NeighborKernel, public PairGeometry
     {
       public:
         template <class ExecutionPolicy, class EncloserType>
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser,
                        UnsignedInt contact_index);
+
+        using NeighborKernel::W_ij;
+        using NeighborKernel::dW_ij;
+        using NeighborKernel::e_ij;
+        using NeighborKernel::vec_r_ij;
+        /** Read from the pair geometry cache of the relation if available. */
+        inline Vecd vec_r_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_e_ij_ != nullptr ? this->pair_r_ij_[n] * this->pair_e_ij_[n] : vec_r_ij(i, j);
+        };
+        inline Vecd e_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_e_ij_ != nullptr ? this->pair_e_ij_[n] : e_ij(i, j);
+        };
+        inline Real dW_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_dW_ij_ != nullptr ? this->pair_dW_ij_[n] : dW_ij(i, j);
+        };
+        inline Real W_ij(UnsignedInt i, UnsignedInt j, UnsignedInt n) const
+        {
+            return this->pair_W_ij_ != nullptr ? this->pair_W_ij_[n] : W_ij(i, j);
+        };
     };
 
     typedef InteractKernel BaseInteractKernel;
     void registerComputingKernel(Implementation<Base> *implementation, UnsignedInt contact_index);
     void resetComputingKernelUpdated(UnsignedInt contact_index);
+    void waitForRelationUpdate() { contact_relation_->waitForPendingUpdate(); };
 
   protected:
     ContactRelationType *contact_relation_;
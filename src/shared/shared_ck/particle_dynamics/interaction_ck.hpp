@@ -31,7 +31,8 @@ template <class ExecutionPolicy, class EncloserType>
 Interaction<Inner<Parameters...>>::InteractKernel::
     InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : NeighborList(ex_policy, *encloser.inner_relation_),
-      NeighborKernel(ex_policy, encloser.inner_relation_->getNeighborhood()) {}
+      NeighborKernel(ex_policy, encloser.inner_relation_->getNeighborhood()),
+      PairGeometry(ex_policy, *encloser.inner_relation_) {}
 //=================================================================================================//
 template <typename... Parameters>
 Interaction<Contact<Parameters...>>::
@@ -68,7 +69,8 @@ template <class ExecutionPolicy, class EncloserType>
 Interaction<Contact<Parameters...>>::InteractKernel::
     InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
     : NeighborList(ex_policy, *encloser.contact_relation_, contact_index),
-      NeighborKernel(ex_policy, encloser.contact_relation_->getNeighborhood(contact_index)) {}
+      NeighborKernel(ex_policy, encloser.contact_relation_->getNeighborhood(contact_index)),
+      PairGeometry(ex_policy, *encloser.contact_relation_, contact_index) {}
 //=================================================================================================//
 template <class WallContactRelationType>
 Interaction<Wall>::Interaction(WallContactRelationType &wall_contact_relation)
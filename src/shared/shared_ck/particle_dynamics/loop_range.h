@@ -64,19 +64,23 @@ class LoopRangeCK<ExecutionPolicy, BodyPartByParticle>
   public:
     LoopRangeCK(BodyPartByParticle &body_part)
         : particle_list_(body_part.dvParticleList()->DelegatedData(ExecutionPolicy{})),
-          loop_bound_(body_part.svRangeSize()->DelegatedData(ExecutionPolicy{})) {};
+          loop_bound_(body_part.svRangeSize()->DelegatedData(ExecutionPolicy{})),
+          is_contiguous_(body_part.isContiguous()) {};
     template <class UnaryFunc>
-    void computeUnit(const UnaryFunc &f, UnsignedInt i) const { f(particle_list_[i]); };
+    void computeUnit(const UnaryFunc &f, UnsignedInt i) const { f(ParticleIndex(i)); };
     template <class ReturnType, class BinaryFunc, class UnaryFunc>
     ReturnType computeUnit(ReturnType temp, const BinaryFunc &bf, const UnaryFunc &uf, UnsignedInt i) const
     {
-        return uf(particle_list_[i]);
+        return uf(ParticleIndex(i));
     };
     UnsignedInt LoopBound() const { return *loop_bound_; };
 
   protected:
     UnsignedInt *particle_list_;
     UnsignedInt *loop_bound_;
+    bool is_contiguous_;
+    /** No indirection if the body part is contiguous at the front of the particle range. */
+    UnsignedInt ParticleIndex(UnsignedInt i) const { return is_contiguous_ ? i : particle_list_[i]; };
 };
 
 template <class ExecutionPolicy>
@@ -148,5 +152,35 @@ class LoopRangeCK<ExecutionPolicy, BodyPartition>
     int present_adapt_level_;
     int *adapt_level_;
 };
+
+template <class ExecutionPolicy>
+class LoopRangeCK<ExecutionPolicy, BodyActivityPartition>
+{
+  public:
+    LoopRangeCK(BodyActivityPartition &activity_partition)
+        : loop_bound_(activity_partition.getBaseParticles().svTotalRealParticles()->DelegatedData(ExecutionPolicy{})),
+          particle_activity_(activity_partition.dvParticleActivity()->DelegatedData(ExecutionPolicy{})) {};
+
+    template <class UnaryFunc>
+    void computeUnit(const UnaryFunc &f, UnsignedInt i) const
+    {
+        if (particle_activity_[i] != 0)
+        {
+            f(i);
+        }
+    };
+
+    template <class ReturnType, class BinaryFunc, class UnaryFunc>
+    ReturnType computeUnit(ReturnType temp, const BinaryFunc &bf, const UnaryFunc &uf, UnsignedInt i) const
+    {
+        return particle_activity_[i] != 0 ? bf(temp, uf(i)) : temp;
+    };
+
+    UnsignedInt LoopBound() const { return *loop_bound_; };
+
+  protected:
+    UnsignedInt *loop_bound_;
+    int *particle_activity_;
+};
 } // namespace SPH
 #endif // LOOP_RANGE_H
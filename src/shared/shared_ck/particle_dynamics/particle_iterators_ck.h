@@ -31,6 +31,7 @@
 
 #include "implementation.h"
 #include "loop_range.h"
+#include "loop_scheduling.h"
 
 namespace SPH
 {
@@ -48,7 +49,8 @@ template <class Identifier, class UnaryFunc>
 void particle_for(const LoopRangeCK<ParallelPolicy, Identifier> &loop_range,
                   const UnaryFunc &unary_func)
 {
-    parallel_for(
+    static tbb::affinity_partitioner affinity_partitioner;
+    scheduled_parallel_for(
         IndexRange(0, loop_range.LoopBound()),
         [&](const IndexRange &r)
         {
@@ -57,7 +59,41 @@ void particle_for(const LoopRangeCK<ParallelPolicy, Identifier> &loop_range,
                 loop_range.computeUnit(unary_func, i);
             }
         },
-        ap);
+        affinity_partitioner);
+};
+
+/**
+ * Iterators with the neighbor counts from the prefix sums of a relation, which are used
+ * as cost estimates if the neighbor cost partitioning is chosen. Only the host loops
+ * over the whole body, in which the loop index is the particle index, are cost aware.
+ * Without the prefix sums, e.g. for the sliced ELLPACK layout, the default partitioning is used.
+ */
+template <class ExecutionPolicy, class Identifier, class UnaryFunc>
+void particle_for(const LoopRangeCK<ExecutionPolicy, Identifier> &loop_range,
+                  const UnsignedInt *particle_offset, const UnaryFunc &unary_func)
+{
+    particle_for(loop_range, unary_func);
+};
+
+template <class UnaryFunc>
+void particle_for(const LoopRangeCK<ParallelPolicy, SPHBody> &loop_range,
+                  const UnsignedInt *particle_offset, const UnaryFunc &unary_func)
+{
+    if (loop_scheduling.Partitioner() != PartitionerType::NeighborCost || particle_offset == nullptr)
+    {
+        particle_for(loop_range, unary_func);
+        return;
+    }
+
+    cost_balanced_parallel_for(
+        loop_range.LoopBound(), particle_offset,
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i < r.end(); ++i)
+            {
+                loop_range.computeUnit(unary_func, i);
+            }
+        });
 };
 
 template <typename Operation, class Identifier, class ReturnType, class UnaryFunc>
@@ -78,7 +114,7 @@ ReturnType particle_reduce(const LoopRangeCK<ParallelPolicy, Identifier> &loop_r
                            ReturnType temp, const UnaryFunc &unary_func)
 {
     Operation operation;
-    return parallel_reduce(
+    return scheduled_parallel_reduce(
         IndexRange(0, loop_range.LoopBound()), temp,
         [&](const IndexRange &r, ReturnType temp0) -> ReturnType
         {
@@ -214,6 +214,14 @@ class ParticleMethodContainer : public BaseMethodContainer
         return group;
     }
 
+    template <class DynamicsIdentifier, typename... Args>
+    auto &addIncrementalCellLinkedListDynamics(DynamicsIdentifier &identifier, Args &&...args)
+    {
+        return *particle_dynamics_keeper_.createPtr<
+            IncrementalUpdateCellLinkedList<ExecutionPolicy, DynamicsIdentifier>>(
+            identifier, std::forward<Args>(args)...);
+    };
+
     template <class FirstRelation, typename... OtherRelations>
     auto &addRelationDynamics(FirstRelation &first_relation, OtherRelations &...other_relations)
     {
@@ -222,11 +230,11 @@ class ParticleMethodContainer : public BaseMethodContainer
             first_relation, other_relations...);
     };
 
-    template <typename... Args>
+    template <class CellOrdering = MortonOrdering, typename... Args>
     auto &addSortDynamics(Args &&...args)
     {
         return *particle_dynamics_keeper_.createPtr<
-            ParticleSortCK<ExecutionPolicy>>(std::forward<Args>(args)...);
+            ParticleSortCK<ExecutionPolicy, CellOrdering>>(std::forward<Args>(args)...);
     };
 
     template <class DynamicsIdentifier>
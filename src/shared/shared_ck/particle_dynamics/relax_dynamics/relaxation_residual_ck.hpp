@@ -11,7 +11,7 @@ template <class DynamicsIdentifier>
 RelaxationResidualBase<BaseInteractionType>::RelaxationResidualBase(DynamicsIdentifier &identifier)
     : BaseInteractionType(identifier),
       dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
-      dv_residual_(this->particles_->template registerStateVariable<Vecd>("KernelGradientIntegral")) {}
+      dv_residual_(this->particles_->template registerScratchVariable<Vecd>("KernelGradientIntegral")) {}
 //=================================================================================================//
 template <class KernelCorrectionType, typename... Parameters>
 RelaxationResidualCK<Inner<KernelCorrectionType, Parameters...>>::
@@ -32,7 +32,7 @@ void RelaxationResidualCK<Inner<KernelCorrectionType, Parameters...>>::InteractK
     interact(size_t index_i, Real dt)
 {
     Vecd residual = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         const Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
@@ -62,7 +62,7 @@ void RelaxationResidualCK<Contact<Boundary, KernelCorrectionType, Parameters...>
     interact(size_t index_i, Real dt)
 {
     Vecd residual = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         const Real dW_ijV_j = this->dW_ij(index_i, index_j) * contact_Vol_[index_j];
@@ -48,17 +48,19 @@ class LevelsetBounding : public BaseLocalDynamics<BodyPartByCell>
 
         void update(size_t index_i, Real dt = 0.0)
         {
-            Real phi = signed_distance_(pos_[index_i]);
+            UnsignedInt &package_hint = package_hint_[index_i];
+            Real phi = signed_distance_(pos_[index_i], package_hint);
 
             if (phi > -constrained_distance_)
             {
                 pos_[index_i] -= (phi + constrained_distance_) *
-                                 normal_direction_(pos_[index_i]);
+                                 normal_direction_(pos_[index_i], package_hint);
             }
         };
 
       protected:
         Vecd *pos_;
+        UnsignedInt *package_hint_;
         ProbeSignedDistance signed_distance_;
         ProbeNormalDirection normal_direction_;
         Real constrained_distance_;
@@ -66,6 +68,45 @@ class LevelsetBounding : public BaseLocalDynamics<BodyPartByCell>
 
   protected:
     DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<UnsignedInt> *dv_package_hint_; /**< cached level-set package of each particle */
+    LevelSet &level_set_;
+    Real constrained_distance_;
+};
+
+/**
+ * @class ShellMidSurfaceBoundingCK
+ * @brief Computing-kernel version of ShellMidSurfaceBounding,
+ * which constrains the shell particles to the mid-surface by level-set probes on the device.
+ */
+class ShellMidSurfaceBoundingCK : public BaseLocalDynamics<BodyPartByCell>
+{
+  public:
+    explicit ShellMidSurfaceBoundingCK(NearShapeSurface &body_part);
+    virtual ~ShellMidSurfaceBoundingCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            // the gradient norm times the normal direction, as in the host version
+            Vecd none_normalized_normal = level_set_gradient_(pos_[index_i], package_hint_[index_i]);
+            pos_[index_i] -= 0.2 * constrained_distance_ * none_normalized_normal;
+        };
+
+      protected:
+        Vecd *pos_;
+        UnsignedInt *package_hint_;
+        ProbeLevelSetGradient level_set_gradient_;
+        Real constrained_distance_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<UnsignedInt> *dv_package_hint_;
     LevelSet &level_set_;
     Real constrained_distance_;
 };
@@ -84,17 +125,19 @@ class LevelsetKernelGradientIntegral : public LocalDynamics
 
         void update(size_t index_i, Real dt = 0.0)
         {
-            residual_[index_i] -= 2.0 * kernel_gradient_integral_(pos_[index_i]);
+            residual_[index_i] -= 2.0 * kernel_gradient_integral_(pos_[index_i], package_hint_[index_i]);
         };
 
       protected:
         Vecd *pos_, *residual_;
+        UnsignedInt *package_hint_;
         ProbeKernelGradientIntegral kernel_gradient_integral_;
     };
 
   protected:
     DiscreteVariable<Vecd> *dv_pos_;
     DiscreteVariable<Vecd> *dv_residual_;
+    DiscreteVariable<UnsignedInt> *dv_package_hint_;
     LevelSet &level_set_;
 };
 
@@ -12,15 +12,25 @@ template <class ExecutionPolicy, class EncloserType>
 LevelsetBounding::UpdateKernel::
     UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      package_hint_(encloser.dv_package_hint_->DelegatedData(ex_policy)),
       signed_distance_(encloser.level_set_.getProbeSignedDistance(ex_policy)),
       normal_direction_(encloser.level_set_.getProbeNormalDirection(ex_policy)),
       constrained_distance_(encloser.constrained_distance_) {}
 //=================================================================================================//
 template <class ExecutionPolicy, class EncloserType>
+ShellMidSurfaceBoundingCK::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      package_hint_(encloser.dv_package_hint_->DelegatedData(ex_policy)),
+      level_set_gradient_(encloser.level_set_.getProbeLevelSetGradient(ex_policy)),
+      constrained_distance_(encloser.constrained_distance_) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
 LevelsetKernelGradientIntegral::UpdateKernel::
     UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
       residual_(encloser.dv_residual_->DelegatedData(ex_policy)),
+      package_hint_(encloser.dv_package_hint_->DelegatedData(ex_policy)),
       kernel_gradient_integral_(encloser.level_set_.getProbeKernelGradientIntegral(ex_policy)) {}
 //=================================================================================================//
 } // namespace SPH
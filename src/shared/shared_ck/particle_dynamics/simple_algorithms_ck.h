@@ -57,6 +57,8 @@ class StateDynamics : public UpdateType, public BaseDynamics<void>
 
     virtual void exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<UpdateType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         this->setUpdated(this->identifier_->getSPHBody());
         this->setupDynamics(dt);
         UpdateKernel *update_kernel = kernel_implementation_.getComputingKernel();
@@ -99,12 +101,22 @@ class ReduceDynamicsCK : public ReduceType,
     virtual ~ReduceDynamicsCK() {};
     std::string QuantityName() { return this->quantity_name_; };
     ReduceReturnType ReducedValue() { return reduced_value_; };
+    Identifier &getDynamicsIdentifier() { return *this->identifier_; };
+    ReduceKernel *getReduceKernel() { return kernel_implementation_.getComputingKernel(); };
+    /** Keep the value reduced by the kernel, also when reduced outside, and return the output. */
+    OutputType finishReduction(const ReduceReturnType &reduced_value)
+    {
+        reduced_value_ = reduced_value;
+        return finish_dynamics_.Result(reduced_value_);
+    };
 
     virtual OutputType exec(Real dt = 0.0) override
     {
+        ScopedDynamicsTimer timer(type_name<ReduceType>(), this->identifier_->getSPHBody());
+        ScopedExecutionHint hint(this->execution_hint_);
         this->setupDynamics(dt);
         ReduceKernel *reduce_kernel = kernel_implementation_.getComputingKernel();
-        reduced_value_ = particle_reduce<Operation>(
+        ReduceReturnType reduced_value = particle_reduce<Operation>(
             LoopRangeCK<ExecutionPolicy, Identifier>(*this->identifier_),
             this->reference_,
             [=](size_t i)
@@ -115,7 +127,89 @@ class ReduceDynamicsCK : public ReduceType,
             type_name<ReduceType>(),
             this->sph_body_->getName());
 
-        return finish_dynamics_.Result(reduced_value_);
+        return finishReduction(reduced_value);
+    };
+};
+
+/**
+ * @class ComposedReduceDynamicsCK
+ * @brief Several reductions over the same particles evaluated in a single sweep,
+ * with the reduce operations combined element-wise, so that the particle data are
+ * read once and only one reduction, i.e. one device synchronization, is required.
+ * The outputs of the reductions are returned as a tuple.
+ */
+template <class ExecutionPolicy, class... ReduceTypes>
+class ComposedReduceDynamicsCK
+    : public BaseDynamics<std::tuple<typename ReduceDynamicsCK<ExecutionPolicy, ReduceTypes>::OutputType...>>
+{
+    using Components = std::tuple<ReduceDynamicsCK<ExecutionPolicy, ReduceTypes> &...>;
+    using FirstComponent = ReduceDynamicsCK<ExecutionPolicy, std::tuple_element_t<0, std::tuple<ReduceTypes...>>>;
+    using Identifier = typename std::tuple_element_t<0, std::tuple<ReduceTypes...>>::Identifier;
+    using Operation = ReduceTuple<typename ReduceTypes::OperationType...>;
+    using ReduceReturnType = typename Operation::ReturnType;
+    Components components_;
+    std::shared_ptr<spdlog::logger> logger_;
+
+  public:
+    using OutputType = std::tuple<typename ReduceDynamicsCK<ExecutionPolicy, ReduceTypes>::OutputType...>;
+
+    /** The reductions are defined as usual and can still be executed individually. */
+    explicit ComposedReduceDynamicsCK(ReduceDynamicsCK<ExecutionPolicy, ReduceTypes> &...components)
+        : BaseDynamics<OutputType>(), components_(components...), logger_(Log::get())
+    {
+        static_assert((std::is_same_v<typename ReduceTypes::Identifier, Identifier> && ...),
+                      "The composed reductions must loop over the same kind of dynamics identifier.");
+
+        Identifier *identifier = &std::get<0>(components_).getDynamicsIdentifier();
+        std::apply(
+            [&](auto &...components)
+            {
+                if (((&components.getDynamicsIdentifier() != identifier) || ...))
+                {
+                    std::cout << "\n Error: the composed reductions are not over the same particles!" << std::endl;
+                    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                    exit(1);
+                }
+            },
+            components_);
+    };
+    virtual ~ComposedReduceDynamicsCK() {};
+
+    virtual OutputType exec(Real dt = 0.0) override
+    {
+        FirstComponent &first_component = std::get<0>(components_);
+        ScopedDynamicsTimer timer(type_name<ComposedReduceDynamicsCK>(), first_component.getSPHBody());
+
+        std::apply([&](auto &...components)
+                   { (components.setupDynamics(dt), ...); },
+                   components_);
+        ReduceReturnType reference = std::apply([](auto &...components)
+                                                { return ReduceReturnType(components.Reference()...); },
+                                                components_);
+        auto reduce_kernels = std::apply([](auto &...components)
+                                         { return std::make_tuple(components.getReduceKernel()...); },
+                                         components_);
+        ReduceReturnType reduced_value = particle_reduce<Operation>(
+            LoopRangeCK<ExecutionPolicy, Identifier>(first_component.getDynamicsIdentifier()),
+            reference,
+            [=](size_t i)
+            {
+                return std::apply([&](auto *...reduce_kernel)
+                                  { return ReduceReturnType(reduce_kernel->reduce(i, dt)...); },
+                                  reduce_kernels);
+            });
+
+        logger_->debug("ComposedReduceDynamicsCK::exec() for {} reductions at {}",
+                       sizeof...(ReduceTypes), first_component.getSPHBody().getName());
+
+        return finishComponents(reduced_value, std::index_sequence_for<ReduceTypes...>{});
+    };
+
+  protected:
+    template <size_t... Is>
+    OutputType finishComponents(const ReduceReturnType &reduced_value, std::index_sequence<Is...>)
+    {
+        return OutputType(std::get<Is>(components_).finishReduction(std::get<Is>(reduced_value))...);
     };
 };
 } // namespace SPH
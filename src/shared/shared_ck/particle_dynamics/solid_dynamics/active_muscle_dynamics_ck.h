@@ -0,0 +1,117 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	active_muscle_dynamics_ck.h
+ * @brief 	The muscle dynamics driven by active contraction on the computing kernels.
+ * @details The activation updates the active contraction stress particle-wise
+ * 			and the active stress is added to the passive one in the initialize kernel
+ * 			of the first half integration, so that the force is still obtained
+ * 			by a single neighbor traversal of the elastic interaction.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef ACTIVE_MUSCLE_DYNAMICS_CK_H
+#define ACTIVE_MUSCLE_DYNAMICS_CK_H
+
+#include "complex_solid.h"
+#include "elastic_dynamics_ck.h"
+
+namespace SPH
+{
+namespace active_muscle_dynamics
+{
+/**
+ * @class MuscleActivationCK
+ * @brief Case-specific muscle activation given by a function of
+ * the initial position and the physical time, i.e.
+ * Real operator()(const Vecd &initial_position, Real time),
+ * which is copied into the kernel and should be free of host pointers.
+ */
+template <class ActivationFunction>
+class MuscleActivationCK : public LocalDynamics
+{
+  public:
+    MuscleActivationCK(SPHBody &sph_body, const ActivationFunction &activation_function);
+    virtual ~MuscleActivationCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ActivationFunction activation_function_;
+        Real *physical_time_;
+        Vecd *pos0_;
+        Real *active_contraction_stress_;
+    };
+
+  protected:
+    ActivationFunction activation_function_;
+    SingularVariable<Real> *sv_physical_time_;
+    DiscreteVariable<Vecd> *dv_pos0_;
+    DiscreteVariable<Real> *dv_active_contraction_stress_;
+};
+} // namespace active_muscle_dynamics
+
+namespace solid_dynamics
+{
+/**
+ * @class ActiveIntegration1stHalfPK2CK
+ * @brief The first half integration with the passive stress from the constitute kernel
+ * of the muscle type and the active stress along the fiber of each particle.
+ */
+template <typename...>
+class ActiveIntegration1stHalfPK2CK;
+
+template <class MaterialType, typename... Parameters>
+class ActiveIntegration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>
+    : public Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>
+{
+    using BaseDynamicsType = Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>;
+    using ActiveStressKernel = typename MaterialType::ActiveStressKernel;
+
+  public:
+    explicit ActiveIntegration1stHalfPK2CK(Inner<Parameters...> &inner_relation)
+        : BaseDynamicsType(inner_relation){};
+    virtual ~ActiveIntegration1stHalfPK2CK() {};
+
+    class InitializeKernel : public BaseDynamicsType::InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ActiveStressKernel active_stress_;
+    };
+
+    using InteractKernel = typename BaseDynamicsType::InteractKernel;
+    using UpdateKernel = typename BaseDynamicsType::UpdateKernel;
+};
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // ACTIVE_MUSCLE_DYNAMICS_CK_H
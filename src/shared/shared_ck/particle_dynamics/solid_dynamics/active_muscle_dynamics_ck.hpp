@@ -0,0 +1,58 @@
+#ifndef ACTIVE_MUSCLE_DYNAMICS_CK_HPP
+#define ACTIVE_MUSCLE_DYNAMICS_CK_HPP
+
+#include "active_muscle_dynamics_ck.h"
+#include "elastic_dynamics_ck.hpp"
+
+namespace SPH
+{
+namespace active_muscle_dynamics
+{
+//=================================================================================================//
+template <class ActivationFunction>
+MuscleActivationCK<ActivationFunction>::
+    MuscleActivationCK(SPHBody &sph_body, const ActivationFunction &activation_function)
+    : LocalDynamics(sph_body), activation_function_(activation_function),
+      sv_physical_time_(sph_system_->getSystemVariableByName<Real>("PhysicalTime")),
+      dv_pos0_(particles_->registerStateVariableFrom<Vecd>("InitialPosition", "Position")),
+      dv_active_contraction_stress_(particles_->getVariableByName<Real>("ActiveContractionStress")) {}
+//=================================================================================================//
+template <class ActivationFunction>
+template <class ExecutionPolicy, class EncloserType>
+MuscleActivationCK<ActivationFunction>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : activation_function_(encloser.activation_function_),
+      physical_time_(encloser.sv_physical_time_->DelegatedData(ex_policy)),
+      pos0_(encloser.dv_pos0_->DelegatedData(ex_policy)),
+      active_contraction_stress_(encloser.dv_active_contraction_stress_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ActivationFunction>
+void MuscleActivationCK<ActivationFunction>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    active_contraction_stress_[index_i] = activation_function_(pos0_[index_i], *physical_time_);
+}
+//=================================================================================================//
+} // namespace active_muscle_dynamics
+//=================================================================================================//
+namespace solid_dynamics
+{
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ActiveIntegration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseDynamicsType::InitializeKernel(ex_policy, encloser),
+      active_stress_(ex_policy, encloser.material_) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void ActiveIntegration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    BaseDynamicsType::InitializeKernel::initialize(index_i, dt);
+    this->stress_PK1_B_[index_i] +=
+        this->F_[index_i] * active_stress_.StressPK2(index_i) * this->B_[index_i].transpose();
+}
+//=================================================================================================//
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // ACTIVE_MUSCLE_DYNAMICS_CK_HPP
@@ -26,5 +26,9 @@
 
 #pragma once
 
+#include "active_muscle_dynamics_ck.hpp"
+#include "contact_dynamics_ck.hpp"
 #include "derived_solid_state.h"
 #include "solid_constraint.hpp"
+#include "elastic_dynamics_ck.hpp"
+#include "thin_structure_dynamics_ck.hpp"
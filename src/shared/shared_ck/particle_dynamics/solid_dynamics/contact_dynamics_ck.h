@@ -0,0 +1,230 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	contact_dynamics_ck.h
+ * @brief 	Here, we define the solid contact dynamics on the computing kernels,
+ * 			i.e. the repulsion factor, the repulsion force and the wall friction.
+ * @details The contact relations are updated every step, as the contacting bodies move.
+ * 			As each contact target is computed by its own kernel and the results are summed,
+ * 			the targets can also be fused into one launch by Contact::fuseContactTargets.
+ * 			The self contact is not included yet, as it requires a surface self-contact relation.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef CONTACT_DYNAMICS_CK_H
+#define CONTACT_DYNAMICS_CK_H
+
+#include "base_general_dynamics.h"
+#include "base_material.h"
+#include "force_prior_ck.hpp"
+#include "interaction_ck.hpp"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+template <typename...>
+class RepulsionFactorSummationCK;
+
+template <typename... Parameters>
+class RepulsionFactorSummationCK<Contact<WithInitialization, Parameters...>>
+    : public Interaction<Contact<Parameters...>>
+{
+    using BaseInteraction = Interaction<Contact<Parameters...>>;
+
+  public:
+    explicit RepulsionFactorSummationCK(Contact<Parameters...> &contact_relation);
+    virtual ~RepulsionFactorSummationCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0) { repulsion_factor_[index_i] = 0.0; };
+
+      protected:
+        Real *repulsion_factor_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *repulsion_factor_;
+        Real *contact_Vol_;
+    };
+
+  protected:
+    DiscreteVariable<Real> *dv_repulsion_factor_;
+};
+using ContactFactorSummationCK = RepulsionFactorSummationCK<Contact<WithInitialization>>;
+
+template <typename...>
+class RepulsionForceCK;
+
+template <typename... Parameters>
+class RepulsionForceCK<Base, Contact<Parameters...>>
+    : public Interaction<Contact<Parameters...>>, public ForcePriorCK
+{
+    using BaseInteraction = Interaction<Contact<Parameters...>>;
+
+  public:
+    explicit RepulsionForceCK(Contact<Parameters...> &contact_relation);
+    virtual ~RepulsionForceCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0) { repulsion_force_[index_i] = Vecd::Zero(); };
+
+      protected:
+        Vecd *repulsion_force_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+
+      protected:
+        Real *Vol_, *repulsion_factor_;
+        Vecd *repulsion_force_;
+        Real *contact_Vol_;
+    };
+
+    using UpdateKernel = ForcePriorCK::UpdateKernel;
+
+  protected:
+    Solid &solid_;
+    DiscreteVariable<Real> *dv_repulsion_factor_;
+    DiscreteVariable<Vecd> *dv_repulsion_force_;
+};
+
+/** The repulsion force between solid bodies, each of which has its own repulsion factor. */
+template <typename... Parameters>
+class RepulsionForceCK<Contact<OneLevel, Parameters...>>
+    : public RepulsionForceCK<Base, Contact<Parameters...>>
+{
+    using BaseDynamicsType = RepulsionForceCK<Base, Contact<Parameters...>>;
+
+  public:
+    explicit RepulsionForceCK(Contact<Parameters...> &contact_relation);
+    virtual ~RepulsionForceCK() {};
+
+    class InteractKernel : public BaseDynamicsType::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real contact_stiffness_ave_;
+        Real *contact_repulsion_factor_;
+    };
+
+  protected:
+    StdVec<Real> contact_stiffness_ave_;
+    StdVec<DiscreteVariable<Real> *> dv_contact_repulsion_factor_;
+};
+using ContactForceCK = RepulsionForceCK<Contact<OneLevel>>;
+
+/** The repulsion force from a rigid wall, for which the repulsion factor is not computed. */
+template <typename... Parameters>
+class RepulsionForceCK<Contact<OneLevel, Wall, Parameters...>>
+    : public RepulsionForceCK<Base, Contact<Parameters...>>
+{
+    using BaseDynamicsType = RepulsionForceCK<Base, Contact<Parameters...>>;
+
+  public:
+    explicit RepulsionForceCK(Contact<Parameters...> &wall_contact_relation);
+    virtual ~RepulsionForceCK() {};
+
+    class InteractKernel : public BaseDynamicsType::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real contact_stiffness_;
+    };
+};
+using ContactForceFromWallCK = RepulsionForceCK<Contact<OneLevel, Wall>>;
+
+/**
+ * @class PairwiseFrictionFromWallCK
+ * @brief Damping to wall by which the wall velocity is not updated
+ * and the mass of wall particle is not considered.
+ * Different from the original version, the neighbor parameters are not stored
+ * but evaluated again during the backward sweep, as the kernels have no local neighbor arrays.
+ * Note that, currently, this class works only when the contact
+ * bodies have the same resolution.
+ */
+template <typename...>
+class PairwiseFrictionFromWallCK;
+
+template <typename... Parameters>
+class PairwiseFrictionFromWallCK<Contact<Wall, Parameters...>>
+    : public Interaction<Contact<Parameters...>>, public Interaction<Wall>
+{
+    using BaseInteraction = Interaction<Contact<Parameters...>>;
+
+  public:
+    PairwiseFrictionFromWallCK(Contact<Parameters...> &wall_contact_relation, Real eta);
+    virtual ~PairwiseFrictionFromWallCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real eta_; /**< friction coefficient */
+        Real *Vol_, *mass_;
+        Vecd *vel_;
+        Real *wall_Vol_;
+        Vecd *wall_vel_ave_, *wall_n_;
+
+        void frictionWithNeighbor(size_t index_i, UnsignedInt n, Real dt);
+    };
+
+  protected:
+    Real eta_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<Vecd> *dv_vel_;
+};
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // CONTACT_DYNAMICS_CK_H
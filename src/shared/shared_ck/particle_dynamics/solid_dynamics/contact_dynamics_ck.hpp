@@ -0,0 +1,192 @@
+#ifndef CONTACT_DYNAMICS_CK_HPP
+#define CONTACT_DYNAMICS_CK_HPP
+
+#include "contact_dynamics_ck.h"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+//=================================================================================================//
+template <typename... Parameters>
+RepulsionFactorSummationCK<Contact<WithInitialization, Parameters...>>::
+    RepulsionFactorSummationCK(Contact<Parameters...> &contact_relation)
+    : BaseInteraction(contact_relation),
+      dv_repulsion_factor_(this->particles_->template registerStateVariable<Real>("RepulsionFactor")) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+RepulsionFactorSummationCK<Contact<WithInitialization, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : repulsion_factor_(encloser.dv_repulsion_factor_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+RepulsionFactorSummationCK<Contact<WithInitialization, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseInteraction::InteractKernel(ex_policy, encloser, contact_index),
+      repulsion_factor_(encloser.dv_repulsion_factor_->DelegatedData(ex_policy)),
+      contact_Vol_(encloser.dv_contact_Vol_[contact_index]->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void RepulsionFactorSummationCK<Contact<WithInitialization, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Real sigma = 0.0;
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        sigma += this->W_ij(index_i, index_j) * contact_Vol_[index_j];
+    }
+    repulsion_factor_[index_i] += sigma;
+}
+//=================================================================================================//
+template <typename... Parameters>
+RepulsionForceCK<Base, Contact<Parameters...>>::
+    RepulsionForceCK(Contact<Parameters...> &contact_relation)
+    : BaseInteraction(contact_relation), ForcePriorCK(this->particles_, "RepulsionForce"),
+      solid_(DynamicCast<Solid>(this, this->sph_body_->getBaseMaterial())),
+      dv_repulsion_factor_(this->particles_->template getVariableByName<Real>("RepulsionFactor")),
+      dv_repulsion_force_(ForcePriorCK::getCurrentForce()) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+RepulsionForceCK<Base, Contact<Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : repulsion_force_(encloser.dv_repulsion_force_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+RepulsionForceCK<Base, Contact<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseInteraction::InteractKernel(ex_policy, encloser, contact_index),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      repulsion_factor_(encloser.dv_repulsion_factor_->DelegatedData(ex_policy)),
+      repulsion_force_(encloser.dv_repulsion_force_->DelegatedData(ex_policy)),
+      contact_Vol_(encloser.dv_contact_Vol_[contact_index]->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+RepulsionForceCK<Contact<OneLevel, Parameters...>>::
+    RepulsionForceCK(Contact<Parameters...> &contact_relation)
+    : BaseDynamicsType(contact_relation)
+{
+    const Real contact_stiffness_1 = this->solid_.ContactStiffness();
+    for (size_t k = 0; k != this->contact_particles_.size(); ++k)
+    {
+        Solid &contact_solid_k = DynamicCast<Solid>(this, this->contact_bodies_[k]->getBaseMaterial());
+        const Real contact_stiffness_k = contact_solid_k.ContactStiffness();
+        contact_stiffness_ave_.push_back(
+            2 * contact_stiffness_1 * contact_stiffness_k / (contact_stiffness_1 + contact_stiffness_k));
+        dv_contact_repulsion_factor_.push_back(
+            this->contact_particles_[k]->template getVariableByName<Real>("RepulsionFactor"));
+    }
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+RepulsionForceCK<Contact<OneLevel, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseDynamicsType::InteractKernel(ex_policy, encloser, contact_index),
+      contact_stiffness_ave_(encloser.contact_stiffness_ave_[contact_index]),
+      contact_repulsion_factor_(encloser.dv_contact_repulsion_factor_[contact_index]->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void RepulsionForceCK<Contact<OneLevel, Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    Real sigma_i = this->repulsion_factor_[index_i];
+    Vecd force = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Real sigma_star = 0.5 * (sigma_i + contact_repulsion_factor_[index_j]);
+        // force due to pressure
+        force -= 2.0 * sigma_star * this->e_ij(index_i, index_j) *
+                 this->dW_ij(index_i, index_j) * this->contact_Vol_[index_j];
+    }
+    this->repulsion_force_[index_i] += force * contact_stiffness_ave_ * this->Vol_[index_i];
+}
+//=================================================================================================//
+template <typename... Parameters>
+RepulsionForceCK<Contact<OneLevel, Wall, Parameters...>>::
+    RepulsionForceCK(Contact<Parameters...> &wall_contact_relation)
+    : BaseDynamicsType(wall_contact_relation) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+RepulsionForceCK<Contact<OneLevel, Wall, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseDynamicsType::InteractKernel(ex_policy, encloser, contact_index),
+      contact_stiffness_(encloser.solid_.ContactStiffness()) {}
+//=================================================================================================//
+template <typename... Parameters>
+void RepulsionForceCK<Contact<OneLevel, Wall, Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    Real p_i = this->repulsion_factor_[index_i] * contact_stiffness_;
+    Vecd force = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        // force due to pressure
+        force -= 2.0 * p_i * this->e_ij(index_i, index_j) *
+                 this->dW_ij(index_i, index_j) * this->contact_Vol_[index_j];
+    }
+    this->repulsion_force_[index_i] += force * this->Vol_[index_i];
+}
+//=================================================================================================//
+template <typename... Parameters>
+PairwiseFrictionFromWallCK<Contact<Wall, Parameters...>>::
+    PairwiseFrictionFromWallCK(Contact<Parameters...> &wall_contact_relation, Real eta)
+    : BaseInteraction(wall_contact_relation), Interaction<Wall>(wall_contact_relation),
+      eta_(eta), dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_vel_(this->particles_->template getVariableByName<Vecd>("Velocity")) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+PairwiseFrictionFromWallCK<Contact<Wall, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index)
+    : BaseInteraction::InteractKernel(ex_policy, encloser, contact_index),
+      eta_(encloser.eta_), Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      wall_Vol_(encloser.dv_contact_Vol_[contact_index]->DelegatedData(ex_policy)),
+      wall_vel_ave_(encloser.dv_wall_vel_ave_[contact_index]->DelegatedData(ex_policy)),
+      wall_n_(encloser.dv_wall_n_[contact_index]->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void PairwiseFrictionFromWallCK<Contact<Wall, Parameters...>>::
+    InteractKernel::frictionWithNeighbor(size_t index_i, UnsignedInt n, Real dt)
+{
+    UnsignedInt index_j = this->neighbor_index_[n];
+    Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
+    Real r_ij = vec_r_ij.norm();
+    Real parameter_b = eta_ * this->dW_ij(index_i, index_j) * wall_Vol_[index_j] * Vol_[index_i] * dt / r_ij;
+
+    // only update particle i
+    Vecd vel_derivative = vel_[index_i] - wall_vel_ave_[index_j];
+    Vecd n_j = vec_r_ij.dot(wall_n_[index_j]) > 0.0 ? wall_n_[index_j] : -1.0 * wall_n_[index_j];
+    vel_derivative -= SMAX(Real(0), vel_derivative.dot(n_j)) * n_j;
+    vel_[index_i] += parameter_b * vel_derivative / (mass_[index_i] - 2.0 * parameter_b);
+}
+//=================================================================================================//
+template <typename... Parameters>
+void PairwiseFrictionFromWallCK<Contact<Wall, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    const UnsignedInt first_neighbor = this->FirstNeighbor(index_i);
+    const UnsignedInt last_neighbor = this->LastNeighbor(index_i);
+    // forward sweep
+    for (UnsignedInt n = first_neighbor; n != last_neighbor; n += this->neighbor_stride_)
+    {
+        frictionWithNeighbor(index_i, n, dt);
+    }
+    // backward sweep
+    for (UnsignedInt n = last_neighbor; n != first_neighbor;)
+    {
+        n -= this->neighbor_stride_;
+        frictionWithNeighbor(index_i, n, dt);
+    }
+}
+//=================================================================================================//
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // CONTACT_DYNAMICS_CK_HPP
@@ -0,0 +1,302 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	elastic_dynamics_ck.h
+ * @brief 	Here, we define the total Lagrangian elastic solid dynamics on the computing kernels.
+ * @details The inner relation should be built on the initial configuration,
+ * 			i.e. with ConfigType::Lagrangian, and the material type is given as template
+ * 			parameter, which provides its constitute kernel without virtual functions.
+ * 			As the reference geometry does not change, the pair geometry and kernel values
+ * 			can be cached once by Relation::cacheReferenceGeometry and are then read by the kernels.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef ELASTIC_DYNAMICS_CK_H
+#define ELASTIC_DYNAMICS_CK_H
+
+#include "base_general_dynamics.h"
+#include "elastic_solid.h"
+#include "force_prior_ck.hpp"
+#include "interaction_ck.hpp"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+template <typename...>
+class ElasticIntegrationCK;
+
+template <typename... Parameters>
+class ElasticIntegrationCK<Interaction<Inner<Parameters...>>>
+    : public Interaction<Inner<Parameters...>>
+{
+  public:
+    explicit ElasticIntegrationCK(Inner<Parameters...> &inner_relation);
+    virtual ~ElasticIntegrationCK() {};
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_, *dv_vel_, *dv_force_;
+    DiscreteVariable<Matd> *dv_B_, *dv_F_, *dv_dF_dt_;
+};
+
+template <typename...>
+class DeformationGradientBySummationCK;
+
+template <typename... Parameters>
+class DeformationGradientBySummationCK<Inner<Parameters...>>
+    : public ElasticIntegrationCK<Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = ElasticIntegrationCK<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit DeformationGradientBySummationCK(Inner<Parameters...> &inner_relation)
+        : BaseInteraction(inner_relation) {};
+    virtual ~DeformationGradientBySummationCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *Vol_;
+        Vecd *pos_;
+        Matd *B_, *F_;
+    };
+};
+
+template <class MaterialType, class BaseInteractionType>
+class BaseIntegration1stHalfCK : public ElasticIntegrationCK<BaseInteractionType>
+{
+  public:
+    template <class DynamicsIdentifier>
+    explicit BaseIntegration1stHalfCK(DynamicsIdentifier &identifier);
+    virtual ~BaseIntegration1stHalfCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *mass_;
+        Vecd *vel_, *force_, *force_prior_;
+    };
+
+  protected:
+    MaterialType &material_;
+    Real rho0_, inv_rho0_, smoothing_length_;
+    DiscreteVariable<Real> *dv_rho_, *dv_mass_;
+    DiscreteVariable<Vecd> *dv_force_prior_;
+};
+
+template <typename...>
+class Integration1stHalfPK2CK;
+
+template <class MaterialType, typename... Parameters>
+class Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>
+    : public BaseIntegration1stHalfCK<MaterialType, Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = BaseIntegration1stHalfCK<MaterialType, Interaction<Inner<Parameters...>>>;
+    using ConstituteKernel = typename MaterialType::ConstituteKernel;
+
+  public:
+    explicit Integration1stHalfPK2CK(Inner<Parameters...> &inner_relation);
+    virtual ~Integration1stHalfPK2CK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ConstituteKernel constitute_;
+        Real rho0_;
+        Real *rho_;
+        Vecd *pos_, *vel_;
+        Matd *B_, *F_, *dF_dt_, *stress_PK1_B_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ConstituteKernel constitute_;
+        Real inv_rho0_, smoothing_length_, numerical_dissipation_factor_, inv_W0_;
+        Real *Vol_, *mass_;
+        Vecd *pos_, *vel_, *force_;
+        Matd *F_, *stress_PK1_B_;
+    };
+
+    using UpdateKernel = typename BaseInteraction::UpdateKernel;
+
+  protected:
+    DiscreteVariable<Matd> *dv_stress_PK1_B_;
+    Real numerical_dissipation_factor_;
+};
+
+/**
+ * @class DecomposedIntegration1stHalfCK
+ * @brief Decompose the stress into particle stress includes isotropic stress
+ * and the stress due to non-homogeneous material properties,
+ * see DecomposedIntegration1stHalf.
+ */
+/** The prior forces given by InlineForce are evaluated in the update kernel. */
+template <class MaterialType, class... InlineForceTypes, typename... Parameters>
+class Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, InlineForce<InlineForceTypes...>, Parameters...>>
+    : public Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>,
+      public InlineForce<InlineForceTypes...>
+{
+    using BaseDynamicsType = Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>;
+    using InlineForceKernel = typename InlineForce<InlineForceTypes...>::ComputingKernel;
+
+  public:
+    Integration1stHalfPK2CK(Inner<Parameters...> &inner_relation, InlineForceTypes &...inline_forces);
+    explicit Integration1stHalfPK2CK(const std::tuple<Inner<Parameters...> &, InlineForceTypes &...> &parameter_set);
+    virtual ~Integration1stHalfPK2CK() {};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        InlineForceKernel inline_force_;
+    };
+};
+
+template <typename...>
+class DecomposedIntegration1stHalfCK;
+
+template <class MaterialType, typename... Parameters>
+class DecomposedIntegration1stHalfCK<Inner<OneLevel, MaterialType, Parameters...>>
+    : public BaseIntegration1stHalfCK<MaterialType, Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = BaseIntegration1stHalfCK<MaterialType, Interaction<Inner<Parameters...>>>;
+    using ConstituteKernel = typename MaterialType::ConstituteKernel;
+
+  public:
+    explicit DecomposedIntegration1stHalfCK(Inner<Parameters...> &inner_relation);
+    virtual ~DecomposedIntegration1stHalfCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ConstituteKernel constitute_;
+        Real rho0_, smoothing_length_, correction_factor_;
+        Real *rho_, *J_to_minus_2_over_dimension_;
+        Vecd *pos_, *vel_;
+        Matd *F_, *dF_dt_, *stress_on_particle_, *inverse_F_T_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real inv_rho0_, shear_modulus_, correction_factor_;
+        Real *Vol_, *mass_, *J_to_minus_2_over_dimension_;
+        Vecd *pos_, *force_;
+        Matd *stress_on_particle_;
+    };
+
+    using UpdateKernel = typename BaseInteraction::UpdateKernel;
+
+  protected:
+    DiscreteVariable<Real> *dv_J_to_minus_2_over_dimension_;
+    DiscreteVariable<Matd> *dv_stress_on_particle_, *dv_inverse_F_T_;
+    const Real correction_factor_ = 1.07;
+};
+
+template <typename...>
+class Integration2ndHalfCK;
+
+template <typename... Parameters>
+class Integration2ndHalfCK<Inner<OneLevel, Parameters...>>
+    : public ElasticIntegrationCK<Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = ElasticIntegrationCK<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit Integration2ndHalfCK(Inner<Parameters...> &inner_relation)
+        : BaseInteraction(inner_relation) {};
+    virtual ~Integration2ndHalfCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Vecd *pos_, *vel_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *Vol_;
+        Vecd *vel_;
+        Matd *B_, *dF_dt_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Matd *F_, *dF_dt_;
+    };
+};
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // ELASTIC_DYNAMICS_CK_H
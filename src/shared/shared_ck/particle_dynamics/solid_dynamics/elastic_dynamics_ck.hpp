@@ -0,0 +1,314 @@
+#ifndef ELASTIC_DYNAMICS_CK_HPP
+#define ELASTIC_DYNAMICS_CK_HPP
+
+#include "elastic_dynamics_ck.h"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+//=================================================================================================//
+template <typename... Parameters>
+ElasticIntegrationCK<Interaction<Inner<Parameters...>>>::
+    ElasticIntegrationCK(Inner<Parameters...> &inner_relation)
+    : Interaction<Inner<Parameters...>>(inner_relation),
+      dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
+      dv_vel_(this->particles_->template registerStateVariable<Vecd>("Velocity")),
+      dv_force_(this->particles_->template registerStateVariable<Vecd>("Force")),
+      dv_B_(this->particles_->template registerStateVariable<Matd>(
+          "LinearCorrectionMatrix", IdentityMatrix<Matd>::value)),
+      dv_F_(this->particles_->template registerStateVariable<Matd>(
+          "DeformationGradient", IdentityMatrix<Matd>::value)),
+      dv_dF_dt_(this->particles_->template registerStateVariable<Matd>("DeformationRate"))
+{
+    this->particles_->template addEvolvingVariable<Vecd>("Velocity");
+    this->particles_->template addEvolvingVariable<Matd>("DeformationGradient");
+    this->particles_->template addVariableToWrite<Vecd>("Velocity");
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+DeformationGradientBySummationCK<Inner<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void DeformationGradientBySummationCK<Inner<Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Matd deformation = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd gradW_ijV_j = this->dW_ij(index_i, index_j, n) * Vol_[index_j] * this->e_ij(index_i, index_j, n);
+        deformation -= (pos_[index_i] - pos_[index_j]) * gradW_ijV_j.transpose();
+    }
+    F_[index_i] = deformation * B_[index_i];
+}
+//=================================================================================================//
+template <class MaterialType, class BaseInteractionType>
+template <class DynamicsIdentifier>
+BaseIntegration1stHalfCK<MaterialType, BaseInteractionType>::
+    BaseIntegration1stHalfCK(DynamicsIdentifier &identifier)
+    : ElasticIntegrationCK<BaseInteractionType>(identifier),
+      material_(DynamicCast<MaterialType>(this, this->sph_body_->getBaseMaterial())),
+      rho0_(material_.ReferenceDensity()), inv_rho0_(1.0 / rho0_),
+      smoothing_length_(this->sph_adaptation_->ReferenceSmoothingLength()),
+      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_force_prior_(this->particles_->template registerStateVariable<Vecd>("ForcePrior"))
+{
+    this->particles_->template addEvolvingVariable<Vecd>("ForcePrior");
+    this->particles_->template addEvolvingVariable<Vecd>("Force");
+    this->particles_->template addEvolvingVariable<Real>("Density");
+}
+//=================================================================================================//
+template <class MaterialType, class BaseInteractionType>
+template <class ExecutionPolicy, class EncloserType>
+BaseIntegration1stHalfCK<MaterialType, BaseInteractionType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, class BaseInteractionType>
+void BaseIntegration1stHalfCK<MaterialType, BaseInteractionType>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    vel_[index_i] += (force_prior_[index_i] + force_[index_i]) / mass_[index_i] * dt;
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::
+    Integration1stHalfPK2CK(Inner<Parameters...> &inner_relation)
+    : BaseInteraction(inner_relation),
+      dv_stress_PK1_B_(this->particles_->template registerStateVariable<Matd>("StressPK1OnParticle")),
+      numerical_dissipation_factor_(0.25) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : constitute_(encloser.material_), rho0_(encloser.rho0_),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      stress_PK1_B_(encloser.dv_stress_PK1_B_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+    rho_[index_i] = rho0_ / F_[index_i].determinant();
+    // obtain the first Piola-Kirchhoff stress from the second Piola-Kirchhoff stress
+    stress_PK1_B_[index_i] = constitute_.StressPK1(F_[index_i]) * B_[index_i].transpose();
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      constitute_(encloser.material_), inv_rho0_(encloser.inv_rho0_),
+      smoothing_length_(encloser.smoothing_length_),
+      numerical_dissipation_factor_(encloser.numerical_dissipation_factor_),
+      inv_W0_(1.0 / encloser.sph_adaptation_->getKernel()->W0(ZeroVecd)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      stress_PK1_B_(encloser.dv_stress_PK1_B_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    // including gravity and force from fluid
+    Vecd force = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd e_ij = this->e_ij(index_i, index_j, n);
+        Real dim_r_ij_1 = Dimensions / this->vec_r_ij(index_i, index_j, n).norm();
+        Vecd pos_jump = pos_[index_i] - pos_[index_j];
+        Vecd vel_jump = vel_[index_i] - vel_[index_j];
+        Real strain_rate = dim_r_ij_1 * dim_r_ij_1 * pos_jump.dot(vel_jump);
+        Real weight = this->W_ij(index_i, index_j, n) * inv_W0_;
+        Matd numerical_stress_ij =
+            0.5 * (F_[index_i] + F_[index_j]) * constitute_.PairNumericalDamping(strain_rate, smoothing_length_);
+        force += mass_[index_i] * inv_rho0_ * this->dW_ij(index_i, index_j, n) * Vol_[index_j] *
+                 (stress_PK1_B_[index_i] + stress_PK1_B_[index_j] +
+                  numerical_dissipation_factor_ * weight * numerical_stress_ij) *
+                 e_ij;
+    }
+    force_[index_i] = force;
+}
+//=================================================================================================//
+template <class MaterialType, class... InlineForceTypes, typename... Parameters>
+Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, InlineForce<InlineForceTypes...>, Parameters...>>::
+    Integration1stHalfPK2CK(Inner<Parameters...> &inner_relation, InlineForceTypes &...inline_forces)
+    : BaseDynamicsType(inner_relation), InlineForce<InlineForceTypes...>(inline_forces...) {}
+//=================================================================================================//
+template <class MaterialType, class... InlineForceTypes, typename... Parameters>
+Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, InlineForce<InlineForceTypes...>, Parameters...>>::
+    Integration1stHalfPK2CK(const std::tuple<Inner<Parameters...> &, InlineForceTypes &...> &parameter_set)
+    : BaseDynamicsType(std::get<0>(parameter_set)), InlineForce<InlineForceTypes...>(parameter_set) {}
+//=================================================================================================//
+template <class MaterialType, class... InlineForceTypes, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, InlineForce<InlineForceTypes...>, Parameters...>>::
+    UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseDynamicsType::UpdateKernel(ex_policy, encloser), inline_force_(ex_policy, encloser) {}
+//=================================================================================================//
+template <class MaterialType, class... InlineForceTypes, typename... Parameters>
+void Integration1stHalfPK2CK<Inner<OneLevel, MaterialType, InlineForce<InlineForceTypes...>, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    this->vel_[index_i] += (this->force_prior_[index_i] + this->force_[index_i] + inline_force_(index_i)) /
+                           this->mass_[index_i] * dt;
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+DecomposedIntegration1stHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    DecomposedIntegration1stHalfCK(Inner<Parameters...> &inner_relation)
+    : BaseInteraction(inner_relation),
+      dv_J_to_minus_2_over_dimension_(
+          this->particles_->template registerStateVariable<Real>("DeterminantTerm")),
+      dv_stress_on_particle_(this->particles_->template registerStateVariable<Matd>("StressOnParticle")),
+      dv_inverse_F_T_(this->particles_->template registerStateVariable<Matd>("InverseTransposedDeformation")) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+DecomposedIntegration1stHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : constitute_(encloser.material_), rho0_(encloser.rho0_),
+      smoothing_length_(encloser.smoothing_length_),
+      correction_factor_(encloser.correction_factor_),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      J_to_minus_2_over_dimension_(encloser.dv_J_to_minus_2_over_dimension_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      stress_on_particle_(encloser.dv_stress_on_particle_->DelegatedData(ex_policy)),
+      inverse_F_T_(encloser.dv_inverse_F_T_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void DecomposedIntegration1stHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+    Real J = F_[index_i].determinant();
+    Real one_over_J = 1.0 / J;
+    rho_[index_i] = rho0_ * one_over_J;
+    J_to_minus_2_over_dimension_[index_i] = math::pow(one_over_J * one_over_J, OneOverDimensions);
+
+    inverse_F_T_[index_i] = small_matrix::inverse(F_[index_i]).transpose();
+    stress_on_particle_[index_i] =
+        inverse_F_T_[index_i] * (constitute_.VolumetricKirchhoff(J) -
+                                 correction_factor_ * constitute_.ShearModulus() * J_to_minus_2_over_dimension_[index_i] *
+                                     (F_[index_i] * F_[index_i].transpose()).trace() * OneOverDimensions) +
+        constitute_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_) * inverse_F_T_[index_i];
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+DecomposedIntegration1stHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      inv_rho0_(encloser.inv_rho0_), shear_modulus_(encloser.material_.ShearModulus()),
+      correction_factor_(encloser.correction_factor_),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      J_to_minus_2_over_dimension_(encloser.dv_J_to_minus_2_over_dimension_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      stress_on_particle_(encloser.dv_stress_on_particle_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void DecomposedIntegration1stHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    // including gravity and force from fluid
+    Vecd force = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd r_ij = this->vec_r_ij(index_i, index_j, n);
+        Vecd shear_force_ij = correction_factor_ * shear_modulus_ *
+                              (J_to_minus_2_over_dimension_[index_i] + J_to_minus_2_over_dimension_[index_j]) *
+                              (pos_[index_i] - pos_[index_j]) / r_ij.norm();
+        force += mass_[index_i] * ((stress_on_particle_[index_i] + stress_on_particle_[index_j]) * r_ij.normalized() + shear_force_ij) *
+                 this->dW_ij(index_i, index_j, n) * Vol_[index_j] * inv_rho0_;
+    }
+    force_[index_i] = force;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Matd deformation_gradient_change_rate = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd gradW_ij = this->dW_ij(index_i, index_j, n) * Vol_[index_j] * this->e_ij(index_i, index_j, n);
+        deformation_gradient_change_rate -= (vel_[index_i] - vel_[index_j]) * gradW_ij.transpose();
+    }
+    dF_dt_[index_i] = deformation_gradient_change_rate * B_[index_i];
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // ELASTIC_DYNAMICS_CK_HPP
@@ -0,0 +1,24 @@
+#include "thin_structure_dynamics_ck.h"
+
+namespace SPH
+{
+namespace thin_structure_dynamics
+{
+//=================================================================================================//
+UpdateShellNormalDirectionCK::UpdateShellNormalDirectionCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body),
+      dv_n_(particles_->getVariableByName<Vecd>("NormalDirection")),
+      dv_n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
+      dv_F_(particles_->getVariableByName<Matd>("DeformationGradient")) {}
+//=================================================================================================//
+ShellCurvatureUpdateCK::ShellCurvatureUpdateCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body),
+      dv_n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
+      dv_F_(particles_->getVariableByName<Matd>("DeformationGradient")),
+      dv_F_bending_(particles_->getVariableByName<Matd>("BendingDeformationGradient")),
+      dv_dn_0_(particles_->registerStateVariable<Matd>("InitialNormalGradient")),
+      dv_k1_(particles_->registerStateVariable<Real>("1stPrincipleCurvature")),
+      dv_k2_(particles_->registerStateVariable<Real>("2ndPrincipleCurvature")) {}
+//=================================================================================================//
+} // namespace thin_structure_dynamics
+} // namespace SPH
@@ -0,0 +1,333 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	thin_structure_dynamics_ck.h
+ * @brief 	Here, we define the shell dynamics on the computing kernels.
+ * @details The formulations follow those in thin_structure_dynamics.h.
+ * 			The inner relation should be built on the initial configuration,
+ * 			i.e. with ConfigType::Lagrangian, and the material type of the
+ * 			stress relaxation is given as template parameter.
+ * @author	Dong Wu, Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef THIN_STRUCTURE_DYNAMICS_CK_H
+#define THIN_STRUCTURE_DYNAMICS_CK_H
+
+#include "base_general_dynamics.h"
+#include "elastic_solid.h"
+#include "interaction_ck.hpp"
+#include "thin_structure_math.h"
+
+namespace SPH
+{
+namespace thin_structure_dynamics
+{
+template <typename...>
+class ShellCorrectConfigurationCK;
+
+template <typename... Parameters>
+class ShellCorrectConfigurationCK<Inner<Parameters...>>
+    : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit ShellCorrectConfigurationCK(Inner<Parameters...> &inner_relation);
+    virtual ~ShellCorrectConfigurationCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *Vol_;
+        Vecd *n0_;
+        Matd *B_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_n0_;
+    DiscreteVariable<Matd> *dv_B_;
+};
+
+template <typename...>
+class ShellIntegrationCK;
+
+template <typename... Parameters>
+class ShellIntegrationCK<Interaction<Inner<Parameters...>>>
+    : public Interaction<Inner<Parameters...>>
+{
+  public:
+    explicit ShellIntegrationCK(Inner<Parameters...> &inner_relation);
+    virtual ~ShellIntegrationCK() {};
+
+  protected:
+    DiscreteVariable<Real> *dv_thickness_;
+    DiscreteVariable<Vecd> *dv_pos_, *dv_vel_, *dv_force_;
+    DiscreteVariable<Vecd> *dv_n0_, *dv_pseudo_n_, *dv_dpseudo_n_dt_, *dv_dpseudo_n_d2t_;
+    DiscreteVariable<Vecd> *dv_rotation_, *dv_angular_vel_, *dv_dangular_vel_dt_;
+    DiscreteVariable<Matd> *dv_B_;
+    DiscreteVariable<Matd> *dv_F_, *dv_dF_dt_, *dv_F_bending_, *dv_dF_bending_dt_;
+};
+
+template <typename...>
+class ShellDeformationGradientTensorCK;
+
+template <typename... Parameters>
+class ShellDeformationGradientTensorCK<Inner<Parameters...>>
+    : public ShellIntegrationCK<Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = ShellIntegrationCK<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit ShellDeformationGradientTensorCK(Inner<Parameters...> &inner_relation)
+        : BaseInteraction(inner_relation) {};
+    virtual ~ShellDeformationGradientTensorCK() {};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *Vol_;
+        Vecd *pos_, *pseudo_n_, *n0_;
+        Matd *B_, *F_, *F_bending_;
+    };
+};
+
+/**
+ * @class ShellStressRelaxationFirstHalfCK
+ * @brief The first half of the shell stress relaxation, see ShellStressRelaxationFirstHalf.
+ * Only the one-, three- and five-point Gaussian quadrature rules along the thickness are defined.
+ */
+template <typename...>
+class ShellStressRelaxationFirstHalfCK;
+
+template <class MaterialType, typename... Parameters>
+class ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>
+    : public ShellIntegrationCK<Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = ShellIntegrationCK<Interaction<Inner<Parameters...>>>;
+    using ConstituteKernel = typename MaterialType::ConstituteKernel;
+    static constexpr UnsignedInt MaxGaussianPoints = 5;
+    using GaussianArray = std::array<Real, MaxGaussianPoints>;
+
+  public:
+    explicit ShellStressRelaxationFirstHalfCK(Inner<Parameters...> &inner_relation,
+                                              UnsignedInt number_of_gaussian_points = 3,
+                                              bool hourglass_control = false,
+                                              Real hourglass_control_factor = 0.002);
+    virtual ~ShellStressRelaxationFirstHalfCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ConstituteKernel constitute_;
+        Real rho0_, smoothing_length_, nu_, shear_correction_factor_;
+        UnsignedInt number_of_gaussian_points_;
+        GaussianArray gaussian_point_, gaussian_weight_;
+        Real *rho_, *thickness_;
+        Vecd *pos_, *vel_, *pseudo_n_, *dpseudo_n_dt_, *rotation_, *angular_vel_, *global_shear_stress_, *n0_;
+        Matd *F_, *dF_dt_, *F_bending_, *dF_bending_dt_;
+        Matd *global_F_, *global_F_bending_, *global_stress_, *global_moment_, *mid_surface_cauchy_stress_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        bool hourglass_control_;
+        Real inv_rho0_, G0_, hourglass_control_factor_, inv_W0_;
+        Real *Vol_, *mass_, *thickness_;
+        Vecd *pos_, *n0_, *pseudo_n_, *rotation_, *angular_vel_;
+        Vecd *force_, *dpseudo_n_d2t_, *dangular_vel_dt_, *global_shear_stress_;
+        Matd *global_F_, *global_F_bending_, *global_stress_, *global_moment_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *mass_;
+        Vecd *vel_, *force_, *force_prior_, *angular_vel_, *dangular_vel_dt_;
+    };
+
+  protected:
+    MaterialType &material_;
+    Real rho0_, inv_rho0_, smoothing_length_, nu_, G0_;
+    UnsignedInt number_of_gaussian_points_;
+    bool hourglass_control_;
+    Real hourglass_control_factor_;
+    GaussianArray gaussian_point_, gaussian_weight_;
+    DiscreteVariable<Real> *dv_rho_, *dv_mass_;
+    DiscreteVariable<Vecd> *dv_force_prior_, *dv_global_shear_stress_;
+    DiscreteVariable<Matd> *dv_global_stress_, *dv_global_moment_, *dv_mid_surface_cauchy_stress_;
+    DiscreteVariable<Matd> *dv_global_F_, *dv_global_F_bending_;
+    const Real shear_correction_factor_ = 5.0 / 6.0;
+};
+
+template <typename...>
+class ShellStressRelaxationSecondHalfCK;
+
+template <typename... Parameters>
+class ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>
+    : public ShellIntegrationCK<Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = ShellIntegrationCK<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit ShellStressRelaxationSecondHalfCK(Inner<Parameters...> &inner_relation)
+        : BaseInteraction(inner_relation) {};
+    virtual ~ShellStressRelaxationSecondHalfCK() {};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Vecd *pos_, *vel_, *pseudo_n_, *dpseudo_n_dt_, *rotation_, *angular_vel_, *n0_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *Vol_;
+        Vecd *vel_, *dpseudo_n_dt_, *n0_;
+        Matd *B_, *dF_dt_, *dF_bending_dt_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Matd *F_, *dF_dt_, *F_bending_, *dF_bending_dt_;
+    };
+};
+
+class UpdateShellNormalDirectionCK : public LocalDynamics
+{
+  public:
+    explicit UpdateShellNormalDirectionCK(SPHBody &sph_body);
+    virtual ~UpdateShellNormalDirectionCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : n_(encloser.dv_n_->DelegatedData(ex_policy)),
+              n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+              F_(encloser.dv_F_->DelegatedData(ex_policy)){};
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            n_[index_i] = getTransformationMatrix(n0_[index_i]).transpose() *
+                          getNormalFromDeformationGradientTensor(F_[index_i]);
+        };
+
+      protected:
+        Vecd *n_, *n0_;
+        Matd *F_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_n_, *dv_n0_;
+    DiscreteVariable<Matd> *dv_F_;
+};
+
+/**
+ * @class ShellCurvatureUpdateCK
+ * @brief Update shell curvature during deformation, see ShellCurvatureUpdate.
+ * The initial normal gradient is obtained by InitialShellCurvature.
+ */
+class ShellCurvatureUpdateCK : public LocalDynamics
+{
+  public:
+    explicit ShellCurvatureUpdateCK(SPHBody &sph_body);
+    virtual ~ShellCurvatureUpdateCK() {};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+              F_(encloser.dv_F_->DelegatedData(ex_policy)),
+              F_bending_(encloser.dv_F_bending_->DelegatedData(ex_policy)),
+              dn_0_(encloser.dv_dn_0_->DelegatedData(ex_policy)),
+              k1_(encloser.dv_k1_->DelegatedData(ex_policy)),
+              k2_(encloser.dv_k2_->DelegatedData(ex_policy)){};
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            const Matd transformation_matrix_i = getTransformationMatrix(n0_[index_i]);
+            Matd dn_0_i = dn_0_[index_i] + transformation_matrix_i.transpose() * F_bending_[index_i] * transformation_matrix_i;
+            Matd dn_i = dn_0_i * transformation_matrix_i.transpose() * small_matrix::inverse(F_[index_i]) * transformation_matrix_i;
+            auto [k1, k2] = get_principle_curvatures(dn_i);
+            k1_[index_i] = k1;
+            k2_[index_i] = k2;
+        };
+
+      protected:
+        Vecd *n0_;
+        Matd *F_, *F_bending_, *dn_0_;
+        Real *k1_, *k2_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_n0_;
+    DiscreteVariable<Matd> *dv_F_, *dv_F_bending_, *dv_dn_0_;
+    DiscreteVariable<Real> *dv_k1_, *dv_k2_;
+};
+} // namespace thin_structure_dynamics
+} // namespace SPH
+#endif // THIN_STRUCTURE_DYNAMICS_CK_H
@@ -0,0 +1,434 @@
+#ifndef THIN_STRUCTURE_DYNAMICS_CK_HPP
+#define THIN_STRUCTURE_DYNAMICS_CK_HPP
+
+#include "thin_structure_dynamics_ck.h"
+
+namespace SPH
+{
+namespace thin_structure_dynamics
+{
+//=================================================================================================//
+template <typename... Parameters>
+ShellCorrectConfigurationCK<Inner<Parameters...>>::
+    ShellCorrectConfigurationCK(Inner<Parameters...> &inner_relation)
+    : BaseInteraction(inner_relation),
+      dv_n0_(this->particles_->template registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
+      dv_B_(this->particles_->template registerStateVariable<Matd>(
+          "LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellCorrectConfigurationCK<Inner<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ShellCorrectConfigurationCK<Inner<Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    /** A small number is added to diagonal to avoid dividing by zero. */
+    Matd global_configuration = Eps * Matd::Identity();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd gradW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
+        global_configuration -= this->vec_r_ij(index_i, index_j) * gradW_ijV_j.transpose();
+    }
+    const Matd transformation_matrix_i = getTransformationMatrix(n0_[index_i]);
+    Matd local_configuration =
+        transformation_matrix_i * global_configuration * transformation_matrix_i.transpose();
+    /** correction matrix is obtained from local configuration. */
+    B_[index_i] = getCorrectionMatrix(local_configuration);
+}
+//=================================================================================================//
+template <typename... Parameters>
+ShellIntegrationCK<Interaction<Inner<Parameters...>>>::
+    ShellIntegrationCK(Inner<Parameters...> &inner_relation)
+    : Interaction<Inner<Parameters...>>(inner_relation),
+      dv_thickness_(this->particles_->template getVariableByName<Real>("Thickness")),
+      dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
+      dv_vel_(this->particles_->template registerStateVariable<Vecd>("Velocity")),
+      dv_force_(this->particles_->template registerStateVariable<Vecd>("Force")),
+      dv_n0_(this->particles_->template registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
+      dv_pseudo_n_(this->particles_->template registerStateVariableFrom<Vecd>("PseudoNormal", "NormalDirection")),
+      dv_dpseudo_n_dt_(this->particles_->template registerStateVariable<Vecd>("PseudoNormalChangeRate")),
+      dv_dpseudo_n_d2t_(this->particles_->template registerStateVariable<Vecd>("PseudoNormal2ndOrderTimeDerivative")),
+      dv_rotation_(this->particles_->template registerStateVariable<Vecd>("Rotation")),
+      dv_angular_vel_(this->particles_->template registerStateVariable<Vecd>("AngularVelocity")),
+      dv_dangular_vel_dt_(this->particles_->template registerStateVariable<Vecd>("AngularAcceleration")),
+      dv_B_(this->particles_->template registerStateVariable<Matd>(
+          "LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)),
+      dv_F_(this->particles_->template registerStateVariable<Matd>(
+          "DeformationGradient", IdentityMatrix<Matd>::value)),
+      dv_dF_dt_(this->particles_->template registerStateVariable<Matd>("DeformationRate")),
+      dv_F_bending_(this->particles_->template registerStateVariable<Matd>("BendingDeformationGradient")),
+      dv_dF_bending_dt_(this->particles_->template registerStateVariable<Matd>("BendingDeformationRate"))
+{
+    this->particles_->template addEvolvingVariable<Vecd>("Velocity");
+    this->particles_->template addEvolvingVariable<Vecd>("PseudoNormal");
+    this->particles_->template addEvolvingVariable<Vecd>("Rotation");
+    this->particles_->template addEvolvingVariable<Vecd>("AngularVelocity");
+    this->particles_->template addEvolvingVariable<Matd>("DeformationGradient");
+    this->particles_->template addEvolvingVariable<Matd>("BendingDeformationGradient");
+    this->particles_->template addVariableToWrite<Vecd>("Velocity");
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellDeformationGradientTensorCK<Inner<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      pseudo_n_(encloser.dv_pseudo_n_->DelegatedData(ex_policy)),
+      n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      F_bending_(encloser.dv_F_bending_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ShellDeformationGradientTensorCK<Inner<Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    const Matd transformation_matrix_i = getTransformationMatrix(n0_[index_i]);
+    Matd deformation_part_one = Matd::Zero();
+    Matd deformation_part_two = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd gradW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
+        deformation_part_one -= (pos_[index_i] - pos_[index_j]) * gradW_ijV_j.transpose();
+        deformation_part_two -= ((pseudo_n_[index_i] - n0_[index_i]) - (pseudo_n_[index_j] - n0_[index_j])) *
+                                gradW_ijV_j.transpose();
+    }
+    F_[index_i] = transformation_matrix_i * deformation_part_one * transformation_matrix_i.transpose() * B_[index_i];
+    F_[index_i].col(Dimensions - 1) = transformation_matrix_i * pseudo_n_[index_i];
+    F_bending_[index_i] = transformation_matrix_i * deformation_part_two * transformation_matrix_i.transpose() * B_[index_i];
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    ShellStressRelaxationFirstHalfCK(Inner<Parameters...> &inner_relation,
+                                     UnsignedInt number_of_gaussian_points,
+                                     bool hourglass_control, Real hourglass_control_factor)
+    : BaseInteraction(inner_relation),
+      material_(DynamicCast<MaterialType>(this, this->sph_body_->getBaseMaterial())),
+      rho0_(material_.ReferenceDensity()), inv_rho0_(1.0 / rho0_),
+      smoothing_length_(this->sph_adaptation_->ReferenceSmoothingLength()),
+      nu_(material_.PoissonRatio()), G0_(material_.ShearModulus()),
+      number_of_gaussian_points_(number_of_gaussian_points),
+      hourglass_control_(hourglass_control),
+      hourglass_control_factor_(hourglass_control_factor),
+      gaussian_point_{}, gaussian_weight_{},
+      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_force_prior_(this->particles_->template registerStateVariable<Vecd>("ForcePrior")),
+      dv_global_shear_stress_(this->particles_->template registerStateVariable<Vecd>("GlobalShearStress")),
+      dv_global_stress_(this->particles_->template registerStateVariable<Matd>("GlobalStress")),
+      dv_global_moment_(this->particles_->template registerStateVariable<Matd>("GlobalMoment")),
+      dv_mid_surface_cauchy_stress_(this->particles_->template registerStateVariable<Matd>("MidSurfaceCauchyStress")),
+      dv_global_F_(this->particles_->template registerStateVariable<Matd>("GlobalDeformationGradient")),
+      dv_global_F_bending_(this->particles_->template registerStateVariable<Matd>("GlobalBendingDeformationGradient"))
+{
+    this->particles_->template addEvolvingVariable<Vecd>("ForcePrior");
+    this->particles_->template addEvolvingVariable<Vecd>("Force");
+    this->particles_->template addEvolvingVariable<Real>("Density");
+
+    /** Note that, only one-point, three-point and five-point Gaussian quadrature rules are defined. */
+    switch (number_of_gaussian_points)
+    {
+    case 1:
+        gaussian_point_ = {0.0};
+        gaussian_weight_ = {2.0};
+        break;
+    case 5:
+        gaussian_point_ = {0.0, 0.5384693101056831, -0.5384693101056831, 0.9061798459386640, -0.9061798459386640};
+        gaussian_weight_ = {0.5688888888888889, 0.4786286704993665, 0.4786286704993665, 0.2369268850561891, 0.2369268850561891};
+        break;
+    default:
+        number_of_gaussian_points_ = 3;
+        gaussian_point_ = {0.0, 0.7745966692414834, -0.7745966692414834};
+        gaussian_weight_ = {0.8888888888888889, 0.5555555555555556, 0.5555555555555556};
+    }
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : constitute_(encloser.material_), rho0_(encloser.rho0_),
+      smoothing_length_(encloser.smoothing_length_), nu_(encloser.nu_),
+      shear_correction_factor_(encloser.shear_correction_factor_),
+      number_of_gaussian_points_(encloser.number_of_gaussian_points_),
+      gaussian_point_(encloser.gaussian_point_), gaussian_weight_(encloser.gaussian_weight_),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      thickness_(encloser.dv_thickness_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      pseudo_n_(encloser.dv_pseudo_n_->DelegatedData(ex_policy)),
+      dpseudo_n_dt_(encloser.dv_dpseudo_n_dt_->DelegatedData(ex_policy)),
+      rotation_(encloser.dv_rotation_->DelegatedData(ex_policy)),
+      angular_vel_(encloser.dv_angular_vel_->DelegatedData(ex_policy)),
+      global_shear_stress_(encloser.dv_global_shear_stress_->DelegatedData(ex_policy)),
+      n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      F_bending_(encloser.dv_F_bending_->DelegatedData(ex_policy)),
+      dF_bending_dt_(encloser.dv_dF_bending_dt_->DelegatedData(ex_policy)),
+      global_F_(encloser.dv_global_F_->DelegatedData(ex_policy)),
+      global_F_bending_(encloser.dv_global_F_bending_->DelegatedData(ex_policy)),
+      global_stress_(encloser.dv_global_stress_->DelegatedData(ex_policy)),
+      global_moment_(encloser.dv_global_moment_->DelegatedData(ex_policy)),
+      mid_surface_cauchy_stress_(encloser.dv_mid_surface_cauchy_stress_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    // Note that F_, F_bending_, dF_dt_, dF_bending_dt_, rotation_, angular_vel_ and B_
+    // are defined in local coordinates, while others in global coordinates.
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+    rotation_[index_i] += angular_vel_[index_i] * dt * 0.5;
+    pseudo_n_[index_i] += dpseudo_n_dt_[index_i] * dt * 0.5;
+
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+    F_bending_[index_i] += dF_bending_dt_[index_i] * dt * 0.5;
+
+    const Matd transformation_matrix_i = getTransformationMatrix(n0_[index_i]);
+    global_F_[index_i] = transformation_matrix_i.transpose() * F_[index_i] * transformation_matrix_i;
+    global_F_bending_[index_i] = transformation_matrix_i.transpose() * F_bending_[index_i] * transformation_matrix_i;
+
+    Real J = F_[index_i].determinant();
+    Matd inverse_transpose_global_F = small_matrix::inverse(global_F_[index_i]).transpose();
+    rho_[index_i] = rho0_ / J;
+
+    /** Get transformation matrix from global coordinates to current local coordinates. */
+    Matd current_transformation_matrix = getTransformationMatrix(pseudo_n_[index_i]);
+    /** Get transformation matrix from initial local coordinates to current local coordinates. */
+    Matd transformation_matrix_0_to_current = current_transformation_matrix * transformation_matrix_i.transpose();
+
+    /** correct out-plane numerical damping. */
+    Matd numerical_damping_scaling = Matd::Identity() * smoothing_length_;
+    numerical_damping_scaling(Dimensions - 1, Dimensions - 1) = SMIN(thickness_[index_i], smoothing_length_);
+
+    Matd resultant_stress = Matd::Zero();
+    Matd resultant_moment = Matd::Zero();
+    Vecd resultant_shear_stress = Vecd::Zero();
+    for (UnsignedInt i = 0; i != number_of_gaussian_points_; ++i)
+    {
+        Real thickness_coordinate = gaussian_point_[i] * thickness_[index_i] * 0.5;
+        Matd F_gaussian_point = F_[index_i] + thickness_coordinate * F_bending_[index_i];
+        Matd dF_gaussian_point_dt = dF_dt_[index_i] + thickness_coordinate * dF_bending_dt_[index_i];
+        Matd inverse_F_gaussian_point = small_matrix::inverse(F_gaussian_point);
+        Matd current_local_almansi_strain = transformation_matrix_0_to_current * 0.5 *
+                                            (Matd::Identity() - inverse_F_gaussian_point.transpose() * inverse_F_gaussian_point) *
+                                            transformation_matrix_0_to_current.transpose();
+
+        /** correct Almansi strain tensor according to plane stress problem. */
+        current_local_almansi_strain = getCorrectedAlmansiStrain(current_local_almansi_strain, nu_);
+
+        Matd cauchy_stress = constitute_.StressCauchy(current_local_almansi_strain) +
+                             transformation_matrix_0_to_current * F_gaussian_point *
+                                 constitute_.NumericalDampingRightCauchy(F_gaussian_point, dF_gaussian_point_dt, numerical_damping_scaling) *
+                                 F_gaussian_point.transpose() * transformation_matrix_0_to_current.transpose() / F_gaussian_point.determinant();
+
+        /** Impose modeling assumptions. */
+        cauchy_stress.col(Dimensions - 1) *= shear_correction_factor_;
+        cauchy_stress.row(Dimensions - 1) *= shear_correction_factor_;
+        cauchy_stress(Dimensions - 1, Dimensions - 1) = 0.0;
+
+        if (i == 0)
+        {
+            mid_surface_cauchy_stress_[index_i] = cauchy_stress;
+        }
+
+        /** Integrate Cauchy stress along thickness. */
+        Real weight = 0.5 * thickness_[index_i] * gaussian_weight_[i];
+        resultant_stress += weight * cauchy_stress;
+        resultant_moment += weight * cauchy_stress * thickness_coordinate;
+        resultant_shear_stress -= weight * cauchy_stress.col(Dimensions - 1);
+
+        resultant_stress.col(Dimensions - 1) = Vecd::Zero();
+        resultant_moment.col(Dimensions - 1) = Vecd::Zero();
+    }
+
+    /** stress and moment in global coordinates for pair interaction */
+    global_stress_[index_i] = J * current_transformation_matrix.transpose() *
+                              resultant_stress * current_transformation_matrix * inverse_transpose_global_F;
+    global_moment_[index_i] = J * current_transformation_matrix.transpose() *
+                              resultant_moment * current_transformation_matrix * inverse_transpose_global_F;
+    global_shear_stress_[index_i] = J * current_transformation_matrix.transpose() * resultant_shear_stress;
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      hourglass_control_(encloser.hourglass_control_),
+      inv_rho0_(encloser.inv_rho0_), G0_(encloser.G0_),
+      hourglass_control_factor_(encloser.hourglass_control_factor_),
+      inv_W0_(1.0 / encloser.sph_adaptation_->getKernel()->W0(ZeroVecd)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      thickness_(encloser.dv_thickness_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+      pseudo_n_(encloser.dv_pseudo_n_->DelegatedData(ex_policy)),
+      rotation_(encloser.dv_rotation_->DelegatedData(ex_policy)),
+      angular_vel_(encloser.dv_angular_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      dpseudo_n_d2t_(encloser.dv_dpseudo_n_d2t_->DelegatedData(ex_policy)),
+      dangular_vel_dt_(encloser.dv_dangular_vel_dt_->DelegatedData(ex_policy)),
+      global_shear_stress_(encloser.dv_global_shear_stress_->DelegatedData(ex_policy)),
+      global_F_(encloser.dv_global_F_->DelegatedData(ex_policy)),
+      global_F_bending_(encloser.dv_global_F_bending_->DelegatedData(ex_policy)),
+      global_stress_(encloser.dv_global_stress_->DelegatedData(ex_policy)),
+      global_moment_(encloser.dv_global_moment_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    const Real thickness_i = thickness_[index_i];
+    Vecd force = Vecd::Zero();
+    Vecd pseudo_normal_acceleration = global_shear_stress_[index_i];
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd e_ij = this->e_ij(index_i, index_j);
+        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
+
+        if (hourglass_control_)
+        {
+            Real r_ij = this->vec_r_ij(index_i, index_j).norm();
+            Real weight = this->W_ij(index_i, index_j) * inv_W0_;
+            Vecd pos_jump = getLinearVariableJump(e_ij, r_ij, pos_[index_i], global_F_[index_i],
+                                                  pos_[index_j], global_F_[index_j]);
+            Real limiter_pos = SMIN(2.0 * pos_jump.norm() / r_ij, 1.0);
+            force += mass_[index_i] * hourglass_control_factor_ * weight * G0_ * pos_jump * Dimensions *
+                     dW_ijV_j * limiter_pos;
+
+            Vecd pseudo_n_variation_i = pseudo_n_[index_i] - n0_[index_i];
+            Vecd pseudo_n_variation_j = pseudo_n_[index_j] - n0_[index_j];
+            Vecd pseudo_n_jump = getLinearVariableJump(e_ij, r_ij, pseudo_n_variation_i, global_F_bending_[index_i],
+                                                       pseudo_n_variation_j, global_F_bending_[index_j]);
+            Real limiter_pseudo_n = SMIN(
+                2.0 * pseudo_n_jump.norm() / ((pseudo_n_variation_i - pseudo_n_variation_j).norm() + Eps), 1.0);
+            pseudo_normal_acceleration += hourglass_control_factor_ * weight * G0_ * pseudo_n_jump * Dimensions *
+                                          dW_ijV_j * thickness_i * thickness_i * limiter_pseudo_n;
+        }
+
+        force += mass_[index_i] * (global_stress_[index_i] + global_stress_[index_j]) * dW_ijV_j * e_ij;
+        pseudo_normal_acceleration += (global_moment_[index_i] + global_moment_[index_j]) * dW_ijV_j * e_ij;
+    }
+
+    force_[index_i] = force * inv_rho0_ / thickness_i;
+    dpseudo_n_d2t_[index_i] = pseudo_normal_acceleration * inv_rho0_ * 12.0 / (thickness_i * thickness_i * thickness_i);
+
+    /** the relation between pseudo-normal and rotations */
+    Vecd local_dpseudo_n_d2t = getTransformationMatrix(n0_[index_i]) * dpseudo_n_d2t_[index_i];
+    dangular_vel_dt_[index_i] = getRotationFromPseudoNormal(local_dpseudo_n_d2t, rotation_[index_i], angular_vel_[index_i], dt);
+}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)),
+      angular_vel_(encloser.dv_angular_vel_->DelegatedData(ex_policy)),
+      dangular_vel_dt_(encloser.dv_dangular_vel_dt_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class MaterialType, typename... Parameters>
+void ShellStressRelaxationFirstHalfCK<Inner<OneLevel, MaterialType, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    vel_[index_i] += (force_prior_[index_i] + force_[index_i]) / mass_[index_i] * dt;
+    angular_vel_[index_i] += dangular_vel_dt_[index_i] * dt;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>::InitializeKernel::
+    InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      pseudo_n_(encloser.dv_pseudo_n_->DelegatedData(ex_policy)),
+      dpseudo_n_dt_(encloser.dv_dpseudo_n_dt_->DelegatedData(ex_policy)),
+      rotation_(encloser.dv_rotation_->DelegatedData(ex_policy)),
+      angular_vel_(encloser.dv_angular_vel_->DelegatedData(ex_policy)),
+      n0_(encloser.dv_n0_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+    rotation_[index_i] += angular_vel_[index_i] * dt * 0.5;
+    // the local pseudo normal in the initial configuration is the last unit vector
+    dpseudo_n_dt_[index_i] = getTransformationMatrix(n0_[index_i]).transpose() *
+                             getVectorChangeRateAfterThinStructureRotation(
+                                 Vecd::Unit(Dimensions - 1), rotation_[index_i], angular_vel_[index_i]);
+    pseudo_n_[index_i] += dpseudo_n_dt_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      dpseudo_n_dt_(encloser.dv_dpseudo_n_dt_->DelegatedData(ex_policy)),
+      n0_(encloser.dv_n0_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      dF_bending_dt_(encloser.dv_dF_bending_dt_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    const Matd transformation_matrix_i = getTransformationMatrix(n0_[index_i]);
+    Matd deformation_gradient_change_rate_part_one = Matd::Zero();
+    Matd deformation_gradient_change_rate_part_two = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); n += this->neighbor_stride_)
+    {
+        UnsignedInt index_j = this->neighbor_index_[n];
+        Vecd gradW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
+        deformation_gradient_change_rate_part_one -= (vel_[index_i] - vel_[index_j]) * gradW_ijV_j.transpose();
+        deformation_gradient_change_rate_part_two -= (dpseudo_n_dt_[index_i] - dpseudo_n_dt_[index_j]) * gradW_ijV_j.transpose();
+    }
+    dF_dt_[index_i] = transformation_matrix_i * deformation_gradient_change_rate_part_one *
+                      transformation_matrix_i.transpose() * B_[index_i];
+    dF_dt_[index_i].col(Dimensions - 1) = transformation_matrix_i * dpseudo_n_dt_[index_i];
+    dF_bending_dt_[index_i] = transformation_matrix_i * deformation_gradient_change_rate_part_two *
+                              transformation_matrix_i.transpose() * B_[index_i];
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      F_bending_(encloser.dv_F_bending_->DelegatedData(ex_policy)),
+      dF_bending_dt_(encloser.dv_dF_bending_dt_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void ShellStressRelaxationSecondHalfCK<Inner<OneLevel, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+    F_bending_[index_i] += dF_bending_dt_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
+} // namespace thin_structure_dynamics
+} // namespace SPH
+#endif // THIN_STRUCTURE_DYNAMICS_CK_HPP
@@ -5,8 +5,46 @@
 namespace SPH
 {
 //=================================================================================================//
+PredictiveTimeStep::PredictiveTimeStep(BaseDynamics<Real> &step_evaluator, UnsignedInt max_reuse_interval,
+                                       Real safety_factor, Real change_tolerance)
+    : BaseDynamics<Real>(), step_evaluator_(step_evaluator),
+      max_reuse_interval_(SMAX(max_reuse_interval, UnsignedInt(1))),
+      safety_factor_(safety_factor), change_tolerance_(change_tolerance),
+      reuse_interval_(1), steps_since_evaluation_(0), number_of_evaluations_(0),
+      is_evaluation_requested_(true), evaluated_dt_(0.0), dt_change_per_step_(0.0) {}
+//=================================================================================================//
+Real PredictiveTimeStep::exec(Real dt)
+{
+    if (is_evaluation_requested_ || steps_since_evaluation_ >= reuse_interval_)
+    {
+        Real new_dt = step_evaluator_.exec(dt);
+        if (number_of_evaluations_ != 0 && !is_evaluation_requested_)
+        {
+            Real relative_change = ABS(new_dt - evaluated_dt_) / SMAX(evaluated_dt_, TinyReal);
+            reuse_interval_ = relative_change < change_tolerance_
+                                  ? SMIN(2 * reuse_interval_, max_reuse_interval_)
+                                  : 1;
+            dt_change_per_step_ = SMIN(new_dt - evaluated_dt_, Real(0)) / Real(steps_since_evaluation_);
+        }
+        else
+        {
+            reuse_interval_ = 1;
+            dt_change_per_step_ = 0.0;
+        }
+        evaluated_dt_ = new_dt;
+        steps_since_evaluation_ = 1;
+        number_of_evaluations_++;
+        is_evaluation_requested_ = false;
+        return new_dt;
+    }
+
+    Real predicted_dt = evaluated_dt_ + dt_change_per_step_ * Real(steps_since_evaluation_);
+    steps_since_evaluation_++;
+    return safety_factor_ * SMAX(predicted_dt, 0.5 * evaluated_dt_);
+}
+//=================================================================================================//
 TimeStepper::TimeStepper(SPHSystem &sph_system, Real end_time, Real start_time)
-    : end_time_(end_time), global_dt_(0.0)
+    : end_time_(end_time), global_dt_(0.0), step_evaluation_interval_(1)
 {
     sv_physical_time_ = sph_system.getSystemVariableByName<Real>("PhysicalTime");
     sv_physical_time_->setValue(start_time);
@@ -64,6 +102,8 @@ Real TimeStepper::incrementPhysicalTime(Real global_time_step)
 {
     global_dt_ = global_time_step;
     sv_physical_time_->incrementValue(global_dt_);
+    DynamicsProfiler::get().incrementStep();
+    StartupProfiler::get().finishStartup();
     for (auto &interval_executor : interval_executers_)
     {
         interval_executor->incrementPresentTime(global_dt_);
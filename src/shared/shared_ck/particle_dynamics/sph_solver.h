@@ -34,6 +34,37 @@
 
 namespace SPH
 {
+/**
+ * @class PredictiveTimeStep
+ * @brief Reuse the step size of a reduction, e.g. the acoustic time step, for the sub-steps
+ * in which it is predicted to change little, so that one reduction per sub-step is saved.
+ * The step size is evaluated again after a reuse interval, which is doubled up to the given maximum
+ * while the relative change between evaluations is within the tolerance, and reset to one otherwise.
+ * In between, the step size extrapolated from the last two evaluations, if decreasing,
+ * reduced by the safety factor is taken. An evaluation can also be requested by a cheap bound,
+ * e.g. a large velocity change found by an integration kernel.
+ */
+class PredictiveTimeStep : public BaseDynamics<Real>
+{
+  public:
+    PredictiveTimeStep(BaseDynamics<Real> &step_evaluator, UnsignedInt max_reuse_interval = 8,
+                       Real safety_factor = 0.9, Real change_tolerance = 0.01);
+    virtual ~PredictiveTimeStep() {};
+    virtual Real exec(Real dt = 0.0) override;
+    void requestEvaluation() { is_evaluation_requested_ = true; };
+    UnsignedInt ReuseInterval() { return reuse_interval_; };
+    UnsignedInt NumberOfEvaluations() { return number_of_evaluations_; };
+
+  protected:
+    BaseDynamics<Real> &step_evaluator_;
+    UnsignedInt max_reuse_interval_;
+    Real safety_factor_, change_tolerance_;
+    UnsignedInt reuse_interval_, steps_since_evaluation_, number_of_evaluations_;
+    bool is_evaluation_requested_;
+    Real evaluated_dt_;
+    Real dt_change_per_step_; /**< negative or zero, from the last two evaluations */
+};
+
 class TimeStepper
 {
   public:
@@ -47,6 +78,15 @@ class TimeStepper
     Real getEndTime() { return end_time_; };
     Real incrementPhysicalTime(Real global_time_step);
     Real incrementPhysicalTime(BaseDynamics<Real> &step_evaluator);
+    /**
+     * The step size of the matched time interval is evaluated only every given number of sub-steps
+     * and kept in between, which saves the host synchronizations of the reductions on a device.
+     * The kept step size should be safe for these sub-steps, e.g. by a smaller CFL number.
+     */
+    void setStepEvaluationInterval(UnsignedInt step_evaluation_interval)
+    {
+        step_evaluation_interval_ = SMAX(step_evaluation_interval, UnsignedInt(1));
+    };
 
     template <class Integrator>
     UnsignedInt integrateMatchedTimeInterval( // designed to avoid too small last step
@@ -54,13 +94,18 @@ class TimeStepper
     {
         Real integrated_time_ = 0.0;
         UnsignedInt sub_step_count = 0;
+        UnsignedInt steps_since_evaluation = 0;
         Real dt = step_evaluator.exec();
 
         constexpr Real TIME_STEP_SAFETY_FACTOR = 1.5; // Ensures the last step is not too small
         while (interval - integrated_time_ > TIME_STEP_SAFETY_FACTOR * dt)
         {
             integrator(dt);
-            dt = step_evaluator.exec();
+            if (++steps_since_evaluation == step_evaluation_interval_)
+            {
+                dt = step_evaluator.exec();
+                steps_since_evaluation = 0;
+            }
             integrated_time_ += dt;
             sub_step_count++;
         }
@@ -95,6 +140,43 @@ class TimeStepper
 
     void integrateMatchedTimeInterval(BaseDynamics<void> &integrator, Real interval, int sub_division = 1);
 
+    /**
+     * Hierarchical local time stepping over adaptation levels, in which the finest level
+     * (number_of_levels - 1) takes the steps of finest_dt and each coarser level k takes
+     * steps of 2^(number_of_levels - 1 - k) * finest_dt, all matched to the interval.
+     * The level integrator, called as level_integrator(level, dt), advances the particles
+     * of one level, e.g. by dynamics on BodyPartitionTemporal. Within a coarse step the
+     * coarser levels are advanced first, so that the finer levels sub-cycle toward them.
+     * Returns the number of finest-level sub-steps.
+     */
+    template <class LevelIntegrator>
+    UnsignedInt integrateLocalTimeSteps(Real interval, Real finest_dt,
+                                        UnsignedInt number_of_levels,
+                                        const LevelIntegrator &level_integrator)
+    {
+        UnsignedInt finest_level = number_of_levels - 1;
+        UnsignedInt sub_steps_per_coarse_step = 1 << finest_level;
+        Real coarse_dt = finest_dt * Real(sub_steps_per_coarse_step);
+        UnsignedInt coarse_steps = SMAX(UnsignedInt(1), UnsignedInt(std::ceil(interval / coarse_dt)));
+        Real matched_finest_dt = interval / Real(coarse_steps * sub_steps_per_coarse_step);
+
+        for (UnsignedInt n = 0; n != coarse_steps; ++n)
+        {
+            for (UnsignedInt sub_step = 0; sub_step != sub_steps_per_coarse_step; ++sub_step)
+            {
+                for (UnsignedInt level = 0; level != number_of_levels; ++level)
+                {
+                    UnsignedInt level_ratio = 1 << (finest_level - level);
+                    if (sub_step % level_ratio == 0)
+                    {
+                        level_integrator(level, matched_finest_dt * Real(level_ratio));
+                    }
+                }
+            }
+        }
+        return coarse_steps * sub_steps_per_coarse_step;
+    };
+
   public: // execution triggers for time stepping
     class TriggerByPhysicalTime
     {
@@ -132,6 +214,7 @@ class TimeStepper
     StdVec<TriggerByPhysicalTime *> physical_time_executers_;
     Real end_time_, start_time_;
     Real global_dt_;
+    UnsignedInt step_evaluation_interval_;
     SingularVariable<Real> *sv_physical_time_;
 };
 
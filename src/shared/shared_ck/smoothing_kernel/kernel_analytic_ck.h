@@ -0,0 +1,123 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file kernel_analytic_ck.h
+ * @brief This is the classes for analytic kernels in computing kernels.
+ * @details The kernel functions are specialized for each kernel type,
+ * so that the evaluation inlines to straight-line polynomial code
+ * without virtual calls or table lookups.
+ * The interface is identical to that of the tabulated kernels.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef KERNEL_ANALYTIC_CK_H
+#define KERNEL_ANALYTIC_CK_H
+
+#include "kernel_laguerre_gauss.h"
+#include "kernel_tabulated_ck.hpp"
+#include "kernel_wendland_c2.h"
+
+namespace SPH
+{
+template <class KernelType>
+class KernelAnalyticCK;
+
+template <class KernelType>
+class KernelAnalyticBaseCK
+{
+  public:
+    explicit KernelAnalyticBaseCK(Kernel &kernel);
+
+  protected:
+    Real kernel_size_;
+    Real dimension_factor_1D_, dimension_factor_2D_, dimension_factor_3D_;
+};
+
+template <>
+class KernelAnalyticCK<KernelWendlandC2> : public KernelAnalyticBaseCK<KernelWendlandC2>
+{
+  public:
+    explicit KernelAnalyticCK(Kernel &kernel)
+        : KernelAnalyticBaseCK<KernelWendlandC2>(kernel){};
+
+    inline Real normalized_W(Real normalized_distance) const
+    {
+        Real q = SMIN(normalized_distance, kernel_size_);
+        Real a = 1.0 - 0.5 * q;
+        Real a_squared = a * a;
+        return a_squared * a_squared * (1.0 + 2.0 * q);
+    };
+
+    inline Real normalized_dW(Real normalized_distance) const
+    {
+        Real q = SMIN(normalized_distance, kernel_size_);
+        Real b = q - 2.0;
+        return 0.625 * b * b * b * q;
+    };
+
+    inline Real normalized_d2W(Real normalized_distance) const
+    {
+        Real q = SMIN(normalized_distance, kernel_size_);
+        Real b = q - 2.0;
+        return 1.25 * b * b * (2.0 * q - 1.0);
+    };
+};
+
+template <>
+class KernelAnalyticCK<KernelLaguerreGauss> : public KernelAnalyticBaseCK<KernelLaguerreGauss>
+{
+  public:
+    explicit KernelAnalyticCK(Kernel &kernel)
+        : KernelAnalyticBaseCK<KernelLaguerreGauss>(kernel){};
+
+    inline Real normalized_W(Real normalized_distance) const
+    {
+        Real q = SMIN(normalized_distance, kernel_size_);
+        Real q_squared = q * q;
+        return (1.0 - q_squared + q_squared * q_squared / 6.0) * math::exp(-q_squared);
+    };
+
+    inline Real normalized_dW(Real normalized_distance) const
+    {
+        Real q = SMIN(normalized_distance, kernel_size_);
+        Real q_squared = q * q;
+        return q * (-q_squared * q_squared / 3.0 + 8.0 * q_squared / 3.0 - 4.0) * math::exp(-q_squared);
+    };
+
+    inline Real normalized_d2W(Real normalized_distance) const
+    {
+        Real q = SMIN(normalized_distance, kernel_size_);
+        Real q_squared = q * q;
+        Real q_fourth = q_squared * q_squared;
+        return (2.0 * q_fourth * q_squared / 3.0 - 7.0 * q_fourth + 16.0 * q_squared - 4.0) *
+               math::exp(-q_squared);
+    };
+};
+
+#if SPHINXSYS_USE_ANALYTIC_KERNEL
+using SmoothingKernelCK = KernelAnalyticCK<KernelWendlandC2>;
+#else
+using SmoothingKernelCK = KernelTabulatedCK;
+#endif // SPHINXSYS_USE_ANALYTIC_KERNEL
+} // namespace SPH
+#endif // KERNEL_ANALYTIC_CK_H
@@ -0,0 +1,20 @@
+#ifndef KERNEL_ANALYTIC_CK_HPP
+#define KERNEL_ANALYTIC_CK_HPP
+
+#include "kernel_analytic_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class KernelType>
+KernelAnalyticBaseCK<KernelType>::KernelAnalyticBaseCK(Kernel &kernel)
+{
+    DynamicCast<KernelType>(this, &kernel); // the analytic kernel must match the given kernel
+    dimension_factor_1D_ = kernel.DimensionFactor1D();
+    dimension_factor_2D_ = kernel.DimensionFactor2D();
+    dimension_factor_3D_ = kernel.DimensionFactor3D();
+    kernel_size_ = kernel.KernelSize();
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // KERNEL_ANALYTIC_CK_HPP
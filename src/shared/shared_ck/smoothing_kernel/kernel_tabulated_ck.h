@@ -22,8 +22,10 @@
  * ------------------------------------------------------------------------- */
 /**
  * @file kernel_tabulated_ck.h
- * @brief This is the class for tabulated kernel
+ * @brief This is the classes for tabulated kernel
  * which is applicable for all SPH kernels.
+ * @details The cubic interpolation works with a coarse table,
+ * while the linear interpolation with a fine table is cheaper for each evaluation.
  * @author	Xiangyu Hu
  */
 
@@ -34,13 +36,13 @@
 
 namespace SPH
 {
-constexpr int kernel_resolution_ = 20;
-constexpr int tabulated_size_ = kernel_resolution_ + 4;
-
-class KernelTabulatedCK
+template <int KernelResolution>
+class KernelTabulatedCubicCK
 {
+    static constexpr int tabulated_size_ = KernelResolution + 4;
+
   public:
-    explicit KernelTabulatedCK(Kernel &kernel);
+    explicit KernelTabulatedCubicCK(Kernel &kernel);
 
     Real interpolateCubic(const Real *data, Real q) const
     {
@@ -80,5 +82,56 @@ class KernelTabulatedCK
     Real dq_, delta_q_0_, delta_q_1_, delta_q_2_, delta_q_3_;
     Real w_1d[tabulated_size_], dw_1d[tabulated_size_], d2w_1d[tabulated_size_];
 };
+
+/**
+ * @class KernelTabulatedLinearCK
+ * @brief Tabulated kernel with linear interpolation from a fine table.
+ * Each entry holds the value and its increment to the next entry,
+ * so that an evaluation reads two adjacent values and takes one multiply-add.
+ */
+template <int KernelResolution>
+class KernelTabulatedLinearCK
+{
+    static constexpr int tabulated_size_ = KernelResolution + 2;
+
+  public:
+    explicit KernelTabulatedLinearCK(Kernel &kernel);
+
+    Real interpolateLinear(const Real (*data)[2], Real q) const
+    {
+        Real scaled_q = q * inv_dq_;
+        int i = SMIN((int)scaled_q, KernelResolution);
+        return data[i][0] + (scaled_q - Real(i)) * data[i][1];
+    };
+
+    inline Real normalized_W(Real normalized_distance) const
+    {
+        return interpolateLinear(w_1d, normalized_distance);
+    };
+
+    inline Real normalized_dW(Real normalized_distance) const
+    {
+        return interpolateLinear(dw_1d, normalized_distance);
+    };
+
+    inline Real normalized_d2W(Real normalized_distance) const
+    {
+        return interpolateLinear(d2w_1d, normalized_distance);
+    };
+
+  protected:
+    Real dimension_factor_1D_, dimension_factor_2D_, dimension_factor_3D_;
+
+  private:
+    Real kernel_size_;
+    Real inv_dq_;
+    Real w_1d[tabulated_size_][2], dw_1d[tabulated_size_][2], d2w_1d[tabulated_size_][2];
+};
+
+#if SPHINXSYS_USE_LINEAR_KERNEL_TABLE
+using KernelTabulatedCK = KernelTabulatedLinearCK<1024>;
+#else
+using KernelTabulatedCK = KernelTabulatedCubicCK<20>;
+#endif // SPHINXSYS_USE_LINEAR_KERNEL_TABLE
 } // namespace SPH
-#endif // KERNEL_TABULATED_CK_H
\ No newline at end of file
+#endif // KERNEL_TABULATED_CK_H
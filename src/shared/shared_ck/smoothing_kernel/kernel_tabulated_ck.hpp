@@ -0,0 +1,60 @@
+#ifndef KERNEL_TABULATED_CK_HPP
+#define KERNEL_TABULATED_CK_HPP
+
+#include "kernel_tabulated_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <int KernelResolution>
+KernelTabulatedCubicCK<KernelResolution>::KernelTabulatedCubicCK(Kernel &kernel)
+{
+    dimension_factor_1D_ = kernel.DimensionFactor1D();
+    dimension_factor_2D_ = kernel.DimensionFactor2D();
+    dimension_factor_3D_ = kernel.DimensionFactor3D();
+    kernel_size_ = kernel.KernelSize();
+
+    dq_ = kernel_size_ / Real(KernelResolution);
+    for (int i = 0; i < tabulated_size_; i++)
+    {
+        w_1d[i] = kernel.W_1D(Real(i - 1) * dq_);
+        dw_1d[i] = kernel.dW_1D(Real(i - 1) * dq_);
+        d2w_1d[i] = kernel.d2W_1D(Real(i - 1) * dq_);
+    }
+
+    delta_q_0_ = (-1.0 * dq_) * (-2.0 * dq_) * (-3.0 * dq_);
+    delta_q_1_ = dq_ * (-1.0 * dq_) * (-2.0 * dq_);
+    delta_q_2_ = (2.0 * dq_) * dq_ * (-1.0 * dq_);
+    delta_q_3_ = (3.0 * dq_) * (2.0 * dq_) * dq_;
+}
+//=================================================================================================//
+template <int KernelResolution>
+KernelTabulatedLinearCK<KernelResolution>::KernelTabulatedLinearCK(Kernel &kernel)
+{
+    dimension_factor_1D_ = kernel.DimensionFactor1D();
+    dimension_factor_2D_ = kernel.DimensionFactor2D();
+    dimension_factor_3D_ = kernel.DimensionFactor3D();
+    kernel_size_ = kernel.KernelSize();
+
+    Real dq = kernel_size_ / Real(KernelResolution);
+    inv_dq_ = 1.0 / dq;
+    for (int i = 0; i < tabulated_size_; i++)
+    {
+        w_1d[i][0] = kernel.W_1D(Real(i) * dq);
+        dw_1d[i][0] = kernel.dW_1D(Real(i) * dq);
+        d2w_1d[i][0] = kernel.d2W_1D(Real(i) * dq);
+    }
+
+    for (int i = 0; i < tabulated_size_ - 1; i++)
+    {
+        w_1d[i][1] = w_1d[i + 1][0] - w_1d[i][0];
+        dw_1d[i][1] = dw_1d[i + 1][0] - dw_1d[i][0];
+        d2w_1d[i][1] = d2w_1d[i + 1][0] - d2w_1d[i][0];
+    }
+    w_1d[tabulated_size_ - 1][1] = 0.0;
+    dw_1d[tabulated_size_ - 1][1] = 0.0;
+    d2w_1d[tabulated_size_ - 1][1] = 0.0;
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // KERNEL_TABULATED_CK_HPP
@@ -0,0 +1,50 @@
+#include "ensemble_runner.h"
+
+#include "loop_scheduling.h"
+
+#include <tbb/parallel_for.h>
+
+namespace SPH
+{
+//=================================================================================================//
+void EnsembleRunner::runInLockStep()
+{
+    StdVec<char> is_running(member_steps_.size(), true);
+    size_t running_members = member_steps_.size();
+    while (running_members != 0)
+    {
+        for (size_t k = 0; k != member_steps_.size(); ++k)
+        {
+            if (is_running[k] && !member_steps_[k]())
+            {
+                is_running[k] = false;
+                running_members--;
+            }
+        }
+    }
+}
+//=================================================================================================//
+void EnsembleRunner::runConcurrently()
+{
+    execution::PartitionerType partitioner_type = execution::loop_scheduling.Partitioner();
+    if (partitioner_type == execution::PartitionerType::Affinity)
+    {
+        execution::loop_scheduling.setPartitioner(execution::PartitionerType::StaticChunked);
+    }
+
+    tbb::parallel_for(
+        IndexRange(0, member_steps_.size(), 1),
+        [&](const IndexRange &r)
+        {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                while (member_steps_[k]())
+                {
+                }
+            }
+        });
+
+    execution::loop_scheduling.setPartitioner(partitioner_type);
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,65 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	ensemble_runner.h
+ * @brief 	Running an ensemble of small independent simulations in one process.
+ * @details Each member is an independent simulation, i.e. with its own SPHSystem,
+ *          given by a function advancing it by one step. All members share the thread pool
+ *          and, for device execution, the device queue of the process, so that
+ *          the startup costs are paid once for the ensemble.
+ *          The output folder of each member should be distinct, e.g. by IOEnvironment::appendOutputFolder.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef ENSEMBLE_RUNNER_H
+#define ENSEMBLE_RUNNER_H
+
+#include "base_data_type_package.h"
+#include "sphinxsys_containers.h"
+
+#include <functional>
+
+namespace SPH
+{
+class EnsembleRunner
+{
+  public:
+    /** Advance the member by one step and return false when the member is finished. */
+    using MemberStep = std::function<bool()>;
+
+    EnsembleRunner() {};
+    ~EnsembleRunner() {};
+
+    void addMember(const MemberStep &member_step) { member_steps_.push_back(member_step); };
+    size_t NumberOfMembers() { return member_steps_.size(); };
+    /** The members take their steps in turn until all are finished, each step using all threads. */
+    void runInLockStep();
+    /** The members run concurrently, each until finished. Meanwhile, the static chunked partitioning is used,
+     *  as the affinity partitioners of the particle loops can not be shared by concurrent members. */
+    void runConcurrently();
+
+  protected:
+    StdVec<MemberStep> member_steps_;
+};
+} // namespace SPH
+#endif // ENSEMBLE_RUNNER_H
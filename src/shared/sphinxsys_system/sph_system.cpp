@@ -3,7 +3,14 @@
 #include "all_body_relations.h"
 #include "elastic_dynamics.h"
 #include "io_log.h"
+#include "level_set_shape.h"
 #include "predefined_bodies.h"
+#include "relation_ck.h"
+#include "startup_profiler.h"
+
+#if SPHINXSYS_USE_SYCL
+#include "implementation_sycl.h"
+#endif // SPHINXSYS_USE_SYCL
 
 namespace SPH
 {
@@ -12,6 +19,7 @@ SPHSystem::SPHSystem(BoundingBoxd system_domain_bounds, Real resolution_ref, siz
     : system_domain_bounds_(system_domain_bounds),
       resolution_ref_(resolution_ref),
       tbb_global_control_(tbb::global_control::max_allowed_parallelism, number_of_threads),
+      task_arena_(int(number_of_threads)),
       io_environment_(io_ptr_keeper_.createPtr<IOEnvironment>(*this)),
       run_particle_relaxation_(false), reload_particles_(false),
       restart_step_(0), generate_regression_data_(false), state_recording_(true)
@@ -34,6 +42,52 @@ void SPHSystem::setLogLevel(size_t log_level)
     spdlog::set_level(static_cast<spdlog::level::level_enum>(log_level_));
 }
 //=================================================================================================//
+void SPHSystem::setDeviceIndex(size_t device_index)
+{
+    device_index_ = device_index;
+#if SPHINXSYS_USE_SYCL
+    execution::execution_instance.setCurrentDevice(device_index_);
+#endif // SPHINXSYS_USE_SYCL
+}
+//=================================================================================================//
+void SPHSystem::setKernelCacheFolder(const std::string &kernel_cache_folder)
+{
+#if SPHINXSYS_USE_SYCL
+    if (!fs::exists(kernel_cache_folder))
+    {
+        fs::create_directories(kernel_cache_folder);
+    }
+    std::string cache_folder = fs::absolute(kernel_cache_folder).string();
+#ifdef _WIN32
+    _putenv_s("SYCL_CACHE_PERSISTENT", "1");
+    _putenv_s("SYCL_CACHE_DIR", cache_folder.c_str());
+#else
+    setenv("SYCL_CACHE_PERSISTENT", "1", 1);
+    setenv("SYCL_CACHE_DIR", cache_folder.c_str(), 1);
+#endif
+    Log::get()->info("The device kernels are cached in {}.", cache_folder);
+#endif // SPHINXSYS_USE_SYCL
+}
+//=================================================================================================//
+void SPHSystem::setNumaAwarePlacement(bool numa_aware_placement)
+{
+    if (numa_aware_placement)
+    {
+        use_particle_memory_arena_ = true;
+        if (thread_pinning_ == nullptr)
+        {
+            thread_pinning_ = thread_pinning_keeper_.createPtr<ThreadPinning>();
+            Log::get()->info("The threads are pinned to {} cores for NUMA-aware placement.",
+                             thread_pinning_->NumberOfCores());
+        }
+    }
+    else
+    {
+        use_particle_memory_arena_ = false;
+        thread_pinning_ = thread_pinning_keeper_.movePtr(nullptr); // pinned threads are not released
+    }
+}
+//=================================================================================================//
 IOEnvironment &SPHSystem::getIOEnvironment()
 {
     if (io_environment_ == nullptr)
@@ -60,6 +114,7 @@ void SPHSystem::initializeSystemCellLinkedLists()
 {
     for (auto &body : real_bodies_)
     {
+        ScopedStartupPhase startup_phase("InitialCellLinkedList", body->getName());
         DynamicCast<RealBody>(this, body)->updateCellLinkedList();
     }
 }
@@ -68,6 +123,7 @@ void SPHSystem::initializeSystemConfigurations()
 {
     for (auto &body : sph_bodies_)
     {
+        ScopedStartupPhase startup_phase("InitialConfiguration", body->getName());
         StdVec<SPHRelation *> &body_relations = body->getBodyRelations();
         for (size_t i = 0; i < body_relations.size(); i++)
         {
@@ -76,6 +132,79 @@ void SPHSystem::initializeSystemConfigurations()
     }
 }
 //=================================================================================================//
+void SPHSystem::snapshot()
+{
+    for (auto &body : sph_bodies_)
+    {
+        body->getBaseParticles().snapshotParticles(execution::par_ck);
+    }
+    system_variables_snapshot_.clear();
+    snapshot_system_variables_(all_system_variables_, system_variables_snapshot_);
+}
+//=================================================================================================//
+void SPHSystem::restore()
+{
+    size_t restored_variables = 0;
+    for (auto &body : sph_bodies_)
+    {
+        restored_variables += body->getBaseParticles().restoreParticles(execution::par_ck);
+    }
+    size_t buffer_index = 0;
+    restore_system_variables_(all_system_variables_, system_variables_snapshot_, buffer_index);
+    Log::get()->info("Restored {} changed particle variables from the snapshot.", restored_variables);
+}
+//=================================================================================================//
+void SPHSystem::reportMemoryUsage(std::ostream &output_stream)
+{
+    auto write_row = [&](const std::string &category, const std::string &body_name, const MemoryUsage &memory_usage)
+    {
+        Real mega_bytes = 1024.0 * 1024.0;
+        output_stream << std::fixed << std::setprecision(3)
+                      << std::setw(14) << Real(memory_usage.host_bytes_) / mega_bytes
+                      << std::setw(14) << Real(memory_usage.device_bytes_) / mega_bytes
+                      << "  " << category << " of " << body_name << "\n";
+    };
+
+    output_stream << "\n Memory usage:\n";
+    output_stream << std::setw(14) << "host[MB]" << std::setw(14) << "device[MB]" << "  category of body\n";
+    MemoryUsage total_memory_usage;
+    for (auto &body : sph_bodies_)
+    {
+        StdVec<std::pair<std::string, MemoryUsage>> categories;
+        categories.emplace_back("Particles", body->getBaseParticles().getMemoryUsage());
+
+        MemoryUsage relations_memory_usage;
+        for (auto &relation : body->getBodyRelations())
+        {
+            relations_memory_usage += relation->getMemoryUsage();
+        }
+        for (auto &relation : body->getBodyRelationsCK())
+        {
+            relations_memory_usage += relation->getMemoryUsage();
+        }
+        categories.emplace_back("Relations", relations_memory_usage);
+
+        RealBody *real_body = dynamic_cast<RealBody *>(body);
+        if (real_body != nullptr && real_body->isCellLinkedListCreated())
+        {
+            categories.emplace_back("CellLinkedList", real_body->getCellLinkedList().getMemoryUsage());
+        }
+
+        LevelSetShape *level_set_shape = dynamic_cast<LevelSetShape *>(&body->getInitialShape());
+        if (level_set_shape != nullptr)
+        {
+            categories.emplace_back("LevelSet", level_set_shape->getLevelSet().getMemoryUsage());
+        }
+
+        for (auto &category : categories)
+        {
+            write_row(category.first, body->getName(), category.second);
+            total_memory_usage += category.second;
+        }
+    }
+    write_row("All", "all bodies", total_memory_usage);
+}
+//=================================================================================================//
 Real SPHSystem::getSmallestTimeStepAmongSolidBodies(Real CFL)
 {
     Real dt = MaxReal;
@@ -102,6 +231,12 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
+        desc.add_options()("device", po::value<int>(), "Default device index for SYCL execution.");
+        desc.add_options()("numa_aware", po::value<bool>(), "NUMA-aware thread pinning and particle placement.");
+        desc.add_options()("static_partitioner", po::value<bool>(), "Static chunked partitioning of parallel particle loops.");
+        desc.add_options()("neighbor_cost_partitioner", po::value<bool>(), "Neighbor-count balanced partitioning of interactions.");
+        desc.add_options()("deterministic_reduce", po::value<bool>(), "Deterministic parallel particle reductions.");
+        desc.add_options()("startup_profile", po::value<bool>(), "Report the initialization phases at the first time step.");
         desc.add_options()("log_level", po::value<int>(), "Output log level (0-6). "
                                                           "0: trace, 1: debug, 2: info, 3: warning, 4: error, 5: critical, 6: off");
 
@@ -180,6 +315,55 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
                       << restart_step_ << ").\n";
         }
 
+        if (vm.count("device"))
+        {
+            int device_index = vm["device"].as<int>();
+            if (device_index < 0)
+            {
+                std::cerr << "Device index must be non-negative.\n";
+                exit(1);
+            }
+            setDeviceIndex(device_index);
+            std::cout << "Device index was set to " << device_index << ".\n";
+        }
+
+        if (vm.count("numa_aware"))
+        {
+            setNumaAwarePlacement(vm["numa_aware"].as<bool>());
+            std::cout << "NUMA-aware placement was set to "
+                      << vm["numa_aware"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("static_partitioner"))
+        {
+            bool static_partitioner = vm["static_partitioner"].as<bool>();
+            execution::loop_scheduling.setPartitioner(
+                static_partitioner ? execution::PartitionerType::StaticChunked : execution::PartitionerType::Affinity);
+            std::cout << "Static chunked partitioning was set to " << static_partitioner << ".\n";
+        }
+
+        if (vm.count("neighbor_cost_partitioner"))
+        {
+            bool neighbor_cost_partitioner = vm["neighbor_cost_partitioner"].as<bool>();
+            execution::loop_scheduling.setPartitioner(
+                neighbor_cost_partitioner ? execution::PartitionerType::NeighborCost : execution::PartitionerType::Affinity);
+            std::cout << "Neighbor cost partitioning was set to " << neighbor_cost_partitioner << ".\n";
+        }
+
+        if (vm.count("deterministic_reduce"))
+        {
+            execution::loop_scheduling.setDeterministicReduction(vm["deterministic_reduce"].as<bool>());
+            std::cout << "Deterministic reduction was set to "
+                      << vm["deterministic_reduce"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("startup_profile"))
+        {
+            StartupProfiler::get().enable(vm["startup_profile"].as<bool>());
+            std::cout << "Startup profiling was set to "
+                      << vm["startup_profile"].as<bool>() << ".\n";
+        }
+
         if (vm.count("log_level"))
         {
             log_level_ = vm["log_level"].as<int>();
@@ -32,6 +32,7 @@
 
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
 #include <tbb/global_control.h>
+#include <tbb/task_arena.h>
 #ifdef BOOST_AVAILABLE
 #include "boost/program_options.hpp"
 namespace po = boost::program_options;
@@ -40,6 +41,7 @@ namespace po = boost::program_options;
 #include "base_data_type_package.h"
 #include "io_environment.h"
 #include "sphinxsys_containers.h"
+#include "thread_pinning.h"
 
 namespace SPH
 {
@@ -52,6 +54,7 @@ class SPHSystem
     UniquePtrKeeper<IOEnvironment> io_ptr_keeper_;
     DataContainerUniquePtrAssemble<SingularVariable> all_system_variable_ptrs_;
     UniquePtrsKeeper<Entity> unique_system_variable_ptrs_;
+    UniquePtrKeeper<ThreadPinning> thread_pinning_keeper_;
 
   public:
     SPHSystem(BoundingBoxd system_domain_bounds, Real resolution_ref,
@@ -73,12 +76,50 @@ class SPHSystem
     void setRestartStep(size_t restart_step) { restart_step_ = restart_step; };
     void setLogLevel(size_t log_level);
     size_t RestartStep() { return restart_step_; };
+    /** Select the default device for SYCL execution, no effect for host builds. */
+    void setDeviceIndex(size_t device_index);
+    size_t DeviceIndex() { return device_index_; };
+    /** Keep the JIT-compiled device kernels in a persistent cache folder, so that later runs do not compile them again.
+     *  It takes effect only if called before the first device execution, no effect for host builds. */
+    void setKernelCacheFolder(const std::string &kernel_cache_folder);
+    /** Reuse the level sets of identifiable geometries from previous runs. */
+    void setCacheLevelSets(bool cache_level_sets) { cache_level_sets_ = cache_level_sets; };
+    bool CacheLevelSets() { return cache_level_sets_; };
+    /** Build the level sets of bodies only within the system domain bounds, where particles are probed,
+     *  which saves time and memory for geometries much larger than the domain. */
+    void setLevelSetsWithinDomainBounds(bool within_domain_bounds) { level_sets_within_domain_bounds_ = within_domain_bounds; };
+    bool LevelSetsWithinDomainBounds() { return level_sets_within_domain_bounds_; };
+    /** Build the cell linked lists of the real bodies over the bounds of their particles,
+     *  expanded by the margin and within the domain bounds, instead of the whole domain.
+     *  The particles moved out are kept in the boundary cells, which is correct but slower,
+     *  so the margin is to cover the expected motion. A negative margin gives the whole domain. */
+    void setCellLinkedListMargin(Real margin) { cell_linked_list_margin_ = margin; };
+    Real CellLinkedListMargin() { return cell_linked_list_margin_; };
+    /** Allocate the particle variables of the bodies created afterwards in per-body memory arenas. */
+    void setUseParticleMemoryArena(bool use_particle_memory_arena) { use_particle_memory_arena_ = use_particle_memory_arena; };
+    bool UseParticleMemoryArena() { return use_particle_memory_arena_; };
+    /** Pin the threads to cores and first touch the particle variables in parallel,
+     *  i.e. in particle memory arenas, for the bodies created afterwards. */
+    void setNumaAwarePlacement(bool numa_aware_placement);
+    bool NumaAwarePlacement() { return thread_pinning_ != nullptr; };
+    /** The task arena of the system, e.g. for running the dynamics on few particles by BaseDynamics::setTaskArena. */
+    tbb::task_arena &getTaskArena() { return task_arena_; };
     /** Initialize cell linked list for the SPH system. */
     void initializeSystemCellLinkedLists();
     /** Initialize particle configuration for the SPH system. */
     void initializeSystemConfigurations();
     /** get the min time step from all bodies. */
     Real getSmallestTimeStepAmongSolidBodies(Real CFL = 0.6);
+    /** Report the host and device memory of particles, relations, cell linked lists and level sets of all bodies. */
+    void reportMemoryUsage(std::ostream &output_stream = std::cout);
+    /** Keep the evolving variables and the number of real particles of all bodies,
+     *  as well as the system variables, in memory, e.g. for rolling back a diverged step.
+     *  The data of the main execution policy are streamed, i.e. also the device data. */
+    void snapshot();
+    /** Roll back to the last snapshot. Only the changed variables are written back.
+     *  The cell linked lists and relations are outdated afterwards and are to be updated
+     *  before the next interaction, as after a restart. */
+    void restore();
     Real ReferenceResolution() { return resolution_ref_; };
     void setReferenceResolution(Real resolution_ref) { resolution_ref_ = resolution_ref; };
     SPHBodyVector getSPHBodies() { return sph_bodies_; };
@@ -108,6 +149,7 @@ class SPHSystem
     BoundingBoxd system_domain_bounds_;       /**< Lower and Upper domain bounds. */
     Real resolution_ref_;                    /**< reference resolution of the SPH system */
     tbb::global_control tbb_global_control_; /**< global controlling on the total number parallel threads */
+    tbb::task_arena task_arena_;             /**< persistent task arena, initialized at its first use */
     SPHBodyVector sph_bodies_;               /**< All sph bodies. */
     SPHBodyVector observation_bodies_;       /**< The bodies without inner particle configuration. */
     SolidBodyVector solid_bodies_;           /**< The bodies with inner particle configuration and acoustic time steps . */
@@ -118,8 +160,37 @@ class SPHSystem
     size_t restart_step_;                    /**< restart step */
     bool generate_regression_data_;          /**< run and generate or enhance the regression test data set. */
     bool state_recording_;                   /**< Record state in output folder. */
+    size_t device_index_ = 0;                /**< default device index for SYCL execution */
+    bool cache_level_sets_ = false;          /**< read and write level sets in the level set cache folder. */
+    bool level_sets_within_domain_bounds_ = false; /**< build level sets of bodies within the domain bounds only. */
+    bool use_particle_memory_arena_ = false; /**< allocate particle variables in per-body memory arenas. */
+    Real cell_linked_list_margin_ = -1.0;    /**< negative for the cell linked lists over the whole domain. */
+    ThreadPinning *thread_pinning_ = nullptr; /**< pinning of the threads for NUMA-aware placement */
     int log_level_ = 2;                      /**< Log level, 0: trace, 1: debug, 2: info, 3: warning, 4: error, 5: critical, 6: off */
     SingularVariables all_system_variables_;
+    struct SystemVariableSnapshot
+    {
+        std::string name_;
+        StdVec<char> data_;
+    };
+    StdVec<SystemVariableSnapshot> system_variables_snapshot_;
+
+    struct SnapshotASystemVariable
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<SingularVariable<DataType>> &variables,
+                        StdVec<SystemVariableSnapshot> &buffers);
+    };
+
+    struct RestoreASystemVariable
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<SingularVariable<DataType>> &variables,
+                        StdVec<SystemVariableSnapshot> &buffers, size_t &buffer_index);
+    };
+
+    OperationOnDataAssemble<SingularVariables, SnapshotASystemVariable> snapshot_system_variables_;
+    OperationOnDataAssemble<SingularVariables, RestoreASystemVariable> restore_system_variables_;
 };
 } // namespace SPH
 #endif // SPH_SYSTEM_H
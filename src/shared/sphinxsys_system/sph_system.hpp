@@ -50,5 +50,35 @@ DataType *SPHSystem::getSystemVariableDataByName(const std::string &name)
     return variable->Data();
 }
 //=================================================================================================//
+template <typename DataType>
+void SPHSystem::SnapshotASystemVariable::
+operator()(DataContainerAddressKeeper<SingularVariable<DataType>> &variables, StdVec<SystemVariableSnapshot> &buffers)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        DataType value = variables[i]->getValue();
+        const char *data = reinterpret_cast<const char *>(&value);
+        buffers.push_back({variables[i]->Name(), StdVec<char>(data, data + sizeof(DataType))});
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void SPHSystem::RestoreASystemVariable::
+operator()(DataContainerAddressKeeper<SingularVariable<DataType>> &variables,
+           StdVec<SystemVariableSnapshot> &buffers, size_t &buffer_index)
+{
+    // the system variables registered after the snapshot are kept
+    for (size_t i = 0; i != variables.size() && buffer_index != buffers.size(); ++i)
+    {
+        if (buffers[buffer_index].name_ == variables[i]->Name())
+        {
+            DataType value;
+            std::memcpy(reinterpret_cast<char *>(&value), buffers[buffer_index].data_.data(), sizeof(DataType));
+            variables[i]->setValue(value);
+            buffer_index++;
+        }
+    }
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // SPH_SYSTEM_HPP
@@ -62,6 +62,12 @@ std::string DataToString(const DataType &value)
     // return std::to_string(value);
 }
 
+/** written as a number rather than a character. */
+inline std::string DataToString(const uint8_t &value)
+{
+    return std::to_string(int(value));
+}
+
 template <int DIMENSION, auto... Rest>
 std::string DataToString(const Eigen::Matrix<Real, DIMENSION, Rest...> &value)
 {
@@ -84,6 +90,13 @@ void StringToData(std::string &value_str, DataType &value)
     std::istringstream(value_str) >> value;
 }
 
+inline void StringToData(std::string &value_str, uint8_t &value)
+{
+    int number = 0;
+    std::istringstream(value_str) >> number;
+    value = uint8_t(number);
+}
+
 template <int DIMENSION, auto... Rest>
 void StringToData(std::string &value_str, Eigen::Matrix<Real, DIMENSION, 1, Rest...> &value)
 {
@@ -12,7 +12,7 @@ namespace SPH
 //=================================================================================================//
 void RadixSort::sort(const ParallelDevicePolicy &ex_policy, UnsignedInt size, UnsignedInt start_index)
 {
-    UnsignedInt *index_permutation = dv_index_permutation_->DelegatedData(ex_policy);
+    UnsignedInt *index_permutation = dv_index_permutation_->DelegatedData(ex_policy) + start_index;
     UnsignedInt *begin = dv_sequence_->DelegatedData(ex_policy) + start_index;
 
 #ifndef SPHINXSYS_USE_ONEDPL_SORTING
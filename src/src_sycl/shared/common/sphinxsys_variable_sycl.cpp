@@ -0,0 +1,33 @@
+#include "sphinxsys_variable_sycl.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+void *ScratchBuffer::DeviceData(const std::string &member_name, size_t bytes,
+                                const std::function<void(void *)> &rebind_member)
+{
+    rebind_members_[member_name] = rebind_member;
+    if (bytes > device_bytes_)
+    {
+        releaseDeviceData();
+        device_data_ = allocateDeviceOnly<char>(bytes);
+        device_bytes_ = bytes;
+        for (auto &member : rebind_members_)
+        {
+            member.second(device_data_);
+        }
+    }
+    return device_data_;
+}
+//=================================================================================================//
+void ScratchBuffer::releaseDeviceData()
+{
+    if (device_data_ != nullptr)
+    {
+        freeDeviceData(static_cast<char *>(device_data_));
+        device_data_ = nullptr;
+        device_bytes_ = 0;
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -26,46 +26,175 @@ DeviceSharedSingularVariable<DataType>::~DeviceSharedSingularVariable()
 template <typename DataType>
 void DiscreteVariable<DataType>::synchronizeWithDevice()
 {
-    if (isDataDelegated())
+    // the device data only accessed as constant are the same as the host data
+    if (isDataDelegated() && is_device_data_writable_)
     {
-        copyFromDevice(data_field_, device_data_field_, data_size_);
+        copyFromDevice(Data(), device_data_field_, data_size_);
     }
 }
 //=================================================================================================//
 template <typename DataType>
 void DiscreteVariable<DataType>::synchronizeToDevice()
 {
-    if (isDataDelegated())
+    if (isDataDelegated() && data_field_ != nullptr)
     {
         copyToDevice(data_field_, device_data_field_, data_size_);
     }
 }
 //=================================================================================================//
 template <typename DataType>
+template <class ChunkFunction>
+void DiscreteVariable<DataType>::streamOutData(
+    const ParallelDevicePolicy &ex_policy, size_t data_size, const ChunkFunction &chunk_function)
+{
+    if (!isDataDelegated() || !is_device_data_writable_)
+    {
+        chunk_function(Data(), data_size);
+        return;
+    }
+
+    execution::execution_instance.synchronize();
+    sycl::queue &queue = execution::execution_instance.getQueue();
+    size_t chunk_size = SMAX(BinaryStreamChunkBytes / sizeof(DataType), size_t(1));
+    DataType *staging[2] = {allocateHostStaging<DataType>(chunk_size),
+                            allocateHostStaging<DataType>(chunk_size)};
+    sycl::event copied[2];
+    size_t chunk_start[2] = {0, 0};
+    // the device copy of the next chunk overlaps with the chunk function of the current one
+    for (size_t start = 0, k = 0; start < data_size; start += chunk_size, k = 1 - k)
+    {
+        chunk_start[k] = start;
+        copied[k] = queue.memcpy(staging[k], device_data_field_ + start,
+                                 SMIN(chunk_size, data_size - start) * sizeof(DataType));
+        if (start != 0)
+        {
+            size_t previous = chunk_start[1 - k];
+            copied[1 - k].wait_and_throw();
+            chunk_function(staging[1 - k], SMIN(chunk_size, data_size - previous));
+        }
+    }
+    if (data_size != 0)
+    {
+        size_t last = ((data_size - 1) / chunk_size) % 2;
+        copied[last].wait_and_throw();
+        chunk_function(staging[last], data_size - chunk_start[last]);
+    }
+    freeDeviceData(staging[0]);
+    freeDeviceData(staging[1]);
+}
+//=================================================================================================//
+template <typename DataType>
+template <class ChunkFunction>
+void DiscreteVariable<DataType>::streamInData(
+    const ParallelDevicePolicy &ex_policy, size_t data_size, const ChunkFunction &chunk_function)
+{
+    if (!isDataDelegated())
+    {
+        chunk_function(Data(), data_size);
+        return;
+    }
+
+    execution::execution_instance.synchronize();
+    sycl::queue &queue = execution::execution_instance.getQueue();
+    size_t chunk_size = SMAX(BinaryStreamChunkBytes / sizeof(DataType), size_t(1));
+    DataType *staging[2] = {allocateHostStaging<DataType>(chunk_size),
+                            allocateHostStaging<DataType>(chunk_size)};
+    sycl::event copied[2];
+    bool is_submitted[2] = {false, false};
+    // a staging buffer is refilled only after its previous chunk is on the device
+    for (size_t start = 0, k = 0; start < data_size; start += chunk_size, k = 1 - k)
+    {
+        if (is_submitted[k])
+        {
+            copied[k].wait_and_throw();
+        }
+        size_t size = SMIN(chunk_size, data_size - start);
+        chunk_function(staging[k], size);
+        copied[k] = queue.memcpy(device_data_field_ + start, staging[k], size * sizeof(DataType));
+        is_submitted[k] = true;
+    }
+    freeDeviceData(staging[0]);
+    freeDeviceData(staging[1]);
+    // the host data are outdated and are synchronized from the device for output
+    is_device_data_writable_ = true;
+}
+//=================================================================================================//
+template <typename DataType>
 DeviceOnlyDiscreteVariable<DataType>::
     DeviceOnlyDiscreteVariable(DiscreteVariable<DataType> *host_variable)
-    : Entity(host_variable->Name()), device_only_data_field_(nullptr)
+    : Entity(host_variable->Name()), device_allocation_(host_variable->getDeviceAllocation()),
+      device_only_data_field_(nullptr), pinned_host_data_field_(nullptr)
+{
+    allocateDeviceData(host_variable);
+    if (!host_variable->isScratch())
+    {
+        copyToDevice(host_variable->Data(), device_only_data_field_, host_variable->getDataSize());
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+DeviceOnlyDiscreteVariable<DataType>::~DeviceOnlyDiscreteVariable()
+{
+    releaseHostData();
+    if (device_only_data_field_ != nullptr)
+    {
+        freeDeviceData(device_only_data_field_);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void DeviceOnlyDiscreteVariable<DataType>::
+    allocateDeviceData(DiscreteVariable<DataType> *host_variable)
 {
     size_t data_size = host_variable->getDataSize();
-    device_only_data_field_ = allocateDeviceOnly<DataType>(data_size);
-    copyToDevice(host_variable->Data(), device_only_data_field_, data_size);
+    ScratchBuffer *scratch_buffer = host_variable->getScratchBuffer();
+    if (scratch_buffer != nullptr)
+    {
+        void *aliased_data = scratch_buffer->DeviceData(
+            Name(), data_size * sizeof(DataType),
+            [host_variable](void *data)
+            { host_variable->setDeviceData(static_cast<DataType *>(data)); });
+        host_variable->setDeviceData(static_cast<DataType *>(aliased_data));
+        return;
+    }
+
+    if (device_allocation_ == DeviceAllocation::Shared)
+    {
+        device_only_data_field_ = allocateDeviceShared<DataType>(data_size);
+    }
+    else
+    {
+        device_only_data_field_ = allocateDeviceOnly<DataType>(data_size);
+    }
+
+    if (device_allocation_ == DeviceAllocation::PinnedHostMirror && !host_variable->isScratch())
+    {
+        pinned_host_data_field_ = host_variable->Data();
+        pinHostMemory(pinned_host_data_field_, data_size);
+    }
     host_variable->setDeviceData(device_only_data_field_);
 }
 //=================================================================================================//
 template <typename DataType>
-DeviceOnlyDiscreteVariable<DataType>::~DeviceOnlyDiscreteVariable()
+void DeviceOnlyDiscreteVariable<DataType>::releaseHostData()
 {
-    freeDeviceData(device_only_data_field_);
+    if (pinned_host_data_field_ != nullptr)
+    {
+        unpinHostMemory(pinned_host_data_field_);
+        pinned_host_data_field_ = nullptr;
+    }
 }
 //=================================================================================================//
 template <typename DataType>
 void DeviceOnlyDiscreteVariable<DataType>::
     reallocateData(DiscreteVariable<DataType> *host_variable)
 {
-    freeDeviceData(device_only_data_field_);
-    size_t new_host_variable_size = host_variable->getDataSize();
-    device_only_data_field_ = allocateDeviceOnly<DataType>(new_host_variable_size);
-    host_variable->setDeviceData(device_only_data_field_);
+    if (device_only_data_field_ != nullptr)
+    {
+        freeDeviceData(device_only_data_field_);
+        device_only_data_field_ = nullptr;
+    }
+    allocateDeviceData(host_variable);
 }
 //=================================================================================================//
 template <typename DataType>
@@ -83,6 +212,7 @@ DataType *DiscreteVariable<DataType>::DelegatedOnDevice()
 template <typename DataType>
 void DiscreteVariable<DataType>::reallocateDataOnDevice(size_t tentative_size)
 {
+    device_only_variable_->releaseHostData();
     reallocateData(tentative_size);
     device_only_variable_->reallocateData(this);
 }
@@ -13,14 +13,13 @@ void package_for(const ParallelDevicePolicy &par_device, UnsignedInt start_index
 {
     UnsignedInt operations = num_grid_pkgs - start_index;
     auto &sycl_queue = execution_instance.getQueue();
-    sycl_queue.submit([&](sycl::handler &cgh)
+    execution_instance.recordSubmission(sycl_queue.submit([&](sycl::handler &cgh)
                       { cgh.parallel_for(execution_instance.getUniformNdRange(operations),
                                          [=](sycl::nd_item<1> index)
                                          {
                                              if (index.get_global_id(0) < operations)
                                                  function(index.get_global_id(0) + start_index);
-                                         }); })
-        .wait_and_throw();
+                                         }); }));
 }
 //=================================================================================================//
 } // namespace SPH
@@ -0,0 +1,14 @@
+#include "implementation_sycl.h"
+
+namespace SPH
+{
+namespace execution
+{
+//=================================================================================================//
+void waitForDeviceSubmissions()
+{
+    execution_instance.synchronize();
+}
+//=================================================================================================//
+} // namespace execution
+} // namespace SPH
@@ -52,16 +52,96 @@ class ExecutionInstance
         return instance;
     }
 
+    /** The queue of the current device, which is used for kernel submission and memory allocation. */
     sycl::queue &getQueue()
     {
-        if (!sycl_queue_)
+        return getQueue(current_device_);
+    }
+
+    sycl::queue &getQueue(size_t device_index)
+    {
+        initializeDevices();
+        if (device_index >= devices_.size())
+        {
+            std::cout << "\n Error: SYCL device " << device_index << " is not available, only "
+                      << devices_.size() << " device(s) found!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        if (!sycl_queues_[device_index])
+        {
+            sycl_queues_[device_index] = makeUnique<sycl::queue>(
+                *sycl_context_, devices_[device_index], sycl::property_list{sycl::property::queue::in_order()});
+            if (device_index == current_device_)
+            {
+                updateWorkGroupSize(devices_[device_index]);
+            }
+        }
+        return *sycl_queues_[device_index];
+    }
+
+    size_t NumberOfDevices()
+    {
+        initializeDevices();
+        return devices_.size();
+    }
+
+    size_t CurrentDevice() const { return current_device_; };
+
+    /** Select the device on which the following kernels are submitted and data are allocated. */
+    void setCurrentDevice(size_t device_index)
+    {
+        current_device_ = device_index;
+        updateWorkGroupSize(getQueue(device_index).get_device());
+    }
+
+    /** With asynchronous submission, kernels are not waited for on the host. As the queues
+     *  are in order, the kernels on one device are chained by their submission sequence,
+     *  and the host only waits when device data are read, copied or freed. */
+    void setAsynchronousSubmission(bool is_asynchronous)
+    {
+        synchronize();
+        asynchronous_submission_ = is_asynchronous;
+    }
+
+    bool AsynchronousSubmission() const { return asynchronous_submission_; };
+
+    /** Record the event of a submitted kernel, or wait for it if submission is synchronous. */
+    void recordSubmission(sycl::event event)
+    {
+        if (asynchronous_submission_)
         {
-            sycl_queue_ = makeUnique<sycl::queue>(sycl::default_selector_v);
-            auto device = sycl_queue_->get_device();
-            unsigned long max_workgroup_size = device.get_info<sycl::info::device::max_work_group_size>();
-            work_group_size_ = SMIN(max_workgroup_size, 64UL);
+            last_events_[current_device_] = event;
+            has_pending_submission_ = true;
+        }
+        else
+        {
+            event.wait_and_throw();
+        }
+    }
+
+    /** The last kernel submitted to a device, used for dependencies from other devices. */
+    sycl::event LastEvent(size_t device_index)
+    {
+        initializeDevices();
+        return last_events_[device_index];
+    }
+
+    /** Wait for all pending kernels on all devices. */
+    void synchronize()
+    {
+        if (has_pending_submission_)
+        {
+            for (size_t i = 0; i != sycl_queues_.size(); ++i)
+            {
+                if (sycl_queues_[i])
+                {
+                    sycl_queues_[i]->wait_and_throw();
+                }
+            }
+            has_pending_submission_ = false;
         }
-        return *sycl_queue_;
     }
 
     auto getWorkGroupSize() const
@@ -86,13 +166,69 @@ class ExecutionInstance
     }
 
   private:
-    ExecutionInstance() : work_group_size_(128), sycl_queue_() {}
+    ExecutionInstance()
+        : work_group_size_(128), current_device_(0), sycl_context_(),
+          asynchronous_submission_(false), has_pending_submission_(false) {}
+
+    /** All GPUs of the default platform share one context, so that USM is valid among their queues. */
+    void initializeDevices()
+    {
+        if (!sycl_context_)
+        {
+            sycl::device default_device(sycl::default_selector_v);
+            if (default_device.is_gpu())
+            {
+                devices_ = default_device.get_platform().get_devices(sycl::info::device_type::gpu);
+            }
+            if (devices_.empty())
+            {
+                devices_.push_back(default_device);
+            }
+            sycl_context_ = makeUnique<sycl::context>(devices_);
+            sycl_queues_.resize(devices_.size());
+            last_events_.resize(devices_.size());
+        }
+    }
+
+    void updateWorkGroupSize(const sycl::device &device)
+    {
+        unsigned long max_workgroup_size = device.get_info<sycl::info::device::max_work_group_size>();
+        work_group_size_ = SMIN(max_workgroup_size, 64UL);
+    }
 
     size_t work_group_size_;
-    UniquePtr<sycl::queue> sycl_queue_;
+    size_t current_device_;
+    std::vector<sycl::device> devices_;
+    UniquePtr<sycl::context> sycl_context_;
+    StdVec<UniquePtr<sycl::queue>> sycl_queues_;
+    StdVec<sycl::event> last_events_;
+    bool asynchronous_submission_;
+    bool has_pending_submission_;
 
 } static &execution_instance = ExecutionInstance::getInstance();
 
+/**
+ * @class DeviceScope
+ * @brief Within the lifetime of the scope, dynamics are submitted to and data are allocated on
+ * the given device, so that a body or body part can be assigned to a device by constructing
+ * and executing its dynamics within a scope. The previous device is restored at the end.
+ */
+class DeviceScope
+{
+  public:
+    explicit DeviceScope(size_t device_index)
+        : previous_device_(execution_instance.CurrentDevice())
+    {
+        execution_instance.setCurrentDevice(device_index);
+    };
+    ~DeviceScope() { execution_instance.setCurrentDevice(previous_device_); };
+    DeviceScope(DeviceScope const &) = delete;
+    void operator=(DeviceScope const &) = delete;
+
+  protected:
+    size_t previous_device_;
+};
+
 } // namespace execution
 
 /* SYCL memory transfer utilities */
@@ -114,9 +250,29 @@ inline T *allocateHostStaging(std::size_t size)
     return sycl::malloc_host<T>(size, execution::execution_instance.getQueue());
 }
 
+/** Pin the pages of host memory so that the copies from and to the device are done by DMA. */
+template <class T>
+inline void pinHostMemory(T *host, std::size_t size)
+{
+#ifdef SYCL_EXT_ONEAPI_COPY_OPTIMIZE
+    sycl::ext::oneapi::experimental::prepare_for_device_copy(
+        host, size * sizeof(T), execution::execution_instance.getQueue());
+#endif
+}
+
+template <class T>
+inline void unpinHostMemory(T *host)
+{
+#ifdef SYCL_EXT_ONEAPI_COPY_OPTIMIZE
+    sycl::ext::oneapi::experimental::release_from_device_copy(
+        host, execution::execution_instance.getQueue());
+#endif
+}
+
 template <class T>
 inline void freeDeviceData(T *device_mem)
 {
+    execution::execution_instance.synchronize();
     sycl::free(device_mem, execution::execution_instance.getQueue());
 }
 
@@ -138,6 +294,14 @@ inline void copyFromDevice(T *host, const T *device, std::size_t size)
     execution::execution_instance.getQueue().memcpy(host, device, size * sizeof(T)).wait_and_throw();
 }
 
+/** Peer copy between the memory of two devices sharing the execution context,
+ *  e.g. for the contact data of bodies assigned to different devices. */
+template <class T>
+inline void copyBetweenDevices(T *destination, const T *source, std::size_t size)
+{
+    execution::execution_instance.getQueue().memcpy(destination, source, size * sizeof(T)).wait_and_throw();
+}
+
 namespace execution
 {
 template <class ComputingKernelType>
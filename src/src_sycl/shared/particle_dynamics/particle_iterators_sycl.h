@@ -31,6 +31,7 @@
 
 #include "implementation_sycl.h"
 #include "particle_iterators_ck.h"
+#include "work_group_tuner_sycl.h"
 
 namespace SPH
 {
@@ -41,12 +42,28 @@ void particle_for(const ParallelDevicePolicy &par_device,
 {
     auto &sycl_queue = execution_instance.getQueue();
     const size_t loop_bound = particles_range.size();
-    sycl_queue.submit([&](sycl::handler &cgh)
-                      { cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound), [=](sycl::nd_item<1> index)
+    work_group_size_tuner.submit<UnaryFunc>([&](size_t work_group_size)
+                                            { return sycl_queue.submit([&](sycl::handler &cgh)
+                      { cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound, work_group_size), [=](sycl::nd_item<1> index)
                                          {
                                  if(index.get_global_id(0) < loop_bound)
-                                     unary_func(index.get_global_id(0)); }); })
-        .wait_and_throw();
+                                     unary_func(index.get_global_id(0)); }); }); });
+}
+
+template <class UnaryFunc>
+void particle_for_in_cell_order(const ParallelDevicePolicy &par_device,
+                                const IndexRange &particles_range,
+                                const UnsignedInt *cell_sorted_index,
+                                const UnaryFunc &unary_func)
+{
+    auto &sycl_queue = execution_instance.getQueue();
+    const size_t loop_bound = particles_range.size();
+    work_group_size_tuner.submit<UnaryFunc>([&](size_t work_group_size)
+                                            { return sycl_queue.submit([&](sycl::handler &cgh)
+                      { cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound, work_group_size), [=](sycl::nd_item<1> index)
+                                         {
+                                 if(index.get_global_id(0) < loop_bound)
+                                     unary_func(cell_sorted_index[index.get_global_id(0)]); }); }); });
 }
 
 template <class Identifier, class UnaryFunc>
@@ -55,12 +72,11 @@ void particle_for(const LoopRangeCK<SequencedDevicePolicy, Identifier> &loop_ran
 {
     auto &sycl_queue = execution_instance.getQueue();
     const size_t loop_bound = loop_range.LoopBound();
-    sycl_queue.submit([&](sycl::handler &cgh)
+    execution_instance.recordSubmission(sycl_queue.submit([&](sycl::handler &cgh)
                       { cgh.single_task([=]()
                                         {
                                 for (int i = 0; i != loop_bound; i++)
-                                    loop_range.computeUnit(unary_func, i); }); })
-        .wait_and_throw();
+                                    loop_range.computeUnit(unary_func, i); }); }));
 }
 
 template <class Identifier, class UnaryFunc>
@@ -69,12 +85,73 @@ void particle_for(const LoopRangeCK<ParallelDevicePolicy, Identifier> &loop_rang
 {
     auto &sycl_queue = execution_instance.getQueue();
     const size_t loop_bound = loop_range.LoopBound();
-    sycl_queue.submit([&](sycl::handler &cgh)
-                      { cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound), [=](sycl::nd_item<1> index)
+    work_group_size_tuner.submit<UnaryFunc>([&](size_t work_group_size)
+                                            { return sycl_queue.submit([&](sycl::handler &cgh)
+                      { cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound, work_group_size), [=](sycl::nd_item<1> index)
                                          {
                                  if(index.get_global_id(0) < loop_bound)
-                                     loop_range.computeUnit(unary_func, index.get_global_id(0)); }); })
-        .wait_and_throw();
+                                     loop_range.computeUnit(unary_func, index.get_global_id(0)); }); }); });
+}
+
+/** The sub-group size required by the cooperative kernels. */
+constexpr UnsignedInt NeighborLaneSize = 32;
+
+/**
+ * @class SubGroupNeighborLanes
+ * @brief The work items of a sub-group loop the neighbor list of one particle together.
+ * The partial sums are reduced over the sub-group component by component.
+ */
+class SubGroupNeighborLanes
+{
+  public:
+    explicit SubGroupNeighborLanes(const sycl::sub_group &sub_group) : sub_group_(sub_group) {};
+    UnsignedInt Lane() const { return sub_group_.get_local_linear_id(); };
+    UnsignedInt Size() const { return sub_group_.get_local_linear_range(); };
+    bool isLeader() const { return Lane() == 0; };
+
+    template <typename DataType>
+    DataType reduce(const DataType &value) const
+    {
+        if constexpr (std::is_arithmetic_v<DataType>)
+        {
+            return sycl::reduce_over_group(sub_group_, value, sycl::plus<DataType>());
+        }
+        else
+        {
+            using Scalar = typename DataType::Scalar;
+            DataType sum = value;
+            for (UnsignedInt k = 0; k != UnsignedInt(value.size()); ++k)
+                sum.data()[k] = sycl::reduce_over_group(sub_group_, value.data()[k], sycl::plus<Scalar>());
+            return sum;
+        }
+    };
+
+  protected:
+    sycl::sub_group sub_group_;
+};
+
+/** One sub-group for each particle, whose work items are given to the function as lanes. */
+template <class Identifier, class LanesFunc>
+void particle_for_cooperative(const LoopRangeCK<ParallelDevicePolicy, Identifier> &loop_range,
+                              const LanesFunc &lanes_func)
+{
+    auto &sycl_queue = execution_instance.getQueue();
+    const size_t loop_bound = loop_range.LoopBound();
+    work_group_size_tuner.submit<LanesFunc>([&](size_t work_group_size)
+                                            {
+        size_t local_size = SMAX(work_group_size / NeighborLaneSize, size_t(1)) * NeighborLaneSize;
+        return sycl_queue.submit([&](sycl::handler &cgh)
+                      { cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound * NeighborLaneSize, local_size),
+                                         [=](sycl::nd_item<1> index) [[sycl::reqd_sub_group_size(NeighborLaneSize)]]
+                                         {
+                                 // all work items of a sub-group are on the same particle
+                                 size_t i = index.get_global_id(0) / NeighborLaneSize;
+                                 if(i < loop_bound)
+                                 {
+                                     SubGroupNeighborLanes lanes(index.get_sub_group());
+                                     loop_range.computeUnit([&](size_t index_i)
+                                                            { lanes_func(index_i, lanes); }, i);
+                                 } }); }); });
 }
 
 template <typename Operation, class Identifier, class ReturnType, class UnaryFunc>
@@ -87,18 +164,19 @@ ReturnType particle_reduce(const LoopRangeCK<ParallelDevicePolicy, Identifier> &
     {
         sycl::buffer<ReturnType> buffer_result(&temp, 1);
         sycl::buffer<ReturnType> buffer_reference(&temp0, 1);
-        sycl_queue.submit([&](sycl::handler &cgh)
+        work_group_size_tuner.submit<UnaryFunc>([&](size_t work_group_size)
+                                                { return sycl_queue.submit([&](sycl::handler &cgh)
                           {
                                 Operation operation;
                                 sycl::accessor acc(buffer_reference, cgh, sycl::read_only);
                                 auto reduction_operator = sycl::reduction(buffer_result, cgh, operation);
-                                cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound), reduction_operator,
+                                cgh.parallel_for(execution_instance.getUniformNdRange(loop_bound, work_group_size), reduction_operator,
                                                  [=](sycl::nd_item<1> item, auto &reduction)
                                                  {
                                                      if (item.get_global_id() < loop_bound)
                                                          reduction.combine(loop_range.computeUnit(
                                                              acc[0], operation, unary_func, item.get_global_id(0)));
-                                                 }); })
+                                                 }); }); })
             .wait_and_throw();
     } // buffer_result goes out of scope, so the result (of temp) is updated
     return temp;
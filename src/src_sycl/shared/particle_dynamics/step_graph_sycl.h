@@ -0,0 +1,95 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	step_graph_sycl.h
+ * @brief 	Recording the kernels of a time step once and replaying them as a SYCL graph.
+ * @details The recorded kernels keep the arguments captured at recording, e.g. the time step size
+ *          and the data pointers, and the host code of the step is not executed at replay.
+ *          Therefore, only steps of a fixed size without host reads, such as reductions,
+ *          can be recorded. The step is re-recorded when its structure key changes,
+ *          e.g. the number of particles or a counter of the relation updates.
+ *          Without the graph extension of the SYCL implementation, the step is executed as usual.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef STEP_GRAPH_SYCL_H
+#define STEP_GRAPH_SYCL_H
+
+#include "implementation_sycl.h"
+
+namespace SPH
+{
+namespace execution
+{
+class StepGraph
+{
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    using ModifiableGraph = sycl::ext::oneapi::experimental::command_graph<
+        sycl::ext::oneapi::experimental::graph_state::modifiable>;
+    using ExecutableGraph = sycl::ext::oneapi::experimental::command_graph<
+        sycl::ext::oneapi::experimental::graph_state::executable>;
+    UniquePtr<ExecutableGraph> executable_graph_;
+#endif
+    size_t structure_key_;
+
+  public:
+    StepGraph() : structure_key_(0) {};
+    ~StepGraph() {};
+    StepGraph(StepGraph const &) = delete;
+    void operator=(StepGraph const &) = delete;
+
+    /** Discard the recorded kernels so that the step is recorded again at the next execution. */
+    void reset()
+    {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        executable_graph_.reset();
+#endif
+    };
+
+    template <class StepFunction>
+    void exec(const StepFunction &step_function, size_t structure_key = 0)
+    {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        sycl::queue &sycl_queue = execution_instance.getQueue();
+        if (!executable_graph_ || structure_key != structure_key_)
+        {
+            // the kernels are not executed but recorded, so they can not be waited for
+            bool is_asynchronous = execution_instance.AsynchronousSubmission();
+            execution_instance.setAsynchronousSubmission(true);
+            ModifiableGraph graph(sycl_queue.get_context(), sycl_queue.get_device());
+            graph.begin_recording(sycl_queue);
+            step_function();
+            graph.end_recording(sycl_queue);
+            execution_instance.setAsynchronousSubmission(is_asynchronous);
+            executable_graph_ = makeUnique<ExecutableGraph>(graph.finalize());
+            structure_key_ = structure_key;
+        }
+        execution_instance.recordSubmission(sycl_queue.ext_oneapi_graph(*executable_graph_));
+#else
+        step_function();
+#endif
+    };
+};
+} // namespace execution
+} // namespace SPH
+#endif // STEP_GRAPH_SYCL_H
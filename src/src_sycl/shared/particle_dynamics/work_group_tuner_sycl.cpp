@@ -0,0 +1,101 @@
+#include "work_group_tuner_sycl.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace SPH
+{
+namespace execution
+{
+//=================================================================================================//
+void WorkGroupSizeTuner::enable(const std::string &cache_file)
+{
+    is_enabled_ = true;
+    cache_file_ = cache_file;
+    entries_.clear();
+    cached_sizes_.clear();
+
+    sycl::device device = execution_instance.getQueue().get_device();
+    device_name_ = device.get_info<sycl::info::device::name>();
+    size_t max_work_group_size = device.get_info<sycl::info::device::max_work_group_size>();
+    candidates_.clear();
+    for (size_t work_group_size = 32; work_group_size <= SMIN(max_work_group_size, size_t(1024));
+         work_group_size *= 2)
+    {
+        candidates_.push_back(work_group_size);
+    }
+    if (candidates_.empty())
+    {
+        candidates_.push_back(max_work_group_size);
+    }
+
+    std::ifstream in_file(cache_file_);
+    std::string line;
+    while (std::getline(in_file, line))
+    {
+        std::istringstream line_stream(line);
+        std::string device_name, kernel_name, work_group_size;
+        if (std::getline(line_stream, device_name, '\t') &&
+            std::getline(line_stream, kernel_name, '\t') &&
+            std::getline(line_stream, work_group_size))
+        {
+            cached_sizes_[std::make_pair(device_name, kernel_name)] = std::stoul(work_group_size);
+        }
+    }
+}
+//=================================================================================================//
+WorkGroupSizeTuner::TuningEntry &WorkGroupSizeTuner::getEntry(const std::string &kernel_name)
+{
+    auto found = entries_.find(kernel_name);
+    if (found != entries_.end())
+    {
+        return found->second;
+    }
+
+    TuningEntry &entry = entries_[kernel_name];
+    auto cached = cached_sizes_.find(std::make_pair(device_name_, kernel_name));
+    if (cached != cached_sizes_.end())
+    {
+        entry.best_work_group_size_ = cached->second;
+    }
+    return entry;
+}
+//=================================================================================================//
+void WorkGroupSizeTuner::recordLaunch(const std::string &kernel_name, TuningEntry &entry, Real time)
+{
+    // the first launch with the default size is a warm-up, which may include the kernel compilation
+    if (entry.launches_++ == 0)
+    {
+        return;
+    }
+
+    if (time < entry.best_time_)
+    {
+        entry.best_time_ = time;
+        entry.best_candidate_ = entry.candidate_;
+    }
+
+    if ((entry.launches_ - 1) % samples_per_candidate_ == 0)
+    {
+        entry.candidate_++;
+    }
+
+    if (entry.candidate_ == candidates_.size())
+    {
+        entry.best_work_group_size_ = candidates_[entry.best_candidate_];
+        cached_sizes_[std::make_pair(device_name_, kernel_name)] = entry.best_work_group_size_;
+        writeCacheFile();
+    }
+}
+//=================================================================================================//
+void WorkGroupSizeTuner::writeCacheFile()
+{
+    std::ofstream out_file(cache_file_, std::ios::trunc);
+    for (const auto &cached : cached_sizes_)
+    {
+        out_file << cached.first.first << '\t' << cached.first.second << '\t' << cached.second << '\n';
+    }
+}
+//=================================================================================================//
+} // namespace execution
+} // namespace SPH
@@ -0,0 +1,124 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2025 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	work_group_tuner_sycl.h
+ * @brief 	Work-group size tuning for the device kernels.
+ * @details The work-group size of each kernel is tuned on its first launches
+ *          and cached in a file for the device, so that the later runs use it directly.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef WORK_GROUP_TUNER_SYCL_H
+#define WORK_GROUP_TUNER_SYCL_H
+
+#include "implementation_sycl.h"
+
+#include <map>
+#include <typeinfo>
+
+namespace SPH
+{
+namespace execution
+{
+/**
+ * @class WorkGroupSizeTuner
+ * @brief The kernels are identified by the types of the functions launched,
+ * which differ for the local dynamics and their kernels.
+ * Each candidate work-group size is timed on the launches after a warm-up launch,
+ * which are synchronized to exclude the kernels submitted before.
+ * The tuning is disabled by default and the global work-group size is used.
+ */
+class WorkGroupSizeTuner
+{
+    struct TuningEntry
+    {
+        size_t best_work_group_size_ = 0; /**< zero if not tuned yet */
+        size_t candidate_ = 0;
+        size_t best_candidate_ = 0;
+        size_t launches_ = 0;
+        Real best_time_ = MaxReal;
+    };
+
+  public:
+    WorkGroupSizeTuner(WorkGroupSizeTuner const &) = delete;
+    void operator=(WorkGroupSizeTuner const &) = delete;
+
+    static WorkGroupSizeTuner &getInstance()
+    {
+        static WorkGroupSizeTuner instance;
+        return instance;
+    }
+
+    /** Enable the tuning with the cached work-group sizes read from the file if it exists. */
+    void enable(const std::string &cache_file = "work_group_sizes.dat");
+    bool isEnabled() const { return is_enabled_; };
+
+    /** Submit the kernel by the function with the work-group size as argument, which returns the event. */
+    template <class KernelType, class SubmitFunction>
+    sycl::event submit(const SubmitFunction &submit_function)
+    {
+        if (!is_enabled_)
+        {
+            sycl::event event = submit_function(execution_instance.getWorkGroupSize());
+            execution_instance.recordSubmission(event);
+            return event;
+        }
+
+        TuningEntry &entry = getEntry(typeid(KernelType).name());
+        if (entry.best_work_group_size_ != 0)
+        {
+            sycl::event event = submit_function(entry.best_work_group_size_);
+            execution_instance.recordSubmission(event);
+            return event;
+        }
+
+        execution_instance.synchronize();
+        size_t work_group_size = entry.launches_ == 0 ? execution_instance.getWorkGroupSize()
+                                                      : candidates_[entry.candidate_];
+        TickCount start = TickCount::now();
+        sycl::event event = submit_function(work_group_size);
+        event.wait_and_throw();
+        Real time = (TickCount::now() - start).seconds();
+        recordLaunch(typeid(KernelType).name(), entry, time);
+        return event;
+    }
+
+  private:
+    WorkGroupSizeTuner() : is_enabled_(false) {};
+
+    TuningEntry &getEntry(const std::string &kernel_name);
+    void recordLaunch(const std::string &kernel_name, TuningEntry &entry, Real time);
+    void writeCacheFile();
+
+    static constexpr size_t samples_per_candidate_ = 2;
+    bool is_enabled_;
+    std::string cache_file_;
+    std::string device_name_;
+    StdVec<size_t> candidates_;
+    std::map<std::string, TuningEntry> entries_;
+    /** the tuned sizes of all devices in the cache file, by device and kernel names */
+    std::map<std::pair<std::string, std::string>, size_t> cached_sizes_;
+} static &work_group_size_tuner = WorkGroupSizeTuner::getInstance();
+} // namespace execution
+} // namespace SPH
+#endif // WORK_GROUP_TUNER_SYCL_H
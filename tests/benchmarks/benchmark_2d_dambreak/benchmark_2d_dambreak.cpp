@@ -0,0 +1,113 @@
+/**
+ * @file 	benchmark_2d_dambreak.cpp
+ * @brief 	Benchmark of the 2D dambreak with a fixed number of steps.
+ * @details The setup follows test_2d_dambreak without output and regression test.
+ * @author 	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 5.366; /**< Water tank length. */
+Real DH = 5.366; /**< Water tank height. */
+Real LL = 2.0;   /**< Water column length. */
+Real LH = 1.0;   /**< Water column height. */
+//----------------------------------------------------------------------
+//	Material parameters.
+//----------------------------------------------------------------------
+Real rho0_f = 1.0;                       /**< Reference density of fluid. */
+Real gravity_g = 1.0;                    /**< Gravity. */
+Real U_ref = 2.0 * sqrt(gravity_g * LH); /**< Characteristic velocity. */
+Real c_f = 10.0 * U_ref;                 /**< Reference sound speed. */
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    BenchmarkParameters parameters = parseBenchmarkParameters(ac, av, 1000);
+    Real particle_spacing_ref = 0.025 / parameters.resolution_scale;
+    Real BW = particle_spacing_ref * 4;
+    //----------------------------------------------------------------------
+    //	Build up an SPHSystem.
+    //----------------------------------------------------------------------
+    BoundingBoxd system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing_ref);
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    Vec2d water_block_halfsize = Vec2d(0.5 * LL, 0.5 * LH);
+    GeometricShapeBox initial_water_block(Transform(water_block_halfsize), water_block_halfsize, "WaterBody");
+    FluidBody water_block(sph_system, initial_water_block);
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+
+    Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+    Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH);
+    ComplexShape wall_shape("WallBoundary");
+    wall_shape.add<GeometricShapeBox>(Transform(Vec2d(-BW, -BW) + outer_wall_halfsize), outer_wall_halfsize);
+    wall_shape.subtract<GeometricShapeBox>(Transform(inner_wall_halfsize), inner_wall_halfsize);
+    SolidBody wall_boundary(sph_system, wall_shape);
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation water_block_inner(water_block);
+    ContactRelation water_wall_contact(water_block, {&wall_boundary});
+    ComplexRelation water_wall_complex(water_block_inner, water_wall_contact);
+    //----------------------------------------------------------------------
+    // Define the numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vecd(0.0, -gravity_g));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(water_block, gravity);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+
+    Dynamics1Level<fluid_dynamics::Integration1stHalfWithWallRiemann> fluid_pressure_relaxation(water_block_inner, water_wall_contact);
+    Dynamics1Level<fluid_dynamics::Integration2ndHalfWithWallRiemann> fluid_density_relaxation(water_block_inner, water_wall_contact);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplexFreeSurface> fluid_density_by_summation(water_block_inner, water_wall_contact);
+
+    ReduceDynamics<fluid_dynamics::AdvectionTimeStep> fluid_advection_time_step(water_block, U_ref);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> fluid_acoustic_time_step(water_block);
+    ParticleSorting particle_sorting(water_block);
+    BenchmarkReport benchmark_report("2d_dambreak", sph_system, parameters);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+    //----------------------------------------------------------------------
+    //	Main loop with a fixed number of advection steps.
+    //----------------------------------------------------------------------
+    benchmark_report.startTiming();
+    for (size_t step = 0; step != parameters.number_of_steps; ++step)
+    {
+        Real advection_dt = fluid_advection_time_step.exec();
+        fluid_density_by_summation.exec();
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < advection_dt)
+        {
+            Real acoustic_dt = fluid_acoustic_time_step.exec();
+            fluid_pressure_relaxation.exec(acoustic_dt);
+            fluid_density_relaxation.exec(acoustic_dt);
+            relaxation_time += acoustic_dt;
+        }
+        benchmark_report.incrementStep();
+
+        if ((step + 1) % 100 == 0)
+        {
+            particle_sorting.exec();
+        }
+        benchmark_report.timeNeighborBuild([&]()
+                                           {
+                                               water_block.updateCellLinkedList();
+                                               water_wall_complex.updateConfiguration(); });
+    }
+    benchmark_report.writeToFile();
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file 	benchmark_2d_oscillating_beam.cpp
+ * @brief 	Benchmark of the 2D oscillating elastic beam with a fixed number of steps.
+ * @details The setup follows test_2d_oscillating_beam without output and regression test.
+ * @author 	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+using namespace SPH;
+//------------------------------------------------------------------------------
+// global parameters for the case
+//------------------------------------------------------------------------------
+Real PL = 0.2;  // beam length
+Real PH = 0.02; // beam thickness
+Real SL = 0.06; // depth of the insert
+//----------------------------------------------------------------------
+//	Material properties of the solid.
+//----------------------------------------------------------------------
+Real rho0_s = 1.0e3;         // reference density
+Real Youngs_modulus = 2.0e6; // reference Youngs modulus
+Real poisson = 0.3975;       // Poisson ratio
+//----------------------------------------------------------------------
+//	Parameters for initial condition on velocity
+//----------------------------------------------------------------------
+Real kl = 1.875;
+Real M = sin(kl) + sinh(kl);
+Real N = cos(kl) + cosh(kl);
+Real Q = 2.0 * (cos(kl) * sinh(kl) - sin(kl) * cosh(kl));
+Real vf = 0.05;
+//----------------------------------------------------------------------
+//	application dependent initial condition
+//----------------------------------------------------------------------
+class BeamInitialCondition
+    : public solid_dynamics::ElasticDynamicsInitialCondition
+{
+  public:
+    explicit BeamInitialCondition(SPHBody &sph_body)
+        : solid_dynamics::ElasticDynamicsInitialCondition(sph_body),
+          elastic_solid_(DynamicCast<ElasticSolid>(this, sph_body_->getBaseMaterial())) {};
+
+    void update(size_t index_i, Real dt)
+    {
+        Real x = pos_[index_i][0] / PL;
+        if (x > 0.0)
+        {
+            vel_[index_i][1] = vf * elastic_solid_.ReferenceSoundSpeed() *
+                               (M * (cos(kl * x) - cosh(kl * x)) - N * (sin(kl * x) - sinh(kl * x))) / Q;
+        }
+    };
+
+  protected:
+    ElasticSolid &elastic_solid_;
+};
+//------------------------------------------------------------------------------
+// the main program
+//------------------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    BenchmarkParameters parameters = parseBenchmarkParameters(ac, av, 5000);
+    Real resolution_ref = PH / 10.0 / parameters.resolution_scale;
+    Real BW = resolution_ref * 4;
+    //----------------------------------------------------------------------
+    //	Build up the environment of a SPHSystem.
+    //----------------------------------------------------------------------
+    BoundingBoxd system_domain_bounds(Vec2d(-SL - BW, -PL / 2.0), Vec2d(PL + 3.0 * BW, PL / 2.0));
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    //----------------------------------------------------------------------
+    //	Creating body, materials and particles.
+    //----------------------------------------------------------------------
+    std::vector<Vecd> beam_base_shape{
+        Vecd(-SL - BW, -PH / 2 - BW), Vecd(-SL - BW, PH / 2 + BW), Vecd(0.0, PH / 2 + BW),
+        Vecd(0.0, -PH / 2 - BW), Vecd(-SL - BW, -PH / 2 - BW)};
+    std::vector<Vecd> beam_shape{
+        Vecd(-SL, -PH / 2), Vecd(-SL, PH / 2), Vecd(PL, PH / 2), Vecd(PL, -PH / 2), Vecd(-SL, -PH / 2)};
+    MultiPolygon beam_multi_polygon;
+    beam_multi_polygon.addAPolygon(beam_base_shape, ShapeBooleanOps::add);
+    beam_multi_polygon.addAPolygon(beam_shape, ShapeBooleanOps::add);
+    SolidBody beam_body(sph_system, makeShared<MultiPolygonShape>(beam_multi_polygon, "BeamBody"));
+    beam_body.defineMaterial<SaintVenantKirchhoffSolid>(rho0_s, Youngs_modulus, poisson);
+    beam_body.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation beam_body_inner(beam_body);
+    //-----------------------------------------------------------------------------
+    // this section define all numerical methods will be used in this case
+    //-----------------------------------------------------------------------------
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> beam_corrected_configuration(beam_body_inner);
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> stress_relaxation_first_half(beam_body_inner);
+    Dynamics1Level<solid_dynamics::Integration2ndHalf> stress_relaxation_second_half(beam_body_inner);
+    SimpleDynamics<BeamInitialCondition> beam_initial_velocity(beam_body);
+    ReduceDynamics<solid_dynamics::AcousticTimeStep> computing_time_step_size(beam_body);
+
+    MultiPolygon constraint_multi_polygon;
+    constraint_multi_polygon.addAPolygon(beam_base_shape, ShapeBooleanOps::add);
+    constraint_multi_polygon.addAPolygon(beam_shape, ShapeBooleanOps::sub);
+    BodyRegionByParticle beam_base(beam_body, makeShared<MultiPolygonShape>(constraint_multi_polygon));
+    SimpleDynamics<FixBodyPartConstraint> constraint_beam_base(beam_base);
+    BenchmarkReport benchmark_report("2d_oscillating_beam", sph_system, parameters);
+    //----------------------------------------------------------------------
+    //	Setup computing and initial conditions.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    beam_initial_velocity.exec();
+    beam_corrected_configuration.exec();
+    //----------------------------------------------------------------------
+    //	Main loop with a fixed number of steps, the neighbor lists are total Lagrangian.
+    //----------------------------------------------------------------------
+    benchmark_report.startTiming();
+    Real dt = computing_time_step_size.exec();
+    for (size_t step = 0; step != parameters.number_of_steps; ++step)
+    {
+        stress_relaxation_first_half.exec(dt);
+        constraint_beam_base.exec();
+        stress_relaxation_second_half.exec(dt);
+        dt = computing_time_step_size.exec();
+        benchmark_report.incrementStep();
+    }
+    benchmark_report.writeToFile();
+
+    return 0;
+}
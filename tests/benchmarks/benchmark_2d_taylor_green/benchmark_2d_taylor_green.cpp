@@ -0,0 +1,118 @@
+/**
+ * @file 	benchmark_2d_taylor_green.cpp
+ * @brief 	Benchmark of the 2D Taylor-Green vortex with a fixed number of steps.
+ * @details The setup follows test_2d_taylor_green without output and regression test.
+ * @author 	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and material parameters.
+//----------------------------------------------------------------------
+Real DL = 1.0;                      /**< box length. */
+Real DH = 1.0;                      /**< box height. */
+Real rho0_f = 1.0;                  /**< Reference density of fluid. */
+Real U_f = 1.0;                     /**< Characteristic velocity. */
+Real c_f = 10.0 * U_f;              /**< Reference sound speed. */
+Real Re = 100;                      /**< Reynolds number. */
+Real mu_f = rho0_f * U_f * DL / Re; /**< Dynamics viscosity. */
+//----------------------------------------------------------------------
+//	application dependent initial condition
+//----------------------------------------------------------------------
+class TaylorGreenInitialCondition
+    : public fluid_dynamics::FluidInitialCondition
+{
+  public:
+    explicit TaylorGreenInitialCondition(SPHBody &sph_body)
+        : fluid_dynamics::FluidInitialCondition(sph_body) {};
+
+    void update(size_t index_i, Real dt)
+    {
+        vel_[index_i][0] = -cos(2.0 * Pi * pos_[index_i][0]) *
+                           sin(2.0 * Pi * pos_[index_i][1]);
+        vel_[index_i][1] = sin(2.0 * Pi * pos_[index_i][0]) *
+                           cos(2.0 * Pi * pos_[index_i][1]);
+    }
+};
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    BenchmarkParameters parameters = parseBenchmarkParameters(ac, av, 1000);
+    Real resolution_ref = 1.0 / 100.0 / parameters.resolution_scale;
+    //----------------------------------------------------------------------
+    //	Build up an SPHSystem.
+    //----------------------------------------------------------------------
+    BoundingBoxd system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    GeometricShapeBox water_block_shape(Transform(Vec2d(0.5 * DL, 0.5 * DH)), Vec2d(0.5 * DL, 0.5 * DH), "WaterBody");
+    FluidBody water_block(sph_system, water_block_shape);
+    water_block.defineClosure<WeaklyCompressibleFluid, Viscosity>(ConstructArgs(rho0_f, c_f), mu_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation water_block_inner(water_block);
+    //----------------------------------------------------------------------
+    // Define the numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    SimpleDynamics<TaylorGreenInitialCondition> initial_condition(water_block);
+    Dynamics1Level<fluid_dynamics::Integration1stHalfInnerRiemann> pressure_relaxation(water_block_inner);
+    Dynamics1Level<fluid_dynamics::Integration2ndHalfInnerNoRiemann> density_relaxation(water_block_inner);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationInner> update_density_by_summation(water_block_inner);
+    InteractionWithUpdate<fluid_dynamics::ViscousForceInner> viscous_force(water_block_inner);
+    InteractionWithUpdate<fluid_dynamics::TransportVelocityCorrectionInner<TruncatedLinear, AllParticles>> transport_velocity_correction(water_block_inner);
+    ReduceDynamics<fluid_dynamics::AdvectionViscousTimeStep> get_fluid_advection_time_step_size(water_block, U_f);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> get_fluid_time_step_size(water_block);
+    PeriodicAlongAxis periodic_along_x(water_block.getSPHBodyBounds(), xAxis);
+    PeriodicAlongAxis periodic_along_y(water_block.getSPHBodyBounds(), yAxis);
+    PeriodicConditionUsingCellLinkedList periodic_condition_x(water_block, periodic_along_x);
+    PeriodicConditionUsingCellLinkedList periodic_condition_y(water_block, periodic_along_y);
+    BenchmarkReport benchmark_report("2d_taylor_green", sph_system, parameters);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    initial_condition.exec();
+    sph_system.initializeSystemCellLinkedLists();
+    periodic_condition_x.update_cell_linked_list_.exec();
+    periodic_condition_y.update_cell_linked_list_.exec();
+    sph_system.initializeSystemConfigurations();
+    //----------------------------------------------------------------------
+    //	Main loop with a fixed number of advection steps.
+    //----------------------------------------------------------------------
+    benchmark_report.startTiming();
+    for (size_t step = 0; step != parameters.number_of_steps; ++step)
+    {
+        Real Dt = get_fluid_advection_time_step_size.exec();
+        update_density_by_summation.exec();
+        viscous_force.exec();
+        transport_velocity_correction.exec();
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < Dt)
+        {
+            Real dt = SMIN(get_fluid_time_step_size.exec(), Dt);
+            relaxation_time += dt;
+            pressure_relaxation.exec(dt);
+            density_relaxation.exec(dt);
+        }
+        benchmark_report.incrementStep();
+
+        periodic_condition_x.bounding_.exec();
+        periodic_condition_y.bounding_.exec();
+        benchmark_report.timeNeighborBuild([&]()
+                                           {
+                                               water_block.updateCellLinkedList();
+                                               periodic_condition_x.update_cell_linked_list_.exec();
+                                               periodic_condition_y.update_cell_linked_list_.exec();
+                                               water_block_inner.updateConfiguration(); });
+    }
+    benchmark_report.writeToFile();
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file 	benchmark_3d_dambreak.cpp
+ * @brief 	Benchmark of the 3D dambreak with a fixed number of steps.
+ * @details The setup follows test_3d_dambreak without output and regression test.
+ * @author 	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 5.366; /**< Tank length. */
+Real DH = 2.0;   /**< Tank height. */
+Real DW = 0.5;   /**< Tank width. */
+Real LL = 2.0;   /**< Liquid length. */
+Real LH = 1.0;   /**< Liquid height. */
+Real LW = 0.5;   /**< Liquid width. */
+//----------------------------------------------------------------------
+//	Material parameters.
+//----------------------------------------------------------------------
+Real rho0_f = 1.0;
+Real gravity_g = 1.0;
+Real U_f = 2.0 * sqrt(gravity_g * LH);
+Real c_f = 10.0 * U_f;
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    BenchmarkParameters parameters = parseBenchmarkParameters(ac, av, 200);
+    Real resolution_ref = 0.05 / parameters.resolution_scale;
+    Real BW = resolution_ref * 4;
+    //----------------------------------------------------------------------
+    //	Build up an SPHSystem.
+    //----------------------------------------------------------------------
+    BoundingBoxd system_domain_bounds(Vecd(-BW, -BW, -BW), Vecd(DL + BW, DH + BW, DW + BW));
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    Vecd halfsize_water(0.5 * LL, 0.5 * LH, 0.5 * LW);
+    GeometricShapeBox initial_water_block(Transform(halfsize_water), halfsize_water, "WaterBody");
+    FluidBody water_block(sph_system, initial_water_block);
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+
+    Vecd halfsize_outer(0.5 * DL + BW, 0.5 * DH + BW, 0.5 * DW + BW);
+    Vecd halfsize_inner(0.5 * DL, 0.5 * DH, 0.5 * DW);
+    ComplexShape wall_shape("WallBoundary");
+    wall_shape.add<GeometricShapeBox>(Transform(halfsize_inner), halfsize_outer);
+    wall_shape.subtract<GeometricShapeBox>(Transform(halfsize_inner), halfsize_inner);
+    SolidBody wall_boundary(sph_system, wall_shape);
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation water_block_inner(water_block);
+    ContactRelation water_wall_contact(water_block, {&wall_boundary});
+    ComplexRelation water_block_complex(water_block_inner, water_wall_contact);
+    //----------------------------------------------------------------------
+    //	Define the numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vec3d(0.0, -gravity_g, 0.0));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(water_block, gravity);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+
+    Dynamics1Level<fluid_dynamics::Integration1stHalfWithWallRiemann> pressure_relaxation(water_block_inner, water_wall_contact);
+    Dynamics1Level<fluid_dynamics::Integration2ndHalfWithWallRiemann> density_relaxation(water_block_inner, water_wall_contact);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplexFreeSurface> update_density_by_summation(water_block_inner, water_wall_contact);
+
+    ReduceDynamics<fluid_dynamics::AdvectionTimeStep> get_fluid_advection_time_step_size(water_block, U_f);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> get_fluid_time_step_size(water_block);
+    ParticleSorting particle_sorting(water_block);
+    BenchmarkReport benchmark_report("3d_dambreak", sph_system, parameters);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+    //----------------------------------------------------------------------
+    //	Main loop with a fixed number of advection steps.
+    //----------------------------------------------------------------------
+    benchmark_report.startTiming();
+    for (size_t step = 0; step != parameters.number_of_steps; ++step)
+    {
+        Real Dt = get_fluid_advection_time_step_size.exec();
+        update_density_by_summation.exec();
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < Dt)
+        {
+            Real dt = get_fluid_time_step_size.exec();
+            pressure_relaxation.exec(dt);
+            density_relaxation.exec(dt);
+            relaxation_time += dt;
+        }
+        benchmark_report.incrementStep();
+
+        if ((step + 1) % 100 == 0)
+        {
+            particle_sorting.exec();
+        }
+        benchmark_report.timeNeighborBuild([&]()
+                                           {
+                                               water_block.updateCellLinkedList();
+                                               water_block_complex.updateConfiguration(); });
+    }
+    benchmark_report.writeToFile();
+
+    return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file 	benchmark_report.h
+ * @brief 	Command line parameters and the machine-readable report of the benchmarks.
+ * @details A benchmark runs a fixed number of steps at a resolution scaled by --scale=<factor>,
+ *          and --steps=<number> overrides the default number of steps. The report, written as
+ *          JSON into the output folder, gives the particle steps per second, the time for
+ *          building the cell linked lists and neighbor lists, the peak resident memory
+ *          and the times of the particle dynamics recorded by the DynamicsProfiler.
+ *          With --machine=<tag>, the throughput is compared with the baseline of that machine
+ *          in the input folder, next to the reference data of the regression tests. The run fails
+ *          with a per-dynamics delta report if the particle steps per second drop by more than
+ *          --tolerance=<fraction>, 0.1 by default. The baseline is written if it does not exist,
+ *          or rewritten with --update-baseline, e.g. after an intended change of performance.
+ * @author 	Xiangyu Hu
+ */
+#ifndef BENCHMARK_REPORT_H
+#define BENCHMARK_REPORT_H
+
+#include "sphinxsys.h"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include <map>
+
+namespace SPH
+{
+struct BenchmarkParameters
+{
+    Real resolution_scale;  /**< the reference resolution is divided by this factor */
+    size_t number_of_steps; /**< number of advection steps to run */
+    std::string machine_tag; /**< the baseline to compare with, no comparison if empty */
+    Real tolerance;          /**< the allowed relative drop of the throughput */
+    bool is_baseline_updated;
+};
+
+inline BenchmarkParameters parseBenchmarkParameters(int ac, char *av[], size_t default_number_of_steps)
+{
+    BenchmarkParameters parameters{1.0, default_number_of_steps, "", 0.1, false};
+    for (int i = 1; i < ac; ++i)
+    {
+        std::string argument(av[i]);
+        if (argument.rfind("--scale=", 0) == 0)
+        {
+            parameters.resolution_scale = std::stod(argument.substr(8));
+        }
+        else if (argument.rfind("--steps=", 0) == 0)
+        {
+            parameters.number_of_steps = std::stoul(argument.substr(8));
+        }
+        else if (argument.rfind("--machine=", 0) == 0)
+        {
+            parameters.machine_tag = argument.substr(10);
+        }
+        else if (argument.rfind("--tolerance=", 0) == 0)
+        {
+            parameters.tolerance = std::stod(argument.substr(12));
+        }
+        else if (argument == "--update-baseline")
+        {
+            parameters.is_baseline_updated = true;
+        }
+        else
+        {
+            std::cout << "\n Error: unknown benchmark option " << argument
+                      << ", only --scale=<factor>, --steps=<number>, --machine=<tag>, "
+                      << "--tolerance=<fraction> and --update-baseline are allowed." << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+    return parameters;
+}
+
+/** peak resident memory of the process in bytes, zero if not available */
+inline size_t peakResidentMemory()
+{
+#ifdef __linux__
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return size_t(usage.ru_maxrss) * 1024; // ru_maxrss is in kilobytes
+#else
+    return 0;
+#endif
+}
+
+class BenchmarkReport
+{
+  public:
+    BenchmarkReport(const std::string &case_name, SPHSystem &sph_system, const BenchmarkParameters &parameters)
+        : case_name_(case_name), sph_system_(sph_system), parameters_(parameters)
+    {
+        DynamicsProfiler::get().enable();
+    };
+
+    /** start timing after the setup, so that only the stepping is measured */
+    void startTiming()
+    {
+        DynamicsProfiler::get().reset();
+        neighbor_build_time_ = TimeInterval();
+        start_ = TickCount::now();
+    };
+
+    void incrementStep()
+    {
+        number_of_steps_++;
+        DynamicsProfiler::get().incrementStep();
+    };
+
+    template <typename FunctionType>
+    void timeNeighborBuild(const FunctionType &function)
+    {
+        TickCount time_instance = TickCount::now();
+        function();
+        neighbor_build_time_ += TickCount::now() - time_instance;
+    };
+
+    void writeToFile()
+    {
+        Real wall_time = (TickCount::now() - start_).seconds();
+        size_t total_real_particles = 0;
+        for (SPHBody *body : sph_system_.getRealBodies())
+        {
+            total_real_particles += body->getBaseParticles().TotalRealParticles();
+        }
+        Real particle_steps_per_second = Real(total_real_particles) * Real(number_of_steps_) / wall_time;
+
+        std::string filefullpath = sph_system_.getIOEnvironment().OutputFolder() + "/" + case_name_ + "_benchmark.json";
+        std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+        out_file << std::setprecision(9) << "{\n"
+                 << " \"case\": \"" << case_name_ << "\",\n"
+                 << " \"dimensions\": " << Dimensions << ",\n"
+                 << " \"resolution_scale\": " << parameters_.resolution_scale << ",\n"
+                 << " \"particles\": " << total_real_particles << ",\n"
+                 << " \"steps\": " << number_of_steps_ << ",\n"
+                 << " \"wall_time\": " << wall_time << ",\n"
+                 << " \"particle_steps_per_second\": " << particle_steps_per_second << ",\n"
+                 << " \"neighbor_build_time\": " << neighbor_build_time_.seconds() << ",\n"
+                 << " \"peak_resident_memory\": " << peakResidentMemory() << ",\n"
+                 << " \"dynamics\": ";
+        DynamicsProfiler::get().writeJson(out_file);
+        out_file << "\n}\n";
+
+        std::cout << "\n " << case_name_ << ": " << total_real_particles << " particles, "
+                  << number_of_steps_ << " steps in " << wall_time << " seconds, "
+                  << particle_steps_per_second << " particle steps per second.\n"
+                  << " The benchmark report is written into " << filefullpath << "." << std::endl;
+
+        if (!parameters_.machine_tag.empty())
+        {
+            compareWithBaseline(total_real_particles, particle_steps_per_second);
+        }
+    };
+
+    /** the baseline has one entry "name<tab>value" per line, with the times per step of the dynamics */
+    void compareWithBaseline(size_t total_real_particles, Real particle_steps_per_second)
+    {
+        std::string filefullpath = sph_system_.getIOEnvironment().InputFolder() + "/" + case_name_ +
+                                   "_" + parameters_.machine_tag + "_benchmark_baseline.dat";
+        StdVec<std::pair<std::string, Real>> times_per_step = DynamicsProfiler::get().TimesPerStep();
+
+        if (parameters_.is_baseline_updated || !fs::exists(filefullpath))
+        {
+            std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+            out_file << std::setprecision(9)
+                     << "particles\t" << total_real_particles << "\n"
+                     << "particle_steps_per_second\t" << particle_steps_per_second << "\n";
+            for (const auto &time_per_step : times_per_step)
+            {
+                out_file << time_per_step.first << "\t" << time_per_step.second << "\n";
+            }
+            std::cout << " The baseline of machine " << parameters_.machine_tag
+                      << " is written into " << filefullpath << "." << std::endl;
+            return;
+        }
+
+        std::map<std::string, Real> baseline;
+        std::ifstream in_file(filefullpath.c_str());
+        std::string line;
+        while (std::getline(in_file, line))
+        {
+            size_t separator = line.rfind('\t');
+            if (separator != std::string::npos)
+            {
+                baseline[line.substr(0, separator)] = std::stod(line.substr(separator + 1));
+            }
+        }
+
+        if (size_t(baseline["particles"]) != total_real_particles)
+        {
+            std::cout << "\n Error: the baseline " << filefullpath << " is for " << size_t(baseline["particles"])
+                      << " particles, not comparable with " << total_real_particles
+                      << " particles of this run, check --scale or rerun with --update-baseline." << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        std::cout << "\n Comparison with the baseline of machine " << parameters_.machine_tag << ":\n"
+                  << std::setw(14) << "baseline[ms]" << std::setw(13) << "current[ms]"
+                  << std::setw(11) << "delta[%]" << "  dynamics at body\n";
+        for (const auto &time_per_step : times_per_step)
+        {
+            auto entry = baseline.find(time_per_step.first);
+            std::cout << std::fixed << std::setprecision(4);
+            if (entry == baseline.end())
+            {
+                std::cout << std::setw(14) << "-" << std::setw(13) << 1000.0 * time_per_step.second
+                          << std::setw(11) << "new";
+            }
+            else
+            {
+                Real delta = time_per_step.second / SMAX(entry->second, TinyReal) - 1.0;
+                std::cout << std::setw(14) << 1000.0 * entry->second << std::setw(13) << 1000.0 * time_per_step.second
+                          << std::setprecision(1) << std::setw(11) << 100.0 * delta
+                          << (delta > parameters_.tolerance ? " *" : "  ");
+            }
+            std::cout << "  " << time_per_step.first << "\n";
+        }
+
+        Real throughput_change = particle_steps_per_second / baseline["particle_steps_per_second"] - 1.0;
+        std::cout << std::setprecision(1) << " Throughput change " << 100.0 * throughput_change
+                  << "%, the dynamics slower than the tolerance are marked by *." << std::defaultfloat << std::endl;
+        if (throughput_change < -parameters_.tolerance)
+        {
+            std::cout << "\n Error: the throughput of " << case_name_ << " drops by more than "
+                      << 100.0 * parameters_.tolerance << "% from the baseline " << filefullpath << "." << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    };
+
+  private:
+    std::string case_name_;
+    SPHSystem &sph_system_;
+    BenchmarkParameters parameters_;
+    size_t number_of_steps_ = 0;
+    TickCount start_;
+    TimeInterval neighbor_build_time_;
+};
+} // namespace SPH
+#endif // BENCHMARK_REPORT_H
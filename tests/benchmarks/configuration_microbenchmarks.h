@@ -0,0 +1,234 @@
+/**
+ * @file 	configuration_microbenchmarks.h
+ * @brief 	Microbenchmarks for the configuration dynamics in isolation.
+ * @details The cell linked list build, the inner relation update and the particle sorting
+ *			are timed on synthetic particle distributions in the unit domain.
+ *			The distributions are uniform (lattice), clustered (Gaussian clusters) and
+ *			free surface (lattice filling the lower half of the domain).
+ *			The particle numbers are registered from 1e4 to 1e8, in which the larger ones
+ *			are usually selected with --benchmark_filter according to the memory available.
+ * @author 	Xiangyu Hu
+ */
+#ifndef CONFIGURATION_MICROBENCHMARKS_H
+#define CONFIGURATION_MICROBENCHMARKS_H
+
+#include "sphinxsys.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace SPH
+{
+enum class SyntheticDistribution
+{
+    Uniform,
+    Clustered,
+    FreeSurface
+};
+
+class SyntheticParticles;
+template <> // generate particles from the prepared synthetic positions
+class ParticleGenerator<BaseParticles, SyntheticParticles> : public ParticleGenerator<BaseParticles>
+{
+  public:
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, const StdVec<Vecd> &positions)
+        : ParticleGenerator<BaseParticles>(sph_body, base_particles), positions_(positions) {};
+    virtual void prepareGeometricData() override
+    {
+        Real volume = pow(particle_spacing_ref_, Dimensions);
+        for (size_t i = 0; i < positions_.size(); ++i)
+        {
+            addPositionAndVolumetricMeasure(positions_[i], volume);
+        }
+    };
+
+  protected:
+    const StdVec<Vecd> &positions_;
+};
+
+/** Lattice positions filling the lower fill_fraction part of the unit domain. */
+inline StdVec<Vecd> latticePositions(size_t total_particles, Real particle_spacing, Real fill_fraction)
+{
+    StdVec<Vecd> positions;
+    Arrayi number_of_lattices = Arrayi::Constant(int(std::ceil(1.0 / particle_spacing)));
+    number_of_lattices[1] = int(std::ceil(fill_fraction / particle_spacing));
+    mesh_for_each(Arrayi::Zero(), number_of_lattices,
+                  [&](const Arrayi &lattice)
+                  {
+                      if (positions.size() < total_particles)
+                      {
+                          positions.push_back((lattice.cast<Real>() + 0.5) * particle_spacing);
+                      }
+                  });
+    return positions;
+}
+
+/** Random positions around a few Gaussian cluster centers, clipped to the unit domain. */
+inline StdVec<Vecd> clusteredPositions(size_t total_particles, Real particle_spacing)
+{
+    std::mt19937 random_engine(1);
+    std::uniform_real_distribution<Real> center_distribution(0.2, 0.8);
+    std::normal_distribution<Real> offset_distribution(0.0, 0.1);
+    const size_t number_of_clusters = 16;
+    StdVec<Vecd> centers;
+    for (size_t k = 0; k != number_of_clusters; ++k)
+    {
+        Vecd center = Vecd::Zero();
+        for (int d = 0; d != Dimensions; ++d)
+        {
+            center[d] = center_distribution(random_engine);
+        }
+        centers.push_back(center);
+    }
+
+    StdVec<Vecd> positions;
+    positions.reserve(total_particles);
+    Vecd lower = 0.5 * particle_spacing * Vecd::Ones();
+    Vecd upper = Vecd::Ones() - lower;
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        Vecd position = centers[i % number_of_clusters];
+        for (int d = 0; d != Dimensions; ++d)
+        {
+            position[d] += offset_distribution(random_engine);
+        }
+        positions.push_back(position.cwiseMax(lower).cwiseMin(upper));
+    }
+    return positions;
+}
+
+/**
+ * A fluid body of the given number of synthetic particles in the unit domain,
+ * in which the particle spacing is chosen so that the particles of the uniform
+ * distribution fill the domain or, for the free-surface distribution, its lower half.
+ */
+class SyntheticConfiguration
+{
+  public:
+    SyntheticConfiguration(size_t total_particles, SyntheticDistribution distribution)
+        : fill_fraction_(distribution == SyntheticDistribution::FreeSurface ? 0.5 : 1.0),
+          particle_spacing_(pow(fill_fraction_ / Real(total_particles), 1.0 / Real(Dimensions))),
+          sph_system_(BoundingBoxd(Vecd::Zero(), Vecd::Ones()), particle_spacing_),
+          body_shape_(Transform(0.5 * Vecd::Ones()), 0.5 * Vecd::Ones(), "SyntheticBody"),
+          body_(sph_system_, body_shape_)
+    {
+        StdVec<Vecd> positions = distribution == SyntheticDistribution::Clustered
+                                     ? clusteredPositions(total_particles, particle_spacing_)
+                                     : latticePositions(total_particles, particle_spacing_, fill_fraction_);
+        body_.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+        body_.generateParticles<BaseParticles, SyntheticParticles>(positions);
+    };
+
+    RealBody &getBody() { return body_; };
+
+    /** Shuffle the particle positions so that each sorting starts from a disordered state. */
+    template <class ExecutionPolicy>
+    void shufflePositions(const ExecutionPolicy &ex_policy)
+    {
+        BaseParticles &particles = body_.getBaseParticles();
+        DiscreteVariable<Vecd> *dv_pos = particles.getVariableByName<Vecd>("Position");
+        dv_pos->prepareForOutput(ex_policy);
+        Vecd *pos = dv_pos->Data();
+        std::shuffle(pos, pos + particles.TotalRealParticles(), random_engine_);
+        dv_pos->finalizeLoadIn(ex_policy);
+    };
+
+  protected:
+    Real fill_fraction_;
+    Real particle_spacing_;
+    SPHSystem sph_system_;
+    GeometricShapeBox body_shape_;
+    FluidBody body_;
+    std::mt19937 random_engine_{2};
+};
+
+template <class ExecutionPolicy>
+void benchmarkCellLinkedList(benchmark::State &state, SyntheticDistribution distribution)
+{
+    SyntheticConfiguration configuration(state.range(0), distribution);
+    UpdateCellLinkedList<ExecutionPolicy, RealBody> update_cell_linked_list(configuration.getBody());
+    for (auto _ : state)
+    {
+        update_cell_linked_list.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ExecutionPolicy>
+void benchmarkInnerRelation(benchmark::State &state, SyntheticDistribution distribution)
+{
+    SyntheticConfiguration configuration(state.range(0), distribution);
+    Inner<> inner_relation(configuration.getBody());
+    UpdateCellLinkedList<ExecutionPolicy, RealBody> update_cell_linked_list(configuration.getBody());
+    UpdateRelation<ExecutionPolicy, Inner<>> update_inner_relation(inner_relation);
+    update_cell_linked_list.exec();
+    for (auto _ : state)
+    {
+        update_inner_relation.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ExecutionPolicy>
+void benchmarkParticleSort(benchmark::State &state, SyntheticDistribution distribution)
+{
+    SyntheticConfiguration configuration(state.range(0), distribution);
+    ParticleSortCK<ExecutionPolicy> particle_sort(configuration.getBody());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        configuration.shufflePositions(ExecutionPolicy{});
+        state.ResumeTiming();
+        particle_sort.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** Register all configuration microbenchmarks of an execution policy. */
+template <class ExecutionPolicy>
+void registerConfigurationMicrobenchmarks(const std::string &policy_name)
+{
+    const StdVec<std::pair<std::string, SyntheticDistribution>> distributions = {
+        {"Uniform", SyntheticDistribution::Uniform},
+        {"Clustered", SyntheticDistribution::Clustered},
+        {"FreeSurface", SyntheticDistribution::FreeSurface}};
+
+    for (auto &distribution : distributions)
+    {
+        std::string suffix = "/" + policy_name + "/" + distribution.first;
+        benchmark::RegisterBenchmark(("CellLinkedList" + suffix).c_str(),
+                                     benchmarkCellLinkedList<ExecutionPolicy>, distribution.second)
+            ->RangeMultiplier(10)
+            ->Range(10000, 100000000)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("InnerRelation" + suffix).c_str(),
+                                     benchmarkInnerRelation<ExecutionPolicy>, distribution.second)
+            ->RangeMultiplier(10)
+            ->Range(10000, 100000000)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("ParticleSort" + suffix).c_str(),
+                                     benchmarkParticleSort<ExecutionPolicy>, distribution.second)
+            ->RangeMultiplier(10)
+            ->Range(10000, 100000000)
+            ->Unit(benchmark::kMillisecond);
+    }
+}
+
+inline int runConfigurationMicrobenchmarks(int ac, char *av[])
+{
+    registerConfigurationMicrobenchmarks<execution::SequencedPolicy>("seq");
+    registerConfigurationMicrobenchmarks<execution::ParallelPolicy>("par_host");
+#if SPHINXSYS_USE_SYCL
+    registerConfigurationMicrobenchmarks<execution::ParallelDevicePolicy>("par_device");
+#endif
+    benchmark::Initialize(&ac, av);
+    if (benchmark::ReportUnrecognizedArguments(ac, av))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+} // namespace SPH
+#endif // CONFIGURATION_MICROBENCHMARKS_H
@@ -0,0 +1,12 @@
+/**
+ * @file 	microbenchmark_3d_configuration.cpp
+ * @brief 	Microbenchmarks of cell linked list, inner relation and particle sorting in 3D.
+ * @author 	Xiangyu Hu
+ */
+#include "configuration_microbenchmarks.h"
+using namespace SPH;
+
+int main(int ac, char *av[])
+{
+    return runConfigurationMicrobenchmarks(ac, av);
+}
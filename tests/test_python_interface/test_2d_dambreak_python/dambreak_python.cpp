@@ -5,7 +5,9 @@
  * 			understanding SPH method for fluid simulation.
  * @author	Luhui Han, Chi Zhang and Xiangyu Hu
  */
-#include "sphinxsys.h"         //SPHinXsys Library.
+#include "sphinxsys.h"          //SPHinXsys Library.
+#include "io_python_async_ck.h" //Asynchronous running without the interpreter lock.
+#include "io_python_view_ck.h"  //Zero-copy views of particle variables.
 #include <pybind11/pybind11.h> //pybind11 Library.
 namespace py = pybind11;
 using namespace SPH; // Namespace cite here.
@@ -133,6 +135,7 @@ class Environment : public PreSettingCase
         write_water_mechanical_energy;
     RegressionTestDynamicTimeWarping<ObservedQuantityRecording<Real>>
         write_recorded_water_pressure;
+    ParticleVariableViews<ParallelPolicy> water_block_variables;
     //----------------------------------------------------------------------
     //	Setup for time-stepping control
     //----------------------------------------------------------------------
@@ -170,7 +173,8 @@ class Environment : public PreSettingCase
           body_states_recording(sph_system),
           restart_io(sph_system),
           write_water_mechanical_energy(water_block, gravity),
-          write_recorded_water_pressure("Pressure", fluid_observer_contact)
+          write_recorded_water_pressure("Pressure", fluid_observer_contact),
+          water_block_variables(water_block.getBaseParticles())
     {
         //----------------------------------------------------------------------
         //	Prepare the simulation with cell linked list, configuration
@@ -199,6 +203,13 @@ class Environment : public PreSettingCase
         return 1;
     }
     //----------------------------------------------------------------------
+    //	For reading the particle states from python without copy.
+    //----------------------------------------------------------------------
+    ParticleVariableViews<ParallelPolicy> &waterBlockVariables()
+    {
+        return water_block_variables;
+    }
+    //----------------------------------------------------------------------
     //	Main loop starts here.
     //----------------------------------------------------------------------
     void runCase(Real End_time)
@@ -298,8 +309,15 @@ class Environment : public PreSettingCase
 /** test_2d_dambreak_python should be same with the project name */
 PYBIND11_MODULE(test_2d_dambreak_python, m)
 {
+    bindParticleVariableViews<ParallelPolicy>(m, "ParticleVariableViews");
+    bindAsyncStep(m, "AsyncStep");
     py::class_<Environment>(m, "dambreak_from_sph_cpp")
         .def(py::init<const int &>())
         .def("CmakeTest", &Environment::cmakeTest)
-        .def("RunCase", &Environment::runCase);
+        .def("RunCase", &Environment::runCase, py::call_guard<py::gil_scoped_release>())
+        .def(
+            "RunCaseAsync", [](Environment &environment, Real end_time)
+            { return launchAsyncStep(environment, &Environment::runCase, end_time); },
+            py::keep_alive<0, 1>())
+        .def("WaterBlockVariables", &Environment::waterBlockVariables, py::return_value_policy::reference_internal);
 }
@@ -34,6 +34,11 @@ def run_case():
     project = test_2d.dambreak_from_sph_cpp(case.restart_step)
     if project.CmakeTest() == 1:
         project.RunCase(case.end_time)
+        # read the particle states without copy
+        water_block_variables = project.WaterBlockVariables()
+        water_block_variables.sync()
+        pressure = water_block_variables.real("Pressure")
+        print("max pressure of the water block: ", pressure.max())
     else:
         print("check path: ", path)
         
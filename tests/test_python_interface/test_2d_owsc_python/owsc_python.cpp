@@ -6,6 +6,7 @@
 #include "owsc_python.h"
 #include "custom_io_observation.h"
 #include "custom_io_simbody.h"
+#include "io_python_async_ck.h"
 #include "sphinxsys.h"
 #include <pybind11/pybind11.h>
 
@@ -397,6 +398,7 @@ class SphOWSC : public SimbodyEnvironment
 
 PYBIND11_MODULE(test_2d_owsc_python, m)
 {
+    bindAsyncStep(m, "AsyncStep");
     py::class_<SphOWSC>(m, "owsc_from_sph_cpp")
         .def(py::init<const int &, const int &>())
         .def("cmake_test", &SphOWSC::cmakeTest)
@@ -406,5 +408,9 @@ PYBIND11_MODULE(test_2d_owsc_python, m)
         .def("get_wave_velocity", &SphOWSC::getWaveVelocity)
         .def("get_wave_velocity_on_flap", &SphOWSC::getWaveVelocityOnFlap)
         .def("get_flap_position", &SphOWSC::getFlapPositon)
-        .def("run_case", &SphOWSC::runCase);
+        .def("run_case", &SphOWSC::runCase, py::call_guard<py::gil_scoped_release>())
+        .def(
+            "run_case_async", [](SphOWSC &owsc, Real pause_time, Real damping_coefficient)
+            { return launchAsyncStep(owsc, &SphOWSC::runCase, pause_time, damping_coefficient); },
+            py::keep_alive<0, 1>());
 }
@@ -295,7 +295,7 @@ int main(int ac, char *av[])
         bidirectional_velocity_condition_left(left_emitter_by_cell, DH, U_f, mu_f);
     fluid_dynamics::BidirectionalBoundaryCK<MainExecutionPolicy, LinearCorrectionCK, PressurePrescribed<>>
         bidirectional_pressure_condition_right(right_emitter_by_cell, Outlet_pressure);
-    StateDynamics<MainExecutionPolicy, fluid_dynamics::OutflowParticleDeletion> out_flow_particle_deletion(water_body);
+    fluid_dynamics::OutflowParticleDeletionCK<MainExecutionPolicy> out_flow_particle_deletion(water_body);
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations, observations
     //	and regression tests of the simulation.
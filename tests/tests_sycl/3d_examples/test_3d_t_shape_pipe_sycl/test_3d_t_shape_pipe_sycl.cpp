@@ -341,7 +341,7 @@ void run_t_shape_pipe(Parameters &params, bool run_relaxation, bool reload_parti
         bidirectional_pressure_conditions.emplace_back(
             std::make_unique<PressureBC<MainExecutionPolicy, LinearCorrectionCK>>(
                 water_block, boundary, params.t_ref));
-    StateDynamics<MainExecutionPolicy, fluid_dynamics::OutflowParticleDeletion> particle_deletion(water_block);
+    fluid_dynamics::OutflowParticleDeletionCK<MainExecutionPolicy> particle_deletion(water_block);
     InteractionDynamicsCK<
         MainExecutionPolicy,
         fluid_dynamics::DensityRegularizationComplexInternalPressureBoundary>
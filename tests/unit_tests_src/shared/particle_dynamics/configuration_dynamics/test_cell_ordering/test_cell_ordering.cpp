@@ -0,0 +1,77 @@
+#include "base_mesh.hpp"
+
+#include <gtest/gtest.h>
+using namespace SPH;
+
+StdVec<Array2i> allCells(const Array2i &number_of_cells)
+{
+    StdVec<Array2i> cells;
+    for (int i = 0; i != number_of_cells[0]; ++i)
+        for (int j = 0; j != number_of_cells[1]; ++j)
+            cells.push_back(Array2i(i, j));
+    return cells;
+}
+
+StdVec<Array3i> allCells(const Array3i &number_of_cells)
+{
+    StdVec<Array3i> cells;
+    for (int i = 0; i != number_of_cells[0]; ++i)
+        for (int j = 0; j != number_of_cells[1]; ++j)
+            for (int k = 0; k != number_of_cells[2]; ++k)
+                cells.push_back(Array3i(i, j, k));
+    return cells;
+}
+
+template <typename CellIndexType, typename OrderingFunction>
+StdVec<std::pair<UnsignedInt, CellIndexType>> orderCells(const CellIndexType &number_of_cells,
+                                                         const OrderingFunction &ordering)
+{
+    StdVec<std::pair<UnsignedInt, CellIndexType>> ordered_cells;
+    for (const CellIndexType &cell_index : allCells(number_of_cells))
+    {
+        ordered_cells.push_back(std::make_pair(ordering(cell_index), cell_index));
+    }
+    std::sort(ordered_cells.begin(), ordered_cells.end(),
+              [](const auto &a, const auto &b)
+              { return a.first < b.first; });
+    return ordered_cells;
+}
+
+template <typename CellIndexType>
+void testHilbertOrdering(const CellIndexType &number_of_cells)
+{
+    auto ordered_cells = orderCells(number_of_cells, [](const CellIndexType &cell_index)
+                                    { return Mesh::transferMeshIndexToHilbertOrder(cell_index); });
+    for (size_t n = 1; n != ordered_cells.size(); ++n)
+    {
+        EXPECT_LT(ordered_cells[n - 1].first, ordered_cells[n].first);
+        // consecutive cells along a Hilbert curve are face neighbors
+        EXPECT_EQ((ordered_cells[n].second - ordered_cells[n - 1].second).abs().sum(), 1);
+    }
+}
+
+TEST(CellOrdering, Hilbert2d)
+{
+    testHilbertOrdering(Array2i(16, 16));
+}
+
+TEST(CellOrdering, Hilbert3d)
+{
+    testHilbertOrdering(Array3i(8, 8, 8));
+}
+
+TEST(CellOrdering, Morton3d)
+{
+    auto ordered_cells = orderCells(Array3i(8, 8, 8), [](const Array3i &cell_index)
+                                    { return Mesh::transferMeshIndexToMortonOrder(cell_index); });
+    for (size_t n = 1; n != ordered_cells.size(); ++n)
+    {
+        EXPECT_LT(ordered_cells[n - 1].first, ordered_cells[n].first);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
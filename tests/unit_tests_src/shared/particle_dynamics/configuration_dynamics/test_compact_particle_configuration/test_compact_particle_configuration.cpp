@@ -0,0 +1,82 @@
+#include "neighborhood.h"
+
+#include <gtest/gtest.h>
+using namespace SPH;
+
+TEST(CompactParticleConfiguration, assign_neighbors)
+{
+    StdVec<size_t> neighbor_size_list{3, 0, 2, 1};
+    size_t total_particles = neighbor_size_list.size();
+    CompactParticleConfiguration compact_configuration(total_particles);
+
+    StdVec<Neighborhood> neighborhoods(total_particles);
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        Neighborhood &neighborhood = neighborhoods[i];
+        for (size_t n = 0; n != neighbor_size_list[i]; ++n)
+        {
+            neighborhood.j_.push_back(10 * i + n);
+            neighborhood.W_ij_.push_back(Real(i));
+            neighborhood.dW_ij_.push_back(-Real(n));
+            neighborhood.r_ij_.push_back(Real(i + n));
+            neighborhood.e_ij_.push_back(Vecd::Ones());
+            neighborhood.current_size_++;
+        }
+        compact_configuration.neighbor_size_[i] = neighborhood.current_size_;
+    }
+
+    compact_configuration.allocateNeighbors(total_particles);
+    EXPECT_EQ(compact_configuration.TotalNeighbors(), size_t(6));
+
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        compact_configuration.assignNeighbors(i, neighborhoods[i]);
+    }
+
+    for (size_t i = 0; i != total_particles; ++i)
+    {
+        CompactNeighborhood neighborhood = compact_configuration[i];
+        EXPECT_EQ(neighborhood.current_size_, neighbor_size_list[i]);
+        for (size_t n = 0; n != neighborhood.current_size_; ++n)
+        {
+            EXPECT_EQ(neighborhood.j_[n], 10 * i + n);
+            EXPECT_EQ(neighborhood.W_ij_[n], Real(i));
+            EXPECT_EQ(neighborhood.dW_ij_[n], -Real(n));
+            EXPECT_EQ(neighborhood.r_ij_[n], Real(i + n));
+        }
+    }
+}
+
+TEST(CompactParticleConfiguration, on_the_fly_kernel)
+{
+    Real h = 0.1;
+    KernelWendlandC2 kernel(h);
+    OnTheFlyKernel on_the_fly_kernel(kernel);
+    CompactParticleConfiguration compact_configuration(2, false);
+    EXPECT_FALSE(compact_configuration.isKernelValueStored());
+
+    Neighborhood neighborhood;
+    Vecd displacement = 0.7 * h * Vecd::UnitX();
+    Real distance = displacement.norm();
+    neighborhood.j_.push_back(1);
+    neighborhood.r_ij_.push_back(distance);
+    neighborhood.current_size_ = 1;
+    compact_configuration.neighbor_size_[0] = 1;
+    compact_configuration.neighbor_size_[1] = 0;
+    compact_configuration.allocateNeighbors(2);
+    compact_configuration.assignNeighbors(0, neighborhood);
+
+    CompactNeighborhood compact_neighborhood = compact_configuration[0];
+    EXPECT_EQ(compact_neighborhood.W_ij_, nullptr);
+    Real r_ij = compact_neighborhood.r_ij_[0];
+    EXPECT_NEAR(on_the_fly_kernel.W(r_ij, displacement), kernel.W(distance, displacement),
+                1.0e-3 * kernel.W0(displacement));
+    EXPECT_NEAR(on_the_fly_kernel.dW(r_ij, displacement), kernel.dW(distance, displacement),
+                1.0e-3 * kernel.W0(displacement) / h);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
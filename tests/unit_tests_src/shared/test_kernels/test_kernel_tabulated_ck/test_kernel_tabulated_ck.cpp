@@ -0,0 +1,37 @@
+#include "kernel_wendland_c2.h"
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+
+class TabulatedKernelChecker : public KernelTabulatedLinearCK<1024>, public KernelTabulatedCubicCK<20>
+{
+  public:
+    explicit TabulatedKernelChecker(Kernel &kernel)
+        : KernelTabulatedLinearCK<1024>(kernel), KernelTabulatedCubicCK<20>(kernel) {};
+
+    Real linearW(Real q) const { return KernelTabulatedLinearCK<1024>::normalized_W(q); };
+    Real linearDW(Real q) const { return KernelTabulatedLinearCK<1024>::normalized_dW(q); };
+    Real cubicW(Real q) const { return KernelTabulatedCubicCK<20>::normalized_W(q); };
+    Real cubicDW(Real q) const { return KernelTabulatedCubicCK<20>::normalized_dW(q); };
+};
+
+TEST(test_KernelTabulatedCK, test_linear_and_cubic_interpolation)
+{
+    KernelWendlandC2 kernel(1.0);
+    TabulatedKernelChecker checker(kernel);
+    Real tolerance = 1.0e-4 * kernel.W_1D(0.0);
+    for (Real q = 0.0; q < kernel.KernelSize(); q += 0.0137)
+    {
+        EXPECT_NEAR(checker.linearW(q), kernel.W_1D(q), tolerance);
+        EXPECT_NEAR(checker.linearDW(q), kernel.dW_1D(q), tolerance);
+        EXPECT_NEAR(checker.cubicW(q), kernel.W_1D(q), tolerance);
+        EXPECT_NEAR(checker.cubicDW(q), kernel.dW_1D(q), tolerance);
+    }
+    EXPECT_NEAR(checker.linearW(kernel.KernelSize()), 0.0, tolerance);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}